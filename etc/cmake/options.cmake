@@ -30,6 +30,11 @@ find_package(PkgConfig)
 
 option(OTBR_DOC "Build documentation" OFF)
 
+option(OTBR_ALLOC_PROFILING "Enable per-subsystem heap allocation accounting" OFF)
+if (OTBR_ALLOC_PROFILING)
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_ALLOC_PROFILING=1)
+endif()
+
 option(OTBR_BORDER_AGENT "Enable Border Agent" ON)
 if (OTBR_BORDER_AGENT)
     target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_BORDER_AGENT=1)
@@ -54,6 +59,11 @@ if (OTBR_FEATURE_FLAGS)
     target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_FEATURE_FLAGS=1)
 endif()
 
+option(OTBR_EPOLL "Use epoll(7) instead of select(2) for the agent mainloop" OFF)
+if(OTBR_EPOLL)
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_EPOLL_MAINLOOP=1)
+endif()
+
 option(OTBR_DUA_ROUTING "Enable Backbone Router DUA Routing" OFF)
 if (OTBR_DUA_ROUTING)
     target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_DUA_ROUTING=1)
@@ -84,6 +94,11 @@ if(OTBR_UNSECURE_JOIN)
     target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_UNSECURE_JOIN=1)
 endif()
 
+option(OTBR_TELEMETRY_SHM "Enable the shared-memory bulk telemetry segment" OFF)
+if(OTBR_TELEMETRY_SHM)
+    target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_TELEMETRY_SHM=1)
+endif()
+
 option(OTBR_TREL "Enable TREL link support." OFF)
 if(OTBR_TREL)
     target_compile_definitions(otbr-config INTERFACE OTBR_ENABLE_TREL=1)
@@ -37,16 +37,81 @@
 #include <systemd/sd-daemon.h>
 #endif
 
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <sys/time.h>
+
 #include "agent/application.hpp"
+#include "common/alloc_tracker.hpp"
 #include "common/code_utils.hpp"
 #include "common/mainloop_manager.hpp"
+#include "common/metrics.hpp"
+#include "common/perf_config.hpp"
+#include "common/time.hpp"
+#include "common/tracing.hpp"
 #include "utils/infra_link_selector.hpp"
 
 namespace otbr {
 
 std::atomic_bool     Application::sShouldTerminate(false);
+std::atomic_bool     Application::sShouldToggleTracing(false);
+std::atomic_bool     Application::sShouldDumpTrace(false);
+std::atomic_bool     Application::sShouldReloadPerfConfig(false);
 const struct timeval Application::kPollTimeout = {10, 0};
 
+// Where a SIGUSR2-triggered trace dump is written.
+static const char kTraceDumpPath[] = "/tmp/otbr-agent-trace.json";
+
+// Comma-separated list of optional subsystem tokens ("backbone", "ubus",
+// "rest", "dbus", "telemetry", "vendor") that must not be started; lets SKUs
+// that compile these features in ship with them turned off.
+static const char kDisabledSubsystemsEnv[] = "OTBR_DISABLED_SUBSYSTEMS";
+
+// Percentage of wall time the mainloop may spend processing before the
+// watchdog keepalive is withheld; a loop pinned above this never waits in
+// the poll and is treated as livelocked.
+static const uint64_t kLoopBusyPercentMax = 95;
+
+// Returns the process CPU time (user plus system) in microseconds.
+static uint64_t GetCpuTimeUsec(void)
+{
+    struct rusage usage;
+    uint64_t      cpu = 0;
+
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+    {
+        cpu = static_cast<uint64_t>(usage.ru_utime.tv_sec) * 1000000 + usage.ru_utime.tv_usec +
+              static_cast<uint64_t>(usage.ru_stime.tv_sec) * 1000000 + usage.ru_stime.tv_usec;
+    }
+
+    return cpu;
+}
+
+static void AccountLoopCycle(int aReadyFds, uint64_t aWaitUsec, uint64_t aBusyUsec, uint64_t aCpuUsec)
+{
+    static Metrics::Counter &sCycles =
+        Metrics::GetInstance().RegisterCounter("otbr_mainloop_cycles_total", "Number of agent mainloop cycles.");
+    static Metrics::Counter &sReadyFds = Metrics::GetInstance().RegisterCounter(
+        "otbr_mainloop_ready_fds_total", "Number of ready file descriptors returned by the mainloop poll.");
+    static Metrics::Histogram &sWait = Metrics::GetInstance().RegisterHistogram(
+        "otbr_mainloop_wait_usec", "Time the mainloop spent waiting in the poll, in microseconds.");
+    static Metrics::Histogram &sBusy = Metrics::GetInstance().RegisterHistogram(
+        "otbr_mainloop_busy_usec", "Time the mainloop spent processing per cycle, in microseconds.");
+    static Metrics::Histogram &sCpu = Metrics::GetInstance().RegisterHistogram(
+        "otbr_mainloop_cpu_usec", "Process CPU time consumed per mainloop cycle, in microseconds.");
+
+    sCycles.Increment();
+    sWait.Observe(aWaitUsec);
+    sBusy.Observe(aBusyUsec);
+    sCpu.Observe(aCpuUsec);
+
+    if (aReadyFds > 0)
+    {
+        sReadyFds.Increment(static_cast<uint64_t>(aReadyFds));
+    }
+}
+
 Application::Application(const std::string &              aInterfaceName,
                          const std::vector<const char *> &aBackboneInterfaceNames,
                          const std::vector<const char *> &aRadioUrls,
@@ -62,50 +127,121 @@ Application::Application(const std::string &              aInterfaceName,
 #if OTBR_ENABLE_BORDER_AGENT
     , mBorderAgent(mNcp)
 #endif
-#if OTBR_ENABLE_BACKBONE_ROUTER
-    , mBackboneAgent(mNcp, aInterfaceName, mBackboneInterfaceName)
-#endif
-#if OTBR_ENABLE_OPENWRT
-    , mUbusAgent(mNcp)
-#endif
-#if OTBR_ENABLE_REST_SERVER
-    , mRestWebServer(mNcp)
-#endif
-#if OTBR_ENABLE_DBUS_SERVER && OTBR_ENABLE_BORDER_AGENT
-    , mDBusAgent(mNcp, mBorderAgent.GetPublisher())
-#endif
-#if OTBR_ENABLE_VENDOR_SERVER
-    , mVendorServer(mNcp)
-#endif
 {
 }
 
 void Application::Init(void)
 {
-    mNcp.Init();
+    Clock::time_point start = Clock::now();
+
+#if OTBR_ENABLE_EPOLL_MAINLOOP
+    SuccessOrDie(mEpollMainloop.Init(), "Failed to initialize the epoll mainloop!");
+#endif
+
+    // Apply file-provided performance tunings before the subsystems read them.
+    PerfConfig::GetInstance().Reload();
+
+    InitStage("NCP controller", [this]() { mNcp.Init(); });
 
 #if OTBR_ENABLE_BORDER_AGENT
-    mBorderAgent.Init();
+    InitStage("border agent", [this]() { mBorderAgent.Init(); });
 #endif
 #if OTBR_ENABLE_BACKBONE_ROUTER
-    mBackboneAgent.Init();
+    InitOptionalStage("backbone agent", "backbone", [this]() {
+        mBackboneAgent = MakeUnique<BackboneRouter::BackboneAgent>(mNcp, mInterfaceName, mBackboneInterfaceName);
+        mBackboneAgent->Init();
+    });
 #endif
 #if OTBR_ENABLE_OPENWRT
-    mUbusAgent.Init();
+    InitOptionalStage("ubus agent", "ubus", [this]() {
+        mUbusAgent = MakeUnique<ubus::UBusAgent>(mNcp);
+        mUbusAgent->Init();
+    });
 #endif
 #if OTBR_ENABLE_REST_SERVER
-    mRestWebServer.Init();
+    InitOptionalStage("REST server", "rest", [this]() {
+        mRestWebServer = MakeUnique<rest::RestWebServer>(mNcp);
+        mRestWebServer->Init();
+    });
+#endif
+#if OTBR_ENABLE_DBUS_SERVER && OTBR_ENABLE_BORDER_AGENT
+    InitOptionalStage("DBus agent", "dbus", [this]() {
+        mDBusAgent = MakeUnique<DBus::DBusAgent>(mNcp, mBorderAgent.GetPublisher());
+        mDBusAgent->Init();
+    });
 #endif
-#if OTBR_ENABLE_DBUS_SERVER
-    mDBusAgent.Init();
+#if OTBR_ENABLE_TELEMETRY_SHM
+    InitOptionalStage("telemetry publisher", "telemetry", [this]() {
+        mTelemetryPublisher = MakeUnique<Telemetry::TelemetryShmPublisher>(mNcp);
+        mTelemetryPublisher->Init();
+    });
 #endif
 #if OTBR_ENABLE_VENDOR_SERVER
-    mVendorServer.Init();
+    InitOptionalStage("vendor server", "vendor", [this]() {
+        mVendorServer = MakeUnique<vendor::VendorServer>(mNcp);
+        mVendorServer->Init();
+    });
 #endif
+
+    otbrLogInfo("Initialized all subsystems in %lld ms",
+                static_cast<long long>(std::chrono::duration_cast<Milliseconds>(Clock::now() - start).count()));
+}
+
+void Application::InitStage(const char *aName, const std::function<void(void)> &aInit)
+{
+    Clock::time_point start = Clock::now();
+
+    aInit();
+
+    otbrLogInfo("Initialized %s in %lld ms", aName,
+                static_cast<long long>(std::chrono::duration_cast<Milliseconds>(Clock::now() - start).count()));
+}
+
+void Application::InitOptionalStage(const char *aName, const char *aToken, const std::function<void(void)> &aInit)
+{
+    if (IsSubsystemDisabled(aToken))
+    {
+        otbrLogNotice("Skipped %s: \"%s\" is listed in %s", aName, aToken, kDisabledSubsystemsEnv);
+    }
+    else
+    {
+        InitStage(aName, aInit);
+    }
+}
+
+bool Application::IsSubsystemDisabled(const char *aToken)
+{
+    bool        disabled = false;
+    const char *env      = getenv(kDisabledSubsystemsEnv);
+    size_t      tokenLen;
+
+    VerifyOrExit(env != nullptr);
+
+    tokenLen = strlen(aToken);
+
+    for (const char *cursor = strstr(env, aToken); cursor != nullptr; cursor = strstr(cursor + 1, aToken))
+    {
+        bool startsToken = (cursor == env || cursor[-1] == ',');
+        bool endsToken   = (cursor[tokenLen] == '\0' || cursor[tokenLen] == ',');
+
+        if (startsToken && endsToken)
+        {
+            ExitNow(disabled = true);
+        }
+    }
+
+exit:
+    return disabled;
 }
 
 void Application::Deinit(void)
 {
+#if OTBR_ENABLE_TELEMETRY_SHM
+    if (mTelemetryPublisher != nullptr)
+    {
+        mTelemetryPublisher->Deinit();
+    }
+#endif
 #if OTBR_ENABLE_BORDER_AGENT
     mBorderAgent.Deinit();
 #endif
@@ -144,10 +280,51 @@ otbrError Application::Run(void)
     // allow quitting elegantly
     signal(SIGTERM, HandleSignal);
 
+    // flight-recorder tracing: SIGUSR1 toggles, SIGUSR2 dumps
+    signal(SIGUSR1, HandleSignal);
+    signal(SIGUSR2, HandleSignal);
+
+    // performance tuning reload
+    signal(SIGHUP, HandleSignal);
+
+#ifdef HAVE_LIBSYSTEMD
+    uint64_t watchdogUsec = 0;
+
+    {
+        const char *watchdogEnv = getenv("WATCHDOG_USEC");
+
+        if (watchdogEnv != nullptr)
+        {
+            watchdogUsec = strtoull(watchdogEnv, nullptr, 10);
+        }
+
+        if (watchdogUsec > 0)
+        {
+            otbrLogInfo("Systemd watchdog enabled, keepalive every %llu us",
+                        static_cast<unsigned long long>(watchdogUsec / 2));
+        }
+    }
+
+    Clock::time_point lastKeepalive  = Clock::now();
+    uint64_t          windowBusyUsec = 0;
+    uint64_t          windowWaitUsec = 0;
+#endif
+    uint64_t lastCpuUsec = GetCpuTimeUsec();
+
     while (!sShouldTerminate)
     {
         otbr::MainloopContext mainloop;
         int                   rval;
+        Clock::time_point     cycleStart;
+        Clock::time_point     pollStart;
+        Clock::time_point     pollEnd;
+        Clock::time_point     cycleEnd;
+        uint64_t              cpuUsec;
+        uint64_t              waitUsec;
+        uint64_t              busyUsec;
+
+        CachedClock::Refresh();
+        cycleStart = Clock::now();
 
         mainloop.mMaxFd   = -1;
         mainloop.mTimeout = kPollTimeout;
@@ -158,8 +335,38 @@ otbrError Application::Run(void)
 
         MainloopManager::GetInstance().Update(mainloop);
 
+#ifdef HAVE_LIBSYSTEMD
+        // Cap the wait so an otherwise idle loop still emits keepalives
+        // well within the watchdog interval.
+        if (watchdogUsec > 0)
+        {
+            struct timeval maxWait;
+
+            maxWait.tv_sec  = static_cast<time_t>(watchdogUsec / 4 / 1000000);
+            maxWait.tv_usec = static_cast<suseconds_t>(watchdogUsec / 4 % 1000000);
+
+            if (timercmp(&maxWait, &mainloop.mTimeout, <))
+            {
+                mainloop.mTimeout = maxWait;
+            }
+        }
+#endif
+
+        pollStart = Clock::now();
+
+#if OTBR_ENABLE_EPOLL_MAINLOOP
+        rval = mEpollMainloop.Poll(mainloop);
+#else
         rval = select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
                       &mainloop.mTimeout);
+#endif
+
+        // The wait above may have lasted the full poll timeout; refresh so
+        // Process() sees post-wakeup time.
+        CachedClock::Refresh();
+        pollEnd = Clock::now();
+
+        HandleSignalRequests();
 
         if (rval >= 0)
         {
@@ -183,15 +390,93 @@ otbrError Application::Run(void)
             otbrLogErr("select() failed: %s", strerror(errno));
             break;
         }
+
+        cycleEnd = Clock::now();
+        cpuUsec  = GetCpuTimeUsec();
+        waitUsec = static_cast<uint64_t>(std::chrono::duration_cast<Microseconds>(pollEnd - pollStart).count());
+        busyUsec = static_cast<uint64_t>(std::chrono::duration_cast<Microseconds>(pollStart - cycleStart).count()) +
+                   static_cast<uint64_t>(std::chrono::duration_cast<Microseconds>(cycleEnd - pollEnd).count());
+
+        AccountLoopCycle(rval > 0 ? rval : 0, waitUsec, busyUsec, cpuUsec - lastCpuUsec);
+        lastCpuUsec = cpuUsec;
+
+#ifdef HAVE_LIBSYSTEMD
+        windowBusyUsec += busyUsec;
+        windowWaitUsec += waitUsec;
+
+        if (watchdogUsec > 0 &&
+            static_cast<uint64_t>(std::chrono::duration_cast<Microseconds>(cycleEnd - lastKeepalive).count()) >=
+                watchdogUsec / 2)
+        {
+            uint64_t windowTotalUsec = windowBusyUsec + windowWaitUsec;
+
+            // Withhold the keepalive when the loop no longer waits in the
+            // poll; systemd then restarts the agent instead of letting a
+            // livelocked loop starve the RCP silently.
+            if (windowTotalUsec == 0 || windowBusyUsec * 100 < windowTotalUsec * kLoopBusyPercentMax)
+            {
+                sd_notify(0, "WATCHDOG=1");
+            }
+            else
+            {
+                otbrLogCrit("Withholding watchdog keepalive: mainloop busy %llu of %llu us",
+                            static_cast<unsigned long long>(windowBusyUsec),
+                            static_cast<unsigned long long>(windowTotalUsec));
+            }
+
+            lastKeepalive  = cycleEnd;
+            windowBusyUsec = 0;
+            windowWaitUsec = 0;
+        }
+#endif
     }
 
     return error;
 }
 
+void Application::HandleSignalRequests(void)
+{
+    if (sShouldToggleTracing.exchange(false))
+    {
+        Tracer &tracer = Tracer::GetInstance();
+
+        tracer.SetEnabled(!tracer.IsEnabled());
+        otbrLogNotice("Tracing %s", tracer.IsEnabled() ? "enabled" : "disabled");
+    }
+
+    if (sShouldDumpTrace.exchange(false))
+    {
+        Tracer::GetInstance().DumpJson(kTraceDumpPath);
+        AllocTracker::GetInstance().LogStats();
+    }
+
+    if (sShouldReloadPerfConfig.exchange(false))
+    {
+        PerfConfig::GetInstance().Reload();
+    }
+}
+
 void Application::HandleSignal(int aSignal)
 {
-    sShouldTerminate = true;
-    signal(aSignal, SIG_DFL);
+    switch (aSignal)
+    {
+    case SIGUSR1:
+        sShouldToggleTracing = true;
+        break;
+
+    case SIGUSR2:
+        sShouldDumpTrace = true;
+        break;
+
+    case SIGHUP:
+        sShouldReloadPerfConfig = true;
+        break;
+
+    default:
+        sShouldTerminate = true;
+        signal(aSignal, SIG_DFL);
+        break;
+    }
 }
 
 } // namespace otbr
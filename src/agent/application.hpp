@@ -35,6 +35,8 @@
 #define OTBR_AGENT_APPLICATION_HPP_
 
 #include <atomic>
+#include <functional>
+#include <memory>
 #include <signal.h>
 #include <stdint.h>
 #include <vector>
@@ -42,6 +44,7 @@
 #if OTBR_ENABLE_BORDER_AGENT
 #include "border_agent/border_agent.hpp"
 #endif
+#include "common/epoll_mainloop.hpp"
 #include "ncp/ncp_openthread.hpp"
 #if OTBR_ENABLE_BACKBONE_ROUTER
 #include "backbone_router/backbone_agent.hpp"
@@ -52,6 +55,9 @@
 #if OTBR_ENABLE_DBUS_SERVER
 #include "dbus/server/dbus_agent.hpp"
 #endif
+#if OTBR_ENABLE_TELEMETRY_SHM
+#include "telemetry/telemetry_shm.hpp"
+#endif
 #if OTBR_ENABLE_OPENWRT
 #include "openwrt/ubus/otubus.hpp"
 #endif
@@ -119,32 +125,85 @@ private:
 
     static void HandleSignal(int aSignal);
 
+    /**
+     * This method applies tracing toggle/dump and configuration reload requests
+     * raised from the signal handler.
+     *
+     */
+    void HandleSignalRequests(void);
+
+    /**
+     * This method runs a subsystem initializer and logs how long it took.
+     *
+     * @param[in] aName  The subsystem name used in the log line.
+     * @param[in] aInit  The initializer to run.
+     *
+     */
+    void InitStage(const char *aName, const std::function<void(void)> &aInit);
+
+    /**
+     * This method runs an optional subsystem initializer unless the subsystem is disabled at runtime.
+     *
+     * @param[in] aName   The subsystem name used in the log line.
+     * @param[in] aToken  The subsystem token matched against `OTBR_DISABLED_SUBSYSTEMS`.
+     * @param[in] aInit   The initializer to run.
+     *
+     */
+    void InitOptionalStage(const char *aName, const char *aToken, const std::function<void(void)> &aInit);
+
+    /**
+     * This method indicates whether an optional subsystem is disabled at runtime.
+     *
+     * @param[in] aToken  The subsystem token to look up.
+     *
+     * @returns Whether @p aToken is listed in `OTBR_DISABLED_SUBSYSTEMS`.
+     *
+     */
+    static bool IsSubsystemDisabled(const char *aToken);
+
     std::string mInterfaceName;
 #if __linux__
     otbr::Utils::InfraLinkSelector mInfraLinkSelector;
 #endif
     const char *              mBackboneInterfaceName;
+#if OTBR_ENABLE_EPOLL_MAINLOOP
+    EpollMainloop mEpollMainloop;
+#endif
     Ncp::ControllerOpenThread mNcp;
 #if OTBR_ENABLE_BORDER_AGENT
     BorderAgent mBorderAgent;
 #endif
+    // Optional subsystems are constructed lazily in Init() so SKUs that
+    // disable them at runtime never pay their memory or socket cost.
 #if OTBR_ENABLE_BACKBONE_ROUTER
-    BackboneRouter::BackboneAgent mBackboneAgent;
+    std::unique_ptr<BackboneRouter::BackboneAgent> mBackboneAgent;
 #endif
 #if OTBR_ENABLE_OPENWRT
-    ubus::UBusAgent mUbusAgent;
+    std::unique_ptr<ubus::UBusAgent> mUbusAgent;
 #endif
 #if OTBR_ENABLE_REST_SERVER
-    rest::RestWebServer mRestWebServer;
+    std::unique_ptr<rest::RestWebServer> mRestWebServer;
 #endif
 #if OTBR_ENABLE_DBUS_SERVER
-    DBus::DBusAgent mDBusAgent;
+    std::unique_ptr<DBus::DBusAgent> mDBusAgent;
+#endif
+#if OTBR_ENABLE_TELEMETRY_SHM
+    std::unique_ptr<Telemetry::TelemetryShmPublisher> mTelemetryPublisher;
 #endif
 #if OTBR_ENABLE_VENDOR_SERVER
-    vendor::VendorServer mVendorServer;
+    std::unique_ptr<vendor::VendorServer> mVendorServer;
 #endif
 
     static std::atomic_bool sShouldTerminate;
+
+    // Raised by SIGUSR1/SIGUSR2 and handled on the mainloop, where file
+    // I/O is safe.
+    static std::atomic_bool sShouldToggleTracing;
+    static std::atomic_bool sShouldDumpTrace;
+
+    // Raised by SIGHUP; the performance configuration is re-read on the
+    // mainloop, where file I/O is safe.
+    static std::atomic_bool sShouldReloadPerfConfig;
 };
 
 /**
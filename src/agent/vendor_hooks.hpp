@@ -0,0 +1,98 @@
+/*
+ *  Copyright (c) 2022, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file defines compile-time vendor hook points for hot paths.
+ *
+ *   Unlike the `VendorServer` extension, which is dispatched virtually
+ *   and is fine for setup-time behavior, these hooks sit on per-packet
+ *   and per-update paths where a virtual call (and the inlining it
+ *   prevents) is measurable. A vendor provides inline definitions for
+ *   the functions below in its own header and points the build at it
+ *   with `OTBR_VENDOR_HOOK_HEADER` (see the root CMakeLists.txt); the
+ *   calls then inline into the call sites. Without that define the
+ *   no-op inline definitions here compile away entirely, so a build
+ *   without vendor hooks pays zero cost.
+ */
+#ifndef OTBR_AGENT_VENDOR_HOOKS_HPP_
+#define OTBR_AGENT_VENDOR_HOOKS_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "common/code_utils.hpp"
+
+#ifdef OTBR_VENDOR_HOOK_HEADER
+
+// The vendor header must define every hook declared below, inline, in
+// namespace `otbr::vendor::hooks`.
+#include OTBR_VENDOR_HOOK_HEADER
+
+#else // OTBR_VENDOR_HOOK_HEADER
+
+namespace otbr {
+namespace vendor {
+namespace hooks {
+
+/**
+ * This hook observes every Neighbor Solicitation handled by the ND proxy.
+ *
+ * It is called after the ICMPv6 type check, before the proxy decides
+ * whether to respond.
+ *
+ * @param[in] aPacket  A pointer to the raw ICMPv6 packet.
+ * @param[in] aLength  The packet length, in bytes.
+ *
+ */
+inline void HandleNdProxyPacket(const uint8_t *aPacket, size_t aLength)
+{
+    OTBR_UNUSED_VARIABLE(aPacket);
+    OTBR_UNUSED_VARIABLE(aLength);
+}
+
+/**
+ * This hook observes every service instance resolved by the mDNS publisher.
+ *
+ * @param[in] aType          The service type (e.g. "_meshcop._udp").
+ * @param[in] aInstanceName  The resolved service instance name.
+ *
+ */
+inline void HandleMdnsServiceResolved(const char *aType, const char *aInstanceName)
+{
+    OTBR_UNUSED_VARIABLE(aType);
+    OTBR_UNUSED_VARIABLE(aInstanceName);
+}
+
+} // namespace hooks
+} // namespace vendor
+} // namespace otbr
+
+#endif // OTBR_VENDOR_HOOK_HEADER
+
+#endif // OTBR_AGENT_VENDOR_HOOKS_HPP_
@@ -52,13 +52,13 @@ BackboneAgent::BackboneAgent(otbr::Ncp::ControllerOpenThread &aNcp,
                              std::string                      aBackboneInterfaceName)
     : mNcp(aNcp)
     , mBackboneRouterState(OT_BACKBONE_ROUTER_STATE_DISABLED)
+    , mMulticastListenerManager(aNcp, aBackboneInterfaceName)
 #if OTBR_ENABLE_DUA_ROUTING
     , mNdProxyManager(aNcp, aBackboneInterfaceName)
     , mDuaRoutingManager(aInterfaceName, aBackboneInterfaceName)
 #endif
 {
     OTBR_UNUSED_VARIABLE(aInterfaceName);
-    OTBR_UNUSED_VARIABLE(aBackboneInterfaceName);
 }
 
 void BackboneAgent::Init(void)
@@ -70,6 +70,7 @@ void BackboneAgent::Init(void)
     otBackboneRouterSetNdProxyCallback(mNcp.GetInstance(), &BackboneAgent::HandleBackboneRouterNdProxyEvent, this);
     mNdProxyManager.Init();
 #endif
+    mMulticastListenerManager.Init();
 
     otBackboneRouterSetEnabled(mNcp.GetInstance(), /* aEnabled */ true);
 }
@@ -117,6 +118,7 @@ void BackboneAgent::OnBecomePrimary(void)
         mNdProxyManager.Enable(mDomainPrefix);
     }
 #endif
+    mMulticastListenerManager.Enable();
 }
 
 void BackboneAgent::OnResignPrimary(void)
@@ -127,6 +129,7 @@ void BackboneAgent::OnResignPrimary(void)
     mDuaRoutingManager.Disable();
     mNdProxyManager.Disable();
 #endif
+    mMulticastListenerManager.Disable();
 }
 
 const char *BackboneAgent::StateToString(otBackboneRouterState aState)
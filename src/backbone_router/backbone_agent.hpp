@@ -39,6 +39,7 @@
 #include <openthread/backbone_router_ftd.h>
 
 #include "backbone_router/dua_routing_manager.hpp"
+#include "backbone_router/multicast_listener_manager.hpp"
 #include "backbone_router/nd_proxy.hpp"
 #include "common/code_utils.hpp"
 #include "ncp/ncp_openthread.hpp"
@@ -103,6 +104,7 @@ private:
     otbr::Ncp::ControllerOpenThread &mNcp;
     otBackboneRouterState            mBackboneRouterState;
     Ip6Prefix                        mDomainPrefix;
+    MulticastListenerManager         mMulticastListenerManager;
 #if OTBR_ENABLE_DUA_ROUTING
     NdProxyManager    mNdProxyManager;
     DuaRoutingManager mDuaRoutingManager;
@@ -31,67 +31,240 @@
  *   The file implements DUA routing functionalities.
  */
 
+#define OTBR_LOG_TAG "DUA"
+
 #include "backbone_router/dua_routing_manager.hpp"
 
 #if OTBR_ENABLE_DUA_ROUTING
 
+#include <errno.h>
+#include <net/if.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <linux/fib_rules.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+
 #include "common/code_utils.hpp"
+#include "common/logging.hpp"
 
 namespace otbr {
 
 namespace BackboneRouter {
 
+static bool PrefixesEqual(const Ip6Prefix &aLhs, const Ip6Prefix &aRhs)
+{
+    return aLhs.mLength == aRhs.mLength && memcmp(aLhs.mPrefix.m8, aRhs.mPrefix.m8, sizeof(aLhs.mPrefix.m8)) == 0;
+}
+
+// Appends one attribute to a netlink message, growing `nlmsg_len`.
+static void AddAttribute(nlmsghdr &aHeader, uint16_t aType, const void *aValue, uint16_t aLength)
+{
+    rtattr *rta = reinterpret_cast<rtattr *>(reinterpret_cast<uint8_t *>(&aHeader) + NLMSG_ALIGN(aHeader.nlmsg_len));
+
+    rta->rta_type = aType;
+    rta->rta_len  = RTA_LENGTH(aLength);
+    memcpy(RTA_DATA(rta), aValue, aLength);
+    aHeader.nlmsg_len = NLMSG_ALIGN(aHeader.nlmsg_len) + RTA_ALIGN(rta->rta_len);
+}
+
 void DuaRoutingManager::Enable(const Ip6Prefix &aDomainPrefix)
 {
-    VerifyOrExit(!mEnabled);
-    mEnabled = true;
+    otbrError error = OTBR_ERROR_NONE;
 
+    if (mEnabled)
+    {
+        // State diff: nothing to reprogram when the prefix is unchanged.
+        VerifyOrExit(!PrefixesEqual(mDomainPrefix, aDomainPrefix));
+
+        SuccessOrExit(error = SendRouteTransaction(/* aAdd */ false));
+        mDomainPrefix = aDomainPrefix;
+        error = SendRouteTransaction(/* aAdd */ true);
+        ExitNow();
+    }
+
+    mEnabled      = true;
     mDomainPrefix = aDomainPrefix;
 
-    AddDefaultRouteToThread();
-    AddPolicyRouteToBackbone();
+    SuccessOrExit(error = InitNetlinkSocket());
+    error = SendRouteTransaction(/* aAdd */ true);
 
 exit:
-    otbrLogResult(OTBR_ERROR_NONE, "DuaRoutingManager: %s", __FUNCTION__);
+    otbrLogResult(error, "DuaRoutingManager: %s", __FUNCTION__);
 }
 
 void DuaRoutingManager::Disable(void)
 {
+    otbrError error = OTBR_ERROR_NONE;
+
     VerifyOrExit(mEnabled);
     mEnabled = false;
 
-    DelDefaultRouteToThread();
-    DelPolicyRouteToBackbone();
+    // The netlink socket stays open so the next enable on an infra link
+    // flap does not pay the setup cost again.
+    error = SendRouteTransaction(/* aAdd */ false);
 
 exit:
-    otbrLogResult(OTBR_ERROR_NONE, "DuaRoutingManager: %s", __FUNCTION__);
+    otbrLogResult(error, "DuaRoutingManager: %s", __FUNCTION__);
 }
 
-void DuaRoutingManager::AddDefaultRouteToThread(void)
+void DuaRoutingManager::Update(MainloopContext &aMainloop)
 {
-    SystemUtils::ExecuteCommand("ip -6 route add %s dev %s proto static metric 1", mDomainPrefix.ToString().c_str(),
-                                mInterfaceName.c_str());
+    if (mNetlinkSock >= 0)
+    {
+        FD_SET(mNetlinkSock, &aMainloop.mReadFdSet);
+        aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, mNetlinkSock);
+    }
 }
 
-void DuaRoutingManager::DelDefaultRouteToThread(void)
+void DuaRoutingManager::Process(const MainloopContext &aMainloop)
 {
-    SystemUtils::ExecuteCommand("ip -6 route del %s dev %s proto static metric 1", mDomainPrefix.ToString().c_str(),
-                                mInterfaceName.c_str());
+    uint8_t buffer[kNetlinkBufferSize];
+    ssize_t len;
+
+    VerifyOrExit(mNetlinkSock >= 0 && FD_ISSET(mNetlinkSock, &aMainloop.mReadFdSet));
+
+    while ((len = recv(mNetlinkSock, buffer, sizeof(buffer), MSG_DONTWAIT)) > 0)
+    {
+        for (nlmsghdr *header = reinterpret_cast<nlmsghdr *>(buffer); NLMSG_OK(header, len);
+             header           = NLMSG_NEXT(header, len))
+        {
+            const nlmsgerr *errMsg;
+
+            if (header->nlmsg_type != NLMSG_ERROR)
+            {
+                continue;
+            }
+
+            errMsg = reinterpret_cast<const nlmsgerr *>(NLMSG_DATA(header));
+
+            // `EEXIST` on add and `ESRCH`/`ENOENT` on delete only mean the
+            // kernel state already matched the request.
+            if (errMsg->error != 0 && errMsg->error != -EEXIST && errMsg->error != -ESRCH &&
+                errMsg->error != -ENOENT)
+            {
+                otbrLogWarning("DuaRoutingManager: netlink request %u failed: %s", header->nlmsg_seq,
+                               strerror(-errMsg->error));
+            }
+        }
+    }
+
+exit:
+    return;
 }
 
-void DuaRoutingManager::AddPolicyRouteToBackbone(void)
+otbrError DuaRoutingManager::InitNetlinkSocket(void)
 {
-    // Packets from Thread interface use route table "openthread"
-    SystemUtils::ExecuteCommand("ip -6 rule add iif %s table openthread", mInterfaceName.c_str());
-    SystemUtils::ExecuteCommand("ip -6 route add %s dev %s proto static table openthread",
-                                mDomainPrefix.ToString().c_str(), mBackboneInterfaceName.c_str());
+    otbrError   error = OTBR_ERROR_NONE;
+    sockaddr_nl addr;
+
+    VerifyOrExit(mNetlinkSock < 0);
+
+    mNetlinkSock = socket(AF_NETLINK, SOCK_RAW | SOCK_NONBLOCK, NETLINK_ROUTE);
+    VerifyOrExit(mNetlinkSock >= 0, error = OTBR_ERROR_ERRNO);
+
+    memset(&addr, 0, sizeof(addr));
+    addr.nl_family = AF_NETLINK;
+    VerifyOrExit(bind(mNetlinkSock, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) == 0, error = OTBR_ERROR_ERRNO);
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        FiniNetlinkSocket();
+    }
+
+    return error;
+}
+
+void DuaRoutingManager::FiniNetlinkSocket(void)
+{
+    if (mNetlinkSock != -1)
+    {
+        close(mNetlinkSock);
+        mNetlinkSock = -1;
+    }
+}
+
+otbrError DuaRoutingManager::SendRouteTransaction(bool aAdd)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    uint8_t   buffer[kNetlinkBufferSize];
+    size_t    offset          = 0;
+    uint32_t  threadIfIndex   = if_nametoindex(mInterfaceName.c_str());
+    uint32_t  backboneIfIndex = if_nametoindex(mBackboneInterfaceName.c_str());
+
+    VerifyOrExit(mNetlinkSock >= 0, error = OTBR_ERROR_INVALID_STATE);
+    VerifyOrExit(threadIfIndex > 0 && backboneIfIndex > 0, error = OTBR_ERROR_ERRNO);
+
+    // Packets from the Thread interface use route table "openthread".
+    AppendRuleMessage(buffer, offset, aAdd);
+    AppendRouteMessage(buffer, offset, aAdd, threadIfIndex, RT_TABLE_MAIN, kRouteMetric);
+    AppendRouteMessage(buffer, offset, aAdd, backboneIfIndex, kRouteTableId, /* aMetric */ 0);
+
+    // All three messages reach the kernel in one send; acknowledgements are
+    // drained asynchronously from `Process()`.
+    VerifyOrExit(send(mNetlinkSock, buffer, offset, 0) == static_cast<ssize_t>(offset), error = OTBR_ERROR_ERRNO);
+
+exit:
+    return error;
 }
 
-void DuaRoutingManager::DelPolicyRouteToBackbone(void)
+void DuaRoutingManager::AppendRuleMessage(uint8_t *aBuffer, size_t &aOffset, bool aAdd)
 {
-    SystemUtils::ExecuteCommand("ip -6 rule del iif %s table openthread", mInterfaceName.c_str());
-    SystemUtils::ExecuteCommand("ip -6 route del %s dev %s proto static table openthread",
-                                mDomainPrefix.ToString().c_str(), mBackboneInterfaceName.c_str());
+    nlmsghdr *    header = reinterpret_cast<nlmsghdr *>(aBuffer + aOffset);
+    fib_rule_hdr *rule;
+
+    memset(header, 0, NLMSG_SPACE(sizeof(fib_rule_hdr)));
+    header->nlmsg_len   = NLMSG_LENGTH(sizeof(fib_rule_hdr));
+    header->nlmsg_type  = aAdd ? RTM_NEWRULE : RTM_DELRULE;
+    header->nlmsg_flags = NLM_F_REQUEST | NLM_F_ACK | (aAdd ? (NLM_F_CREATE | NLM_F_EXCL) : 0);
+    header->nlmsg_seq   = ++mNetlinkSequence;
+
+    rule         = reinterpret_cast<fib_rule_hdr *>(NLMSG_DATA(header));
+    rule->family = AF_INET6;
+    rule->table  = kRouteTableId;
+    rule->action = FR_ACT_TO_TBL;
+
+    AddAttribute(*header, FRA_IIFNAME, mInterfaceName.c_str(), mInterfaceName.length() + 1);
+
+    aOffset += NLMSG_ALIGN(header->nlmsg_len);
+}
+
+void DuaRoutingManager::AppendRouteMessage(uint8_t *aBuffer,
+                                           size_t & aOffset,
+                                           bool     aAdd,
+                                           uint32_t aIfIndex,
+                                           uint8_t  aTable,
+                                           uint32_t aMetric)
+{
+    nlmsghdr *header = reinterpret_cast<nlmsghdr *>(aBuffer + aOffset);
+    rtmsg *   route;
+
+    memset(header, 0, NLMSG_SPACE(sizeof(rtmsg)));
+    header->nlmsg_len   = NLMSG_LENGTH(sizeof(rtmsg));
+    header->nlmsg_type  = aAdd ? RTM_NEWROUTE : RTM_DELROUTE;
+    header->nlmsg_flags = NLM_F_REQUEST | NLM_F_ACK | (aAdd ? (NLM_F_CREATE | NLM_F_REPLACE) : 0);
+    header->nlmsg_seq   = ++mNetlinkSequence;
+
+    route               = reinterpret_cast<rtmsg *>(NLMSG_DATA(header));
+    route->rtm_family   = AF_INET6;
+    route->rtm_dst_len  = mDomainPrefix.mLength;
+    route->rtm_table    = aTable;
+    route->rtm_protocol = RTPROT_STATIC;
+    route->rtm_scope    = RT_SCOPE_UNIVERSE;
+    route->rtm_type     = RTN_UNICAST;
+
+    AddAttribute(*header, RTA_DST, mDomainPrefix.mPrefix.m8, sizeof(mDomainPrefix.mPrefix.m8));
+    AddAttribute(*header, RTA_OIF, &aIfIndex, sizeof(aIfIndex));
+
+    if (aMetric != 0)
+    {
+        AddAttribute(*header, RTA_PRIORITY, &aMetric, sizeof(aMetric));
+    }
+
+    aOffset += NLMSG_ALIGN(header->nlmsg_len);
 }
 
 } // namespace BackboneRouter
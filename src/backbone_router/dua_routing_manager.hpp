@@ -41,8 +41,8 @@
 #include <openthread/backbone_router_ftd.h>
 
 #include "common/code_utils.hpp"
+#include "common/mainloop.hpp"
 #include "ncp/ncp_openthread.hpp"
-#include "utils/system_utils.hpp"
 
 namespace otbr {
 namespace BackboneRouter {
@@ -60,7 +60,7 @@ namespace BackboneRouter {
  * This class implements the DUA routing manager.
  *
  */
-class DuaRoutingManager : private NonCopyable
+class DuaRoutingManager : public MainloopProcessor, private NonCopyable
 {
 public:
     /**
@@ -71,9 +71,13 @@ public:
         : mEnabled(false)
         , mInterfaceName(std::move(aInterfaceName))
         , mBackboneInterfaceName(std::move(aBackboneInterfaceName))
+        , mNetlinkSock(-1)
+        , mNetlinkSequence(0)
     {
     }
 
+    ~DuaRoutingManager(void) override { FiniNetlinkSocket(); }
+
     /**
      * This method enables the DUA routing manager.
      *
@@ -86,16 +90,33 @@ public:
      */
     void Disable(void);
 
+    void Update(MainloopContext &aMainloop) override;
+    void Process(const MainloopContext &aMainloop) override;
+
 private:
-    void AddDefaultRouteToThread(void);
-    void DelDefaultRouteToThread(void);
-    void AddPolicyRouteToBackbone(void);
-    void DelPolicyRouteToBackbone(void);
+    enum
+    {
+        kRouteTableId      = 88,  ///< The "openthread" route table; MUST match `script/_rt_tables`.
+        kRouteMetric       = 1,   ///< The metric of the DUA prefix route on the Thread interface.
+        kNetlinkBufferSize = 512, ///< Size of the buffer assembling one batch of netlink messages.
+    };
+
+    otbrError InitNetlinkSocket(void);
+    void      FiniNetlinkSocket(void);
+    otbrError SendRouteTransaction(bool aAdd);
+    void      AppendRuleMessage(uint8_t *aBuffer, size_t &aOffset, bool aAdd);
+    void      AppendRouteMessage(uint8_t *aBuffer, size_t &aOffset, bool aAdd, uint32_t aIfIndex, uint8_t aTable,
+                                 uint32_t aMetric);
 
     Ip6Prefix   mDomainPrefix;
     bool        mEnabled : 1;
     std::string mInterfaceName;
     std::string mBackboneInterfaceName;
+
+    // Non-blocking NETLINK_ROUTE socket; route/rule changes are sent as one
+    // batched request and the acknowledgements are drained from `Process()`.
+    int      mNetlinkSock;
+    uint32_t mNetlinkSequence;
 };
 
 /**
@@ -0,0 +1,247 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   The file implements the multicast listener manager.
+ */
+
+#define OTBR_LOG_TAG "MLM"
+
+#include "backbone_router/multicast_listener_manager.hpp"
+
+#if OTBR_ENABLE_BACKBONE_ROUTER
+
+#include <net/if.h>
+#include <netinet/in.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+#include "common/time.hpp"
+
+namespace otbr {
+namespace BackboneRouter {
+
+void MulticastListenerManager::Init(void)
+{
+    otBackboneRouterSetMulticastListenerCallback(
+        mNcp.GetInstance(),
+        [](void *aContext, otBackboneRouterMulticastListenerEvent aEvent, const otIp6Address *aAddress) {
+            static_cast<MulticastListenerManager *>(aContext)->HandleMulticastListenerEvent(aEvent, aAddress);
+        },
+        this);
+}
+
+void MulticastListenerManager::Enable(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(!IsEnabled());
+
+    mBackboneIfIndex = if_nametoindex(mBackboneInterfaceName.c_str());
+    VerifyOrExit(mBackboneIfIndex > 0, error = OTBR_ERROR_ERRNO);
+
+    SuccessOrExit(error = InitListenerSocket());
+
+    // Listener events received while not Primary were dropped, so rebuild
+    // the table once from a full enumeration; afterwards it is maintained
+    // purely from incremental deltas.
+    SyncListenerTable();
+
+    for (const Ip6Address &listener : mListeners)
+    {
+        ScheduleGroupChange(listener, /* aJoin */ true);
+    }
+
+exit:
+    otbrLogResult(error, "MulticastListenerManager: %s", __FUNCTION__);
+}
+
+void MulticastListenerManager::Disable(void)
+{
+    VerifyOrExit(IsEnabled());
+
+    // Closing the membership socket leaves every joined group in one batch
+    // instead of one `setsockopt()` per listener.
+    FiniListenerSocket();
+    mListeners.clear();
+    mPendingGroupChanges.clear();
+
+    otbrLogInfo("MulticastListenerManager: disabled");
+
+exit:
+    return;
+}
+
+void MulticastListenerManager::HandleMulticastListenerEvent(otBackboneRouterMulticastListenerEvent aEvent,
+                                                            const otIp6Address *                   aAddress)
+{
+    Ip6Address address(aAddress->mFields.m8);
+
+    VerifyOrExit(IsEnabled());
+
+    switch (aEvent)
+    {
+    case OT_BACKBONE_ROUTER_MULTICAST_LISTENER_ADDED:
+        VerifyOrExit(mListeners.insert(address).second);
+        ScheduleGroupChange(address, /* aJoin */ true);
+        break;
+    case OT_BACKBONE_ROUTER_MULTICAST_LISTENER_REMOVED:
+        VerifyOrExit(mListeners.erase(address) > 0);
+        ScheduleGroupChange(address, /* aJoin */ false);
+        break;
+    }
+
+exit:
+    return;
+}
+
+void MulticastListenerManager::Update(MainloopContext &aMainloop)
+{
+    if (!mPendingGroupChanges.empty())
+    {
+        aMainloop.mTimeout = ToTimeval(Microseconds::zero());
+    }
+}
+
+void MulticastListenerManager::Process(const MainloopContext &aMainloop)
+{
+    OTBR_UNUSED_VARIABLE(aMainloop);
+
+    ApplyGroupChanges();
+}
+
+otbrError MulticastListenerManager::InitListenerSocket(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    mListenerSock = socket(AF_INET6, SOCK_DGRAM, 0);
+    VerifyOrExit(mListenerSock >= 0, error = OTBR_ERROR_ERRNO);
+
+exit:
+    return error;
+}
+
+void MulticastListenerManager::FiniListenerSocket(void)
+{
+    if (mListenerSock != -1)
+    {
+        close(mListenerSock);
+        mListenerSock = -1;
+    }
+}
+
+void MulticastListenerManager::SyncListenerTable(void)
+{
+    otBackboneRouterMulticastListenerIterator iterator = OT_BACKBONE_ROUTER_MULTICAST_LISTENER_ITERATOR_INIT;
+    otBackboneRouterMulticastListenerInfo     info;
+
+    mListeners.clear();
+
+    while (otBackboneRouterMulticastListenerGetNext(mNcp.GetInstance(), &iterator, &info) == OT_ERROR_NONE)
+    {
+        mListeners.emplace(info.mAddress.mFields.m8);
+    }
+}
+
+void MulticastListenerManager::ScheduleGroupChange(const Ip6Address &aAddress, bool aJoin)
+{
+    auto it = mPendingGroupChanges.find(aAddress);
+
+    if (it != mPendingGroupChanges.end() && it->second != aJoin)
+    {
+        // The opposite change is still pending, so the pair cancels out.
+        mPendingGroupChanges.erase(it);
+    }
+    else
+    {
+        mPendingGroupChanges[aAddress] = aJoin;
+    }
+}
+
+void MulticastListenerManager::ApplyGroupChanges(void)
+{
+    VerifyOrExit(IsEnabled() && !mPendingGroupChanges.empty());
+
+    // Membership changes applied back to back are coalesced by the kernel
+    // into batched MLDv2 reports rather than one report per group.
+    for (const auto &change : mPendingGroupChanges)
+    {
+        if (change.second)
+        {
+            JoinGroup(change.first);
+        }
+        else
+        {
+            LeaveGroup(change.first);
+        }
+    }
+
+    otbrLogInfo("MulticastListenerManager: applied %zu multicast group changes in one pass",
+                mPendingGroupChanges.size());
+    mPendingGroupChanges.clear();
+
+exit:
+    return;
+}
+
+void MulticastListenerManager::JoinGroup(const Ip6Address &aAddress) const
+{
+    ipv6_mreq mreq;
+    otbrError error = OTBR_ERROR_NONE;
+
+    mreq.ipv6mr_interface = mBackboneIfIndex;
+    aAddress.CopyTo(mreq.ipv6mr_multiaddr);
+
+    VerifyOrExit(setsockopt(mListenerSock, IPPROTO_IPV6, IPV6_JOIN_GROUP, &mreq, sizeof(mreq)) == 0,
+                 error = OTBR_ERROR_ERRNO);
+exit:
+    otbrLogResult(error, "MulticastListenerManager: JoinGroup %s", aAddress.ToString().c_str());
+}
+
+void MulticastListenerManager::LeaveGroup(const Ip6Address &aAddress) const
+{
+    ipv6_mreq mreq;
+    otbrError error = OTBR_ERROR_NONE;
+
+    mreq.ipv6mr_interface = mBackboneIfIndex;
+    aAddress.CopyTo(mreq.ipv6mr_multiaddr);
+
+    VerifyOrExit(setsockopt(mListenerSock, IPPROTO_IPV6, IPV6_LEAVE_GROUP, &mreq, sizeof(mreq)) == 0,
+                 error = OTBR_ERROR_ERRNO);
+exit:
+    otbrLogResult(error, "MulticastListenerManager: LeaveGroup %s", aAddress.ToString().c_str());
+}
+
+} // namespace BackboneRouter
+} // namespace otbr
+
+#endif // OTBR_ENABLE_BACKBONE_ROUTER
@@ -0,0 +1,161 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definition for the multicast listener manager.
+ */
+
+#ifndef BACKBONE_ROUTER_MULTICAST_LISTENER_MANAGER_HPP_
+#define BACKBONE_ROUTER_MULTICAST_LISTENER_MANAGER_HPP_
+
+#if OTBR_ENABLE_BACKBONE_ROUTER
+
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+
+#include <openthread/backbone_router_ftd.h>
+
+#include "common/code_utils.hpp"
+#include "common/mainloop.hpp"
+#include "common/types.hpp"
+#include "ncp/ncp_openthread.hpp"
+
+namespace otbr {
+namespace BackboneRouter {
+
+/**
+ * @addtogroup border-router-backbone
+ *
+ * @brief
+ *   This module includes definition for the multicast listener manager.
+ *
+ * @{
+ */
+
+/**
+ * This class maintains the multicast listener table of the Backbone Router
+ * and mirrors it onto the backbone interface as MLDv2 group memberships.
+ *
+ * The table is updated incrementally from multicast listener events; a full
+ * enumeration only happens when the Backbone Router becomes Primary. Group
+ * changes from a burst of events are coalesced and applied in one pass from
+ * the mainloop.
+ *
+ */
+class MulticastListenerManager : public MainloopProcessor, private NonCopyable
+{
+public:
+    /**
+     * This constructor initializes a multicast listener manager instance.
+     *
+     * @param[in] aNcp                    A reference to the NCP controller.
+     * @param[in] aBackboneInterfaceName  The name of the backbone network interface.
+     *
+     */
+    explicit MulticastListenerManager(otbr::Ncp::ControllerOpenThread &aNcp, std::string aBackboneInterfaceName)
+        : mNcp(aNcp)
+        , mBackboneInterfaceName(std::move(aBackboneInterfaceName))
+        , mBackboneIfIndex(0)
+        , mListenerSock(-1)
+    {
+    }
+
+    ~MulticastListenerManager(void) override { FiniListenerSocket(); }
+
+    /**
+     * This method initializes the multicast listener manager.
+     *
+     */
+    void Init(void);
+
+    /**
+     * This method enables the multicast listener manager.
+     *
+     */
+    void Enable(void);
+
+    /**
+     * This method disables the multicast listener manager.
+     *
+     */
+    void Disable(void);
+
+    /**
+     * This method handles a Backbone Router multicast listener event.
+     *
+     * @param[in] aEvent    The multicast listener event type.
+     * @param[in] aAddress  The multicast listener address.
+     *
+     */
+    void HandleMulticastListenerEvent(otBackboneRouterMulticastListenerEvent aEvent, const otIp6Address *aAddress);
+
+    void Update(MainloopContext &aMainloop) override;
+    void Process(const MainloopContext &aMainloop) override;
+
+private:
+    bool IsEnabled(void) const { return mListenerSock >= 0; }
+
+    otbrError InitListenerSocket(void);
+    void      FiniListenerSocket(void);
+    void      SyncListenerTable(void);
+    void      ScheduleGroupChange(const Ip6Address &aAddress, bool aJoin);
+    void      ApplyGroupChanges(void);
+    void      JoinGroup(const Ip6Address &aAddress) const;
+    void      LeaveGroup(const Ip6Address &aAddress) const;
+
+    otbr::Ncp::ControllerOpenThread &mNcp;
+    std::string                      mBackboneInterfaceName;
+    uint32_t                         mBackboneIfIndex;
+
+    // The MLDv2 membership socket; closing it leaves all joined groups in
+    // one operation.
+    int mListenerSock;
+
+    // The in-process multicast listener table, updated incrementally from
+    // listener events.
+    std::set<Ip6Address> mListeners;
+
+    // Group changes coalesced from a burst of listener events and applied
+    // in one pass from `Process()`; `true` means join and `false` means
+    // leave. A join+leave pair for a flapping listener cancels out.
+    std::map<Ip6Address, bool> mPendingGroupChanges;
+};
+
+/**
+ * @}
+ */
+
+} // namespace BackboneRouter
+} // namespace otbr
+
+#endif // OTBR_ENABLE_BACKBONE_ROUTER
+
+#endif // BACKBONE_ROUTER_MULTICAST_LISTENER_MANAGER_HPP_
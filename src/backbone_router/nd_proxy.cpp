@@ -40,10 +40,13 @@
 #include <openthread/backbone_router_ftd.h>
 
 #include <assert.h>
+#include <errno.h>
 #include <net/if.h>
 #include <netinet/icmp6.h>
 #include <netinet/ip6.h>
+#include <string.h>
 #include <sys/ioctl.h>
+#include <sys/socket.h>
 #include <unistd.h>
 
 #if __linux__
@@ -52,15 +55,28 @@
 #error "Platform not supported"
 #endif
 
+#include "agent/vendor_hooks.hpp"
 #include "backbone_router/constants.hpp"
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
+#include "common/metrics.hpp"
+#include "common/time.hpp"
 #include "common/types.hpp"
+#include "utils/socket_utils.hpp"
 #include "utils/system_utils.hpp"
 
 namespace otbr {
 namespace BackboneRouter {
 
+struct NdProxyManager::Icmp6RecvArena
+{
+    uint8_t        mPackets[kMulticastNsBatchSize][kMaxICMP6PacketSize];
+    unsigned char  mControl[kMulticastNsBatchSize][2 * CMSG_SPACE(sizeof(struct in6_pktinfo))];
+    sockaddr_in6   mSources[kMulticastNsBatchSize];
+    struct iovec   mIoVecs[kMulticastNsBatchSize];
+    struct mmsghdr mHeaders[kMulticastNsBatchSize];
+};
+
 void NdProxyManager::Enable(const Ip6Prefix &aDomainPrefix)
 {
     otbrError error = OTBR_ERROR_NONE;
@@ -99,6 +115,8 @@ void NdProxyManager::Disable(void)
 
     FiniNetfilterQueue();
     FiniIcmp6RawSocket();
+    mPendingNdProxyEvents.clear();
+    mPendingMulticastGroupChanges.clear();
 
     // Remove ip6tables rule for unicast ICMPv6 messages
     VerifyOrExit(SystemUtils::ExecuteCommand(
@@ -130,12 +148,22 @@ void NdProxyManager::Update(MainloopContext &aMainloop)
         FD_SET(mUnicastNsQueueSock, &aMainloop.mReadFdSet);
         aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, mUnicastNsQueueSock);
     }
+
+    if (!mPendingNdProxyEvents.empty() || !mPendingMulticastGroupChanges.empty())
+    {
+        aMainloop.mTimeout = ToTimeval(Microseconds::zero());
+    }
 }
 
 void NdProxyManager::Process(const MainloopContext &aMainloop)
 {
     VerifyOrExit(IsEnabled());
 
+    // Queued events are applied before the membership deltas they scheduled,
+    // so both land in this pass.
+    ApplyNdProxyEvents();
+    ApplyMulticastGroupChanges();
+
     if (FD_ISSET(mIcmp6RawSock, &aMainloop.mReadFdSet))
     {
         ProcessMulticastNeighborSolicition();
@@ -145,48 +173,80 @@ void NdProxyManager::Process(const MainloopContext &aMainloop)
     {
         ProcessUnicastNeighborSolicition();
     }
+
+    // Both drains above only queue responses; one batched send covers them.
+    FlushPendingNeighborAdvertisements();
+
 exit:
     return;
 }
 
 void NdProxyManager::ProcessMulticastNeighborSolicition()
 {
-    struct msghdr     msghdr;
-    sockaddr_in6      sin6;
-    struct iovec      iovec;
-    ssize_t           len;
+    Icmp6RecvArena &arena = *mIcmp6RecvArena;
+    int             count;
+
+    for (size_t i = 0; i < kMulticastNsBatchSize; i++)
+    {
+        arena.mIoVecs[i].iov_len  = kMaxICMP6PacketSize;
+        arena.mIoVecs[i].iov_base = arena.mPackets[i];
+
+        memset(&arena.mHeaders[i], 0, sizeof(arena.mHeaders[i]));
+        arena.mHeaders[i].msg_hdr.msg_name       = &arena.mSources[i];
+        arena.mHeaders[i].msg_hdr.msg_namelen    = sizeof(arena.mSources[i]);
+        arena.mHeaders[i].msg_hdr.msg_iov        = &arena.mIoVecs[i];
+        arena.mHeaders[i].msg_hdr.msg_iovlen     = 1;
+        arena.mHeaders[i].msg_hdr.msg_control    = arena.mControl[i];
+        arena.mHeaders[i].msg_hdr.msg_controllen = sizeof(arena.mControl[i]);
+    }
+
+    count = recvmmsg(mIcmp6RawSock, arena.mHeaders, kMulticastNsBatchSize, MSG_DONTWAIT, nullptr);
+    VerifyOrExit(count >= 0, otbrLogResult(OTBR_ERROR_ERRNO, "NdProxyManager: %s", __FUNCTION__));
+
+    otbrLogDebug("NdProxyManager: received %d multicast NS in one batch", count);
+
+    {
+        static Metrics::Counter &sNsReceived = Metrics::GetInstance().RegisterCounter(
+            "otbr_ndproxy_ns_received_total", "Number of multicast Neighbor Solicitations received.");
+
+        sNsReceived.Increment(static_cast<uint64_t>(count));
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        HandleMulticastNeighborSolicition(arena.mHeaders[i].msg_hdr, arena.mSources[i], arena.mHeaders[i].msg_len);
+    }
+
+exit:
+    return;
+}
+
+void NdProxyManager::HandleMulticastNeighborSolicition(msghdr &aMsgHdr, const sockaddr_in6 &aSrc, size_t aLength)
+{
+    uint8_t *         packet = static_cast<uint8_t *>(aMsgHdr.msg_iov->iov_base);
     struct icmp6_hdr *icmp6header;
     struct cmsghdr *  cmsghdr;
-    unsigned char     cbuf[2 * CMSG_SPACE(sizeof(struct in6_pktinfo))];
-    uint8_t           packet[kMaxICMP6PacketSize];
     otbrError         error = OTBR_ERROR_NONE;
     bool              found = false;
 
-    iovec.iov_len  = kMaxICMP6PacketSize;
-    iovec.iov_base = packet;
-
-    msghdr.msg_name       = &sin6;
-    msghdr.msg_namelen    = sizeof(sin6);
-    msghdr.msg_iov        = &iovec;
-    msghdr.msg_iovlen     = 1;
-    msghdr.msg_control    = cbuf;
-    msghdr.msg_controllen = sizeof(cbuf);
-
-    len = recvmsg(mIcmp6RawSock, &msghdr, 0);
-
-    VerifyOrExit(len >= static_cast<ssize_t>(sizeof(struct icmp6_hdr)), error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(aLength >= sizeof(struct icmp6_hdr), error = OTBR_ERROR_PARSE);
 
     {
-        Ip6Address &src = *reinterpret_cast<Ip6Address *>(&sin6.sin6_addr);
+        const Ip6Address &src = *reinterpret_cast<const Ip6Address *>(&aSrc.sin6_addr);
 
         icmp6header = reinterpret_cast<icmp6_hdr *>(packet);
 
         // only process neighbor solicit
         VerifyOrExit(icmp6header->icmp6_type == ND_NEIGHBOR_SOLICIT, error = OTBR_ERROR_PARSE);
 
-        otbrLogDebug("NdProxyManager: Received ND-NS from %s", src.ToString().c_str());
+        vendor::hooks::HandleNdProxyPacket(packet, aLength);
 
-        for (cmsghdr = CMSG_FIRSTHDR(&msghdr); cmsghdr; cmsghdr = CMSG_NXTHDR(&msghdr, cmsghdr))
+        char srcString[Ip6Address::kStringSize];
+
+        src.ToString(srcString, sizeof(srcString));
+        otbrLogDebug("NdProxyManager: Received ND-NS from %s", srcString);
+
+        for (cmsghdr = CMSG_FIRSTHDR(&aMsgHdr); cmsghdr; cmsghdr = CMSG_NXTHDR(&aMsgHdr, cmsghdr))
         {
             if (cmsghdr->cmsg_level != IPPROTO_IPV6)
             {
@@ -211,7 +271,10 @@ void NdProxyManager::ProcessMulticastNeighborSolicition()
                         }
                     }
 
-                    otbrLogDebug("NdProxyManager: dst=%s, ifindex=%d, proxying=%s", dst.ToString().c_str(), ifindex,
+                    char dstString[Ip6Address::kStringSize];
+
+                    dst.ToString(dstString, sizeof(dstString));
+                    otbrLogDebug("NdProxyManager: dst=%s, ifindex=%d, proxying=%s", dstString, ifindex,
                                  found ? "Y" : "N");
                 }
                 break;
@@ -235,8 +298,13 @@ void NdProxyManager::ProcessMulticastNeighborSolicition()
             struct nd_neighbor_solicit *ns     = reinterpret_cast<struct nd_neighbor_solicit *>(packet);
             Ip6Address &                target = *reinterpret_cast<Ip6Address *>(&ns->nd_ns_target);
 
-            otbrLogInfo("NdProxyManager: send solicited NA for multicast NS: src=%s, target=%s", src.ToString().c_str(),
-                        target.ToString().c_str());
+            char srcString[Ip6Address::kStringSize];
+            char targetString[Ip6Address::kStringSize];
+
+            src.ToString(srcString, sizeof(srcString));
+            target.ToString(targetString, sizeof(targetString));
+            otbrLogInfo("NdProxyManager: send solicited NA for multicast NS: src=%s, target=%s", srcString,
+                        targetString);
 
             SendNeighborAdvertisement(target, src);
         }
@@ -251,98 +319,263 @@ void NdProxyManager::ProcessUnicastNeighborSolicition(void)
     otbrError error = OTBR_ERROR_NONE;
     char      packet[kMaxICMP6PacketSize];
     ssize_t   len;
+    size_t    handled = 0;
 
-    VerifyOrExit((len = recv(mUnicastNsQueueSock, packet, sizeof(packet), 0)) >= 0, error = OTBR_ERROR_ERRNO);
-    VerifyOrExit(nfq_handle_packet(mNfqHandler, packet, len) == 0, error = OTBR_ERROR_ERRNO);
+    // Drain the queue socket up to the batch cap; accept verdicts raised by
+    // the handler are coalesced and flushed in one batched verdict below.
+    while (handled < kUnicastNsBatchSize)
+    {
+        len = recv(mUnicastNsQueueSock, packet, sizeof(packet), handled == 0 ? 0 : MSG_DONTWAIT);
 
-    error = OTBR_ERROR_NONE;
+        if (len < 0)
+        {
+            VerifyOrExit(handled > 0 && (errno == EAGAIN || errno == EWOULDBLOCK), error = OTBR_ERROR_ERRNO);
+            break;
+        }
+
+        VerifyOrExit(nfq_handle_packet(mNfqHandler, packet, len) == 0, error = OTBR_ERROR_ERRNO);
+        handled++;
+    }
 
 exit:
-    otbrLogResult(error, "NdProxyManager: %s", __FUNCTION__);
+    FlushPendingAcceptVerdicts();
+    otbrLogResult(error, "NdProxyManager: %s (handled %zu)", __FUNCTION__, handled);
+}
+
+void NdProxyManager::FlushPendingAcceptVerdicts(void)
+{
+    VerifyOrExit(mHasPendingAcceptVerdict);
+
+    nfq_set_verdict_batch(mNfqQueueHandler, mPendingAcceptVerdictId, NF_ACCEPT);
+    mHasPendingAcceptVerdict = false;
+
+exit:
+    return;
 }
 
 void NdProxyManager::HandleBackboneRouterNdProxyEvent(otBackboneRouterNdProxyEvent aEvent, const otIp6Address *aDua)
 {
-    Ip6Address target;
+    PendingNdProxyEvent pendingEvent;
+
+    // Events arriving in a burst (a BBR failover transfers every DUA at
+    // once) are only queued here; `ApplyNdProxyEvents()` applies the whole
+    // burst in one pass from the next `Process()`, which `Update()`
+    // schedules immediately while events are pending.
+    pendingEvent.mEvent = aEvent;
 
     if (aEvent != OT_BACKBONE_ROUTER_NDPROXY_CLEARED)
     {
         assert(aDua != nullptr);
-        target = Ip6Address(aDua->mFields.m8);
+        pendingEvent.mTarget = Ip6Address(aDua->mFields.m8);
     }
 
-    switch (aEvent)
-    {
-    case OT_BACKBONE_ROUTER_NDPROXY_ADDED:
-    case OT_BACKBONE_ROUTER_NDPROXY_RENEWED:
+    mPendingNdProxyEvents.push_back(pendingEvent);
+}
+
+void NdProxyManager::ApplyNdProxyEvents(void)
+{
+    VerifyOrExit(!mPendingNdProxyEvents.empty());
+
+    for (const PendingNdProxyEvent &pendingEvent : mPendingNdProxyEvents)
     {
-        bool isNewInsert = mNdProxySet.insert(target).second;
+        const Ip6Address &target = pendingEvent.mTarget;
 
-        if (isNewInsert)
+        switch (pendingEvent.mEvent)
         {
-            JoinSolicitedNodeMulticastGroup(target);
+        case OT_BACKBONE_ROUTER_NDPROXY_ADDED:
+        case OT_BACKBONE_ROUTER_NDPROXY_RENEWED:
+        {
+            bool isNewInsert = mNdProxySet.insert(target).second;
+
+            if (isNewInsert)
+            {
+                mNdProxyMatcher.Insert(target);
+                ScheduleSolicitedNodeMulticastGroupChange(target, /* aJoin */ true);
+            }
+
+            SendNeighborAdvertisement(target, Ip6Address::GetLinkLocalAllNodesMulticastAddress());
+            break;
         }
+        case OT_BACKBONE_ROUTER_NDPROXY_REMOVED:
+            mNdProxySet.erase(target);
+            mNdProxyMatcher.Remove(target);
+            mNaTemplates.erase(target);
+            ScheduleSolicitedNodeMulticastGroupChange(target, /* aJoin */ false);
+            break;
+        case OT_BACKBONE_ROUTER_NDPROXY_CLEARED:
+            for (const Ip6Address &proxingTarget : mNdProxySet)
+            {
+                ScheduleSolicitedNodeMulticastGroupChange(proxingTarget, /* aJoin */ false);
+            }
+            mNdProxySet.clear();
+            mNdProxyMatcher.Clear();
+            mNaTemplates.clear();
+            break;
+        }
+    }
+
+    otbrLogInfo("NdProxyManager: applied %zu ND proxy events in one pass", mPendingNdProxyEvents.size());
+    mPendingNdProxyEvents.clear();
+
+    // The unsolicited NAs queued above ride the same batched send that
+    // covers the socket drains later in this `Process()` pass.
+
+exit:
+    return;
+}
 
-        SendNeighborAdvertisement(target, Ip6Address::GetLinkLocalAllNodesMulticastAddress());
-        break;
+void NdProxyManager::ScheduleSolicitedNodeMulticastGroupChange(const Ip6Address &aTarget, bool aJoin)
+{
+    auto it = mPendingMulticastGroupChanges.find(aTarget);
+
+    if (it != mPendingMulticastGroupChanges.end() && it->second != aJoin)
+    {
+        // The opposite change is still pending, so the pair cancels out.
+        mPendingMulticastGroupChanges.erase(it);
     }
-    case OT_BACKBONE_ROUTER_NDPROXY_REMOVED:
-        mNdProxySet.erase(target);
-        LeaveSolicitedNodeMulticastGroup(target);
-        break;
-    case OT_BACKBONE_ROUTER_NDPROXY_CLEARED:
-        for (const Ip6Address &proxingTarget : mNdProxySet)
+    else
+    {
+        mPendingMulticastGroupChanges[aTarget] = aJoin;
+    }
+}
+
+void NdProxyManager::ApplyMulticastGroupChanges(void)
+{
+    VerifyOrExit(!mPendingMulticastGroupChanges.empty());
+
+    for (const auto &change : mPendingMulticastGroupChanges)
+    {
+        if (change.second)
+        {
+            JoinSolicitedNodeMulticastGroup(change.first);
+        }
+        else
         {
-            LeaveSolicitedNodeMulticastGroup(proxingTarget);
+            LeaveSolicitedNodeMulticastGroup(change.first);
         }
-        mNdProxySet.clear();
-        break;
     }
+
+    otbrLogInfo("NdProxyManager: applied %zu multicast group changes in one pass",
+                mPendingMulticastGroupChanges.size());
+    mPendingMulticastGroupChanges.clear();
+
+exit:
+    return;
 }
 
 void NdProxyManager::SendNeighborAdvertisement(const Ip6Address &aTarget, const Ip6Address &aDst)
 {
-    uint8_t                    packet[kMaxICMP6PacketSize];
-    uint16_t                   len = 0;
-    struct nd_neighbor_advert &na  = *reinterpret_cast<struct nd_neighbor_advert *>(packet);
-    struct nd_opt_hdr &        opt = *reinterpret_cast<struct nd_opt_hdr *>(packet + sizeof(struct nd_neighbor_advert));
-    bool                       isSolicited = !aDst.IsMulticast();
-    sockaddr_in6               dst;
-    otbrError                  error = OTBR_ERROR_NONE;
-    otBackboneRouterNdProxyInfo aNdProxyInfo;
+    struct nd_neighbor_advert * na;
+    bool                        isSolicited = !aDst.IsMulticast();
+    otbrError                   error = OTBR_ERROR_NONE;
+    otBackboneRouterNdProxyInfo ndProxyInfo;
+    auto                        it = mNaTemplates.find(aTarget);
 
     VerifyOrExit(otBackboneRouterGetNdProxyInfo(mNcp.GetInstance(), reinterpret_cast<const otIp6Address *>(&aTarget),
-                                                &aNdProxyInfo) == OT_ERROR_NONE,
+                                                &ndProxyInfo) == OT_ERROR_NONE,
                  error = OTBR_ERROR_OPENTHREAD);
 
-    memset(packet, 0, sizeof(packet));
+    if (it == mNaTemplates.end())
+    {
+        it = mNaTemplates.emplace(aTarget, NaPacketTemplate()).first;
+        BuildNeighborAdvertisementTemplate(aTarget, it->second.mPacket);
+    }
 
-    na.nd_na_type = ND_NEIGHBOR_ADVERT;
-    na.nd_na_code = 0;
+    na = reinterpret_cast<struct nd_neighbor_advert *>(it->second.mPacket);
+
+    // Patch the per-send flags; everything else in the template is fixed
+    // for the proxied address.
     // set Solicited
-    na.nd_na_flags_reserved = isSolicited ? ND_NA_FLAG_SOLICITED : 0;
+    na->nd_na_flags_reserved = isSolicited ? ND_NA_FLAG_SOLICITED : 0;
     // set Router
-    na.nd_na_flags_reserved |= ND_NA_FLAG_ROUTER;
+    na->nd_na_flags_reserved |= ND_NA_FLAG_ROUTER;
     // set Override
-    na.nd_na_flags_reserved |= aNdProxyInfo.mTimeSinceLastTransaction <= kDuaRecentTime ? ND_NA_FLAG_OVERRIDE : 0;
+    na->nd_na_flags_reserved |= ndProxyInfo.mTimeSinceLastTransaction <= kDuaRecentTime ? ND_NA_FLAG_OVERRIDE : 0;
 
-    memcpy(&na.nd_na_target, aTarget.m8, sizeof(Ip6Address));
-    len += sizeof(struct nd_neighbor_advert);
+    if (mPendingNaCount == kNaSendBatchSize)
+    {
+        FlushPendingNeighborAdvertisements();
+    }
 
-    opt.nd_opt_type = ND_OPT_TARGET_LINKADDR;
-    opt.nd_opt_len  = 1;
+    {
+        PendingNa &pending = mPendingNa[mPendingNaCount++];
 
-    memcpy(reinterpret_cast<uint8_t *>(&opt) + 2, mMacAddress.m8, sizeof(mMacAddress));
+        memcpy(pending.mPacket, it->second.mPacket, kNaPacketLength);
+        aDst.CopyTo(pending.mDst);
+    }
 
-    len += (opt.nd_opt_len * 8);
+exit:
+    otbrLogResult(error, "NdProxyManager: %s", __FUNCTION__);
+}
 
-    aDst.CopyTo(dst);
+void NdProxyManager::FlushPendingNeighborAdvertisements(void)
+{
+    static Metrics::Counter &sNaSent = Metrics::GetInstance().RegisterCounter(
+        "otbr_ndproxy_na_sent_total", "Number of proxied Neighbor Advertisements sent.");
+    struct mmsghdr headers[kNaSendBatchSize];
+    struct iovec   ioVecs[kNaSendBatchSize];
+    int            sent;
 
-    VerifyOrExit(sendto(mIcmp6RawSock, packet, len, 0, reinterpret_cast<const sockaddr *>(&dst), sizeof(dst)) == len,
-                 error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(mPendingNaCount > 0);
+
+    for (size_t i = 0; i < mPendingNaCount; i++)
+    {
+        ioVecs[i].iov_base = mPendingNa[i].mPacket;
+        ioVecs[i].iov_len  = kNaPacketLength;
+
+        memset(&headers[i], 0, sizeof(headers[i]));
+        headers[i].msg_hdr.msg_name    = &mPendingNa[i].mDst;
+        headers[i].msg_hdr.msg_namelen = sizeof(mPendingNa[i].mDst);
+        headers[i].msg_hdr.msg_iov     = &ioVecs[i];
+        headers[i].msg_hdr.msg_iovlen  = 1;
+    }
+
+    sent = sendmmsg(mIcmp6RawSock, headers, static_cast<unsigned int>(mPendingNaCount), 0);
+
+    if (sent < 0)
+    {
+        otbrLogResult(OTBR_ERROR_ERRNO, "NdProxyManager: %s", __FUNCTION__);
+    }
+    else
+    {
+        sNaSent.Increment(static_cast<uint64_t>(sent));
+
+        if (static_cast<size_t>(sent) < mPendingNaCount)
+        {
+            otbrLogWarning("NdProxyManager: sent %d of %zu queued NA in one batch", sent, mPendingNaCount);
+        }
+        else
+        {
+            otbrLogDebug("NdProxyManager: sent %d queued NA in one batch", sent);
+        }
+    }
+
+    mPendingNaCount = 0;
 
 exit:
-    otbrLogResult(error, "NdProxyManager: %s", __FUNCTION__);
+    return;
+}
+
+void NdProxyManager::BuildNeighborAdvertisementTemplate(const Ip6Address &aTarget, uint8_t *aPacket)
+{
+    struct nd_neighbor_advert &na = *reinterpret_cast<struct nd_neighbor_advert *>(aPacket);
+    struct nd_opt_hdr &        opt =
+        *reinterpret_cast<struct nd_opt_hdr *>(aPacket + sizeof(struct nd_neighbor_advert));
+
+    static_assert(kNaPacketLength == sizeof(struct nd_neighbor_advert) + 8,
+                  "kNaPacketLength must cover the NA header and the TLLA option");
+
+    memset(aPacket, 0, kNaPacketLength);
+
+    na.nd_na_type = ND_NEIGHBOR_ADVERT;
+    na.nd_na_code = 0;
+
+    memcpy(&na.nd_na_target, aTarget.m8, sizeof(Ip6Address));
+
+    opt.nd_opt_type = ND_OPT_TARGET_LINKADDR;
+    opt.nd_opt_len  = 1;
+
+    memcpy(reinterpret_cast<uint8_t *>(&opt) + 2, mMacAddress.m8, sizeof(mMacAddress));
 }
 
 otbrError NdProxyManager::UpdateMacAddress(void)
@@ -357,6 +590,9 @@ otbrError NdProxyManager::UpdateMacAddress(void)
 
     VerifyOrExit(ioctl(mIcmp6RawSock, SIOCGIFHWADDR, &ifr) != -1, error = OTBR_ERROR_ERRNO);
     memcpy(mMacAddress.m8, ifr.ifr_hwaddr.sa_data, sizeof(mMacAddress));
+
+    // The cached NA templates embed the MAC address in the TLLA option.
+    mNaTemplates.clear();
 #else
     ExitNow(error = OTBR_ERROR_NOT_IMPLEMENTED);
 #endif
@@ -371,10 +607,21 @@ otbrError NdProxyManager::InitIcmp6RawSocket(void)
     int                 on    = 1;
     int                 hops  = 255;
     struct icmp6_filter filter;
+    SocketSpec          spec;
 
-    mIcmp6RawSock = socket(AF_INET6, SOCK_RAW, IPPROTO_ICMPV6);
+    // A large receive buffer absorbs solicitation bursts until the next
+    // mainloop wakeup drains them; the nonblocking default matches the
+    // MSG_DONTWAIT batch receive.
+    spec.mDomain     = AF_INET6;
+    spec.mType       = SOCK_RAW;
+    spec.mProtocol   = IPPROTO_ICMPV6;
+    spec.mRcvBufSize = kIcmp6RcvBufSize;
+
+    mIcmp6RawSock = CreateSocket(spec);
     VerifyOrExit(mIcmp6RawSock >= 0, error = OTBR_ERROR_ERRNO);
 
+    mIcmp6RecvArena = new Icmp6RecvArena();
+
 #if __linux__
     VerifyOrExit(setsockopt(mIcmp6RawSock, SOL_SOCKET, SO_BINDTODEVICE, mBackboneInterfaceName.c_str(),
                             mBackboneInterfaceName.length()) == 0,
@@ -410,6 +657,9 @@ exit:
 
 void NdProxyManager::FiniIcmp6RawSocket(void)
 {
+    delete mIcmp6RecvArena;
+    mIcmp6RecvArena = nullptr;
+
     if (mIcmp6RawSock != -1)
     {
         close(mIcmp6RawSock);
@@ -426,7 +676,7 @@ otbrError NdProxyManager::InitNetfilterQueue(void)
     VerifyOrExit(nfq_bind_pf(mNfqHandler, AF_INET6) >= 0);
 
     VerifyOrExit((mNfqQueueHandler = nfq_create_queue(mNfqHandler, 88, HandleNetfilterQueue, this)) != nullptr);
-    VerifyOrExit(nfq_set_mode(mNfqQueueHandler, NFQNL_COPY_PACKET, 0xffff) >= 0);
+    VerifyOrExit(nfq_set_mode(mNfqQueueHandler, NFQNL_COPY_PACKET, kUnicastNsCopyRange) >= 0);
     VerifyOrExit((mUnicastNsQueueSock = nfq_fd(mNfqHandler)) >= 0);
 
     error = OTBR_ERROR_NONE;
@@ -497,37 +747,61 @@ int NdProxyManager::HandleNetfilterQueue(struct nfq_q_handle *aNfQueueHandler,
     }
 
     VerifyOrExit((len = nfq_get_payload(aNfData, &data)) > 0, error = OTBR_ERROR_PARSE);
+    VerifyOrExit(len >= static_cast<int>(sizeof(struct ip6_hdr) + sizeof(struct icmp6_hdr)),
+                 error = OTBR_ERROR_PARSE);
 
-    ip6header = reinterpret_cast<struct ip6_hdr *>(data);
-    src       = *reinterpret_cast<Ip6Address *>(&ip6header->ip6_src);
-    dst       = *reinterpret_cast<Ip6Address *>(&ip6header->ip6_dst);
+    ip6header   = reinterpret_cast<struct ip6_hdr *>(data);
+    icmp6header = reinterpret_cast<struct icmp6_hdr *>(data + sizeof(struct ip6_hdr));
+    dst         = *reinterpret_cast<Ip6Address *>(&ip6header->ip6_dst);
 
+    // Fast pre-filter: release non-proxied traffic before any further
+    // parsing or logging. The trie lookup walks at most one node per
+    // address bit however many DUAs are being proxied.
     VerifyOrExit(ip6header->ip6_nxt == IPPROTO_ICMPV6);
+    VerifyOrExit(icmp6header->icmp6_type == ND_NEIGHBOR_SOLICIT);
+    VerifyOrExit(mNdProxyMatcher.Contains(dst), error = OTBR_ERROR_NOT_FOUND);
 
-    otbrLogDebug("NdProxyManager: Handle Neighbor Solicitation: from %s to %s", src.ToString().c_str(),
-                 dst.ToString().c_str());
+    src = *reinterpret_cast<Ip6Address *>(&ip6header->ip6_src);
 
-    icmp6header = reinterpret_cast<struct icmp6_hdr *>(data + sizeof(struct ip6_hdr));
-    VerifyOrExit(icmp6header->icmp6_type == ND_NEIGHBOR_SOLICIT);
+    {
+        char srcString[Ip6Address::kStringSize];
+        char dstString[Ip6Address::kStringSize];
 
-    VerifyOrExit(mNdProxySet.find(dst) != mNdProxySet.end(), error = OTBR_ERROR_NOT_FOUND);
+        src.ToString(srcString, sizeof(srcString));
+        dst.ToString(dstString, sizeof(dstString));
+        otbrLogDebug("NdProxyManager: Handle Neighbor Solicitation: from %s to %s", srcString, dstString);
+    }
+
+    VerifyOrExit(len >= static_cast<int>(sizeof(struct ip6_hdr) + sizeof(struct nd_neighbor_solicit)),
+                 error = OTBR_ERROR_PARSE);
 
     {
         struct nd_neighbor_solicit &ns = *reinterpret_cast<struct nd_neighbor_solicit *>(data + sizeof(struct ip6_hdr));
         Ip6Address &                target = *reinterpret_cast<Ip6Address *>(&ns.nd_ns_target);
 
-        otbrLogDebug("NdProxyManager: %s: target: %s, hoplimit %d", __FUNCTION__, target.ToString().c_str(),
-                     ip6header->ip6_hlim);
+        char targetString[Ip6Address::kStringSize];
+
+        target.ToString(targetString, sizeof(targetString));
+        otbrLogDebug("NdProxyManager: %s: target: %s, hoplimit %d", __FUNCTION__, targetString, ip6header->ip6_hlim);
         VerifyOrExit(ip6header->ip6_hlim == 255, error = OTBR_ERROR_PARSE);
         SendNeighborAdvertisement(target, src);
         verdict = NF_DROP;
     }
 
 exit:
-    ret = nfq_set_verdict(aNfQueueHandler, id, verdict, len, data);
+    if (verdict == NF_DROP)
+    {
+        // The packet is answered by the proxy, so no payload is handed back.
+        ret = nfq_set_verdict(aNfQueueHandler, id, verdict, 0, nullptr);
 
-    otbrLogResult(error, "NdProxyManager: %s (nfq_set_verdict id  %d, ret %d verdict %d)", __FUNCTION__, id, ret,
-                  verdict);
+        otbrLogResult(error, "NdProxyManager: %s (nfq_set_verdict id  %d, ret %d verdict %d)", __FUNCTION__, id, ret,
+                      verdict);
+    }
+    else
+    {
+        mPendingAcceptVerdictId  = id;
+        mHasPendingAcceptVerdict = true;
+    }
 
     return ret;
 }
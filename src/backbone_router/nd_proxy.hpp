@@ -46,12 +46,15 @@
 #include <netinet/in.h>
 #include <set>
 #include <string>
+#include <sys/socket.h>
 #include <utility>
+#include <vector>
 
 #include <openthread/backbone_router_ftd.h>
 
 #include "common/code_utils.hpp"
 #include "common/mainloop.hpp"
+#include "common/prefix_matcher.hpp"
 #include "common/types.hpp"
 #include "ncp/ncp_openthread.hpp"
 
@@ -82,9 +85,13 @@ public:
         : mNcp(aNcp)
         , mBackboneInterfaceName(std::move(aBackboneInterfaceName))
         , mIcmp6RawSock(-1)
+        , mIcmp6RecvArena(nullptr)
         , mUnicastNsQueueSock(-1)
         , mNfqHandler(nullptr)
         , mNfqQueueHandler(nullptr)
+        , mPendingAcceptVerdictId(0)
+        , mHasPendingAcceptVerdict(false)
+        , mPendingNaCount(0)
     {
     }
 
@@ -132,35 +139,103 @@ public:
 private:
     enum
     {
-        kMaxICMP6PacketSize = 1500, ///< Max size of an ICMP6 packet in bytes.
+        kIcmp6RcvBufSize      = 512 * 1024, ///< SO_RCVBUF sized to ride out NS bursts without kernel drops.
+        kMaxICMP6PacketSize   = 1500,       ///< Max size of an ICMP6 packet in bytes.
+        kMulticastNsBatchSize = 32,         ///< Max multicast NS packets read per mainloop wakeup.
+        kNaPacketLength       = 32,         ///< Length of a proxied NA packet: the NA header plus the TLLA option.
+        kNaSendBatchSize      = 32,         ///< Max queued NA packets flushed with one `sendmmsg()`.
+        kUnicastNsBatchSize   = 32,         ///< Max queued unicast NS packets handled per mainloop wakeup.
+        kUnicastNsCopyRange   = 64,         ///< Bytes of each queued packet copied to userspace: IPv6 plus NS headers.
+    };
+
+    // A preformatted Neighbor Advertisement packet for one proxied address;
+    // only the per-send flags are patched before the packet is queued. The
+    // ICMP6 checksum is computed by the kernel for the raw socket.
+    struct NaPacketTemplate
+    {
+        uint8_t mPacket[kNaPacketLength];
+    };
+
+    // Preallocated receive buffers for reading a burst of multicast Neighbor
+    // Solicitations with one `recvmmsg()` call; defined in the implementation
+    // file and allocated while the ICMP6 raw socket is open.
+    struct Icmp6RecvArena;
+
+    // A Neighbor Advertisement queued for the next batched `sendmmsg()`.
+    struct PendingNa
+    {
+        uint8_t      mPacket[kNaPacketLength];
+        sockaddr_in6 mDst;
+    };
+
+    // A Backbone Router ND proxy event queued for batched application; the
+    // target is unused for `OT_BACKBONE_ROUTER_NDPROXY_CLEARED`.
+    struct PendingNdProxyEvent
+    {
+        otBackboneRouterNdProxyEvent mEvent;
+        Ip6Address                   mTarget;
     };
 
     void       SendNeighborAdvertisement(const Ip6Address &aTarget, const Ip6Address &aDst);
+    void       BuildNeighborAdvertisementTemplate(const Ip6Address &aTarget, uint8_t *aPacket);
     otbrError  UpdateMacAddress(void);
     otbrError  InitIcmp6RawSocket(void);
     void       FiniIcmp6RawSocket(void);
     otbrError  InitNetfilterQueue(void);
     void       FiniNetfilterQueue(void);
     void       ProcessMulticastNeighborSolicition(void);
+    void       HandleMulticastNeighborSolicition(msghdr &aMsgHdr, const sockaddr_in6 &aSrc, size_t aLength);
     void       ProcessUnicastNeighborSolicition(void);
+    void       FlushPendingAcceptVerdicts(void);
+    void       FlushPendingNeighborAdvertisements(void);
     void       JoinSolicitedNodeMulticastGroup(const Ip6Address &aTarget) const;
     void       LeaveSolicitedNodeMulticastGroup(const Ip6Address &aTarget) const;
+    void       ScheduleSolicitedNodeMulticastGroupChange(const Ip6Address &aTarget, bool aJoin);
+    void       ApplyMulticastGroupChanges(void);
+    void       ApplyNdProxyEvents(void);
     static int HandleNetfilterQueue(struct nfq_q_handle *aNfQueueHandler,
                                     struct nfgenmsg *    aNfMsg,
                                     struct nfq_data *    aNfData,
                                     void *               aContext);
     int HandleNetfilterQueue(struct nfq_q_handle *aNfQueueHandler, struct nfgenmsg *aNfMsg, struct nfq_data *aNfData);
 
-    otbr::Ncp::ControllerOpenThread &mNcp;
-    std::string                      mBackboneInterfaceName;
-    std::set<Ip6Address>             mNdProxySet;
-    uint32_t                         mBackboneIfIndex;
-    int                              mIcmp6RawSock;
-    int                              mUnicastNsQueueSock;
-    struct nfq_handle *              mNfqHandler;      ///< A pointer to an NFQUEUE handler.
-    struct nfq_q_handle *            mNfqQueueHandler; ///< A pointer to a newly created queue.
-    MacAddress                       mMacAddress;
-    Ip6Prefix                        mDomainPrefix;
+    otbr::Ncp::ControllerOpenThread &      mNcp;
+    std::string                            mBackboneInterfaceName;
+    std::set<Ip6Address>                   mNdProxySet;
+    Ip6PrefixMatcher                       mNdProxyMatcher; ///< Proxied DUAs as /128 entries; see netfilter path.
+    std::map<Ip6Address, NaPacketTemplate> mNaTemplates;
+    uint32_t                               mBackboneIfIndex;
+    int                                    mIcmp6RawSock;
+    Icmp6RecvArena *                       mIcmp6RecvArena; ///< Receive buffers; allocated while the socket is open.
+    int                                    mUnicastNsQueueSock;
+    struct nfq_handle *                    mNfqHandler;      ///< A pointer to an NFQUEUE handler.
+    struct nfq_q_handle *                  mNfqQueueHandler; ///< A pointer to a newly created queue.
+    MacAddress                             mMacAddress;
+    Ip6Prefix                              mDomainPrefix;
+
+    // NF_ACCEPT verdicts deferred during a drain of the netfilter queue;
+    // packet ids are monotonic, so one batched verdict for the highest
+    // deferred id releases every accepted packet.
+    uint32_t mPendingAcceptVerdictId;
+    bool     mHasPendingAcceptVerdict;
+
+    // Neighbor Advertisements queued during a drain of solicitations and
+    // transmitted with a single `sendmmsg()` call, so a burst of NS packets
+    // costs one send syscall instead of one per response.
+    PendingNa mPendingNa[kNaSendBatchSize];
+    size_t    mPendingNaCount;
+
+    // ND proxy events queued in arrival order and applied in one pass from
+    // `Process()`, so a BBR failover transferring many DUAs costs one pass
+    // over the proxy set, one merged set of multicast membership deltas and
+    // one batched unsolicited-NA transmission.
+    std::vector<PendingNdProxyEvent> mPendingNdProxyEvents;
+
+    // Solicited-node multicast group changes coalesced from a burst of ND
+    // proxy events and applied in one pass from `Process()`; `true` means
+    // join and `false` means leave. A join+leave pair for a flapping
+    // address cancels out before any syscall is made.
+    std::map<Ip6Address, bool> mPendingMulticastGroupChanges;
 };
 
 /**
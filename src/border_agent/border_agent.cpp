@@ -49,10 +49,12 @@
 #include <sstream>
 
 #include <openthread/border_agent.h>
+#include <openthread/dataset.h>
 #include <openthread/thread_ftd.h>
 #include <openthread/platform/toolchain.h>
 
 #include "agent/uris.hpp"
+#include "border_agent/meshcop_txt.hpp"
 #include "ncp/ncp_openthread.hpp"
 #if OTBR_ENABLE_BACKBONE_ROUTER
 #include "backbone_router/backbone_agent.hpp"
@@ -128,12 +130,17 @@ void BorderAgent::Init(void)
 
     mServiceInstanceName = BaseServiceInstanceName();
 
+    // A failure here only costs the warm start; the agent still comes up
+    // cold the usual way.
+    mStateSnapshot.Init();
+
     Start();
 }
 
 void BorderAgent::Deinit(void)
 {
     Stop();
+    mStateSnapshot.Deinit();
 }
 
 void BorderAgent::Start(void)
@@ -156,6 +163,12 @@ void BorderAgent::Stop(void)
 {
     otbrLogInfo("Stop Thread Border Agent");
 
+    if (mUpdateMeshCopTaskId != 0)
+    {
+        mTaskRunner.Cancel(mUpdateMeshCopTaskId);
+        mUpdateMeshCopTaskId = 0;
+    }
+
 #if OTBR_ENABLE_SRP_ADVERTISING_PROXY
     mAdvertisingProxy.Stop();
 #endif
@@ -182,7 +195,13 @@ void BorderAgent::HandleMdnsState(Mdns::Publisher::State aState)
     switch (aState)
     {
     case Mdns::Publisher::State::kReady:
-        UpdateMeshCopService();
+        // Re-advertise the registration persisted by the previous agent
+        // instance right away when the active dataset still matches; the
+        // regular Thread state change path refreshes it soon after.
+        if (!WarmStartMeshCopService())
+        {
+            UpdateMeshCopService();
+        }
 #if OTBR_ENABLE_SRP_ADVERTISING_PROXY
         mAdvertisingProxy.PublishAllHostsAndServices();
 #endif
@@ -191,6 +210,9 @@ void BorderAgent::HandleMdnsState(Mdns::Publisher::State aState)
 #endif
         break;
     default:
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+        mAdvertisingProxy.HandleMdnsState(aState);
+#endif
         otbrLogWarning("mDNS publisher not available!");
         break;
     }
@@ -207,30 +229,31 @@ static uint64_t ConvertTimestampToUint64(const otTimestamp &aTimestamp)
 
 void BorderAgent::PublishMeshCopService(void)
 {
-    StateBitmap              state;
-    uint32_t                 stateUint32;
-    otInstance *             instance    = mNcp.GetInstance();
-    const otExtendedPanId *  extPanId    = otThreadGetExtendedPanId(instance);
-    const otExtAddress *     extAddr     = otLinkGetExtendedAddress(instance);
-    const char *             networkName = otThreadGetNetworkName(instance);
-    Mdns::Publisher::TxtList txtList{{"rv", "1"}};
-    int                      port;
+    StateBitmap                                           state;
+    uint32_t                                              stateUint32;
+    otInstance *                                          instance = mNcp.GetInstance();
+    const Ncp::ControllerOpenThread::ThreadStateSnapshot &snapshot = mNcp.GetStateSnapshot();
+    const otExtendedPanId *                               extPanId = otThreadGetExtendedPanId(instance);
+    const otExtAddress *                                  extAddr  = otLinkGetExtendedAddress(instance);
+    MeshCopTxt                                            txtSet;
+    int                                                   port;
 
     otbrLogInfo("Publish meshcop service %s.%s.local.", mServiceInstanceName.c_str(), kBorderAgentServiceType);
 
-    txtList.emplace_back("vn", kVendorName);
-    txtList.emplace_back("mn", kProductName);
-    txtList.emplace_back("nn", networkName);
-    txtList.emplace_back("xp", extPanId->m8, sizeof(extPanId->m8));
-    txtList.emplace_back("tv", mNcp.GetThreadVersion());
+    txtSet.Set<MeshCopTxt::kKeyRv>("1");
+    txtSet.Set<MeshCopTxt::kKeyVn>(kVendorName);
+    txtSet.Set<MeshCopTxt::kKeyMn>(kProductName);
+    txtSet.Set<MeshCopTxt::kKeyNn>(otThreadGetNetworkName(instance));
+    txtSet.Set<MeshCopTxt::kKeyXp>(extPanId->m8, sizeof(extPanId->m8));
+    txtSet.Set<MeshCopTxt::kKeyTv>(mNcp.GetThreadVersion());
 
     // "xa" stands for Extended MAC Address (64-bit) of the Thread Interface of the Border Agent.
-    txtList.emplace_back("xa", extAddr->m8, sizeof(extAddr->m8));
+    txtSet.Set<MeshCopTxt::kKeyXa>(extAddr->m8, sizeof(extAddr->m8));
 
     state.mConnectionMode = kConnectionModePskc;
     state.mAvailability   = kAvailabilityHigh;
 
-    switch (otThreadGetDeviceRole(instance))
+    switch (snapshot.mDeviceRole)
     {
     case OT_DEVICE_ROLE_DISABLED:
         state.mThreadIfStatus = kThreadIfStatusNotInitialized;
@@ -249,29 +272,25 @@ void BorderAgent::PublishMeshCopService(void)
 #endif
 
     stateUint32 = htobe32(state.ToUint32());
-    txtList.emplace_back("sb", reinterpret_cast<uint8_t *>(&stateUint32), sizeof(stateUint32));
+    txtSet.Set<MeshCopTxt::kKeySb>(&stateUint32, sizeof(stateUint32));
 
     if (state.mThreadIfStatus == kThreadIfStatusActive)
     {
-        otError              error;
-        otOperationalDataset activeDataset;
-        uint32_t             partitionId;
+        uint32_t partitionId = snapshot.mPartitionId;
 
-        if ((error = otDatasetGetActive(instance, &activeDataset)) != OT_ERROR_NONE)
+        if (!snapshot.mActiveDatasetValid)
         {
-            otbrLogWarning("Failed to get active dataset: %s", otThreadErrorToString(error));
+            otbrLogWarning("Failed to get active dataset");
         }
         else
         {
-            uint64_t activeTimestampValue = ConvertTimestampToUint64(activeDataset.mActiveTimestamp);
+            uint64_t activeTimestampValue = ConvertTimestampToUint64(snapshot.mActiveDataset.mActiveTimestamp);
 
             activeTimestampValue = htobe64(activeTimestampValue);
-            txtList.emplace_back("at", reinterpret_cast<uint8_t *>(&activeTimestampValue),
-                                 sizeof(activeTimestampValue));
+            txtSet.Set<MeshCopTxt::kKeyAt>(&activeTimestampValue, sizeof(activeTimestampValue));
         }
 
-        partitionId = otThreadGetPartitionId(instance);
-        txtList.emplace_back("pt", reinterpret_cast<uint8_t *>(&partitionId), sizeof(partitionId));
+        txtSet.Set<MeshCopTxt::kKeyPt>(&partitionId, sizeof(partitionId));
     }
 
 #if OTBR_ENABLE_BACKBONE_ROUTER
@@ -281,11 +300,11 @@ void BorderAgent::PublishMeshCopService(void)
         uint16_t               bbrPort = htobe16(BackboneRouter::BackboneAgent::kBackboneUdpPort);
 
         otBackboneRouterGetConfig(instance, &bbrConfig);
-        txtList.emplace_back("sq", &bbrConfig.mSequenceNumber, sizeof(bbrConfig.mSequenceNumber));
-        txtList.emplace_back("bb", reinterpret_cast<const uint8_t *>(&bbrPort), sizeof(bbrPort));
+        txtSet.Set<MeshCopTxt::kKeySq>(&bbrConfig.mSequenceNumber, sizeof(bbrConfig.mSequenceNumber));
+        txtSet.Set<MeshCopTxt::kKeyBb>(&bbrPort, sizeof(bbrPort));
     }
 
-    txtList.emplace_back("dn", otThreadGetDomainName(instance));
+    txtSet.Set<MeshCopTxt::kKeyDn>(otThreadGetDomainName(instance));
 #endif
     if (otBorderAgentGetState(instance) != OT_BORDER_AGENT_STATE_STOPPED)
     {
@@ -300,31 +319,55 @@ void BorderAgent::PublishMeshCopService(void)
         port = kBorderAgentServiceDummyPort;
     }
 
+    std::vector<uint8_t>     txtData;
+    Mdns::Publisher::TxtList txtList;
+
 #if OTBR_ENABLE_DBUS_SERVER
+    std::vector<const std::map<std::string, std::vector<uint8_t>>::value_type *> vendorExtras;
+
+    // Vendor overrides of well-known keys land in their slots; anything the
+    // table cannot absorb is carried over verbatim after the slots.
     for (const auto &entry : mMeshCopTxtUpdate)
     {
-        const std::string &         key   = entry.first;
-        const std::vector<uint8_t> &value = entry.second;
-        bool                        found = false;
-
-        for (auto &addedEntry : txtList)
+        if (!txtSet.SetByName(entry.first.c_str(), entry.second.data(), entry.second.size()))
         {
-            if (addedEntry.mName == key)
-            {
-                addedEntry.mValue = value;
-                found             = true;
-                break;
-            }
-        }
-        if (!found)
-        {
-            txtList.emplace_back(key.c_str(), value.data(), value.size());
+            vendorExtras.push_back(&entry);
         }
     }
 #endif
 
+    // The publisher API takes a TxtList, so the fixed slots convert at this
+    // boundary only, in table order.
+    txtSet.AppendTo(txtList);
+
+#if OTBR_ENABLE_DBUS_SERVER
+    for (const auto *entry : vendorExtras)
+    {
+        txtList.emplace_back(entry->first.c_str(), entry->second.data(), entry->second.size());
+    }
+#endif
+
+    // Skip the publication entirely when nothing the state change affected
+    // actually made it into the encoded service content.
+    if (Mdns::Publisher::EncodeTxtData(txtList, txtData) == OTBR_ERROR_NONE && port == mPublishedPort &&
+        mServiceInstanceName == mPublishedInstanceName && txtData == mPublishedTxtData)
+    {
+        ++mAvoidedRepublishCount;
+        otbrLogInfo("Meshcop service %s.%s.local is unchanged, skipping publish (%llu avoided so far)",
+                    mServiceInstanceName.c_str(), kBorderAgentServiceType,
+                    static_cast<unsigned long long>(mAvoidedRepublishCount));
+        ExitNow();
+    }
+
+    mPublishedInstanceName = mServiceInstanceName;
+    mPublishedPort         = port;
+    mPublishedTxtData      = std::move(txtData);
+
+    mStateSnapshot.SetMeshCopService(mPublishedInstanceName, static_cast<uint16_t>(mPublishedPort), mPublishedTxtData,
+                                     ComputeActiveDatasetDigest());
+
     mPublisher->PublishService(/* aHostName */ "", mServiceInstanceName, kBorderAgentServiceType,
-                               Mdns::Publisher::SubTypeList{}, port, txtList, [this](otbrError aError) {
+                               Mdns::Publisher::SubTypeList{}, port, std::move(txtList), [this](otbrError aError) {
                                    if (aError == OTBR_ERROR_ABORTED)
                                    {
                                        // OTBR_ERROR_ABORTED is thrown when an ongoing service registration is
@@ -337,6 +380,11 @@ void BorderAgent::PublishMeshCopService(void)
                                    {
                                        otbrLogResult(aError, "Result of publish meshcop service %s.%s.local",
                                                      mServiceInstanceName.c_str(), kBorderAgentServiceType);
+                                       if (aError != OTBR_ERROR_NONE)
+                                       {
+                                           // Forget the cached content so the next update retries.
+                                           mPublishedTxtData.clear();
+                                       }
                                    }
                                    if (aError == OTBR_ERROR_DUPLICATED)
                                    {
@@ -348,18 +396,79 @@ void BorderAgent::PublishMeshCopService(void)
                                        PublishMeshCopService();
                                    }
                                });
+
+exit:
+    return;
 }
 
 void BorderAgent::UnpublishMeshCopService(void)
 {
     otbrLogInfo("Unpublish meshcop service %s.%s.local", mServiceInstanceName.c_str(), kBorderAgentServiceType);
 
+    mPublishedInstanceName.clear();
+    mPublishedTxtData.clear();
+
     mPublisher->UnpublishService(mServiceInstanceName, kBorderAgentServiceType, [this](otbrError aError) {
         otbrLogResult(aError, "Result of unpublish meshcop service %s.%s.local", mServiceInstanceName.c_str(),
                       kBorderAgentServiceType);
     });
 }
 
+uint64_t BorderAgent::ComputeActiveDatasetDigest(void)
+{
+    otOperationalDatasetTlvs datasetTlvs;
+    uint64_t                 digest = 0;
+
+    if (otDatasetGetActiveTlvs(mNcp.GetInstance(), &datasetTlvs) == OT_ERROR_NONE)
+    {
+        digest = Utils::StateSnapshot::ComputeDigest(datasetTlvs.mTlvs, datasetTlvs.mLength);
+    }
+
+    return digest;
+}
+
+bool BorderAgent::WarmStartMeshCopService(void)
+{
+    bool                     published = false;
+    std::string              instanceName;
+    uint16_t                 port   = 0;
+    uint64_t                 digest = 0;
+    std::vector<uint8_t>     txtData;
+    Mdns::Publisher::TxtList txtList;
+
+    // Only worth doing before the first regular publication.
+    VerifyOrExit(mPublishedTxtData.empty());
+    VerifyOrExit(mStateSnapshot.GetMeshCopService(instanceName, port, txtData, digest));
+    VerifyOrExit(digest != 0 && digest == ComputeActiveDatasetDigest(),
+                 otbrLogInfo("Skipping warm start: active dataset changed since the snapshot was written"));
+    VerifyOrExit(Mdns::Publisher::DecodeTxtData(txtList, txtData.data(), static_cast<uint16_t>(txtData.size())) ==
+                 OTBR_ERROR_NONE);
+
+    otbrLogInfo("Warm-starting meshcop service %s.%s.local from the state snapshot", instanceName.c_str(),
+                kBorderAgentServiceType);
+
+    mServiceInstanceName   = instanceName;
+    mPublishedInstanceName = instanceName;
+    mPublishedPort         = port;
+    mPublishedTxtData      = std::move(txtData);
+
+    mPublisher->PublishService(/* aHostName */ "", mServiceInstanceName, kBorderAgentServiceType,
+                               Mdns::Publisher::SubTypeList{}, port, std::move(txtList), [this](otbrError aError) {
+                                   otbrLogResult(aError, "Result of warm-start publish meshcop service %s.%s.local",
+                                                 mServiceInstanceName.c_str(), kBorderAgentServiceType);
+                                   if (aError != OTBR_ERROR_NONE)
+                                   {
+                                       // Fall back to the regular publication path.
+                                       mPublishedTxtData.clear();
+                                       UpdateMeshCopService();
+                                   }
+                               });
+    published = true;
+
+exit:
+    return published;
+}
+
 void BorderAgent::UpdateMeshCopService(void)
 {
     VerifyOrExit(mPublisher->IsStarted(), mPublisher->Start());
@@ -368,11 +477,32 @@ exit:
     return;
 }
 
+void BorderAgent::ScheduleUpdateMeshCopService(void)
+{
+    if (mMeshCopUpdateDebounceWindow == Milliseconds::zero())
+    {
+        UpdateMeshCopService();
+        ExitNow();
+    }
+
+    // Further state changes within the window ride on the already scheduled
+    // update, so a republish storm collapses into a single publication.
+    VerifyOrExit(mUpdateMeshCopTaskId == 0);
+
+    mUpdateMeshCopTaskId = mTaskRunner.Post(mMeshCopUpdateDebounceWindow, [this]() {
+        mUpdateMeshCopTaskId = 0;
+        UpdateMeshCopService();
+    });
+
+exit:
+    return;
+}
+
 #if OTBR_ENABLE_DBUS_SERVER
 void BorderAgent::HandleUpdateVendorMeshCoPTxtEntries(std::map<std::string, std::vector<uint8_t>> aUpdate)
 {
     mMeshCopTxtUpdate = std::move(aUpdate);
-    UpdateMeshCopService();
+    ScheduleUpdateMeshCopService();
 }
 #endif
 
@@ -391,7 +521,7 @@ void BorderAgent::HandleThreadStateChanged(otChangedFlags aFlags)
     if (aFlags & (OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_EXT_PANID | OT_CHANGED_THREAD_NETWORK_NAME |
                   OT_CHANGED_THREAD_BACKBONE_ROUTER_STATE))
     {
-        UpdateMeshCopService();
+        ScheduleUpdateMeshCopService();
     }
 exit:
     return;
@@ -399,9 +529,7 @@ exit:
 
 bool BorderAgent::IsThreadStarted(void) const
 {
-    otDeviceRole role = otThreadGetDeviceRole(mNcp.GetInstance());
-
-    return role == OT_DEVICE_ROLE_CHILD || role == OT_DEVICE_ROLE_ROUTER || role == OT_DEVICE_ROLE_LEADER;
+    return mNcp.GetStateSnapshot().IsAttached();
 }
 
 std::string BorderAgent::BaseServiceInstanceName() const
@@ -45,11 +45,14 @@
 #include "backbone_router/backbone_agent.hpp"
 #include "common/code_utils.hpp"
 #include "common/mainloop.hpp"
+#include "common/task_runner.hpp"
+#include "common/time.hpp"
 #include "mdns/mdns.hpp"
 #include "ncp/ncp_openthread.hpp"
 #include "sdp_proxy/advertising_proxy.hpp"
 #include "sdp_proxy/discovery_proxy.hpp"
 #include "trel_dnssd/trel_dnssd.hpp"
+#include "utils/state_snapshot.hpp"
 
 #ifndef OTBR_VENDOR_NAME
 #define OTBR_VENDOR_NAME "OpenThread"
@@ -111,6 +114,24 @@ public:
      */
     Mdns::Publisher &GetPublisher() { return *mPublisher; }
 
+    /**
+     * This method sets the window within which Thread state changes are
+     * coalesced into a single MeshCoP service update.
+     *
+     * @param[in] aWindow  The debounce window. Zero publishes immediately.
+     *
+     */
+    void SetMeshCopUpdateDebounceWindow(Milliseconds aWindow) { mMeshCopUpdateDebounceWindow = aWindow; }
+
+    /**
+     * This method returns the number of MeshCoP service updates that were
+     * skipped because the published content would not have changed.
+     *
+     * @returns  The number of avoided republishes.
+     *
+     */
+    uint64_t GetAvoidedMeshCopRepublishCount(void) const { return mAvoidedRepublishCount; }
+
 private:
     enum : uint8_t
     {
@@ -159,6 +180,7 @@ private:
     void HandleMdnsState(Mdns::Publisher::State aState);
     void PublishMeshCopService(void);
     void UpdateMeshCopService(void);
+    void ScheduleUpdateMeshCopService(void);
     void UnpublishMeshCopService(void);
 #if OTBR_ENABLE_DBUS_SERVER
     void HandleUpdateVendorMeshCoPTxtEntries(std::map<std::string, std::vector<uint8_t>> aUpdate);
@@ -166,6 +188,9 @@ private:
 
     void HandleThreadStateChanged(otChangedFlags aFlags);
 
+    bool     WarmStartMeshCopService(void);
+    uint64_t ComputeActiveDatasetDigest(void);
+
     bool        IsThreadStarted(void) const;
     std::string BaseServiceInstanceName() const;
     std::string GetAlternativeServiceInstanceName() const;
@@ -188,6 +213,23 @@ private:
 #endif
 
     std::string mServiceInstanceName;
+
+    TaskRunner         mTaskRunner;
+    TaskRunner::TaskId mUpdateMeshCopTaskId{0};
+    Milliseconds       mMeshCopUpdateDebounceWindow{300};
+
+    // The instance name, port and encoded TXT data of the last MeshCoP
+    // service publication; a republication with identical content is
+    // skipped entirely.
+    std::string          mPublishedInstanceName;
+    int                  mPublishedPort{0};
+    std::vector<uint8_t> mPublishedTxtData;
+
+    uint64_t mAvoidedRepublishCount{0};
+
+    // Persists the published registration across restarts so a new agent
+    // instance can re-advertise before the NCP state is re-derived.
+    Utils::StateSnapshot mStateSnapshot;
 };
 
 /**
@@ -0,0 +1,83 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "border_agent/meshcop_txt.hpp"
+
+#include <assert.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+constexpr char MeshCopTxt::kKeyNames[MeshCopTxt::kNumKeys][3];
+
+void MeshCopTxt::SetSlot(Key aKey, const void *aValue, size_t aLength)
+{
+    Slot &slot = mSlots[aKey];
+
+    assert(aLength <= kMaxValueSize);
+
+    slot.mPresent = true;
+    slot.mLength  = static_cast<uint8_t>(aLength);
+    memcpy(slot.mValue, aValue, aLength);
+}
+
+bool MeshCopTxt::SetByName(const char *aName, const void *aValue, size_t aLength)
+{
+    bool found = false;
+
+    VerifyOrExit(aLength <= kMaxValueSize);
+
+    for (uint8_t key = 0; key < kNumKeys; key++)
+    {
+        if (strcmp(aName, kKeyNames[key]) == 0)
+        {
+            SetSlot(static_cast<Key>(key), aValue, aLength);
+            found = true;
+            break;
+        }
+    }
+
+exit:
+    return found;
+}
+
+void MeshCopTxt::AppendTo(Mdns::Publisher::TxtList &aTxtList) const
+{
+    for (uint8_t key = 0; key < kNumKeys; key++)
+    {
+        const Slot &slot = mSlots[key];
+
+        if (slot.mPresent)
+        {
+            aTxtList.emplace_back(kKeyNames[key], slot.mValue, slot.mLength);
+        }
+    }
+}
+
+} // namespace otbr
@@ -0,0 +1,173 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions of the fixed-slot MeshCoP TXT key-value set.
+ */
+
+#ifndef OTBR_AGENT_MESHCOP_TXT_HPP_
+#define OTBR_AGENT_MESHCOP_TXT_HPP_
+
+#include "openthread-br/config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "mdns/mdns.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements fixed-slot storage for the compile-time MeshCoP TXT key set.
+ *
+ * The `_meshcop._udp` TXT keys are fixed by the Thread specification, so
+ * instead of assembling them through string-keyed map operations on every
+ * state transition, each key gets a dedicated slot and a setter that resolves
+ * the slot at compile time. Setting a value is a bounds-checked `memcpy`;
+ * re-assembling the full set allocates nothing and always visits the slots in
+ * the same order, giving a deterministic encode cost per update.
+ *
+ * Vendor-supplied entries with keys outside this table (via the
+ * UpdateVendorMeshCopTxtEntries D-Bus API) are not stored here; only
+ * overrides of table keys are, through the runtime `SetByName()` path.
+ *
+ */
+class MeshCopTxt
+{
+public:
+    /**
+     * This enumeration represents the well-known MeshCoP TXT keys, in the
+     * order they are emitted.
+     *
+     */
+    enum Key : uint8_t
+    {
+        kKeyRv,   ///< Record version.
+        kKeyVn,   ///< Vendor name.
+        kKeyMn,   ///< Model name.
+        kKeyNn,   ///< Network name.
+        kKeyXp,   ///< Extended PAN ID.
+        kKeyTv,   ///< Thread version.
+        kKeyXa,   ///< Extended MAC address.
+        kKeySb,   ///< State bitmap.
+        kKeyAt,   ///< Active timestamp.
+        kKeyPt,   ///< Partition ID.
+        kKeySq,   ///< BBR sequence number.
+        kKeyBb,   ///< Backbone UDP port.
+        kKeyDn,   ///< Domain name.
+        kNumKeys, ///< The number of well-known keys.
+    };
+
+    MeshCopTxt(void) { Clear(); }
+
+    /**
+     * This method clears all slots.
+     *
+     */
+    void Clear(void) { memset(mSlots, 0, sizeof(mSlots)); }
+
+    /**
+     * This method sets the value of a key resolved at compile time.
+     *
+     * @param[in] aValue   A pointer to the value bytes.
+     * @param[in] aLength  The value length, which must not exceed `kMaxValueSize`.
+     *
+     */
+    template <Key kKey> void Set(const void *aValue, size_t aLength)
+    {
+        static_assert(kKey < kNumKeys, "unknown MeshCoP TXT key");
+        SetSlot(kKey, aValue, aLength);
+    }
+
+    /**
+     * This method sets the value of a key resolved at compile time from a C string.
+     *
+     * @param[in] aValue  The value as a null-terminated string.
+     *
+     */
+    template <Key kKey> void Set(const char *aValue) { Set<kKey>(aValue, strlen(aValue)); }
+
+    /**
+     * This method clears the slot of a key resolved at compile time.
+     *
+     */
+    template <Key kKey> void Unset(void)
+    {
+        static_assert(kKey < kNumKeys, "unknown MeshCoP TXT key");
+        mSlots[kKey].mPresent = false;
+    }
+
+    /**
+     * This method sets the value of a key looked up by name at runtime.
+     *
+     * This is the override path for vendor-provided entries whose keys happen
+     * to match the well-known table.
+     *
+     * @param[in] aName    The TXT key name.
+     * @param[in] aValue   A pointer to the value bytes.
+     * @param[in] aLength  The value length.
+     *
+     * @retval true   The name matched a well-known key and the slot was set.
+     * @retval false  The name is not in the table or the value does not fit a
+     *                slot; the caller keeps the entry.
+     *
+     */
+    bool SetByName(const char *aName, const void *aValue, size_t aLength);
+
+    /**
+     * This method appends all present slots, in table order, to a TXT entry list.
+     *
+     * @param[out] aTxtList  The list to append to.
+     *
+     */
+    void AppendTo(Mdns::Publisher::TxtList &aTxtList) const;
+
+    static constexpr size_t kMaxValueSize = 64; ///< The largest value any slot holds.
+
+private:
+    struct Slot
+    {
+        bool    mPresent;
+        uint8_t mLength;
+        uint8_t mValue[kMaxValueSize];
+    };
+
+    void SetSlot(Key aKey, const void *aValue, size_t aLength);
+
+    static constexpr char kKeyNames[kNumKeys][3] = {
+        "rv", "vn", "mn", "nn", "xp", "tv", "xa", "sb", "at", "pt", "sq", "bb", "dn",
+    };
+
+    Slot mSlots[kNumKeys];
+};
+
+} // namespace otbr
+
+#endif // OTBR_AGENT_MESHCOP_TXT_HPP_
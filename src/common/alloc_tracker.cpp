@@ -0,0 +1,250 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define OTBR_LOG_TAG "ALLOC"
+
+#include "common/alloc_tracker.hpp"
+
+#include <cstddef>
+#include <new>
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "common/logging.hpp"
+
+namespace otbr {
+
+thread_local uint8_t AllocTracker::sCurrentTag = 0;
+
+AllocTracker &AllocTracker::GetInstance(void)
+{
+    static AllocTracker sInstance;
+
+    return sInstance;
+}
+
+AllocTracker::AllocTracker(void)
+    : mNumTags(1)
+{
+    mTags[0].mName = "untagged";
+}
+
+uint8_t AllocTracker::RegisterTag(const char *aName)
+{
+    uint8_t tag     = 0;
+    uint8_t numTags = mNumTags.load(std::memory_order_relaxed);
+
+    for (uint8_t i = 0; i < numTags; i++)
+    {
+        VerifyOrExit(strcmp(mTags[i].mName, aName) != 0, tag = i);
+    }
+
+    VerifyOrExit(numTags < kMaxTags);
+
+    mTags[numTags].mName = aName;
+    tag                  = numTags;
+    mNumTags.store(static_cast<uint8_t>(numTags + 1), std::memory_order_release);
+
+exit:
+    return tag;
+}
+
+uint8_t AllocTracker::SizeToClass(size_t aSize)
+{
+    uint8_t sizeClass = 0;
+    size_t  bound     = kMinClassSize;
+
+    while (sizeClass < kNumSizeClasses - 1 && aSize > bound)
+    {
+        sizeClass++;
+        bound <<= 1;
+    }
+
+    return sizeClass;
+}
+
+void AllocTracker::RecordAlloc(uint8_t aTag, size_t aSize)
+{
+    TagStats &stats = mTags[aTag < kMaxTags ? aTag : 0];
+
+    stats.mLiveBytes.fetch_add(aSize, std::memory_order_relaxed);
+    stats.mLiveAllocs.fetch_add(1, std::memory_order_relaxed);
+    stats.mTotalAllocs.fetch_add(1, std::memory_order_relaxed);
+    stats.mSizeClassAllocs[SizeToClass(aSize)].fetch_add(1, std::memory_order_relaxed);
+}
+
+void AllocTracker::RecordFree(uint8_t aTag, size_t aSize)
+{
+    TagStats &stats = mTags[aTag < kMaxTags ? aTag : 0];
+
+    stats.mLiveBytes.fetch_sub(aSize, std::memory_order_relaxed);
+    stats.mLiveAllocs.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void AllocTracker::LogStats(void) const
+{
+#if OTBR_ENABLE_ALLOC_PROFILING
+    uint8_t numTags = mNumTags.load(std::memory_order_acquire);
+
+    otbrLogNotice("Heap allocation stats by tag:");
+
+    for (uint8_t i = 0; i < numTags; i++)
+    {
+        const TagStats &stats = mTags[i];
+
+        otbrLogNotice("  %-10s live %llu bytes in %llu allocations (%llu allocations total)", stats.mName,
+                      static_cast<unsigned long long>(stats.mLiveBytes.load(std::memory_order_relaxed)),
+                      static_cast<unsigned long long>(stats.mLiveAllocs.load(std::memory_order_relaxed)),
+                      static_cast<unsigned long long>(stats.mTotalAllocs.load(std::memory_order_relaxed)));
+
+        for (uint8_t sizeClass = 0; sizeClass < kNumSizeClasses; sizeClass++)
+        {
+            uint64_t count = stats.mSizeClassAllocs[sizeClass].load(std::memory_order_relaxed);
+            size_t   bound = kMinClassSize << sizeClass;
+
+            if (count == 0)
+            {
+                continue;
+            }
+
+            // The last class catches everything past the second-largest bound.
+            otbrLogNotice("    %s %6zu bytes: %llu allocations", sizeClass + 1 < kNumSizeClasses ? "<=" : "> ",
+                          sizeClass + 1 < kNumSizeClasses ? bound : bound / 2,
+                          static_cast<unsigned long long>(count));
+        }
+    }
+#else
+    otbrLogNotice("Heap allocation stats unavailable; rebuild with -DOTBR_ALLOC_PROFILING=ON");
+#endif
+}
+
+} // namespace otbr
+
+#if OTBR_ENABLE_ALLOC_PROFILING
+
+namespace {
+
+// Prepended to every allocation so the matching deallocation can be
+// attributed to the tag that was current at allocation time.
+struct alignas(alignof(std::max_align_t)) AllocHeader
+{
+    size_t  mSize;
+    uint8_t mTag;
+};
+
+void *TrackedAlloc(size_t aSize)
+{
+    AllocHeader *header = static_cast<AllocHeader *>(malloc(aSize + sizeof(AllocHeader)));
+
+    if (header == nullptr)
+    {
+        return nullptr;
+    }
+
+    header->mSize = aSize;
+    header->mTag  = otbr::AllocTracker::GetCurrentTag();
+    otbr::AllocTracker::GetInstance().RecordAlloc(header->mTag, aSize);
+
+    return header + 1;
+}
+
+void TrackedFree(void *aPointer)
+{
+    AllocHeader *header;
+
+    if (aPointer == nullptr)
+    {
+        return;
+    }
+
+    header = static_cast<AllocHeader *>(aPointer) - 1;
+    otbr::AllocTracker::GetInstance().RecordFree(header->mTag, header->mSize);
+    free(header);
+}
+
+} // namespace
+
+void *operator new(size_t aSize)
+{
+    void *pointer = TrackedAlloc(aSize);
+
+    if (pointer == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    return pointer;
+}
+
+void *operator new[](size_t aSize)
+{
+    return operator new(aSize);
+}
+
+void *operator new(size_t aSize, const std::nothrow_t &) noexcept
+{
+    return TrackedAlloc(aSize);
+}
+
+void *operator new[](size_t aSize, const std::nothrow_t &) noexcept
+{
+    return TrackedAlloc(aSize);
+}
+
+void operator delete(void *aPointer) noexcept
+{
+    TrackedFree(aPointer);
+}
+
+void operator delete[](void *aPointer) noexcept
+{
+    TrackedFree(aPointer);
+}
+
+void operator delete(void *aPointer, size_t) noexcept
+{
+    TrackedFree(aPointer);
+}
+
+void operator delete[](void *aPointer, size_t) noexcept
+{
+    TrackedFree(aPointer);
+}
+
+void operator delete(void *aPointer, const std::nothrow_t &) noexcept
+{
+    TrackedFree(aPointer);
+}
+
+void operator delete[](void *aPointer, const std::nothrow_t &) noexcept
+{
+    TrackedFree(aPointer);
+}
+
+#endif // OTBR_ENABLE_ALLOC_PROFILING
@@ -0,0 +1,168 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions of per-subsystem heap allocation accounting.
+ */
+
+#ifndef OTBR_COMMON_ALLOC_TRACKER_HPP_
+#define OTBR_COMMON_ALLOC_TRACKER_HPP_
+
+#include "openthread-br/config.h"
+
+#include <atomic>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+/**
+ * This class accounts heap allocations per subsystem tag.
+ *
+ * Subsystems register a tag once and set it as the current tag around their
+ * hot paths with `TagScope`; when the agent is built with
+ * `OTBR_ALLOC_PROFILING`, overridden global `operator new`/`delete` attribute
+ * every allocation to the tag active on the allocating thread, so live bytes
+ * and a power-of-two size-class histogram of allocation counts can be broken
+ * down by subsystem without valgrind. Without the build flag the
+ * operators are not overridden and the only cost is a thread-local store per
+ * scope.
+ *
+ * Tag names must be string literals; only the pointers are stored.
+ *
+ */
+class AllocTracker : private NonCopyable
+{
+public:
+    static constexpr uint8_t kMaxTags        = 16; ///< Maximum number of tags, including the implicit "untagged".
+    static constexpr uint8_t kNumSizeClasses = 14; ///< Size classes: <=8 B doubling up to <=32 KiB, plus overflow.
+
+    /**
+     * This class sets the calling thread's current allocation tag for its lifetime.
+     *
+     */
+    class TagScope : private NonCopyable
+    {
+    public:
+        /**
+         * This constructor makes @p aTag the calling thread's current allocation tag.
+         *
+         * @param[in] aTag  The tag index returned by `RegisterTag()`.
+         *
+         */
+        explicit TagScope(uint8_t aTag)
+            : mPreviousTag(sCurrentTag)
+        {
+            sCurrentTag = aTag;
+        }
+
+        ~TagScope(void) { sCurrentTag = mPreviousTag; }
+
+    private:
+        uint8_t mPreviousTag;
+    };
+
+    /**
+     * This method returns the process-wide allocation tracker.
+     *
+     * @returns A reference to the tracker singleton.
+     *
+     */
+    static AllocTracker &GetInstance(void);
+
+    /**
+     * This method registers an allocation tag, or returns the existing one of the same name.
+     *
+     * @param[in] aName  The tag name; must be a string literal.
+     *
+     * @returns The tag index, or 0 (the "untagged" tag) if the tag table is full.
+     *
+     */
+    uint8_t RegisterTag(const char *aName);
+
+    /**
+     * This method returns the calling thread's current allocation tag.
+     *
+     * @returns The current tag index.
+     *
+     */
+    static uint8_t GetCurrentTag(void) { return sCurrentTag; }
+
+    /**
+     * This method accounts one allocation against a tag.
+     *
+     * @param[in] aTag   The tag index.
+     * @param[in] aSize  The allocation size in bytes.
+     *
+     */
+    void RecordAlloc(uint8_t aTag, size_t aSize);
+
+    /**
+     * This method accounts one deallocation against a tag.
+     *
+     * @param[in] aTag   The tag index the matching allocation was accounted against.
+     * @param[in] aSize  The allocation size in bytes.
+     *
+     */
+    void RecordFree(uint8_t aTag, size_t aSize);
+
+    /**
+     * This method logs the per-tag live bytes, live allocations and total allocations.
+     *
+     */
+    void LogStats(void) const;
+
+private:
+    struct TagStats
+    {
+        const char *          mName = nullptr;
+        std::atomic<uint64_t> mLiveBytes{0};
+        std::atomic<uint64_t> mLiveAllocs{0};
+        std::atomic<uint64_t> mTotalAllocs{0};
+        std::atomic<uint64_t> mSizeClassAllocs[kNumSizeClasses]{};
+    };
+
+    static constexpr size_t kMinClassSize = 8;
+
+    AllocTracker(void);
+
+    static uint8_t SizeToClass(size_t aSize);
+
+    static thread_local uint8_t sCurrentTag;
+
+    TagStats             mTags[kMaxTags];
+    std::atomic<uint8_t> mNumTags;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_ALLOC_TRACKER_HPP_
@@ -0,0 +1,89 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/arena.hpp"
+
+#include <cstddef>
+#include <new>
+
+namespace otbr {
+
+ScratchArena &ScratchArena::GetInstance(void)
+{
+    static ScratchArena sInstance;
+
+    return sInstance;
+}
+
+ScratchArena::ScratchArena(void)
+    : mBuffer(kArenaSize)
+    , mOffset(0)
+    , mHighWatermark(0)
+{
+}
+
+void *ScratchArena::Allocate(size_t aSize)
+{
+    constexpr size_t kAlignment = alignof(std::max_align_t);
+    void *           block;
+
+    aSize = (aSize + kAlignment - 1) & ~(kAlignment - 1);
+
+    if (mOffset + aSize <= kArenaSize)
+    {
+        block = &mBuffer[mOffset];
+        mOffset += aSize;
+
+        if (mOffset > mHighWatermark)
+        {
+            mHighWatermark = mOffset;
+        }
+    }
+    else
+    {
+        // Oversized or overflowing allocations fall back to the heap; they
+        // are released together with the bump region at the next reset.
+        block = ::operator new(aSize);
+        mOverflow.push_back(block);
+    }
+
+    return block;
+}
+
+void ScratchArena::Reset(void)
+{
+    mOffset = 0;
+
+    for (void *block : mOverflow)
+    {
+        ::operator delete(block);
+    }
+    mOverflow.clear();
+}
+
+} // namespace otbr
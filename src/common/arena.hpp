@@ -0,0 +1,157 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions of a bump allocator for per-event scratch memory.
+ */
+
+#ifndef OTBR_COMMON_ARENA_HPP_
+#define OTBR_COMMON_ARENA_HPP_
+
+#include "openthread-br/config.h"
+
+#include <string>
+#include <vector>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements a bump allocator for short-lived per-event scratch memory.
+ *
+ * Allocations are served by advancing an offset into a fixed block, and all of
+ * them are reclaimed at once by `Reset()`, which the mainloop calls after each
+ * `Process()` pass. This removes malloc/free pairs from steady-state event
+ * handling for containers that never outlive the event being handled.
+ *
+ * Memory obtained from the arena MUST NOT be kept across a mainloop iteration;
+ * anything that outlives the event belongs in a normally allocated container.
+ * The arena is not thread-safe and is intended for mainloop-only use. When the
+ * fixed block is exhausted, allocations transparently fall back to the heap
+ * and are released at the next `Reset()`.
+ *
+ */
+class ScratchArena : private NonCopyable
+{
+public:
+    /**
+     * This method returns the process-wide scratch arena.
+     *
+     * @returns A reference to the scratch arena singleton.
+     *
+     */
+    static ScratchArena &GetInstance(void);
+
+    /**
+     * This method allocates @p aSize bytes of scratch memory.
+     *
+     * The returned memory is suitably aligned for any type and stays valid
+     * until the next call to `Reset()`.
+     *
+     * @param[in] aSize  The number of bytes to allocate.
+     *
+     * @returns A pointer to the allocated memory.
+     *
+     */
+    void *Allocate(size_t aSize);
+
+    /**
+     * This method reclaims all scratch memory allocated since the last reset.
+     *
+     */
+    void Reset(void);
+
+    /**
+     * This method returns the largest arena usage seen in a single pass.
+     *
+     * @returns The high watermark, in bytes, of bump-allocated memory.
+     *
+     */
+    size_t GetHighWatermark(void) const { return mHighWatermark; }
+
+private:
+    static constexpr size_t kArenaSize = 64 * 1024;
+
+    ScratchArena(void);
+
+    std::vector<uint8_t> mBuffer;
+    size_t               mOffset;
+    size_t               mHighWatermark;
+    std::vector<void *>  mOverflow;
+};
+
+/**
+ * This template class adapts the scratch arena to the STL allocator interface.
+ *
+ * Containers instantiated with this allocator draw from `ScratchArena` and
+ * must respect its lifetime rules: they are for locals that die before the
+ * current mainloop pass completes.
+ *
+ */
+template <typename Type> class ScratchAllocator
+{
+public:
+    typedef Type value_type;
+
+    ScratchAllocator(void) = default;
+
+    template <typename Other> ScratchAllocator(const ScratchAllocator<Other> &)
+    {
+    }
+
+    Type *allocate(size_t aCount)
+    {
+        return static_cast<Type *>(ScratchArena::GetInstance().Allocate(aCount * sizeof(Type)));
+    }
+
+    // Individual deallocation is a no-op; the arena reclaims in bulk on reset.
+    void deallocate(Type *, size_t) {}
+};
+
+template <typename Lhs, typename Rhs> bool operator==(const ScratchAllocator<Lhs> &, const ScratchAllocator<Rhs> &)
+{
+    return true;
+}
+
+template <typename Lhs, typename Rhs> bool operator!=(const ScratchAllocator<Lhs> &, const ScratchAllocator<Rhs> &)
+{
+    return false;
+}
+
+template <typename Type> using ScratchVector = std::vector<Type, ScratchAllocator<Type>>;
+
+using ScratchString = std::basic_string<char, std::char_traits<char>, ScratchAllocator<char>>;
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_ARENA_HPP_
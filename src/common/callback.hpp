@@ -29,11 +29,189 @@
 #ifndef OTBR_COMMON_CALLBACK_HPP_
 #define OTBR_COMMON_CALLBACK_HPP_
 
+#include <cstddef>
 #include <functional>
+#include <new>
 #include <type_traits>
+#include <utility>
 
 namespace otbr {
 
+/**
+ * The default inline storage size of `MoveOnlyFunction`, chosen to fit the
+ * typical capture of a `this` pointer plus a couple of strings or ids.
+ *
+ */
+constexpr size_t kDefaultCallbackInlineSize = 48;
+
+template <class T, size_t kInlineSize = kDefaultCallbackInlineSize> class MoveOnlyFunction;
+
+/**
+ * A move-only, small-buffer-optimized alternative to `std::function`.
+ *
+ * Callables whose size fits the inline storage are stored in place, so
+ * creating and posting such a callback performs no heap allocation; larger
+ * callables fall back to the heap. The type is move-only, which also allows
+ * wrapping callables that `std::function` rejects (e.g. ones capturing
+ * `std::unique_ptr`).
+ *
+ */
+template <typename R, typename... Args, size_t kInlineSize> class MoveOnlyFunction<R(Args...), kInlineSize>
+{
+public:
+    MoveOnlyFunction(void) = default;
+
+    MoveOnlyFunction(std::nullptr_t) {}
+
+    // Constructs a `MoveOnlyFunction` instance with a callable. The
+    // `std::enable_if` check keeps this constructor from hijacking the
+    // move constructor.
+    template <typename T,
+              typename = typename std::enable_if<
+                  !std::is_same<MoveOnlyFunction, typename std::decay<T>::type>::value>::type>
+    MoveOnlyFunction(T &&aFunc)
+    {
+        using Callable = typename std::decay<T>::type;
+        using Traits   = CallableTraits<Callable,
+                                      (sizeof(Callable) <= kInlineSize &&
+                                       alignof(Callable) <= alignof(typename std::aligned_storage<
+                                                                    kInlineSize, alignof(std::max_align_t)>::type))>;
+
+        Traits::Construct(&mStorage, std::forward<T>(aFunc));
+        mInvoke = &Traits::Invoke;
+        mManage = &Traits::Manage;
+    }
+
+    MoveOnlyFunction(const MoveOnlyFunction &) = delete;
+    MoveOnlyFunction &operator=(const MoveOnlyFunction &) = delete;
+
+    MoveOnlyFunction(MoveOnlyFunction &&aOther) noexcept { MoveFrom(std::move(aOther)); }
+
+    MoveOnlyFunction &operator=(MoveOnlyFunction &&aOther) noexcept
+    {
+        if (this != &aOther)
+        {
+            Reset();
+            MoveFrom(std::move(aOther));
+        }
+
+        return *this;
+    }
+
+    MoveOnlyFunction &operator=(std::nullptr_t)
+    {
+        Reset();
+        return *this;
+    }
+
+    ~MoveOnlyFunction(void) { Reset(); }
+
+    R operator()(Args... aArgs) const
+    {
+        return mInvoke(const_cast<void *>(static_cast<const void *>(&mStorage)), std::forward<Args>(aArgs)...);
+    }
+
+    bool IsNull(void) const { return mInvoke == nullptr; }
+
+    explicit operator bool(void) const { return !IsNull(); }
+
+private:
+    enum class Op
+    {
+        kMoveTo,  ///< Move the callable from `aStorage` into `aOther`.
+        kDestroy, ///< Destroy the callable in `aStorage`.
+    };
+
+    using Storage = typename std::aligned_storage<kInlineSize, alignof(std::max_align_t)>::type;
+
+    template <typename Callable, bool kStoreInline> struct CallableTraits;
+
+    // The callable fits the inline storage and is stored in place.
+    template <typename Callable> struct CallableTraits<Callable, true>
+    {
+        template <typename T> static void Construct(void *aStorage, T &&aFunc)
+        {
+            new (aStorage) Callable(std::forward<T>(aFunc));
+        }
+
+        static R Invoke(void *aStorage, Args... aArgs)
+        {
+            return (*static_cast<Callable *>(aStorage))(std::forward<Args>(aArgs)...);
+        }
+
+        static void Manage(Op aOp, void *aStorage, void *aOther)
+        {
+            Callable *callable = static_cast<Callable *>(aStorage);
+
+            if (aOp == Op::kMoveTo)
+            {
+                new (aOther) Callable(std::move(*callable));
+            }
+
+            callable->~Callable();
+        }
+    };
+
+    // The callable is too large for the inline storage and lives on the heap.
+    template <typename Callable> struct CallableTraits<Callable, false>
+    {
+        template <typename T> static void Construct(void *aStorage, T &&aFunc)
+        {
+            *static_cast<Callable **>(aStorage) = new Callable(std::forward<T>(aFunc));
+        }
+
+        static R Invoke(void *aStorage, Args... aArgs)
+        {
+            return (**static_cast<Callable **>(aStorage))(std::forward<Args>(aArgs)...);
+        }
+
+        static void Manage(Op aOp, void *aStorage, void *aOther)
+        {
+            Callable **callable = static_cast<Callable **>(aStorage);
+
+            if (aOp == Op::kMoveTo)
+            {
+                *static_cast<Callable **>(aOther) = *callable;
+            }
+            else
+            {
+                delete *callable;
+            }
+
+            *callable = nullptr;
+        }
+    };
+
+    void MoveFrom(MoveOnlyFunction &&aOther)
+    {
+        mInvoke = aOther.mInvoke;
+        mManage = aOther.mManage;
+
+        if (mManage != nullptr)
+        {
+            mManage(Op::kMoveTo, &aOther.mStorage, &mStorage);
+        }
+
+        aOther.mInvoke = nullptr;
+        aOther.mManage = nullptr;
+    }
+
+    void Reset(void)
+    {
+        if (mManage != nullptr)
+        {
+            mManage(Op::kDestroy, &mStorage, nullptr);
+        }
+
+        mInvoke = nullptr;
+        mManage = nullptr;
+    }
+
+    R (*mInvoke)(void *, Args...) = nullptr;
+    void (*mManage)(Op, void *, void *) = nullptr;
+    Storage mStorage;
+};
+
 template <class T> class OnceCallback;
 
 /**
@@ -86,10 +264,10 @@ public:
         return cb.mFunc(std::forward<Args>(args)...);
     }
 
-    bool IsNull() const { return mFunc == nullptr; }
+    bool IsNull() const { return mFunc.IsNull(); }
 
 private:
-    std::function<R(Args...)> mFunc;
+    MoveOnlyFunction<R(Args...)> mFunc;
 };
 
 } // namespace otbr
@@ -32,81 +32,111 @@
 
 #include "common/code_utils.hpp"
 
-static bool NameEndsWithDot(const std::string &aName)
+// Returns whether the name has "._udp" or "._tcp" at @p aPos, ending there or
+// followed by a label separator.
+static bool IsTransportLabelAt(const char *aName, size_t aNameLength, size_t aPos)
 {
-    return !aName.empty() && aName.back() == '.';
+    return aPos + 5 <= aNameLength && aName[aPos] == '.' && aName[aPos + 1] == '_' &&
+           (memcmp(&aName[aPos + 2], "udp", 3) == 0 || memcmp(&aName[aPos + 2], "tcp", 3) == 0) &&
+           (aPos + 5 == aNameLength || aName[aPos + 5] == '.');
 }
 
-DnsNameInfo SplitFullDnsName(const std::string &aName)
+DnsNameInfoView SplitFullDnsNameView(const char *aName, size_t aNameLength)
 {
-    size_t      transportPos;
-    DnsNameInfo nameInfo;
-    std::string fullName = aName;
+    DnsNameInfoView nameInfo;
+    size_t          transportPos = 0;
+    bool            hasTransport = false;
 
-    if (!NameEndsWithDot(fullName))
+    // Ignore a trailing dot so "a.b." and "a.b" split identically.
+    if (aNameLength > 0 && aName[aNameLength - 1] == '.')
     {
-        fullName += '.';
+        aNameLength--;
     }
 
-    transportPos = fullName.rfind("._udp.");
-
-    if (transportPos == std::string::npos)
+    for (size_t pos = aNameLength; pos > 0; pos--)
     {
-        transportPos = fullName.rfind("._tcp.");
+        if (IsTransportLabelAt(aName, aNameLength, pos - 1))
+        {
+            transportPos = pos - 1;
+            hasTransport = true;
+            break;
+        }
     }
 
-    if (transportPos == std::string::npos)
+    if (!hasTransport)
     {
         // host.domain or domain
-        size_t dotPos = fullName.find_first_of('.');
+        const char *dot    = static_cast<const char *>(memchr(aName, '.', aNameLength));
+        size_t      dotPos = (dot != nullptr) ? static_cast<size_t>(dot - aName) : aNameLength;
 
-        assert(dotPos != std::string::npos);
+        nameInfo.mHostName = {aName, dotPos};
 
-        // host.domain
-        nameInfo.mHostName = fullName.substr(0, dotPos);
-        nameInfo.mDomain   = fullName.substr(dotPos + 1, fullName.length() - dotPos - 1);
+        if (dot != nullptr)
+        {
+            nameInfo.mDomain = {aName + dotPos + 1, aNameLength - dotPos - 1};
+        }
     }
     else
     {
         // service or service instance
-        size_t dotPos = transportPos > 0 ? fullName.find_last_of('.', transportPos - 1) : std::string::npos;
+        size_t dotPos = transportPos;
+
+        while (dotPos > 0 && aName[dotPos - 1] != '.')
+        {
+            dotPos--;
+        }
 
-        nameInfo.mDomain = fullName.substr(transportPos + 6); // 6 is the length of "._tcp." or "._udp."
+        if (transportPos + 6 <= aNameLength)
+        {
+            nameInfo.mDomain = {aName + transportPos + 6, aNameLength - transportPos - 6};
+        }
 
-        if (dotPos == std::string::npos)
+        if (dotPos == 0)
         {
             // service.domain
-            nameInfo.mServiceName = fullName.substr(0, transportPos + 5);
+            nameInfo.mServiceName = {aName, transportPos + 5};
         }
         else
         {
             // instance.service.domain
-            nameInfo.mInstanceName = fullName.substr(0, dotPos);
-            nameInfo.mServiceName  = fullName.substr(dotPos + 1, transportPos + 4 - dotPos);
+            nameInfo.mInstanceName = {aName, dotPos - 1};
+            nameInfo.mServiceName  = {aName + dotPos, transportPos + 5 - dotPos};
         }
     }
 
-    if (!NameEndsWithDot(nameInfo.mDomain))
-    {
-        nameInfo.mDomain += '.';
-    }
+    return nameInfo;
+}
+
+DnsNameInfo DnsNameInfoView::ToNameInfo(void) const
+{
+    DnsNameInfo nameInfo;
+
+    nameInfo.mInstanceName = mInstanceName.ToString();
+    nameInfo.mServiceName  = mServiceName.ToString();
+    nameInfo.mHostName     = mHostName.ToString();
+    nameInfo.mDomain       = DomainString();
 
     return nameInfo;
 }
 
+DnsNameInfo SplitFullDnsName(const std::string &aName)
+{
+    return SplitFullDnsNameView(aName.data(), aName.length()).ToNameInfo();
+}
+
 otbrError SplitFullServiceInstanceName(const std::string &aFullName,
                                        std::string &      aInstanceName,
                                        std::string &      aType,
                                        std::string &      aDomain)
 {
-    otbrError   error    = OTBR_ERROR_NONE;
-    DnsNameInfo nameInfo = SplitFullDnsName(aFullName);
+    otbrError       error    = OTBR_ERROR_NONE;
+    DnsNameInfoView nameInfo = SplitFullDnsNameView(aFullName.data(), aFullName.length());
 
     VerifyOrExit(nameInfo.IsServiceInstance(), error = OTBR_ERROR_INVALID_ARGS);
 
-    aInstanceName = std::move(nameInfo.mInstanceName);
-    aType         = std::move(nameInfo.mServiceName);
-    aDomain       = std::move(nameInfo.mDomain);
+    aInstanceName = nameInfo.mInstanceName.ToString();
+    aType         = nameInfo.mServiceName.ToString();
+    aDomain       = nameInfo.DomainString();
 
 exit:
     return error;
@@ -114,13 +144,13 @@ exit:
 
 otbrError SplitFullServiceName(const std::string &aFullName, std::string &aType, std::string &aDomain)
 {
-    otbrError   error    = OTBR_ERROR_NONE;
-    DnsNameInfo nameInfo = SplitFullDnsName(aFullName);
+    otbrError       error    = OTBR_ERROR_NONE;
+    DnsNameInfoView nameInfo = SplitFullDnsNameView(aFullName.data(), aFullName.length());
 
     VerifyOrExit(nameInfo.IsService(), error = OTBR_ERROR_INVALID_ARGS);
 
-    aType   = std::move(nameInfo.mServiceName);
-    aDomain = std::move(nameInfo.mDomain);
+    aType   = nameInfo.mServiceName.ToString();
+    aDomain = nameInfo.DomainString();
 
 exit:
     return error;
@@ -128,13 +158,13 @@ exit:
 
 otbrError SplitFullHostName(const std::string &aFullName, std::string &aHostName, std::string &aDomain)
 {
-    otbrError   error    = OTBR_ERROR_NONE;
-    DnsNameInfo nameInfo = SplitFullDnsName(aFullName);
+    otbrError       error    = OTBR_ERROR_NONE;
+    DnsNameInfoView nameInfo = SplitFullDnsNameView(aFullName.data(), aFullName.length());
 
     VerifyOrExit(nameInfo.IsHost(), error = OTBR_ERROR_INVALID_ARGS);
 
-    aHostName = std::move(nameInfo.mHostName);
-    aDomain   = std::move(nameInfo.mDomain);
+    aHostName = nameInfo.mHostName.ToString();
+    aDomain   = nameInfo.DomainString();
 
 exit:
     return error;
@@ -74,6 +74,72 @@ struct DnsNameInfo
     bool IsHost(void) const { return mServiceName.empty(); }
 };
 
+/**
+ * This structure represents DNS name information as non-owning views into the full name.
+ *
+ * Splitting into views performs no allocation; each component references the
+ * bytes of the original name, which must outlive the views. Owned strings are
+ * materialized only where a component is actually stored.
+ *
+ * @sa SplitFullDnsNameView
+ *
+ */
+struct DnsNameInfoView
+{
+    /**
+     * This structure represents a non-owning view of a name component.
+     *
+     */
+    struct View
+    {
+        View(void) = default;
+
+        View(const char *aData, size_t aLength)
+            : mData(aData)
+            , mLength(aLength)
+        {
+        }
+
+        const char *mData   = nullptr; ///< The start of the component, not null-terminated.
+        size_t      mLength = 0;       ///< The length of the component, in bytes.
+
+        bool IsEmpty(void) const { return mLength == 0; }
+
+        /**
+         * This method materializes the view into an owned string.
+         *
+         * @returns The component as a `std::string`.
+         *
+         */
+        std::string ToString(void) const { return std::string(mData, mLength); }
+    };
+
+    View mInstanceName; ///< Instance name, or empty if the DNS name is not a service instance.
+    View mServiceName;  ///< Service name, or empty if the DNS name is not a service or service instance.
+    View mHostName;     ///< Host name, or empty if the DNS name is not a host name.
+    View mDomain;       ///< Domain name, without the trailing dot.
+
+    bool IsServiceInstance(void) const { return !mInstanceName.IsEmpty(); }
+    bool IsService(void) const { return !mServiceName.IsEmpty() && mInstanceName.IsEmpty(); }
+    bool IsHost(void) const { return mServiceName.IsEmpty(); }
+
+    /**
+     * This method materializes the domain with its trailing dot.
+     *
+     * @returns The domain as a `std::string` ending with '.'.
+     *
+     */
+    std::string DomainString(void) const { return mDomain.ToString() + '.'; }
+
+    /**
+     * This method materializes all components into an owned `DnsNameInfo`.
+     *
+     * @returns A `DnsNameInfo` structure containing DNS name information.
+     *
+     */
+    DnsNameInfo ToNameInfo(void) const;
+};
+
 /**
  * This method splits a full DNS name into name components.
  *
@@ -86,6 +152,22 @@ struct DnsNameInfo
  */
 DnsNameInfo SplitFullDnsName(const std::string &aName);
 
+/**
+ * This function splits a full DNS name into non-owning name component views.
+ *
+ * The name is split in a single pass without copying; @p aName must outlive
+ * the returned views. A trailing dot in the name is accepted and ignored.
+ *
+ * @param[in] aName        A pointer to the full DNS name, not necessarily null-terminated.
+ * @param[in] aNameLength  The length of the full DNS name, in bytes.
+ *
+ * @returns A `DnsNameInfoView` structure viewing the DNS name components.
+ *
+ * @sa DnsNameInfoView
+ *
+ */
+DnsNameInfoView SplitFullDnsNameView(const char *aName, size_t aNameLength);
+
 /**
  * This function splits a full service name into components.
  *
@@ -0,0 +1,290 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define OTBR_LOG_TAG "EPOLL"
+
+#include "common/epoll_mainloop.hpp"
+
+#if OTBR_ENABLE_EPOLL_MAINLOOP
+
+#include <errno.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "common/logging.hpp"
+
+namespace otbr {
+
+EpollMainloop::EpollMainloop(bool aEdgeTriggered)
+    : mEpollFd(-1)
+    , mEdgeTriggered(aEdgeTriggered)
+{
+}
+
+EpollMainloop::~EpollMainloop(void)
+{
+    if (mEpollFd != -1)
+    {
+        close(mEpollFd);
+        mEpollFd = -1;
+    }
+}
+
+otbrError EpollMainloop::Init(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    mEpollFd = epoll_create1(EPOLL_CLOEXEC);
+    VerifyOrExit(mEpollFd != -1, error = OTBR_ERROR_ERRNO);
+
+exit:
+    return error;
+}
+
+bool EpollMainloop::ControlFd(int aOp, int aFd, uint32_t aEvents)
+{
+    struct epoll_event event;
+
+    memset(&event, 0, sizeof(event));
+    event.events  = aEvents;
+    event.data.fd = aFd;
+
+    return epoll_ctl(mEpollFd, aOp, aFd, &event) == 0;
+}
+
+bool EpollMainloop::AddFd(int aFd, uint32_t aEvents)
+{
+    bool success = ControlFd(EPOLL_CTL_ADD, aFd, aEvents);
+
+    if (!success && errno == EEXIST)
+    {
+        // Another open description of this fd is still registered (e.g. the
+        // fd was dup()ed and re-added); update its interest set instead.
+        success = ControlFd(EPOLL_CTL_MOD, aFd, aEvents);
+    }
+
+    if (!success)
+    {
+        otbrLogWarning("Failed to add fd %d to epoll: %s", aFd, strerror(errno));
+    }
+
+    return success;
+}
+
+bool EpollMainloop::ModifyFd(int aFd, uint32_t aEvents)
+{
+    bool success = ControlFd(EPOLL_CTL_MOD, aFd, aEvents);
+
+    if (!success && errno == ENOENT)
+    {
+        // The kernel registration is gone: the fd was closed behind the
+        // cache and the number reused. Register the new descriptor.
+        success = ControlFd(EPOLL_CTL_ADD, aFd, aEvents);
+    }
+
+    if (!success)
+    {
+        otbrLogWarning("Failed to modify fd %d in epoll: %s", aFd, strerror(errno));
+    }
+
+    return success;
+}
+
+bool EpollMainloop::GetFdIdentity(int aFd, dev_t &aDevice, ino_t &aInode)
+{
+    struct stat st;
+    bool        success = fstat(aFd, &st) == 0;
+
+    if (success)
+    {
+        aDevice = st.st_dev;
+        aInode  = st.st_ino;
+    }
+
+    return success;
+}
+
+void EpollMainloop::UpdateRegistrations(const MainloopContext &aMainloop)
+{
+    // Reconcile the fds requested through the `select()`-style fd sets with
+    // the fds already registered with the kernel. In steady state the
+    // interest sets do not change and this issues one fstat() per registered
+    // fd and no epoll_ctl() calls. The fstat() identity check is required for
+    // correctness: closing a watched fd drops its kernel registration, and a
+    // new descriptor reusing the number would otherwise be trusted as still
+    // registered whenever its interest set matches the cached one.
+    for (int fd = 0; fd <= aMainloop.mMaxFd; fd++)
+    {
+        uint32_t events = 0;
+
+        if (FD_ISSET(fd, &aMainloop.mReadFdSet))
+        {
+            events |= EPOLLIN;
+        }
+        if (FD_ISSET(fd, &aMainloop.mWriteFdSet))
+        {
+            events |= EPOLLOUT;
+        }
+        if (FD_ISSET(fd, &aMainloop.mErrorFdSet))
+        {
+            events |= EPOLLPRI;
+        }
+
+        if (events == 0)
+        {
+            continue;
+        }
+
+        if (mEdgeTriggered)
+        {
+            events |= EPOLLET;
+        }
+
+        auto  it     = mRegisteredFds.find(fd);
+        dev_t device = 0;
+        ino_t inode  = 0;
+
+        if (!GetFdIdentity(fd, device, inode))
+        {
+            // The fd is not open; a processor declared interest in a dead fd.
+            otbrLogWarning("Failed to stat fd %d requested for epoll: %s", fd, strerror(errno));
+
+            if (it != mRegisteredFds.end())
+            {
+                mRegisteredFds.erase(it);
+            }
+            continue;
+        }
+
+        if (it == mRegisteredFds.end())
+        {
+            if (AddFd(fd, events))
+            {
+                mRegisteredFds[fd] = Registration{events, device, inode};
+            }
+        }
+        else if (it->second.mDevice != device || it->second.mInode != inode)
+        {
+            // Same fd number, different descriptor: the watched fd was closed
+            // (which dropped its kernel registration) and the number reused.
+            // The new descriptor must be registered even when the interest
+            // set matches the cached one.
+            if (AddFd(fd, events))
+            {
+                it->second = Registration{events, device, inode};
+            }
+            else
+            {
+                mRegisteredFds.erase(it);
+            }
+        }
+        else if (it->second.mEvents != events)
+        {
+            if (ModifyFd(fd, events))
+            {
+                it->second.mEvents = events;
+            }
+            else
+            {
+                // Drop the cache entry so the next cycle retries from ADD
+                // instead of trusting stale state.
+                mRegisteredFds.erase(it);
+            }
+        }
+    }
+
+    for (auto it = mRegisteredFds.begin(); it != mRegisteredFds.end();)
+    {
+        int fd = it->first;
+
+        if (fd > aMainloop.mMaxFd ||
+            (!FD_ISSET(fd, &aMainloop.mReadFdSet) && !FD_ISSET(fd, &aMainloop.mWriteFdSet) &&
+             !FD_ISSET(fd, &aMainloop.mErrorFdSet)))
+        {
+            // The fd may already be closed, in which case the kernel has
+            // dropped the registration on its own.
+            ControlFd(EPOLL_CTL_DEL, fd, 0);
+            it = mRegisteredFds.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+int EpollMainloop::Poll(MainloopContext &aMainloop)
+{
+    struct epoll_event events[kMaxEpollEvents];
+    int                timeout;
+    int                rval;
+
+    UpdateRegistrations(aMainloop);
+
+    timeout = static_cast<int>(aMainloop.mTimeout.tv_sec * 1000 + aMainloop.mTimeout.tv_usec / 1000);
+
+    rval = epoll_wait(mEpollFd, events, kMaxEpollEvents, timeout);
+    VerifyOrExit(rval >= 0);
+
+    FD_ZERO(&aMainloop.mReadFdSet);
+    FD_ZERO(&aMainloop.mWriteFdSet);
+    FD_ZERO(&aMainloop.mErrorFdSet);
+    aMainloop.mMaxFd = -1;
+
+    for (int i = 0; i < rval; i++)
+    {
+        int fd = events[i].data.fd;
+
+        if (events[i].events & (EPOLLIN | EPOLLERR | EPOLLHUP | EPOLLRDHUP))
+        {
+            FD_SET(fd, &aMainloop.mReadFdSet);
+        }
+        if (events[i].events & (EPOLLOUT | EPOLLERR))
+        {
+            FD_SET(fd, &aMainloop.mWriteFdSet);
+        }
+        if (events[i].events & (EPOLLPRI | EPOLLERR | EPOLLHUP))
+        {
+            FD_SET(fd, &aMainloop.mErrorFdSet);
+        }
+
+        if (fd > aMainloop.mMaxFd)
+        {
+            aMainloop.mMaxFd = fd;
+        }
+    }
+
+exit:
+    return rval;
+}
+
+} // namespace otbr
+
+#endif // OTBR_ENABLE_EPOLL_MAINLOOP
@@ -0,0 +1,130 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the epoll-backed mainloop poller.
+ */
+
+#ifndef OTBR_COMMON_EPOLL_MAINLOOP_HPP_
+#define OTBR_COMMON_EPOLL_MAINLOOP_HPP_
+
+#include <openthread-br/config.h>
+
+#if OTBR_ENABLE_EPOLL_MAINLOOP
+
+#include <map>
+
+#include <stdint.h>
+#include <sys/types.h>
+
+#include "common/code_utils.hpp"
+#include "common/mainloop.hpp"
+#include "common/types.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements an epoll(7)-backed poller for the mainloop.
+ *
+ * Mainloop processors keep registering their fds through the `MainloopContext`
+ * fd sets as before. This class diffs the requested fd sets against the fds
+ * already registered with the kernel and only issues `epoll_ctl()` calls for
+ * fds whose interest set actually changed, so steady-state iterations cost a
+ * single `epoll_wait()` plus one `fstat()` per registered fd instead of an
+ * O(maxfd) kernel scan per cycle. The `fstat()` guards against fd-number
+ * reuse: closing a watched fd silently drops its kernel registration, and a
+ * new descriptor reusing the number must be registered anew even when its
+ * interest set matches the cached one.
+ *
+ */
+class EpollMainloop : private NonCopyable
+{
+public:
+    /**
+     * This constructor initializes the epoll mainloop poller.
+     *
+     * @param[in] aEdgeTriggered  Whether to register fds edge-triggered (EPOLLET). Edge-triggered
+     *                            mode requires all processors to drain their fds on each wakeup
+     *                            and is therefore disabled by default.
+     *
+     */
+    explicit EpollMainloop(bool aEdgeTriggered = false);
+
+    ~EpollMainloop(void);
+
+    /**
+     * This method initializes the underlying epoll instance.
+     *
+     * @retval OTBR_ERROR_NONE   Successfully created the epoll instance.
+     * @retval OTBR_ERROR_ERRNO  Failed to create the epoll instance.
+     *
+     */
+    otbrError Init(void);
+
+    /**
+     * This method polls the fds registered in @p aMainloop.
+     *
+     * The fd sets in @p aMainloop are consumed as the requested interest sets and are rewritten
+     * on return to contain only the fds that are ready, mirroring the `select()` contract so
+     * that `MainloopManager::Process()` can consume the context unchanged.
+     *
+     * @param[in,out] aMainloop  A reference to the mainloop context to poll.
+     *
+     * @returns The number of ready fds on success, or -1 on failure with `errno` set.
+     *
+     */
+    int Poll(MainloopContext &aMainloop);
+
+private:
+    static constexpr int kMaxEpollEvents = 64;
+
+    struct Registration
+    {
+        uint32_t mEvents; ///< The registered epoll interest set.
+        dev_t    mDevice; ///< Device of the fd when registered, to detect fd-number reuse.
+        ino_t    mInode;  ///< Inode of the fd when registered, to detect fd-number reuse.
+    };
+
+    void UpdateRegistrations(const MainloopContext &aMainloop);
+    bool ControlFd(int aOp, int aFd, uint32_t aEvents);
+    bool AddFd(int aFd, uint32_t aEvents);
+    bool ModifyFd(int aFd, uint32_t aEvents);
+
+    static bool GetFdIdentity(int aFd, dev_t &aDevice, ino_t &aInode);
+
+    int                         mEpollFd;
+    bool                        mEdgeTriggered;
+    std::map<int, Registration> mRegisteredFds;
+};
+
+} // namespace otbr
+
+#endif // OTBR_ENABLE_EPOLL_MAINLOOP
+
+#endif // OTBR_COMMON_EPOLL_MAINLOOP_HPP_
@@ -0,0 +1,156 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definition of a cached fd/event list for mainloop updates.
+ */
+
+#ifndef OTBR_COMMON_FD_EVENT_LIST_HPP_
+#define OTBR_COMMON_FD_EVENT_LIST_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+
+#include "common/code_utils.hpp"
+#include "common/mainloop.hpp"
+
+namespace otbr {
+
+/**
+ * This class caches a list of fds and their interest events as prepared
+ * `fd_set`s.
+ *
+ * A mainloop processor whose fd membership changes rarely rebuilds the list
+ * only when membership or interest changes, and its per-cycle `Update()`
+ * collapses to `Apply()` — a bulk merge of the prepared sets into the mainloop
+ * context instead of per-fd `FD_SET` calls and max-fd math on every cycle.
+ *
+ */
+class FdEventList : private NonCopyable
+{
+public:
+    static constexpr uint8_t kEventRead  = 1 << 0; ///< The fd is polled for reading.
+    static constexpr uint8_t kEventWrite = 1 << 1; ///< The fd is polled for writing.
+    static constexpr uint8_t kEventError = 1 << 2; ///< The fd is polled for errors.
+
+    /**
+     * This constructor initializes an empty list.
+     *
+     */
+    FdEventList(void) { Clear(); }
+
+    /**
+     * This method removes all fds from the list.
+     *
+     */
+    void Clear(void)
+    {
+        mMaxFd = -1;
+        FD_ZERO(&mReadFdSet);
+        FD_ZERO(&mWriteFdSet);
+        FD_ZERO(&mErrorFdSet);
+    }
+
+    /**
+     * This method adds an fd and its interest events to the list.
+     *
+     * @param[in] aFd      The fd to poll.
+     * @param[in] aEvents  The events of interest, a bitwise OR of `kEvent*`.
+     *
+     */
+    void Add(int aFd, uint8_t aEvents)
+    {
+        VerifyOrDie(aFd >= 0 && aFd < FD_SETSIZE, "fd out of select() range");
+
+        if (aEvents & kEventRead)
+        {
+            FD_SET(aFd, &mReadFdSet);
+        }
+
+        if (aEvents & kEventWrite)
+        {
+            FD_SET(aFd, &mWriteFdSet);
+        }
+
+        if (aEvents & kEventError)
+        {
+            FD_SET(aFd, &mErrorFdSet);
+        }
+
+        mMaxFd = std::max(mMaxFd, aFd);
+    }
+
+    /**
+     * This method merges the prepared fd sets into a mainloop context.
+     *
+     * @param[in,out] aMainloop  A reference to the mainloop context to update.
+     *
+     */
+    void Apply(MainloopContext &aMainloop) const
+    {
+        VerifyOrExit(mMaxFd >= 0);
+
+        // An `fd_set` is a plain bitmap on every platform this daemon
+        // targets, so merging the prepared sets is a bytewise OR over the
+        // words that can hold fds up to `mMaxFd`.
+        OrFdSet(mReadFdSet, aMainloop.mReadFdSet);
+        OrFdSet(mWriteFdSet, aMainloop.mWriteFdSet);
+        OrFdSet(mErrorFdSet, aMainloop.mErrorFdSet);
+
+        aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, mMaxFd);
+
+    exit:
+        return;
+    }
+
+private:
+    void OrFdSet(const fd_set &aSource, fd_set &aTarget) const
+    {
+        const uint8_t *src   = reinterpret_cast<const uint8_t *>(&aSource);
+        uint8_t *      dst   = reinterpret_cast<uint8_t *>(&aTarget);
+        size_t         bytes = static_cast<size_t>(mMaxFd) / 8 + 1;
+
+        for (size_t i = 0; i < bytes; i++)
+        {
+            dst[i] |= src[i];
+        }
+    }
+
+    int    mMaxFd;
+    fd_set mReadFdSet;
+    fd_set mWriteFdSet;
+    fd_set mErrorFdSet;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_FD_EVENT_LIST_HPP_
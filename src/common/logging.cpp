@@ -44,20 +44,521 @@
 #include <sys/time.h>
 #include <syslog.h>
 
+#include <semaphore.h>
+
+#include <atomic>
+#include <mutex>
 #include <sstream>
+#include <thread>
 
 #include "common/code_utils.hpp"
 #include "common/time.hpp"
+#include "utils/hex.hpp"
+
+static std::atomic<otbrLogLevel> sLevel(OTBR_LOG_INFO);
 
-static otbrLogLevel sLevel            = OTBR_LOG_INFO;
-static const char   sLevelString[][8] = {
+static const char sLevelString[][8] = {
     "[EMERG]", "[ALERT]", "[CRIT]", "[ERR ]", "[WARN]", "[NOTE]", "[INFO]", "[DEBG]",
 };
 
+/**
+ * Per-tag log level overrides. Entries are published by bumping the count
+ * after the entry is filled, so `otbrLogShouldLog()` can scan them without
+ * taking a lock on the hot path.
+ */
+struct TagLevelOverride
+{
+    char                      mTag[16];
+    std::atomic<otbrLogLevel> mLevel;
+};
+
+static constexpr size_t    kMaxTagOverrides = 8;
+static TagLevelOverride    sTagOverrides[kMaxTagOverrides];
+static std::atomic<size_t> sNumTagOverrides(0);
+static std::mutex          sTagOverrideMutex;
+
+/**
+ * The asynchronous log sink: a fixed-size lock-free ring buffer (Vyukov bounded
+ * queue with per-slot sequence numbers) written by any thread and drained into
+ * syslog by a background thread. Messages are dropped and counted when the ring
+ * is full so that the hot path never blocks on the syslog socket.
+ */
+struct AsyncLogEntry
+{
+    std::atomic<uint32_t> mSequence;
+    int                   mPriority;
+    char                  mText[512];
+};
+
+static constexpr uint32_t kAsyncLogCapacity = 1024; // Must be a power of two.
+
+static AsyncLogEntry         sAsyncLogRing[kAsyncLogCapacity];
+static std::atomic<uint32_t> sAsyncLogHead(0);
+static uint32_t              sAsyncLogTail = 0; // Only accessed by the drain thread.
+static std::atomic<uint32_t> sAsyncLogDropped(0);
+static uint32_t              sAsyncLogReportedDropped = 0;
+static sem_t                 sAsyncLogSem;
+static std::thread           sAsyncLogThread;
+static std::atomic<bool>     sAsyncLogRunning(false);
+static bool                  sAsyncLogEnabled = false;
+
+static bool AsyncLogEnqueue(int aPriority, const char *aText)
+{
+    bool     enqueued = false;
+    uint32_t pos      = sAsyncLogHead.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        AsyncLogEntry &entry = sAsyncLogRing[pos & (kAsyncLogCapacity - 1)];
+        uint32_t       seq   = entry.mSequence.load(std::memory_order_acquire);
+        int32_t        diff  = static_cast<int32_t>(seq - pos);
+
+        if (diff == 0)
+        {
+            if (sAsyncLogHead.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                entry.mPriority = aPriority;
+                strncpy(entry.mText, aText, sizeof(entry.mText) - 1);
+                entry.mText[sizeof(entry.mText) - 1] = '\0';
+                entry.mSequence.store(pos + 1, std::memory_order_release);
+                sem_post(&sAsyncLogSem);
+                enqueued = true;
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            // The ring is full; drop the message rather than blocking.
+            sAsyncLogDropped.fetch_add(1, std::memory_order_relaxed);
+            break;
+        }
+        else
+        {
+            pos = sAsyncLogHead.load(std::memory_order_relaxed);
+        }
+    }
+
+    return enqueued;
+}
+
+static bool AsyncLogDequeue(int &aPriority, char *aText, size_t aTextSize)
+{
+    bool           dequeued = false;
+    AsyncLogEntry &entry    = sAsyncLogRing[sAsyncLogTail & (kAsyncLogCapacity - 1)];
+    uint32_t       seq      = entry.mSequence.load(std::memory_order_acquire);
+
+    if (static_cast<int32_t>(seq - (sAsyncLogTail + 1)) == 0)
+    {
+        aPriority = entry.mPriority;
+        strncpy(aText, entry.mText, aTextSize - 1);
+        aText[aTextSize - 1] = '\0';
+        entry.mSequence.store(sAsyncLogTail + kAsyncLogCapacity, std::memory_order_release);
+        sAsyncLogTail++;
+        dequeued = true;
+    }
+
+    return dequeued;
+}
+
+static void AsyncLogDrainLoop(void)
+{
+    while (sAsyncLogRunning.load(std::memory_order_acquire) || sAsyncLogHead.load(std::memory_order_acquire) != sAsyncLogTail)
+    {
+        int      priority;
+        char     text[sizeof(sAsyncLogRing[0].mText)];
+        uint32_t dropped;
+
+        if (sem_wait(&sAsyncLogSem) == -1 && errno == EINTR)
+        {
+            continue;
+        }
+
+        while (AsyncLogDequeue(priority, text, sizeof(text)))
+        {
+            syslog(priority, "%s", text);
+        }
+
+        dropped = sAsyncLogDropped.load(std::memory_order_relaxed);
+        if (dropped != sAsyncLogReportedDropped)
+        {
+            syslog(LOG_WARNING, "[WARN]-LOG-----: dropped %u log messages (ring buffer full)",
+                   dropped - sAsyncLogReportedDropped);
+            sAsyncLogReportedDropped = dropped;
+        }
+    }
+}
+
+static void AsyncLogStart(void)
+{
+    for (uint32_t i = 0; i < kAsyncLogCapacity; i++)
+    {
+        sAsyncLogRing[i].mSequence.store(i, std::memory_order_relaxed);
+    }
+
+    sem_init(&sAsyncLogSem, 0, 0);
+    sAsyncLogRunning.store(true, std::memory_order_release);
+    sAsyncLogThread  = std::thread(AsyncLogDrainLoop);
+    sAsyncLogEnabled = true;
+}
+
+static void AsyncLogStop(void)
+{
+    if (sAsyncLogEnabled)
+    {
+        sAsyncLogRunning.store(false, std::memory_order_release);
+        sem_post(&sAsyncLogSem);
+        sAsyncLogThread.join();
+        sem_destroy(&sAsyncLogSem);
+        sAsyncLogEnabled = false;
+    }
+}
+
+/**
+ * The structured binary sink: a second ring (same bounded-queue scheme as the
+ * asynchronous sink) that records the format string pointer, the log tag
+ * pointer and the raw argument values, deferring all printf formatting to
+ * extraction time. Storing the pointers is safe because the log macros only
+ * pass string literals; string arguments are copied into a small per-record
+ * pool since they may point at transient buffers. Capture walks the format
+ * string once to pull the arguments off the va_list, and bails out (to the
+ * regular eager path) on conversions it cannot replay later.
+ */
+enum BinaryLogArgKind : uint8_t
+{
+    kArgSigned,   // d, i with any length modifier; stored sign-extended.
+    kArgUnsigned, // u, o, x, X with any length modifier; stored zero-extended.
+    kArgDouble,   // f, F, e, E, g, G; stored as the bit pattern.
+    kArgChar,     // c; stored as the promoted int.
+    kArgString,   // s; stored as an offset into the record string pool.
+    kArgPointer,  // p.
+};
+
+static constexpr size_t kBinaryLogMaxArgs    = 8;   // Records with more arguments format eagerly.
+static constexpr size_t kBinaryLogStringPool = 104; // Room for copied string arguments per record.
+
+struct BinaryLogPayload
+{
+    otbrLogLevel mLevel;
+    const char * mTag;
+    const char * mFormat;
+    uint8_t      mNumArgs;
+    uint8_t      mKinds[kBinaryLogMaxArgs];
+    uint64_t     mArgs[kBinaryLogMaxArgs];
+    char         mStrings[kBinaryLogStringPool];
+};
+
+struct BinaryLogRecord
+{
+    std::atomic<uint32_t> mSequence;
+    BinaryLogPayload      mPayload;
+};
+
+static constexpr uint32_t kBinaryLogCapacity = 1024; // Must be a power of two.
+
+static BinaryLogRecord       sBinaryLogRing[kBinaryLogCapacity];
+static std::atomic<uint32_t> sBinaryLogHead(0);
+static uint32_t              sBinaryLogTail = 0; // Only accessed under the flush mutex.
+static std::atomic<uint32_t> sBinaryLogDropped(0);
+static uint32_t              sBinaryLogReportedDropped = 0;
+static std::atomic<bool>     sBinaryLogEnabled(false);
+static bool                  sBinaryLogInitialized = false;
+static std::mutex            sBinaryLogFlushMutex;
+
+static bool BinaryLogParseArgs(const char *aFormat, va_list aArgs, BinaryLogPayload &aPayload)
+{
+    bool        success     = true;
+    const char *p           = aFormat;
+    size_t      numArgs     = 0;
+    size_t      stringsUsed = 0;
+
+    while (*p != '\0')
+    {
+        char     conversion;
+        int      longs = 0;
+        uint64_t value = 0;
+        uint8_t  kind;
+
+        if (*p++ != '%')
+        {
+            continue;
+        }
+
+        if (*p == '%')
+        {
+            p++;
+            continue;
+        }
+
+        // Flags, width and precision are replayed verbatim at extraction;
+        // only '*' would pull an extra argument off the list.
+        while (*p == '-' || *p == '+' || *p == ' ' || *p == '#' || *p == '.' || (*p >= '0' && *p <= '9'))
+        {
+            p++;
+        }
+        VerifyOrExit(*p != '*', success = false);
+
+        for (; *p == 'l' || *p == 'h' || *p == 'z' || *p == 'j' || *p == 't'; p++)
+        {
+            if (*p == 'l')
+            {
+                longs++;
+            }
+            else if (*p == 'z' || *p == 'j' || *p == 't')
+            {
+                longs = 1; // size_t/intmax_t/ptrdiff_t are long-sized on the supported platforms.
+            }
+            // 'h'/'hh' arguments arrive promoted to int; the default handles them.
+        }
+
+        conversion = *p++;
+
+        VerifyOrExit(numArgs < kBinaryLogMaxArgs, success = false);
+
+        switch (conversion)
+        {
+        case 'd':
+        case 'i':
+        {
+            int64_t signedValue;
+
+            if (longs >= 2)
+            {
+                signedValue = va_arg(aArgs, long long);
+            }
+            else if (longs == 1)
+            {
+                signedValue = va_arg(aArgs, long);
+            }
+            else
+            {
+                signedValue = va_arg(aArgs, int);
+            }
+            value = static_cast<uint64_t>(signedValue);
+            kind  = kArgSigned;
+            break;
+        }
+        case 'u':
+        case 'o':
+        case 'x':
+        case 'X':
+            if (longs >= 2)
+            {
+                value = va_arg(aArgs, unsigned long long);
+            }
+            else if (longs == 1)
+            {
+                value = va_arg(aArgs, unsigned long);
+            }
+            else
+            {
+                value = va_arg(aArgs, unsigned int);
+            }
+            kind = kArgUnsigned;
+            break;
+        case 'f':
+        case 'F':
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G':
+        {
+            double doubleValue = va_arg(aArgs, double);
+
+            memcpy(&value, &doubleValue, sizeof(value));
+            kind = kArgDouble;
+            break;
+        }
+        case 'c':
+            value = static_cast<uint64_t>(va_arg(aArgs, int));
+            kind  = kArgChar;
+            break;
+        case 's':
+        {
+            const char *stringValue = va_arg(aArgs, const char *);
+            size_t      length;
+
+            if (stringValue == nullptr)
+            {
+                stringValue = "(null)";
+            }
+
+            length = strlen(stringValue);
+            VerifyOrExit(stringsUsed + length + 1 <= sizeof(aPayload.mStrings), success = false);
+
+            memcpy(aPayload.mStrings + stringsUsed, stringValue, length + 1);
+            value = stringsUsed;
+            stringsUsed += length + 1;
+            kind = kArgString;
+            break;
+        }
+        case 'p':
+            value = reinterpret_cast<uint64_t>(va_arg(aArgs, void *));
+            kind  = kArgPointer;
+            break;
+        default:
+            ExitNow(success = false);
+        }
+
+        aPayload.mKinds[numArgs] = kind;
+        aPayload.mArgs[numArgs]  = value;
+        numArgs++;
+    }
+
+    aPayload.mNumArgs = static_cast<uint8_t>(numArgs);
+
+exit:
+    return success;
+}
+
+static void BinaryLogFormatRecord(const BinaryLogPayload &aPayload, char *aBuffer, size_t aBufferSize)
+{
+    const char *p        = aPayload.mFormat;
+    size_t      out      = 0;
+    size_t      argIndex = 0;
+
+    while (*p != '\0' && out + 1 < aBufferSize)
+    {
+        char   spec[32];
+        size_t specLen = 0;
+        char   conversion;
+        int    written = 0;
+
+        if (*p != '%')
+        {
+            aBuffer[out++] = *p++;
+            continue;
+        }
+
+        if (p[1] == '%')
+        {
+            aBuffer[out++] = '%';
+            p += 2;
+            continue;
+        }
+
+        if (argIndex >= aPayload.mNumArgs)
+        {
+            break;
+        }
+
+        // Rebuild the conversion spec with a 64-bit length modifier, so the
+        // widened stored value formats exactly as the original would have;
+        // capture already masked or extended it to the original width.
+        spec[specLen++] = *p++;
+        while ((*p == '-' || *p == '+' || *p == ' ' || *p == '#' || *p == '.' || (*p >= '0' && *p <= '9')) &&
+               specLen < sizeof(spec) - 4)
+        {
+            spec[specLen++] = *p++;
+        }
+        while (*p == 'l' || *p == 'h' || *p == 'z' || *p == 'j' || *p == 't')
+        {
+            p++;
+        }
+        conversion = *p++;
+
+        if (aPayload.mKinds[argIndex] == kArgSigned || aPayload.mKinds[argIndex] == kArgUnsigned)
+        {
+            spec[specLen++] = 'l';
+            spec[specLen++] = 'l';
+        }
+        spec[specLen++] = conversion;
+        spec[specLen]   = '\0';
+
+        switch (aPayload.mKinds[argIndex])
+        {
+        case kArgSigned:
+            written = snprintf(aBuffer + out, aBufferSize - out, spec,
+                               static_cast<long long>(aPayload.mArgs[argIndex]));
+            break;
+        case kArgUnsigned:
+            written = snprintf(aBuffer + out, aBufferSize - out, spec,
+                               static_cast<unsigned long long>(aPayload.mArgs[argIndex]));
+            break;
+        case kArgDouble:
+        {
+            double doubleValue;
+
+            memcpy(&doubleValue, &aPayload.mArgs[argIndex], sizeof(doubleValue));
+            written = snprintf(aBuffer + out, aBufferSize - out, spec, doubleValue);
+            break;
+        }
+        case kArgChar:
+            written = snprintf(aBuffer + out, aBufferSize - out, spec, static_cast<int>(aPayload.mArgs[argIndex]));
+            break;
+        case kArgString:
+            written = snprintf(aBuffer + out, aBufferSize - out, spec,
+                               aPayload.mStrings + aPayload.mArgs[argIndex]);
+            break;
+        case kArgPointer:
+            written = snprintf(aBuffer + out, aBufferSize - out, spec,
+                               reinterpret_cast<void *>(aPayload.mArgs[argIndex]));
+            break;
+        }
+
+        if (written > 0)
+        {
+            out = out + written < aBufferSize - 1 ? out + written : aBufferSize - 1;
+        }
+        argIndex++;
+    }
+
+    aBuffer[out] = '\0';
+}
+
+static bool BinaryLogCapture(otbrLogLevel aLevel, const char *aTag, const char *aFormat, va_list aArgs)
+{
+    bool             captured = false;
+    BinaryLogPayload payload;
+    uint32_t         pos;
+
+    payload.mLevel  = aLevel;
+    payload.mTag    = aTag;
+    payload.mFormat = aFormat;
+
+    // Parse into the local payload first; a claimed ring slot could not be
+    // released again if an unsupported conversion shows up halfway through.
+    VerifyOrExit(BinaryLogParseArgs(aFormat, aArgs, payload));
+
+    pos = sBinaryLogHead.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        BinaryLogRecord &record = sBinaryLogRing[pos & (kBinaryLogCapacity - 1)];
+        uint32_t         seq    = record.mSequence.load(std::memory_order_acquire);
+        int32_t          diff   = static_cast<int32_t>(seq - pos);
+
+        if (diff == 0)
+        {
+            if (sBinaryLogHead.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                record.mPayload = payload;
+                record.mSequence.store(pos + 1, std::memory_order_release);
+                captured = true;
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            // The ring is full: the record is dropped and counted, not
+            // bounced to the eager path where it would jump the queue.
+            sBinaryLogDropped.fetch_add(1, std::memory_order_relaxed);
+            captured = true;
+            break;
+        }
+        else
+        {
+            pos = sBinaryLogHead.load(std::memory_order_relaxed);
+        }
+    }
+
+exit:
+    return captured;
+}
+
 /** Get the current debug log level */
 otbrLogLevel otbrLogGetLevel(void)
 {
-    return sLevel;
+    return sLevel.load(std::memory_order_relaxed);
 }
 
 /**
@@ -66,17 +567,69 @@ otbrLogLevel otbrLogGetLevel(void)
 void otbrLogSetLevel(otbrLogLevel aLevel)
 {
     assert(aLevel >= OTBR_LOG_EMERG && aLevel <= OTBR_LOG_DEBUG);
-    sLevel = aLevel;
+    sLevel.store(aLevel, std::memory_order_relaxed);
+}
+
+void otbrLogSetTagLevel(const char *aLogTag, otbrLogLevel aLevel)
+{
+    std::lock_guard<std::mutex> _(sTagOverrideMutex);
+    size_t                      count = sNumTagOverrides.load(std::memory_order_relaxed);
+    size_t                      i;
+
+    assert(aLevel >= OTBR_LOG_EMERG && aLevel <= OTBR_LOG_DEBUG);
+
+    for (i = 0; i < count; i++)
+    {
+        if (strcmp(sTagOverrides[i].mTag, aLogTag) == 0)
+        {
+            sTagOverrides[i].mLevel.store(aLevel, std::memory_order_relaxed);
+            ExitNow();
+        }
+    }
+
+    VerifyOrExit(count < kMaxTagOverrides,
+                 otbrLog(OTBR_LOG_WARNING, OTBR_LOG_TAG, "Too many log tag level overrides, ignoring tag %s",
+                         aLogTag));
+
+    strncpy(sTagOverrides[count].mTag, aLogTag, sizeof(sTagOverrides[count].mTag) - 1);
+    sTagOverrides[count].mTag[sizeof(sTagOverrides[count].mTag) - 1] = '\0';
+    sTagOverrides[count].mLevel.store(aLevel, std::memory_order_relaxed);
+    sNumTagOverrides.store(count + 1, std::memory_order_release);
+
+exit:
+    return;
+}
+
+bool otbrLogShouldLog(otbrLogLevel aLevel, const char *aLogTag)
+{
+    otbrLogLevel level = sLevel.load(std::memory_order_relaxed);
+    size_t       count = sNumTagOverrides.load(std::memory_order_acquire);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        if (strcmp(sTagOverrides[i].mTag, aLogTag) == 0)
+        {
+            level = sTagOverrides[i].mLevel.load(std::memory_order_relaxed);
+            break;
+        }
+    }
+
+    return aLevel <= level;
 }
 
 /** Initialize logging */
-void otbrLogInit(const char *aIdent, otbrLogLevel aLevel, bool aPrintStderr)
+void otbrLogInit(const char *aIdent, otbrLogLevel aLevel, bool aPrintStderr, bool aAsync)
 {
     assert(aIdent);
     assert(aLevel >= OTBR_LOG_EMERG && aLevel <= OTBR_LOG_DEBUG);
 
     openlog(aIdent, (LOG_CONS | LOG_PID) | (aPrintStderr ? LOG_PERROR : 0), OTBR_SYSLOG_FACILITY_ID);
     sLevel = aLevel;
+
+    if (aAsync)
+    {
+        AsyncLogStart();
+    }
 }
 
 static const char *GetPrefix(const char *aLogTag)
@@ -113,22 +666,113 @@ void otbrLog(otbrLogLevel aLevel, const char *aLogTag, const char *aFormat, ...)
 
     va_start(ap, aFormat);
 
-    if ((aLevel <= sLevel) && (vsnprintf(buffer, sizeof(buffer), aFormat, ap) > 0))
+    VerifyOrExit(otbrLogShouldLog(aLevel, aLogTag));
+
+    if (sBinaryLogEnabled.load(std::memory_order_relaxed))
     {
-        syslog(static_cast<int>(aLevel), "%s%s: %s", sLevelString[aLevel], GetPrefix(aLogTag), buffer);
+        va_list argsCopy;
+        bool    captured;
+
+        // Capture works on a copy so the eager fallback below still sees an
+        // unconsumed argument list when a conversion cannot be replayed.
+        va_copy(argsCopy, ap);
+        captured = BinaryLogCapture(aLevel, aLogTag, aFormat, argsCopy);
+        va_end(argsCopy);
+
+        VerifyOrExit(!captured);
     }
 
+    if (vsnprintf(buffer, sizeof(buffer), aFormat, ap) > 0)
+    {
+        if (sAsyncLogEnabled)
+        {
+            char line[kBufferSize];
+
+            snprintf(line, sizeof(line), "%s%s: %s", sLevelString[aLevel], GetPrefix(aLogTag), buffer);
+            AsyncLogEnqueue(static_cast<int>(aLevel), line);
+        }
+        else
+        {
+            syslog(static_cast<int>(aLevel), "%s%s: %s", sLevelString[aLevel], GetPrefix(aLogTag), buffer);
+        }
+    }
+
+exit:
     va_end(ap);
 
     return;
 }
 
+void otbrLogEnableBinarySink(bool aEnabled)
+{
+    if (aEnabled && !sBinaryLogInitialized)
+    {
+        for (uint32_t i = 0; i < kBinaryLogCapacity; i++)
+        {
+            sBinaryLogRing[i].mSequence.store(i, std::memory_order_relaxed);
+        }
+        sBinaryLogInitialized = true;
+    }
+
+    sBinaryLogEnabled.store(aEnabled, std::memory_order_release);
+
+    if (!aEnabled)
+    {
+        otbrLogBinarySinkFlush();
+    }
+}
+
+void otbrLogBinarySinkFlush(void)
+{
+    std::lock_guard<std::mutex> _(sBinaryLogFlushMutex);
+    uint32_t                    dropped;
+
+    while (true)
+    {
+        BinaryLogRecord &record = sBinaryLogRing[sBinaryLogTail & (kBinaryLogCapacity - 1)];
+        uint32_t         seq    = record.mSequence.load(std::memory_order_acquire);
+        char             text[1024];
+
+        if (static_cast<int32_t>(seq - (sBinaryLogTail + 1)) != 0)
+        {
+            break;
+        }
+
+        BinaryLogFormatRecord(record.mPayload, text, sizeof(text));
+
+        if (sAsyncLogEnabled)
+        {
+            char line[sizeof(text) + 32];
+
+            snprintf(line, sizeof(line), "%s%s: %s", sLevelString[record.mPayload.mLevel],
+                     GetPrefix(record.mPayload.mTag), text);
+            AsyncLogEnqueue(static_cast<int>(record.mPayload.mLevel), line);
+        }
+        else
+        {
+            syslog(static_cast<int>(record.mPayload.mLevel), "%s%s: %s", sLevelString[record.mPayload.mLevel],
+                   GetPrefix(record.mPayload.mTag), text);
+        }
+
+        record.mSequence.store(sBinaryLogTail + kBinaryLogCapacity, std::memory_order_release);
+        sBinaryLogTail++;
+    }
+
+    dropped = sBinaryLogDropped.load(std::memory_order_relaxed);
+    if (dropped != sBinaryLogReportedDropped)
+    {
+        syslog(LOG_WARNING, "[WARN]-LOG-----: dropped %u binary log records (ring buffer full)",
+               dropped - sBinaryLogReportedDropped);
+        sBinaryLogReportedDropped = dropped;
+    }
+}
+
 /** log to the syslog or log file */
 void otbrLogv(otbrLogLevel aLevel, const char *aFormat, va_list aArgList)
 {
     assert(aFormat);
 
-    if (aLevel <= sLevel)
+    if (aLevel <= otbrLogGetLevel())
     {
         otbrLogvNoFilter(aLevel, aFormat, aArgList);
     }
@@ -136,57 +780,72 @@ void otbrLogv(otbrLogLevel aLevel, const char *aFormat, va_list aArgList)
 
 void otbrLogvNoFilter(otbrLogLevel aLevel, const char *aFormat, va_list aArgList)
 {
-    vsyslog(static_cast<int>(aLevel), aFormat, aArgList);
+    if (sAsyncLogEnabled)
+    {
+        char line[1024];
+
+        if (vsnprintf(line, sizeof(line), aFormat, aArgList) > 0)
+        {
+            AsyncLogEnqueue(static_cast<int>(aLevel), line);
+        }
+    }
+    else
+    {
+        vsyslog(static_cast<int>(aLevel), aFormat, aArgList);
+    }
 }
 
 /** Hex dump data to the log */
 void otbrDump(otbrLogLevel aLevel, const char *aLogTag, const char *aPrefix, const void *aMemory, size_t aSize)
 {
-    static const char kHexChars[] = "0123456789abcdef";
+    // Hex dumps are 16-byte lines in the form "ADDR: XXXX...", batched so
+    // that one log record carries several lines instead of one syslog call
+    // each. The hex itself goes through the table/SIMD encoder shared with
+    // utils/hex.cpp.
+    constexpr size_t kBytesPerLine   = 16;
+    constexpr size_t kLinesPerRecord = 8;
+    // "\n%04zx: " plus the hex digits. The offset field is 4 digits minimum
+    // but widens for dumps of 64 KiB and more, so the budget covers the 16
+    // digits a 64-bit size_t can print.
+    constexpr size_t kCharsPerLine = 1 + 16 + 2 + 2 * kBytesPerLine;
+
+    const uint8_t *bytes  = static_cast<const uint8_t *>(aMemory);
+    size_t         offset = 0;
+
     assert(aPrefix && (aMemory || aSize == 0));
-    const uint8_t *pEnd;
-    const uint8_t *p8;
-    int            addr;
 
-    if (aLevel >= sLevel)
+    // Disabled dumps cost this one branch and nothing else.
+    if (aLevel > otbrLogGetLevel())
     {
         return;
     }
 
-    /* break hex dumps into 16byte lines
-     * In the form ADDR: XX XX XX XX ...
-     */
-
-    // we pre-increment... so subtract
-    addr = -16;
-
-    while (aSize > 0)
+    while (offset < aSize)
     {
-        size_t this_size;
-        char   hex[16 * 3 + 1];
-
-        addr = addr + 16;
-        p8   = (const uint8_t *)(aMemory) + addr;
-
-        /* truncate line to max 16 bytes */
-        this_size = aSize;
-        if (this_size > 16)
-        {
-            this_size = 16;
-        }
-        aSize = aSize - this_size;
-
-        char *ch = hex - 1;
+        char  record[kLinesPerRecord * kCharsPerLine + 1];
+        char *out = record;
 
-        for (pEnd = p8 + this_size; p8 < pEnd; p8++)
+        for (size_t line = 0; line < kLinesPerRecord && offset < aSize; line++)
         {
-            *++ch = kHexChars[(*p8) >> 4];
-            *++ch = kHexChars[(*p8) & 0x0f];
-            *++ch = ' ';
+            size_t lineSize  = aSize - offset < kBytesPerLine ? aSize - offset : kBytesPerLine;
+            size_t remaining = sizeof(record) - static_cast<size_t>(out - record);
+            int    headerLen = snprintf(out, remaining, "%s%04zx: ", line == 0 ? "" : "\n", offset);
+
+            // `Bytes2Hex()` takes no size and writes `2 * lineSize` digits
+            // plus a terminator; flush the record early rather than let a
+            // line wider than budgeted run past the buffer. The first line
+            // of a record always fits, so the dump keeps making progress.
+            if (headerLen < 0 || static_cast<size_t>(headerLen) + 2 * lineSize + 1 > remaining)
+            {
+                break;
+            }
+
+            out += headerLen;
+            out += otbr::Utils::Bytes2Hex(bytes + offset, static_cast<uint16_t>(lineSize), out);
+            offset += lineSize;
         }
-        *ch = 0;
 
-        otbrLog(aLevel, aLogTag, "%s: %04x: %s", aPrefix, addr, hex);
+        otbrLog(aLevel, aLogTag, "%s: %s", aPrefix, record);
     }
 }
 
@@ -253,5 +912,8 @@ const char *otbrErrorString(otbrError aError)
 
 void otbrLogDeinit(void)
 {
+    sBinaryLogEnabled.store(false, std::memory_order_release);
+    otbrLogBinarySinkFlush();
+    AsyncLogStop();
     closelog();
 }
@@ -60,6 +60,17 @@ typedef enum
     OTBR_LOG_DEBUG,   ///< Debug level messages
 } otbrLogLevel;
 
+/**
+ * @def OTBR_LOG_MAX_LEVEL
+ *
+ * The compile-time maximum log level. Log statements above this level are
+ * compiled out entirely, including the evaluation of their arguments.
+ *
+ */
+#ifndef OTBR_LOG_MAX_LEVEL
+#define OTBR_LOG_MAX_LEVEL OTBR_LOG_DEBUG
+#endif
+
 /**
  * Get current log level.
  */
@@ -70,6 +81,34 @@ otbrLogLevel otbrLogGetLevel(void);
  */
 void otbrLogSetLevel(otbrLogLevel aLevel);
 
+/**
+ * This function sets an independent log level for a log tag.
+ *
+ * Messages with @p aLogTag are filtered by @p aLevel instead of the global
+ * log level, so one module can log at debug level without enabling debug
+ * logging everywhere.
+ *
+ * @param[in] aLogTag  The log tag to override the level for.
+ * @param[in] aLevel   The log level for the tag.
+ *
+ */
+void otbrLogSetTagLevel(const char *aLogTag, otbrLogLevel aLevel);
+
+/**
+ * This function indicates whether a message would be logged.
+ *
+ * The tag-specific level applies when one is set for @p aLogTag, otherwise
+ * the global level. This is the cheap check the log macros perform before
+ * evaluating their arguments.
+ *
+ * @param[in] aLevel   The level of the message.
+ * @param[in] aLogTag  The log tag of the message.
+ *
+ * @returns Whether a message at @p aLevel with @p aLogTag would be logged.
+ *
+ */
+bool otbrLogShouldLog(otbrLogLevel aLevel, const char *aLogTag);
+
 /**
  * Control log to syslog.
  *
@@ -84,9 +123,43 @@ void otbrLogEnableSyslog(bool aEnabled);
  * @param[in] aIdent        Identity of the logger.
  * @param[in] aLevel        Log level of the logger.
  * @param[in] aPrintStderr  Whether to log to stderr.
+ * @param[in] aAsync        Whether to write logs asynchronously: the hot path appends the
+ *                          formatted message to a fixed-size lock-free ring buffer which is
+ *                          drained into syslog by a background thread. Messages are dropped
+ *                          (and counted) when the ring buffer is full.
+ *
+ */
+void otbrLogInit(const char *aIdent, otbrLogLevel aLevel, bool aPrintStderr, bool aAsync = false);
+
+/**
+ * This function enables or disables the structured binary log sink.
+ *
+ * While the sink is enabled, messages that pass the level filter are
+ * recorded into a fixed-size ring as the format string pointer, the log tag
+ * pointer and the raw argument values; all printf formatting is deferred to
+ * `otbrLogBinarySinkFlush()`, so a captured record costs a format-string
+ * scan and a slot write instead of a vsnprintf plus a syslog call. Format
+ * strings and log tags must be string literals, which the log macros
+ * guarantee; string arguments are copied into the record since they may
+ * point at transient buffers. Records are dropped and counted when the ring
+ * is full, and messages using conversions the capture cannot replay fall
+ * back to the regular eager path.
+ *
+ * Enable or disable from the main thread; capture itself is thread safe.
+ *
+ * @param[in] aEnabled  Whether to capture log messages into the binary sink.
+ *
+ */
+void otbrLogEnableBinarySink(bool aEnabled);
+
+/**
+ * This function formats the records captured by the binary log sink and
+ * emits them through the regular log output.
+ *
+ * Disabling the sink and `otbrLogDeinit()` flush implicitly.
  *
  */
-void otbrLogInit(const char *aIdent, otbrLogLevel aLevel, bool aPrintStderr);
+void otbrLogBinarySinkFlush(void);
 
 /**
  * This function log at level @p aLevel.
@@ -236,13 +309,26 @@ void otbrLogDeinit(void);
  * @param[in] ...  Arguments for the format specification.
  *
  */
-#define otbrLogEmerg(...) otbrLog(OTBR_LOG_EMERG, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogAlert(...) otbrLog(OTBR_LOG_ALERT, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogCrit(...) otbrLog(OTBR_LOG_CRIT, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogErr(...) otbrLog(OTBR_LOG_ERR, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogWarning(...) otbrLog(OTBR_LOG_WARNING, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogNotice(...) otbrLog(OTBR_LOG_NOTICE, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogInfo(...) otbrLog(OTBR_LOG_INFO, OTBR_LOG_TAG, __VA_ARGS__)
-#define otbrLogDebug(...) otbrLog(OTBR_LOG_DEBUG, OTBR_LOG_TAG, __VA_ARGS__)
+// The level check runs before the arguments are evaluated, so hot paths do
+// not pay for string conversions of disabled log statements. Levels above
+// OTBR_LOG_MAX_LEVEL are eliminated at compile time.
+#define otbrLogAtLevel(aLevel, ...)                                 \
+    do                                                              \
+    {                                                               \
+        if ((aLevel) <= OTBR_LOG_MAX_LEVEL &&                       \
+            otbrLogShouldLog(aLevel, OTBR_LOG_TAG))                 \
+        {                                                           \
+            otbrLog(aLevel, OTBR_LOG_TAG, __VA_ARGS__);             \
+        }                                                           \
+    } while (0)
+
+#define otbrLogEmerg(...) otbrLogAtLevel(OTBR_LOG_EMERG, __VA_ARGS__)
+#define otbrLogAlert(...) otbrLogAtLevel(OTBR_LOG_ALERT, __VA_ARGS__)
+#define otbrLogCrit(...) otbrLogAtLevel(OTBR_LOG_CRIT, __VA_ARGS__)
+#define otbrLogErr(...) otbrLogAtLevel(OTBR_LOG_ERR, __VA_ARGS__)
+#define otbrLogWarning(...) otbrLogAtLevel(OTBR_LOG_WARNING, __VA_ARGS__)
+#define otbrLogNotice(...) otbrLogAtLevel(OTBR_LOG_NOTICE, __VA_ARGS__)
+#define otbrLogInfo(...) otbrLogAtLevel(OTBR_LOG_INFO, __VA_ARGS__)
+#define otbrLogDebug(...) otbrLogAtLevel(OTBR_LOG_DEBUG, __VA_ARGS__)
 
 #endif // OTBR_COMMON_LOGGING_HPP_
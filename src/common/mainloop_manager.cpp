@@ -25,9 +25,18 @@
  *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
  *    POSSIBILITY OF SUCH DAMAGE.
  */
+#define OTBR_LOG_TAG "MLOOP"
+
 #include <assert.h>
 
+#include <algorithm>
+#include <typeinfo>
+
+#include "common/arena.hpp"
+#include "common/logging.hpp"
 #include "common/mainloop_manager.hpp"
+#include "common/time.hpp"
+#include "common/tracing.hpp"
 
 namespace otbr {
 
@@ -40,21 +49,246 @@ void MainloopManager::AddMainloopProcessor(MainloopProcessor *aMainloopProcessor
 void MainloopManager::RemoveMainloopProcessor(MainloopProcessor *aMainloopProcessor)
 {
     mMainloopProcessorList.remove(aMainloopProcessor);
+    mDispatchEntries.erase(std::remove_if(mDispatchEntries.begin(), mDispatchEntries.end(),
+                                          [aMainloopProcessor](const DispatchEntry &aEntry) {
+                                              return aEntry.mProcessor == aMainloopProcessor;
+                                          }),
+                           mDispatchEntries.end());
+    mProcessorRecords.erase(aMainloopProcessor);
 }
 
 void MainloopManager::Update(MainloopContext &aMainloop)
 {
+    Timepoint            now            = Clock::now();
+    const struct timeval initialTimeout = aMainloop.mTimeout;
+
+    mDispatchEntries.clear();
+
     for (auto &mainloopProcessor : mMainloopProcessorList)
     {
-        mainloopProcessor->Update(aMainloop);
+        MainloopContext context;
+        DispatchEntry   entry;
+
+        context.mMaxFd   = -1;
+        context.mTimeout = initialTimeout;
+        FD_ZERO(&context.mReadFdSet);
+        FD_ZERO(&context.mWriteFdSet);
+        FD_ZERO(&context.mErrorFdSet);
+
+        // Let the processor register into a scratch context so that we can
+        // tell which fds and which timeout belong to it.
+        mainloopProcessor->Update(context);
+
+        if (!timerisset(&context.mTimeout))
+        {
+            ClampZeroTimeout(mainloopProcessor, context.mTimeout);
+        }
+        else
+        {
+            ProcessorRecord &record = mProcessorRecords[mainloopProcessor];
+
+            record.mZeroTimeoutStreak = 0;
+            record.mBackoffExponent   = 0;
+        }
+
+        entry.mProcessor   = mainloopProcessor;
+        entry.mHasDeadline = false;
+
+        for (int fd = 0; fd <= context.mMaxFd; fd++)
+        {
+            bool isSet = false;
+
+            if (FD_ISSET(fd, &context.mReadFdSet))
+            {
+                FD_SET(fd, &aMainloop.mReadFdSet);
+                isSet = true;
+            }
+            if (FD_ISSET(fd, &context.mWriteFdSet))
+            {
+                FD_SET(fd, &aMainloop.mWriteFdSet);
+                isSet = true;
+            }
+            if (FD_ISSET(fd, &context.mErrorFdSet))
+            {
+                FD_SET(fd, &aMainloop.mErrorFdSet);
+                isSet = true;
+            }
+
+            if (isSet)
+            {
+                entry.mFds.push_back(fd);
+            }
+        }
+
+        aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, context.mMaxFd);
+
+        if (timercmp(&context.mTimeout, &initialTimeout, <))
+        {
+            entry.mHasDeadline = true;
+            entry.mDeadline    = now + FromTimeval<Microseconds>(context.mTimeout);
+        }
+
+        if (timercmp(&context.mTimeout, &aMainloop.mTimeout, <))
+        {
+            aMainloop.mTimeout = context.mTimeout;
+        }
+
+        mDispatchEntries.push_back(std::move(entry));
+    }
+
+    AccountLoopRate(now);
+}
+
+void MainloopManager::ClampZeroTimeout(MainloopProcessor *aProcessor, struct timeval &aTimeout)
+{
+    // A zero timeout is legitimate for short bursts (pending tasklets,
+    // remaining dbus dispatch data), so only requests sustained beyond
+    // the tolerance are clamped, with an exponentially growing backoff.
+    constexpr uint32_t kZeroTimeoutTolerance = 16;
+    constexpr uint32_t kMaxBackoffMs         = 100;
+    constexpr uint8_t  kMaxBackoffExponent   = 7;
+    constexpr Seconds  kSpinWarningInterval{10};
+
+    ProcessorRecord &record = mProcessorRecords[aProcessor];
+    uint32_t         backoffMs;
+
+    record.mZeroTimeoutStreak++;
+    VerifyOrExit(record.mZeroTimeoutStreak > kZeroTimeoutTolerance);
+
+    backoffMs = std::min(static_cast<uint32_t>(1) << record.mBackoffExponent, kMaxBackoffMs);
+
+    if (record.mBackoffExponent < kMaxBackoffExponent)
+    {
+        record.mBackoffExponent++;
+    }
+
+    aTimeout.tv_sec  = 0;
+    aTimeout.tv_usec = static_cast<suseconds_t>(backoffMs) * 1000;
+
+    record.mStats.mSpinClampCount++;
+    mSpinClampCount++;
+
+    {
+        Timepoint now = Clock::now();
+
+        if (record.mLastSpinWarning.time_since_epoch().count() == 0 ||
+            now - record.mLastSpinWarning >= kSpinWarningInterval)
+        {
+            record.mLastSpinWarning = now;
+            otbrLogWarning("Mainloop processor %s requested a zero timeout %u times in a row, clamping to %ums",
+                           GetProcessorName(aProcessor), record.mZeroTimeoutStreak, backoffMs);
+        }
+    }
+
+exit:
+    return;
+}
+
+void MainloopManager::AccountLoopRate(Timepoint aNow)
+{
+    constexpr Seconds kLoopRateWindow{10};
+
+    mLoopIterations++;
+
+    if (mLoopWindowStart.time_since_epoch().count() == 0)
+    {
+        mLoopWindowStart = aNow;
+    }
+    else if (aNow - mLoopWindowStart >= kLoopRateWindow)
+    {
+        uint64_t seconds = static_cast<uint64_t>(std::chrono::duration_cast<Seconds>(aNow - mLoopWindowStart).count());
+
+        mLastLoopRate    = static_cast<uint32_t>(mLoopIterations / seconds);
+        mLoopIterations  = 0;
+        mLoopWindowStart = aNow;
+
+        otbrLogDebug("Mainloop running at %u iterations/sec (%llu zero-timeout clamps total)", mLastLoopRate,
+                     static_cast<unsigned long long>(mSpinClampCount));
     }
 }
 
 void MainloopManager::Process(const MainloopContext &aMainloop)
 {
-    for (auto &mainloopProcessor : mMainloopProcessorList)
+    Timepoint now = Clock::now();
+
+    for (DispatchEntry &entry : mDispatchEntries)
     {
-        mainloopProcessor->Process(aMainloop);
+        bool shouldProcess = (entry.mHasDeadline && now >= entry.mDeadline);
+
+        // Processors that registered neither an fd nor a deadline are
+        // always processed to preserve the previous polling behavior.
+        shouldProcess = shouldProcess || (entry.mFds.empty() && !entry.mHasDeadline);
+
+        for (auto it = entry.mFds.begin(); !shouldProcess && it != entry.mFds.end(); ++it)
+        {
+            shouldProcess = FD_ISSET(*it, &aMainloop.mReadFdSet) || FD_ISSET(*it, &aMainloop.mWriteFdSet) ||
+                            FD_ISSET(*it, &aMainloop.mErrorFdSet);
+        }
+
+        if (shouldProcess)
+        {
+            Tracer::Scope scope("mainloop", GetProcessorName(entry.mProcessor));
+            Timepoint     start = Clock::now();
+
+            entry.mProcessor->Process(aMainloop);
+
+            RecordProcessTime(entry.mProcessor,
+                              std::chrono::duration_cast<Microseconds>(Clock::now() - start));
+        }
     }
+
+    // All per-event scratch memory dies with the pass.
+    ScratchArena::GetInstance().Reset();
+}
+
+const char *MainloopManager::GetProcessorName(const MainloopProcessor *aProcessor)
+{
+    return typeid(*aProcessor).name();
+}
+
+void MainloopManager::RecordProcessTime(MainloopProcessor *aProcessor, Microseconds aDuration)
+{
+    constexpr Seconds kBudgetWarningInterval{10};
+
+    ProcessorRecord &record = mProcessorRecords[aProcessor];
+    ProcessorStats & stats  = record.mStats;
+    uint64_t         usec   = static_cast<uint64_t>(std::max<Microseconds::rep>(aDuration.count(), 0));
+    uint8_t          bucket = 0;
+
+    while ((usec >> (bucket + 1)) != 0 && bucket < ProcessorStats::kNumBuckets - 1)
+    {
+        bucket++;
+    }
+
+    stats.mNumCalls++;
+    stats.mTotalTime += aDuration;
+    stats.mMaxTime = std::max(stats.mMaxTime, aDuration);
+    stats.mBuckets[bucket]++;
+
+    if (mProcessTimeBudget.count() > 0 && aDuration >= mProcessTimeBudget)
+    {
+        Timepoint now = Clock::now();
+
+        if (record.mLastBudgetWarning.time_since_epoch().count() == 0 ||
+            now - record.mLastBudgetWarning >= kBudgetWarningInterval)
+        {
+            record.mLastBudgetWarning = now;
+            otbrLogWarning("Mainloop processor %s blocked the mainloop for %lldms (budget %lldms)",
+                           GetProcessorName(aProcessor), static_cast<long long>(aDuration.count() / 1000),
+                           static_cast<long long>(mProcessTimeBudget.count()));
+        }
+    }
+}
+
+std::vector<std::pair<std::string, MainloopManager::ProcessorStats>> MainloopManager::GetProcessorStats(void) const
+{
+    std::vector<std::pair<std::string, ProcessorStats>> stats;
+
+    for (const auto &entry : mProcessorRecords)
+    {
+        stats.emplace_back(GetProcessorName(entry.first), entry.second.mStats);
+    }
+
+    return stats;
 }
 } // namespace otbr
@@ -39,9 +39,14 @@
 #include <openthread/openthread-system.h>
 
 #include <list>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "common/code_utils.hpp"
 #include "common/mainloop.hpp"
+#include "common/time.hpp"
 #include "ncp/ncp_openthread.hpp"
 
 namespace otbr {
@@ -53,6 +58,27 @@ namespace otbr {
 class MainloopManager : private NonCopyable
 {
 public:
+    /**
+     * This structure represents the latency statistics of a mainloop processor.
+     *
+     */
+    struct ProcessorStats
+    {
+        /**
+         * The number of histogram buckets. Bucket `i` counts `Process()` calls that
+         * took at least 2^i and less than 2^(i+1) microseconds; the last bucket
+         * additionally counts everything beyond the histogram range (~2 seconds).
+         *
+         */
+        static constexpr uint8_t kNumBuckets = 21;
+
+        uint64_t     mNumCalls = 0;                ///< The number of `Process()` calls.
+        Microseconds mTotalTime{0};                ///< The accumulated `Process()` wall time.
+        Microseconds mMaxTime{0};                  ///< The longest single `Process()` call.
+        uint32_t     mBuckets[kNumBuckets] = {0};  ///< The log2-scale latency histogram.
+        uint32_t     mSpinClampCount = 0;          ///< Times a pathological zero timeout request was clamped.
+    };
+
     /**
      * The constructor to initialize the mainloop manager.
      *
@@ -88,6 +114,9 @@ public:
     /**
      * This method updates the mainloop context of all mainloop processors.
      *
+     * While merging the per-processor fd registrations into @p aMainloop, this method also
+     * rebuilds the fd-to-processor dispatch index used by `Process()`.
+     *
      * @param[in,out] aMainloop  A reference to the mainloop to be updated.
      *
      */
@@ -96,13 +125,84 @@ public:
     /**
      * This method processes mainloop events of all mainloop processors.
      *
+     * Only processors that own a ready fd or whose requested timeout has expired are
+     * invoked, so a single ready fd no longer wakes every registered processor.
+     *
      * @param[in] aMainloop  A reference to the mainloop context.
      *
      */
     void Process(const MainloopContext &aMainloop);
 
+    /**
+     * This method sets the wall-time budget for a single `Process()` call.
+     *
+     * A rate-limited warning identifying the processor is logged whenever a
+     * call exceeds the budget.
+     *
+     * @param[in] aBudget  The budget for a single `Process()` call.
+     *
+     */
+    void SetProcessTimeBudget(Milliseconds aBudget) { mProcessTimeBudget = aBudget; }
+
+    /**
+     * This method returns the latency statistics of all registered processors.
+     *
+     * @returns A list of (processor name, statistics) pairs.
+     *
+     */
+    std::vector<std::pair<std::string, ProcessorStats>> GetProcessorStats(void) const;
+
+    /**
+     * This method returns how often a pathological zero-timeout request was clamped.
+     *
+     * A non-zero, growing value means some processor tried to spin the
+     * mainloop; `GetProcessorStats()` tells which one.
+     *
+     * @returns The total number of clamped zero-timeout requests.
+     *
+     */
+    uint64_t GetSpinClampCount(void) const { return mSpinClampCount; }
+
+    /**
+     * This method returns the mainloop iteration rate of the last accounting window.
+     *
+     * @returns The iterations per second observed in the last window.
+     *
+     */
+    uint32_t GetLastLoopRate(void) const { return mLastLoopRate; }
+
 private:
-    std::list<MainloopProcessor *> mMainloopProcessorList;
+    struct DispatchEntry
+    {
+        MainloopProcessor *mProcessor;
+        std::vector<int>   mFds;         ///< The fds the processor registered in the last `Update()`.
+        bool               mHasDeadline; ///< Whether the processor shortened the mainloop timeout.
+        Timepoint          mDeadline;    ///< The time the processor requested to be woken at.
+    };
+
+    struct ProcessorRecord
+    {
+        ProcessorStats mStats;
+        Timepoint      mLastBudgetWarning;     ///< When the last over-budget warning was logged.
+        Timepoint      mLastSpinWarning;       ///< When the last spin-clamp warning was logged.
+        uint32_t       mZeroTimeoutStreak = 0; ///< Consecutive `Update()` calls requesting a zero timeout.
+        uint8_t        mBackoffExponent   = 0; ///< Exponent of the current clamp backoff.
+    };
+
+    static const char *GetProcessorName(const MainloopProcessor *aProcessor);
+
+    void RecordProcessTime(MainloopProcessor *aProcessor, Microseconds aDuration);
+    void ClampZeroTimeout(MainloopProcessor *aProcessor, struct timeval &aTimeout);
+    void AccountLoopRate(Timepoint aNow);
+
+    std::list<MainloopProcessor *>                mMainloopProcessorList;
+    std::vector<DispatchEntry>                    mDispatchEntries;
+    std::map<MainloopProcessor *, ProcessorRecord> mProcessorRecords;
+    Milliseconds                                  mProcessTimeBudget{0};   ///< Zero means no budget check.
+    uint64_t                                      mSpinClampCount   = 0;   ///< Total clamped zero-timeout requests.
+    uint32_t                                      mLastLoopRate     = 0;   ///< Iterations/sec of the last window.
+    uint32_t                                      mLoopIterations   = 0;   ///< Iterations in the current window.
+    Timepoint                                     mLoopWindowStart;        ///< Start of the current window.
 };
 } // namespace otbr
 #endif // OTBR_COMMON_MAINLOOP_MANAGER_HPP_
@@ -0,0 +1,133 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/metrics.hpp"
+
+#include <inttypes.h>
+#include <stdio.h>
+
+namespace otbr {
+
+Metrics &Metrics::GetInstance(void)
+{
+    static Metrics sInstance;
+
+    return sInstance;
+}
+
+Metrics::Counter &Metrics::RegisterCounter(const std::string &aName, const std::string &aHelp)
+{
+    CounterEntry *entry = nullptr;
+
+    for (CounterEntry &counterEntry : mCounters)
+    {
+        if (counterEntry.mName == aName)
+        {
+            entry = &counterEntry;
+            break;
+        }
+    }
+
+    if (entry == nullptr)
+    {
+        mCounters.emplace_back(aName, aHelp);
+        entry = &mCounters.back();
+    }
+
+    return entry->mCounter;
+}
+
+Metrics::Histogram &Metrics::RegisterHistogram(const std::string &aName, const std::string &aHelp)
+{
+    HistogramEntry *entry = nullptr;
+
+    for (HistogramEntry &histogramEntry : mHistograms)
+    {
+        if (histogramEntry.mName == aName)
+        {
+            entry = &histogramEntry;
+            break;
+        }
+    }
+
+    if (entry == nullptr)
+    {
+        mHistograms.emplace_back(aName, aHelp);
+        entry = &mHistograms.back();
+    }
+
+    return entry->mHistogram;
+}
+
+std::string Metrics::SerializePrometheus(void) const
+{
+    std::string body;
+    char        line[160];
+
+    for (const CounterEntry &entry : mCounters)
+    {
+        body += "# HELP " + entry.mName + " " + entry.mHelp + "\n";
+        body += "# TYPE " + entry.mName + " counter\n";
+
+        snprintf(line, sizeof(line), "%s %" PRIu64 "\n", entry.mName.c_str(), entry.mCounter.GetValue());
+        body += line;
+    }
+
+    for (const HistogramEntry &entry : mHistograms)
+    {
+        const Histogram &histogram  = entry.mHistogram;
+        uint64_t         cumulative = 0;
+
+        body += "# HELP " + entry.mName + " " + entry.mHelp + "\n";
+        body += "# TYPE " + entry.mName + " histogram\n";
+
+        for (uint8_t i = 0; i < Histogram::kNumBuckets - 1; i++)
+        {
+            cumulative += histogram.mBuckets[i].load(std::memory_order_relaxed);
+            snprintf(line, sizeof(line), "%s_bucket{le=\"%" PRIu64 "\"} %" PRIu64 "\n", entry.mName.c_str(),
+                     (static_cast<uint64_t>(2) << i) - 1, cumulative);
+            body += line;
+        }
+
+        cumulative += histogram.mBuckets[Histogram::kNumBuckets - 1].load(std::memory_order_relaxed);
+        snprintf(line, sizeof(line), "%s_bucket{le=\"+Inf\"} %" PRIu64 "\n", entry.mName.c_str(), cumulative);
+        body += line;
+
+        snprintf(line, sizeof(line), "%s_sum %" PRIu64 "\n", entry.mName.c_str(),
+                 histogram.mSum.load(std::memory_order_relaxed));
+        body += line;
+
+        snprintf(line, sizeof(line), "%s_count %" PRIu64 "\n", entry.mName.c_str(),
+                 histogram.mCount.load(std::memory_order_relaxed));
+        body += line;
+    }
+
+    return body;
+}
+
+} // namespace otbr
@@ -0,0 +1,212 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions of a lightweight performance metrics registry.
+ */
+
+#ifndef OTBR_COMMON_METRICS_HPP_
+#define OTBR_COMMON_METRICS_HPP_
+
+#include "openthread-br/config.h"
+
+#include <atomic>
+#include <list>
+#include <string>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements a process-wide registry of named performance metrics.
+ *
+ * Counters and histograms are registered once at initialization time and then
+ * incremented from hot paths with plain relaxed atomic operations — no locks
+ * and no syscalls. Serialization into the Prometheus text exposition format
+ * happens only at scrape time.
+ *
+ * Registering metrics concurrently with a scrape is not supported; register
+ * during component setup, before the mainloop starts.
+ *
+ */
+class Metrics : private NonCopyable
+{
+public:
+    /**
+     * This class implements a monotonically increasing counter.
+     *
+     */
+    class Counter : private NonCopyable
+    {
+    public:
+        /**
+         * This method increments the counter.
+         *
+         * @param[in] aDelta  The amount to add; defaults to 1.
+         *
+         */
+        void Increment(uint64_t aDelta = 1) { mValue.fetch_add(aDelta, std::memory_order_relaxed); }
+
+        /**
+         * This method returns the current counter value.
+         *
+         * @returns The current counter value.
+         *
+         */
+        uint64_t GetValue(void) const { return mValue.load(std::memory_order_relaxed); }
+
+    private:
+        std::atomic<uint64_t> mValue{0};
+    };
+
+    /**
+     * This class implements a histogram with power-of-two buckets.
+     *
+     * Bucket `i` counts observations strictly below `2 << i`; the last bucket
+     * absorbs the rest. The unit of observed values is up to the caller and
+     * should be stated in the metric's help string.
+     *
+     */
+    class Histogram : private NonCopyable
+    {
+    public:
+        static constexpr uint8_t kNumBuckets = 16; ///< Number of power-of-two buckets.
+
+        /**
+         * This method records one observation.
+         *
+         * @param[in] aValue  The observed value.
+         *
+         */
+        void Observe(uint64_t aValue)
+        {
+            uint8_t bucket = 0;
+
+            while (bucket < kNumBuckets - 1 && aValue >= (static_cast<uint64_t>(2) << bucket))
+            {
+                bucket++;
+            }
+
+            mBuckets[bucket].fetch_add(1, std::memory_order_relaxed);
+            mSum.fetch_add(aValue, std::memory_order_relaxed);
+            mCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+    private:
+        friend class Metrics;
+
+        std::atomic<uint64_t> mBuckets[kNumBuckets]{};
+        std::atomic<uint64_t> mSum{0};
+        std::atomic<uint64_t> mCount{0};
+    };
+
+    /**
+     * This method returns the process-wide metrics registry.
+     *
+     * @returns A reference to the registry singleton.
+     *
+     */
+    static Metrics &GetInstance(void);
+
+    /**
+     * This method registers a counter, or returns the existing one of the same name.
+     *
+     * The returned reference stays valid for the lifetime of the process.
+     *
+     * @param[in] aName  The Prometheus metric name.
+     * @param[in] aHelp  A one-line description for the `# HELP` comment.
+     *
+     * @returns A reference to the counter.
+     *
+     */
+    Counter &RegisterCounter(const std::string &aName, const std::string &aHelp);
+
+    /**
+     * This method registers a histogram, or returns the existing one of the same name.
+     *
+     * The returned reference stays valid for the lifetime of the process.
+     *
+     * @param[in] aName  The Prometheus metric name.
+     * @param[in] aHelp  A one-line description for the `# HELP` comment.
+     *
+     * @returns A reference to the histogram.
+     *
+     */
+    Histogram &RegisterHistogram(const std::string &aName, const std::string &aHelp);
+
+    /**
+     * This method serializes all registered metrics in the Prometheus text exposition format.
+     *
+     * @returns The serialized metrics.
+     *
+     */
+    std::string SerializePrometheus(void) const;
+
+private:
+    struct CounterEntry
+    {
+        CounterEntry(const std::string &aName, const std::string &aHelp)
+            : mName(aName)
+            , mHelp(aHelp)
+        {
+        }
+
+        std::string mName;
+        std::string mHelp;
+        Counter     mCounter;
+    };
+
+    struct HistogramEntry
+    {
+        HistogramEntry(const std::string &aName, const std::string &aHelp)
+            : mName(aName)
+            , mHelp(aHelp)
+        {
+        }
+
+        std::string mName;
+        std::string mHelp;
+        Histogram   mHistogram;
+    };
+
+    Metrics(void) = default;
+
+    // `std::list` keeps entry addresses stable across registrations, so the
+    // references handed to hot paths never move.
+    std::list<CounterEntry>   mCounters;
+    std::list<HistogramEntry> mHistograms;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_METRICS_HPP_
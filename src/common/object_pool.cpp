@@ -0,0 +1,88 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the fixed-slab object pool.
+ */
+
+#include "common/object_pool.hpp"
+
+#include <cstddef>
+
+namespace otbr {
+
+ObjectPool::ObjectPool(size_t aSlotSize, size_t aSlotsPerSlab)
+    : mSlotSize(((aSlotSize + alignof(std::max_align_t) - 1) / alignof(std::max_align_t)) *
+                alignof(std::max_align_t))
+    , mSlotsPerSlab(aSlotsPerSlab)
+    , mFreeList(nullptr)
+{
+    // A freed slot holds the free list link in place.
+    static_assert(sizeof(FreeSlot) <= alignof(std::max_align_t), "FreeSlot must fit the smallest slot");
+}
+
+void ObjectPool::AddSlab(void)
+{
+    std::unique_ptr<uint8_t[]> slab(new uint8_t[mSlotSize * mSlotsPerSlab]);
+
+    for (size_t i = 0; i < mSlotsPerSlab; i++)
+    {
+        FreeSlot *slot = reinterpret_cast<FreeSlot *>(slab.get() + i * mSlotSize);
+
+        slot->mNext = mFreeList;
+        mFreeList   = slot;
+    }
+
+    mSlabs.push_back(std::move(slab));
+}
+
+void *ObjectPool::Allocate(void)
+{
+    FreeSlot *slot;
+
+    if (mFreeList == nullptr)
+    {
+        AddSlab();
+    }
+
+    slot      = mFreeList;
+    mFreeList = slot->mNext;
+
+    return slot;
+}
+
+void ObjectPool::Free(void *aSlot)
+{
+    FreeSlot *slot = static_cast<FreeSlot *>(aSlot);
+
+    slot->mNext = mFreeList;
+    mFreeList   = slot;
+}
+
+} // namespace otbr
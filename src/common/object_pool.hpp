@@ -0,0 +1,115 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definition of a fixed-slab object pool.
+ */
+
+#ifndef OTBR_COMMON_OBJECT_POOL_HPP_
+#define OTBR_COMMON_OBJECT_POOL_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <vector>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements a fixed-slab pool of equally sized memory slots.
+ *
+ * Slots are carved out of slabs allocated a whole slab at a time and are
+ * recycled through a free list, so objects that churn at a steady rate
+ * (allocated and freed over and over) stop fragmenting the general heap.
+ * Freed slots are returned to the pool, not to the system; the slabs are
+ * released when the pool is destroyed.
+ *
+ * The pool is not thread safe; it is meant for mainloop-thread objects.
+ *
+ */
+class ObjectPool : private NonCopyable
+{
+public:
+    /**
+     * This constructor initializes an empty pool.
+     *
+     * No slab is allocated until the first `Allocate()` call.
+     *
+     * @param[in] aSlotSize      The slot size in bytes; rounded up to the
+     *                           size of `max_align_t` so any object fits.
+     * @param[in] aSlotsPerSlab  The number of slots carved from one slab.
+     *
+     */
+    ObjectPool(size_t aSlotSize, size_t aSlotsPerSlab);
+
+    /**
+     * This method returns a slot from the pool, growing it by one slab when
+     * the free list is empty.
+     *
+     * @returns A pointer to an uninitialized slot of the configured size.
+     *
+     */
+    void *Allocate(void);
+
+    /**
+     * This method returns a slot to the pool free list.
+     *
+     * @param[in] aSlot  The slot to return; must come from this pool.
+     *
+     */
+    void Free(void *aSlot);
+
+    /**
+     * This method returns the number of slabs the pool has allocated.
+     *
+     * @returns The slab count.
+     *
+     */
+    size_t GetSlabCount(void) const { return mSlabs.size(); }
+
+private:
+    struct FreeSlot
+    {
+        FreeSlot *mNext;
+    };
+
+    void AddSlab(void);
+
+    size_t                                  mSlotSize;
+    size_t                                  mSlotsPerSlab;
+    FreeSlot *                              mFreeList;
+    std::vector<std::unique_ptr<uint8_t[]>> mSlabs;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_OBJECT_POOL_HPP_
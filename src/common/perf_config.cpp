@@ -0,0 +1,199 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define OTBR_LOG_TAG "PERF"
+
+#include "common/perf_config.hpp"
+
+#include <set>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common/logging.hpp"
+
+namespace otbr {
+
+// The environment variable overriding the configuration file location, and
+// the default location used when it is unset.
+static const char kConfigFileEnv[]     = "OTBR_PERF_CONFIG_FILE";
+static const char kDefaultConfigFile[] = "/etc/otbr/perf.conf";
+
+PerfConfig &PerfConfig::GetInstance(void)
+{
+    static PerfConfig sInstance;
+
+    return sInstance;
+}
+
+PerfConfig::Uint32Value &PerfConfig::RegisterUint32(const std::string &aKey,
+                                                    uint32_t           aDefault,
+                                                    const std::string &aHelp)
+{
+    Entry *entry = FindEntry(aKey);
+
+    if (entry == nullptr)
+    {
+        mEntries.emplace_back(aKey, aDefault, aHelp);
+        entry = &mEntries.back();
+    }
+
+    return entry->mValue;
+}
+
+PerfConfig::Entry *PerfConfig::FindEntry(const std::string &aKey)
+{
+    Entry *found = nullptr;
+
+    for (Entry &entry : mEntries)
+    {
+        if (entry.mKey == aKey)
+        {
+            found = &entry;
+            break;
+        }
+    }
+
+    return found;
+}
+
+void PerfConfig::ApplyValue(Entry &aEntry, uint32_t aValue)
+{
+    uint32_t oldValue = aEntry.mValue.Get();
+
+    VerifyOrExit(aValue != oldValue);
+
+    aEntry.mValue.mValue.store(aValue, std::memory_order_relaxed);
+    otbrLogNotice("Perf config: %s = %lu (was %lu)", aEntry.mKey.c_str(), static_cast<unsigned long>(aValue),
+                  static_cast<unsigned long>(oldValue));
+
+exit:
+    return;
+}
+
+void PerfConfig::Reload(void)
+{
+    const char *          path = getenv(kConfigFileEnv);
+    FILE *                file;
+    char                  line[256];
+    std::set<std::string> seenKeys;
+
+    if (path == nullptr)
+    {
+        path = kDefaultConfigFile;
+    }
+
+    file = fopen(path, "r");
+
+    if (file != nullptr)
+    {
+        while (fgets(line, sizeof(line), file) != nullptr)
+        {
+            char *        comment = strchr(line, '#');
+            char *        equals;
+            char *        keyStart;
+            char *        keyEnd;
+            char *        valueEnd = nullptr;
+            unsigned long value;
+            Entry *       entry;
+
+            if (comment != nullptr)
+            {
+                *comment = '\0';
+            }
+
+            equals = strchr(line, '=');
+
+            if (equals == nullptr)
+            {
+                continue;
+            }
+
+            // Trim the key in place.
+            keyStart = line;
+            while (*keyStart == ' ' || *keyStart == '\t')
+            {
+                keyStart++;
+            }
+            keyEnd = equals;
+            while (keyEnd > keyStart && (keyEnd[-1] == ' ' || keyEnd[-1] == '\t'))
+            {
+                keyEnd--;
+            }
+            *keyEnd = '\0';
+
+            if (keyStart == keyEnd)
+            {
+                continue;
+            }
+
+            value = strtoul(equals + 1, &valueEnd, 0);
+            while (valueEnd != nullptr && (*valueEnd == ' ' || *valueEnd == '\t' || *valueEnd == '\n' ||
+                                           *valueEnd == '\r'))
+            {
+                valueEnd++;
+            }
+
+            if (valueEnd == equals + 1 || *valueEnd != '\0')
+            {
+                otbrLogWarning("Perf config: ignoring unparsable value for key '%s'", keyStart);
+                continue;
+            }
+
+            entry = FindEntry(keyStart);
+
+            if (entry == nullptr)
+            {
+                otbrLogWarning("Perf config: ignoring unknown key '%s'", keyStart);
+                continue;
+            }
+
+            seenKeys.insert(entry->mKey);
+            ApplyValue(*entry, static_cast<uint32_t>(value));
+        }
+
+        fclose(file);
+    }
+    else
+    {
+        otbrLogInfo("Perf config file %s not present; using built-in defaults", path);
+    }
+
+    // Keys absent from the file revert to their defaults, so removing a line
+    // (or the whole file) and reloading undoes an experiment.
+    for (Entry &entry : mEntries)
+    {
+        if (seenKeys.count(entry.mKey) == 0)
+        {
+            ApplyValue(entry, entry.mDefault);
+        }
+    }
+}
+
+} // namespace otbr
@@ -0,0 +1,155 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions of the runtime performance configuration registry.
+ */
+
+#ifndef OTBR_COMMON_PERF_CONFIG_HPP_
+#define OTBR_COMMON_PERF_CONFIG_HPP_
+
+#include "openthread-br/config.h"
+
+#include <atomic>
+#include <list>
+#include <string>
+
+#include <stdint.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements a process-wide registry of runtime performance tunables.
+ *
+ * Tunables are registered once at initialization time with a built-in default
+ * and then read from hot paths with plain relaxed atomic loads — no locks and
+ * no parsing. `Reload()` re-reads the configuration file and atomically stores
+ * the new values, so tunings can be A/B tested on a running daemon (via
+ * `SIGHUP`) without a rebuild; keys absent from the file revert to their
+ * defaults.
+ *
+ * Registering tunables concurrently with a reload is not supported; register
+ * during component setup, before the mainloop starts.
+ *
+ */
+class PerfConfig : private NonCopyable
+{
+public:
+    /**
+     * This class holds one unsigned integer tunable.
+     *
+     */
+    class Uint32Value : private NonCopyable
+    {
+    public:
+        /**
+         * This method returns the current value of the tunable.
+         *
+         * @returns The current value.
+         *
+         */
+        uint32_t Get(void) const { return mValue.load(std::memory_order_relaxed); }
+
+    private:
+        friend class PerfConfig;
+
+        explicit Uint32Value(uint32_t aDefault)
+            : mValue(aDefault)
+        {
+        }
+
+        std::atomic<uint32_t> mValue;
+    };
+
+    /**
+     * This method returns the process-wide performance configuration registry.
+     *
+     * @returns A reference to the registry singleton.
+     *
+     */
+    static PerfConfig &GetInstance(void);
+
+    /**
+     * This method registers a tunable, or returns the existing one of the same key.
+     *
+     * The returned reference stays valid for the lifetime of the process.
+     *
+     * @param[in] aKey      The configuration key (e.g. "rest.max_connections").
+     * @param[in] aDefault  The built-in default value.
+     * @param[in] aHelp     A one-line description of what the tunable controls.
+     *
+     * @returns A reference to the tunable.
+     *
+     */
+    Uint32Value &RegisterUint32(const std::string &aKey, uint32_t aDefault, const std::string &aHelp);
+
+    /**
+     * This method re-reads the configuration file and applies its values.
+     *
+     * The file location is taken from the `OTBR_PERF_CONFIG_FILE` environment
+     * variable, falling back to the built-in default path. Each line holds one
+     * `key = value` pair; `#` starts a comment. Unknown keys and unparsable
+     * values are logged and skipped; registered keys absent from the file (or
+     * when the file itself is absent) revert to their defaults.
+     *
+     */
+    void Reload(void);
+
+private:
+    struct Entry
+    {
+        Entry(const std::string &aKey, uint32_t aDefault, const std::string &aHelp)
+            : mKey(aKey)
+            , mHelp(aHelp)
+            , mDefault(aDefault)
+            , mValue(aDefault)
+        {
+        }
+
+        std::string mKey;
+        std::string mHelp;
+        uint32_t    mDefault;
+        Uint32Value mValue;
+    };
+
+    PerfConfig(void) = default;
+
+    Entry *FindEntry(const std::string &aKey);
+    void   ApplyValue(Entry &aEntry, uint32_t aValue);
+
+    // `std::list` keeps entry addresses stable across registrations, so the
+    // references handed to hot paths never move.
+    std::list<Entry> mEntries;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_PERF_CONFIG_HPP_
@@ -0,0 +1,135 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the binary trie for IPv6 prefix matching.
+ */
+
+#include "common/prefix_matcher.hpp"
+
+#include <assert.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+void Ip6PrefixMatcher::Clear(void)
+{
+    mNodes.clear();
+    mNodes.push_back(Node{{kNoChild, kNoChild}, false});
+}
+
+uint32_t Ip6PrefixMatcher::AddNode(void)
+{
+    mNodes.push_back(Node{{kNoChild, kNoChild}, false});
+
+    return static_cast<uint32_t>(mNodes.size() - 1);
+}
+
+void Ip6PrefixMatcher::Insert(const Ip6Prefix &aPrefix)
+{
+    uint32_t node = 0;
+
+    assert(aPrefix.IsValid());
+
+    for (uint8_t bit = 0; bit < aPrefix.mLength; bit++)
+    {
+        uint8_t branch = GetBit(aPrefix.mPrefix, bit);
+
+        if (mNodes[node].mChildren[branch] == kNoChild)
+        {
+            // `AddNode()` may reallocate the pool, so the child link is
+            // written through a fresh reference.
+            uint32_t child = AddNode();
+
+            mNodes[node].mChildren[branch] = child;
+        }
+
+        node = mNodes[node].mChildren[branch];
+    }
+
+    mNodes[node].mIsTerminal = true;
+}
+
+void Ip6PrefixMatcher::Insert(const Ip6Address &aAddress)
+{
+    Ip6Prefix prefix;
+
+    prefix.mPrefix = aAddress;
+    prefix.mLength = sizeof(aAddress.m8) * 8;
+
+    Insert(prefix);
+}
+
+void Ip6PrefixMatcher::Remove(const Ip6Prefix &aPrefix)
+{
+    uint32_t node = 0;
+
+    for (uint8_t bit = 0; bit < aPrefix.mLength; bit++)
+    {
+        node = mNodes[node].mChildren[GetBit(aPrefix.mPrefix, bit)];
+        VerifyOrExit(node != kNoChild);
+    }
+
+    mNodes[node].mIsTerminal = false;
+
+exit:
+    return;
+}
+
+void Ip6PrefixMatcher::Remove(const Ip6Address &aAddress)
+{
+    Ip6Prefix prefix;
+
+    prefix.mPrefix = aAddress;
+    prefix.mLength = sizeof(aAddress.m8) * 8;
+
+    Remove(prefix);
+}
+
+bool Ip6PrefixMatcher::Contains(const Ip6Address &aAddress) const
+{
+    bool     found = false;
+    uint32_t node  = 0;
+
+    for (uint8_t bit = 0; bit < sizeof(aAddress.m8) * 8; bit++)
+    {
+        VerifyOrExit(!mNodes[node].mIsTerminal, found = true);
+
+        node = mNodes[node].mChildren[GetBit(aAddress, bit)];
+        VerifyOrExit(node != kNoChild);
+    }
+
+    found = mNodes[node].mIsTerminal;
+
+exit:
+    return found;
+}
+
+} // namespace otbr
@@ -0,0 +1,139 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definition of a binary trie for IPv6 prefix matching.
+ */
+
+#ifndef OTBR_COMMON_PREFIX_MATCHER_HPP_
+#define OTBR_COMMON_PREFIX_MATCHER_HPP_
+
+#include <stdint.h>
+
+#include <vector>
+
+#include "common/types.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements a binary trie over IPv6 prefixes.
+ *
+ * A lookup walks at most one node per prefix bit regardless of how many
+ * prefixes are inserted, so it suits per-packet paths where a list of
+ * `memcmp()`-based checks would grow with the number of prefixes. Nodes
+ * live in one contiguous pool, so inserting a batch of prefixes appends
+ * to a single vector and lookups stay cache friendly.
+ *
+ */
+class Ip6PrefixMatcher
+{
+public:
+    /**
+     * This constructor initializes an empty matcher.
+     *
+     */
+    Ip6PrefixMatcher(void) { Clear(); }
+
+    /**
+     * This method removes all prefixes from the matcher.
+     *
+     */
+    void Clear(void);
+
+    /**
+     * This method inserts an IPv6 prefix into the matcher.
+     *
+     * @param[in] aPrefix  The prefix to insert; must be valid.
+     *
+     */
+    void Insert(const Ip6Prefix &aPrefix);
+
+    /**
+     * This method inserts a full IPv6 address into the matcher as a /128 prefix.
+     *
+     * @param[in] aAddress  The address to insert.
+     *
+     */
+    void Insert(const Ip6Address &aAddress);
+
+    /**
+     * This method removes an IPv6 prefix from the matcher.
+     *
+     * The trie nodes are kept and only the terminal mark is cleared; the
+     * pool is compacted on the next `Clear()`.
+     *
+     * @param[in] aPrefix  The prefix to remove.
+     *
+     */
+    void Remove(const Ip6Prefix &aPrefix);
+
+    /**
+     * This method removes a full IPv6 address (a /128 prefix) from the matcher.
+     *
+     * @param[in] aAddress  The address to remove.
+     *
+     */
+    void Remove(const Ip6Address &aAddress);
+
+    /**
+     * This method indicates whether any inserted prefix covers an address.
+     *
+     * @param[in] aAddress  The address to look up.
+     *
+     * @returns Whether @p aAddress falls within at least one inserted prefix.
+     *
+     */
+    bool Contains(const Ip6Address &aAddress) const;
+
+private:
+    enum
+    {
+        kNoChild = 0, ///< The root is never a child, so index 0 marks "no child".
+    };
+
+    struct Node
+    {
+        uint32_t mChildren[2]; ///< Pool indices of the zero-bit and one-bit children.
+        bool     mIsTerminal;  ///< Whether an inserted prefix ends at this node.
+    };
+
+    static uint8_t GetBit(const Ip6Address &aAddress, uint8_t aIndex)
+    {
+        return (aAddress.m8[aIndex >> 3] >> (7 - (aIndex & 7))) & 1;
+    }
+
+    uint32_t AddNode(void);
+
+    std::vector<Node> mNodes; ///< The node pool; the root is at index 0.
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_PREFIX_MATCHER_HPP_
@@ -34,6 +34,7 @@
 #include "common/task_runner.hpp"
 
 #include <algorithm>
+#include <iterator>
 
 #include <fcntl.h>
 #include <unistd.h>
@@ -43,7 +44,8 @@
 namespace otbr {
 
 TaskRunner::TaskRunner(void)
-    : mTaskQueue(DelayedTask::Comparator{})
+    : mWakeupPending(false)
+    , mTimingWheel(Clock::now())
 {
     int flags;
 
@@ -58,6 +60,16 @@ TaskRunner::TaskRunner(void)
 
 TaskRunner::~TaskRunner(void)
 {
+    for (ImmediateTaskQueue &queue : mImmediateQueues)
+    {
+        ImmediateTaskNode *node;
+
+        while ((node = queue.Pop()) != nullptr)
+        {
+            delete node;
+        }
+    }
+
     if (mEventFd[kRead] != -1)
     {
         close(mEventFd[kRead]);
@@ -72,7 +84,17 @@ TaskRunner::~TaskRunner(void)
 
 void TaskRunner::Post(Task<void> aTask)
 {
-    Post(Milliseconds::zero(), std::move(aTask));
+    Post(Priority::kNormal, std::move(aTask));
+}
+
+void TaskRunner::Post(Priority aPriority, Task<void> aTask)
+{
+    ImmediateTaskNode *node = new ImmediateTaskNode();
+
+    node->mTask = std::move(aTask);
+
+    mImmediateQueues[static_cast<uint8_t>(aPriority)].Push(node);
+    TriggerWakeup();
 }
 
 TaskRunner::TaskId TaskRunner::Post(Milliseconds aDelay, Task<void> aTask)
@@ -87,15 +109,18 @@ void TaskRunner::Update(MainloopContext &aMainloop)
 
     {
         std::lock_guard<std::mutex> _(mTaskQueueMutex);
+        Timepoint                   deadline;
 
-        if (!mTaskQueue.empty())
+        if (mTimingWheel.GetNextDeadline(deadline))
         {
-            auto  now     = Clock::now();
-            auto &task    = mTaskQueue.top();
-            auto  delay   = std::chrono::duration_cast<Microseconds>(task.GetTimeExecute() - now);
-            auto  timeout = FromTimeval<Microseconds>(aMainloop.mTimeout);
-
-            if (task.GetTimeExecute() < now)
+            // Update() runs on the mainloop thread, so iteration-granularity
+            // time is enough for the deadline math; Post() keeps the real
+            // clock since it may run on any thread.
+            auto now     = CachedClock::Now();
+            auto delay   = std::chrono::duration_cast<Microseconds>(deadline - now);
+            auto timeout = FromTimeval<Microseconds>(aMainloop.mTimeout);
+
+            if (deadline < now)
             {
                 delay = Microseconds::zero();
             }
@@ -126,14 +151,86 @@ void TaskRunner::Process(const MainloopContext &aMainloop)
     // Critical error happens, simply die.
     VerifyOrDie(errno == EAGAIN || errno == EWOULDBLOCK, strerror(errno));
 
+    // Clear the coalescing flag before draining so that a producer posting
+    // from now on triggers a new wakeup and no task is left behind.
+    mWakeupPending.store(false, std::memory_order_release);
+
+    // Expired delayed tasks run first: they are timer completions and are
+    // treated as latency critical.
     PopTasks();
+
+    DrainImmediateTasks();
+}
+
+void TaskRunner::DrainImmediateTasks(void)
+{
+    ImmediateTaskQueue &latencyQueue = mImmediateQueues[static_cast<uint8_t>(Priority::kLatencyCritical)];
+    ImmediateTaskQueue &normalQueue  = mImmediateQueues[static_cast<uint8_t>(Priority::kNormal)];
+    ImmediateTaskQueue &bulkQueue    = mImmediateQueues[static_cast<uint8_t>(Priority::kBulk)];
+    Timepoint           bulkStop     = Clock::now() + Milliseconds(kBulkTimeBudgetMs);
+    uint32_t            normalCredit = kNormalDrainWeight;
+    uint32_t            bulkCredit   = kBulkDrainWeight;
+    bool                bulkDeferred = false;
+    ImmediateTaskNode * node;
+
+    auto run = [](ImmediateTaskNode *aNode) {
+        aNode->mTask();
+        delete aNode;
+    };
+
+    while (true)
+    {
+        // The latency-critical queue is re-checked before every task so that
+        // nothing queued behind normal or bulk work delays it by more than
+        // one task execution.
+        if ((node = latencyQueue.Pop()) != nullptr)
+        {
+            run(node);
+            continue;
+        }
+
+        if (normalCredit > 0 && (node = normalQueue.Pop()) != nullptr)
+        {
+            normalCredit--;
+            run(node);
+            continue;
+        }
+
+        if (!bulkDeferred && bulkCredit > 0 && (node = bulkQueue.Pop()) != nullptr)
+        {
+            bulkCredit--;
+            run(node);
+
+            if (Clock::now() >= bulkStop)
+            {
+                bulkDeferred = true;
+            }
+            continue;
+        }
+
+        // The weighted round is over. Exit when it ran nothing; otherwise
+        // grant fresh credits and go around again.
+        if (normalCredit == kNormalDrainWeight && bulkCredit == kBulkDrainWeight)
+        {
+            break;
+        }
+
+        normalCredit = kNormalDrainWeight;
+        bulkCredit   = kBulkDrainWeight;
+    }
+
+    if (bulkDeferred)
+    {
+        // Bulk work exhausted its time budget for this cycle; re-arm the
+        // wakeup so any remaining bulk tasks run on the next cycle, after
+        // the other processors had their turn.
+        TriggerWakeup();
+    }
 }
 
 TaskRunner::TaskId TaskRunner::PushTask(Milliseconds aDelay, Task<void> aTask)
 {
-    ssize_t       rval;
-    const uint8_t kOne = 1;
-    TaskId        taskId;
+    TaskId taskId;
 
     {
         std::lock_guard<std::mutex> _(mTaskQueueMutex);
@@ -141,9 +238,23 @@ TaskRunner::TaskId TaskRunner::PushTask(Milliseconds aDelay, Task<void> aTask)
         taskId = mNextTaskId++;
 
         mActiveTaskIds.insert(taskId);
-        mTaskQueue.emplace(taskId, aDelay, std::move(aTask));
+        mTimingWheel.Insert(DelayedTask(taskId, aDelay, std::move(aTask)));
     }
 
+    TriggerWakeup();
+
+    return taskId;
+}
+
+void TaskRunner::TriggerWakeup(void)
+{
+    ssize_t       rval;
+    const uint8_t kOne = 1;
+
+    // Coalesce wakeups: a burst of posts only writes the pipe once until
+    // the mainloop thread consumes the pending wakeup in `Process()`.
+    VerifyOrExit(!mWakeupPending.exchange(true, std::memory_order_acq_rel));
+
     do
     {
         rval = write(mEventFd[kWrite], &kOne, sizeof(kOne));
@@ -159,7 +270,53 @@ TaskRunner::TaskId TaskRunner::PushTask(Milliseconds aDelay, Task<void> aTask)
     otbrLogWarning("Failed to write fd %d: %s", mEventFd[kWrite], strerror(errno));
 
 exit:
-    return taskId;
+    return;
+}
+
+void TaskRunner::ImmediateTaskQueue::Push(ImmediateTaskNode *aNode)
+{
+    ImmediateTaskNode *prev;
+
+    aNode->mNext.store(nullptr, std::memory_order_relaxed);
+    prev = mHead.exchange(aNode, std::memory_order_acq_rel);
+    prev->mNext.store(aNode, std::memory_order_release);
+}
+
+TaskRunner::ImmediateTaskNode *TaskRunner::ImmediateTaskQueue::Pop(void)
+{
+    ImmediateTaskNode *tail = mTail;
+    ImmediateTaskNode *next = tail->mNext.load(std::memory_order_acquire);
+    ImmediateTaskNode *node = nullptr;
+
+    if (tail == &mStub)
+    {
+        VerifyOrExit(next != nullptr);
+
+        mTail = next;
+        tail  = next;
+        next  = tail->mNext.load(std::memory_order_acquire);
+    }
+
+    if (next != nullptr)
+    {
+        mTail = next;
+        ExitNow(node = tail);
+    }
+
+    // A producer has exchanged the head but not yet linked its node. Leave
+    // the tasks for the wakeup that producer is going to trigger.
+    VerifyOrExit(mHead.load(std::memory_order_acquire) == tail);
+
+    Push(&mStub);
+
+    next = tail->mNext.load(std::memory_order_acquire);
+    VerifyOrExit(next != nullptr);
+
+    mTail = next;
+    node  = tail;
+
+exit:
+    return node;
 }
 
 void TaskRunner::Cancel(TaskRunner::TaskId aTaskId)
@@ -171,35 +328,228 @@ void TaskRunner::Cancel(TaskRunner::TaskId aTaskId)
 
 void TaskRunner::PopTasks(void)
 {
-    while (true)
+    std::vector<DelayedTask> expiredTasks;
+
+    // The braces here are necessary for auto-releasing of the mutex.
+    {
+        std::lock_guard<std::mutex> _(mTaskQueueMutex);
+
+        mTimingWheel.Advance(CachedClock::Now(), expiredTasks);
+    }
+
+    for (DelayedTask &expiredTask : expiredTasks)
     {
-        Task<void> task;
-        bool       canceled;
+        bool canceled;
 
-        // The braces here are necessary for auto-releasing of the mutex.
+        // Re-acquire the mutex per task so that an expired task can still
+        // cancel a task that expired in the same batch.
         {
             std::lock_guard<std::mutex> _(mTaskQueueMutex);
 
-            if (!mTaskQueue.empty() && mTaskQueue.top().GetTimeExecute() <= Clock::now())
+            canceled = (mActiveTaskIds.erase(expiredTask.mTaskId) == 0);
+        }
+
+        if (!canceled)
+        {
+            expiredTask.mTask();
+        }
+    }
+}
+
+TaskRunner::TimingWheel::TimingWheel(Timepoint aNow)
+    : mEpoch(aNow)
+    , mCurrentTick(0)
+{
+}
+
+uint64_t TaskRunner::TimingWheel::TickOf(Timepoint aTime) const
+{
+    Milliseconds elapsed = std::chrono::duration_cast<Milliseconds>(aTime - mEpoch);
+
+    return (aTime <= mEpoch) ? 0 : static_cast<uint64_t>(elapsed.count()) / kTickDuration;
+}
+
+void TaskRunner::TimingWheel::Insert(DelayedTask aTask)
+{
+    uint64_t deadlineTick = TickOf(aTask.mDeadline);
+    uint64_t delta;
+    uint8_t  level;
+
+    if (deadlineTick <= mCurrentTick)
+    {
+        // The task is due within the current tick. Keep it aside so that
+        // it is matched by its exact deadline and never fires early.
+        mImminentTasks.push_back(std::move(aTask));
+        ExitNow();
+    }
+
+    delta = deadlineTick - mCurrentTick;
+
+    for (level = 0; level < kNumLevels; level++)
+    {
+        if ((delta >> (kLevelBits * (level + 1))) == 0)
+        {
+            uint16_t slot = (deadlineTick >> (kLevelBits * level)) & (kSlotsPerLevel - 1);
+
+            mLevels[level].mSlots[slot].push_back(std::move(aTask));
+            mLevels[level].mOccupancy |= (UINT64_C(1) << slot);
+            break;
+        }
+    }
+
+    if (level == kNumLevels)
+    {
+        mOverflowTasks.push_back(std::move(aTask));
+    }
+
+exit:
+    return;
+}
+
+void TaskRunner::TimingWheel::Place(DelayedTask aTask, Timepoint aNow, std::vector<DelayedTask> &aExpiredTasks)
+{
+    if (aTask.mDeadline <= aNow)
+    {
+        aExpiredTasks.push_back(std::move(aTask));
+    }
+    else
+    {
+        Insert(std::move(aTask));
+    }
+}
+
+void TaskRunner::TimingWheel::Advance(Timepoint aNow, std::vector<DelayedTask> &aExpiredTasks)
+{
+    uint64_t                 targetTick = TickOf(aNow);
+    std::vector<DelayedTask> pendingTasks;
+
+    for (auto it = mImminentTasks.begin(); it != mImminentTasks.end();)
+    {
+        if (it->mDeadline <= aNow)
+        {
+            aExpiredTasks.push_back(std::move(*it));
+            it = mImminentTasks.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    VerifyOrExit(targetTick > mCurrentTick);
+
+    // Drain every slot the wheel hands pass. Draining is allowed to be
+    // eager: `Place()` re-checks the deadline of every drained task and
+    // re-inserts the ones that are not due yet into a lower level.
+    for (uint8_t level = 0; level < kNumLevels; level++)
+    {
+        uint64_t startSlotCount = mCurrentTick >> (kLevelBits * level);
+        uint64_t endSlotCount   = targetTick >> (kLevelBits * level);
+        uint64_t numPassed      = std::min<uint64_t>(endSlotCount - startSlotCount, kSlotsPerLevel);
+
+        if (numPassed == 0)
+        {
+            break;
+        }
+
+        for (uint64_t i = 1; i <= numPassed; i++)
+        {
+            uint16_t slot = (startSlotCount + i) & (kSlotsPerLevel - 1);
+
+            if (mLevels[level].mOccupancy & (UINT64_C(1) << slot))
             {
-                const DelayedTask &top    = mTaskQueue.top();
-                TaskId             taskId = top.mTaskId;
+                std::vector<DelayedTask> &tasks = mLevels[level].mSlots[slot];
 
-                task = std::move(top.mTask);
-                mTaskQueue.pop();
-                canceled = (mActiveTaskIds.erase(taskId) == 0);
+                std::move(tasks.begin(), tasks.end(), std::back_inserter(pendingTasks));
+                tasks.clear();
+                mLevels[level].mOccupancy &= ~(UINT64_C(1) << slot);
             }
-            else
+        }
+    }
+
+    // Re-insert the overflow tasks when the last-level hand advanced.
+    if ((targetTick >> (kLevelBits * kNumLevels)) != (mCurrentTick >> (kLevelBits * kNumLevels)) ||
+        (targetTick >> (kLevelBits * (kNumLevels - 1))) != (mCurrentTick >> (kLevelBits * (kNumLevels - 1))))
+    {
+        std::move(mOverflowTasks.begin(), mOverflowTasks.end(), std::back_inserter(pendingTasks));
+        mOverflowTasks.clear();
+    }
+
+    mCurrentTick = targetTick;
+
+    for (DelayedTask &task : pendingTasks)
+    {
+        Place(std::move(task), aNow, aExpiredTasks);
+    }
+
+exit:
+    std::sort(aExpiredTasks.begin(), aExpiredTasks.end());
+}
+
+bool TaskRunner::TimingWheel::GetNextDeadline(Timepoint &aDeadline) const
+{
+    bool     found    = false;
+    uint64_t bestTick = 0;
+
+    for (const DelayedTask &task : mImminentTasks)
+    {
+        if (!found || task.mDeadline < aDeadline)
+        {
+            found     = true;
+            aDeadline = task.mDeadline;
+        }
+    }
+
+    if (found)
+    {
+        // An imminent task is due within the current tick and is always
+        // earlier than anything kept in the wheel slots.
+        ExitNow();
+    }
+
+    for (uint8_t level = 0; level < kNumLevels; level++)
+    {
+        uint64_t slotCount = mCurrentTick >> (kLevelBits * level);
+        uint16_t curSlot   = slotCount & (kSlotsPerLevel - 1);
+
+        if (mLevels[level].mOccupancy == 0)
+        {
+            continue;
+        }
+
+        for (uint16_t distance = 1; distance <= kSlotsPerLevel; distance++)
+        {
+            uint16_t slot = (curSlot + distance) & (kSlotsPerLevel - 1);
+
+            if (mLevels[level].mOccupancy & (UINT64_C(1) << slot))
             {
+                // The slot start is a conservative deadline: tasks in the
+                // slot cannot be due before the hand reaches the slot.
+                uint64_t tick = (slotCount + distance) << (kLevelBits * level);
+
+                if (!found || tick < bestTick)
+                {
+                    found    = true;
+                    bestTick = tick;
+                }
                 break;
             }
         }
+    }
 
-        if (!canceled)
-        {
-            task();
-        }
+    if (!found && !mOverflowTasks.empty())
+    {
+        found    = true;
+        bestTick = ((mCurrentTick >> (kLevelBits * (kNumLevels - 1))) + 1) << (kLevelBits * (kNumLevels - 1));
     }
+
+    if (found)
+    {
+        aDeadline = mEpoch + Milliseconds(bestTick * kTickDuration);
+    }
+
+exit:
+    return found;
 }
 
 } // namespace otbr
@@ -36,13 +36,16 @@
 
 #include <openthread-br/config.h>
 
+#include <atomic>
 #include <chrono>
 #include <functional>
 #include <future>
+#include <list>
 #include <mutex>
-#include <queue>
 #include <set>
+#include <vector>
 
+#include "common/callback.hpp"
 #include "common/code_utils.hpp"
 #include "common/mainloop.hpp"
 #include "common/time.hpp"
@@ -60,8 +63,10 @@ public:
     /**
      * This type represents the generic executable task.
      *
+     * Tasks whose captures fit the inline storage are posted without heap allocation.
+     *
      */
-    template <class T> using Task = std::function<T(void)>;
+    template <class T> using Task = MoveOnlyFunction<T(void)>;
 
     /**
      * This type represents a unique task ID to an delayed task.
@@ -71,6 +76,22 @@ public:
      */
     typedef uint64_t TaskId;
 
+    /**
+     * This enumeration defines the priority classes of immediate tasks.
+     *
+     * Latency-critical tasks always run before the other classes. Normal and
+     * bulk tasks are drained with a fixed weight ratio, and bulk additionally
+     * runs under a per-`Process()` time budget, so heavy background batches
+     * cannot add tail latency to timer-driven work.
+     *
+     */
+    enum class Priority : uint8_t
+    {
+        kLatencyCritical = 0, ///< Runs before the other classes; never throttled.
+        kNormal          = 1, ///< The default class of `Post()`.
+        kBulk            = 2, ///< Heavy background batches; weighted and time budgeted.
+    };
+
     /**
      * This constructor initializes the Task Runner instance.
      *
@@ -86,14 +107,29 @@ public:
     /**
      * This method posts a task to the task runner and returns immediately.
      *
-     * Tasks are executed sequentially and follow the First-Come-First-Serve rule.
-     * It is safe to call this method in different threads concurrently.
+     * The task is posted at normal priority; tasks of the same priority follow the
+     * First-Come-First-Serve rule. It is safe to call this method in different threads
+     * concurrently. The task is enqueued lock-free and concurrent posts share a single
+     * mainloop wakeup.
      *
      * @param[in] aTask  The task to be executed.
      *
      */
     void Post(Task<void> aTask);
 
+    /**
+     * This method posts a task with a given priority class and returns immediately.
+     *
+     * Tasks of the same priority are executed in posting order. See `Priority`
+     * for how the classes are drained against each other. It is safe to call
+     * this method in different threads concurrently.
+     *
+     * @param[in] aPriority  The priority class of the task.
+     * @param[in] aTask      The task to be executed.
+     *
+     */
+    void Post(Priority aPriority, Task<void> aTask);
+
     /**
      * This method posts a task to the task runner and returns immediately.
      *
@@ -148,13 +184,6 @@ private:
 
     struct DelayedTask
     {
-        friend class Comparator;
-
-        struct Comparator
-        {
-            bool operator()(const DelayedTask &aLhs, const DelayedTask &aRhs) const { return aRhs < aLhs; }
-        };
-
         DelayedTask(TaskId aTaskId, Milliseconds aDelay, Task<void> aTask)
             : mTaskId(aTaskId)
             , mDeadline(Clock::now() + aDelay)
@@ -164,7 +193,7 @@ private:
 
         bool operator<(const DelayedTask &aOther) const
         {
-            return mDeadline <= aOther.mDeadline || (mDeadline == aOther.mDeadline && mTaskId < aOther.mTaskId);
+            return mDeadline < aOther.mDeadline || (mDeadline == aOther.mDeadline && mTaskId < aOther.mTaskId);
         }
 
         Timepoint GetTimeExecute(void) const { return mDeadline; }
@@ -174,19 +203,141 @@ private:
         Task<void> mTask;
     };
 
+    /**
+     * This class implements a hierarchical timing wheel that keeps the delayed tasks.
+     *
+     * Tasks are hashed into per-level slots by their deadline so that insertion is O(1)
+     * and expiry touches only the slots the wheel hand actually passes, instead of the
+     * O(log n) heap operations per task of a priority queue. Each level covers 64 times
+     * the span of the level below it; tasks beyond the span of the last level are kept
+     * in an overflow list and are re-inserted when the last-level hand advances.
+     *
+     */
+    class TimingWheel
+    {
+    public:
+        explicit TimingWheel(Timepoint aNow);
+
+        /**
+         * This method inserts a delayed task into the wheel.
+         *
+         * @param[in] aTask  The delayed task to insert.
+         *
+         */
+        void Insert(DelayedTask aTask);
+
+        /**
+         * This method advances the wheel to @p aNow and collects all expired tasks.
+         *
+         * The expired tasks are appended to @p aExpiredTasks in deadline order.
+         *
+         * @param[in]  aNow           The current time.
+         * @param[out] aExpiredTasks  A vector to collect the expired tasks.
+         *
+         */
+        void Advance(Timepoint aNow, std::vector<DelayedTask> &aExpiredTasks);
+
+        /**
+         * This method returns the earliest time the wheel needs to be advanced at.
+         *
+         * The returned deadline is conservative: it is never later than the earliest
+         * task deadline, but may be earlier for tasks kept in higher wheel levels.
+         *
+         * @param[out] aDeadline  A reference to output the earliest deadline.
+         *
+         * @returns Whether there is any pending task in the wheel.
+         *
+         */
+        bool GetNextDeadline(Timepoint &aDeadline) const;
+
+    private:
+        static constexpr uint8_t  kLevelBits     = 6;
+        static constexpr uint8_t  kNumLevels     = 4;
+        static constexpr uint16_t kSlotsPerLevel = 1 << kLevelBits;
+        static constexpr uint32_t kTickDuration  = 1; ///< In milliseconds.
+
+        struct Level
+        {
+            std::vector<DelayedTask> mSlots[kSlotsPerLevel];
+            uint64_t                 mOccupancy = 0;
+        };
+
+        uint64_t TickOf(Timepoint aTime) const;
+        void     Place(DelayedTask aTask, Timepoint aNow, std::vector<DelayedTask> &aExpiredTasks);
+
+        Timepoint              mEpoch;
+        uint64_t               mCurrentTick;
+        Level                  mLevels[kNumLevels];
+        std::list<DelayedTask> mImminentTasks; ///< Tasks due within the current tick, checked by exact deadline.
+        std::list<DelayedTask> mOverflowTasks;
+    };
+
+    /**
+     * This type represents a node of the lock-free MPSC queue of immediate tasks.
+     *
+     * The queue follows Vyukov's intrusive MPSC design: producers exchange the
+     * head pointer and link their node, the single consumer (the mainloop
+     * thread) chases the tail through a stub node.
+     *
+     */
+    struct ImmediateTaskNode
+    {
+        std::atomic<ImmediateTaskNode *> mNext{nullptr};
+        Task<void>                       mTask;
+    };
+
+    /**
+     * This type represents one lock-free MPSC queue of immediate tasks; each
+     * priority class owns one instance.
+     *
+     */
+    struct ImmediateTaskQueue
+    {
+        ImmediateTaskQueue(void)
+            : mHead(&mStub)
+            , mTail(&mStub)
+        {
+        }
+
+        void               Push(ImmediateTaskNode *aNode);
+        ImmediateTaskNode *Pop(void);
+
+        std::atomic<ImmediateTaskNode *> mHead;
+        ImmediateTaskNode *              mTail;
+        ImmediateTaskNode                mStub;
+    };
+
+    static constexpr uint8_t kNumPriorities = 3;
+
+    // Per weighted round, up to `kNormalDrainWeight` normal tasks run for
+    // every `kBulkDrainWeight` bulk task; bulk additionally stops for the
+    // cycle once it has consumed `kBulkTimeBudgetMs` of wall time.
+    static constexpr uint32_t kNormalDrainWeight = 4;
+    static constexpr uint32_t kBulkDrainWeight   = 1;
+    static constexpr uint32_t kBulkTimeBudgetMs  = 5;
+
     TaskId PushTask(Milliseconds aDelay, Task<void> aTask);
     void   PopTasks(void);
 
+    void DrainImmediateTasks(void);
+    void TriggerWakeup(void);
+
     // The event fds which are used to wakeup the mainloop
     // when there are pending tasks in the task queue.
     int mEventFd[2];
 
-    std::priority_queue<DelayedTask, std::vector<DelayedTask>, DelayedTask::Comparator> mTaskQueue;
+    ImmediateTaskQueue mImmediateQueues[kNumPriorities];
+
+    // Whether a wakeup has been written to the event fd and not yet
+    // consumed; used to coalesce a burst of posts into one write().
+    std::atomic<bool> mWakeupPending;
+
+    TimingWheel mTimingWheel;
 
     std::set<TaskId> mActiveTaskIds;
     TaskId           mNextTaskId = 1;
 
-    // The mutex which protects the `mTaskQueue` from being
+    // The mutex which protects the `mTimingWheel` from being
     // simultaneously accessed by multiple threads.
     std::mutex mTaskQueueMutex;
 };
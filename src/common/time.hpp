@@ -50,6 +50,44 @@ using Microseconds = std::chrono::microseconds;
 using Clock        = std::chrono::steady_clock;
 using Timepoint    = Clock::time_point;
 
+/**
+ * This class provides a timestamp cache with mainloop-iteration granularity.
+ *
+ * `Application::Run()` refreshes the cache whenever the mainloop wakes, so
+ * hot paths that only need cycle-granularity time (timeout checks, latency
+ * accounting, cache-expiry tests) read the stored value instead of issuing
+ * a clock_gettime call each. The cache is for the mainloop thread only;
+ * until the first refresh, `Now()` falls back to the real clock, so code
+ * shared with tools and tests keeps working unchanged.
+ *
+ */
+class CachedClock
+{
+public:
+    /**
+     * This method returns the cached timestamp, or the real clock before the first refresh.
+     *
+     * @returns The cached time point.
+     *
+     */
+    static Timepoint Now(void) { return sCachedNow.time_since_epoch().count() != 0 ? sCachedNow : Clock::now(); }
+
+    /**
+     * This method refreshes the cache from the real clock.
+     *
+     * @returns The refreshed time point.
+     *
+     */
+    static Timepoint Refresh(void)
+    {
+        sCachedNow = Clock::now();
+        return sCachedNow;
+    }
+
+private:
+    static Timepoint sCachedNow;
+};
+
 template <class D> D FromTimeval(const timeval &aTime)
 {
     return std::chrono::duration_cast<D>(Microseconds{aTime.tv_usec}) +
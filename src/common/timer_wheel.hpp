@@ -0,0 +1,248 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definition of a hashed timing wheel.
+ */
+
+#ifndef OTBR_COMMON_TIMER_WHEEL_HPP_
+#define OTBR_COMMON_TIMER_WHEEL_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <list>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "common/code_utils.hpp"
+#include "common/time.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements a hashed timing wheel tracking one deadline per item.
+ *
+ * Items are hashed into fixed-width slots by their deadline, so scheduling,
+ * rescheduling and cancellation are O(1), and a sweep visits only the slots
+ * that elapsed since the previous sweep — O(expired) rather than O(items).
+ *
+ * The horizon (slot width times slot count) must exceed the largest timeout
+ * ever scheduled; every tracked deadline then lies within one lap of the
+ * cursor, so the first occupied slot ahead of the cursor holds the next
+ * deadline. The wheel is not thread safe; it is meant for mainloop-thread
+ * items.
+ *
+ */
+template <typename Item> class TimerWheel : private NonCopyable
+{
+public:
+    /**
+     * This constructor initializes an empty wheel.
+     *
+     * @param[in] aSlotWidthMs  The width of one slot (in milliseconds).
+     * @param[in] aSlotCount    The number of slots in the wheel.
+     *
+     */
+    TimerWheel(uint32_t aSlotWidthMs, size_t aSlotCount)
+        : mSlotWidthMs(aSlotWidthMs)
+        , mSlots(aSlotCount)
+        , mCursorTick(TickOf(Clock::now()))
+        , mCount(0)
+    {
+    }
+
+    /**
+     * This method schedules or reschedules the deadline of an item.
+     *
+     * @param[in] aItem      The item to track.
+     * @param[in] aDeadline  The new deadline of the item.
+     *
+     */
+    void Schedule(Item *aItem, Timepoint aDeadline)
+    {
+        // A deadline already in the past lands in the cursor slot so the
+        // next sweep fires it; a slot behind the cursor would only be
+        // reached after a full lap.
+        uint64_t tick = TickOf(aDeadline);
+        size_t   slot;
+
+        Remove(aItem);
+
+        if (tick < mCursorTick)
+        {
+            tick = mCursorTick;
+        }
+        slot = static_cast<size_t>(tick % mSlots.size());
+
+        mSlots[slot].emplace_front(aItem, aDeadline);
+        mEntries[aItem] = std::make_pair(slot, mSlots[slot].begin());
+        mCount++;
+    }
+
+    /**
+     * This method stops tracking an item; unknown items are ignored.
+     *
+     * @param[in] aItem  The item to stop tracking.
+     *
+     */
+    void Remove(Item *aItem)
+    {
+        auto it = mEntries.find(aItem);
+
+        VerifyOrExit(it != mEntries.end());
+
+        mSlots[it->second.first].erase(it->second.second);
+        mEntries.erase(it);
+        mCount--;
+
+    exit:
+        return;
+    }
+
+    /**
+     * This method advances the cursor to @p aNow and hands every item whose
+     * deadline passed to @p aHandler, after dropping it from the wheel.
+     *
+     * The handler may freely call `Schedule()` or `Remove()`, including for
+     * the item it is handed.
+     *
+     * @param[in] aNow      The current time.
+     * @param[in] aHandler  The callable invoked as `aHandler(Item &)`.
+     *
+     */
+    template <typename Handler> void Advance(Timepoint aNow, Handler aHandler)
+    {
+        std::vector<Item *> expired;
+        uint64_t            targetTick = TickOf(aNow);
+        uint64_t            steps      = targetTick - mCursorTick;
+
+        VerifyOrExit(mCount > 0, mCursorTick = targetTick);
+
+        // One full lap covers every slot; a cursor further behind than that
+        // (a long idle stretch) has nothing extra to visit. The loop below
+        // includes both endpoints, so the lap is capped one short of the slot
+        // count to keep the cursor slot from being scanned twice.
+        if (steps > mSlots.size() - 1)
+        {
+            steps = mSlots.size() - 1;
+        }
+
+        for (uint64_t i = 0; i <= steps; i++)
+        {
+            for (const auto &entry : mSlots[(mCursorTick + i) % mSlots.size()])
+            {
+                if (entry.second <= aNow)
+                {
+                    expired.push_back(entry.first);
+                }
+            }
+        }
+
+        mCursorTick = targetTick;
+
+        for (Item *item : expired)
+        {
+            // An earlier handler in this batch may have removed (and possibly
+            // freed) the item; only items still tracked are dispatched.
+            if (mEntries.find(item) == mEntries.end())
+            {
+                continue;
+            }
+
+            Remove(item);
+            aHandler(*item);
+        }
+
+    exit:
+        return;
+    }
+
+    /**
+     * This method returns the earliest tracked deadline.
+     *
+     * @returns The earliest deadline, or `Timepoint::max()` when the wheel
+     *          is empty.
+     *
+     */
+    Timepoint GetNextDeadline(void) const
+    {
+        Timepoint next = Timepoint::max();
+
+        VerifyOrExit(mCount > 0);
+
+        for (size_t i = 0; i < mSlots.size(); i++)
+        {
+            const Slot &slot = mSlots[(mCursorTick + i) % mSlots.size()];
+
+            if (slot.empty())
+            {
+                continue;
+            }
+
+            for (const auto &entry : slot)
+            {
+                next = std::min(next, entry.second);
+            }
+            break;
+        }
+
+    exit:
+        return next;
+    }
+
+    /**
+     * This method returns the number of tracked items.
+     *
+     * @returns The tracked item count.
+     *
+     */
+    size_t GetCount(void) const { return mCount; }
+
+private:
+    using Slot = std::list<std::pair<Item *, Timepoint>>;
+
+    uint64_t TickOf(Timepoint aTime) const
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<Milliseconds>(aTime.time_since_epoch()).count()) /
+               mSlotWidthMs;
+    }
+
+    uint64_t                                                              mSlotWidthMs;
+    std::vector<Slot>                                                     mSlots;
+    uint64_t                                                              mCursorTick;
+    size_t                                                                mCount;
+    std::unordered_map<Item *, std::pair<size_t, typename Slot::iterator>> mEntries;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_TIMER_WHEEL_HPP_
@@ -39,6 +39,8 @@
 #include <stdint.h>
 #include <string.h>
 
+#include "common/byteswap.hpp"
+
 namespace otbr {
 
 /**
@@ -75,7 +77,21 @@ public:
      */
     uint16_t GetLength(void) const
     {
-        return (mLength != kLengthEscape ? mLength : static_cast<uint16_t>((&mLength)[1] << 8 | (&mLength)[2]));
+        return (mLength != kLengthEscape ? mLength : LoadBigEndian16(&mLength + 1));
+    }
+
+    /**
+     * This method returns the size of the Tlv header (the type and length fields).
+     *
+     * Only the first two bytes of the Tlv are read, so the method is safe to
+     * call once `sizeof(Tlv)` bytes are known to be in bounds.
+     *
+     * @returns The header size, in bytes.
+     *
+     */
+    size_t GetHeaderSize(void) const
+    {
+        return sizeof(mType) + (mLength != kLengthEscape ? sizeof(mLength) : (sizeof(uint16_t) + sizeof(mLength)));
     }
 
     /**
@@ -85,9 +101,8 @@ public:
     {
         if (aLength >= kLengthEscape || aForceExtended)
         {
-            mLength       = kLengthEscape;
-            (&mLength)[1] = (aLength >> 8);
-            (&mLength)[2] = (aLength & 0xff);
+            mLength = kLengthEscape;
+            StoreBigEndian16(&mLength + 1, aLength);
         }
         else
         {
@@ -115,9 +130,7 @@ public:
      */
     uint16_t GetValueUInt16(void) const
     {
-        const uint8_t *p = static_cast<const uint8_t *>(GetValue());
-
-        return static_cast<uint16_t>(p[0] << 8 | p[1]);
+        return LoadBigEndian16(GetValue());
     }
 
     /**
@@ -136,14 +149,8 @@ public:
      */
     void SetValue(uint64_t aValue)
     {
-        uint8_t *value;
-
         SetLength(sizeof(aValue), false);
-        value = static_cast<uint8_t *>(GetValue());
-        for (int i = 0; i < int{sizeof(aValue)}; ++i)
-        {
-            value[i] = (aValue >> (8 * (sizeof(aValue) - i - 1))) & 0xff;
-        }
+        StoreBigEndian64(GetValue(), aValue);
     }
 
     /**
@@ -154,14 +161,8 @@ public:
      */
     void SetValue(uint32_t aValue)
     {
-        uint8_t *value;
-
         SetLength(sizeof(aValue), false);
-        value = static_cast<uint8_t *>(GetValue());
-        for (int i = 0; i < int{sizeof(aValue)}; ++i)
-        {
-            value[i] = (aValue >> (8 * (sizeof(aValue) - i - 1))) & 0xff;
-        }
+        StoreBigEndian32(GetValue(), aValue);
     }
 
     /**
@@ -172,12 +173,8 @@ public:
      */
     void SetValue(uint16_t aValue)
     {
-        uint8_t *value;
-
         SetLength(sizeof(aValue), false);
-        value    = static_cast<uint8_t *>(GetValue());
-        value[0] = (aValue >> 8);
-        value[1] = (aValue & 0xff);
+        StoreBigEndian16(GetValue(), aValue);
     }
 
     /**
@@ -242,6 +239,171 @@ private:
     uint8_t mLength;
 };
 
+/**
+ * This class represents a non-owning, bounds-checked view over a buffer of Tlvs.
+ *
+ * The range iterates the Tlvs in place without copying the buffer. A Tlv whose
+ * header or value would run past the end of the buffer terminates the
+ * iteration, so callers can iterate untrusted buffers without per-step size
+ * checks of their own.
+ *
+ */
+class TlvRange
+{
+public:
+    /**
+     * This class implements a forward iterator over the Tlvs of a `TlvRange`.
+     *
+     */
+    class Iterator
+    {
+    public:
+        const Tlv &operator*(void) const { return *reinterpret_cast<const Tlv *>(mPosition); }
+        const Tlv *operator->(void) const { return reinterpret_cast<const Tlv *>(mPosition); }
+
+        Iterator &operator++(void)
+        {
+            mPosition = reinterpret_cast<const uint8_t *>(operator->()->GetNext());
+            Validate();
+            return *this;
+        }
+
+        bool operator==(const Iterator &aOther) const { return mPosition == aOther.mPosition; }
+        bool operator!=(const Iterator &aOther) const { return mPosition != aOther.mPosition; }
+
+    private:
+        Iterator(const uint8_t *aPosition, const uint8_t *aEnd)
+            : mPosition(aPosition)
+            , mEnd(aEnd)
+        {
+            Validate();
+        }
+
+        // Stops the iteration when the remaining bytes cannot hold the
+        // current Tlv's header and value. The full header — four bytes for
+        // an extended-length Tlv — must be in bounds before `GetNext()` is
+        // called, since `GetNext()` reads the two extra length bytes.
+        void Validate(void)
+        {
+            const Tlv *tlv = reinterpret_cast<const Tlv *>(mPosition);
+
+            if (mPosition + sizeof(Tlv) > mEnd || mPosition + tlv->GetHeaderSize() > mEnd ||
+                reinterpret_cast<const uint8_t *>(tlv->GetNext()) > mEnd)
+            {
+                mPosition = mEnd;
+            }
+        }
+
+        const uint8_t *mPosition;
+        const uint8_t *mEnd;
+
+        friend class TlvRange;
+    };
+
+    /**
+     * This constructor initializes the range with a raw Tlv buffer.
+     *
+     * The buffer is not copied and must outlive the range.
+     *
+     * @param[in] aBuffer  A pointer to the Tlv buffer.
+     * @param[in] aLength  The length of the Tlv buffer, in bytes.
+     *
+     */
+    TlvRange(const void *aBuffer, size_t aLength)
+        : mBegin(static_cast<const uint8_t *>(aBuffer))
+        , mEnd(mBegin + aLength)
+    {
+    }
+
+    Iterator begin(void) const { return Iterator(mBegin, mEnd); }
+    Iterator end(void) const { return Iterator(mEnd, mEnd); }
+
+    /**
+     * This method finds the first Tlv of a given type in the range.
+     *
+     * @param[in] aType  The Tlv type to find.
+     *
+     * @returns A pointer to the first Tlv of type @p aType, or nullptr if not found.
+     *
+     */
+    const Tlv *FindTlv(uint8_t aType) const
+    {
+        const Tlv *result = nullptr;
+
+        for (const Tlv &tlv : *this)
+        {
+            if (tlv.GetType() == aType)
+            {
+                result = &tlv;
+                break;
+            }
+        }
+
+        return result;
+    }
+
+private:
+    const uint8_t *mBegin;
+    const uint8_t *mEnd;
+};
+
+/**
+ * This class implements a find-by-type index over a Tlv buffer.
+ *
+ * The index records the offset of the first Tlv of each type in a single pass
+ * over the buffer, so repeated type lookups cost O(1) instead of rescanning
+ * the buffer. Like `TlvRange` it does not copy the buffer, which must outlive
+ * the index.
+ *
+ */
+class TlvIndex
+{
+public:
+    /**
+     * This constructor builds the index from a raw Tlv buffer.
+     *
+     * @param[in] aBuffer  A pointer to the Tlv buffer.
+     * @param[in] aLength  The length of the Tlv buffer, in bytes.
+     *
+     */
+    TlvIndex(const void *aBuffer, size_t aLength)
+        : mBuffer(static_cast<const uint8_t *>(aBuffer))
+    {
+        memset(mOffsets, 0xff, sizeof(mOffsets));
+
+        for (const Tlv &tlv : TlvRange(aBuffer, aLength))
+        {
+            if (mOffsets[tlv.GetType()] == kNoOffset)
+            {
+                mOffsets[tlv.GetType()] =
+                    static_cast<uint16_t>(reinterpret_cast<const uint8_t *>(&tlv) - mBuffer);
+            }
+        }
+    }
+
+    /**
+     * This method finds the first Tlv of a given type.
+     *
+     * @param[in] aType  The Tlv type to find.
+     *
+     * @returns A pointer to the first Tlv of type @p aType, or nullptr if not found.
+     *
+     */
+    const Tlv *FindTlv(uint8_t aType) const
+    {
+        return mOffsets[aType] == kNoOffset ? nullptr : reinterpret_cast<const Tlv *>(mBuffer + mOffsets[aType]);
+    }
+
+private:
+    enum
+    {
+        kNoOffset = 0xffff, ///< The type does not occur in the buffer.
+    };
+
+    const uint8_t *mBuffer;
+    uint16_t       mOffsets[256];
+};
+
 namespace Meshcop {
 
 enum
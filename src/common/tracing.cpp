@@ -0,0 +1,116 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define OTBR_LOG_TAG "TRACE"
+
+#include "common/tracing.hpp"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "common/logging.hpp"
+
+namespace otbr {
+
+Tracer &Tracer::GetInstance(void)
+{
+    static Tracer sInstance;
+
+    return sInstance;
+}
+
+uint64_t Tracer::Now(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return static_cast<uint64_t>(now.tv_sec) * 1000000 + static_cast<uint64_t>(now.tv_nsec) / 1000;
+}
+
+void Tracer::Record(const char *aCategory, const char *aName, uint64_t aBeginUs, uint64_t aEndUs)
+{
+    // Claiming the slot is atomic; the event write itself is not. A scrape
+    // racing a concurrent writer may see one torn event, which is acceptable
+    // for a flight recorder.
+    uint64_t slot  = mNextSlot.fetch_add(1, std::memory_order_relaxed);
+    Event &  event = mRing[slot & (kRingSize - 1)];
+
+    event.mCategory = aCategory;
+    event.mName     = aName;
+    event.mBeginUs  = aBeginUs;
+    event.mEndUs    = aEndUs;
+}
+
+otbrError Tracer::DumpJson(const char *aPath) const
+{
+    otbrError error = OTBR_ERROR_NONE;
+    uint64_t  next  = mNextSlot.load(std::memory_order_relaxed);
+    uint64_t  first = next > kRingSize ? next - kRingSize : 0;
+    size_t    count = 0;
+    FILE *    file  = fopen(aPath, "w");
+
+    VerifyOrExit(file != nullptr, error = OTBR_ERROR_ERRNO);
+
+    fputs("{\"traceEvents\":[", file);
+
+    // Oldest to newest, so chrome://tracing shows events in order.
+    for (uint64_t slot = first; slot < next; slot++)
+    {
+        const Event &event = mRing[slot & (kRingSize - 1)];
+
+        fprintf(file,
+                "%s{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%" PRIu64 ",\"dur\":%" PRIu64
+                ",\"pid\":1,\"tid\":1}",
+                count > 0 ? "," : "", event.mName, event.mCategory, event.mBeginUs, event.mEndUs - event.mBeginUs);
+        count++;
+    }
+
+    fputs("]}\n", file);
+
+    VerifyOrExit(fclose(file) == 0, file = nullptr, error = OTBR_ERROR_ERRNO);
+    file = nullptr;
+
+    otbrLogNotice("Dumped %zu trace events to %s", count, aPath);
+
+exit:
+    if (file != nullptr)
+    {
+        fclose(file);
+    }
+
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to dump trace to %s", aPath);
+    }
+
+    return error;
+}
+
+} // namespace otbr
@@ -0,0 +1,180 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions of a flight-recorder trace ring buffer.
+ */
+
+#ifndef OTBR_COMMON_TRACING_HPP_
+#define OTBR_COMMON_TRACING_HPP_
+
+#include "openthread-br/config.h"
+
+#include <atomic>
+#include <vector>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "common/code_utils.hpp"
+#include "common/types.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements an always-compiled-in, branch-gated trace ring buffer.
+ *
+ * Scoped trace events record begin/end timestamps of interesting activity into
+ * a fixed-size ring; when tracing is disabled the per-scope cost is a relaxed
+ * atomic load and a branch. The ring can be dumped at any time as Chrome
+ * trace-event JSON (loadable in chrome://tracing or Perfetto), covering the
+ * most recent events.
+ *
+ * Category and name strings must be string literals (or otherwise outlive the
+ * tracer); only the pointers are recorded.
+ *
+ */
+class Tracer : private NonCopyable
+{
+public:
+    /**
+     * This class records one trace event covering its own lifetime.
+     *
+     */
+    class Scope : private NonCopyable
+    {
+    public:
+        /**
+         * This constructor starts a scoped trace event.
+         *
+         * @param[in] aCategory  The event category; must be a string literal.
+         * @param[in] aName      The event name; must be a string literal.
+         *
+         */
+        Scope(const char *aCategory, const char *aName)
+            : mArmed(Tracer::GetInstance().IsEnabled())
+            , mCategory(aCategory)
+            , mName(aName)
+            , mBeginUs(mArmed ? Tracer::Now() : 0)
+        {
+        }
+
+        ~Scope(void)
+        {
+            if (mArmed)
+            {
+                Tracer::GetInstance().Record(mCategory, mName, mBeginUs, Tracer::Now());
+            }
+        }
+
+    private:
+        bool        mArmed;
+        const char *mCategory;
+        const char *mName;
+        uint64_t    mBeginUs;
+    };
+
+    /**
+     * This method returns the process-wide tracer.
+     *
+     * @returns A reference to the tracer singleton.
+     *
+     */
+    static Tracer &GetInstance(void);
+
+    /**
+     * This method indicates whether tracing is currently enabled.
+     *
+     * @returns Whether tracing is enabled.
+     *
+     */
+    bool IsEnabled(void) const { return mEnabled.load(std::memory_order_relaxed); }
+
+    /**
+     * This method enables or disables tracing.
+     *
+     * @param[in] aEnabled  Whether to enable tracing.
+     *
+     */
+    void SetEnabled(bool aEnabled) { mEnabled.store(aEnabled, std::memory_order_relaxed); }
+
+    /**
+     * This method records one completed trace event into the ring.
+     *
+     * @param[in] aCategory  The event category; must be a string literal.
+     * @param[in] aName      The event name; must be a string literal.
+     * @param[in] aBeginUs   The begin timestamp, in microseconds.
+     * @param[in] aEndUs     The end timestamp, in microseconds.
+     *
+     */
+    void Record(const char *aCategory, const char *aName, uint64_t aBeginUs, uint64_t aEndUs);
+
+    /**
+     * This method dumps the ring as Chrome trace-event JSON.
+     *
+     * @param[in] aPath  The path of the file to write.
+     *
+     * @retval OTBR_ERROR_NONE   Successfully dumped the trace.
+     * @retval OTBR_ERROR_ERRNO  Failed to write the file.
+     *
+     */
+    otbrError DumpJson(const char *aPath) const;
+
+    /**
+     * This method returns the current monotonic time in microseconds.
+     *
+     * @returns The monotonic timestamp in microseconds.
+     *
+     */
+    static uint64_t Now(void);
+
+private:
+    struct Event
+    {
+        const char *mCategory;
+        const char *mName;
+        uint64_t    mBeginUs;
+        uint64_t    mEndUs;
+    };
+
+    static constexpr size_t kRingSize = 4096; ///< Number of retained events; must be a power of two.
+
+    Tracer(void)
+        : mRing(kRingSize)
+    {
+    }
+
+    std::vector<Event>    mRing;
+    std::atomic<uint64_t> mNextSlot{0};
+    std::atomic<bool>     mEnabled{false};
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_TRACING_HPP_
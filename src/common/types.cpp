@@ -27,7 +27,7 @@
  */
 
 #include <arpa/inet.h>
-#include <sstream>
+#include <stdio.h>
 #include <sys/socket.h>
 
 #include "common/code_utils.hpp"
@@ -43,14 +43,124 @@ Ip6Address::Ip6Address(const uint8_t (&aAddress)[16])
 
 std::string Ip6Address::ToString() const
 {
-    char strbuf[INET6_ADDRSTRLEN];
+    char strbuf[kStringSize];
 
-    VerifyOrDie(inet_ntop(AF_INET6, this->m8, strbuf, sizeof(strbuf)) != nullptr,
-                "Failed to convert Ip6 address to string");
+    ToString(strbuf, sizeof(strbuf));
 
     return std::string(strbuf);
 }
 
+size_t Ip6Address::ToString(char *aBuffer, size_t aSize) const
+{
+    static const char kHexChars[]  = "0123456789abcdef";
+    int               bestBase     = -1;
+    int               bestLength   = 0;
+    int               curBase      = -1;
+    int               curLength    = 0;
+    char *            cur          = aBuffer;
+    uint16_t          words[8];
+
+    VerifyOrDie(aSize >= kStringSize, "Ip6 address string buffer is too small");
+
+    for (int i = 0; i < 8; i++)
+    {
+        words[i] = static_cast<uint16_t>((m8[2 * i] << 8) | m8[2 * i + 1]);
+    }
+
+    // Find the longest run of zero words to compress as "::"; a
+    // single zero word is not compressed, matching `inet_ntop`.
+    for (int i = 0; i < 8; i++)
+    {
+        if (words[i] == 0)
+        {
+            if (curBase == -1)
+            {
+                curBase = i;
+            }
+            curLength = i - curBase + 1;
+
+            if (curLength > bestLength)
+            {
+                bestBase   = curBase;
+                bestLength = curLength;
+            }
+        }
+        else
+        {
+            curBase = -1;
+        }
+    }
+
+    if (bestLength < 2)
+    {
+        bestBase = -1;
+    }
+
+    for (int i = 0; i < 8; i++)
+    {
+        if (bestBase != -1 && i >= bestBase && i < bestBase + bestLength)
+        {
+            if (i == bestBase)
+            {
+                *cur++ = ':';
+            }
+            continue;
+        }
+
+        if (i != 0)
+        {
+            *cur++ = ':';
+        }
+
+        // Encode v4-mapped and v4-compatible addresses in the embedded
+        // IPv4 form, the same way `inet_ntop` does.
+        if (i == 6 && bestBase == 0 &&
+            (bestLength == 6 || (bestLength == 7 && words[7] != 0x0001) || (bestLength == 5 && words[5] == 0xffff)))
+        {
+            for (int j = 12; j < 16; j++)
+            {
+                uint8_t byte = m8[j];
+
+                if (byte >= 100)
+                {
+                    *cur++ = static_cast<char>('0' + byte / 100);
+                }
+                if (byte >= 10)
+                {
+                    *cur++ = static_cast<char>('0' + (byte / 10) % 10);
+                }
+                *cur++ = static_cast<char>('0' + byte % 10);
+
+                if (j != 15)
+                {
+                    *cur++ = '.';
+                }
+            }
+            break;
+        }
+
+        for (int shift = 12; shift >= 0; shift -= 4)
+        {
+            uint8_t nibble = (words[i] >> shift) & 0xf;
+
+            // Skip the leading zero nibbles of the group.
+            if ((words[i] >> shift) != 0 || shift == 0)
+            {
+                *cur++ = kHexChars[nibble];
+            }
+        }
+    }
+
+    if (bestBase != -1 && bestBase + bestLength == 8)
+    {
+        *cur++ = ':';
+    }
+
+    *cur = '\0';
+
+    return static_cast<size_t>(cur - aBuffer);
+}
+
 Ip6Address Ip6Address::ToSolicitedNodeMulticastAddress(void) const
 {
     Ip6Address ma(Ip6Address::GetSolicitedMulticastAddressPrefix());
@@ -111,19 +221,23 @@ void Ip6Prefix::Set(const otIp6Prefix &aPrefix)
 
 std::string Ip6Prefix::ToString() const
 {
-    std::stringbuf strBuilder;
-    char           strbuf[INET6_ADDRSTRLEN];
+    char strbuf[kStringSize];
+
+    ToString(strbuf, sizeof(strbuf));
 
-    VerifyOrDie(inet_ntop(AF_INET6, mPrefix.m8, strbuf, sizeof(strbuf)) != nullptr,
-                "Failed to convert Ip6 prefix to string");
+    return std::string(strbuf);
+}
+
+size_t Ip6Prefix::ToString(char *aBuffer, size_t aSize) const
+{
+    size_t length;
 
-    strBuilder.sputn(strbuf, strlen(strbuf));
-    strBuilder.sputc('/');
+    VerifyOrDie(aSize >= kStringSize, "Ip6 prefix string buffer is too small");
 
-    sprintf(strbuf, "%d", mLength);
-    strBuilder.sputn(strbuf, strlen(strbuf));
+    length = mPrefix.ToString(aBuffer, aSize);
+    length += static_cast<size_t>(snprintf(aBuffer + length, aSize - length, "/%d", mLength));
 
-    return strBuilder.str();
+    return length;
 }
 
 std::string MacAddress::ToString(void) const
@@ -177,6 +177,13 @@ public:
      */
     Ip6Address ToSolicitedNodeMulticastAddress(void) const;
 
+    /**
+     * The buffer size (in bytes, including the terminator) that always fits
+     * the string representation of an Ip6 address.
+     *
+     */
+    static constexpr size_t kStringSize = 46;
+
     /**
      * This method returns the string representation for the Ip6 address.
      *
@@ -185,6 +192,21 @@ public:
      */
     std::string ToString(void) const;
 
+    /**
+     * This method writes the string representation of the Ip6 address into a buffer.
+     *
+     * This variant performs no heap allocation; the output matches `inet_ntop`,
+     * including zero compression and embedded IPv4 forms. @p aSize must be at
+     * least `kStringSize`.
+     *
+     * @param[out] aBuffer  The buffer to write the null-terminated string to.
+     * @param[in]  aSize    The size of @p aBuffer, in bytes.
+     *
+     * @returns The length of the written string, not including the terminator.
+     *
+     */
+    size_t ToString(char *aBuffer, size_t aSize) const;
+
     /**
      * This method indicates whether or not the Ip6 address is the Unspecified Address.
      *
@@ -322,6 +344,13 @@ public:
      */
     void Set(const otIp6Prefix &aPrefix);
 
+    /**
+     * The buffer size (in bytes, including the terminator) that always fits
+     * the string representation of an Ip6 prefix.
+     *
+     */
+    static constexpr size_t kStringSize = Ip6Address::kStringSize + 4;
+
     /**
      * This method returns the string representation for the Ip6 prefix.
      *
@@ -330,6 +359,20 @@ public:
      */
     std::string ToString(void) const;
 
+    /**
+     * This method writes the string representation of the Ip6 prefix into a buffer.
+     *
+     * This variant performs no heap allocation. @p aSize must be at least
+     * `kStringSize`.
+     *
+     * @param[out] aBuffer  The buffer to write the null-terminated string to.
+     * @param[in]  aSize    The size of @p aBuffer, in bytes.
+     *
+     * @returns The length of the written string, not including the terminator.
+     *
+     */
+    size_t ToString(char *aBuffer, size_t aSize) const;
+
     /**
      * This method clears the Ip6 prefix to be unspecified.
      *
@@ -390,6 +433,17 @@ struct MdnsResponseCounters
     uint32_t mUnknownError;   ///< The number of unknown error responses
 };
 
+struct MdnsLatencyHistogram
+{
+    static constexpr uint8_t kBucketCount = 16;
+
+    /**
+     * Per-bucket sample counts. Bucket 0 counts sub-millisecond latencies, bucket i (0 < i < kBucketCount - 1)
+     * counts latencies in [2^(i-1), 2^i) milliseconds and the last bucket counts everything beyond.
+     */
+    uint32_t mBuckets[kBucketCount];
+};
+
 struct MdnsTelemetryInfo
 {
     static constexpr uint32_t kEmaFactorNumerator   = 1;
@@ -408,6 +462,14 @@ struct MdnsTelemetryInfo
     uint32_t mServiceRegistrationEmaLatency; ///< The EMA latency of service registrations in milliseconds
     uint32_t mHostResolutionEmaLatency;      ///< The EMA latency of host resolutions in milliseconds
     uint32_t mServiceResolutionEmaLatency;   ///< The EMA latency of service resolutions in milliseconds
+
+    uint32_t mHostResolutionNegativeCacheHits;    ///< The number of host resolutions answered by the negative cache
+    uint32_t mServiceResolutionNegativeCacheHits; ///< The number of service resolutions answered by the negative cache
+
+    MdnsLatencyHistogram mHostRegistrationLatencyHistogram;    ///< The latency histogram of host registrations
+    MdnsLatencyHistogram mServiceRegistrationLatencyHistogram; ///< The latency histogram of service registrations
+    MdnsLatencyHistogram mHostResolutionLatencyHistogram;      ///< The latency histogram of host resolutions
+    MdnsLatencyHistogram mServiceResolutionLatencyHistogram;   ///< The latency histogram of service resolutions
 };
 
 } // namespace otbr
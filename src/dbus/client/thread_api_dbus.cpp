@@ -85,14 +85,14 @@ ThreadApiDBus::ThreadApiDBus(DBusConnection *aConnection)
     : mInterfaceName("wpan0")
     , mConnection(aConnection)
 {
-    SubscribeDeviceRoleSignal();
+    mPropertyCacheEnabled = SubscribeDeviceRoleSignal() == ClientError::ERROR_NONE;
 }
 
 ThreadApiDBus::ThreadApiDBus(DBusConnection *aConnection, const std::string &aInterfaceName)
     : mInterfaceName(aInterfaceName)
     , mConnection(aConnection)
 {
-    SubscribeDeviceRoleSignal();
+    mPropertyCacheEnabled = SubscribeDeviceRoleSignal() == ClientError::ERROR_NONE;
 }
 
 ClientError ThreadApiDBus::SubscribeDeviceRoleSignal(void)
@@ -126,9 +126,8 @@ DBusHandlerResult ThreadApiDBus::DBusMessageFilter(DBusConnection *aConnection,
     DBusHandlerResult handled = DBUS_HANDLER_RESULT_NOT_YET_HANDLED;
     OTBR_UNUSED_VARIABLE(aConnection);
 
-    DBusMessageIter iter, subIter, dictEntryIter, valIter;
-    std::string     interfaceName, propertyName, val;
-    DeviceRole      role = OTBR_DEVICE_ROLE_DISABLED;
+    DBusMessageIter iter, subIter;
+    std::string     interfaceName;
 
     VerifyOrExit(dbus_message_is_signal(aMessage, DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTIES_CHANGED_SIGNAL));
     VerifyOrExit(dbus_message_iter_init(aMessage, &iter));
@@ -137,21 +136,60 @@ DBusHandlerResult ThreadApiDBus::DBusMessageFilter(DBusConnection *aConnection,
 
     VerifyOrExit(dbus_message_iter_get_arg_type(&iter) == DBUS_TYPE_ARRAY);
     dbus_message_iter_recurse(&iter, &subIter);
-    VerifyOrExit(dbus_message_iter_get_arg_type(&subIter) == DBUS_TYPE_DICT_ENTRY);
-    dbus_message_iter_recurse(&subIter, &dictEntryIter);
-    SuccessOrExit(DBusMessageExtract(&dictEntryIter, propertyName));
-    VerifyOrExit(dbus_message_iter_get_arg_type(&dictEntryIter) == DBUS_TYPE_VARIANT);
-    dbus_message_iter_recurse(&dictEntryIter, &valIter);
-    SuccessOrExit(DBusMessageExtract(&valIter, val));
 
-    VerifyOrExit(propertyName == OTBR_DBUS_PROPERTY_DEVICE_ROLE);
-    SuccessOrExit(NameToDeviceRole(val, role));
-
-    for (const auto &f : mDeviceRoleHandlers)
+    // Walk every changed property and refresh the local cache, so the
+    // matching getters can be served without a round trip afterwards.
+    while (dbus_message_iter_get_arg_type(&subIter) == DBUS_TYPE_DICT_ENTRY)
     {
-        f(role);
+        DBusMessageIter dictEntryIter;
+        DBusMessageIter valIter;
+        std::string     propertyName;
+
+        dbus_message_iter_recurse(&subIter, &dictEntryIter);
+        dbus_message_iter_next(&subIter);
+
+        if (DBusMessageExtract(&dictEntryIter, propertyName) != OTBR_ERROR_NONE ||
+            dbus_message_iter_get_arg_type(&dictEntryIter) != DBUS_TYPE_VARIANT)
+        {
+            continue;
+        }
+        dbus_message_iter_recurse(&dictEntryIter, &valIter);
+
+        if (propertyName == OTBR_DBUS_PROPERTY_DEVICE_ROLE)
+        {
+            std::string roleName;
+            DeviceRole  role = OTBR_DEVICE_ROLE_DISABLED;
+
+            if (DBusMessageExtract(&valIter, roleName) != OTBR_ERROR_NONE ||
+                NameToDeviceRole(roleName, role) != ClientError::ERROR_NONE)
+            {
+                continue;
+            }
+
+            if (mPropertyCacheEnabled)
+            {
+                mCachedDeviceRole     = role;
+                mDeviceRoleCacheValid = true;
+            }
+
+            for (const auto &f : mDeviceRoleHandlers)
+            {
+                f(role);
+            }
+            handled = DBUS_HANDLER_RESULT_HANDLED;
+        }
+        else if (propertyName == OTBR_DBUS_PROPERTY_LEADER_DATA)
+        {
+            LeaderData leaderData;
+
+            if (mPropertyCacheEnabled && DBusMessageExtract(&valIter, leaderData) == OTBR_ERROR_NONE)
+            {
+                mCachedLeaderData     = leaderData;
+                mLeaderDataCacheValid = true;
+                handled               = DBUS_HANDLER_RESULT_HANDLED;
+            }
+        }
     }
-    handled = DBUS_HANDLER_RESULT_HANDLED;
 
 exit:
     return handled;
@@ -495,10 +533,25 @@ ClientError ThreadApiDBus::GetLinkMode(LinkModeConfig &aConfig)
 ClientError ThreadApiDBus::GetDeviceRole(DeviceRole &aRole)
 {
     std::string roleName;
-    ClientError error;
+    ClientError error = ClientError::ERROR_NONE;
+
+    // Served locally once the PropertiesChanged subscription has primed the
+    // cache; the signal keeps it current afterwards.
+    if (mDeviceRoleCacheValid)
+    {
+        aRole = mCachedDeviceRole;
+        ExitNow();
+    }
 
     SuccessOrExit(error = GetProperty(OTBR_DBUS_PROPERTY_DEVICE_ROLE, roleName));
     SuccessOrExit(error = NameToDeviceRole(roleName, aRole));
+
+    if (mPropertyCacheEnabled)
+    {
+        mCachedDeviceRole     = aRole;
+        mDeviceRoleCacheValid = true;
+    }
+
 exit:
     return error;
 }
@@ -565,7 +618,24 @@ ClientError ThreadApiDBus::GetRouterId(uint8_t &aRouterId)
 
 ClientError ThreadApiDBus::GetLeaderData(LeaderData &aLeaderData)
 {
-    return GetProperty(OTBR_DBUS_PROPERTY_LEADER_DATA, aLeaderData);
+    ClientError error = ClientError::ERROR_NONE;
+
+    if (mLeaderDataCacheValid)
+    {
+        aLeaderData = mCachedLeaderData;
+        ExitNow();
+    }
+
+    SuccessOrExit(error = GetProperty(OTBR_DBUS_PROPERTY_LEADER_DATA, aLeaderData));
+
+    if (mPropertyCacheEnabled)
+    {
+        mCachedLeaderData     = aLeaderData;
+        mLeaderDataCacheValid = true;
+    }
+
+exit:
+    return error;
 }
 
 ClientError ThreadApiDBus::GetNetworkData(std::vector<uint8_t> &aNetworkData)
@@ -831,5 +901,37 @@ ClientError ThreadApiDBus::UpdateVendorMeshCopTxtEntries(std::vector<TxtEntry> &
     return CallDBusMethodSync(OTBR_DBUS_UPDATE_VENDOR_MESHCOP_TXT_METHOD, args);
 }
 
+ClientError ThreadApiDBus::QueuePipelinedCall(const std::string &aMethodName, OtResultHandler aHandler)
+{
+    return QueuePipelinedCall(aMethodName, std::tuple<>(), std::move(aHandler));
+}
+
+void ThreadApiDBus::FlushPipelinedCalls(void)
+{
+    dbus_connection_flush(mConnection);
+}
+
+void ThreadApiDBus::PipelinedCallReplyHandler(DBusPendingCall *aPending, void *aContext)
+{
+    OtResultHandler &       handler = *static_cast<OtResultHandler *>(aContext);
+    DBus::UniqueDBusMessage reply(dbus_pending_call_steal_reply(aPending));
+    ClientError             error = ClientError::ERROR_DBUS;
+
+    if (reply != nullptr)
+    {
+        error = DBus::CheckErrorMessage(reply.get());
+    }
+
+    if (handler)
+    {
+        handler(error);
+    }
+}
+
+void ThreadApiDBus::DeleteOtResultHandler(void *aContext)
+{
+    delete static_cast<OtResultHandler *>(aContext);
+}
+
 } // namespace DBus
 } // namespace otbr
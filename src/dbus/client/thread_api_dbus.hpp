@@ -38,8 +38,12 @@
 
 #include <dbus/dbus.h>
 
+#include "common/code_utils.hpp"
 #include "common/types.hpp"
+#include "dbus/client/client_error.hpp"
 #include "dbus/common/constants.hpp"
+#include "dbus/common/dbus_message_helper.hpp"
+#include "dbus/common/dbus_resources.hpp"
 #include "dbus/common/error.hpp"
 #include "dbus/common/types.hpp"
 
@@ -796,7 +800,119 @@ public:
      */
     ClientError UpdateVendorMeshCopTxtEntries(std::vector<TxtEntry> &aUpdate);
 
+    /**
+     * This method gets multiple properties in one d-bus round trip.
+     *
+     * @param[in]  aPropertyNames  The names of the properties to get.
+     * @param[out] aValues         Output values, one per property name, in the same order.
+     *
+     * @retval ERROR_NONE  Successfully performed the dbus function call
+     * @retval ERROR_DBUS  dbus encode/decode error
+     * @retval ...         OpenThread defined error value otherwise
+     *
+     */
+    template <typename... ValTypes>
+    ClientError GetProperties(const std::vector<std::string> &aPropertyNames, ValTypes &... aValues)
+    {
+        UniqueDBusMessage message(dbus_message_new_method_call((OTBR_DBUS_SERVER_PREFIX + mInterfaceName).c_str(),
+                                                               (OTBR_DBUS_OBJECT_PREFIX + mInterfaceName).c_str(),
+                                                               OTBR_DBUS_THREAD_INTERFACE,
+                                                               OTBR_DBUS_GET_PROPERTIES_METHOD));
+        UniqueDBusMessage reply = nullptr;
+        ClientError       ret   = ClientError::ERROR_NONE;
+        DBusError         error;
+        DBusMessageIter   iter;
+        DBusMessageIter   subIter;
+
+        dbus_error_init(&error);
+        VerifyOrExit(message != nullptr, ret = ClientError::OT_ERROR_FAILED);
+        VerifyOrExit(TupleToDBusMessage(*message, std::tie(aPropertyNames)) == OTBR_ERROR_NONE,
+                     ret = ClientError::ERROR_DBUS);
+        reply = UniqueDBusMessage(
+            dbus_connection_send_with_reply_and_block(mConnection, message.get(), DBUS_TIMEOUT_USE_DEFAULT, &error));
+
+        VerifyOrExit(!dbus_error_is_set(&error), ret = ConvertFromDBusErrorName(error.message));
+        VerifyOrExit(reply != nullptr, ret = ClientError::ERROR_DBUS);
+        SuccessOrExit(ret = CheckErrorMessage(reply.get()));
+        VerifyOrExit(dbus_message_iter_init(reply.get(), &iter), ret = ClientError::ERROR_DBUS);
+        VerifyOrExit(dbus_message_iter_get_arg_type(&iter) == DBUS_TYPE_ARRAY, ret = ClientError::ERROR_DBUS);
+        dbus_message_iter_recurse(&iter, &subIter);
+        ret = ExtractPropertyValues(subIter, aValues...);
+
+    exit:
+        dbus_error_free(&error);
+        return ret;
+    }
+
+    /**
+     * This method queues a method call for pipelined sending.
+     *
+     * Queued calls are buffered on the shared connection and written out together by the next
+     * `FlushPipelinedCalls`, so a multi-step flow pays roughly one round trip instead of one per
+     * call. @p aHandler runs with the call result once the reply is dispatched.
+     *
+     * @param[in] aMethodName  The method name to call.
+     * @param[in] aArgs        The tuple of method arguments.
+     * @param[in] aHandler     The completion handler.
+     *
+     * @retval ERROR_NONE  Successfully queued the call
+     * @retval ERROR_DBUS  dbus encode error
+     *
+     */
+    template <typename ArgType>
+    ClientError QueuePipelinedCall(const std::string &aMethodName, const ArgType &aArgs, OtResultHandler aHandler)
+    {
+        ClientError       ret = ClientError::ERROR_NONE;
+        UniqueDBusMessage message(dbus_message_new_method_call((OTBR_DBUS_SERVER_PREFIX + mInterfaceName).c_str(),
+                                                               (OTBR_DBUS_OBJECT_PREFIX + mInterfaceName).c_str(),
+                                                               OTBR_DBUS_THREAD_INTERFACE, aMethodName.c_str()));
+        DBusPendingCall * pending = nullptr;
+        OtResultHandler * handlerOnHeap;
+
+        VerifyOrExit(message != nullptr, ret = ClientError::ERROR_DBUS);
+        VerifyOrExit(TupleToDBusMessage(*message, aArgs) == OTBR_ERROR_NONE, ret = ClientError::ERROR_DBUS);
+        VerifyOrExit(dbus_connection_send_with_reply(mConnection, message.get(), &pending, DBUS_TIMEOUT_USE_DEFAULT),
+                     ret = ClientError::ERROR_DBUS);
+        VerifyOrExit(pending != nullptr, ret = ClientError::ERROR_DBUS);
+
+        handlerOnHeap = new OtResultHandler(std::move(aHandler));
+
+        if (!dbus_pending_call_set_notify(pending, &ThreadApiDBus::PipelinedCallReplyHandler, handlerOnHeap,
+                                          &ThreadApiDBus::DeleteOtResultHandler))
+        {
+            delete handlerOnHeap;
+            dbus_pending_call_unref(pending);
+            ExitNow(ret = ClientError::ERROR_DBUS);
+        }
+
+        dbus_pending_call_unref(pending);
+
+    exit:
+        return ret;
+    }
+
+    /**
+     * This method queues a method call without arguments for pipelined sending.
+     *
+     * @param[in] aMethodName  The method name to call.
+     * @param[in] aHandler     The completion handler.
+     *
+     * @retval ERROR_NONE  Successfully queued the call
+     * @retval ERROR_DBUS  dbus encode error
+     *
+     */
+    ClientError QueuePipelinedCall(const std::string &aMethodName, OtResultHandler aHandler);
+
+    /**
+     * This method writes all queued pipelined calls to the bus in one batch.
+     *
+     */
+    void FlushPipelinedCalls(void);
+
 private:
+    static void PipelinedCallReplyHandler(DBusPendingCall *aPending, void *aContext);
+    static void DeleteOtResultHandler(void *aContext);
+
     ClientError CallDBusMethodSync(const std::string &aMethodName);
     ClientError CallDBusMethodAsync(const std::string &aMethodName, DBusPendingCallNotifyFunction aFunction);
 
@@ -811,6 +927,26 @@ private:
 
     template <typename ValType> ClientError GetProperty(const std::string &aPropertyName, ValType &aValue);
 
+    static ClientError ExtractPropertyValues(DBusMessageIter &aIter)
+    {
+        OTBR_UNUSED_VARIABLE(aIter);
+
+        return ClientError::ERROR_NONE;
+    }
+
+    template <typename ValType, typename... RestTypes>
+    static ClientError ExtractPropertyValues(DBusMessageIter &aIter, ValType &aValue, RestTypes &... aRest)
+    {
+        ClientError ret = ClientError::ERROR_NONE;
+
+        VerifyOrExit(DBusMessageExtractFromVariant(&aIter, aValue) == OTBR_ERROR_NONE, ret = ClientError::ERROR_DBUS);
+        dbus_message_iter_next(&aIter);
+        ret = ExtractPropertyValues(aIter, aRest...);
+
+    exit:
+        return ret;
+    }
+
     ClientError              SubscribeDeviceRoleSignal(void);
     static DBusHandlerResult sDBusMessageFilter(DBusConnection *aConnection, DBusMessage *aMessage, void *aData);
     DBusHandlerResult        DBusMessageFilter(DBusConnection *aConnection, DBusMessage *aMessage);
@@ -840,6 +976,15 @@ private:
     OtResultHandler   mJoinerHandler;
 
     std::vector<DeviceRoleHandler> mDeviceRoleHandlers;
+
+    // Local property cache fed by the server's PropertiesChanged signals.
+    // Only usable when the signal subscription succeeded; getters fall back
+    // to a round trip while the corresponding entry has not been primed.
+    bool       mPropertyCacheEnabled = false;
+    bool       mDeviceRoleCacheValid = false;
+    bool       mLeaderDataCacheValid = false;
+    DeviceRole mCachedDeviceRole     = OTBR_DEVICE_ROLE_DISABLED;
+    LeaderData mCachedLeaderData{};
 };
 
 } // namespace DBus
@@ -172,6 +172,9 @@ void DumpDBusMessage(DBusMessage &aMessage)
     DBusMessageIter    iter;
     std::ostringstream sout;
 
+    // The walk stringifies the whole message; skip it entirely unless the
+    // sink accepts debug records for this tag.
+    VerifyOrExit(otbrLogShouldLog(OTBR_LOG_DEBUG, OTBR_LOG_TAG));
     VerifyOrExit(dbus_message_iter_init(&aMessage, &iter), otbrLogDebug("Failed to iterate dbus message during dump"));
     sout << "{ ";
     DumpDBusMessage(sout, &iter);
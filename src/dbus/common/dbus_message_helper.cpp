@@ -71,6 +71,11 @@ exit:
     return error;
 }
 
+otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<int8_t> &aValue)
+{
+    return DBusMessageExtractPrimitive(aIter, aValue);
+}
+
 otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<uint8_t> &aValue)
 {
     return DBusMessageExtractPrimitive(aIter, aValue);
@@ -142,6 +147,11 @@ exit:
     return error;
 }
 
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<int8_t> &aValue)
+{
+    return DBusMessageEncodePrimitive(aIter, aValue);
+}
+
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<uint8_t> &aValue)
 {
     return DBusMessageEncodePrimitive(aIter, aValue);
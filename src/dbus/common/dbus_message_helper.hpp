@@ -85,12 +85,16 @@ otbrError DBusMessageEncode(DBusMessageIter *aIter, const SrpServerInfo &aSrpSer
 otbrError DBusMessageExtract(DBusMessageIter *aIter, SrpServerInfo &aSrpServerInfo);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const MdnsResponseCounters &aMdnsResponseCounters);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, MdnsResponseCounters &aMdnsResponseCounters);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const MdnsLatencyHistogram &aMdnsLatencyHistogram);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, MdnsLatencyHistogram &aMdnsLatencyHistogram);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const MdnsTelemetryInfo &aMdnsTelemetryInfo);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, MdnsTelemetryInfo &aMdnsTelemetryInfo);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const DnssdCounters &aDnssdCounters);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, DnssdCounters &aDnssdCounters);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const RadioSpinelMetrics &aRadioSpinelMetrics);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, RadioSpinelMetrics &RadioSpinelMetrics);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const RadioTurnaroundMetrics &aRadioTurnaroundMetrics);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, RadioTurnaroundMetrics &aRadioTurnaroundMetrics);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const RcpInterfaceMetrics &aRcpInterfaceMetrics);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, RcpInterfaceMetrics &aRcpInterfaceMetrics);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const RadioCoexMetrics &aRadioCoexMetrics);
@@ -256,8 +260,9 @@ template <> struct DBusTypeTrait<MdnsTelemetryInfo>
     //              struct of { uint32, uint32, uint32, uint32, uint32, uint32 },
     //              struct of { uint32, uint32, uint32, uint32, uint32, uint32 },
     //              struct of { uint32, uint32, uint32, uint32, uint32, uint32 },
-    //              uint32, uint32, uint32, uint32 }
-    static constexpr const char *TYPE_AS_STRING = "((uuuuuu)(uuuuuu)(uuuuuu)(uuuuuu)uuuu)";
+    //              uint32, uint32, uint32, uint32, uint32, uint32,
+    //              array of uint32, array of uint32, array of uint32, array of uint32 }
+    static constexpr const char *TYPE_AS_STRING = "((uuuuuu)(uuuuuu)(uuuuuu)(uuuuuu)uuuuuuauauauau)";
 };
 
 template <> struct DBusTypeTrait<DnssdCounters>
@@ -278,6 +283,12 @@ template <> struct DBusTypeTrait<RcpInterfaceMetrics>
     static constexpr const char *TYPE_AS_STRING = "(yttttttt)";
 };
 
+template <> struct DBusTypeTrait<RadioTurnaroundMetrics>
+{
+    // struct of { uint64, uint64, uint64, uint64, array of uint64 }
+    static constexpr const char *TYPE_AS_STRING = "(ttttat)";
+};
+
 template <> struct DBusTypeTrait<RadioCoexMetrics>
 {
     // struct of { uint32, uint32, uint32, uint32, uint32, uint32, uint32, uint32,
@@ -344,6 +355,7 @@ otbrError DBusMessageEncode(DBusMessageIter *aIter, bool aValue);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, int8_t aValue);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::string &aValue);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const char *aValue);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<int8_t> &aValue);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<uint8_t> &aValue);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<uint16_t> &aValue);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<uint32_t> &aValue);
@@ -354,6 +366,7 @@ otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<int64_t> &
 otbrError DBusMessageExtract(DBusMessageIter *aIter, bool &aValue);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, int8_t &aValue);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, std::string &aValue);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<int8_t> &aValue);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<uint8_t> &aValue);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<uint16_t> &aValue);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<uint32_t> &aValue);
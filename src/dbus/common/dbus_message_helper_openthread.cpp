@@ -28,6 +28,8 @@
 
 #include <string.h>
 
+#include <algorithm>
+
 #include "dbus/common/dbus_message_helper.hpp"
 
 namespace otbr {
@@ -689,6 +691,28 @@ exit:
     return error;
 }
 
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const MdnsLatencyHistogram &aMdnsLatencyHistogram)
+{
+    std::vector<uint32_t> buckets(aMdnsLatencyHistogram.mBuckets,
+                                  aMdnsLatencyHistogram.mBuckets + MdnsLatencyHistogram::kBucketCount);
+
+    return DBusMessageEncode(aIter, buckets);
+}
+
+otbrError DBusMessageExtract(DBusMessageIter *aIter, MdnsLatencyHistogram &aMdnsLatencyHistogram)
+{
+    otbrError             error = OTBR_ERROR_NONE;
+    std::vector<uint32_t> buckets;
+
+    SuccessOrExit(error = DBusMessageExtract(aIter, buckets));
+    VerifyOrExit(buckets.size() == MdnsLatencyHistogram::kBucketCount, error = OTBR_ERROR_DBUS);
+
+    std::copy(buckets.begin(), buckets.end(), aMdnsLatencyHistogram.mBuckets);
+
+exit:
+    return error;
+}
+
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const MdnsTelemetryInfo &aMdnsTelemetryInfo)
 {
     DBusMessageIter sub;
@@ -706,6 +730,14 @@ otbrError DBusMessageEncode(DBusMessageIter *aIter, const MdnsTelemetryInfo &aMd
     SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsTelemetryInfo.mHostResolutionEmaLatency));
     SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsTelemetryInfo.mServiceResolutionEmaLatency));
 
+    SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsTelemetryInfo.mHostResolutionNegativeCacheHits));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsTelemetryInfo.mServiceResolutionNegativeCacheHits));
+
+    SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsTelemetryInfo.mHostRegistrationLatencyHistogram));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsTelemetryInfo.mServiceRegistrationLatencyHistogram));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsTelemetryInfo.mHostResolutionLatencyHistogram));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aMdnsTelemetryInfo.mServiceResolutionLatencyHistogram));
+
     VerifyOrExit(dbus_message_iter_close_container(aIter, &sub), error = OTBR_ERROR_DBUS);
 exit:
     return error;
@@ -728,6 +760,14 @@ otbrError DBusMessageExtract(DBusMessageIter *aIter, MdnsTelemetryInfo &aMdnsTel
     SuccessOrExit(error = DBusMessageExtract(&sub, aMdnsTelemetryInfo.mHostResolutionEmaLatency));
     SuccessOrExit(error = DBusMessageExtract(&sub, aMdnsTelemetryInfo.mServiceResolutionEmaLatency));
 
+    SuccessOrExit(error = DBusMessageExtract(&sub, aMdnsTelemetryInfo.mHostResolutionNegativeCacheHits));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aMdnsTelemetryInfo.mServiceResolutionNegativeCacheHits));
+
+    SuccessOrExit(error = DBusMessageExtract(&sub, aMdnsTelemetryInfo.mHostRegistrationLatencyHistogram));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aMdnsTelemetryInfo.mServiceRegistrationLatencyHistogram));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aMdnsTelemetryInfo.mHostResolutionLatencyHistogram));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aMdnsTelemetryInfo.mServiceResolutionLatencyHistogram));
+
     dbus_message_iter_next(aIter);
 exit:
     return error;
@@ -809,6 +849,42 @@ exit:
     return error;
 }
 
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const RadioTurnaroundMetrics &aRadioTurnaroundMetrics)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(dbus_message_iter_open_container(aIter, DBUS_TYPE_STRUCT, nullptr, &sub), error = OTBR_ERROR_DBUS);
+
+    SuccessOrExit(error = DBusMessageEncode(&sub, aRadioTurnaroundMetrics.mCycleCount));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aRadioTurnaroundMetrics.mTotalUs));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aRadioTurnaroundMetrics.mMaxUs));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aRadioTurnaroundMetrics.mOverBudgetCount));
+    SuccessOrExit(error = DBusMessageEncode(&sub, aRadioTurnaroundMetrics.mBuckets));
+
+    VerifyOrExit(dbus_message_iter_close_container(aIter, &sub), error = OTBR_ERROR_DBUS);
+exit:
+    return error;
+}
+
+otbrError DBusMessageExtract(DBusMessageIter *aIter, RadioTurnaroundMetrics &aRadioTurnaroundMetrics)
+{
+    DBusMessageIter sub;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    dbus_message_iter_recurse(aIter, &sub);
+
+    SuccessOrExit(error = DBusMessageExtract(&sub, aRadioTurnaroundMetrics.mCycleCount));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aRadioTurnaroundMetrics.mTotalUs));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aRadioTurnaroundMetrics.mMaxUs));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aRadioTurnaroundMetrics.mOverBudgetCount));
+    SuccessOrExit(error = DBusMessageExtract(&sub, aRadioTurnaroundMetrics.mBuckets));
+
+    dbus_message_iter_next(aIter);
+exit:
+    return error;
+}
+
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const RadioCoexMetrics &aRadioCoexMetrics)
 {
     DBusMessageIter sub;
@@ -596,6 +596,15 @@ struct RcpInterfaceMetrics
     uint64_t mTxFrameByteCount;             ///< The number of transmitted bytes.
 };
 
+struct RadioTurnaroundMetrics
+{
+    uint64_t              mCycleCount;      ///< The number of sampled mainloop cycles.
+    uint64_t              mTotalUs;         ///< The accumulated turnaround time, in microseconds.
+    uint64_t              mMaxUs;           ///< The maximum observed turnaround, in microseconds.
+    uint64_t              mOverBudgetCount; ///< The cycles that exceeded the turnaround budget.
+    std::vector<uint64_t> mBuckets;         ///< Bucket N counts cycles below (1 << N) ms; the last counts the rest.
+};
+
 struct RadioCoexMetrics
 {
     uint32_t mNumGrantGlitch;          ///< Number of grant glitches.
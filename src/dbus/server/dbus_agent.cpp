@@ -31,9 +31,9 @@
 #include "dbus/server/dbus_agent.hpp"
 
 #include <chrono>
-#include <thread>
 #include <unistd.h>
 
+#include "common/alloc_tracker.hpp"
 #include "common/logging.hpp"
 #include "dbus/common/constants.hpp"
 #include "mdns/mdns.hpp"
@@ -44,6 +44,9 @@ namespace DBus {
 const struct timeval           DBusAgent::kPollTimeout = {0, 0};
 constexpr std::chrono::seconds DBusAgent::kDBusWaitAllowance;
 
+// Allocation tag attributing message dispatch and marshalling to D-Bus.
+static const uint8_t kAllocTag = AllocTracker::GetInstance().RegisterTag("dbus");
+
 DBusAgent::DBusAgent(otbr::Ncp::ControllerOpenThread &aNcp, Mdns::Publisher &aPublisher)
     : mInterfaceName(aNcp.GetInterfaceName())
     , mNcp(aNcp)
@@ -52,23 +55,35 @@ DBusAgent::DBusAgent(otbr::Ncp::ControllerOpenThread &aNcp, Mdns::Publisher &aPu
 }
 
 void DBusAgent::Init(void)
+{
+    mConnectionDeadline = Clock::now() + kDBusWaitAllowance;
+    TryInit();
+}
+
+void DBusAgent::TryInit(void)
 {
     otbrError error = OTBR_ERROR_NONE;
 
-    auto connection_deadline = Clock::now() + kDBusWaitAllowance;
+    mConnection = PrepareDBusConnection();
 
-    while ((mConnection = PrepareDBusConnection()) == nullptr && Clock::now() < connection_deadline)
+    // Retry from the mainloop instead of sleeping here so the rest of
+    // the agent keeps starting up while the bus daemon comes up.
+    if (mConnection == nullptr)
     {
+        VerifyOrDie(Clock::now() < mConnectionDeadline, "Failed to get DBus connection");
         otbrLogWarning("Failed to setup DBus connection, will retry after 1 second");
-        std::this_thread::sleep_for(std::chrono::seconds(1));
+        mNcp.PostTimerTask(Milliseconds(1000), [this]() { TryInit(); });
+        ExitNow();
     }
 
-    VerifyOrDie(mConnection != nullptr, "Failed to get DBus connection");
-
     mThreadObject =
         std::unique_ptr<DBusThreadObject>(new DBusThreadObject(mConnection.get(), mInterfaceName, &mNcp, &mPublisher));
     error = mThreadObject->Init();
     VerifyOrDie(error == OTBR_ERROR_NONE, "Failed to initialize DBus Agent");
+    otbrLogInfo("DBus agent ready");
+
+exit:
+    return;
 }
 
 DBusAgent::UniqueDBusConnection DBusAgent::PrepareDBusConnection(void)
@@ -97,9 +112,9 @@ DBusAgent::UniqueDBusConnection DBusAgent::PrepareDBusConnection(void)
                      otbrLogWarning("Failed to request DBus name: %s: %s", dbusError.name, dbusError.message);
                      uniqueConn = nullptr;
                  });
-    VerifyOrExit(
-        dbus_connection_set_watch_functions(uniqueConn.get(), AddDBusWatch, RemoveDBusWatch, nullptr, this, nullptr),
-        uniqueConn = nullptr);
+    VerifyOrExit(dbus_connection_set_watch_functions(uniqueConn.get(), AddDBusWatch, RemoveDBusWatch, ToggleDBusWatch,
+                                                     this, nullptr),
+                 uniqueConn = nullptr);
 
 exit:
     dbus_error_free(&dbusError);
@@ -109,96 +124,155 @@ exit:
 
 dbus_bool_t DBusAgent::AddDBusWatch(struct DBusWatch *aWatch, void *aContext)
 {
-    static_cast<DBusAgent *>(aContext)->mWatches.insert(aWatch);
+    DBusAgent *agent = static_cast<DBusAgent *>(aContext);
+
+    agent->mWatches.insert(aWatch);
+    agent->mWatchListDirty = true;
     return TRUE;
 }
 
 void DBusAgent::RemoveDBusWatch(struct DBusWatch *aWatch, void *aContext)
 {
-    static_cast<DBusAgent *>(aContext)->mWatches.erase(aWatch);
-}
+    DBusAgent *agent = static_cast<DBusAgent *>(aContext);
 
-void DBusAgent::Update(MainloopContext &aMainloop)
-{
-    unsigned int flags;
-    int          fd;
+    agent->mWatches.erase(aWatch);
+    agent->mWatchListDirty = true;
 
-    if (dbus_connection_get_dispatch_status(mConnection.get()) == DBUS_DISPATCH_DATA_REMAINS)
+    // The watch may be freed by libdbus right after this callback; make
+    // sure the cached snapshot cannot hand out a dangling pointer.
+    for (WatchEntry &entry : agent->mEnabledWatches)
     {
-        aMainloop.mTimeout = {0, 0};
+        if (entry.mWatch == aWatch)
+        {
+            entry.mWatch = nullptr;
+        }
     }
+}
+
+void DBusAgent::ToggleDBusWatch(struct DBusWatch *aWatch, void *aContext)
+{
+    OTBR_UNUSED_VARIABLE(aWatch);
+
+    static_cast<DBusAgent *>(aContext)->mWatchListDirty = true;
+}
+
+void DBusAgent::RebuildWatchList(void)
+{
+    mEnabledWatches.clear();
 
-    for (const auto &watch : mWatches)
+    for (DBusWatch *watch : mWatches)
     {
+        WatchEntry entry;
+
         if (!dbus_watch_get_enabled(watch))
         {
             continue;
         }
 
-        flags = dbus_watch_get_flags(watch);
-        fd    = dbus_watch_get_unix_fd(watch);
+        entry.mWatch = watch;
+        entry.mFd    = dbus_watch_get_unix_fd(watch);
+        entry.mFlags = dbus_watch_get_flags(watch);
 
-        if (fd < 0)
+        if (entry.mFd < 0)
         {
             continue;
         }
 
-        if (flags & DBUS_WATCH_READABLE)
+        mEnabledWatches.push_back(entry);
+    }
+
+    mWatchListDirty = false;
+}
+
+void DBusAgent::Update(MainloopContext &aMainloop)
+{
+    VerifyOrExit(mConnection != nullptr);
+
+    if (dbus_connection_get_dispatch_status(mConnection.get()) == DBUS_DISPATCH_DATA_REMAINS ||
+        mThreadObject->HasPendingPropertyChangedSignals())
+    {
+        aMainloop.mTimeout = {0, 0};
+    }
+
+    if (mWatchListDirty)
+    {
+        RebuildWatchList();
+    }
+
+    for (const WatchEntry &entry : mEnabledWatches)
+    {
+        if (entry.mWatch == nullptr)
         {
-            FD_SET(fd, &aMainloop.mReadFdSet);
+            continue;
         }
 
-        if ((flags & DBUS_WATCH_WRITABLE))
+        if (entry.mFlags & DBUS_WATCH_READABLE)
         {
-            FD_SET(fd, &aMainloop.mWriteFdSet);
+            FD_SET(entry.mFd, &aMainloop.mReadFdSet);
         }
 
-        FD_SET(fd, &aMainloop.mErrorFdSet);
+        if ((entry.mFlags & DBUS_WATCH_WRITABLE))
+        {
+            FD_SET(entry.mFd, &aMainloop.mWriteFdSet);
+        }
+
+        FD_SET(entry.mFd, &aMainloop.mErrorFdSet);
 
-        aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, fd);
+        aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, entry.mFd);
     }
+
+exit:
+    return;
 }
 
 void DBusAgent::Process(const MainloopContext &aMainloop)
 {
-    unsigned int flags;
-    int          fd;
+    AllocTracker::TagScope allocScope(kAllocTag);
+    unsigned int           flags;
 
-    for (const auto &watch : mWatches)
-    {
-        if (!dbus_watch_get_enabled(watch))
-        {
-            continue;
-        }
+    VerifyOrExit(mConnection != nullptr);
 
-        flags = dbus_watch_get_flags(watch);
-        fd    = dbus_watch_get_unix_fd(watch);
+    if (mWatchListDirty)
+    {
+        RebuildWatchList();
+    }
 
-        if (fd < 0)
+    for (const WatchEntry &entry : mEnabledWatches)
+    {
+        // Handling a watch may remove other watches, which nulls their
+        // snapshot entries via `RemoveDBusWatch`.
+        if (entry.mWatch == nullptr)
         {
             continue;
         }
 
-        if ((flags & DBUS_WATCH_READABLE) && !FD_ISSET(fd, &aMainloop.mReadFdSet))
+        flags = entry.mFlags;
+
+        if ((flags & DBUS_WATCH_READABLE) && !FD_ISSET(entry.mFd, &aMainloop.mReadFdSet))
         {
             flags &= static_cast<unsigned int>(~DBUS_WATCH_READABLE);
         }
 
-        if ((flags & DBUS_WATCH_WRITABLE) && !FD_ISSET(fd, &aMainloop.mWriteFdSet))
+        if ((flags & DBUS_WATCH_WRITABLE) && !FD_ISSET(entry.mFd, &aMainloop.mWriteFdSet))
         {
             flags &= static_cast<unsigned int>(~DBUS_WATCH_WRITABLE);
         }
 
-        if (FD_ISSET(fd, &aMainloop.mErrorFdSet))
+        if (FD_ISSET(entry.mFd, &aMainloop.mErrorFdSet))
         {
             flags |= DBUS_WATCH_ERROR;
         }
 
-        dbus_watch_handle(watch, flags);
+        dbus_watch_handle(entry.mWatch, flags);
     }
 
     while (DBUS_DISPATCH_DATA_REMAINS == dbus_connection_dispatch(mConnection.get()))
         ;
+
+    mThreadObject->EmitPendingPropertyChangedSignals();
+
+exit:
+    return;
 }
 
 } // namespace DBus
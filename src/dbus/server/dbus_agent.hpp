@@ -38,6 +38,7 @@
 #include <set>
 #include <string>
 #include <sys/select.h>
+#include <vector>
 
 #include "common/code_utils.hpp"
 #include "common/mainloop.hpp"
@@ -77,8 +78,18 @@ private:
 
     using UniqueDBusConnection = std::unique_ptr<DBusConnection, std::function<void(DBusConnection *)>>;
 
+    struct WatchEntry
+    {
+        DBusWatch *  mWatch;
+        int          mFd;
+        unsigned int mFlags;
+    };
+
     static dbus_bool_t   AddDBusWatch(struct DBusWatch *aWatch, void *aContext);
     static void          RemoveDBusWatch(struct DBusWatch *aWatch, void *aContext);
+    static void          ToggleDBusWatch(struct DBusWatch *aWatch, void *aContext);
+    void                 RebuildWatchList(void);
+    void                 TryInit(void);
     UniqueDBusConnection PrepareDBusConnection(void);
 
     static const struct timeval kPollTimeout;
@@ -86,6 +97,7 @@ private:
     std::string                       mInterfaceName;
     std::unique_ptr<DBusThreadObject> mThreadObject;
     UniqueDBusConnection              mConnection;
+    Clock::time_point                 mConnectionDeadline;
     otbr::Ncp::ControllerOpenThread & mNcp;
     Mdns::Publisher &                 mPublisher;
 
@@ -94,6 +106,11 @@ private:
      *
      */
     std::set<DBusWatch *> mWatches;
+
+    // Snapshot of the enabled watches with fd and flags resolved once;
+    // rebuilt only when libdbus adds, removes or toggles a watch.
+    std::vector<WatchEntry> mEnabledWatches;
+    bool                    mWatchListDirty = true;
 };
 
 } // namespace DBus
@@ -75,10 +75,29 @@ void DBusObject::RegisterMethod(const std::string &      aInterfaceName,
                                 const std::string &      aMethodName,
                                 const MethodHandlerType &aHandler)
 {
-    std::string fullPath = aInterfaceName + "." + aMethodName;
+    uint64_t hash = HashMemberName(aInterfaceName.c_str(), aMethodName.c_str());
 
-    assert(mMethodHandlers.find(fullPath) == mMethodHandlers.end());
-    mMethodHandlers.emplace(fullPath, aHandler);
+    assert(mMethodHandlers.find(hash) == mMethodHandlers.end());
+    mMethodHandlers.emplace(hash, aHandler);
+}
+
+uint64_t DBusObject::HashMemberName(const char *aInterfaceName, const char *aMemberName)
+{
+    // 64-bit FNV-1a over "interface.member", fed byte by byte so the
+    // concatenated string never exists.
+    uint64_t hash = 14695981039346656037ULL;
+
+    for (const char *p = aInterfaceName; *p != '\0'; p++)
+    {
+        hash = (hash ^ static_cast<uint8_t>(*p)) * 1099511628211ULL;
+    }
+    hash = (hash ^ static_cast<uint8_t>('.')) * 1099511628211ULL;
+    for (const char *p = aMemberName; *p != '\0'; p++)
+    {
+        hash = (hash ^ static_cast<uint8_t>(*p)) * 1099511628211ULL;
+    }
+
+    return hash;
 }
 
 void DBusObject::RegisterGetPropertyHandler(const std::string &        aInterfaceName,
@@ -109,14 +128,19 @@ DBusHandlerResult DBusObject::MessageHandler(DBusConnection *aConnection, DBusMe
 {
     DBusHandlerResult handled = DBUS_HANDLER_RESULT_NOT_YET_HANDLED;
     DBusRequest       request(aConnection, aMessage);
-    std::string       interface  = dbus_message_get_interface(aMessage);
-    std::string       memberName = interface + "." + dbus_message_get_member(aMessage);
-    auto              iter       = mMethodHandlers.find(memberName);
+    const char *      interfaceName = dbus_message_get_interface(aMessage);
+    const char *      memberName    = dbus_message_get_member(aMessage);
+    auto              iter          = mMethodHandlers.end();
+
+    if (interfaceName != nullptr && memberName != nullptr)
+    {
+        iter = mMethodHandlers.find(HashMemberName(interfaceName, memberName));
+    }
 
     if (dbus_message_get_type(aMessage) == DBUS_MESSAGE_TYPE_METHOD_CALL && iter != mMethodHandlers.end())
     {
-        otbrLogInfo("Handling method %s", memberName.c_str());
-        if (otbrLogGetLevel() >= OTBR_LOG_DEBUG)
+        otbrLogInfo("Handling method %s.%s", interfaceName, memberName);
+        if (otbrLogShouldLog(OTBR_LOG_DEBUG, OTBR_LOG_TAG))
         {
             DumpDBusMessage(*aMessage);
         }
@@ -134,13 +158,17 @@ void DBusObject::GetPropertyMethodHandler(DBusRequest &aRequest)
     DBusMessageIter iter;
     std::string     interfaceName;
     std::string     propertyName;
-    otError         error      = OT_ERROR_NONE;
-    otError         replyError = OT_ERROR_NONE;
+    std::string     propertyKey;
+    bool            servedFromCache = false;
+    otError         error           = OT_ERROR_NONE;
+    otError         replyError      = OT_ERROR_NONE;
 
     VerifyOrExit(reply != nullptr, error = OT_ERROR_NO_BUFS);
     VerifyOrExit(dbus_message_iter_init(aRequest.GetMessage(), &iter), error = OT_ERROR_FAILED);
     VerifyOrExit(DBusMessageExtract(&iter, interfaceName) == OTBR_ERROR_NONE, error = OT_ERROR_PARSE);
     VerifyOrExit(DBusMessageExtract(&iter, propertyName) == OTBR_ERROR_NONE, error = OT_ERROR_PARSE);
+
+    propertyKey = interfaceName + "." + propertyName;
     {
         auto propertyIter = mGetPropertyHandlers.find(interfaceName);
 
@@ -152,20 +180,26 @@ void DBusObject::GetPropertyMethodHandler(DBusRequest &aRequest)
             auto            interfaceIter     = interfaceHandlers.find(propertyName);
 
             VerifyOrExit(interfaceIter != interfaceHandlers.end(), error = OT_ERROR_NOT_FOUND);
+            VerifyOrExit(!(servedFromCache = TryServeFromPropertyCache(propertyKey, aRequest)));
             dbus_message_iter_init_append(reply.get(), &replyIter);
             SuccessOrExit(replyError = interfaceIter->second(replyIter));
         }
     }
 exit:
-    if (error == OT_ERROR_NONE && replyError == OT_ERROR_NONE)
+    if (servedFromCache)
     {
-        if (otbrLogGetLevel() >= OTBR_LOG_DEBUG)
+        otbrLogDebug("GetProperty %s.%s served from cache", interfaceName.c_str(), propertyName.c_str());
+    }
+    else if (error == OT_ERROR_NONE && replyError == OT_ERROR_NONE)
+    {
+        if (otbrLogShouldLog(OTBR_LOG_DEBUG, OTBR_LOG_TAG))
         {
             otbrLogDebug("GetProperty %s.%s reply:", interfaceName.c_str(), propertyName.c_str());
             DumpDBusMessage(*reply);
         }
 
         dbus_connection_send(aRequest.GetConnection(), reply.get(), nullptr);
+        CachePropertyReply(propertyKey, reply.get());
     }
     else if (error == OT_ERROR_NONE)
     {
@@ -252,6 +286,58 @@ exit:
     return;
 }
 
+void DBusObject::MarkPropertyCacheable(const std::string &aInterfaceName, const std::string &aPropertyName)
+{
+    mCachedPropertyReplies.emplace(aInterfaceName + "." + aPropertyName, nullptr);
+}
+
+void DBusObject::InvalidatePropertyCache(const std::string &aInterfaceName, const std::string &aPropertyName)
+{
+    auto iter = mCachedPropertyReplies.find(aInterfaceName + "." + aPropertyName);
+
+    if (iter != mCachedPropertyReplies.end())
+    {
+        iter->second = nullptr;
+    }
+}
+
+bool DBusObject::TryServeFromPropertyCache(const std::string &aPropertyKey, DBusRequest &aRequest)
+{
+    bool              served = false;
+    auto              iter   = mCachedPropertyReplies.find(aPropertyKey);
+    UniqueDBusMessage cachedReply;
+    const char *      sender;
+
+    VerifyOrExit(iter != mCachedPropertyReplies.end() && iter->second != nullptr);
+
+    // Copying the cached message duplicates the marshalled body without
+    // re-running the property handler; only the reply headers are patched.
+    cachedReply = UniqueDBusMessage(dbus_message_copy(iter->second.get()));
+    VerifyOrExit(cachedReply != nullptr);
+    VerifyOrExit(dbus_message_set_reply_serial(cachedReply.get(), dbus_message_get_serial(aRequest.GetMessage())));
+
+    sender = dbus_message_get_sender(aRequest.GetMessage());
+    if (sender != nullptr)
+    {
+        VerifyOrExit(dbus_message_set_destination(cachedReply.get(), sender));
+    }
+
+    served = dbus_connection_send(aRequest.GetConnection(), cachedReply.get(), nullptr);
+
+exit:
+    return served;
+}
+
+void DBusObject::CachePropertyReply(const std::string &aPropertyKey, DBusMessage *aReply)
+{
+    auto iter = mCachedPropertyReplies.find(aPropertyKey);
+
+    if (iter != mCachedPropertyReplies.end())
+    {
+        iter->second = UniqueDBusMessage(dbus_message_copy(aReply));
+    }
+}
+
 DBusObject::~DBusObject(void)
 {
 }
@@ -263,8 +349,62 @@ UniqueDBusMessage DBusObject::NewSignalMessage(const std::string &aInterfaceName
 
 void DBusObject::Flush(void)
 {
+    EmitPendingPropertyChangedSignals();
     dbus_connection_flush(mConnection);
 }
 
+void DBusObject::EmitPendingPropertyChangedSignals(void)
+{
+    for (auto &interfaceEntry : mPendingPropertyChanges)
+    {
+        const std::string &interfaceName = interfaceEntry.first;
+        UniqueDBusMessage  signalMsg = NewSignalMessage(DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTIES_CHANGED_SIGNAL);
+        DBusMessageIter    iter, subIter, dictEntryIter;
+        otbrError          error = OTBR_ERROR_NONE;
+
+        VerifyOrExit(signalMsg != nullptr, error = OTBR_ERROR_DBUS);
+        dbus_message_iter_init_append(signalMsg.get(), &iter);
+
+        // interface_name
+        SuccessOrExit(error = DBusMessageEncode(&iter, interfaceName));
+
+        // changed_properties
+        VerifyOrExit(dbus_message_iter_open_container(&iter, DBUS_TYPE_ARRAY,
+                                                      "{" DBUS_TYPE_STRING_AS_STRING DBUS_TYPE_VARIANT_AS_STRING "}",
+                                                      &subIter),
+                     error = OTBR_ERROR_DBUS);
+
+        for (auto &propertyEntry : interfaceEntry.second)
+        {
+            VerifyOrExit(dbus_message_iter_open_container(&subIter, DBUS_TYPE_DICT_ENTRY, nullptr, &dictEntryIter),
+                         error = OTBR_ERROR_DBUS);
+            SuccessOrExit(error = DBusMessageEncode(&dictEntryIter, propertyEntry.first));
+            SuccessOrExit(error = propertyEntry.second(dictEntryIter));
+            VerifyOrExit(dbus_message_iter_close_container(&subIter, &dictEntryIter), error = OTBR_ERROR_DBUS);
+        }
+
+        VerifyOrExit(dbus_message_iter_close_container(&iter, &subIter), error = OTBR_ERROR_DBUS);
+
+        // invalidated_properties
+        SuccessOrExit(error = DBusMessageEncode(&iter, std::vector<std::string>()));
+
+        if (otbrLogShouldLog(OTBR_LOG_DEBUG, OTBR_LOG_TAG))
+        {
+            otbrLogDebug("Signal %s.%s", DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTIES_CHANGED_SIGNAL);
+            DumpDBusMessage(*signalMsg);
+        }
+
+        VerifyOrExit(dbus_connection_send(mConnection, signalMsg.get(), nullptr), error = OTBR_ERROR_DBUS);
+
+    exit:
+        if (error != OTBR_ERROR_NONE)
+        {
+            otbrLogWarning("Failed to emit PropertiesChanged for %s: %d", interfaceName.c_str(), error);
+        }
+    }
+
+    mPendingPropertyChanges.clear();
+}
+
 } // namespace DBus
 } // namespace otbr
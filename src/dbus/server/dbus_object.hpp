@@ -39,6 +39,7 @@
 #endif
 
 #include <functional>
+#include <map>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -152,14 +153,17 @@ public:
     }
 
     /**
-     * This method sends a property changed signal.
+     * This method queues a property changed signal.
+     *
+     * Changes queued within one mainloop cycle are coalesced into a single
+     * `PropertiesChanged` emission per interface carrying the new values;
+     * for a property changed more than once, the last value wins.
      *
      * @param[in] aInterfaceName  The interface name.
      * @param[in] aPropertyName   The property name.
      * @param[in] aValue          New value of the property.
      *
-     * @retval OTBR_ERROR_NONE  Signal successfully sent.
-     * @retval OTBR_ERROR_DBUS  Failed to send the signal.
+     * @retval OTBR_ERROR_NONE  Signal successfully queued.
      *
      */
     template <typename ValueType>
@@ -167,44 +171,28 @@ public:
                                     const std::string &aPropertyName,
                                     const ValueType &  aValue)
     {
-        UniqueDBusMessage signalMsg = NewSignalMessage(DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTIES_CHANGED_SIGNAL);
-        DBusMessageIter   iter, subIter, dictEntryIter;
-        otbrError         error = OTBR_ERROR_NONE;
-
-        VerifyOrExit(signalMsg != nullptr, error = OTBR_ERROR_DBUS);
-        dbus_message_iter_init_append(signalMsg.get(), &iter);
-
-        // interface_name
-        VerifyOrExit(DBusMessageEncode(&iter, aInterfaceName) == OTBR_ERROR_NONE, error = OTBR_ERROR_DBUS);
+        otbrLogDebug("Signal %s.%s queued", aInterfaceName.c_str(), aPropertyName.c_str());
+        mPendingPropertyChanges[aInterfaceName][aPropertyName] = [aValue](DBusMessageIter &aIter) {
+            return DBusMessageEncodeToVariant(&aIter, aValue);
+        };
 
-        // changed_properties
-        VerifyOrExit(dbus_message_iter_open_container(&iter, DBUS_TYPE_ARRAY,
-                                                      "{" DBUS_TYPE_STRING_AS_STRING DBUS_TYPE_VARIANT_AS_STRING "}",
-                                                      &subIter),
-                     error = OTBR_ERROR_DBUS);
-        VerifyOrExit(dbus_message_iter_open_container(&subIter, DBUS_TYPE_DICT_ENTRY, nullptr, &dictEntryIter),
-                     error = OTBR_ERROR_DBUS);
-
-        SuccessOrExit(error = DBusMessageEncode(&dictEntryIter, aPropertyName));
-        SuccessOrExit(error = DBusMessageEncodeToVariant(&dictEntryIter, aValue));
-
-        VerifyOrExit(dbus_message_iter_close_container(&subIter, &dictEntryIter), error = OTBR_ERROR_DBUS);
-        VerifyOrExit(dbus_message_iter_close_container(&iter, &subIter), error = OTBR_ERROR_DBUS);
-
-        // invalidated_properties
-        SuccessOrExit(error = DBusMessageEncode(&iter, std::vector<std::string>()));
-
-        if (otbrLogGetLevel() >= OTBR_LOG_DEBUG)
-        {
-            otbrLogDebug("Signal %s.%s", aInterfaceName.c_str(), aPropertyName.c_str());
-            DumpDBusMessage(*signalMsg);
-        }
+        return OTBR_ERROR_NONE;
+    }
 
-        VerifyOrExit(dbus_connection_send(mConnection, signalMsg.get(), nullptr), error = OTBR_ERROR_DBUS);
+    /**
+     * This method emits one coalesced `PropertiesChanged` signal per
+     * interface with queued property changes.
+     *
+     */
+    void EmitPendingPropertyChangedSignals(void);
 
-    exit:
-        return error;
-    }
+    /**
+     * This method indicates whether property changed signals are queued.
+     *
+     * @returns Whether property changed signals are queued.
+     *
+     */
+    bool HasPendingPropertyChangedSignals(void) const { return !mPendingPropertyChanges.empty(); }
 
     /**
      * The destructor of a d-bus object.
@@ -218,7 +206,37 @@ public:
      */
     void Flush(void);
 
+protected:
+    /**
+     * This method marks a property so that its serialized `Get` reply is
+     * cached and replayed for later `Get` calls until invalidated.
+     *
+     * Mark only properties whose value changes are always followed by a
+     * call to `InvalidatePropertyCache`.
+     *
+     * @param[in] aInterfaceName  The interface name.
+     * @param[in] aPropertyName   The property name.
+     *
+     */
+    void MarkPropertyCacheable(const std::string &aInterfaceName, const std::string &aPropertyName);
+
+    /**
+     * This method drops the cached `Get` reply of a property, if any.
+     *
+     * @param[in] aInterfaceName  The interface name.
+     * @param[in] aPropertyName   The property name.
+     *
+     */
+    void InvalidatePropertyCache(const std::string &aInterfaceName, const std::string &aPropertyName);
+
 private:
+    bool TryServeFromPropertyCache(const std::string &aPropertyKey, DBusRequest &aRequest);
+    void CachePropertyReply(const std::string &aPropertyKey, DBusMessage *aReply);
+
+    // Hashes "interface.member" without materializing the concatenated
+    // string, so per-message dispatch needs no allocation.
+    static uint64_t HashMemberName(const char *aInterfaceName, const char *aMemberName);
+
     void GetAllPropertiesMethodHandler(DBusRequest &aRequest);
     void GetPropertyMethodHandler(DBusRequest &aRequest);
     void SetPropertyMethodHandler(DBusRequest &aRequest);
@@ -228,9 +246,22 @@ private:
 
     UniqueDBusMessage NewSignalMessage(const std::string &aInterfaceName, const std::string &aSignalName);
 
-    std::unordered_map<std::string, MethodHandlerType>                                    mMethodHandlers;
+    // Method handlers keyed by the 64-bit hash of "interface.member";
+    // duplicate registration (or a hash collision) trips the assert in
+    // `RegisterMethod` at startup.
+    std::unordered_map<uint64_t, MethodHandlerType>                                       mMethodHandlers;
     std::unordered_map<std::string, std::unordered_map<std::string, PropertyHandlerType>> mGetPropertyHandlers;
     std::unordered_map<std::string, PropertyHandlerType>                                  mSetPropertyHandlers;
+
+    // Serialized `Get` replies of cacheable properties, keyed by
+    // "interface.property"; a null message means cacheable but currently
+    // invalidated.
+    std::unordered_map<std::string, UniqueDBusMessage> mCachedPropertyReplies;
+
+    // Property changes queued for the next coalesced `PropertiesChanged`
+    // emission, as interface -> property -> variant encoder.
+    std::map<std::string, std::map<std::string, std::function<otbrError(DBusMessageIter &)>>> mPendingPropertyChanges;
+
     DBusConnection *                                                                      mConnection;
     std::string                                                                           mObjectPath;
 };
@@ -122,7 +122,7 @@ public:
         VerifyOrExit(reply != nullptr);
         VerifyOrExit(otbr::DBus::TupleToDBusMessage(*reply, aReply) == OTBR_ERROR_NONE);
 
-        if (otbrLogGetLevel() >= OTBR_LOG_DEBUG)
+        if (otbrLogShouldLog(OTBR_LOG_DEBUG, OTBR_LOG_TAG))
         {
             otbrLogDebug("Replied to %s.%s :", dbus_message_get_interface(mMessage), dbus_message_get_member(mMessage));
             DumpDBusMessage(*reply);
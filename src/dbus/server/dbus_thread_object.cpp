@@ -96,6 +96,24 @@ static uint64_t ConvertOpenThreadUint64(const uint8_t *aValue)
 namespace otbr {
 namespace DBus {
 
+// Properties whose serialized `Get` replies are cached until the
+// corresponding otChangedFlags bits are signalled by the OpenThread core.
+static const struct
+{
+    otChangedFlags mChangedFlags;
+    const char *   mPropertyName;
+} kCacheableProperties[] = {
+    {OT_CHANGED_THREAD_NETDATA, OTBR_DBUS_PROPERTY_NETWORK_DATA_PRPOERTY},
+    {OT_CHANGED_THREAD_NETDATA, OTBR_DBUS_PROPERTY_STABLE_NETWORK_DATA_PRPOERTY},
+    {OT_CHANGED_THREAD_NETWORK_NAME, OTBR_DBUS_PROPERTY_NETWORK_NAME},
+    {OT_CHANGED_THREAD_PANID, OTBR_DBUS_PROPERTY_PANID},
+    {OT_CHANGED_THREAD_EXT_PANID, OTBR_DBUS_PROPERTY_EXTPANID},
+    {OT_CHANGED_THREAD_CHANNEL, OTBR_DBUS_PROPERTY_CHANNEL},
+    {OT_CHANGED_NETWORK_KEY, OTBR_DBUS_PROPERTY_NETWORK_KEY},
+    {OT_CHANGED_ACTIVE_DATASET, OTBR_DBUS_PROPERTY_ACTIVE_DATASET_TLVS},
+    {OT_CHANGED_THREAD_PARTITION_ID, OTBR_DBUS_PROPERTY_PARTITION_ID_PROEPRTY},
+};
+
 DBusThreadObject::DBusThreadObject(DBusConnection *                 aConnection,
                                    const std::string &              aInterfaceName,
                                    otbr::Ncp::ControllerOpenThread *aNcp,
@@ -116,6 +134,12 @@ otbrError DBusThreadObject::Init(void)
     threadHelper->AddDeviceRoleHandler(std::bind(&DBusThreadObject::DeviceRoleHandler, this, _1));
     threadHelper->AddActiveDatasetChangeHandler(std::bind(&DBusThreadObject::ActiveDatasetChangeHandler, this, _1));
     mNcp->RegisterResetHandler(std::bind(&DBusThreadObject::NcpResetHandler, this));
+    mNcp->AddThreadStateChangedCallback(std::bind(&DBusThreadObject::InvalidatePropertyCaches, this, _1));
+
+    for (const auto &property : kCacheableProperties)
+    {
+        MarkPropertyCacheable(OTBR_DBUS_THREAD_INTERFACE, property.mPropertyName);
+    }
 
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SCAN_METHOD,
                    std::bind(&DBusThreadObject::ScanHandler, this, _1));
@@ -249,6 +273,8 @@ otbrError DBusThreadObject::Init(void)
                                std::bind(&DBusThreadObject::GetRadioSpinelMetricsHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_RCP_INTERFACE_METRICS,
                                std::bind(&DBusThreadObject::GetRcpInterfaceMetricsHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_RADIO_TURNAROUND_METRICS,
+                               std::bind(&DBusThreadObject::GetRadioTurnaroundMetricsHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_UPTIME,
                                std::bind(&DBusThreadObject::GetUptimeHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_RADIO_COEX_METRICS,
@@ -272,6 +298,38 @@ void DBusThreadObject::NcpResetHandler(void)
         std::bind(&DBusThreadObject::ActiveDatasetChangeHandler, this, _1));
     SignalPropertyChanged(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_DEVICE_ROLE,
                           GetDeviceRoleName(OT_DEVICE_ROLE_DISABLED));
+    InvalidatePropertyCaches(~static_cast<otChangedFlags>(0));
+}
+
+void DBusThreadObject::InvalidatePropertyCaches(otChangedFlags aFlags)
+{
+    for (const auto &property : kCacheableProperties)
+    {
+        if (aFlags & property.mChangedFlags)
+        {
+            InvalidatePropertyCache(OTBR_DBUS_THREAD_INTERFACE, property.mPropertyName);
+        }
+    }
+
+    // Push the new leader data so clients keeping a PropertiesChanged-fed
+    // cache can serve their getters without a round trip.
+    if (aFlags & (OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_PARTITION_ID | OT_CHANGED_THREAD_NETDATA))
+    {
+        const auto &snapshot = mNcp->GetStateSnapshot();
+
+        if (snapshot.mLeaderDataValid)
+        {
+            LeaderData leaderData;
+
+            leaderData.mPartitionId       = snapshot.mLeaderData.mPartitionId;
+            leaderData.mWeighting         = snapshot.mLeaderData.mWeighting;
+            leaderData.mDataVersion       = snapshot.mLeaderData.mDataVersion;
+            leaderData.mStableDataVersion = snapshot.mLeaderData.mStableDataVersion;
+            leaderData.mLeaderRouterId    = snapshot.mLeaderData.mLeaderRouterId;
+
+            SignalPropertyChanged(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_LEADER_DATA, leaderData);
+        }
+    }
 }
 
 void DBusThreadObject::ScanHandler(DBusRequest &aRequest)
@@ -652,10 +710,9 @@ exit:
 
 otError DBusThreadObject::GetDeviceRoleHandler(DBusMessageIter &aIter)
 {
-    auto         threadHelper = mNcp->GetThreadHelper();
-    otDeviceRole role         = otThreadGetDeviceRole(threadHelper->GetInstance());
-    std::string  roleName     = GetDeviceRoleName(role);
-    otError      error        = OT_ERROR_NONE;
+    otDeviceRole role     = mNcp->GetStateSnapshot().mDeviceRole;
+    std::string  roleName = GetDeviceRoleName(role);
+    otError      error    = OT_ERROR_NONE;
 
     VerifyOrExit(DBusMessageEncodeToVariant(&aIter, roleName) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
 
@@ -858,12 +915,13 @@ exit:
 
 otError DBusThreadObject::GetLeaderDataHandler(DBusMessageIter &aIter)
 {
-    auto                threadHelper = mNcp->GetThreadHelper();
-    otError             error        = OT_ERROR_NONE;
+    const auto &        snapshot = mNcp->GetStateSnapshot();
+    otError             error    = OT_ERROR_NONE;
     struct otLeaderData data;
     LeaderData          leaderData;
 
-    SuccessOrExit(error = otThreadGetLeaderData(threadHelper->GetInstance(), &data));
+    VerifyOrExit(snapshot.mLeaderDataValid, error = OT_ERROR_DETACHED);
+    data = snapshot.mLeaderData;
     leaderData.mPartitionId       = data.mPartitionId;
     leaderData.mWeighting         = data.mWeighting;
     leaderData.mDataVersion       = data.mDataVersion;
@@ -1040,9 +1098,8 @@ exit:
 
 otError DBusThreadObject::GetPartitionIDHandler(DBusMessageIter &aIter)
 {
-    auto     threadHelper = mNcp->GetThreadHelper();
-    otError  error        = OT_ERROR_NONE;
-    uint32_t partitionId  = otThreadGetPartitionId(threadHelper->GetInstance());
+    otError  error       = OT_ERROR_NONE;
+    uint32_t partitionId = mNcp->GetStateSnapshot().mPartitionId;
 
     VerifyOrExit(DBusMessageEncodeToVariant(&aIter, partitionId) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
 
@@ -1512,6 +1569,28 @@ exit:
     return error;
 }
 
+otError DBusThreadObject::GetRadioTurnaroundMetricsHandler(DBusMessageIter &aIter)
+{
+    otError                error = OT_ERROR_NONE;
+    RadioTurnaroundMetrics radioTurnaroundMetrics;
+
+    const otbr::Ncp::ControllerOpenThread::RadioTurnaroundMetrics &ncpMetrics = mNcp->GetRadioTurnaroundMetrics();
+
+    radioTurnaroundMetrics.mCycleCount      = ncpMetrics.mCycleCount;
+    radioTurnaroundMetrics.mTotalUs         = ncpMetrics.mTotalUs;
+    radioTurnaroundMetrics.mMaxUs           = ncpMetrics.mMaxUs;
+    radioTurnaroundMetrics.mOverBudgetCount = ncpMetrics.mOverBudgetCount;
+    radioTurnaroundMetrics.mBuckets.assign(
+        ncpMetrics.mBuckets,
+        ncpMetrics.mBuckets + otbr::Ncp::ControllerOpenThread::RadioTurnaroundMetrics::kNumBuckets);
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, radioTurnaroundMetrics) == OTBR_ERROR_NONE,
+                 error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+
 otError DBusThreadObject::GetUptimeHandler(DBusMessageIter &aIter)
 {
     otError error = OT_ERROR_NONE;
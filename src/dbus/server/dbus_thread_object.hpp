@@ -85,6 +85,7 @@ private:
     void DeviceRoleHandler(otDeviceRole aDeviceRole);
     void ActiveDatasetChangeHandler(const otOperationalDatasetTlvs &aDatasetTlvs);
     void NcpResetHandler(void);
+    void InvalidatePropertyCaches(otChangedFlags aFlags);
 
     void ScanHandler(DBusRequest &aRequest);
     void EnergyScanHandler(DBusRequest &aRequest);
@@ -153,6 +154,7 @@ private:
     otError GetThreadVersionHandler(DBusMessageIter &aIter);
     otError GetRadioSpinelMetricsHandler(DBusMessageIter &aIter);
     otError GetRcpInterfaceMetricsHandler(DBusMessageIter &aIter);
+    otError GetRadioTurnaroundMetricsHandler(DBusMessageIter &aIter);
     otError GetUptimeHandler(DBusMessageIter &aIter);
     otError GetRadioCoexMetrics(DBusMessageIter &aIter);
 
@@ -36,66 +36,355 @@
 #include "mdns/mdns.hpp"
 
 #include <assert.h>
+#include <inttypes.h>
 
 #include <algorithm>
 #include <functional>
 
+#include "agent/vendor_hooks.hpp"
+#include "common/alloc_tracker.hpp"
 #include "common/code_utils.hpp"
+#include "common/metrics.hpp"
+#include "common/object_pool.hpp"
+#include "common/time.hpp"
+#include "common/tracing.hpp"
+#include "mdns/name_interner.hpp"
 #include "utils/dns_utils.hpp"
+#include "utils/string_utils.hpp"
 
 namespace otbr {
 
 namespace Mdns {
 
+// FNV-1a parameters for the 64-bit registration content hash.
+static constexpr uint64_t kFnvOffsetBasis = 0xcbf29ce484222325ull;
+static constexpr uint64_t kFnvPrime       = 0x100000001b3ull;
+
+// Negative cache TTLs: a definite 'not found' answer is kept longer than a
+// transient resolver failure.
+static constexpr Milliseconds kNegativeCacheNotFoundTtl{10000};
+static constexpr Milliseconds kNegativeCacheDefaultTtl{2000};
+
+// Allocation tag attributing registration and resolution churn to mDNS.
+static const uint8_t kAllocTag = AllocTracker::GetInstance().RegisterTag("mdns");
+
 void Publisher::PublishService(const std::string &aHostName,
                                const std::string &aName,
                                const std::string &aType,
                                const SubTypeList &aSubTypeList,
                                uint16_t           aPort,
-                               const TxtList &    aTxtList,
+                               TxtList            aTxtList,
                                ResultCallback &&  aCallback)
 {
-    mServiceRegistrationBeginTime[std::make_pair(aName, aType)] = Clock::now();
+    AllocTracker::TagScope allocScope(kAllocTag);
 
-    PublishServiceImpl(aHostName, aName, aType, aSubTypeList, aPort, aTxtList, std::move(aCallback));
+    mServiceRegistrationBeginTime[std::make_pair(aName, aType)] = CachedClock::Now();
+
+    PublishServiceImpl(aHostName, aName, aType, aSubTypeList, aPort, std::move(aTxtList), std::move(aCallback));
 }
 
 void Publisher::PublishHost(const std::string &            aName,
                             const std::vector<Ip6Address> &aAddresses,
                             ResultCallback &&              aCallback)
 {
-    mHostRegistrationBeginTime[aName] = Clock::now();
+    AllocTracker::TagScope allocScope(kAllocTag);
+
+    mHostRegistrationBeginTime[aName] = CachedClock::Now();
 
     PublishHostImpl(aName, aAddresses, std::move(aCallback));
 }
 
+void Publisher::UpdateHostAddresses(const std::string &aName, AddressList aAddresses, ResultCallback &&aCallback)
+{
+    AllocTracker::TagScope allocScope(kAllocTag);
+
+    HostRegistration *      hostReg = FindHostRegistration(aName);
+    AddressList             sorted  = SortAddressList(std::move(aAddresses));
+    std::vector<Ip6Address> added;
+    bool                    removed  = false;
+    size_t                  oldIndex = 0;
+    size_t                  newIndex = 0;
+
+    VerifyOrExit(hostReg != nullptr && hostReg->IsCompleted());
+
+    // Merge-walk both sorted lists; an address present before but absent
+    // now is a removal, which the per-record hook cannot express.
+    while (oldIndex < hostReg->mAddresses.size() && newIndex < sorted.size())
+    {
+        if (hostReg->mAddresses[oldIndex] == sorted[newIndex])
+        {
+            oldIndex++;
+            newIndex++;
+        }
+        else if (sorted[newIndex] < hostReg->mAddresses[oldIndex])
+        {
+            added.push_back(sorted[newIndex]);
+            newIndex++;
+        }
+        else
+        {
+            removed = true;
+            break;
+        }
+    }
+    removed = removed || oldIndex < hostReg->mAddresses.size();
+    VerifyOrExit(!removed);
+
+    for (; newIndex < sorted.size(); newIndex++)
+    {
+        added.push_back(sorted[newIndex]);
+    }
+
+    if (added.empty())
+    {
+        std::move(aCallback)(OTBR_ERROR_NONE);
+        ExitNow();
+    }
+
+    for (const Ip6Address &address : added)
+    {
+        VerifyOrExit(AddHostAddressImpl(aName, address) == OTBR_ERROR_NONE);
+    }
+
+    hostReg->mAddresses   = std::move(sorted);
+    hostReg->mContentHash = HostRegistration::ComputeContentHash(hostReg->mName, hostReg->mAddresses);
+
+    otbrLogInfo("Added %zu address(es) to host %s in place", added.size(), aName.c_str());
+    std::move(aCallback)(OTBR_ERROR_NONE);
+
+exit:
+    if (!aCallback.IsNull())
+    {
+        // The delta could not be applied (or failed partway, in which case
+        // the duplicate-registration check sees the outdated address list
+        // and rebuilds the registration); republish the full set.
+        PublishHost(aName, sorted, std::move(aCallback));
+    }
+}
+
+void Publisher::PublishBatch(std::vector<BatchRecord> aRecords, BatchResultCallback &&aCallback)
+{
+    // Shared across the per-record adapter callbacks; each adapter only
+    // captures the context pointer and its record index, which fits the
+    // `OnceCallback` inline storage, so no per-record heap allocation.
+    struct BatchContext
+    {
+        BatchContext(size_t aSize, BatchResultCallback &&aCallback)
+            : mErrors(aSize, OTBR_ERROR_NONE)
+            , mRemaining(aSize)
+            , mCallback(std::move(aCallback))
+        {
+        }
+
+        std::vector<otbrError> mErrors;
+        size_t                 mRemaining;
+        BatchResultCallback    mCallback;
+    };
+
+    std::shared_ptr<BatchContext> context;
+
+    if (aRecords.empty())
+    {
+        std::move(aCallback)(std::vector<otbrError>());
+        ExitNow();
+    }
+
+    context = std::make_shared<BatchContext>(aRecords.size(), std::move(aCallback));
+
+    BeginTransaction();
+
+    for (size_t i = 0; i < aRecords.size(); i++)
+    {
+        BatchRecord &  record = aRecords[i];
+        ResultCallback callback([context, i](otbrError aError) {
+            context->mErrors[i] = aError;
+
+            if (--context->mRemaining == 0)
+            {
+                std::move(context->mCallback)(context->mErrors);
+            }
+        });
+
+        switch (record.mKind)
+        {
+        case BatchRecord::Kind::kPublishService:
+            PublishService(record.mHostName, record.mName, record.mType, record.mSubTypeList, record.mPort,
+                           std::move(record.mTxtList), std::move(callback));
+            break;
+
+        case BatchRecord::Kind::kUnpublishService:
+            UnpublishService(record.mName, record.mType, std::move(callback));
+            break;
+
+        case BatchRecord::Kind::kPublishHost:
+            PublishHost(record.mName, record.mAddresses, std::move(callback));
+            break;
+
+        case BatchRecord::Kind::kUnpublishHost:
+            UnpublishHost(record.mName, std::move(callback));
+            break;
+        }
+    }
+
+    EndTransaction();
+
+exit:
+    return;
+}
+
 void Publisher::OnServiceResolveFailed(const std::string &aType, const std::string &aInstanceName, int32_t aErrorCode)
 {
-    UpdateMdnsResponseCounters(mTelemetryInfo.mServiceResolutions, DnsErrorToOtbrError(aErrorCode));
+    static Metrics::Counter &sFailures = Metrics::GetInstance().RegisterCounter(
+        "otbr_mdns_service_resolution_failures_total", "Number of failed mDNS service resolutions.");
+    NegativeCacheEntry &entry = mServiceResolveFailures[ServiceRegistrationKey(aInstanceName, aType)];
+
+    sFailures.Increment();
+
+    entry.mErrorCode  = aErrorCode;
+    entry.mExpireTime = CachedClock::Now() + (DnsErrorToOtbrError(aErrorCode) == OTBR_ERROR_NOT_FOUND
+                                            ? kNegativeCacheNotFoundTtl
+                                            : kNegativeCacheDefaultTtl);
+
+    mServiceResolutionCounters.Record(DnsErrorToOtbrError(aErrorCode), GetBackendLabel());
     UpdateServiceInstanceResolutionEmaLatency(aInstanceName, aType, DnsErrorToOtbrError(aErrorCode));
     OnServiceResolveFailedImpl(aType, aInstanceName, aErrorCode);
 }
 
 void Publisher::OnHostResolveFailed(const std::string &aHostName, int32_t aErrorCode)
 {
-    UpdateMdnsResponseCounters(mTelemetryInfo.mHostResolutions, DnsErrorToOtbrError(aErrorCode));
+    static Metrics::Counter &sFailures = Metrics::GetInstance().RegisterCounter(
+        "otbr_mdns_host_resolution_failures_total", "Number of failed mDNS host resolutions.");
+    NegativeCacheEntry &entry = mHostResolveFailures[HostRegistrationKey(aHostName)];
+
+    sFailures.Increment();
+
+    entry.mErrorCode  = aErrorCode;
+    entry.mExpireTime = CachedClock::Now() + (DnsErrorToOtbrError(aErrorCode) == OTBR_ERROR_NOT_FOUND
+                                            ? kNegativeCacheNotFoundTtl
+                                            : kNegativeCacheDefaultTtl);
+
+    mHostResolutionCounters.Record(DnsErrorToOtbrError(aErrorCode), GetBackendLabel());
     UpdateHostResolutionEmaLatency(aHostName, DnsErrorToOtbrError(aErrorCode));
     OnHostResolveFailedImpl(aHostName, aErrorCode);
 }
 
+void Publisher::SubscribeService(const std::string &aType, const std::string &aInstanceName)
+{
+    if (!aInstanceName.empty())
+    {
+        auto it = mServiceResolveFailures.find(ServiceRegistrationKey(aInstanceName, aType));
+
+        if (it != mServiceResolveFailures.end())
+        {
+            if (CachedClock::Now() < it->second.mExpireTime)
+            {
+                mTelemetryInfo.mServiceResolutionNegativeCacheHits++;
+                otbrLogInfo("Answering subscription to %s.%s from the negative cache", aInstanceName.c_str(),
+                            aType.c_str());
+                mNegativeCachedServiceSubscriptions.insert(it->first);
+                OnServiceResolveFailedImpl(aType, aInstanceName, it->second.mErrorCode);
+                ExitNow();
+            }
+
+            mServiceResolveFailures.erase(it);
+        }
+    }
+
+    SubscribeServiceImpl(aType, aInstanceName);
+
+exit:
+    return;
+}
+
+void Publisher::UnsubscribeService(const std::string &aType, const std::string &aInstanceName)
+{
+    if (!aInstanceName.empty())
+    {
+        auto it = mNegativeCachedServiceSubscriptions.find(ServiceRegistrationKey(aInstanceName, aType));
+
+        if (it != mNegativeCachedServiceSubscriptions.end())
+        {
+            // The backend never saw this subscription; it was answered from
+            // the negative cache.
+            mNegativeCachedServiceSubscriptions.erase(it);
+            ExitNow();
+        }
+    }
+
+    UnsubscribeServiceImpl(aType, aInstanceName);
+
+exit:
+    return;
+}
+
+void Publisher::SubscribeHost(const std::string &aHostName)
+{
+    auto it = mHostResolveFailures.find(HostRegistrationKey(aHostName));
+
+    if (it != mHostResolveFailures.end())
+    {
+        if (CachedClock::Now() < it->second.mExpireTime)
+        {
+            mTelemetryInfo.mHostResolutionNegativeCacheHits++;
+            otbrLogInfo("Answering subscription to host %s from the negative cache", aHostName.c_str());
+            mNegativeCachedHostSubscriptions.insert(it->first);
+            OnHostResolveFailedImpl(aHostName, it->second.mErrorCode);
+            ExitNow();
+        }
+
+        mHostResolveFailures.erase(it);
+    }
+
+    SubscribeHostImpl(aHostName);
+
+exit:
+    return;
+}
+
+void Publisher::UnsubscribeHost(const std::string &aHostName)
+{
+    auto it = mNegativeCachedHostSubscriptions.find(HostRegistrationKey(aHostName));
+
+    if (it != mNegativeCachedHostSubscriptions.end())
+    {
+        // The backend never saw this subscription; it was answered from the
+        // negative cache.
+        mNegativeCachedHostSubscriptions.erase(it);
+        ExitNow();
+    }
+
+    UnsubscribeHostImpl(aHostName);
+
+exit:
+    return;
+}
+
 otbrError Publisher::EncodeTxtData(const TxtList &aTxtList, std::vector<uint8_t> &aTxtData)
 {
-    otbrError error = OTBR_ERROR_NONE;
+    otbrError error     = OTBR_ERROR_NONE;
+    size_t    totalSize = 0;
 
+    // Validate the entries and precompute the encoded size first, so that the
+    // encoding pass below writes into a buffer sized once up front and never
+    // reallocates.
     for (const auto &txtEntry : aTxtList)
     {
-        const auto & name        = txtEntry.mName;
-        const auto & value       = txtEntry.mValue;
-        const size_t entryLength = name.length() + 1 + value.size();
+        const size_t entryLength = txtEntry.mName.length() + 1 + txtEntry.mValue.size();
 
         VerifyOrExit(entryLength <= kMaxTextEntrySize, error = OTBR_ERROR_INVALID_ARGS);
 
-        aTxtData.push_back(static_cast<uint8_t>(entryLength));
+        totalSize += entryLength + 1;
+    }
+
+    aTxtData.clear();
+    aTxtData.reserve(totalSize);
+
+    for (const auto &txtEntry : aTxtList)
+    {
+        const auto &name  = txtEntry.mName;
+        const auto &value = txtEntry.mValue;
+
+        aTxtData.push_back(static_cast<uint8_t>(name.length() + 1 + value.size()));
         aTxtData.insert(aTxtData.end(), name.begin(), name.end());
         aTxtData.push_back('=');
         aTxtData.insert(aTxtData.end(), value.begin(), value.end());
@@ -141,36 +430,63 @@ exit:
 
 void Publisher::RemoveSubscriptionCallbacks(uint64_t aSubscriberId)
 {
-    size_t erased;
-
-    OTBR_UNUSED_VARIABLE(erased);
+    size_t slot;
 
     assert(aSubscriberId > 0);
 
-    erased = mDiscoveredCallbacks.erase(aSubscriberId);
+    // The low half of the id is the slot index plus one; the high half must
+    // match the slot's current generation or the id is stale.
+    slot = static_cast<size_t>(aSubscriberId & 0xffffffff) - 1;
+
+    assert(slot < kMaxSubscribers);
+    assert(mSubscribers[slot].mGeneration == static_cast<uint32_t>(aSubscriberId >> 32));
+    assert(mSubscribers[slot].mInstanceCallback != nullptr || mSubscribers[slot].mHostCallback != nullptr);
 
-    assert(erased == 1);
+    // Bumping the generation invalidates the removed id before the slot is
+    // handed out again.
+    mSubscribers[slot].mInstanceCallback = nullptr;
+    mSubscribers[slot].mHostCallback     = nullptr;
+    mSubscribers[slot].mGeneration++;
 }
 
 uint64_t Publisher::AddSubscriptionCallbacks(Publisher::DiscoveredServiceInstanceCallback aInstanceCallback,
                                              Publisher::DiscoveredHostCallback            aHostCallback)
 {
-    uint64_t subscriberId = mNextSubscriberId++;
+    size_t slot;
 
-    assert(subscriberId > 0);
+    for (slot = 0; slot < kMaxSubscribers; slot++)
+    {
+        if (mSubscribers[slot].mInstanceCallback == nullptr && mSubscribers[slot].mHostCallback == nullptr)
+        {
+            break;
+        }
+    }
 
-    mDiscoveredCallbacks.emplace(subscriberId, std::make_pair(std::move(aInstanceCallback), std::move(aHostCallback)));
-    return subscriberId;
+    VerifyOrDie(slot < kMaxSubscribers, "too many mDNS subscriber callbacks");
+
+    mSubscribers[slot].mInstanceCallback = std::move(aInstanceCallback);
+    mSubscribers[slot].mHostCallback     = std::move(aHostCallback);
+
+    return (static_cast<uint64_t>(mSubscribers[slot].mGeneration) << 32) | static_cast<uint64_t>(slot + 1);
 }
 
 void Publisher::OnServiceResolved(const std::string &aType, const DiscoveredInstanceInfo &aInstanceInfo)
 {
+    static Metrics::Counter &sResolutions = Metrics::GetInstance().RegisterCounter(
+        "otbr_mdns_service_resolutions_total", "Number of successful mDNS service resolutions.");
+    Tracer::Scope          scope("mdns", "OnServiceResolved");
+    AllocTracker::TagScope allocScope(kAllocTag);
+
+    sResolutions.Increment();
+
     otbrLogInfo("Service %s is resolved successfully: %s %s host %s addresses %zu", aType.c_str(),
                 aInstanceInfo.mRemoved ? "remove" : "add", aInstanceInfo.mName.c_str(), aInstanceInfo.mHostName.c_str(),
                 aInstanceInfo.mAddresses.size());
 
     DnsUtils::CheckServiceNameSanity(aType);
 
+    vendor::hooks::HandleMdnsServiceResolved(aType.c_str(), aInstanceInfo.mName.c_str());
+
     assert(aInstanceInfo.mNetifIndex > 0);
 
     if (!aInstanceInfo.mRemoved)
@@ -178,16 +494,71 @@ void Publisher::OnServiceResolved(const std::string &aType, const DiscoveredInst
         DnsUtils::CheckHostnameSanity(aInstanceInfo.mHostName);
     }
 
-    UpdateMdnsResponseCounters(mTelemetryInfo.mServiceResolutions, OTBR_ERROR_NONE);
+    mServiceResolutionCounters.Record(OTBR_ERROR_NONE, GetBackendLabel());
     UpdateServiceInstanceResolutionEmaLatency(aInstanceInfo.mName, aType, OTBR_ERROR_NONE);
 
-    for (const auto &subCallback : mDiscoveredCallbacks)
+    // A successful resolution invalidates any cached failure for the instance.
+    mServiceResolveFailures.erase(ServiceRegistrationKey(aInstanceInfo.mName, aType));
+
+    mPendingDiscoveredInstances[NameInterner::GetInstance().Intern(aType).GetId()].push_back(aInstanceInfo);
+
+    if (mDiscoveryBatchWindow == Milliseconds::zero())
+    {
+        FlushDiscoveryBatches();
+    }
+    else if (!mDiscoveryBatchPending)
+    {
+        mDiscoveryBatchPending  = true;
+        mDiscoveryBatchDeadline = CachedClock::Now() + mDiscoveryBatchWindow;
+    }
+}
+
+void Publisher::UpdateDiscoveryBatchTimeout(MainloopContext &aMainloop)
+{
+    Microseconds delay;
+
+    VerifyOrExit(mDiscoveryBatchPending);
+
+    delay = std::chrono::duration_cast<Microseconds>(mDiscoveryBatchDeadline - CachedClock::Now());
+    delay = std::max(delay, Microseconds::zero());
+
+    if (delay < FromTimeval<Microseconds>(aMainloop.mTimeout))
+    {
+        aMainloop.mTimeout = ToTimeval(delay);
+    }
+
+exit:
+    return;
+}
+
+void Publisher::FlushDueDiscoveryBatches(void)
+{
+    VerifyOrExit(mDiscoveryBatchPending && CachedClock::Now() >= mDiscoveryBatchDeadline);
+
+    FlushDiscoveryBatches();
+
+exit:
+    return;
+}
+
+void Publisher::FlushDiscoveryBatches(void)
+{
+    Tracer::Scope scope("mdns", "FlushDiscoveryBatches");
+
+    mDiscoveryBatchPending = false;
+
+    for (const auto &batch : mPendingDiscoveredInstances)
     {
-        if (subCallback.second.first != nullptr)
+        for (const Subscriber &subscriber : mSubscribers)
         {
-            subCallback.second.first(aType, aInstanceInfo);
+            if (subscriber.mInstanceCallback != nullptr)
+            {
+                subscriber.mInstanceCallback(NameInterner::GetInstance().GetString(batch.first), batch.second);
+            }
         }
     }
+
+    mPendingDiscoveredInstances.clear();
 }
 
 void Publisher::OnServiceRemoved(uint32_t aNetifIndex, const std::string &aType, const std::string &aInstanceName)
@@ -205,6 +576,13 @@ void Publisher::OnServiceRemoved(uint32_t aNetifIndex, const std::string &aType,
 
 void Publisher::OnHostResolved(const std::string &aHostName, const Publisher::DiscoveredHostInfo &aHostInfo)
 {
+    static Metrics::Counter &sResolutions = Metrics::GetInstance().RegisterCounter(
+        "otbr_mdns_host_resolutions_total", "Number of successful mDNS host resolutions.");
+    Tracer::Scope          scope("mdns", "OnHostResolved");
+    AllocTracker::TagScope allocScope(kAllocTag);
+
+    sResolutions.Increment();
+
     otbrLogInfo("Host %s is resolved successfully: host %s addresses %zu ttl %u", aHostName.c_str(),
                 aHostInfo.mHostName.c_str(), aHostInfo.mAddresses.size(), aHostInfo.mTtl);
 
@@ -213,14 +591,17 @@ void Publisher::OnHostResolved(const std::string &aHostName, const Publisher::Di
         DnsUtils::CheckHostnameSanity(aHostInfo.mHostName);
     }
 
-    UpdateMdnsResponseCounters(mTelemetryInfo.mHostResolutions, OTBR_ERROR_NONE);
+    mHostResolutionCounters.Record(OTBR_ERROR_NONE, GetBackendLabel());
     UpdateHostResolutionEmaLatency(aHostName, OTBR_ERROR_NONE);
 
-    for (const auto &subCallback : mDiscoveredCallbacks)
+    // A successful resolution invalidates any cached failure for the host.
+    mHostResolveFailures.erase(HostRegistrationKey(aHostName));
+
+    for (const Subscriber &subscriber : mSubscribers)
     {
-        if (subCallback.second.second != nullptr)
+        if (subscriber.mHostCallback != nullptr)
         {
-            subCallback.second.second(aHostName, aHostInfo);
+            subscriber.mHostCallback(aHostName, aHostInfo);
         }
     }
 }
@@ -254,6 +635,30 @@ std::string Publisher::MakeFullHostName(const std::string &aName)
     return aName + ".local";
 }
 
+const std::string &Publisher::ServiceRegistrationKey(const std::string &aName, const std::string &aType)
+{
+    mRegistrationKeyBuffer.assign(aName);
+    mRegistrationKeyBuffer.append(".");
+    mRegistrationKeyBuffer.append(aType);
+    mRegistrationKeyBuffer.append(".local");
+
+    // DNS-SD names are case-insensitive; normalizing the reused scratch
+    // buffer in place keeps lookups both correct and allocation-free.
+    StringUtils::ConvertToLowercase(mRegistrationKeyBuffer);
+
+    return mRegistrationKeyBuffer;
+}
+
+const std::string &Publisher::HostRegistrationKey(const std::string &aName)
+{
+    mRegistrationKeyBuffer.assign(aName);
+    mRegistrationKeyBuffer.append(".local");
+
+    StringUtils::ConvertToLowercase(mRegistrationKeyBuffer);
+
+    return mRegistrationKeyBuffer;
+}
+
 void Publisher::AddServiceRegistration(ServiceRegistrationPtr &&aServiceReg)
 {
     mServiceRegistrations.emplace(MakeFullServiceName(aServiceReg->mName, aServiceReg->mType), std::move(aServiceReg));
@@ -261,7 +666,7 @@ void Publisher::AddServiceRegistration(ServiceRegistrationPtr &&aServiceReg)
 
 void Publisher::RemoveServiceRegistration(const std::string &aName, const std::string &aType, otbrError aError)
 {
-    auto                   it = mServiceRegistrations.find(MakeFullServiceName(aName, aType));
+    auto                   it = mServiceRegistrations.find(ServiceRegistrationKey(aName, aType));
     ServiceRegistrationPtr serviceReg;
 
     otbrLogInfo("Removing service %s.%s", aName.c_str(), aType.c_str());
@@ -280,7 +685,7 @@ exit:
 
 Publisher::ServiceRegistration *Publisher::FindServiceRegistration(const std::string &aName, const std::string &aType)
 {
-    auto it = mServiceRegistrations.find(MakeFullServiceName(aName, aType));
+    auto it = mServiceRegistrations.find(ServiceRegistrationKey(aName, aType));
 
     return it != mServiceRegistrations.end() ? it->second.get() : nullptr;
 }
@@ -306,6 +711,9 @@ Publisher::ResultCallback Publisher::HandleDuplicateServiceRegistration(const st
     {
         // Returns success if the same service has already been
         // registered with exactly the same parameters.
+        mSuppressedServiceRepublishes++;
+        otbrLogDebug("Suppressed republish of unchanged service %s.%s (total %" PRIu64 ")", aName.c_str(),
+                     aType.c_str(), mSuppressedServiceRepublishes);
         std::move(aCallback)(OTBR_ERROR_NONE);
     }
     else
@@ -343,6 +751,9 @@ Publisher::ResultCallback Publisher::HandleDuplicateHostRegistration(const std::
     {
         // Returns success if the same service has already been
         // registered with exactly the same parameters.
+        mSuppressedHostRepublishes++;
+        otbrLogDebug("Suppressed republish of unchanged host %s (total %" PRIu64 ")", aName.c_str(),
+                     mSuppressedHostRepublishes);
         std::move(aCallback)(OTBR_ERROR_NONE);
     }
     else
@@ -370,7 +781,7 @@ void Publisher::AddHostRegistration(HostRegistrationPtr &&aHostReg)
 
 void Publisher::RemoveHostRegistration(const std::string &aName, otbrError aError)
 {
-    auto                it = mHostRegistrations.find(MakeFullHostName(aName));
+    auto                it = mHostRegistrations.find(HostRegistrationKey(aName));
     HostRegistrationPtr hostReg;
 
     otbrLogInfo("Removing host %s", aName.c_str());
@@ -390,7 +801,7 @@ exit:
 
 Publisher::HostRegistration *Publisher::FindHostRegistration(const std::string &aName)
 {
-    auto it = mHostRegistrations.find(MakeFullHostName(aName));
+    auto it = mHostRegistrations.find(HostRegistrationKey(aName));
 
     return it != mHostRegistrations.end() ? it->second.get() : nullptr;
 }
@@ -400,6 +811,109 @@ Publisher::Registration::~Registration(void)
     TriggerCompleteCallback(OTBR_ERROR_ABORTED);
 }
 
+// The concrete registration types (per mDNS backend, service and host) fall
+// into a handful of sizes; one slab pool per size class keeps lease-renewal
+// churn from fragmenting the general heap.
+static constexpr size_t kRegistrationSizeGranularity = 64;
+static constexpr size_t kRegistrationNumSizeClasses  = 8;
+static constexpr size_t kRegistrationSlotsPerSlab    = 32;
+
+static ObjectPool *GetRegistrationPool(size_t aSize)
+{
+    static ObjectPool *sPools[kRegistrationNumSizeClasses];
+    ObjectPool **      pool = nullptr;
+    size_t             sizeClass;
+
+    sizeClass = (aSize + kRegistrationSizeGranularity - 1) / kRegistrationSizeGranularity;
+    VerifyOrExit(sizeClass <= kRegistrationNumSizeClasses);
+
+    pool = &sPools[sizeClass - 1];
+
+    if (*pool == nullptr)
+    {
+        *pool = new ObjectPool(sizeClass * kRegistrationSizeGranularity, kRegistrationSlotsPerSlab);
+    }
+
+exit:
+    return pool != nullptr ? *pool : nullptr;
+}
+
+void *Publisher::Registration::operator new(size_t aSize)
+{
+    ObjectPool *pool = GetRegistrationPool(aSize);
+
+    return pool != nullptr ? pool->Allocate() : ::operator new(aSize);
+}
+
+void Publisher::Registration::operator delete(void *aPointer, size_t aSize)
+{
+    ObjectPool *pool = GetRegistrationPool(aSize);
+
+    if (pool != nullptr)
+    {
+        pool->Free(aPointer);
+    }
+    else
+    {
+        ::operator delete(aPointer);
+    }
+}
+
+uint64_t Publisher::Registration::HashUpdate(uint64_t aHash, const void *aBytes, size_t aLength)
+{
+    const uint8_t *bytes = static_cast<const uint8_t *>(aBytes);
+
+    for (size_t i = 0; i < aLength; i++)
+    {
+        aHash ^= bytes[i];
+        aHash *= kFnvPrime;
+    }
+
+    return aHash;
+}
+
+uint64_t Publisher::Registration::HashUpdate(uint64_t aHash, const std::string &aString)
+{
+    uint64_t length = aString.length();
+
+    // The length keeps adjacent variable-length fields from aliasing.
+    aHash = HashUpdate(aHash, &length, sizeof(length));
+
+    return HashUpdate(aHash, aString.data(), aString.length());
+}
+
+uint64_t Publisher::ServiceRegistration::ComputeContentHash(const std::string &aHostName,
+                                                            const std::string &aName,
+                                                            const std::string &aType,
+                                                            const SubTypeList &aSubTypeList,
+                                                            uint16_t           aPort,
+                                                            const TxtList &    aTxtList)
+{
+    uint64_t hash = kFnvOffsetBasis;
+
+    hash = HashUpdate(hash, aHostName);
+    hash = HashUpdate(hash, aName);
+    hash = HashUpdate(hash, aType);
+
+    for (const std::string &subType : aSubTypeList)
+    {
+        hash = HashUpdate(hash, subType);
+    }
+
+    hash = HashUpdate(hash, &aPort, sizeof(aPort));
+
+    for (const TxtEntry &txtEntry : aTxtList)
+    {
+        uint64_t valueLength = txtEntry.mValue.size();
+
+        hash = HashUpdate(hash, txtEntry.mName);
+        hash = HashUpdate(hash, &valueLength, sizeof(valueLength));
+        hash = HashUpdate(hash, txtEntry.mValue.data(), txtEntry.mValue.size());
+    }
+
+    return hash;
+}
+
 bool Publisher::ServiceRegistration::IsOutdated(const std::string &aHostName,
                                                 const std::string &aName,
                                                 const std::string &aType,
@@ -407,8 +921,9 @@ bool Publisher::ServiceRegistration::IsOutdated(const std::string &aHostName,
                                                 uint16_t           aPort,
                                                 const TxtList &    aTxtList) const
 {
-    return !(mHostName == aHostName && mName == aName && mType == aType && mSubTypeList == aSubTypeList &&
-             mPort == aPort && mTxtList == aTxtList);
+    // A 64-bit content hash collision between two contents of the same
+    // service instance is considered negligible.
+    return mContentHash != ComputeContentHash(aHostName, aName, aType, aSubTypeList, aPort, aTxtList);
 }
 
 void Publisher::ServiceRegistration::Complete(otbrError aError)
@@ -421,14 +936,30 @@ void Publisher::ServiceRegistration::OnComplete(otbrError aError)
 {
     if (!IsCompleted())
     {
-        mPublisher->UpdateMdnsResponseCounters(mPublisher->mTelemetryInfo.mServiceRegistrations, aError);
+        mPublisher->mServiceRegistrationCounters.Record(aError, mPublisher->GetBackendLabel());
         mPublisher->UpdateServiceRegistrationEmaLatency(mName, mType, aError);
     }
 }
 
+uint64_t Publisher::HostRegistration::ComputeContentHash(const std::string &            aName,
+                                                         const std::vector<Ip6Address> &aAddresses)
+{
+    uint64_t    hash   = kFnvOffsetBasis;
+    AddressList sorted = SortAddressList(aAddresses);
+
+    hash = HashUpdate(hash, aName);
+
+    for (const Ip6Address &address : sorted)
+    {
+        hash = HashUpdate(hash, address.m8, sizeof(address.m8));
+    }
+
+    return hash;
+}
+
 bool Publisher::HostRegistration::IsOutdated(const std::string &aName, const std::vector<Ip6Address> &aAddresses) const
 {
-    return !(mName == aName && mAddresses == aAddresses);
+    return mContentHash != ComputeContentHash(aName, aAddresses);
 }
 
 void Publisher::HostRegistration::Complete(otbrError aError)
@@ -441,35 +972,81 @@ void Publisher::HostRegistration::OnComplete(otbrError aError)
 {
     if (!IsCompleted())
     {
-        mPublisher->UpdateMdnsResponseCounters(mPublisher->mTelemetryInfo.mHostRegistrations, aError);
+        mPublisher->mHostRegistrationCounters.Record(aError, mPublisher->GetBackendLabel());
         mPublisher->UpdateHostRegistrationEmaLatency(mName, aError);
     }
 }
 
-void Publisher::UpdateMdnsResponseCounters(otbr::MdnsResponseCounters &aCounters, otbrError aError)
+Publisher::ResponseErrorClass Publisher::ClassifyResponseError(otbrError aError)
 {
+    ResponseErrorClass errorClass;
+
     switch (aError)
     {
     case OTBR_ERROR_NONE:
-        ++aCounters.mSuccess;
+        errorClass = kResponseSuccess;
         break;
     case OTBR_ERROR_NOT_FOUND:
-        ++aCounters.mNotFound;
+        errorClass = kResponseNotFound;
         break;
     case OTBR_ERROR_INVALID_ARGS:
-        ++aCounters.mInvalidArgs;
+        errorClass = kResponseInvalidArgs;
         break;
     case OTBR_ERROR_DUPLICATED:
-        ++aCounters.mDuplicated;
+        errorClass = kResponseDuplicated;
         break;
     case OTBR_ERROR_NOT_IMPLEMENTED:
-        ++aCounters.mNotImplemented;
+        errorClass = kResponseNotImplemented;
         break;
     case OTBR_ERROR_MDNS:
     default:
-        ++aCounters.mUnknownError;
+        errorClass = kResponseUnknownError;
         break;
     }
+
+    return errorClass;
+}
+
+void Publisher::ResponseCounterCells::Record(otbrError aError, const char *aBackendLabel)
+{
+    // The metric name segment of each error class, indexed by `ResponseErrorClass`.
+    static const char *const kResponseClassNames[kNumResponseErrorClasses] = {
+        "success", "not_found", "invalid_args", "duplicated", "not_implemented", "unknown_error",
+    };
+    ResponseErrorClass errorClass = ClassifyResponseError(aError);
+
+    mCells[errorClass].fetch_add(1, std::memory_order_relaxed);
+
+    if (mExports[errorClass] == nullptr)
+    {
+        mExports[errorClass] = &Metrics::GetInstance().RegisterCounter(
+            std::string("otbr_mdns_") + aBackendLabel + "_" + mOperation + "_" + kResponseClassNames[errorClass] +
+                "_total",
+            std::string("Number of ") + kResponseClassNames[errorClass] + " mDNS " + mOperation + " responses.");
+    }
+    mExports[errorClass]->Increment();
+}
+
+void Publisher::ResponseCounterCells::RollUp(otbr::MdnsResponseCounters &aCounters) const
+{
+    aCounters.mSuccess        = mCells[kResponseSuccess].load(std::memory_order_relaxed);
+    aCounters.mNotFound       = mCells[kResponseNotFound].load(std::memory_order_relaxed);
+    aCounters.mInvalidArgs    = mCells[kResponseInvalidArgs].load(std::memory_order_relaxed);
+    aCounters.mDuplicated     = mCells[kResponseDuplicated].load(std::memory_order_relaxed);
+    aCounters.mNotImplemented = mCells[kResponseNotImplemented].load(std::memory_order_relaxed);
+    aCounters.mUnknownError   = mCells[kResponseUnknownError].load(std::memory_order_relaxed);
+}
+
+const MdnsTelemetryInfo &Publisher::GetMdnsTelemetryInfo(void) const
+{
+    // The cells are authoritative; the plain structs handed to telemetry
+    // consumers are refreshed only when somebody actually reads them.
+    mHostRegistrationCounters.RollUp(mTelemetryInfo.mHostRegistrations);
+    mServiceRegistrationCounters.RollUp(mTelemetryInfo.mServiceRegistrations);
+    mHostResolutionCounters.RollUp(mTelemetryInfo.mHostResolutions);
+    mServiceResolutionCounters.RollUp(mTelemetryInfo.mServiceResolutions);
+
+    return mTelemetryInfo;
 }
 
 void Publisher::UpdateEmaLatency(uint32_t &aEmaLatency, uint32_t aLatency, otbrError aError)
@@ -492,6 +1069,24 @@ exit:
     return;
 }
 
+void Publisher::UpdateLatencyHistogram(otbr::MdnsLatencyHistogram &aHistogram, uint32_t aLatency, otbrError aError)
+{
+    uint8_t bucket = 0;
+
+    VerifyOrExit(aError != OTBR_ERROR_ABORTED);
+
+    while (aLatency != 0 && bucket < MdnsLatencyHistogram::kBucketCount - 1)
+    {
+        aLatency >>= 1;
+        ++bucket;
+    }
+
+    ++aHistogram.mBuckets[bucket];
+
+exit:
+    return;
+}
+
 void Publisher::UpdateServiceRegistrationEmaLatency(const std::string &aInstanceName,
                                                     const std::string &aType,
                                                     otbrError          aError)
@@ -500,8 +1095,9 @@ void Publisher::UpdateServiceRegistrationEmaLatency(const std::string &aInstance
 
     if (it != mServiceRegistrationBeginTime.end())
     {
-        uint32_t latency = std::chrono::duration_cast<Milliseconds>(Clock::now() - it->second).count();
+        uint32_t latency = std::chrono::duration_cast<Milliseconds>(CachedClock::Now() - it->second).count();
         UpdateEmaLatency(mTelemetryInfo.mServiceRegistrationEmaLatency, latency, aError);
+        UpdateLatencyHistogram(mTelemetryInfo.mServiceRegistrationLatencyHistogram, latency, aError);
         mServiceRegistrationBeginTime.erase(it);
     }
 }
@@ -512,8 +1108,9 @@ void Publisher::UpdateHostRegistrationEmaLatency(const std::string &aHostName, o
 
     if (it != mHostRegistrationBeginTime.end())
     {
-        uint32_t latency = std::chrono::duration_cast<Milliseconds>(Clock::now() - it->second).count();
+        uint32_t latency = std::chrono::duration_cast<Milliseconds>(CachedClock::Now() - it->second).count();
         UpdateEmaLatency(mTelemetryInfo.mHostRegistrationEmaLatency, latency, aError);
+        UpdateLatencyHistogram(mTelemetryInfo.mHostRegistrationLatencyHistogram, latency, aError);
         mHostRegistrationBeginTime.erase(it);
     }
 }
@@ -526,8 +1123,9 @@ void Publisher::UpdateServiceInstanceResolutionEmaLatency(const std::string &aIn
 
     if (it != mServiceInstanceResolutionBeginTime.end())
     {
-        uint32_t latency = std::chrono::duration_cast<Milliseconds>(Clock::now() - it->second).count();
+        uint32_t latency = std::chrono::duration_cast<Milliseconds>(CachedClock::Now() - it->second).count();
         UpdateEmaLatency(mTelemetryInfo.mServiceResolutionEmaLatency, latency, aError);
+        UpdateLatencyHistogram(mTelemetryInfo.mServiceResolutionLatencyHistogram, latency, aError);
         mServiceInstanceResolutionBeginTime.erase(it);
     }
 }
@@ -538,8 +1136,9 @@ void Publisher::UpdateHostResolutionEmaLatency(const std::string &aHostName, otb
 
     if (it != mHostResolutionBeginTime.end())
     {
-        uint32_t latency = std::chrono::duration_cast<Milliseconds>(Clock::now() - it->second).count();
+        uint32_t latency = std::chrono::duration_cast<Milliseconds>(CachedClock::Now() - it->second).count();
         UpdateEmaLatency(mTelemetryInfo.mHostResolutionEmaLatency, latency, aError);
+        UpdateLatencyHistogram(mTelemetryInfo.mHostResolutionLatencyHistogram, latency, aError);
         mHostResolutionBeginTime.erase(it);
     }
 }
@@ -34,16 +34,21 @@
 #ifndef OTBR_AGENT_MDNS_HPP_
 #define OTBR_AGENT_MDNS_HPP_
 
+#include <atomic>
 #include <functional>
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include <sys/select.h>
 
 #include "common/callback.hpp"
 #include "common/code_utils.hpp"
+#include "common/mainloop.hpp"
+#include "common/metrics.hpp"
 #include "common/time.hpp"
 #include "common/types.hpp"
 
@@ -129,11 +134,14 @@ public:
     };
 
     /**
-     * This function is called to notify a discovered service instance.
+     * This function is called to notify discovered service instances.
+     *
+     * Instances of the same service type resolved within the batching window (see
+     * `SetDiscoveryEventBatchWindow()`) are delivered together in a single call.
      *
      */
     using DiscoveredServiceInstanceCallback =
-        std::function<void(const std::string &aType, const DiscoveredInstanceInfo &aInstanceInfo)>;
+        std::function<void(const std::string &aType, const std::vector<DiscoveredInstanceInfo> &aInstances)>;
 
     /**
      * This function is called to notify a discovered host.
@@ -193,7 +201,8 @@ public:
      * @param[in] aType         The type of this service.
      * @param[in] aSubTypeList  A list of service subtypes.
      * @param[in] aPort         The port number of this service.
-     * @param[in] aTxtList      A list of TXT name/value pairs.
+     * @param[in] aTxtList      A list of TXT name/value pairs. Callers done with the list should move it
+     *                          in to avoid copying the entries.
      * @param[in] aCallback     The callback for receiving the publishing result. `OTBR_ERROR_NONE` will be
      *                          returned if the operation is successful and all other values indicate a
      *                          failure. Specifically, `OTBR_ERROR_DUPLICATED` indicates that the name has
@@ -206,7 +215,7 @@ public:
                         const std::string &aType,
                         const SubTypeList &aSubTypeList,
                         uint16_t           aPort,
-                        const TxtList &    aTxtList,
+                        TxtList            aTxtList,
                         ResultCallback &&  aCallback);
 
     /**
@@ -236,6 +245,23 @@ public:
      */
     void PublishHost(const std::string &aName, const std::vector<Ip6Address> &aAddresses, ResultCallback &&aCallback);
 
+    /**
+     * This method updates the address set of an already published host.
+     *
+     * When the change is purely additive and the backend supports adding
+     * individual AAAA records to an existing registration, the new records
+     * are added in place without re-sending the unchanged ones. In every
+     * other case (unknown host, removed addresses, unsupported or failing
+     * backend) the method falls back to a full `PublishHost()`, so callers
+     * may use it unconditionally.
+     *
+     * @param[in] aName       The name of the host.
+     * @param[in] aAddresses  The new address set of the host.
+     * @param[in] aCallback   The callback for receiving the publishing result.
+     *
+     */
+    void UpdateHostAddresses(const std::string &aName, AddressList aAddresses, ResultCallback &&aCallback);
+
     /**
      * This method un-publishes a host.
      *
@@ -245,6 +271,74 @@ public:
      */
     virtual void UnpublishHost(const std::string &aName, ResultCallback &&aCallback) = 0;
 
+    /**
+     * This structure represents one record in a batched publish request.
+     *
+     * Which fields are meaningful depends on `mKind`: service records use
+     * the host/name/type/subtype/port/TXT fields, host records use the
+     * name/address fields, and un-publish records only need the names.
+     *
+     */
+    struct BatchRecord
+    {
+        enum class Kind
+        {
+            kPublishService,   ///< Publish or update a service; see `PublishService()`.
+            kUnpublishService, ///< Un-publish a service; see `UnpublishService()`.
+            kPublishHost,      ///< Publish or update a host; see `PublishHost()`.
+            kUnpublishHost,    ///< Un-publish a host; see `UnpublishHost()`.
+        };
+
+        Kind        mKind;
+        std::string mHostName;    ///< The host name of a service record.
+        std::string mName;        ///< The service instance name or the host name.
+        std::string mType;        ///< The service type.
+        SubTypeList mSubTypeList; ///< The service subtypes.
+        uint16_t    mPort = 0;    ///< The service port.
+        TxtList     mTxtList;     ///< The service TXT entries.
+        AddressList mAddresses;   ///< The host addresses.
+    };
+
+    using BatchResultCallback = OnceCallback<void(const std::vector<otbrError> &aErrors)>;
+
+    /**
+     * This method publishes a batch of records with one aggregated completion.
+     *
+     * The records are committed inside one transaction and @p aCallback is
+     * invoked exactly once, after every record has completed, with one error
+     * per record in the order of @p aRecords. Callers advertising a host and
+     * its N services this way avoid allocating N per-record completion
+     * closures capturing names for bookkeeping.
+     *
+     * @param[in] aRecords   The records to publish or un-publish.
+     * @param[in] aCallback  The callback receiving the per-record results.
+     *
+     */
+    void PublishBatch(std::vector<BatchRecord> aRecords, BatchResultCallback &&aCallback);
+
+    /**
+     * This method begins a publishing transaction.
+     *
+     * Registrations made before the matching `EndTransaction()` call may be
+     * batched by the implementation and committed to the underlying mDNS
+     * service in a single request. Every registration still receives its own
+     * result callback, but a name collision within a transaction may be
+     * reported to all registrations batched with it. Transactions nest: only
+     * the outermost `EndTransaction()` commits.
+     *
+     * The default implementation does nothing: registrations are committed
+     * individually as they are made.
+     *
+     */
+    virtual void BeginTransaction(void) {}
+
+    /**
+     * This method ends a publishing transaction, committing the registrations
+     * batched since the matching `BeginTransaction()` call.
+     *
+     */
+    virtual void EndTransaction(void) {}
+
     /**
      * This method subscribes a given service or service instance.
      *
@@ -255,11 +349,14 @@ public:
      * @note Discovery Proxy implementation guarantees no duplicate subscriptions for the same service or service
      * instance.
      *
+     * A subscription to a service instance that failed to resolve recently is answered from a short-TTL
+     * negative cache without hitting the resolver again.
+     *
      * @param[in] aType          The service type.
      * @param[in] aInstanceName  The service instance to subscribe, or empty to subscribe the service.
      *
      */
-    virtual void SubscribeService(const std::string &aType, const std::string &aInstanceName) = 0;
+    void SubscribeService(const std::string &aType, const std::string &aInstanceName);
 
     /**
      * This method unsubscribes a given service or service instance.
@@ -273,7 +370,7 @@ public:
      * @param[in] aInstanceName  The service instance to unsubscribe, or empty to unsubscribe the service.
      *
      */
-    virtual void UnsubscribeService(const std::string &aType, const std::string &aInstanceName) = 0;
+    void UnsubscribeService(const std::string &aType, const std::string &aInstanceName);
 
     /**
      * This method subscribes a given host.
@@ -282,10 +379,13 @@ public:
      *
      * @note Discovery Proxy implementation guarantees no duplicate subscriptions for the same host.
      *
+     * A subscription to a host that failed to resolve recently is answered from a short-TTL negative
+     * cache without hitting the resolver again.
+     *
      * @param[in] aHostName  The host name (without domain).
      *
      */
-    virtual void SubscribeHost(const std::string &aHostName) = 0;
+    void SubscribeHost(const std::string &aHostName);
 
     /**
      * This method unsubscribes a given host.
@@ -295,7 +395,7 @@ public:
      * @param[in] aHostName  The host name (without domain).
      *
      */
-    virtual void UnsubscribeHost(const std::string &aHostName) = 0;
+    void UnsubscribeHost(const std::string &aHostName);
 
     /**
      * This method sets the callbacks for subscriptions.
@@ -317,13 +417,29 @@ public:
      */
     void RemoveSubscriptionCallbacks(uint64_t aSubscriberId);
 
+    /**
+     * This method sets the window within which discovery events of the same service type are coalesced.
+     *
+     * During a network-wide re-announcement, resolve events arrive back to back; batching them delivers
+     * one callback invocation per service type and window instead of one per event. A window of zero
+     * (the default) delivers every event immediately.
+     *
+     * @param[in] aWindow  The batching window.
+     *
+     */
+    void SetDiscoveryEventBatchWindow(Milliseconds aWindow) { mDiscoveryBatchWindow = aWindow; }
+
     /**
      * This method returns the mDNS statistics information of the publisher.
      *
+     * The response counters are kept in atomic cells on the hot path and
+     * only rolled up into the returned struct here, so reading telemetry
+     * never perturbs in-flight operations.
+     *
      * @returns  The MdnsTelemetryInfo of the publisher.
      *
      */
-    const MdnsTelemetryInfo &GetMdnsTelemetryInfo() const { return mTelemetryInfo; }
+    const MdnsTelemetryInfo &GetMdnsTelemetryInfo(void) const;
 
     virtual ~Publisher(void) = default;
 
@@ -381,6 +497,24 @@ public:
      */
     static otbrError DecodeTxtData(TxtList &aTxtList, const uint8_t *aTxtData, uint16_t aTxtLength);
 
+    /**
+     * This method returns the number of service republish requests completed
+     * from the registration cache because their content was unchanged.
+     *
+     * @returns The number of suppressed service republishes.
+     *
+     */
+    uint64_t GetSuppressedServiceRepublishCount(void) const { return mSuppressedServiceRepublishes; }
+
+    /**
+     * This method returns the number of host republish requests completed
+     * from the registration cache because their content was unchanged.
+     *
+     * @returns The number of suppressed host republishes.
+     *
+     */
+    uint64_t GetSuppressedHostRepublishCount(void) const { return mSuppressedHostRepublishes; }
+
 protected:
     static constexpr uint8_t kMaxTextEntrySize = 255;
 
@@ -397,11 +531,22 @@ protected:
         }
         virtual ~Registration(void);
 
+        // Registrations churn on every SRP lease cycle, so their storage is
+        // recycled through size-classed slab pools instead of the general
+        // heap; oversized registrations fall back to the heap. The virtual
+        // destructor makes the deletes below see the most-derived size.
+        static void *operator new(size_t aSize);
+        static void  operator delete(void *aPointer, size_t aSize);
+
         // Tells whether the service registration has been completed (typically by calling
         // `ServiceRegistration::Complete`).
         bool IsCompleted() const { return mCallback.IsNull(); }
 
     protected:
+        // FNV-1a accumulation helpers for the registration content hash.
+        static uint64_t HashUpdate(uint64_t aHash, const void *aBytes, size_t aLength);
+        static uint64_t HashUpdate(uint64_t aHash, const std::string &aString);
+
         // Completes the service registration with given result/error.
         void TriggerCompleteCallback(otbrError aError)
         {
@@ -422,6 +567,11 @@ protected:
         uint16_t    mPort;
         TxtList     mTxtList;
 
+        // Hash over the registration content (host name, instance name, type,
+        // subtypes, port and TXT data); identical republish requests are
+        // detected by comparing hashes instead of every field.
+        uint64_t mContentHash;
+
         ServiceRegistration(std::string      aHostName,
                             std::string      aName,
                             std::string      aType,
@@ -438,6 +588,7 @@ protected:
             , mPort(aPort)
             , mTxtList(SortTxtList(std::move(aTxtList)))
         {
+            mContentHash = ComputeContentHash(mHostName, mName, mType, mSubTypeList, mPort, mTxtList);
         }
         ~ServiceRegistration(void) override { OnComplete(OTBR_ERROR_ABORTED); }
 
@@ -445,6 +596,15 @@ protected:
 
         void OnComplete(otbrError aError);
 
+        // Computes the content hash of a service registration. The sub type
+        // and TXT lists MUST be sorted.
+        static uint64_t ComputeContentHash(const std::string &aHostName,
+                                           const std::string &aName,
+                                           const std::string &aType,
+                                           const SubTypeList &aSubTypeList,
+                                           uint16_t           aPort,
+                                           const TxtList &    aTxtList);
+
         // Tells whether this `ServiceRegistration` object is outdated comparing to the given parameters.
         bool IsOutdated(const std::string &aHostName,
                         const std::string &aName,
@@ -460,11 +620,16 @@ protected:
         std::string             mName;
         std::vector<Ip6Address> mAddresses;
 
+        // Hash over the registration content (host name and addresses); see
+        // `ServiceRegistration::mContentHash`.
+        uint64_t mContentHash;
+
         HostRegistration(std::string aName, AddressList aAddresses, ResultCallback &&aCallback, Publisher *aPublisher)
             : Registration(std::move(aCallback), aPublisher)
             , mName(std::move(aName))
             , mAddresses(SortAddressList(std::move(aAddresses)))
         {
+            mContentHash = ComputeContentHash(mName, mAddresses);
         }
 
         ~HostRegistration(void) { OnComplete(OTBR_ERROR_ABORTED); }
@@ -473,14 +638,18 @@ protected:
 
         void OnComplete(otbrError);
 
+        // Computes the content hash of a host registration; the addresses are
+        // hashed in sorted order.
+        static uint64_t ComputeContentHash(const std::string &aName, const std::vector<Ip6Address> &aAddresses);
+
         // Tells whether this `HostRegistration` object is outdated comparing to the given parameters.
         bool IsOutdated(const std::string &aName, const std::vector<Ip6Address> &aAddresses) const;
     };
 
     using ServiceRegistrationPtr = std::unique_ptr<ServiceRegistration>;
-    using ServiceRegistrationMap = std::map<std::string, ServiceRegistrationPtr>;
+    using ServiceRegistrationMap = std::unordered_map<std::string, ServiceRegistrationPtr>;
     using HostRegistrationPtr    = std::unique_ptr<HostRegistration>;
-    using HostRegistrationMap    = std::map<std::string, HostRegistrationPtr>;
+    using HostRegistrationMap    = std::unordered_map<std::string, HostRegistrationPtr>;
 
     static SubTypeList SortSubTypeList(SubTypeList aSubTypeList);
     static TxtList     SortTxtList(TxtList aTxtList);
@@ -488,16 +657,37 @@ protected:
     static std::string MakeFullServiceName(const std::string &aName, const std::string &aType);
     static std::string MakeFullHostName(const std::string &aName);
 
+    // Builds the registration lookup key into a scratch buffer reused across
+    // calls, so per-event lookups do not rebuild a heap string for the key.
+    const std::string &ServiceRegistrationKey(const std::string &aName, const std::string &aType);
+    const std::string &HostRegistrationKey(const std::string &aName);
+
     virtual void PublishServiceImpl(const std::string &aHostName,
                                     const std::string &aName,
                                     const std::string &aType,
                                     const SubTypeList &aSubTypeList,
                                     uint16_t           aPort,
-                                    const TxtList &    aTxtList,
+                                    TxtList            aTxtList,
                                     ResultCallback &&  aCallback)                            = 0;
     virtual void PublishHostImpl(const std::string &            aName,
                                  const std::vector<Ip6Address> &aAddresses,
                                  ResultCallback &&              aCallback)                               = 0;
+
+    // Adds one AAAA record to an existing host registration. Backends
+    // without per-record additions keep the default, which makes
+    // `UpdateHostAddresses()` fall back to a full republish.
+    virtual otbrError AddHostAddressImpl(const std::string &aName, const Ip6Address &aAddress)
+    {
+        OTBR_UNUSED_VARIABLE(aName);
+        OTBR_UNUSED_VARIABLE(aAddress);
+
+        return OTBR_ERROR_NOT_IMPLEMENTED;
+    }
+
+    virtual void SubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName)   = 0;
+    virtual void UnsubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName) = 0;
+    virtual void SubscribeHostImpl(const std::string &aHostName)                                    = 0;
+    virtual void UnsubscribeHostImpl(const std::string &aHostName)                                  = 0;
     virtual void OnServiceResolveFailedImpl(const std::string &aType,
                                             const std::string &aInstanceName,
                                             int32_t            aErrorCode)                            = 0;
@@ -505,10 +695,31 @@ protected:
 
     virtual otbrError DnsErrorToOtbrError(int32_t aError) = 0;
 
+    /**
+     * This method returns the backend label used in exported counter metric names.
+     *
+     * @returns The backend label, e.g. "avahi" or "mdnssd".
+     *
+     */
+    virtual const char *GetBackendLabel(void) const { return "mdns"; }
+
     void AddServiceRegistration(ServiceRegistrationPtr &&aServiceReg);
     void RemoveServiceRegistration(const std::string &aName, const std::string &aType, otbrError aError);
     ServiceRegistration *FindServiceRegistration(const std::string &aName, const std::string &aType);
     void                 OnServiceResolved(const std::string &aType, const DiscoveredInstanceInfo &aInstanceInfo);
+
+    // Clamps the mainloop timeout to the pending discovery-batch deadline;
+    // called from the backends' `Update()`.
+    void UpdateDiscoveryBatchTimeout(MainloopContext &aMainloop);
+
+    // Delivers the pending discovery batches once their window has elapsed;
+    // called from the backends' `Process()`.
+    void FlushDueDiscoveryBatches(void);
+
+    // Fans the pending discovery batches out to the subscribers, one call
+    // per service type.
+    void FlushDiscoveryBatches(void);
+
     void OnServiceResolveFailed(const std::string &aType, const std::string &aInstanceName, int32_t aErrorCode);
     void OnServiceRemoved(uint32_t aNetifIndex, const std::string &aType, const std::string &aInstanceName);
     void OnHostResolved(const std::string &aHostName, const DiscoveredHostInfo &aHostInfo);
@@ -533,8 +744,44 @@ protected:
     void              RemoveHostRegistration(const std::string &aName, otbrError aError);
     HostRegistration *FindHostRegistration(const std::string &aName);
 
-    static void UpdateMdnsResponseCounters(otbr::MdnsResponseCounters &aCounters, otbrError aError);
+    // Error classes of mDNS responses. One atomic cell is kept per class,
+    // so the hot path only bumps a cell and telemetry reads roll the cells
+    // up lazily; adding a class touches this enum and the tables in the
+    // translation unit, never the backends.
+    enum ResponseErrorClass : uint8_t
+    {
+        kResponseSuccess = 0,
+        kResponseNotFound,
+        kResponseInvalidArgs,
+        kResponseDuplicated,
+        kResponseNotImplemented,
+        kResponseUnknownError,
+        kNumResponseErrorClasses,
+    };
+
+    // One set of response counter cells, e.g. for host registrations.
+    // `Record()` is safe to call concurrently; the matching counters in the
+    // process-wide metrics registry are registered on first use under the
+    // label of the publisher backend.
+    struct ResponseCounterCells
+    {
+        explicit ResponseCounterCells(const char *aOperation)
+            : mOperation(aOperation)
+        {
+        }
+
+        void Record(otbrError aError, const char *aBackendLabel);
+        void RollUp(otbr::MdnsResponseCounters &aCounters) const;
+
+        const char *          mOperation;                           // The operation segment of the metric names.
+        std::atomic<uint32_t> mCells[kNumResponseErrorClasses]{};   // One cell per error class.
+        Metrics::Counter *    mExports[kNumResponseErrorClasses]{}; // Registry counters, registered on first use.
+    };
+
+    static ResponseErrorClass ClassifyResponseError(otbrError aError);
+
     static void UpdateEmaLatency(uint32_t &aEmaLatency, uint32_t aLatency, otbrError aError);
+    static void UpdateLatencyHistogram(otbr::MdnsLatencyHistogram &aHistogram, uint32_t aLatency, otbrError aError);
 
     void UpdateServiceRegistrationEmaLatency(const std::string &aInstanceName,
                                              const std::string &aType,
@@ -548,9 +795,56 @@ protected:
     ServiceRegistrationMap mServiceRegistrations;
     HostRegistrationMap    mHostRegistrations;
 
-    uint64_t mNextSubscriberId = 1;
+    // Scratch buffer backing `ServiceRegistrationKey()` and
+    // `HostRegistrationKey()`.
+    std::string mRegistrationKeyBuffer;
+
+    // Recently failed resolutions; a repeated subscription within the entry
+    // TTL is answered locally instead of hitting the resolver again.
+    struct NegativeCacheEntry
+    {
+        Timepoint mExpireTime;
+        int32_t   mErrorCode;
+    };
+
+    std::unordered_map<std::string, NegativeCacheEntry> mServiceResolveFailures;
+    std::unordered_map<std::string, NegativeCacheEntry> mHostResolveFailures;
+
+    // Subscriptions answered from the negative cache; their matching
+    // unsubscriptions must not reach the backend either.
+    std::unordered_set<std::string> mNegativeCachedServiceSubscriptions;
+    std::unordered_set<std::string> mNegativeCachedHostSubscriptions;
+
+    // Republish requests answered from the registration cache because their
+    // content hash was unchanged.
+    uint64_t mSuppressedServiceRepublishes = 0;
+    uint64_t mSuppressedHostRepublishes    = 0;
+
+    // A subscriber callback slot. The id handed out by
+    // `AddSubscriptionCallbacks()` encodes the slot index together with the
+    // slot's generation, so a stale id from a removed subscriber can never
+    // address a reused slot. Discovery fan-out walks the fixed array and
+    // invokes the callbacks in place, with no map traversal or copies.
+    struct Subscriber
+    {
+        DiscoveredServiceInstanceCallback mInstanceCallback = nullptr;
+        DiscoveredHostCallback            mHostCallback     = nullptr;
+        uint32_t                          mGeneration       = 0;
+    };
+
+    static constexpr size_t kMaxSubscribers = 8;
+
+    Subscriber mSubscribers[kMaxSubscribers];
+
+    // Discovery events of the same service type arriving within the batching
+    // window are coalesced and fanned out to the subscribers as one batch.
+    // Batches are keyed by the interned id of the service type (see
+    // `NameInterner`), so a batch cycle materializes no type-string copies.
+    Milliseconds                                                      mDiscoveryBatchWindow{0};
+    bool                                                              mDiscoveryBatchPending = false;
+    Timepoint                                                         mDiscoveryBatchDeadline;
+    std::unordered_map<uint32_t, std::vector<DiscoveredInstanceInfo>> mPendingDiscoveredInstances;
 
-    std::map<uint64_t, std::pair<DiscoveredServiceInstanceCallback, DiscoveredHostCallback>> mDiscoveredCallbacks;
     // {instance name, service type} -> the timepoint to begin service registration
     std::map<std::pair<std::string, std::string>, Timepoint> mServiceRegistrationBeginTime;
     // host name -> the timepoint to begin host registration
@@ -560,7 +854,14 @@ protected:
     // host name -> the timepoint to begin host resolution
     std::map<std::string, Timepoint> mHostResolutionBeginTime;
 
-    otbr::MdnsTelemetryInfo mTelemetryInfo{};
+    // The authoritative response counter cells; the plain structs inside
+    // `mTelemetryInfo` are only refreshed from them on read.
+    ResponseCounterCells mHostRegistrationCounters{"host_registrations"};
+    ResponseCounterCells mServiceRegistrationCounters{"service_registrations"};
+    ResponseCounterCells mHostResolutionCounters{"host_resolutions"};
+    ResponseCounterCells mServiceResolutionCounters{"service_resolutions"};
+
+    mutable otbr::MdnsTelemetryInfo mTelemetryInfo{};
 };
 
 /**
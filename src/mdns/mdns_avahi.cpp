@@ -49,7 +49,9 @@
 #include <string.h>
 #include <sys/socket.h>
 
+#include "common/arena.hpp"
 #include "common/code_utils.hpp"
+#include "common/fd_event_list.hpp"
 #include "common/logging.hpp"
 #include "common/time.hpp"
 
@@ -73,12 +75,27 @@ struct AvahiWatch
      *
      */
     AvahiWatch(int aFd, AvahiWatchEvent aEvents, AvahiWatchCallback aCallback, void *aContext, void *aPoller)
-        : mFd(aFd)
-        , mEvents(aEvents)
-        , mCallback(aCallback)
-        , mContext(aContext)
-        , mPoller(aPoller)
+        : mPoller(aPoller)
     {
+        Reset(aFd, aEvents, aCallback, aContext);
+    }
+
+    /**
+     * This method re-initializes a pooled watch for reuse.
+     *
+     * @param[in] aFd        The file descriptor to watch.
+     * @param[in] aEvents    The events to watch.
+     * @param[in] aCallback  The function to be called when events happend on this file descriptor.
+     * @param[in] aContext   A pointer to application-specific context.
+     *
+     */
+    void Reset(int aFd, AvahiWatchEvent aEvents, AvahiWatchCallback aCallback, void *aContext)
+    {
+        mFd       = aFd;
+        mEvents   = aEvents;
+        mHappened = 0;
+        mCallback = aCallback;
+        mContext  = aContext;
     }
 };
 
@@ -103,10 +120,24 @@ struct AvahiTimeout
      *
      */
     AvahiTimeout(const struct timeval *aTimeout, AvahiTimeoutCallback aCallback, void *aContext, void *aPoller)
-        : mCallback(aCallback)
-        , mContext(aContext)
-        , mPoller(aPoller)
+        : mPoller(aPoller)
     {
+        Reset(aTimeout, aCallback, aContext);
+    }
+
+    /**
+     * This method re-initializes a pooled timer for reuse.
+     *
+     * @param[in] aTimeout   A pointer to the time after which the callback should be called.
+     * @param[in] aCallback  The function to be called after timeout.
+     * @param[in] aContext   A pointer to application-specific context.
+     *
+     */
+    void Reset(const struct timeval *aTimeout, AvahiTimeoutCallback aCallback, void *aContext)
+    {
+        mCallback = aCallback;
+        mContext  = aContext;
+
         if (aTimeout)
         {
             mTimeout = otbr::Clock::now() + otbr::FromTimeval<otbr::Microseconds>(*aTimeout);
@@ -163,6 +194,8 @@ class AvahiPoller : public MainloopProcessor
 public:
     AvahiPoller(void);
 
+    ~AvahiPoller(void) override;
+
     // Implementation of MainloopProcessor.
 
     void Update(MainloopContext &aMainloop) override;
@@ -193,9 +226,24 @@ private:
     static void            TimeoutFree(AvahiTimeout *aTimer);
     void                   TimeoutFree(AvahiTimeout &aTimer);
 
+    void RebuildWatchFds(void);
+
+    // The Avahi client churns watches and timers on every state transition;
+    // freed adapter objects are parked on a free list (up to
+    // `kMaxPooledAdapters` each) and reused instead of reallocated.
+    static constexpr size_t kMaxPooledAdapters = 8;
+
     Watches   mWatches;
+    Watches   mFreeWatches;
     Timers    mTimers;
+    Timers    mFreeTimers;
     AvahiPoll mAvahiPoller;
+
+    // The watch fds are cached as prepared `fd_set`s and rebuilt only when a
+    // watch is added, removed or retargeted, so the per-cycle `Update()` pays
+    // a bulk merge instead of per-watch set construction.
+    FdEventList mWatchFds;
+    bool        mWatchFdsStale = true;
 };
 
 AvahiPoller::AvahiPoller(void)
@@ -211,6 +259,19 @@ AvahiPoller::AvahiPoller(void)
     mAvahiPoller.timeout_free   = TimeoutFree;
 }
 
+AvahiPoller::~AvahiPoller(void)
+{
+    for (AvahiWatch *watch : mFreeWatches)
+    {
+        delete watch;
+    }
+
+    for (AvahiTimeout *timer : mFreeTimers)
+    {
+        delete timer;
+    }
+}
+
 AvahiWatch *AvahiPoller::WatchNew(const struct AvahiPoll *aPoller,
                                   int                     aFd,
                                   AvahiWatchEvent         aEvent,
@@ -222,16 +283,32 @@ AvahiWatch *AvahiPoller::WatchNew(const struct AvahiPoll *aPoller,
 
 AvahiWatch *AvahiPoller::WatchNew(int aFd, AvahiWatchEvent aEvent, AvahiWatchCallback aCallback, void *aContext)
 {
+    AvahiWatch *watch;
+
     assert(aEvent && aCallback && aFd >= 0);
 
-    mWatches.push_back(new AvahiWatch(aFd, aEvent, aCallback, aContext, this));
+    if (!mFreeWatches.empty())
+    {
+        watch = mFreeWatches.back();
+        mFreeWatches.pop_back();
+        watch->Reset(aFd, aEvent, aCallback, aContext);
+    }
+    else
+    {
+        watch = new AvahiWatch(aFd, aEvent, aCallback, aContext, this);
+    }
+
+    mWatches.push_back(watch);
+    mWatchFdsStale = true;
 
-    return mWatches.back();
+    return watch;
 }
 
 void AvahiPoller::WatchUpdate(AvahiWatch *aWatch, AvahiWatchEvent aEvent)
 {
     aWatch->mEvents = aEvent;
+
+    reinterpret_cast<AvahiPoller *>(aWatch->mPoller)->mWatchFdsStale = true;
 }
 
 AvahiWatchEvent AvahiPoller::WatchGetEvents(AvahiWatch *aWatch)
@@ -251,7 +328,17 @@ void AvahiPoller::WatchFree(AvahiWatch &aWatch)
         if (*it == &aWatch)
         {
             mWatches.erase(it);
-            delete &aWatch;
+            mWatchFdsStale = true;
+
+            if (mFreeWatches.size() < kMaxPooledAdapters)
+            {
+                mFreeWatches.push_back(&aWatch);
+            }
+            else
+            {
+                delete &aWatch;
+            }
+
             break;
         }
     }
@@ -268,8 +355,22 @@ AvahiTimeout *AvahiPoller::TimeoutNew(const AvahiPoll *     aPoller,
 
 AvahiTimeout *AvahiPoller::TimeoutNew(const struct timeval *aTimeout, AvahiTimeoutCallback aCallback, void *aContext)
 {
-    mTimers.push_back(new AvahiTimeout(aTimeout, aCallback, aContext, this));
-    return mTimers.back();
+    AvahiTimeout *timer;
+
+    if (!mFreeTimers.empty())
+    {
+        timer = mFreeTimers.back();
+        mFreeTimers.pop_back();
+        timer->Reset(aTimeout, aCallback, aContext);
+    }
+    else
+    {
+        timer = new AvahiTimeout(aTimeout, aCallback, aContext, this);
+    }
+
+    mTimers.push_back(timer);
+
+    return timer;
 }
 
 void AvahiPoller::TimeoutUpdate(AvahiTimeout *aTimer, const struct timeval *aTimeout)
@@ -296,34 +397,43 @@ void AvahiPoller::TimeoutFree(AvahiTimeout &aTimer)
         if (*it == &aTimer)
         {
             mTimers.erase(it);
-            delete &aTimer;
+
+            if (mFreeTimers.size() < kMaxPooledAdapters)
+            {
+                mFreeTimers.push_back(&aTimer);
+            }
+            else
+            {
+                delete &aTimer;
+            }
+
             break;
         }
     }
 }
 
-void AvahiPoller::Update(MainloopContext &aMainloop)
+void AvahiPoller::RebuildWatchFds(void)
 {
-    Timepoint now = Clock::now();
+    mWatchFds.Clear();
 
     for (Watches::iterator it = mWatches.begin(); it != mWatches.end(); ++it)
     {
-        int             fd     = (*it)->mFd;
-        AvahiWatchEvent events = (*it)->mEvents;
+        AvahiWatchEvent events     = (*it)->mEvents;
+        uint8_t         listEvents = 0;
 
         if (AVAHI_WATCH_IN & events)
         {
-            FD_SET(fd, &aMainloop.mReadFdSet);
+            listEvents |= FdEventList::kEventRead;
         }
 
         if (AVAHI_WATCH_OUT & events)
         {
-            FD_SET(fd, &aMainloop.mWriteFdSet);
+            listEvents |= FdEventList::kEventWrite;
         }
 
         if (AVAHI_WATCH_ERR & events)
         {
-            FD_SET(fd, &aMainloop.mErrorFdSet);
+            listEvents |= FdEventList::kEventError;
         }
 
         if (AVAHI_WATCH_HUP & events)
@@ -331,8 +441,25 @@ void AvahiPoller::Update(MainloopContext &aMainloop)
             // TODO what do with this event type?
         }
 
-        aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, fd);
+        mWatchFds.Add((*it)->mFd, listEvents);
+    }
 
+    mWatchFdsStale = false;
+}
+
+void AvahiPoller::Update(MainloopContext &aMainloop)
+{
+    Timepoint now = Clock::now();
+
+    if (mWatchFdsStale)
+    {
+        RebuildWatchFds();
+    }
+
+    mWatchFds.Apply(aMainloop);
+
+    for (Watches::iterator it = mWatches.begin(); it != mWatches.end(); ++it)
+    {
         (*it)->mHappened = 0;
     }
 
@@ -364,8 +491,8 @@ void AvahiPoller::Update(MainloopContext &aMainloop)
 
 void AvahiPoller::Process(const MainloopContext &aMainloop)
 {
-    Timepoint                   now = Clock::now();
-    std::vector<AvahiTimeout *> expired;
+    Timepoint                     now = Clock::now();
+    ScratchVector<AvahiTimeout *> expired; // Dies with this pass; bump-allocated.
 
     for (Watches::iterator it = mWatches.begin(); it != mWatches.end(); ++it)
     {
@@ -409,7 +536,7 @@ void AvahiPoller::Process(const MainloopContext &aMainloop)
         }
     }
 
-    for (std::vector<AvahiTimeout *>::iterator it = expired.begin(); it != expired.end(); ++it)
+    for (ScratchVector<AvahiTimeout *>::iterator it = expired.begin(); it != expired.end(); ++it)
     {
         AvahiTimeout *avahiTimeout = *it;
 
@@ -422,9 +549,55 @@ PublisherAvahi::PublisherAvahi(StateCallback aStateCallback)
     , mPoller(MakeUnique<AvahiPoller>())
     , mState(State::kIdle)
     , mStateCallback(std::move(aStateCallback))
+    , mTransactionDepth(0)
+    , mTransactionGroup(nullptr)
+    , mSnapshotReplayPending(false)
+    , mDaemonStalled(false)
 {
 }
 
+PublisherAvahi::SyncCallTimer::SyncCallTimer(PublisherAvahi &aPublisher)
+    : mPublisher(aPublisher)
+    , mStart(Clock::now())
+{
+}
+
+PublisherAvahi::SyncCallTimer::~SyncCallTimer(void)
+{
+    Milliseconds elapsed = std::chrono::duration_cast<Milliseconds>(Clock::now() - mStart);
+
+    VerifyOrExit(elapsed.count() >= kDaemonStallThresholdMs);
+
+    mPublisher.mDaemonStalled   = true;
+    mPublisher.mDaemonRetryTime = Clock::now() + Milliseconds(kDaemonStallBackoffMs);
+    otbrLogWarning("Avahi daemon answered in %lld ms; failing mDNS operations fast for the next %u ms",
+                   static_cast<long long>(elapsed.count()), kDaemonStallBackoffMs);
+
+exit:
+    return;
+}
+
+bool PublisherAvahi::DaemonStallBackoffActive(void)
+{
+    bool active = false;
+
+    VerifyOrExit(mDaemonStalled);
+
+    if (Clock::now() >= mDaemonRetryTime)
+    {
+        // Let one probe operation through; if the daemon is still stalled,
+        // the probe's own timing re-arms the backoff.
+        mDaemonStalled = false;
+    }
+    else
+    {
+        active = true;
+    }
+
+exit:
+    return active;
+}
+
 PublisherAvahi::~PublisherAvahi(void)
 {
     Stop();
@@ -432,12 +605,12 @@ PublisherAvahi::~PublisherAvahi(void)
 
 PublisherAvahi::AvahiServiceRegistration::~AvahiServiceRegistration(void)
 {
-    ReleaseGroup(mEntryGroup);
+    static_cast<PublisherAvahi *>(mPublisher)->ReleaseGroup(mEntryGroup);
 }
 
 PublisherAvahi::AvahiHostRegistration::~AvahiHostRegistration(void)
 {
-    ReleaseGroup(mEntryGroup);
+    static_cast<PublisherAvahi *>(mPublisher)->ReleaseGroup(mEntryGroup);
 }
 
 otbrError PublisherAvahi::Start(void)
@@ -471,6 +644,16 @@ void PublisherAvahi::Stop(void)
     mSubscribedServices.clear();
     mSubscribedHosts.clear();
 
+    mTransactionDepth = 0;
+    mTransactionGroup = nullptr;
+    mGroupRefCounts.clear();
+
+    // The snapshots are kept: they are what the registrations are replayed
+    // from when the client becomes ready again.
+    mServiceReplayQueue.clear();
+    mHostReplayQueue.clear();
+    mSnapshotReplayPending = false;
+
     if (mClient)
     {
         avahi_client_free(mClient);
@@ -480,6 +663,26 @@ void PublisherAvahi::Stop(void)
     mState = Mdns::Publisher::State::kIdle;
 }
 
+void PublisherAvahi::Update(MainloopContext &aMainloop)
+{
+    // The avahi file descriptors are driven by `AvahiPoller`; only the
+    // snapshot replay and the discovery batching deadline are handled here.
+    if (mSnapshotReplayPending)
+    {
+        aMainloop.mTimeout = ToTimeval(Microseconds::zero());
+    }
+
+    UpdateDiscoveryBatchTimeout(aMainloop);
+}
+
+void PublisherAvahi::Process(const MainloopContext &aMainloop)
+{
+    OTBR_UNUSED_VARIABLE(aMainloop);
+
+    ProcessSnapshotReplay();
+    FlushDueDiscoveryBatches();
+}
+
 void PublisherAvahi::HandleClientState(AvahiClient *aClient, AvahiClientState aState, void *aContext)
 {
     static_cast<PublisherAvahi *>(aContext)->HandleClientState(aClient, aState);
@@ -522,34 +725,59 @@ void PublisherAvahi::HandleGroupState(AvahiEntryGroup *aGroup, AvahiEntryGroupSt
 
 void PublisherAvahi::CallHostOrServiceCallback(AvahiEntryGroup *aGroup, otbrError aError)
 {
-    ServiceRegistration *serviceReg;
-    HostRegistration *   hostReg;
+    // A group committed by a transaction may be shared by several
+    // registrations; collect them first since completing a registration
+    // with an error removes it from the registration maps.
+    std::vector<std::pair<std::string, std::string>> services;
+    std::vector<std::string>                         hosts;
 
-    if ((serviceReg = FindServiceRegistration(aGroup)) != nullptr)
+    for (const auto &kv : mServiceRegistrations)
     {
-        if (aError == OTBR_ERROR_NONE)
+        const auto &serviceReg = static_cast<const AvahiServiceRegistration &>(*kv.second);
+
+        if (serviceReg.GetEntryGroup() == aGroup)
         {
-            serviceReg->Complete(aError);
+            services.emplace_back(serviceReg.mName, serviceReg.mType);
         }
-        else
+    }
+
+    for (const auto &kv : mHostRegistrations)
+    {
+        const auto &hostReg = static_cast<const AvahiHostRegistration &>(*kv.second);
+
+        if (hostReg.GetEntryGroup() == aGroup)
         {
-            RemoveServiceRegistration(serviceReg->mName, serviceReg->mType, aError);
+            hosts.push_back(hostReg.mName);
         }
     }
-    else if ((hostReg = FindHostRegistration(aGroup)) != nullptr)
+
+    if (services.empty() && hosts.empty())
+    {
+        otbrLogWarning("No registered service or host matches avahi group @%p", aGroup);
+    }
+
+    for (const auto &nameAndType : services)
     {
         if (aError == OTBR_ERROR_NONE)
         {
-            hostReg->Complete(aError);
+            FindServiceRegistration(nameAndType.first, nameAndType.second)->Complete(aError);
         }
         else
         {
-            RemoveHostRegistration(hostReg->mName, aError);
+            RemoveServiceRegistration(nameAndType.first, nameAndType.second, aError);
         }
     }
-    else
+
+    for (const auto &name : hosts)
     {
-        otbrLogWarning("No registered service or host matches avahi group @%p", aGroup);
+        if (aError == OTBR_ERROR_NONE)
+        {
+            FindHostRegistration(name)->Complete(aError);
+        }
+        else
+        {
+            RemoveHostRegistration(name, aError);
+        }
     }
 }
 
@@ -565,9 +793,46 @@ AvahiEntryGroup *PublisherAvahi::CreateGroup(AvahiClient *aClient)
     return group;
 }
 
+AvahiEntryGroup *PublisherAvahi::AcquireGroup(AvahiClient *aClient)
+{
+    AvahiEntryGroup *group;
+
+    if (mTransactionDepth > 0)
+    {
+        if (mTransactionGroup == nullptr)
+        {
+            mTransactionGroup = CreateGroup(aClient);
+        }
+        group = mTransactionGroup;
+    }
+    else
+    {
+        group = CreateGroup(aClient);
+    }
+
+    if (group != nullptr)
+    {
+        mGroupRefCounts[group]++;
+    }
+
+    return group;
+}
+
 void PublisherAvahi::ReleaseGroup(AvahiEntryGroup *aGroup)
 {
-    int error;
+    int  error;
+    auto refCount = mGroupRefCounts.find(aGroup);
+
+    assert(refCount != mGroupRefCounts.end() && refCount->second > 0);
+
+    // A group shared by a transaction is freed when its last user is gone.
+    VerifyOrExit(--refCount->second == 0);
+    mGroupRefCounts.erase(refCount);
+
+    if (aGroup == mTransactionGroup)
+    {
+        mTransactionGroup = nullptr;
+    }
 
     otbrLogInfo("Releasing avahi entry group @%p", aGroup);
 
@@ -583,6 +848,41 @@ void PublisherAvahi::ReleaseGroup(AvahiEntryGroup *aGroup)
     {
         otbrLogErr("Failed to free entry group for avahi error: %s", avahi_strerror(error));
     }
+
+exit:
+    return;
+}
+
+void PublisherAvahi::BeginTransaction(void)
+{
+    mTransactionDepth++;
+}
+
+void PublisherAvahi::EndTransaction(void)
+{
+    AvahiEntryGroup *group = mTransactionGroup;
+    int              avahiError;
+
+    assert(mTransactionDepth > 0);
+
+    VerifyOrExit(--mTransactionDepth == 0);
+    VerifyOrExit(group != nullptr);
+
+    // The next transaction gets a fresh group; this one now lives on the
+    // references held by the registrations batched into it.
+    mTransactionGroup = nullptr;
+
+    otbrLogInfo("Commit avahi transaction group @%p", group);
+    avahiError = avahi_entry_group_commit(group);
+
+    if (avahiError != AVAHI_OK)
+    {
+        otbrLogErr("Failed to commit transaction group for avahi error: %s!", avahi_strerror(avahiError));
+        CallHostOrServiceCallback(group, OTBR_ERROR_MDNS);
+    }
+
+exit:
+    return;
 }
 
 void PublisherAvahi::HandleClientState(AvahiClient *aClient, AvahiClientState aState)
@@ -595,9 +895,10 @@ void PublisherAvahi::HandleClientState(AvahiClient *aClient, AvahiClientState aS
         // The server has startup successfully and registered its host
         // name on the network, so it's time to create our services.
         otbrLogInfo("Avahi client is ready");
-        mClient = aClient;
-        mState  = State::kReady;
-        mStateCallback(mState);
+        mClient        = aClient;
+        mState         = State::kReady;
+        mDaemonStalled = false;
+        BeginSnapshotReplay();
         break;
 
     case AVAHI_CLIENT_FAILURE:
@@ -634,18 +935,95 @@ void PublisherAvahi::HandleClientState(AvahiClient *aClient, AvahiClientState aS
     }
 }
 
+void PublisherAvahi::BeginSnapshotReplay(void)
+{
+    mServiceReplayQueue.clear();
+    mHostReplayQueue.clear();
+
+    for (const auto &kv : mServiceSnapshots)
+    {
+        mServiceReplayQueue.push_back(kv.second);
+    }
+
+    for (const auto &kv : mHostSnapshots)
+    {
+        mHostReplayQueue.push_back(kv.second);
+    }
+
+    if (mServiceReplayQueue.empty() && mHostReplayQueue.empty())
+    {
+        mStateCallback(mState);
+    }
+    else
+    {
+        otbrLogInfo("Replaying %zu hosts and %zu services from the registration snapshot", mHostReplayQueue.size(),
+                    mServiceReplayQueue.size());
+        mSnapshotReplayPending = true;
+    }
+}
+
+void PublisherAvahi::ProcessSnapshotReplay(void)
+{
+    size_t budget = kMaxSnapshotReplayPerCycle;
+
+    VerifyOrExit(mSnapshotReplayPending);
+    VerifyOrExit(mState == State::kReady && mClient != nullptr);
+
+    BeginTransaction();
+
+    // Hosts are replayed before services so that the services they host can
+    // refer to them.
+    while (budget > 0 && !mHostReplayQueue.empty())
+    {
+        HostSnapshot &snapshot = mHostReplayQueue.back();
+        std::string   name     = snapshot.mName;
+
+        PublishHostImpl(snapshot.mName, snapshot.mAddresses, ResultCallback([name](otbrError aError) {
+                            otbrLogResult(aError, "Replay host registration %s", name.c_str());
+                        }));
+        mHostReplayQueue.pop_back();
+        budget--;
+    }
+
+    while (budget > 0 && !mServiceReplayQueue.empty())
+    {
+        ServiceSnapshot &snapshot = mServiceReplayQueue.back();
+        std::string      name     = snapshot.mName;
+        std::string      type     = snapshot.mType;
+
+        PublishServiceImpl(snapshot.mHostName, snapshot.mName, snapshot.mType, snapshot.mSubTypeList, snapshot.mPort,
+                           std::move(snapshot.mTxtList), ResultCallback([name, type](otbrError aError) {
+                               otbrLogResult(aError, "Replay service registration %s.%s", name.c_str(), type.c_str());
+                           }));
+        mServiceReplayQueue.pop_back();
+        budget--;
+    }
+
+    EndTransaction();
+
+    if (mServiceReplayQueue.empty() && mHostReplayQueue.empty())
+    {
+        otbrLogInfo("Finished replaying the registration snapshot");
+        mSnapshotReplayPending = false;
+        mStateCallback(mState);
+    }
+
+exit:
+    return;
+}
+
 void PublisherAvahi::PublishServiceImpl(const std::string &aHostName,
                                         const std::string &aName,
                                         const std::string &aType,
                                         const SubTypeList &aSubTypeList,
                                         uint16_t           aPort,
-                                        const TxtList &    aTxtList,
+                                        TxtList            aTxtList,
                                         ResultCallback &&  aCallback)
 {
     otbrError         error             = OTBR_ERROR_NONE;
     int               avahiError        = AVAHI_OK;
     SubTypeList       sortedSubTypeList = SortSubTypeList(aSubTypeList);
-    TxtList           sortedTxtList     = SortTxtList(aTxtList);
+    TxtList           sortedTxtList     = SortTxtList(std::move(aTxtList));
     const std::string logHostName       = !aHostName.empty() ? aHostName : "localhost";
     std::string       fullHostName;
     AvahiEntryGroup * group = nullptr;
@@ -653,9 +1031,11 @@ void PublisherAvahi::PublishServiceImpl(const std::string &aHostName,
     // Aligned with AvahiStringList
     AvahiStringList  txtBuffer[(kMaxSizeOfTxtRecord - 1) / sizeof(AvahiStringList) + 1];
     AvahiStringList *txtHead = nullptr;
+    SyncCallTimer    syncCallTimer(*this);
 
     VerifyOrExit(mState == State::kReady, error = OTBR_ERROR_INVALID_STATE);
     VerifyOrExit(mClient != nullptr, error = OTBR_ERROR_INVALID_STATE);
+    VerifyOrExit(!DaemonStallBackoffActive(), error = OTBR_ERROR_MDNS);
 
     if (!aHostName.empty())
     {
@@ -666,8 +1046,8 @@ void PublisherAvahi::PublishServiceImpl(const std::string &aHostName,
                                                    std::move(aCallback));
     VerifyOrExit(!aCallback.IsNull());
 
-    SuccessOrExit(error = TxtListToAvahiStringList(aTxtList, txtBuffer, sizeof(txtBuffer), txtHead));
-    VerifyOrExit((group = CreateGroup(mClient)) != nullptr, error = OTBR_ERROR_MDNS);
+    SuccessOrExit(error = TxtListToAvahiStringList(sortedTxtList, txtBuffer, sizeof(txtBuffer), txtHead));
+    VerifyOrExit((group = AcquireGroup(mClient)) != nullptr, error = OTBR_ERROR_MDNS);
     avahiError = avahi_entry_group_add_service_strlst(group, AVAHI_IF_UNSPEC, AVAHI_PROTO_UNSPEC, AvahiPublishFlags{},
                                                       aName.c_str(), aType.c_str(),
                                                       /* domain */ nullptr, fullHostName.c_str(), aPort, txtHead);
@@ -683,12 +1063,27 @@ void PublisherAvahi::PublishServiceImpl(const std::string &aHostName,
         VerifyOrExit(avahiError == AVAHI_OK);
     }
 
-    otbrLogInfo("Commit avahi service %s.%s", aName.c_str(), aType.c_str());
-    avahiError = avahi_entry_group_commit(group);
-    VerifyOrExit(avahiError == AVAHI_OK);
+    if (mTransactionDepth == 0)
+    {
+        otbrLogInfo("Commit avahi service %s.%s", aName.c_str(), aType.c_str());
+        avahiError = avahi_entry_group_commit(group);
+        VerifyOrExit(avahiError == AVAHI_OK);
+    }
 
-    AddServiceRegistration(std::unique_ptr<AvahiServiceRegistration>(new AvahiServiceRegistration(
-        aHostName, aName, aType, sortedSubTypeList, aPort, sortedTxtList, std::move(aCallback), group, this)));
+    {
+        ServiceSnapshot &snapshot = mServiceSnapshots[MakeFullServiceName(aName, aType)];
+
+        snapshot.mHostName    = aHostName;
+        snapshot.mName        = aName;
+        snapshot.mType        = aType;
+        snapshot.mSubTypeList = sortedSubTypeList;
+        snapshot.mPort        = aPort;
+        snapshot.mTxtList     = sortedTxtList;
+    }
+
+    AddServiceRegistration(std::unique_ptr<AvahiServiceRegistration>(
+        new AvahiServiceRegistration(aHostName, aName, aType, sortedSubTypeList, aPort, std::move(sortedTxtList),
+                                     std::move(aCallback), group, this)));
 
 exit:
     if (avahiError != AVAHI_OK || error != OTBR_ERROR_NONE)
@@ -712,6 +1107,7 @@ void PublisherAvahi::UnpublishService(const std::string &aName, const std::strin
     otbrError error = OTBR_ERROR_NONE;
 
     VerifyOrExit(mState == Publisher::State::kReady, error = OTBR_ERROR_INVALID_STATE);
+    mServiceSnapshots.erase(MakeFullServiceName(aName, aType));
     RemoveServiceRegistration(aName, aType, OTBR_ERROR_ABORTED);
 
 exit:
@@ -726,15 +1122,17 @@ void PublisherAvahi::PublishHostImpl(const std::string &            aName,
     int              avahiError = AVAHI_OK;
     std::string      fullHostName;
     AvahiEntryGroup *group = nullptr;
+    SyncCallTimer    syncCallTimer(*this);
 
     VerifyOrExit(mState == State::kReady, error = OTBR_ERROR_INVALID_STATE);
     VerifyOrExit(mClient != nullptr, error = OTBR_ERROR_INVALID_STATE);
+    VerifyOrExit(!DaemonStallBackoffActive(), error = OTBR_ERROR_MDNS);
 
     aCallback = HandleDuplicateHostRegistration(aName, aAddresses, std::move(aCallback));
     VerifyOrExit(!aCallback.IsNull());
     VerifyOrExit(!aAddresses.empty(), std::move(aCallback)(OTBR_ERROR_NONE));
 
-    VerifyOrExit((group = CreateGroup(mClient)) != nullptr, error = OTBR_ERROR_MDNS);
+    VerifyOrExit((group = AcquireGroup(mClient)) != nullptr, error = OTBR_ERROR_MDNS);
 
     fullHostName = MakeFullHostName(aName);
     for (const auto &address : aAddresses)
@@ -748,9 +1146,19 @@ void PublisherAvahi::PublishHostImpl(const std::string &            aName,
         VerifyOrExit(avahiError == AVAHI_OK);
     }
 
-    otbrLogInfo("Commit avahi host %s", aName.c_str());
-    avahiError = avahi_entry_group_commit(group);
-    VerifyOrExit(avahiError == AVAHI_OK);
+    if (mTransactionDepth == 0)
+    {
+        otbrLogInfo("Commit avahi host %s", aName.c_str());
+        avahiError = avahi_entry_group_commit(group);
+        VerifyOrExit(avahiError == AVAHI_OK);
+    }
+
+    {
+        HostSnapshot &snapshot = mHostSnapshots[MakeFullHostName(aName)];
+
+        snapshot.mName      = aName;
+        snapshot.mAddresses = aAddresses;
+    }
 
     AddHostRegistration(std::unique_ptr<AvahiHostRegistration>(
         new AvahiHostRegistration(aName, aAddresses, std::move(aCallback), group, this)));
@@ -772,11 +1180,63 @@ exit:
     }
 }
 
+otbrError PublisherAvahi::AddHostAddressImpl(const std::string &aName, const Ip6Address &aAddress)
+{
+    otbrError              error      = OTBR_ERROR_NONE;
+    int                    avahiError = AVAHI_OK;
+    AvahiHostRegistration *hostReg;
+    AvahiEntryGroup *      group;
+    AvahiAddress           avahiAddress;
+    std::string            fullHostName;
+    SyncCallTimer          syncCallTimer(*this);
+
+    VerifyOrExit(mState == State::kReady, error = OTBR_ERROR_INVALID_STATE);
+    VerifyOrExit(mClient != nullptr, error = OTBR_ERROR_INVALID_STATE);
+    VerifyOrExit(!DaemonStallBackoffActive(), error = OTBR_ERROR_MDNS);
+
+    hostReg = static_cast<AvahiHostRegistration *>(FindHostRegistration(aName));
+    VerifyOrExit(hostReg != nullptr, error = OTBR_ERROR_NOT_FOUND);
+    VerifyOrExit((group = hostReg->GetEntryGroup()) != nullptr, error = OTBR_ERROR_MDNS);
+
+    fullHostName = MakeFullHostName(aName);
+
+    avahiAddress.proto = AVAHI_PROTO_INET6;
+    memcpy(avahiAddress.data.ipv6.address, aAddress.m8, sizeof(aAddress.m8));
+    avahiError = avahi_entry_group_add_address(group, AVAHI_IF_UNSPEC, AVAHI_PROTO_UNSPEC, AVAHI_PUBLISH_NO_REVERSE,
+                                               fullHostName.c_str(), &avahiAddress);
+    VerifyOrExit(avahiError == AVAHI_OK);
+
+    if (mTransactionDepth == 0)
+    {
+        avahiError = avahi_entry_group_commit(group);
+        VerifyOrExit(avahiError == AVAHI_OK);
+    }
+
+    {
+        auto it = mHostSnapshots.find(fullHostName);
+
+        if (it != mHostSnapshots.end())
+        {
+            it->second.mAddresses.push_back(aAddress);
+        }
+    }
+
+exit:
+    if (avahiError != AVAHI_OK)
+    {
+        error = OTBR_ERROR_MDNS;
+        otbrLogInfo("Failed to add address record to host %s: %s", aName.c_str(), avahi_strerror(avahiError));
+    }
+
+    return error;
+}
+
 void PublisherAvahi::UnpublishHost(const std::string &aName, ResultCallback &&aCallback)
 {
     otbrError error = OTBR_ERROR_NONE;
 
     VerifyOrExit(mState == Publisher::State::kReady, error = OTBR_ERROR_INVALID_STATE);
+    mHostSnapshots.erase(MakeFullHostName(aName));
     RemoveHostRegistration(aName, OTBR_ERROR_ABORTED);
 
 exit:
@@ -822,43 +1282,10 @@ exit:
     return error;
 }
 
-Publisher::ServiceRegistration *PublisherAvahi::FindServiceRegistration(const AvahiEntryGroup *aEntryGroup)
-{
-    ServiceRegistration *result = nullptr;
-
-    for (const auto &kv : mServiceRegistrations)
-    {
-        const auto &serviceReg = static_cast<const AvahiServiceRegistration &>(*kv.second);
-        if (serviceReg.GetEntryGroup() == aEntryGroup)
-        {
-            result = kv.second.get();
-            break;
-        }
-    }
-
-    return result;
-}
-
-Publisher::HostRegistration *PublisherAvahi::FindHostRegistration(const AvahiEntryGroup *aEntryGroup)
+void PublisherAvahi::SubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName)
 {
-    HostRegistration *result = nullptr;
-
-    for (const auto &kv : mHostRegistrations)
-    {
-        const auto &hostReg = static_cast<const AvahiHostRegistration &>(*kv.second);
-        if (hostReg.GetEntryGroup() == aEntryGroup)
-        {
-            result = kv.second.get();
-            break;
-        }
-    }
-
-    return result;
-}
-
-void PublisherAvahi::SubscribeService(const std::string &aType, const std::string &aInstanceName)
-{
-    auto service = MakeUnique<ServiceSubscription>(*this, aType, aInstanceName);
+    auto          service = MakeUnique<ServiceSubscription>(*this, aType, aInstanceName);
+    SyncCallTimer syncCallTimer(*this);
 
     VerifyOrExit(mState == Publisher::State::kReady);
     mSubscribedServices.push_back(std::move(service));
@@ -866,6 +1293,14 @@ void PublisherAvahi::SubscribeService(const std::string &aType, const std::strin
     otbrLogInfo("Subscribe service %s.%s (total %zu)", aInstanceName.c_str(), aType.c_str(),
                 mSubscribedServices.size());
 
+    if (DaemonStallBackoffActive())
+    {
+        // Degrade instead of blocking the mainloop on a stalled daemon; the
+        // failure is negative-cached and subscribers retry later.
+        OnServiceResolveFailed(aType, aInstanceName, AVAHI_ERR_FAILURE);
+        ExitNow();
+    }
+
     if (aInstanceName.empty())
     {
         mSubscribedServices.back()->Browse();
@@ -879,7 +1314,7 @@ exit:
     return;
 }
 
-void PublisherAvahi::UnsubscribeService(const std::string &aType, const std::string &aInstanceName)
+void PublisherAvahi::UnsubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName)
 {
     ServiceSubscriptionList::iterator it;
 
@@ -923,9 +1358,10 @@ otbrError PublisherAvahi::DnsErrorToOtbrError(int32_t aErrorCode)
     return otbr::Mdns::DnsErrorToOtbrError(aErrorCode);
 }
 
-void PublisherAvahi::SubscribeHost(const std::string &aHostName)
+void PublisherAvahi::SubscribeHostImpl(const std::string &aHostName)
 {
-    auto host = MakeUnique<HostSubscription>(*this, aHostName);
+    auto          host = MakeUnique<HostSubscription>(*this, aHostName);
+    SyncCallTimer syncCallTimer(*this);
 
     VerifyOrExit(mState == Publisher::State::kReady);
 
@@ -933,13 +1369,21 @@ void PublisherAvahi::SubscribeHost(const std::string &aHostName)
 
     otbrLogInfo("Subscribe host %s (total %zu)", aHostName.c_str(), mSubscribedHosts.size());
 
+    if (DaemonStallBackoffActive())
+    {
+        // Degrade instead of blocking the mainloop on a stalled daemon; the
+        // failure is negative-cached and subscribers retry later.
+        OnHostResolveFailed(aHostName, AVAHI_ERR_FAILURE);
+        ExitNow();
+    }
+
     mSubscribedHosts.back()->Resolve();
 
 exit:
     return;
 }
 
-void PublisherAvahi::UnsubscribeHost(const std::string &aHostName)
+void PublisherAvahi::UnsubscribeHostImpl(const std::string &aHostName)
 {
     HostSubscriptionList::iterator it;
 
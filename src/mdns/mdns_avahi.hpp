@@ -34,8 +34,10 @@
 #ifndef OTBR_AGENT_MDNS_AVAHI_HPP_
 #define OTBR_AGENT_MDNS_AVAHI_HPP_
 
+#include <map>
 #include <memory>
 #include <set>
+#include <unordered_map>
 #include <vector>
 
 #include <avahi-client/client.h>
@@ -68,21 +70,22 @@ class AvahiPoller;
  * This class implements mDNS publisher with avahi.
  *
  */
-class PublisherAvahi : public Publisher
+class PublisherAvahi : public MainloopProcessor, public Publisher
 {
 public:
     PublisherAvahi(StateCallback aStateCallback);
     ~PublisherAvahi(void) override;
 
+    void Update(MainloopContext &aMainloop) override;
+    void Process(const MainloopContext &aMainloop) override;
+
     void      UnpublishService(const std::string &aName, const std::string &aType, ResultCallback &&aCallback) override;
     void      UnpublishHost(const std::string &aName, ResultCallback &&aCallback) override;
-    void      SubscribeService(const std::string &aType, const std::string &aInstanceName) override;
-    void      UnsubscribeService(const std::string &aType, const std::string &aInstanceName) override;
-    void      SubscribeHost(const std::string &aHostName) override;
-    void      UnsubscribeHost(const std::string &aHostName) override;
     otbrError Start(void) override;
     bool      IsStarted(void) const override;
     void      Stop(void) override;
+    void      BeginTransaction(void) override;
+    void      EndTransaction(void) override;
 
 protected:
     void      PublishServiceImpl(const std::string &aHostName,
@@ -90,21 +93,52 @@ protected:
                                  const std::string &aType,
                                  const SubTypeList &aSubTypeList,
                                  uint16_t           aPort,
-                                 const TxtList &    aTxtList,
+                                 TxtList            aTxtList,
                                  ResultCallback &&  aCallback) override;
     void      PublishHostImpl(const std::string &            aName,
                               const std::vector<Ip6Address> &aAddresses,
                               ResultCallback &&              aCallback) override;
+    otbrError AddHostAddressImpl(const std::string &aName, const Ip6Address &aAddress) override;
+    void      SubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName) override;
+    void      UnsubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName) override;
+    void      SubscribeHostImpl(const std::string &aHostName) override;
+    void      UnsubscribeHostImpl(const std::string &aHostName) override;
     void      OnServiceResolveFailedImpl(const std::string &aType,
                                          const std::string &aInstanceName,
                                          int32_t            aErrorCode) override;
     void      OnHostResolveFailedImpl(const std::string &aHostName, int32_t aErrorCode) override;
     otbrError DnsErrorToOtbrError(int32_t aErrorCode) override;
 
+    const char *GetBackendLabel(void) const override { return "avahi"; }
+
 private:
     static constexpr size_t   kMaxSizeOfTxtRecord = 1024;
     static constexpr uint32_t kDefaultTtl         = 10; // In seconds.
 
+    // The number of snapshots replayed per mainloop cycle after the avahi
+    // daemon restarts.
+    static constexpr size_t kMaxSnapshotReplayPerCycle = 16;
+
+    // Threshold (in milliseconds) above which a synchronous libavahi-client
+    // call counts as evidence that the avahi daemon is stalled, and the
+    // backoff (in milliseconds) during which mDNS operations then fail fast
+    // instead of issuing further blocking D-Bus calls from the mainloop.
+    static constexpr uint32_t kDaemonStallThresholdMs = 500;
+    static constexpr uint32_t kDaemonStallBackoffMs   = 5000;
+
+    // Measures the synchronous libavahi-client calls made while in scope
+    // and trips the stall backoff when the daemon answers too slowly.
+    class SyncCallTimer
+    {
+    public:
+        explicit SyncCallTimer(PublisherAvahi &aPublisher);
+        ~SyncCallTimer(void);
+
+    private:
+        PublisherAvahi &mPublisher;
+        Timepoint       mStart;
+    };
+
     class AvahiServiceRegistration : public ServiceRegistration
     {
     public:
@@ -151,6 +185,7 @@ private:
 
         ~AvahiHostRegistration(void) override;
         const AvahiEntryGroup *GetEntryGroup(void) const { return mEntryGroup; }
+        AvahiEntryGroup *      GetEntryGroup(void) { return mEntryGroup; }
 
     private:
         AvahiEntryGroup *mEntryGroup;
@@ -283,11 +318,46 @@ private:
     typedef std::vector<std::unique_ptr<ServiceSubscription>> ServiceSubscriptionList;
     typedef std::vector<std::unique_ptr<HostSubscription>>    HostSubscriptionList;
 
+    // Snapshots of the published registration set. They survive an avahi
+    // daemon restart so the registrations can be replayed without the
+    // advertising proxy re-walking the whole SRP host table.
+    struct ServiceSnapshot
+    {
+        std::string mHostName;
+        std::string mName;
+        std::string mType;
+        SubTypeList mSubTypeList;
+        uint16_t    mPort;
+        TxtList     mTxtList;
+    };
+
+    struct HostSnapshot
+    {
+        std::string             mName;
+        std::vector<Ip6Address> mAddresses;
+    };
+
     static void HandleClientState(AvahiClient *aClient, AvahiClientState aState, void *aContext);
     void        HandleClientState(AvahiClient *aClient, AvahiClientState aState);
 
+    // Queues the snapshots for replay when the avahi client becomes ready.
+    // The ready state callback is deferred until the replay has drained so
+    // that the registrations are back in place when the listeners run.
+    void BeginSnapshotReplay(void);
+
+    // Replays a bounded number of snapshots per mainloop cycle, committed as
+    // one transaction, so a large registration set does not stall the
+    // mainloop.
+    void ProcessSnapshotReplay(void);
+
+    // Returns whether mDNS operations should fail fast because the avahi
+    // daemon recently stalled a synchronous call; lets one probe operation
+    // through once the backoff has elapsed.
+    bool DaemonStallBackoffActive(void);
+
     AvahiEntryGroup *CreateGroup(AvahiClient *aClient);
-    static void      ReleaseGroup(AvahiEntryGroup *aGroup);
+    AvahiEntryGroup *AcquireGroup(AvahiClient *aClient);
+    void             ReleaseGroup(AvahiEntryGroup *aGroup);
 
     static void HandleGroupState(AvahiEntryGroup *aGroup, AvahiEntryGroupState aState, void *aContext);
     void        HandleGroupState(AvahiEntryGroup *aGroup, AvahiEntryGroupState aState);
@@ -298,16 +368,32 @@ private:
                                               size_t            aBufferSize,
                                               AvahiStringList *&aHead);
 
-    ServiceRegistration *FindServiceRegistration(const AvahiEntryGroup *aEntryGroup);
-    HostRegistration *   FindHostRegistration(const AvahiEntryGroup *aEntryGroup);
-
     AvahiClient *                mClient;
     std::unique_ptr<AvahiPoller> mPoller;
     State                        mState;
     StateCallback                mStateCallback;
 
+    // Registrations made within a transaction share one entry group and are
+    // committed together; the reference counts keep a shared group alive
+    // until its last registration is removed.
+    uint32_t                            mTransactionDepth;
+    AvahiEntryGroup *                   mTransactionGroup;
+    std::map<AvahiEntryGroup *, size_t> mGroupRefCounts;
+
     ServiceSubscriptionList mSubscribedServices;
     HostSubscriptionList    mSubscribedHosts;
+
+    std::unordered_map<std::string, ServiceSnapshot> mServiceSnapshots;
+    std::unordered_map<std::string, HostSnapshot>    mHostSnapshots;
+    std::vector<ServiceSnapshot>                     mServiceReplayQueue;
+    std::vector<HostSnapshot>                        mHostReplayQueue;
+    bool                                             mSnapshotReplayPending;
+
+    // A stalled avahi daemon (its synchronous D-Bus calls answering slowly)
+    // must degrade only mDNS: while the backoff is armed, publish and
+    // subscribe operations fail fast instead of blocking the mainloop.
+    bool      mDaemonStalled;
+    Timepoint mDaemonRetryTime;
 };
 
 } // namespace Mdns
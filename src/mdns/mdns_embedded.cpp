@@ -0,0 +1,864 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the embedded in-process mDNS publisher.
+ */
+
+#define OTBR_LOG_TAG "MDNS"
+
+#include "mdns/mdns_embedded.hpp"
+
+#include <algorithm>
+
+#include <arpa/inet.h>
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <netinet/in.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+
+namespace otbr {
+
+namespace Mdns {
+
+// DNS wire constants used by the embedded responder.
+static constexpr uint16_t kDnsClassIn       = 0x0001;
+static constexpr uint16_t kDnsCacheFlushBit = 0x8000;
+static constexpr uint16_t kDnsTypePtr       = 12;
+static constexpr uint16_t kDnsTypeTxt       = 16;
+static constexpr uint16_t kDnsTypeAaaa      = 28;
+static constexpr uint16_t kDnsTypeSrv       = 33;
+static constexpr uint16_t kDnsTypeAny       = 255;
+static constexpr uint16_t kDnsFlagsResponse = 0x8400; ///< QR and AA bits.
+static constexpr uint8_t  kMaxLabelLength   = 63;
+static constexpr uint8_t  kMaxNamePointers  = 16;
+
+static const struct in6_addr kMdnsMulticastGroup = {
+    {{0xff, 0x02, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xfb}}};
+
+static void AppendUint16(std::vector<uint8_t> &aMessage, uint16_t aValue)
+{
+    aMessage.push_back(aValue >> 8);
+    aMessage.push_back(aValue & 0xff);
+}
+
+static void AppendUint32(std::vector<uint8_t> &aMessage, uint32_t aValue)
+{
+    AppendUint16(aMessage, aValue >> 16);
+    AppendUint16(aMessage, aValue & 0xffff);
+}
+
+static void WriteUint16(std::vector<uint8_t> &aMessage, size_t aOffset, uint16_t aValue)
+{
+    aMessage[aOffset]     = aValue >> 8;
+    aMessage[aOffset + 1] = aValue & 0xff;
+}
+
+// Appends a dot-separated name as uncompressed DNS labels. Compression is a
+// size optimization only and a responder is not required to emit it.
+static otbrError AppendName(std::vector<uint8_t> &aMessage, const std::string &aFullName)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    size_t    begin = 0;
+
+    while (begin < aFullName.size())
+    {
+        size_t end   = aFullName.find('.', begin);
+        size_t label = (end == std::string::npos ? aFullName.size() : end) - begin;
+
+        VerifyOrExit(label > 0 && label <= kMaxLabelLength, error = OTBR_ERROR_INVALID_ARGS);
+        aMessage.push_back(static_cast<uint8_t>(label));
+        aMessage.insert(aMessage.end(), aFullName.begin() + begin, aFullName.begin() + begin + label);
+        begin += label + 1;
+    }
+
+    aMessage.push_back(0);
+
+exit:
+    return error;
+}
+
+// Reads a possibly compressed name starting at @p aOffset, leaving @p aOffset
+// just past the name in the original record.
+static otbrError ReadName(const uint8_t *aMessage, uint16_t aLength, uint16_t &aOffset, std::string &aName)
+{
+    otbrError error    = OTBR_ERROR_NONE;
+    uint16_t  offset   = aOffset;
+    uint16_t  jumped   = 0;
+    uint8_t   pointers = 0;
+
+    aName.clear();
+
+    while (true)
+    {
+        uint8_t length;
+
+        VerifyOrExit(offset < aLength, error = OTBR_ERROR_PARSE);
+        length = aMessage[offset];
+
+        if ((length & 0xc0) == 0xc0)
+        {
+            VerifyOrExit(offset + 1 < aLength, error = OTBR_ERROR_PARSE);
+            VerifyOrExit(++pointers <= kMaxNamePointers, error = OTBR_ERROR_PARSE);
+
+            if (jumped == 0)
+            {
+                jumped = offset + 2;
+            }
+
+            offset = static_cast<uint16_t>((length & 0x3f) << 8) | aMessage[offset + 1];
+            continue;
+        }
+
+        VerifyOrExit((length & 0xc0) == 0, error = OTBR_ERROR_PARSE);
+        ++offset;
+
+        if (length == 0)
+        {
+            break;
+        }
+
+        VerifyOrExit(offset + length <= aLength, error = OTBR_ERROR_PARSE);
+
+        if (!aName.empty())
+        {
+            aName.push_back('.');
+        }
+
+        aName.append(reinterpret_cast<const char *>(&aMessage[offset]), length);
+        offset += length;
+    }
+
+    aOffset = (jumped != 0) ? jumped : offset;
+
+exit:
+    return error;
+}
+
+PublisherEmbedded::PublisherEmbedded(StateCallback aStateCallback)
+    : mSocketFd(-1)
+    , mState(State::kIdle)
+    , mStateCallback(std::move(aStateCallback))
+{
+}
+
+PublisherEmbedded::~PublisherEmbedded(void)
+{
+    Stop();
+}
+
+otbrError PublisherEmbedded::Start(void)
+{
+    otbrError           error = OTBR_ERROR_NONE;
+    int                 one   = 1;
+    int                 hops  = 255;
+    struct ipv6_mreq    mreq;
+    struct sockaddr_in6 addr;
+
+    assert(mSocketFd == -1);
+
+    mSocketFd = socket(AF_INET6, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    VerifyOrExit(mSocketFd >= 0, error = OTBR_ERROR_ERRNO);
+
+    VerifyOrExit(setsockopt(mSocketFd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one)) == 0, error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(setsockopt(mSocketFd, SOL_SOCKET, SO_REUSEPORT, &one, sizeof(one)) == 0, error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(setsockopt(mSocketFd, IPPROTO_IPV6, IPV6_V6ONLY, &one, sizeof(one)) == 0, error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(setsockopt(mSocketFd, IPPROTO_IPV6, IPV6_MULTICAST_HOPS, &hops, sizeof(hops)) == 0,
+                 error = OTBR_ERROR_ERRNO);
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sin6_family = AF_INET6;
+    addr.sin6_port   = htons(kMdnsPort);
+    VerifyOrExit(bind(mSocketFd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) == 0,
+                 error = OTBR_ERROR_ERRNO);
+
+    memset(&mreq, 0, sizeof(mreq));
+    mreq.ipv6mr_multiaddr = kMdnsMulticastGroup;
+    mreq.ipv6mr_interface = 0;
+    VerifyOrExit(setsockopt(mSocketFd, IPPROTO_IPV6, IPV6_JOIN_GROUP, &mreq, sizeof(mreq)) == 0,
+                 error = OTBR_ERROR_ERRNO);
+
+    otbrLogInfo("Embedded mDNS responder started");
+    mState = State::kReady;
+    mStateCallback(mState);
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogErr("Failed to start embedded mDNS responder: %s", strerror(errno));
+
+        if (mSocketFd != -1)
+        {
+            close(mSocketFd);
+            mSocketFd = -1;
+        }
+    }
+
+    return error;
+}
+
+bool PublisherEmbedded::IsStarted(void) const
+{
+    return mSocketFd >= 0;
+}
+
+void PublisherEmbedded::Stop(void)
+{
+    VerifyOrExit(mSocketFd != -1);
+
+    close(mSocketFd);
+    mSocketFd = -1;
+    mState    = State::kIdle;
+    mServiceRegistrations.clear();
+    mHostRegistrations.clear();
+
+exit:
+    return;
+}
+
+void PublisherEmbedded::Update(MainloopContext &aMainloop)
+{
+    VerifyOrExit(mSocketFd != -1);
+
+    FD_SET(mSocketFd, &aMainloop.mReadFdSet);
+    aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, mSocketFd);
+
+exit:
+    UpdateDiscoveryBatchTimeout(aMainloop);
+}
+
+void PublisherEmbedded::Process(const MainloopContext &aMainloop)
+{
+    uint8_t buffer[kMaxMessageSize];
+
+    VerifyOrExit(mSocketFd != -1 && FD_ISSET(mSocketFd, &aMainloop.mReadFdSet));
+
+    while (true)
+    {
+        ssize_t length = recv(mSocketFd, buffer, sizeof(buffer), 0);
+
+        if (length <= 0)
+        {
+            break;
+        }
+
+        HandleMessage(buffer, static_cast<uint16_t>(length));
+    }
+
+exit:
+    FlushDueDiscoveryBatches();
+}
+
+otbrError PublisherEmbedded::SendMessage(const std::vector<uint8_t> &aMessage)
+{
+    otbrError           error = OTBR_ERROR_NONE;
+    struct sockaddr_in6 addr;
+
+    VerifyOrExit(mSocketFd != -1, error = OTBR_ERROR_MDNS);
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sin6_family = AF_INET6;
+    addr.sin6_port   = htons(kMdnsPort);
+    addr.sin6_addr   = kMdnsMulticastGroup;
+
+    VerifyOrExit(sendto(mSocketFd, aMessage.data(), aMessage.size(), 0, reinterpret_cast<struct sockaddr *>(&addr),
+                        sizeof(addr)) == static_cast<ssize_t>(aMessage.size()),
+                 error = OTBR_ERROR_ERRNO);
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to send mDNS message: %s", strerror(errno));
+    }
+
+    return error;
+}
+
+void PublisherEmbedded::SendQuery(const std::string &aFullName, uint16_t aRecordType)
+{
+    std::vector<uint8_t> message;
+
+    AppendUint16(message, 0); // Transaction ID is zero in mDNS.
+    AppendUint16(message, 0); // Flags: standard query.
+    AppendUint16(message, 1); // One question.
+    AppendUint16(message, 0);
+    AppendUint16(message, 0);
+    AppendUint16(message, 0);
+
+    SuccessOrExit(AppendName(message, aFullName));
+    AppendUint16(message, aRecordType);
+    AppendUint16(message, kDnsClassIn);
+
+    SendMessage(message);
+
+exit:
+    return;
+}
+
+void PublisherEmbedded::AppendServiceRecords(std::vector<uint8_t> &     aMessage,
+                                             const ServiceRegistration &aServiceReg,
+                                             uint32_t                   aTtl,
+                                             uint16_t &                 aAnswerCount)
+{
+    std::string          fullInstanceName = MakeFullServiceName(aServiceReg.mName, aServiceReg.mType);
+    std::string          fullTypeName     = aServiceReg.mType + ".local";
+    std::string          fullHostName =
+        MakeFullHostName(aServiceReg.mHostName.empty() ? "otbr" : aServiceReg.mHostName);
+    std::vector<uint8_t> txtData;
+    size_t               lengthOffset;
+
+    // PTR record: service type to instance.
+    SuccessOrExit(AppendName(aMessage, fullTypeName));
+    AppendUint16(aMessage, kDnsTypePtr);
+    AppendUint16(aMessage, kDnsClassIn);
+    AppendUint32(aMessage, aTtl);
+    lengthOffset = aMessage.size();
+    AppendUint16(aMessage, 0);
+    SuccessOrExit(AppendName(aMessage, fullInstanceName));
+    WriteUint16(aMessage, lengthOffset, static_cast<uint16_t>(aMessage.size() - lengthOffset - 2));
+    ++aAnswerCount;
+
+    // PTR records for each sub-type.
+    for (const std::string &subType : aServiceReg.mSubTypeList)
+    {
+        SuccessOrExit(AppendName(aMessage, subType + "._sub." + fullTypeName));
+        AppendUint16(aMessage, kDnsTypePtr);
+        AppendUint16(aMessage, kDnsClassIn);
+        AppendUint32(aMessage, aTtl);
+        lengthOffset = aMessage.size();
+        AppendUint16(aMessage, 0);
+        SuccessOrExit(AppendName(aMessage, fullInstanceName));
+        WriteUint16(aMessage, lengthOffset, static_cast<uint16_t>(aMessage.size() - lengthOffset - 2));
+        ++aAnswerCount;
+    }
+
+    // SRV record.
+    SuccessOrExit(AppendName(aMessage, fullInstanceName));
+    AppendUint16(aMessage, kDnsTypeSrv);
+    AppendUint16(aMessage, kDnsClassIn | kDnsCacheFlushBit);
+    AppendUint32(aMessage, aTtl);
+    lengthOffset = aMessage.size();
+    AppendUint16(aMessage, 0);
+    AppendUint16(aMessage, 0); // Priority.
+    AppendUint16(aMessage, 0); // Weight.
+    AppendUint16(aMessage, aServiceReg.mPort);
+    SuccessOrExit(AppendName(aMessage, fullHostName));
+    WriteUint16(aMessage, lengthOffset, static_cast<uint16_t>(aMessage.size() - lengthOffset - 2));
+    ++aAnswerCount;
+
+    // TXT record.
+    SuccessOrExit(EncodeTxtData(aServiceReg.mTxtList, txtData));
+    SuccessOrExit(AppendName(aMessage, fullInstanceName));
+    AppendUint16(aMessage, kDnsTypeTxt);
+    AppendUint16(aMessage, kDnsClassIn | kDnsCacheFlushBit);
+    AppendUint32(aMessage, aTtl);
+    AppendUint16(aMessage, static_cast<uint16_t>(txtData.size()));
+    aMessage.insert(aMessage.end(), txtData.begin(), txtData.end());
+    ++aAnswerCount;
+
+exit:
+    return;
+}
+
+void PublisherEmbedded::AppendHostRecords(std::vector<uint8_t> &  aMessage,
+                                          const HostRegistration &aHostReg,
+                                          uint32_t                aTtl,
+                                          uint16_t &              aAnswerCount)
+{
+    std::string fullHostName = MakeFullHostName(aHostReg.mName);
+
+    for (const Ip6Address &address : aHostReg.mAddresses)
+    {
+        SuccessOrExit(AppendName(aMessage, fullHostName));
+        AppendUint16(aMessage, kDnsTypeAaaa);
+        AppendUint16(aMessage, kDnsClassIn | kDnsCacheFlushBit);
+        AppendUint32(aMessage, aTtl);
+        AppendUint16(aMessage, sizeof(address.m8));
+        aMessage.insert(aMessage.end(), address.m8, address.m8 + sizeof(address.m8));
+        ++aAnswerCount;
+    }
+
+exit:
+    return;
+}
+
+void PublisherEmbedded::AnnounceService(const ServiceRegistration &aServiceReg, uint32_t aTtl)
+{
+    std::vector<uint8_t> message;
+    uint16_t             answerCount = 0;
+
+    AppendUint16(message, 0);
+    AppendUint16(message, kDnsFlagsResponse);
+    AppendUint16(message, 0);
+    AppendUint16(message, 0); // Answer count is patched below.
+    AppendUint16(message, 0);
+    AppendUint16(message, 0);
+
+    AppendServiceRecords(message, aServiceReg, aTtl, answerCount);
+
+    if (!aServiceReg.mHostName.empty())
+    {
+        HostRegistration *hostReg = FindHostRegistration(aServiceReg.mHostName);
+
+        if (hostReg != nullptr)
+        {
+            AppendHostRecords(message, *hostReg, aTtl, answerCount);
+        }
+    }
+
+    WriteUint16(message, 6, answerCount);
+    SendMessage(message);
+}
+
+void PublisherEmbedded::AnnounceHost(const HostRegistration &aHostReg, uint32_t aTtl)
+{
+    std::vector<uint8_t> message;
+    uint16_t             answerCount = 0;
+
+    AppendUint16(message, 0);
+    AppendUint16(message, kDnsFlagsResponse);
+    AppendUint16(message, 0);
+    AppendUint16(message, 0);
+    AppendUint16(message, 0);
+    AppendUint16(message, 0);
+
+    AppendHostRecords(message, aHostReg, aTtl, answerCount);
+
+    WriteUint16(message, 6, answerCount);
+    SendMessage(message);
+}
+
+void PublisherEmbedded::PublishServiceImpl(const std::string &aHostName,
+                                           const std::string &aName,
+                                           const std::string &aType,
+                                           const SubTypeList &aSubTypeList,
+                                           uint16_t           aPort,
+                                           TxtList            aTxtList,
+                                           ResultCallback &&  aCallback)
+{
+    otbrError            error             = OTBR_ERROR_NONE;
+    SubTypeList          sortedSubTypeList = SortSubTypeList(aSubTypeList);
+    TxtList              sortedTxtList     = SortTxtList(std::move(aTxtList));
+    ServiceRegistration *serviceReg;
+
+    aCallback = HandleDuplicateServiceRegistration(aHostName, aName, aType, sortedSubTypeList, aPort, sortedTxtList,
+                                                   std::move(aCallback));
+    VerifyOrExit(!aCallback.IsNull());
+    VerifyOrExit(IsStarted(), error = OTBR_ERROR_MDNS);
+
+    AddServiceRegistration(ServiceRegistrationPtr(new ServiceRegistration(
+        aHostName, aName, aType, sortedSubTypeList, aPort, std::move(sortedTxtList), std::move(aCallback), this)));
+
+    serviceReg = FindServiceRegistration(aName, aType);
+    AnnounceService(*serviceReg, kDefaultTtl);
+    serviceReg->Complete(OTBR_ERROR_NONE);
+
+exit:
+    if (error != OTBR_ERROR_NONE && !aCallback.IsNull())
+    {
+        std::move(aCallback)(error);
+    }
+}
+
+void PublisherEmbedded::PublishHostImpl(const std::string &            aName,
+                                        const std::vector<Ip6Address> &aAddresses,
+                                        ResultCallback &&              aCallback)
+{
+    otbrError         error = OTBR_ERROR_NONE;
+    HostRegistration *hostReg;
+
+    aCallback = HandleDuplicateHostRegistration(aName, aAddresses, std::move(aCallback));
+    VerifyOrExit(!aCallback.IsNull());
+    VerifyOrExit(!aAddresses.empty(), std::move(aCallback)(OTBR_ERROR_NONE));
+    VerifyOrExit(IsStarted(), error = OTBR_ERROR_MDNS);
+
+    AddHostRegistration(HostRegistrationPtr(new HostRegistration(aName, aAddresses, std::move(aCallback), this)));
+
+    hostReg = FindHostRegistration(aName);
+    AnnounceHost(*hostReg, kDefaultTtl);
+    hostReg->Complete(OTBR_ERROR_NONE);
+
+exit:
+    if (error != OTBR_ERROR_NONE && !aCallback.IsNull())
+    {
+        std::move(aCallback)(error);
+    }
+}
+
+void PublisherEmbedded::UnpublishService(const std::string &aName, const std::string &aType, ResultCallback &&aCallback)
+{
+    ServiceRegistration *serviceReg = FindServiceRegistration(aName, aType);
+
+    if (serviceReg != nullptr)
+    {
+        // Send a goodbye packet (TTL zero) so caches drop the records.
+        AnnounceService(*serviceReg, 0);
+    }
+
+    RemoveServiceRegistration(aName, aType, OTBR_ERROR_ABORTED);
+    std::move(aCallback)(OTBR_ERROR_NONE);
+}
+
+void PublisherEmbedded::UnpublishHost(const std::string &aName, ResultCallback &&aCallback)
+{
+    HostRegistration *hostReg = FindHostRegistration(aName);
+
+    if (hostReg != nullptr)
+    {
+        AnnounceHost(*hostReg, 0);
+    }
+
+    RemoveHostRegistration(aName, OTBR_ERROR_ABORTED);
+    std::move(aCallback)(OTBR_ERROR_NONE);
+}
+
+void PublisherEmbedded::SubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName)
+{
+    mSubscribedServices.push_back(ServiceSubscription{aType, aInstanceName});
+
+    otbrLogInfo("Subscribe service %s.%s (total %zu)", aInstanceName.c_str(), aType.c_str(),
+                mSubscribedServices.size());
+
+    if (aInstanceName.empty())
+    {
+        SendQuery(aType + ".local", kDnsTypePtr);
+    }
+    else
+    {
+        SendQuery(MakeFullServiceName(aInstanceName, aType), kDnsTypeAny);
+    }
+}
+
+void PublisherEmbedded::UnsubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName)
+{
+    auto it =
+        std::find_if(mSubscribedServices.begin(), mSubscribedServices.end(),
+                     [&aType, &aInstanceName](const ServiceSubscription &aSubscription) {
+                         return aSubscription.mType == aType && aSubscription.mInstanceName == aInstanceName;
+                     });
+
+    assert(it != mSubscribedServices.end());
+    mSubscribedServices.erase(it);
+
+    otbrLogInfo("Unsubscribe service %s.%s (remaining %zu)", aInstanceName.c_str(), aType.c_str(),
+                mSubscribedServices.size());
+}
+
+void PublisherEmbedded::SubscribeHostImpl(const std::string &aHostName)
+{
+    mSubscribedHosts.push_back(aHostName);
+
+    otbrLogInfo("Subscribe host %s (total %zu)", aHostName.c_str(), mSubscribedHosts.size());
+
+    SendQuery(MakeFullHostName(aHostName), kDnsTypeAaaa);
+}
+
+void PublisherEmbedded::UnsubscribeHostImpl(const std::string &aHostName)
+{
+    auto it = std::find(mSubscribedHosts.begin(), mSubscribedHosts.end(), aHostName);
+
+    assert(it != mSubscribedHosts.end());
+    mSubscribedHosts.erase(it);
+
+    otbrLogInfo("Unsubscribe host %s (remaining %zu)", aHostName.c_str(), mSubscribedHosts.size());
+}
+
+void PublisherEmbedded::OnServiceResolveFailedImpl(const std::string &aType,
+                                                   const std::string &aInstanceName,
+                                                   int32_t            aErrorCode)
+{
+    otbrLogWarning("Resolve service %s.%s failed: %" PRId32, aInstanceName.c_str(), aType.c_str(), aErrorCode);
+}
+
+void PublisherEmbedded::OnHostResolveFailedImpl(const std::string &aHostName, int32_t aErrorCode)
+{
+    otbrLogWarning("Resolve host %s failed: %" PRId32, aHostName.c_str(), aErrorCode);
+}
+
+otbrError PublisherEmbedded::DnsErrorToOtbrError(int32_t aErrorCode)
+{
+    return aErrorCode == 0 ? OTBR_ERROR_NONE : OTBR_ERROR_MDNS;
+}
+
+void PublisherEmbedded::HandleMessage(const uint8_t *aMessage, uint16_t aLength)
+{
+    static constexpr uint16_t  kHeaderSize = 12;
+    uint16_t                   flags;
+    uint16_t                   questionCount;
+    uint16_t                   recordCount;
+    uint16_t                   offset = kHeaderSize;
+    std::vector<ParsedRecord>  questions;
+    std::vector<ParsedRecord>  records;
+
+    VerifyOrExit(aLength >= kHeaderSize);
+
+    flags         = static_cast<uint16_t>(aMessage[2] << 8) | aMessage[3];
+    questionCount = static_cast<uint16_t>(aMessage[4] << 8) | aMessage[5];
+    // Answer, authority and additional records are handled uniformly.
+    recordCount = (static_cast<uint16_t>(aMessage[6] << 8) | aMessage[7]) +
+                  (static_cast<uint16_t>(aMessage[8] << 8) | aMessage[9]) +
+                  (static_cast<uint16_t>(aMessage[10] << 8) | aMessage[11]);
+
+    for (uint16_t i = 0; i < questionCount; ++i)
+    {
+        ParsedRecord question;
+
+        SuccessOrExit(ReadName(aMessage, aLength, offset, question.mName));
+        VerifyOrExit(offset + 4 <= aLength);
+        question.mType  = static_cast<uint16_t>(aMessage[offset] << 8) | aMessage[offset + 1];
+        question.mClass = static_cast<uint16_t>(aMessage[offset + 2] << 8) | aMessage[offset + 3];
+        offset += 4;
+
+        questions.push_back(std::move(question));
+    }
+
+    for (uint16_t i = 0; i < recordCount; ++i)
+    {
+        ParsedRecord record;
+        uint16_t     dataLength;
+        uint16_t     dataOffset;
+
+        SuccessOrExit(ReadName(aMessage, aLength, offset, record.mName));
+        VerifyOrExit(offset + 10 <= aLength);
+        record.mType  = static_cast<uint16_t>(aMessage[offset] << 8) | aMessage[offset + 1];
+        record.mClass = static_cast<uint16_t>(aMessage[offset + 2] << 8) | aMessage[offset + 3];
+        record.mTtl   = (static_cast<uint32_t>(aMessage[offset + 4]) << 24) |
+                      (static_cast<uint32_t>(aMessage[offset + 5]) << 16) |
+                      (static_cast<uint32_t>(aMessage[offset + 6]) << 8) | aMessage[offset + 7];
+        dataLength = static_cast<uint16_t>(aMessage[offset + 8] << 8) | aMessage[offset + 9];
+        offset += 10;
+        VerifyOrExit(offset + dataLength <= aLength);
+
+        record.mData.assign(&aMessage[offset], &aMessage[offset + dataLength]);
+        dataOffset = offset;
+
+        switch (record.mType)
+        {
+        case kDnsTypePtr:
+            SuccessOrExit(ReadName(aMessage, aLength, dataOffset, record.mDataName));
+            break;
+        case kDnsTypeSrv:
+            VerifyOrExit(dataLength >= 6);
+            record.mSrvPriority = static_cast<uint16_t>(aMessage[dataOffset] << 8) | aMessage[dataOffset + 1];
+            record.mSrvWeight   = static_cast<uint16_t>(aMessage[dataOffset + 2] << 8) | aMessage[dataOffset + 3];
+            record.mSrvPort     = static_cast<uint16_t>(aMessage[dataOffset + 4] << 8) | aMessage[dataOffset + 5];
+            dataOffset += 6;
+            SuccessOrExit(ReadName(aMessage, aLength, dataOffset, record.mDataName));
+            break;
+        default:
+            break;
+        }
+
+        offset += dataLength;
+        records.push_back(std::move(record));
+    }
+
+    if ((flags & 0x8000) == 0)
+    {
+        HandleQuery(questions);
+    }
+    else
+    {
+        HandleResponse(records);
+    }
+
+exit:
+    return;
+}
+
+void PublisherEmbedded::HandleQuery(const std::vector<ParsedRecord> &aQuestions)
+{
+    std::vector<uint8_t> message;
+    uint16_t             answerCount = 0;
+
+    AppendUint16(message, 0);
+    AppendUint16(message, kDnsFlagsResponse);
+    AppendUint16(message, 0);
+    AppendUint16(message, 0);
+    AppendUint16(message, 0);
+    AppendUint16(message, 0);
+
+    for (const ParsedRecord &question : aQuestions)
+    {
+        for (const auto &kv : mServiceRegistrations)
+        {
+            const ServiceRegistration &serviceReg       = *kv.second;
+            std::string                fullTypeName     = serviceReg.mType + ".local";
+            std::string                fullInstanceName = MakeFullServiceName(serviceReg.mName, serviceReg.mType);
+
+            if ((question.mType == kDnsTypePtr || question.mType == kDnsTypeAny) && question.mName == fullTypeName)
+            {
+                AppendServiceRecords(message, serviceReg, kDefaultTtl, answerCount);
+            }
+            else if ((question.mType == kDnsTypeSrv || question.mType == kDnsTypeTxt ||
+                      question.mType == kDnsTypeAny) &&
+                     question.mName == fullInstanceName)
+            {
+                AppendServiceRecords(message, serviceReg, kDefaultTtl, answerCount);
+            }
+        }
+
+        for (const auto &kv : mHostRegistrations)
+        {
+            const HostRegistration &hostReg = *kv.second;
+
+            if ((question.mType == kDnsTypeAaaa || question.mType == kDnsTypeAny) &&
+                question.mName == MakeFullHostName(hostReg.mName))
+            {
+                AppendHostRecords(message, hostReg, kDefaultTtl, answerCount);
+            }
+        }
+    }
+
+    VerifyOrExit(answerCount > 0);
+
+    WriteUint16(message, 6, answerCount);
+    SendMessage(message);
+
+exit:
+    return;
+}
+
+void PublisherEmbedded::HandleResponse(const std::vector<ParsedRecord> &aRecords)
+{
+    for (const ServiceSubscription &subscription : mSubscribedServices)
+    {
+        std::string fullTypeName = subscription.mType + ".local";
+
+        for (const ParsedRecord &ptrRecord : aRecords)
+        {
+            DiscoveredInstanceInfo instanceInfo;
+            std::string            fullInstanceName;
+            bool                   hasSrv = false;
+
+            if (ptrRecord.mType != kDnsTypePtr || ptrRecord.mName != fullTypeName)
+            {
+                continue;
+            }
+
+            fullInstanceName  = ptrRecord.mDataName;
+            instanceInfo.mTtl = ptrRecord.mTtl;
+
+            // The instance label precedes ".<type>.local".
+            if (fullInstanceName.size() <= fullTypeName.size() + 1)
+            {
+                continue;
+            }
+
+            instanceInfo.mName = fullInstanceName.substr(0, fullInstanceName.size() - fullTypeName.size() - 1);
+
+            if (!subscription.mInstanceName.empty() && instanceInfo.mName != subscription.mInstanceName)
+            {
+                continue;
+            }
+
+            if (ptrRecord.mTtl == 0)
+            {
+                OnServiceRemoved(0, subscription.mType, instanceInfo.mName);
+                continue;
+            }
+
+            // A well-formed mDNS response carries the SRV, TXT and AAAA
+            // records for the instance in the same message.
+            for (const ParsedRecord &record : aRecords)
+            {
+                if (record.mType == kDnsTypeSrv && record.mName == fullInstanceName)
+                {
+                    hasSrv                 = true;
+                    instanceInfo.mHostName = record.mDataName + ".";
+                    instanceInfo.mPort     = record.mSrvPort;
+                    instanceInfo.mPriority = record.mSrvPriority;
+                    instanceInfo.mWeight   = record.mSrvWeight;
+                }
+                else if (record.mType == kDnsTypeTxt && record.mName == fullInstanceName)
+                {
+                    instanceInfo.mTxtData = record.mData;
+                }
+            }
+
+            if (hasSrv)
+            {
+                for (const ParsedRecord &record : aRecords)
+                {
+                    if (record.mType == kDnsTypeAaaa && record.mName + "." == instanceInfo.mHostName &&
+                        record.mData.size() == OTBR_IP6_ADDRESS_SIZE)
+                    {
+                        instanceInfo.mAddresses.push_back(Ip6Address(
+                            *reinterpret_cast<const uint8_t(*)[OTBR_IP6_ADDRESS_SIZE]>(record.mData.data())));
+                    }
+                }
+
+                OnServiceResolved(subscription.mType, instanceInfo);
+            }
+        }
+    }
+
+    for (const std::string &hostName : mSubscribedHosts)
+    {
+        DiscoveredHostInfo hostInfo;
+        std::string        fullHostName = MakeFullHostName(hostName);
+
+        for (const ParsedRecord &record : aRecords)
+        {
+            if (record.mType == kDnsTypeAaaa && record.mName == fullHostName &&
+                record.mData.size() == OTBR_IP6_ADDRESS_SIZE)
+            {
+                hostInfo.mAddresses.push_back(
+                    Ip6Address(*reinterpret_cast<const uint8_t(*)[OTBR_IP6_ADDRESS_SIZE]>(record.mData.data())));
+                hostInfo.mTtl = record.mTtl;
+            }
+        }
+
+        if (!hostInfo.mAddresses.empty())
+        {
+            hostInfo.mHostName = fullHostName + ".";
+            OnHostResolved(hostName, hostInfo);
+        }
+    }
+}
+
+Publisher *Publisher::Create(StateCallback aStateCallback)
+{
+    return new PublisherEmbedded(std::move(aStateCallback));
+}
+
+void Publisher::Destroy(Publisher *aPublisher)
+{
+    delete static_cast<PublisherEmbedded *>(aPublisher);
+}
+
+} // namespace Mdns
+
+} // namespace otbr
@@ -0,0 +1,157 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definition for the embedded in-process mDNS publisher.
+ */
+
+#ifndef OTBR_AGENT_MDNS_EMBEDDED_HPP_
+#define OTBR_AGENT_MDNS_EMBEDDED_HPP_
+
+#include <string>
+#include <vector>
+
+#include "common/code_utils.hpp"
+#include "common/mainloop.hpp"
+#include "common/types.hpp"
+#include "mdns/mdns.hpp"
+
+namespace otbr {
+
+namespace Mdns {
+
+/**
+ * This class implements mDNS publisher with an embedded in-process responder.
+ *
+ * Unlike the Avahi and mDNSResponder backends, this publisher speaks mDNS
+ * directly over a multicast UDP socket, so publish and browse operations do
+ * not pay a round trip to an external daemon. It implements the subset of
+ * RFC 6762 that the agent needs (announcing, query answering, goodbye
+ * packets, one-shot browse/resolve queries) and deliberately omits probing
+ * and conflict resolution.
+ *
+ */
+class PublisherEmbedded : public MainloopProcessor, public Publisher
+{
+public:
+    explicit PublisherEmbedded(StateCallback aStateCallback);
+
+    ~PublisherEmbedded(void) override;
+
+    // Implementation of Mdns::Publisher.
+
+    void UnpublishService(const std::string &aName, const std::string &aType, ResultCallback &&aCallback) override;
+
+    void      UnpublishHost(const std::string &aName, ResultCallback &&aCallback) override;
+    otbrError Start(void) override;
+    bool      IsStarted(void) const override;
+    void      Stop(void) override;
+
+    // Implementation of MainloopProcessor.
+
+    void Update(MainloopContext &aMainloop) override;
+    void Process(const MainloopContext &aMainloop) override;
+
+protected:
+    void PublishServiceImpl(const std::string &aHostName,
+                            const std::string &aName,
+                            const std::string &aType,
+                            const SubTypeList &aSubTypeList,
+                            uint16_t           aPort,
+                            TxtList            aTxtList,
+                            ResultCallback &&  aCallback) override;
+    void PublishHostImpl(const std::string &            aName,
+                         const std::vector<Ip6Address> &aAddresses,
+                         ResultCallback &&              aCallback) override;
+    void SubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName) override;
+    void UnsubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName) override;
+    void SubscribeHostImpl(const std::string &aHostName) override;
+    void UnsubscribeHostImpl(const std::string &aHostName) override;
+    void OnServiceResolveFailedImpl(const std::string &aType,
+                                    const std::string &aInstanceName,
+                                    int32_t            aErrorCode) override;
+    void OnHostResolveFailedImpl(const std::string &aHostName, int32_t aErrorCode) override;
+
+    otbrError DnsErrorToOtbrError(int32_t aErrorCode) override;
+
+private:
+    static constexpr uint16_t kMdnsPort       = 5353;
+    static constexpr uint32_t kDefaultTtl     = 10;
+    static constexpr size_t   kMaxMessageSize = 8192;
+
+    struct ServiceSubscription
+    {
+        std::string mType;
+        std::string mInstanceName; ///< Empty for browse subscriptions.
+    };
+
+    // A resource record parsed from a received message.
+    struct ParsedRecord
+    {
+        std::string          mName;
+        uint16_t             mType  = 0;
+        uint16_t             mClass = 0;
+        uint32_t             mTtl   = 0;
+        std::vector<uint8_t> mData;
+        std::string          mDataName; ///< The decompressed RDATA name of PTR and SRV records.
+        uint16_t             mSrvPort     = 0;
+        uint16_t             mSrvPriority = 0;
+        uint16_t             mSrvWeight   = 0;
+    };
+
+    otbrError SendMessage(const std::vector<uint8_t> &aMessage);
+    void      SendQuery(const std::string &aFullName, uint16_t aRecordType);
+    void      AnnounceService(const ServiceRegistration &aServiceReg, uint32_t aTtl);
+    void      AnnounceHost(const HostRegistration &aHostReg, uint32_t aTtl);
+
+    void AppendServiceRecords(std::vector<uint8_t> &     aMessage,
+                              const ServiceRegistration &aServiceReg,
+                              uint32_t                   aTtl,
+                              uint16_t &                 aAnswerCount);
+    void AppendHostRecords(std::vector<uint8_t> &  aMessage,
+                           const HostRegistration &aHostReg,
+                           uint32_t                aTtl,
+                           uint16_t &              aAnswerCount);
+
+    void HandleMessage(const uint8_t *aMessage, uint16_t aLength);
+    void HandleQuery(const std::vector<ParsedRecord> &aQuestions);
+    void HandleResponse(const std::vector<ParsedRecord> &aRecords);
+
+    int                              mSocketFd;
+    State                            mState;
+    StateCallback                    mStateCallback;
+    std::vector<ServiceSubscription> mSubscribedServices;
+    std::vector<std::string>         mSubscribedHosts;
+};
+
+} // namespace Mdns
+
+} // namespace otbr
+
+#endif // OTBR_AGENT_MDNS_EMBEDDED_HPP_
@@ -57,6 +57,11 @@ namespace Mdns {
 
 static const char kDomain[] = "local.";
 
+// At most this many service instance resolutions (a DNSServiceResolve
+// followed by a DNSServiceGetAddrInfo) run concurrently; a browse burst
+// queues the rest so the resolver is not flooded.
+static constexpr uint32_t kMaxConcurrentResolutions = 8;
+
 static otbrError DNSErrorToOtbrError(DNSServiceErrorType aError)
 {
     otbrError error;
@@ -210,9 +215,10 @@ static const char *DNSErrorToString(DNSServiceErrorType aError)
 }
 
 PublisherMDnsSd::PublisherMDnsSd(StateCallback aCallback)
-    : mHostsRef(nullptr)
+    : mSharedConnection(nullptr)
     , mState(State::kIdle)
     , mStateCallback(std::move(aCallback))
+    , mRunningResolutionCount(0)
 {
 }
 
@@ -243,17 +249,23 @@ void PublisherMDnsSd::Stop(void)
     std::swap(mServiceRegistrations, serviceRegistrations);
     std::swap(mHostRegistrations, hostRegistrations);
 
-    if (mHostsRef != nullptr)
-    {
-        DNSServiceRefDeallocate(mHostsRef);
-        otbrLogDebug("Deallocated DNSServiceRef for hosts: %p", mHostsRef);
-        mHostsRef = nullptr;
-    }
+    // The registrations and subscriptions must be destroyed while the
+    // shared connection is still valid: their destructors cancel the
+    // operations sharing it.
+    serviceRegistrations.clear();
+    hostRegistrations.clear();
 
     mSubscribedServices.clear();
 
     mSubscribedHosts.clear();
 
+    if (mSharedConnection != nullptr)
+    {
+        DNSServiceRefDeallocate(mSharedConnection);
+        otbrLogDebug("Deallocated shared DNSServiceRef: %p", mSharedConnection);
+        mSharedConnection = nullptr;
+    }
+
     mState = State::kIdle;
 
 exit:
@@ -262,24 +274,12 @@ exit:
 
 void PublisherMDnsSd::Update(MainloopContext &aMainloop)
 {
-    for (auto &kv : mServiceRegistrations)
+    // All registrations and instance resolutions share one connection, so a
+    // single fd is polled regardless of how many services are advertised or
+    // being resolved.
+    if (mSharedConnection != nullptr)
     {
-        auto &serviceReg = static_cast<DnssdServiceRegistration &>(*kv.second);
-
-        assert(serviceReg.GetServiceRef() != nullptr);
-
-        int fd = DNSServiceRefSockFD(serviceReg.GetServiceRef());
-
-        if (fd != -1)
-        {
-            FD_SET(fd, &aMainloop.mReadFdSet);
-            aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, fd);
-        }
-    }
-
-    if (mHostsRef != nullptr)
-    {
-        int fd = DNSServiceRefSockFD(mHostsRef);
+        int fd = DNSServiceRefSockFD(mSharedConnection);
 
         assert(fd != -1);
 
@@ -297,30 +297,23 @@ void PublisherMDnsSd::Update(MainloopContext &aMainloop)
     {
         host->Update(aMainloop);
     }
+
+    UpdateDiscoveryBatchTimeout(aMainloop);
 }
 
 void PublisherMDnsSd::Process(const MainloopContext &aMainloop)
 {
     std::vector<DNSServiceRef> readyServices;
 
-    for (auto &kv : mServiceRegistrations)
-    {
-        auto &serviceReg = static_cast<DnssdServiceRegistration &>(*kv.second);
-        int   fd         = DNSServiceRefSockFD(serviceReg.GetServiceRef());
-
-        if (FD_ISSET(fd, &aMainloop.mReadFdSet))
-        {
-            readyServices.push_back(serviceReg.GetServiceRef());
-        }
-    }
-
-    if (mHostsRef != nullptr)
+    if (mSharedConnection != nullptr)
     {
-        int fd = DNSServiceRefSockFD(mHostsRef);
+        int fd = DNSServiceRefSockFD(mSharedConnection);
 
         if (FD_ISSET(fd, &aMainloop.mReadFdSet))
         {
-            readyServices.push_back(mHostsRef);
+            // Processing the shared connection dispatches the replies of
+            // every operation multiplexed over it.
+            readyServices.push_back(mSharedConnection);
         }
     }
 
@@ -353,13 +346,17 @@ void PublisherMDnsSd::Process(const MainloopContext &aMainloop)
         }
     }
 exit:
-    return;
+    // Resolutions finished during dispatch free slots for queued ones.
+    StartPendingResolutions();
+    FlushDueDiscoveryBatches();
 }
 
 PublisherMDnsSd::DnssdServiceRegistration::~DnssdServiceRegistration(void)
 {
     if (mServiceRef != nullptr)
     {
+        static_cast<PublisherMDnsSd *>(mPublisher)->mServiceRefMap.erase(mServiceRef);
+        // Cancels only this operation; the shared connection stays alive.
         DNSServiceRefDeallocate(mServiceRef);
     }
 }
@@ -401,17 +398,11 @@ exit:
 Publisher::ServiceRegistration *PublisherMDnsSd::FindServiceRegistration(const DNSServiceRef &aServiceRef)
 {
     ServiceRegistration *result = nullptr;
+    auto                 it     = mServiceRefMap.find(aServiceRef);
 
-    for (auto &kv : mServiceRegistrations)
+    if (it != mServiceRefMap.end())
     {
-        // We are sure that the service registrations must be instances of `DnssdServiceRegistration`.
-        auto &serviceReg = static_cast<DnssdServiceRegistration &>(*kv.second);
-
-        if (serviceReg.GetServiceRef() == aServiceRef)
-        {
-            result = kv.second.get();
-            break;
-        }
+        result = it->second;
     }
 
     return result;
@@ -481,19 +472,32 @@ exit:
     return;
 }
 
+DNSServiceErrorType PublisherMDnsSd::EnsureSharedConnection(void)
+{
+    DNSServiceErrorType error = kDNSServiceErr_NoError;
+
+    VerifyOrExit(mSharedConnection == nullptr);
+
+    SuccessOrExit(error = DNSServiceCreateConnection(&mSharedConnection));
+    otbrLogDebug("Created shared DNSServiceRef: %p", mSharedConnection);
+
+exit:
+    return error;
+}
+
 void PublisherMDnsSd::PublishServiceImpl(const std::string &aHostName,
                                          const std::string &aName,
                                          const std::string &aType,
                                          const SubTypeList &aSubTypeList,
                                          uint16_t           aPort,
-                                         const TxtList &    aTxtList,
+                                         TxtList            aTxtList,
                                          ResultCallback &&  aCallback)
 {
     otbrError            ret   = OTBR_ERROR_NONE;
     int                  error = 0;
     std::vector<uint8_t> txt;
     SubTypeList          sortedSubTypeList = SortSubTypeList(aSubTypeList);
-    TxtList              sortedTxtList     = SortTxtList(aTxtList);
+    TxtList              sortedTxtList     = SortTxtList(std::move(aTxtList));
     std::string          regType           = MakeRegType(aType, sortedSubTypeList);
     DNSServiceRef        serviceRef        = nullptr;
     std::string          fullHostName;
@@ -509,14 +513,22 @@ void PublisherMDnsSd::PublishServiceImpl(const std::string &aHostName,
                                                    std::move(aCallback));
     VerifyOrExit(!aCallback.IsNull());
 
-    SuccessOrExit(ret = EncodeTxtData(aTxtList, txt));
-    otbrLogInfo("Registering new service %s.%s.local, serviceRef = %p", aName.c_str(), regType.c_str(), serviceRef);
-    SuccessOrExit(error = DNSServiceRegister(&serviceRef, kDNSServiceFlagsNoAutoRename, kDNSServiceInterfaceIndexAny,
-                                             aName.c_str(), regType.c_str(), /* domain */ nullptr,
-                                             !aHostName.empty() ? fullHostName.c_str() : nullptr, htons(aPort),
-                                             txt.size(), txt.data(), HandleServiceRegisterResult, this));
-    AddServiceRegistration(std::unique_ptr<DnssdServiceRegistration>(new DnssdServiceRegistration(
-        aHostName, aName, aType, sortedSubTypeList, aPort, sortedTxtList, std::move(aCallback), serviceRef, this)));
+    SuccessOrExit(ret = EncodeTxtData(sortedTxtList, txt));
+    SuccessOrExit(error = EnsureSharedConnection());
+
+    // The operation multiplexes over the shared connection: `serviceRef` is
+    // set to the shared connection on input and replaced with the operation
+    // reference on success.
+    serviceRef = mSharedConnection;
+    otbrLogInfo("Registering new service %s.%s.local", aName.c_str(), regType.c_str());
+    SuccessOrExit(error = DNSServiceRegister(
+                      &serviceRef, kDNSServiceFlagsShareConnection | kDNSServiceFlagsNoAutoRename,
+                      kDNSServiceInterfaceIndexAny, aName.c_str(), regType.c_str(), /* domain */ nullptr,
+                      !aHostName.empty() ? fullHostName.c_str() : nullptr, htons(aPort), txt.size(), txt.data(),
+                      HandleServiceRegisterResult, this));
+    AddServiceRegistration(std::unique_ptr<DnssdServiceRegistration>(
+        new DnssdServiceRegistration(aHostName, aName, aType, sortedSubTypeList, aPort, std::move(sortedTxtList),
+                                     std::move(aCallback), serviceRef, this)));
 
 exit:
     if (error != kDNSServiceErr_NoError || ret != OTBR_ERROR_NONE)
@@ -528,10 +540,8 @@ exit:
                        DNSErrorToString(error));
         }
 
-        if (serviceRef != nullptr)
-        {
-            DNSServiceRefDeallocate(serviceRef);
-        }
+        // No reference is deallocated here: on failure no operation was
+        // created and the shared connection must stay alive.
         std::move(aCallback)(ret);
     }
 }
@@ -564,20 +574,16 @@ void PublisherMDnsSd::PublishHostImpl(const std::string &            aName,
     VerifyOrExit(!aCallback.IsNull());
     VerifyOrExit(!aAddresses.empty(), std::move(aCallback)(OTBR_ERROR_NONE));
 
-    if (mHostsRef == nullptr)
-    {
-        SuccessOrExit(error = DNSServiceCreateConnection(&mHostsRef));
-        otbrLogDebug("Created new DNSServiceRef for hosts: %p", mHostsRef);
-    }
+    SuccessOrExit(error = EnsureSharedConnection());
 
-    registration = new DnssdHostRegistration(aName, aAddresses, std::move(aCallback), mHostsRef, this);
+    registration = new DnssdHostRegistration(aName, aAddresses, std::move(aCallback), mSharedConnection, this);
 
     otbrLogInfo("Registering new host %s", aName.c_str());
     for (const auto &address : aAddresses)
     {
         DNSRecordRef recordRef = nullptr;
         // Supports only IPv6 for now, may support IPv4 in the future.
-        SuccessOrExit(error = DNSServiceRegisterRecord(mHostsRef, &recordRef, kDNSServiceFlagsShared,
+        SuccessOrExit(error = DNSServiceRegisterRecord(mSharedConnection, &recordRef, kDNSServiceFlagsShared,
                                                        kDNSServiceInterfaceIndexAny, fullName.c_str(),
                                                        kDNSServiceType_AAAA, kDNSServiceClass_IN, sizeof(address.m8),
                                                        address.m8, /* ttl */ 0, HandleRegisterHostResult, this));
@@ -675,7 +681,7 @@ std::string PublisherMDnsSd::MakeRegType(const std::string &aType, SubTypeList a
     return regType;
 }
 
-void PublisherMDnsSd::SubscribeService(const std::string &aType, const std::string &aInstanceName)
+void PublisherMDnsSd::SubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName)
 {
     VerifyOrExit(mState == Publisher::State::kReady);
     mSubscribedServices.push_back(MakeUnique<ServiceSubscription>(*this, aType, aInstanceName));
@@ -696,7 +702,7 @@ exit:
     return;
 }
 
-void PublisherMDnsSd::UnsubscribeService(const std::string &aType, const std::string &aInstanceName)
+void PublisherMDnsSd::UnsubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName)
 {
     ServiceSubscriptionList::iterator it;
 
@@ -712,6 +718,9 @@ void PublisherMDnsSd::UnsubscribeService(const std::string &aType, const std::st
     otbrLogInfo("Unsubscribe service %s.%s (left %zu)", aInstanceName.c_str(), aType.c_str(),
                 mSubscribedServices.size());
 
+    // Resolutions torn down with the subscription free slots for queued ones.
+    StartPendingResolutions();
+
 exit:
     return;
 }
@@ -733,7 +742,7 @@ otbrError PublisherMDnsSd::DnsErrorToOtbrError(int32_t aErrorCode)
     return otbr::Mdns::DNSErrorToOtbrError(aErrorCode);
 }
 
-void PublisherMDnsSd::SubscribeHost(const std::string &aHostName)
+void PublisherMDnsSd::SubscribeHostImpl(const std::string &aHostName)
 {
     VerifyOrExit(mState == State::kReady);
     mSubscribedHosts.push_back(MakeUnique<HostSubscription>(*this, aHostName));
@@ -746,7 +755,7 @@ exit:
     return;
 }
 
-void PublisherMDnsSd::UnsubscribeHost(const std::string &aHostName)
+void PublisherMDnsSd::UnsubscribeHostImpl(const std::string &aHostName)
 {
     HostSubscriptionList ::iterator it;
 
@@ -876,14 +885,70 @@ exit:
     }
 }
 
+void PublisherMDnsSd::StartPendingResolutions(void)
+{
+    bool started;
+
+    // Starting a resolution may fail synchronously and run callbacks that
+    // mutate the subscription list, so the scan restarts after every start.
+    do
+    {
+        started = false;
+
+        VerifyOrExit(mRunningResolutionCount < kMaxConcurrentResolutions);
+
+        for (const auto &service : mSubscribedServices)
+        {
+            ServiceInstanceResolution *resolution;
+
+            if (service->mPendingResolutions.empty())
+            {
+                continue;
+            }
+
+            resolution = service->mPendingResolutions.front();
+            service->mPendingResolutions.pop_front();
+
+            mRunningResolutionCount++;
+            resolution->mStarted = true;
+            resolution->Resolve();
+            started = true;
+            break;
+        }
+    } while (started);
+
+exit:
+    return;
+}
+
 void PublisherMDnsSd::ServiceSubscription::Resolve(uint32_t           aInterfaceIndex,
                                                    const std::string &aInstanceName,
                                                    const std::string &aType,
                                                    const std::string &aDomain)
 {
+    ServiceInstanceResolution *resolution;
+    bool                       isFirst = mSeenInstances.insert(aInstanceName).second;
+
     mResolvingInstances.push_back(
         MakeUnique<ServiceInstanceResolution>(*this, aInstanceName, aType, aDomain, aInterfaceIndex));
-    mResolvingInstances.back()->Resolve();
+    resolution                     = mResolvingInstances.back().get();
+    resolution->mIsFirstResolution = isFirst;
+
+    if (isFirst)
+    {
+        // Fresh sightings queue ahead of TTL-driven re-resolutions so a
+        // browse burst does not delay first-instance results.
+        auto it = std::find_if(mPendingResolutions.begin(), mPendingResolutions.end(),
+                               [](const ServiceInstanceResolution *aElem) { return !aElem->mIsFirstResolution; });
+
+        mPendingResolutions.insert(it, resolution);
+    }
+    else
+    {
+        mPendingResolutions.push_back(resolution);
+    }
+
+    mMDnsSd->StartPendingResolutions();
 }
 
 void PublisherMDnsSd::ServiceSubscription::RemoveInstanceResolution(
@@ -896,40 +961,67 @@ void PublisherMDnsSd::ServiceSubscription::RemoveInstanceResolution(
 
     assert(it != mResolvingInstances.end());
 
+    mPendingResolutions.erase(
+        std::remove(mPendingResolutions.begin(), mPendingResolutions.end(), &aInstanceResolution),
+        mPendingResolutions.end());
     mResolvingInstances.erase(it);
 }
 
 void PublisherMDnsSd::ServiceSubscription::UpdateAll(MainloopContext &aMainloop) const
 {
+    // Instance resolutions multiplex over the publisher's shared connection,
+    // whose fd `PublisherMDnsSd::Update()` polls; only the browse operation
+    // owns a connection of its own.
     Update(aMainloop);
-
-    for (const auto &instance : mResolvingInstances)
-    {
-        instance->Update(aMainloop);
-    }
 }
 
 void PublisherMDnsSd::ServiceSubscription::ProcessAll(const MainloopContext &     aMainloop,
                                                       std::vector<DNSServiceRef> &aReadyServices) const
 {
+    // Instance resolution replies are dispatched with the shared connection.
     Process(aMainloop, aReadyServices);
+}
 
-    for (const auto &instance : mResolvingInstances)
+PublisherMDnsSd::ServiceInstanceResolution::~ServiceInstanceResolution(void)
+{
+    if (mStarted)
     {
-        instance->Process(aMainloop, aReadyServices);
+        mSubscription->mMDnsSd->mRunningResolutionCount--;
     }
 }
 
 void PublisherMDnsSd::ServiceInstanceResolution::Resolve(void)
 {
+    PublisherMDnsSd *   mdnsSd = mSubscription->mMDnsSd;
+    DNSServiceErrorType error;
+
     assert(mServiceRef == nullptr);
 
-    mSubscription->mMDnsSd->mServiceInstanceResolutionBeginTime[std::make_pair(mInstanceName, mTypeEndWithDot)] =
-        Clock::now();
+    mdnsSd->mServiceInstanceResolutionBeginTime[std::make_pair(mInstanceName, mTypeEndWithDot)] = Clock::now();
+
+    SuccessOrExit(error = mdnsSd->EnsureSharedConnection());
+
+    // The operation multiplexes over the shared connection: `mServiceRef` is
+    // set to the shared connection on input and replaced with the operation
+    // reference on success.
+    mServiceRef = mdnsSd->mSharedConnection;
 
     otbrLogInfo("DNSServiceResolve %s %s inf %u", mInstanceName.c_str(), mTypeEndWithDot.c_str(), mNetifIndex);
-    DNSServiceResolve(&mServiceRef, /* flags */ kDNSServiceFlagsTimeout, mNetifIndex, mInstanceName.c_str(),
-                      mTypeEndWithDot.c_str(), mDomain.c_str(), HandleResolveResult, this);
+    error = DNSServiceResolve(&mServiceRef, kDNSServiceFlagsShareConnection | kDNSServiceFlagsTimeout, mNetifIndex,
+                              mInstanceName.c_str(), mTypeEndWithDot.c_str(), mDomain.c_str(), HandleResolveResult,
+                              this);
+
+exit:
+    if (error != kDNSServiceErr_NoError)
+    {
+        otbrLogWarning("DNSServiceResolve failed: %s", DNSErrorToString(error));
+
+        // On failure the input reference is left untouched; it aliases the
+        // shared connection and must not be released here.
+        mServiceRef = nullptr;
+        mSubscription->mMDnsSd->OnServiceResolveFailed(mSubscription->mType, mInstanceName, error);
+        FinishResolution();
+    }
 }
 
 void PublisherMDnsSd::ServiceInstanceResolution::HandleResolveResult(DNSServiceRef        aServiceRef,
@@ -1002,13 +1094,17 @@ otbrError PublisherMDnsSd::ServiceInstanceResolution::GetAddrInfo(uint32_t aInte
 
     otbrLogInfo("DNSServiceGetAddrInfo %s inf %d", mInstanceInfo.mHostName.c_str(), aInterfaceIndex);
 
-    dnsError = DNSServiceGetAddrInfo(&mServiceRef, kDNSServiceFlagsTimeout, aInterfaceIndex,
-                                     kDNSServiceProtocol_IPv6 | kDNSServiceProtocol_IPv4,
+    // Multiplexed over the shared connection, like the resolve operation.
+    mServiceRef = mSubscription->mMDnsSd->mSharedConnection;
+
+    dnsError = DNSServiceGetAddrInfo(&mServiceRef, kDNSServiceFlagsShareConnection | kDNSServiceFlagsTimeout,
+                                     aInterfaceIndex, kDNSServiceProtocol_IPv6 | kDNSServiceProtocol_IPv4,
                                      mInstanceInfo.mHostName.c_str(), HandleGetAddrInfoResult, this);
 
     if (dnsError != kDNSServiceErr_NoError)
     {
         otbrLogWarning("DNSServiceGetAddrInfo failed: %s", DNSErrorToString(dnsError));
+        mServiceRef = nullptr;
     }
 
     return dnsError == kDNSServiceErr_NoError ? OTBR_ERROR_NONE : OTBR_ERROR_MDNS;
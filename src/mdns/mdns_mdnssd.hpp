@@ -35,8 +35,10 @@
 #define OTBR_AGENT_MDNS_MDNSSD_HPP_
 
 #include <array>
+#include <deque>
 #include <map>
 #include <memory>
+#include <set>
 #include <utility>
 #include <vector>
 
@@ -68,10 +70,6 @@ public:
     void UnpublishService(const std::string &aName, const std::string &aType, ResultCallback &&aCallback) override;
 
     void      UnpublishHost(const std::string &aName, ResultCallback &&aCallback) override;
-    void      SubscribeService(const std::string &aType, const std::string &aInstanceName) override;
-    void      UnsubscribeService(const std::string &aType, const std::string &aInstanceName) override;
-    void      SubscribeHost(const std::string &aHostName) override;
-    void      UnsubscribeHost(const std::string &aHostName) override;
     otbrError Start(void) override;
     bool      IsStarted(void) const override;
     void      Stop(void) override;
@@ -87,17 +85,23 @@ protected:
                                  const std::string &aType,
                                  const SubTypeList &aSubTypeList,
                                  uint16_t           aPort,
-                                 const TxtList &    aTxtList,
+                                 TxtList            aTxtList,
                                  ResultCallback &&  aCallback) override;
     void      PublishHostImpl(const std::string &            aName,
                               const std::vector<Ip6Address> &aAddress,
                               ResultCallback &&              aCallback) override;
+    void      SubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName) override;
+    void      UnsubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName) override;
+    void      SubscribeHostImpl(const std::string &aHostName) override;
+    void      UnsubscribeHostImpl(const std::string &aHostName) override;
     void      OnServiceResolveFailedImpl(const std::string &aType,
                                          const std::string &aInstanceName,
                                          int32_t            aErrorCode) override;
     void      OnHostResolveFailedImpl(const std::string &aHostName, int32_t aErrorCode) override;
     otbrError DnsErrorToOtbrError(int32_t aErrorCode) override;
 
+    const char *GetBackendLabel(void) const override { return "mdnssd"; }
+
 private:
     static constexpr uint32_t kDefaultTtl = 10;
 
@@ -123,12 +127,15 @@ private:
                                   aPublisher)
             , mServiceRef(aServiceRef)
         {
+            aPublisher->mServiceRefMap[aServiceRef] = this;
         }
 
         ~DnssdServiceRegistration(void) override;
         const DNSServiceRef &GetServiceRef() const { return mServiceRef; }
 
     private:
+        // An operation sharing the publisher connection; deallocating it
+        // cancels only this registration.
         DNSServiceRef mServiceRef;
     };
 
@@ -192,9 +199,13 @@ private:
             , mTypeEndWithDot(std::move(aType))
             , mDomain(std::move(aDomain))
             , mNetifIndex(aNetifIndex)
+            , mStarted(false)
+            , mIsFirstResolution(false)
         {
         }
 
+        ~ServiceInstanceResolution(void);
+
         void      Resolve(void);
         otbrError GetAddrInfo(uint32_t aInterfaceIndex);
         void      FinishResolution(void);
@@ -240,6 +251,8 @@ private:
         std::string            mDomain;
         uint32_t               mNetifIndex;
         DiscoveredInstanceInfo mInstanceInfo;
+        bool                   mStarted;           ///< Counted against the concurrent resolution limit.
+        bool                   mIsFirstResolution; ///< First sighting of the instance; scheduled ahead.
     };
 
     struct ServiceSubscription : public ServiceRef
@@ -282,6 +295,12 @@ private:
         std::string      mInstanceName;
 
         std::vector<std::unique_ptr<ServiceInstanceResolution>> mResolvingInstances;
+        // Resolutions queued behind the concurrent resolution limit, in
+        // scheduling order; entries point into `mResolvingInstances`.
+        std::deque<ServiceInstanceResolution *> mPendingResolutions;
+        // Instance names resolved at least once, distinguishing fresh
+        // sightings from TTL-driven re-resolutions when scheduling.
+        std::set<std::string> mSeenInstances;
     };
 
     struct HostSubscription : public ServiceRef
@@ -343,12 +362,25 @@ private:
 
     static std::string MakeRegType(const std::string &aType, SubTypeList aSubTypeList);
 
+    DNSServiceErrorType EnsureSharedConnection(void);
+
+    void StartPendingResolutions(void);
+
     ServiceRegistration *FindServiceRegistration(const DNSServiceRef &aServiceRef);
     HostRegistration *   FindHostRegistration(const DNSServiceRef &aServiceRef, const DNSRecordRef &aRecordRef);
 
-    DNSServiceRef mHostsRef;
-    State         mState;
-    StateCallback mStateCallback;
+    // The shared connection all registrations multiplex over; a single fd
+    // serves any number of services and host records.
+    DNSServiceRef mSharedConnection;
+    // Operation table mapping a registration's shared-connection operation
+    // back to its registration without scanning every registration.
+    std::map<DNSServiceRef, ServiceRegistration *> mServiceRefMap;
+    State                                          mState;
+    StateCallback                                  mStateCallback;
+
+    // Instance resolutions currently running over the shared connection;
+    // further ones wait in their subscription's pending queue.
+    uint32_t mRunningResolutionCount;
 
     ServiceSubscriptionList mSubscribedServices;
     HostSubscriptionList    mSubscribedHosts;
@@ -0,0 +1,108 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements interning of DNS-SD names.
+ */
+
+#include "mdns/name_interner.hpp"
+
+#include "utils/string_utils.hpp"
+
+namespace otbr {
+
+namespace Mdns {
+
+const std::string &InternedName::GetString(void) const
+{
+    return NameInterner::GetInstance().GetString(mId);
+}
+
+const std::string &InternedName::GetLowercase(void) const
+{
+    return NameInterner::GetInstance().GetString(GetLowercaseId());
+}
+
+uint32_t InternedName::GetLowercaseId(void) const
+{
+    return NameInterner::GetInstance().GetLowercaseId(mId);
+}
+
+NameInterner &NameInterner::GetInstance(void)
+{
+    static NameInterner sInstance;
+
+    return sInstance;
+}
+
+NameInterner::NameInterner(void)
+{
+    // The empty string takes id zero so a default handle is valid.
+    Intern("");
+}
+
+InternedName NameInterner::Intern(const std::string &aName)
+{
+    uint32_t id;
+    auto     it = mIndex.find(aName);
+
+    if (it != mIndex.end())
+    {
+        ExitNow(id = it->second);
+    }
+
+    {
+        std::string lowercase   = StringUtils::ToLowercase(aName);
+        uint32_t    lowercaseId;
+
+        if (lowercase == aName)
+        {
+            // The name is its own lowercase form.
+            id          = static_cast<uint32_t>(mEntries.size());
+            lowercaseId = id;
+        }
+        else
+        {
+            // Interning the lowercase form first keeps the recursion one
+            // level deep.
+            lowercaseId = Intern(lowercase).GetId();
+            id          = static_cast<uint32_t>(mEntries.size());
+        }
+
+        mEntries.push_back(Entry{aName, lowercaseId});
+        mIndex.emplace(aName, id);
+    }
+
+exit:
+    return InternedName(id);
+}
+
+} // namespace Mdns
+
+} // namespace otbr
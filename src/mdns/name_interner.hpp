@@ -0,0 +1,194 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definition for interning of DNS-SD names.
+ */
+
+#ifndef OTBR_AGENT_MDNS_NAME_INTERNER_HPP_
+#define OTBR_AGENT_MDNS_NAME_INTERNER_HPP_
+
+#include <stdint.h>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+namespace Mdns {
+
+/**
+ * This class is an id-based handle to a string held by `NameInterner`.
+ *
+ * Handles to the same spelling carry the same id, so equality is an integer
+ * compare, and a case-insensitive match compares the ids of the lowercase
+ * forms. The default handle refers to the empty string.
+ *
+ */
+class InternedName
+{
+    friend class NameInterner;
+
+public:
+    /**
+     * Default constructor; the handle refers to the empty string.
+     *
+     */
+    InternedName(void)
+        : mId(0)
+    {
+    }
+
+    /**
+     * This method returns the interned string.
+     *
+     * @returns A reference to the string; valid for the process lifetime.
+     *
+     */
+    const std::string &GetString(void) const;
+
+    /**
+     * This method returns the lowercase form of the interned string.
+     *
+     * @returns A reference to the lowercase form; valid for the process lifetime.
+     *
+     */
+    const std::string &GetLowercase(void) const;
+
+    /**
+     * This method returns the id of the interned string.
+     *
+     * @returns The id; identical spellings share one id.
+     *
+     */
+    uint32_t GetId(void) const { return mId; }
+
+    /**
+     * This method returns the id of the lowercase form of the interned string.
+     *
+     * @returns The lowercase-form id; names equal up to case share one.
+     *
+     */
+    uint32_t GetLowercaseId(void) const;
+
+    bool operator==(const InternedName &aOther) const { return mId == aOther.mId; }
+    bool operator!=(const InternedName &aOther) const { return mId != aOther.mId; }
+
+private:
+    explicit InternedName(uint32_t aId)
+        : mId(aId)
+    {
+    }
+
+    uint32_t mId;
+};
+
+/**
+ * This class implements a process-wide table of interned DNS-SD names.
+ *
+ * Service types and the other names flowing through the mDNS layer are a
+ * small recurring set; interning materializes each spelling (and its
+ * lowercase form, which DNS comparisons need) once, after which callers
+ * pass 4-byte handles instead of re-copying and re-comparing strings.
+ * Entries live for the process lifetime, so only names drawn from a
+ * bounded set (service types, not client-supplied instance or host names)
+ * should be interned. The table is meant for the mainloop thread only.
+ *
+ */
+class NameInterner : private NonCopyable
+{
+public:
+    /**
+     * This method returns the interner singleton.
+     *
+     * @returns A reference to the interner.
+     *
+     */
+    static NameInterner &GetInstance(void);
+
+    /**
+     * This method interns a name, reusing the existing entry for a spelling
+     * seen before.
+     *
+     * @param[in] aName  The name to intern.
+     *
+     * @returns The handle of the interned name.
+     *
+     */
+    InternedName Intern(const std::string &aName);
+
+    /**
+     * This method returns the string of an interned name by id.
+     *
+     * @param[in] aId  The id of the interned name.
+     *
+     * @returns A reference to the string; valid for the process lifetime.
+     *
+     */
+    const std::string &GetString(uint32_t aId) const { return mEntries[aId].mName; }
+
+    /**
+     * This method returns the lowercase-form id of an interned name.
+     *
+     * @param[in] aId  The id of the interned name.
+     *
+     * @returns The id of the lowercase form.
+     *
+     */
+    uint32_t GetLowercaseId(uint32_t aId) const { return mEntries[aId].mLowercaseId; }
+
+    /**
+     * This method returns the number of interned names.
+     *
+     * @returns The entry count.
+     *
+     */
+    size_t GetCount(void) const { return mEntries.size(); }
+
+private:
+    struct Entry
+    {
+        std::string mName;
+        uint32_t    mLowercaseId;
+    };
+
+    NameInterner(void);
+
+    std::vector<Entry>                        mEntries;
+    std::unordered_map<std::string, uint32_t> mIndex;
+};
+
+} // namespace Mdns
+
+} // namespace otbr
+
+#endif // OTBR_AGENT_MDNS_NAME_INTERNER_HPP_
@@ -34,6 +34,8 @@
 #include <stdio.h>
 #include <string.h>
 
+#include <algorithm>
+
 #include <openthread/backbone_router_ftd.h>
 #include <openthread/dataset.h>
 #include <openthread/logging.h>
@@ -71,6 +73,7 @@ ControllerOpenThread::ControllerOpenThread(const char *                     aInt
                                            bool                             aDryRun,
                                            bool                             aEnableAutoAttach)
     : mInstance(nullptr)
+    , mStateSnapshot(std::make_shared<ThreadStateSnapshot>())
     , mEnableAutoAttach(aEnableAutoAttach)
 {
     VerifyOrDie(aRadioUrls.size() <= OT_PLATFORM_CONFIG_MAX_RADIO_URLS, "Too many Radio URLs!");
@@ -154,11 +157,26 @@ otLogLevel ControllerOpenThread::ConvertToOtLogLevel(otbrLogLevel aLevel)
     return level;
 }
 
+constexpr uint8_t ControllerOpenThread::RadioTurnaroundMetrics::kNumBuckets;
+
+// Servicing the radio for longer than this per mainloop cycle gets
+// reported; the warning itself is rate limited to one per interval.
+static constexpr uint64_t     kRadioTurnaroundBudgetUs = 50 * 1000;
+static constexpr Milliseconds kTurnaroundWarnInterval  = Milliseconds(10000);
+
+// The active controller of this process; see the class documentation
+// for why there can only ever be one.
+static ControllerOpenThread *sActiveController = nullptr;
+
 void ControllerOpenThread::Init(void)
 {
     otbrError  error = OTBR_ERROR_NONE;
     otLogLevel level = ConvertToOtLogLevel(otbrLogGetLevel());
 
+    VerifyOrDie(sActiveController == nullptr || sActiveController == this,
+                "Only one NCP controller is supported per process; pass extra RCPs as additional radio URLs");
+    sActiveController = this;
+
     VerifyOrExit(otLoggingSetLevel(level) == OT_ERROR_NONE, error = OTBR_ERROR_OPENTHREAD);
 
     mInstance = otSysInit(&mConfig);
@@ -184,6 +202,8 @@ void ControllerOpenThread::Init(void)
 
     mThreadHelper = std::unique_ptr<otbr::agent::ThreadHelper>(new otbr::agent::ThreadHelper(mInstance, this));
 
+    RefreshStateSnapshot(OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_PARTITION_ID | OT_CHANGED_ACTIVE_DATASET);
+
 exit:
     SuccessOrDie(error, "Failed to initialize NCP!");
 }
@@ -195,6 +215,10 @@ otError ControllerOpenThread::ApplyFeatureFlagList(const FeatureFlagList &aFeatu
     // Save a cached copy of feature flags for debugging purpose.
     mAppliedFeatureFlagListBytes = aFeatureFlagList.SerializeAsString();
 
+    // Refresh the atomic flag snapshot so subsystems can gate hot-path
+    // behavior on the flags without ever touching the proto.
+    mFlagNat64Enabled.store(aFeatureFlagList.enable_nat64(), std::memory_order_relaxed);
+
     // TODO: apply the feature flags through API.
 
     return error;
@@ -206,14 +230,50 @@ void ControllerOpenThread::Deinit(void)
     assert(mInstance != nullptr);
 
     otSysDeinit();
-    mInstance = nullptr;
+    mInstance         = nullptr;
+    sActiveController = nullptr;
+}
+
+void ControllerOpenThread::RefreshStateSnapshot(otChangedFlags aFlags)
+{
+    // Copy-on-write: readers on other threads may still hold the previous
+    // snapshot, so a new one is published instead of mutating in place.
+    // Only the fields a batch actually touched are re-read; everything else
+    // keeps the value from the previous batch.
+    std::shared_ptr<ThreadStateSnapshot> snapshot = std::make_shared<ThreadStateSnapshot>(*mStateSnapshot);
+
+    snapshot->mVersion++;
+
+    if (aFlags & OT_CHANGED_THREAD_ROLE)
+    {
+        snapshot->mDeviceRole = otThreadGetDeviceRole(mInstance);
+    }
+
+    if (aFlags & OT_CHANGED_THREAD_PARTITION_ID)
+    {
+        snapshot->mPartitionId = otThreadGetPartitionId(mInstance);
+    }
+
+    if (aFlags & (OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_PARTITION_ID | OT_CHANGED_THREAD_NETDATA))
+    {
+        snapshot->mLeaderDataValid = otThreadGetLeaderData(mInstance, &snapshot->mLeaderData) == OT_ERROR_NONE;
+    }
+
+    if (aFlags & (OT_CHANGED_ACTIVE_DATASET | OT_CHANGED_THREAD_ROLE))
+    {
+        snapshot->mActiveDatasetValid = otDatasetGetActive(mInstance, &snapshot->mActiveDataset) == OT_ERROR_NONE;
+    }
+
+    std::atomic_store(&mStateSnapshot, std::shared_ptr<const ThreadStateSnapshot>(std::move(snapshot)));
 }
 
 void ControllerOpenThread::HandleStateChanged(otChangedFlags aFlags)
 {
+    RefreshStateSnapshot(aFlags);
+
     if (aFlags & OT_CHANGED_THREAD_ROLE)
     {
-        switch (otThreadGetDeviceRole(mInstance))
+        switch (mStateSnapshot->mDeviceRole)
         {
         case OT_DEVICE_ROLE_DISABLED:
 #if OTBR_ENABLE_LEGACY
@@ -252,16 +312,51 @@ void ControllerOpenThread::Update(MainloopContext &aMainloop)
 
 void ControllerOpenThread::Process(const MainloopContext &aMainloop)
 {
+    Timepoint start = Clock::now();
+
     otTaskletsProcess(mInstance);
 
     otSysMainloopProcess(mInstance, &aMainloop);
 
+    RecordRadioTurnaround(
+        static_cast<uint64_t>(std::chrono::duration_cast<Microseconds>(Clock::now() - start).count()));
+
     if (IsAutoAttachEnabled() && mThreadHelper->TryResumeNetwork() == OT_ERROR_NONE)
     {
         DisableAutoAttach();
     }
 }
 
+void ControllerOpenThread::RecordRadioTurnaround(uint64_t aDurationUs)
+{
+    uint8_t bucket = 0;
+
+    mRadioTurnaroundMetrics.mCycleCount++;
+    mRadioTurnaroundMetrics.mTotalUs += aDurationUs;
+    mRadioTurnaroundMetrics.mMaxUs = std::max(mRadioTurnaroundMetrics.mMaxUs, aDurationUs);
+
+    while (bucket < RadioTurnaroundMetrics::kNumBuckets - 1 && aDurationUs >= (1000ULL << bucket))
+    {
+        bucket++;
+    }
+    mRadioTurnaroundMetrics.mBuckets[bucket]++;
+
+    VerifyOrExit(aDurationUs > kRadioTurnaroundBudgetUs);
+    mRadioTurnaroundMetrics.mOverBudgetCount++;
+
+    // Rate limit the log so a persistently slow radio link does not turn
+    // the log itself into extra mainloop work.
+    VerifyOrExit(Clock::now() - mLastTurnaroundWarnTime >= kTurnaroundWarnInterval);
+    mLastTurnaroundWarnTime = Clock::now();
+    otbrLogWarning("Radio turnaround took %llu us (budget %llu us), %llu over-budget cycles so far",
+                   static_cast<unsigned long long>(aDurationUs),
+                   static_cast<unsigned long long>(kRadioTurnaroundBudgetUs),
+                   static_cast<unsigned long long>(mRadioTurnaroundMetrics.mOverBudgetCount));
+
+exit:
+    return;
+}
+
 bool ControllerOpenThread::IsAutoAttachEnabled(void)
 {
     return mEnableAutoAttach;
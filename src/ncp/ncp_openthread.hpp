@@ -34,6 +34,7 @@
 #ifndef OTBR_AGENT_NCP_OPENTHREAD_HPP_
 #define OTBR_AGENT_NCP_OPENTHREAD_HPP_
 
+#include <atomic>
 #include <chrono>
 #include <memory>
 
@@ -41,11 +42,14 @@
 
 #include <openthread/backbone_router_ftd.h>
 #include <openthread/cli.h>
+#include <openthread/dataset.h>
 #include <openthread/instance.h>
 #include <openthread/openthread-system.h>
+#include <openthread/thread.h>
 
 #include "common/mainloop.hpp"
 #include "common/task_runner.hpp"
+#include "common/time.hpp"
 #include "common/types.hpp"
 #include "utils/thread_helper.hpp"
 
@@ -60,12 +64,65 @@ namespace Ncp {
 /**
  * This interface defines NCP Controller functionality.
  *
+ * There is exactly one controller, and thus one `otInstance`, per
+ * process: the OpenThread POSIX platform layer keeps its driver state
+ * in globals (`otSysInit`, reset reason, network interface), so a
+ * second instance cannot be hosted alongside it. Dual-radio gateways
+ * should therefore pass every RCP as an additional radio URL to this
+ * single controller instead of spawning a second agent process; the
+ * radio links then share the mainloop, task runner, mDNS publisher and
+ * infrastructure sockets by construction.
+ *
  */
 class ControllerOpenThread : public MainloopProcessor
 {
 public:
     using ThreadStateChangedCallback = std::function<void(otChangedFlags aFlags)>;
 
+    /**
+     * This structure holds OT core state read once per state-change batch.
+     *
+     * Every subsystem hooked on Thread state changes used to re-query the
+     * role and dataset itself; consumers should read this snapshot from
+     * their state-changed callbacks instead. Published snapshots are
+     * immutable: each batch produces a fresh copy with a higher version,
+     * so holders of an older snapshot keep a consistent view.
+     *
+     */
+    struct ThreadStateSnapshot
+    {
+        uint64_t             mVersion;            ///< Incremented once per published snapshot.
+        otDeviceRole         mDeviceRole;         ///< The device role.
+        uint32_t             mPartitionId;        ///< The Thread partition ID.
+        otLeaderData         mLeaderData;         ///< The Thread Leader Data.
+        bool                 mLeaderDataValid;    ///< Whether `mLeaderData` was read successfully.
+        otOperationalDataset mActiveDataset;      ///< The Active Operational Dataset.
+        bool                 mActiveDatasetValid; ///< Whether `mActiveDataset` was read successfully.
+
+        ThreadStateSnapshot(void)
+            : mVersion(0)
+            , mDeviceRole(OT_DEVICE_ROLE_DISABLED)
+            , mPartitionId(0)
+            , mLeaderData()
+            , mLeaderDataValid(false)
+            , mActiveDataset()
+            , mActiveDatasetValid(false)
+        {
+        }
+
+        /**
+         * This method indicates whether the device is attached.
+         *
+         * @returns TRUE if the role is child, router or leader, FALSE otherwise.
+         *
+         */
+        bool IsAttached(void) const
+        {
+            return mDeviceRole == OT_DEVICE_ROLE_CHILD || mDeviceRole == OT_DEVICE_ROLE_ROUTER ||
+                   mDeviceRole == OT_DEVICE_ROLE_LEADER;
+        }
+    };
+
     /**
      * This constructor initializes this object.
      *
@@ -146,6 +203,63 @@ public:
      */
     void AddThreadStateChangedCallback(ThreadStateChangedCallback aCallback);
 
+    /**
+     * This method returns the state snapshot of the current change batch.
+     *
+     * The snapshot is refreshed once before the state-changed callbacks of
+     * a batch are dispatched, so all consumers of one batch share the same
+     * role/dataset reads. The reference is only safe on the main thread
+     * and within the current batch; off-thread readers and holders must
+     * use `ShareStateSnapshot()`.
+     *
+     * @returns A reference to the state snapshot.
+     *
+     */
+    const ThreadStateSnapshot &GetStateSnapshot(void) const { return *mStateSnapshot; }
+
+    /**
+     * This method returns a shared reference to the current state snapshot.
+     *
+     * Snapshots are copy-on-write: a published snapshot is never mutated,
+     * so the returned pointer may be read from any thread without holding
+     * the NCP thread mutex and stays consistent for as long as the caller
+     * keeps it.
+     *
+     * @returns A shared pointer to the current state snapshot.
+     *
+     */
+    std::shared_ptr<const ThreadStateSnapshot> ShareStateSnapshot(void) const
+    {
+        return std::atomic_load(&mStateSnapshot);
+    }
+
+    /**
+     * This structure holds mainloop-to-radio turnaround metrics.
+     *
+     * One sample is recorded per mainloop cycle and covers tasklet and
+     * radio processing, i.e. the time from the mainloop waking up until
+     * the radio driver has been fully serviced.
+     *
+     */
+    struct RadioTurnaroundMetrics
+    {
+        static constexpr uint8_t kNumBuckets = 8; ///< The number of histogram buckets.
+
+        uint64_t mCycleCount{0};          ///< The number of sampled mainloop cycles.
+        uint64_t mTotalUs{0};             ///< The accumulated turnaround time, in microseconds.
+        uint64_t mMaxUs{0};               ///< The maximum observed turnaround, in microseconds.
+        uint64_t mOverBudgetCount{0};     ///< The cycles that exceeded the turnaround budget.
+        uint64_t mBuckets[kNumBuckets]{}; ///< Bucket N counts cycles below (1 << N) ms; the last counts the rest.
+    };
+
+    /**
+     * This method returns the mainloop-to-radio turnaround metrics.
+     *
+     * @returns A reference to the turnaround metrics.
+     *
+     */
+    const RadioTurnaroundMetrics &GetRadioTurnaroundMetrics(void) const { return mRadioTurnaroundMetrics; }
+
     /**
      * This method resets the OpenThread instance.
      *
@@ -188,6 +302,20 @@ public:
      *
      */
     const std::string &GetAppliedFeatureFlagListBytes(void) { return mAppliedFeatureFlagListBytes; }
+
+    /**
+     * This method indicates whether the NAT64 feature flag is enabled.
+     *
+     * The value is a plain atomic snapshot refreshed by
+     * `ApplyFeatureFlagList`, so the check compiles down to a relaxed
+     * load and is free to call on hot paths. New flags added to the
+     * proto should get a getter and a cached atomic following the same
+     * pattern.
+     *
+     * @returns TRUE if the NAT64 feature flag is enabled, FALSE otherwise.
+     *
+     */
+    bool IsNat64FlagEnabled(void) const { return mFlagNat64Enabled.load(std::memory_order_relaxed); }
 #endif
 
     ~ControllerOpenThread(void) override;
@@ -198,6 +326,7 @@ private:
         static_cast<ControllerOpenThread *>(aContext)->HandleStateChanged(aFlags);
     }
     void HandleStateChanged(otChangedFlags aFlags);
+    void RefreshStateSnapshot(otChangedFlags aFlags);
 
     static void HandleBackboneRouterDomainPrefixEvent(void *                            aContext,
                                                       otBackboneRouterDomainPrefixEvent aEvent,
@@ -215,6 +344,8 @@ private:
     bool IsAutoAttachEnabled(void);
     void DisableAutoAttach(void);
 
+    void RecordRadioTurnaround(uint64_t aDurationUs);
+
     static otLogLevel ConvertToOtLogLevel(otbrLogLevel aLevel);
 
     otInstance *mInstance;
@@ -224,10 +355,17 @@ private:
     std::vector<std::function<void(void)>>     mResetHandlers;
     TaskRunner                                 mTaskRunner;
     std::vector<ThreadStateChangedCallback>    mThreadStateChangedCallbacks;
+    std::shared_ptr<const ThreadStateSnapshot> mStateSnapshot;
+    RadioTurnaroundMetrics                     mRadioTurnaroundMetrics;
+    Timepoint                                  mLastTurnaroundWarnTime;
     bool                                       mEnableAutoAttach = false;
 #if OTBR_ENABLE_FEATURE_FLAGS
     // The applied FeatureFlagList in ApplyFeatureFlagList call, used for debugging purpose.
     std::string mAppliedFeatureFlagListBytes;
+
+    // Flag values cached out of the proto so hot-path checks stay lock
+    // and proto free; see `IsNat64FlagEnabled`.
+    std::atomic<bool> mFlagNat64Enabled{false};
 #endif
 };
 
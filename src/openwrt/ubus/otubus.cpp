@@ -52,25 +52,47 @@ namespace ubus {
 static UbusServer *sUbusServerInstance = nullptr;
 static int         sUbusEfd            = -1;
 static void *      sJsonUri            = nullptr;
-static int         sBufNum;
 
-const static int PANID_LENGTH      = 10;
 const static int XPANID_LENGTH     = 64;
 const static int NETWORKKEY_LENGTH = 64;
 
+// Room for a neighbor table or diagnostic reply at typical network sizes
+// (~32 entries of roughly 120 bytes of blobmsg payload each).
+const static int kTableBufSizeEstimate = 4096;
+
 UbusServer::UbusServer(Ncp::ControllerOpenThread *aController, std::mutex *aMutex)
     : mIfFinishScan(false)
     , mContext(nullptr)
     , mSockPath(nullptr)
+    , mScanDeferred(false)
+    , mDiagDeferred(false)
+    , mDiagNodeNum(0)
+    , mNeighborCacheValid(false)
+    , mNeighborCacheTime(0)
     , mController(aController)
     , mNcpThreadMutex(aMutex)
-    , mSecond(0)
 {
-    memset(&mNetworkdataBuf, 0, sizeof(mNetworkdataBuf));
     memset(&mBuf, 0, sizeof(mBuf));
+    memset(&mScanBuf, 0, sizeof(mScanBuf));
+    memset(&mScanRequest, 0, sizeof(mScanRequest));
+    memset(&mScanPollTimer, 0, sizeof(mScanPollTimer));
+    memset(&mDiagBuf, 0, sizeof(mDiagBuf));
+    memset(&mDiagRequest, 0, sizeof(mDiagRequest));
+    memset(&mDiagPollTimer, 0, sizeof(mDiagPollTimer));
+    memset(&mNeighborBuf, 0, sizeof(mNeighborBuf));
+    mScanPollTimer.cb = UbusScanPollTimer;
+    mDiagPollTimer.cb = UbusDiagPollTimer;
 
     blob_buf_init(&mBuf, 0);
-    blob_buf_init(&mNetworkdataBuf, 0);
+    blob_buf_init(&mScanBuf, 0);
+    blob_buf_init(&mDiagBuf, 0);
+    blob_buf_init(&mNeighborBuf, 0);
+
+    // Pre-grow the buffers that carry multi-entry tables; libubox keeps the
+    // allocation across blob_buf_init calls, so the first full-sized reply
+    // does not walk an incremental realloc chain.
+    mDiagBuf.grow(&mDiagBuf, kTableBufSizeEstimate);
+    mNeighborBuf.grow(&mNeighborBuf, kTableBufSizeEstimate);
 }
 
 UbusServer &UbusServer::GetInstance(void)
@@ -241,14 +263,63 @@ void UbusServer::HandleActiveScanResult(otActiveScanResult *aResult, void *aCont
     static_cast<UbusServer *>(aContext)->HandleActiveScanResultDetail(aResult);
 }
 
+static const char kHexChars[] = "0123456789abcdef";
+
+// Adds aValue formatted as "0x%04x" without the stdio machinery; the LuCI
+// status pages poll these tables continuously.
+static void AddHexU16(struct blob_buf &aBuf, const char *aName, uint16_t aValue)
+{
+    char hex[7];
+
+    hex[0] = '0';
+    hex[1] = 'x';
+    hex[2] = kHexChars[(aValue >> 12) & 0xf];
+    hex[3] = kHexChars[(aValue >> 8) & 0xf];
+    hex[4] = kHexChars[(aValue >> 4) & 0xf];
+    hex[5] = kHexChars[aValue & 0xf];
+    hex[6] = '\0';
+    blobmsg_add_string(&aBuf, aName, hex);
+}
+
+// Adds aValue right-justified in aWidth columns like printf("%*d"), keeping
+// the field widths existing consumers of these tables see.
+static void AddPaddedDecimal(struct blob_buf &aBuf, const char *aName, int32_t aValue, uint8_t aWidth)
+{
+    char     buffer[16];
+    char *   pos       = buffer + sizeof(buffer) - 1;
+    bool     negative  = aValue < 0;
+    uint32_t magnitude = negative ? ~static_cast<uint32_t>(aValue) + 1 : static_cast<uint32_t>(aValue);
+
+    *pos = '\0';
+
+    do
+    {
+        *--pos = static_cast<char>('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude > 0);
+
+    if (negative)
+    {
+        *--pos = '-';
+    }
+
+    while (buffer + sizeof(buffer) - 1 - pos < aWidth && pos > buffer)
+    {
+        *--pos = ' ';
+    }
+
+    blobmsg_add_string(&aBuf, aName, pos);
+}
+
 void UbusServer::OutputBytes(const uint8_t *aBytes, uint8_t aLength, char *aOutput)
 {
-    char byte2char[5] = "";
     for (int i = 0; i < aLength; i++)
     {
-        sprintf(byte2char, "%02x", aBytes[i]);
-        strcat(aOutput, byte2char);
+        aOutput[2 * i]     = kHexChars[aBytes[i] >> 4];
+        aOutput[2 * i + 1] = kHexChars[aBytes[i] & 0xf];
     }
+
+    aOutput[2 * aLength] = '\0';
 }
 
 void UbusServer::AppendResult(otError aError, struct ubus_context *aContext, struct ubus_request_data *aRequest)
@@ -259,38 +330,16 @@ void UbusServer::AppendResult(otError aError, struct ubus_context *aContext, str
 
 void UbusServer::HandleActiveScanResultDetail(otActiveScanResult *aResult)
 {
-    void *jsonList = nullptr;
-
-    char panidstring[PANID_LENGTH];
-    char xpanidstring[XPANID_LENGTH] = "";
-
     if (aResult == nullptr)
     {
-        blobmsg_close_array(&mBuf, sJsonUri);
         mIfFinishScan = true;
-        goto exit;
     }
+    else
+    {
+        std::lock_guard<std::mutex> lock(mScanResultMutex);
 
-    jsonList = blobmsg_open_table(&mBuf, nullptr);
-
-    blobmsg_add_string(&mBuf, "NetworkName", aResult->mNetworkName.m8);
-
-    OutputBytes(aResult->mExtendedPanId.m8, OT_EXT_PAN_ID_SIZE, xpanidstring);
-    blobmsg_add_string(&mBuf, "ExtendedPanId", xpanidstring);
-
-    sprintf(panidstring, "0x%04x", aResult->mPanId);
-    blobmsg_add_string(&mBuf, "PanId", panidstring);
-
-    blobmsg_add_u32(&mBuf, "Channel", aResult->mChannel);
-
-    blobmsg_add_u32(&mBuf, "Rssi", aResult->mRssi);
-
-    blobmsg_add_u32(&mBuf, "Lqi", aResult->mLqi);
-
-    blobmsg_close_table(&mBuf, jsonList);
-
-exit:
-    return;
+        mScanResults.push_back(*aResult);
+    }
 }
 
 int UbusServer::UbusScanHandler(struct ubus_context *     aContext,
@@ -316,28 +365,92 @@ int UbusServer::UbusScanHandlerDetail(struct ubus_context *     aContext,
     uint64_t eventNum;
     ssize_t  retval;
 
-    blob_buf_init(&mBuf, 0);
-    sJsonUri = blobmsg_open_array(&mBuf, "scan_list");
+    VerifyOrExit(!mScanDeferred, error = OT_ERROR_BUSY);
+
+    {
+        std::lock_guard<std::mutex> lock(mScanResultMutex);
 
-    mIfFinishScan = 0;
+        mScanResults.clear();
+    }
+
+    mIfFinishScan = false;
     sUbusServerInstance->ProcessScan();
 
     eventNum = 1;
     retval   = write(sUbusEfd, &eventNum, sizeof(uint64_t));
-    if (retval != sizeof(uint64_t))
+    VerifyOrExit(retval == sizeof(uint64_t), error = OT_ERROR_FAILED);
+
+    // Defer the request instead of sleeping here so the uloop keeps
+    // serving other ubus clients while the scan runs. Replies have to
+    // be sent from this thread, so a uloop timer drains the queued
+    // results and streams them to the caller as they arrive.
+    ubus_defer_request(aContext, aRequest, &mScanRequest);
+    mScanDeferred = true;
+    uloop_timeout_set(&mScanPollTimer, kScanPollInterval);
+
+exit:
+    if (error != OT_ERROR_NONE)
     {
-        error = OT_ERROR_FAILED;
-        goto exit;
+        blob_buf_init(&mBuf, 0);
+        AppendResult(error, aContext, aRequest);
     }
+    return 0;
+}
+
+void UbusServer::UbusScanPollTimer(struct uloop_timeout *aTimeout)
+{
+    GetInstance().UbusScanPollTimerDetail(aTimeout);
+}
+
+void UbusServer::UbusScanPollTimerDetail(struct uloop_timeout *aTimeout)
+{
+    // Observe the completion flag before draining: the scan callback
+    // queues the last result before it raises the flag, so a true flag
+    // means every result is visible to this drain.
+    bool                            finished = mIfFinishScan;
+    std::vector<otActiveScanResult> results;
 
-    while (!mIfFinishScan)
     {
-        sleep(1);
+        std::lock_guard<std::mutex> lock(mScanResultMutex);
+
+        results.swap(mScanResults);
     }
 
-exit:
-    AppendResult(error, aContext, aRequest);
-    return 0;
+    // Stream one reply per discovered network so the caller sees the
+    // first network as soon as it is found, not when the scan ends.
+    for (const otActiveScanResult &result : results)
+    {
+        char xpanidstring[XPANID_LENGTH] = "";
+
+        blob_buf_init(&mScanBuf, 0);
+
+        blobmsg_add_string(&mScanBuf, "NetworkName", result.mNetworkName.m8);
+
+        OutputBytes(result.mExtendedPanId.m8, OT_EXT_PAN_ID_SIZE, xpanidstring);
+        blobmsg_add_string(&mScanBuf, "ExtendedPanId", xpanidstring);
+
+        AddHexU16(mScanBuf, "PanId", result.mPanId);
+
+        blobmsg_add_u32(&mScanBuf, "Channel", result.mChannel);
+
+        blobmsg_add_u32(&mScanBuf, "Rssi", result.mRssi);
+
+        blobmsg_add_u32(&mScanBuf, "Lqi", result.mLqi);
+
+        ubus_send_reply(mContext, &mScanRequest, mScanBuf.head);
+    }
+
+    if (!finished)
+    {
+        uloop_timeout_set(aTimeout, kScanPollInterval);
+        return;
+    }
+
+    blob_buf_init(&mScanBuf, 0);
+    blobmsg_add_u16(&mScanBuf, "Error", OT_ERROR_NONE);
+    ubus_send_reply(mContext, &mScanRequest, mScanBuf.head);
+    ubus_complete_deferred_request(mContext, &mScanRequest, UBUS_STATUS_OK);
+    mScanDeferred = false;
 }
 
 int UbusServer::UbusChannelHandler(struct ubus_context *     aContext,
@@ -734,7 +847,6 @@ int UbusServer::UbusParentHandlerDetail(struct ubus_context *     aContext,
     otError      error = OT_ERROR_NONE;
     otRouterInfo parentInfo;
     char         extAddress[XPANID_LENGTH] = "";
-    char         transfer[XPANID_LENGTH]   = "";
     void *       jsonList                  = nullptr;
     void *       jsonArray                 = nullptr;
 
@@ -747,11 +859,8 @@ int UbusServer::UbusParentHandlerDetail(struct ubus_context *     aContext,
     jsonList  = blobmsg_open_table(&mBuf, "parent");
     blobmsg_add_string(&mBuf, "Role", "R");
 
-    sprintf(transfer, "0x%04x", parentInfo.mRloc16);
-    blobmsg_add_string(&mBuf, "Rloc16", transfer);
-
-    sprintf(transfer, "%3d", parentInfo.mAge);
-    blobmsg_add_string(&mBuf, "Age", transfer);
+    AddHexU16(mBuf, "Rloc16", parentInfo.mRloc16);
+    AddPaddedDecimal(mBuf, "Age", parentInfo.mAge, 3);
 
     OutputBytes(parentInfo.mExtAddress.m8, sizeof(parentInfo.mExtAddress.m8), extAddress);
     blobmsg_add_string(&mBuf, "ExtAddress", extAddress);
@@ -777,72 +886,86 @@ int UbusServer::UbusNeighborHandlerDetail(struct ubus_context *     aContext,
     OT_UNUSED_VARIABLE(aMethod);
     OT_UNUSED_VARIABLE(aMsg);
 
-    otError                error = OT_ERROR_NONE;
-    otNeighborInfo         neighborInfo;
-    otNeighborInfoIterator iterator                  = OT_NEIGHBOR_INFO_ITERATOR_INIT;
-    char                   transfer[XPANID_LENGTH]   = "";
-    void *                 jsonList                  = nullptr;
-    char                   mode[5]                   = "";
-    char                   extAddress[XPANID_LENGTH] = "";
+    otError error = OT_ERROR_NONE;
 
-    blob_buf_init(&mBuf, 0);
+    // Steady-state polls (e.g. LuCI every couple of seconds) are served
+    // from the cached blob; it is rebuilt only after a relevant state
+    // change or once it ages out.
+    if (!mNeighborCacheValid || time(nullptr) - mNeighborCacheTime > kNeighborCacheMaxAge)
+    {
+        otNeighborInfo         neighborInfo;
+        otNeighborInfoIterator iterator                  = OT_NEIGHBOR_INFO_ITERATOR_INIT;
+        void *                 jsonList                  = nullptr;
+        void *                 jsonArray                 = nullptr;
+        char                   mode[5]                   = "";
+        char                   extAddress[XPANID_LENGTH] = "";
 
-    sJsonUri = blobmsg_open_array(&mBuf, "neighbor_list");
+        blob_buf_init(&mNeighborBuf, 0);
 
-    mNcpThreadMutex->lock();
-    while (otThreadGetNextNeighborInfo(mController->GetInstance(), &iterator, &neighborInfo) == OT_ERROR_NONE)
-    {
-        jsonList = blobmsg_open_table(&mBuf, nullptr);
+        jsonArray = blobmsg_open_array(&mNeighborBuf, "neighbor_list");
 
-        blobmsg_add_string(&mBuf, "Role", neighborInfo.mIsChild ? "C" : "R");
+        mNcpThreadMutex->lock();
+        while (otThreadGetNextNeighborInfo(mController->GetInstance(), &iterator, &neighborInfo) == OT_ERROR_NONE)
+        {
+            jsonList = blobmsg_open_table(&mNeighborBuf, nullptr);
 
-        sprintf(transfer, "0x%04x", neighborInfo.mRloc16);
-        blobmsg_add_string(&mBuf, "Rloc16", transfer);
+            blobmsg_add_string(&mNeighborBuf, "Role", neighborInfo.mIsChild ? "C" : "R");
 
-        sprintf(transfer, "%3d", neighborInfo.mAge);
-        blobmsg_add_string(&mBuf, "Age", transfer);
+            AddHexU16(mNeighborBuf, "Rloc16", neighborInfo.mRloc16);
+            AddPaddedDecimal(mNeighborBuf, "Age", neighborInfo.mAge, 3);
+            AddPaddedDecimal(mNeighborBuf, "AvgRssi", neighborInfo.mAverageRssi, 8);
+            AddPaddedDecimal(mNeighborBuf, "LastRssi", neighborInfo.mLastRssi, 9);
 
-        sprintf(transfer, "%8d", neighborInfo.mAverageRssi);
-        blobmsg_add_string(&mBuf, "AvgRssi", transfer);
+            if (neighborInfo.mRxOnWhenIdle)
+            {
+                strcat(mode, "r");
+            }
 
-        sprintf(transfer, "%9d", neighborInfo.mLastRssi);
-        blobmsg_add_string(&mBuf, "LastRssi", transfer);
+            if (neighborInfo.mFullThreadDevice)
+            {
+                strcat(mode, "d");
+            }
 
-        if (neighborInfo.mRxOnWhenIdle)
-        {
-            strcat(mode, "r");
-        }
+            if (neighborInfo.mFullNetworkData)
+            {
+                strcat(mode, "n");
+            }
+            blobmsg_add_string(&mNeighborBuf, "Mode", mode);
 
-        if (neighborInfo.mFullThreadDevice)
-        {
-            strcat(mode, "d");
-        }
+            OutputBytes(neighborInfo.mExtAddress.m8, sizeof(neighborInfo.mExtAddress.m8), extAddress);
+            blobmsg_add_string(&mNeighborBuf, "ExtAddress", extAddress);
 
-        if (neighborInfo.mFullNetworkData)
-        {
-            strcat(mode, "n");
-        }
-        blobmsg_add_string(&mBuf, "Mode", mode);
+            blobmsg_add_u16(&mNeighborBuf, "LinkQualityIn", neighborInfo.mLinkQualityIn);
 
-        OutputBytes(neighborInfo.mExtAddress.m8, sizeof(neighborInfo.mExtAddress.m8), extAddress);
-        blobmsg_add_string(&mBuf, "ExtAddress", extAddress);
+            blobmsg_close_table(&mNeighborBuf, jsonList);
 
-        blobmsg_add_u16(&mBuf, "LinkQualityIn", neighborInfo.mLinkQualityIn);
+            memset(mode, 0, sizeof(mode));
+            memset(extAddress, 0, sizeof(extAddress));
+        }
 
-        blobmsg_close_table(&mBuf, jsonList);
+        blobmsg_close_array(&mNeighborBuf, jsonArray);
 
-        memset(mode, 0, sizeof(mode));
-        memset(extAddress, 0, sizeof(extAddress));
-    }
+        mNcpThreadMutex->unlock();
 
-    blobmsg_close_array(&mBuf, sJsonUri);
+        blobmsg_add_u16(&mNeighborBuf, "Error", error);
 
-    mNcpThreadMutex->unlock();
+        mNeighborCacheValid = true;
+        mNeighborCacheTime  = time(nullptr);
+    }
 
-    AppendResult(error, aContext, aRequest);
+    ubus_send_reply(aContext, aRequest, mNeighborBuf.head);
     return 0;
 }
 
+void UbusServer::HandleThreadStateChanged(otChangedFlags aFlags)
+{
+    if (aFlags & (OT_CHANGED_THREAD_CHILD_ADDED | OT_CHANGED_THREAD_CHILD_REMOVED | OT_CHANGED_THREAD_ROLE |
+                  OT_CHANGED_THREAD_PARTITION_ID))
+    {
+        mNeighborCacheValid = false;
+    }
+}
+
 int UbusServer::UbusMgmtset(struct ubus_context *     aContext,
                             struct ubus_object *      aObj,
                             struct ubus_request_data *aRequest,
@@ -1090,15 +1213,11 @@ int UbusServer::UbusGetInformation(struct ubus_context *     aContext,
         blobmsg_add_u32(&mBuf, "Channel", otLinkGetChannel(mController->GetInstance()));
     else if (!strcmp(aAction, "panid"))
     {
-        char panIdString[PANID_LENGTH];
-        sprintf(panIdString, "0x%04x", otLinkGetPanId(mController->GetInstance()));
-        blobmsg_add_string(&mBuf, "PanId", panIdString);
+        AddHexU16(mBuf, "PanId", otLinkGetPanId(mController->GetInstance()));
     }
     else if (!strcmp(aAction, "rloc16"))
     {
-        char rloc[PANID_LENGTH];
-        sprintf(rloc, "0x%04x", otThreadGetRloc16(mController->GetInstance()));
-        blobmsg_add_string(&mBuf, "rloc16", rloc);
+        AddHexU16(mBuf, "rloc16", otThreadGetRloc16(mController->GetInstance()));
     }
     else if (!strcmp(aAction, "networkkey"))
     {
@@ -1153,46 +1272,60 @@ int UbusServer::UbusGetInformation(struct ubus_context *     aContext,
     }
     else if (!strcmp(aAction, "partitionid"))
     {
-        blobmsg_add_u32(&mBuf, "Partitionid", otThreadGetPartitionId(mController->GetInstance()));
+        // Read the lock-free published snapshot rather than entering the OT
+        // API; telemetry pollers then share one state extraction per change
+        // batch with the other frontends.
+        blobmsg_add_u32(&mBuf, "Partitionid", mController->ShareStateSnapshot()->mPartitionId);
     }
     else if (!strcmp(aAction, "leaderdata"))
     {
-        otLeaderData leaderData;
+        std::shared_ptr<const Ncp::ControllerOpenThread::ThreadStateSnapshot> snapshot =
+            mController->ShareStateSnapshot();
 
-        SuccessOrExit(error = otThreadGetLeaderData(mController->GetInstance(), &leaderData));
+        VerifyOrExit(snapshot->mLeaderDataValid, error = OT_ERROR_DETACHED);
 
         sJsonUri = blobmsg_open_table(&mBuf, "leaderdata");
 
-        blobmsg_add_u32(&mBuf, "PartitionId", leaderData.mPartitionId);
-        blobmsg_add_u32(&mBuf, "Weighting", leaderData.mWeighting);
-        blobmsg_add_u32(&mBuf, "DataVersion", leaderData.mDataVersion);
-        blobmsg_add_u32(&mBuf, "StableDataVersion", leaderData.mStableDataVersion);
-        blobmsg_add_u32(&mBuf, "LeaderRouterId", leaderData.mLeaderRouterId);
+        blobmsg_add_u32(&mBuf, "PartitionId", snapshot->mLeaderData.mPartitionId);
+        blobmsg_add_u32(&mBuf, "Weighting", snapshot->mLeaderData.mWeighting);
+        blobmsg_add_u32(&mBuf, "DataVersion", snapshot->mLeaderData.mDataVersion);
+        blobmsg_add_u32(&mBuf, "StableDataVersion", snapshot->mLeaderData.mStableDataVersion);
+        blobmsg_add_u32(&mBuf, "LeaderRouterId", snapshot->mLeaderData.mLeaderRouterId);
 
         blobmsg_close_table(&mBuf, sJsonUri);
     }
     else if (!strcmp(aAction, "networkdata"))
     {
-        ubus_send_reply(aContext, aRequest, mNetworkdataBuf.head);
-        if (time(nullptr) - mSecond > 10)
+        struct otIp6Address address;
+        uint8_t             tlvTypes[OT_NETWORK_DIAGNOSTIC_TYPELIST_MAX_ENTRIES];
+        uint8_t             count             = 0;
+        char                multicastAddr[10] = "ff03::2";
+
+        VerifyOrExit(!mDiagDeferred, error = OT_ERROR_BUSY);
+
         {
-            struct otIp6Address address;
-            uint8_t             tlvTypes[OT_NETWORK_DIAGNOSTIC_TYPELIST_MAX_ENTRIES];
-            uint8_t             count             = 0;
-            char                multicastAddr[10] = "ff03::2";
+            std::lock_guard<std::mutex> lock(mDiagResultMutex);
 
-            blob_buf_init(&mNetworkdataBuf, 0);
+            mDiagResults.clear();
+        }
+        mDiagNodeNum = 0;
 
-            SuccessOrExit(error = otIp6AddressFromString(multicastAddr, &address));
+        SuccessOrExit(error = otIp6AddressFromString(multicastAddr, &address));
 
-            tlvTypes[count++] = static_cast<uint8_t>(OT_NETWORK_DIAGNOSTIC_TLV_ROUTE);
-            tlvTypes[count++] = static_cast<uint8_t>(OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE);
+        tlvTypes[count++] = static_cast<uint8_t>(OT_NETWORK_DIAGNOSTIC_TLV_ROUTE);
+        tlvTypes[count++] = static_cast<uint8_t>(OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE);
 
-            sBufNum = 0;
-            otThreadSendDiagnosticGet(mController->GetInstance(), &address, tlvTypes, count,
-                                      &UbusServer::HandleDiagnosticGetResponse, this);
-            mSecond = time(nullptr);
-        }
+        SuccessOrExit(error = otThreadSendDiagnosticGet(mController->GetInstance(), &address, tlvTypes, count,
+                                                        &UbusServer::HandleDiagnosticGetResponse, this));
+
+        // Defer the request and let a uloop timer stream the per-node
+        // responses as they arrive: a multicast query across a large mesh
+        // takes seconds to answer and its result set no longer has to fit
+        // in one cached blob.
+        ubus_defer_request(aContext, aRequest, &mDiagRequest);
+        mDiagDeferred = true;
+        mDiagDeadline = Clock::now() + Milliseconds(kDiagCollectTimeout);
+        uloop_timeout_set(&mDiagPollTimer, kScanPollInterval);
         goto exit;
     }
     else if (!strcmp(aAction, "joinernum"))
@@ -1314,26 +1447,21 @@ static bool IsRoutingLocator(const otIp6Address *aAddress)
 
 void UbusServer::HandleDiagnosticGetResponse(otError aError, otMessage *aMessage, const otMessageInfo *aMessageInfo)
 {
-    uint16_t              rloc16;
     uint16_t              sockRloc16 = 0;
-    void *                jsonArray  = nullptr;
-    void *                jsonItem   = nullptr;
-    char                  xrloc[10];
+    DiagNodeResult        node;
     otNetworkDiagTlv      diagTlv;
     otNetworkDiagIterator iterator = OT_NETWORK_DIAGNOSTIC_ITERATOR_INIT;
 
     SuccessOrExit(aError);
 
-    char networkdata[20];
-    sprintf(networkdata, "networkdata%d", sBufNum);
-    sJsonUri = blobmsg_open_table(&mNetworkdataBuf, networkdata);
-    sBufNum++;
-
+    // This callback runs on the OpenThread thread: only parse the message
+    // into a plain result here and leave the blob building to the uloop
+    // poll timer, which owns the ubus connection.
     if (IsRoutingLocator(&aMessageInfo->mSockAddr))
     {
-        sockRloc16 = ntohs(aMessageInfo->mPeerAddr.mFields.m16[7]);
-        sprintf(xrloc, "0x%04x", sockRloc16);
-        blobmsg_add_string(&mNetworkdataBuf, "rloc", xrloc);
+        node.mHasRloc = true;
+        node.mRloc16  = ntohs(aMessageInfo->mPeerAddr.mFields.m16[7]);
+        sockRloc16    = node.mRloc16;
     }
 
     while (otThreadGetNextDiagnosticTlv(aMessage, &iterator, &diagTlv) == OT_ERROR_NONE)
@@ -1344,7 +1472,7 @@ void UbusServer::HandleDiagnosticGetResponse(otError aError, otMessage *aMessage
         {
             const otNetworkDiagRoute &route = diagTlv.mData.mRoute;
 
-            jsonArray = blobmsg_open_array(&mNetworkdataBuf, "routedata");
+            node.mHasRoutes = true;
 
             for (uint16_t i = 0; i < route.mRouteCount; ++i)
             {
@@ -1353,21 +1481,19 @@ void UbusServer::HandleDiagnosticGetResponse(otError aError, otMessage *aMessage
                 out = route.mRouteData[i].mLinkQualityOut;
                 if (in != 0 && out != 0)
                 {
-                    jsonItem = blobmsg_open_table(&mNetworkdataBuf, "router");
-                    rloc16   = route.mRouteData[i].mRouterId << 10;
-                    blobmsg_add_u32(&mNetworkdataBuf, "routerid", route.mRouteData[i].mRouterId);
-                    sprintf(xrloc, "0x%04x", rloc16);
-                    blobmsg_add_string(&mNetworkdataBuf, "rloc", xrloc);
-                    blobmsg_close_table(&mNetworkdataBuf, jsonItem);
+                    DiagRouterEntry router;
+
+                    router.mRouterId = route.mRouteData[i].mRouterId;
+                    node.mRouters.push_back(router);
                 }
             }
-            blobmsg_close_array(&mNetworkdataBuf, jsonArray);
             break;
         }
 
         case OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE:
         {
-            jsonArray = blobmsg_open_array(&mNetworkdataBuf, "childdata");
+            node.mHasChildren = true;
+
             for (uint16_t i = 0; i < diagTlv.mData.mChildTable.mCount; ++i)
             {
                 enum
@@ -1378,19 +1504,14 @@ void UbusServer::HandleDiagnosticGetResponse(otError aError, otMessage *aMessage
                 };
                 const otNetworkDiagChildEntry &entry = diagTlv.mData.mChildTable.mTable[i];
 
-                uint8_t mode = 0;
+                DiagChildEntry child;
 
-                jsonItem = blobmsg_open_table(&mNetworkdataBuf, "child");
-                sprintf(xrloc, "0x%04x", (sockRloc16 | entry.mChildId));
-                blobmsg_add_string(&mNetworkdataBuf, "rloc", xrloc);
-
-                mode = (entry.mMode.mRxOnWhenIdle ? kModeRxOnWhenIdle : 0) |
-                       (entry.mMode.mDeviceType ? kModeFullThreadDevice : 0) |
-                       (entry.mMode.mNetworkData ? kModeFullNetworkData : 0);
-                blobmsg_add_u16(&mNetworkdataBuf, "mode", mode);
-                blobmsg_close_table(&mNetworkdataBuf, jsonItem);
+                child.mRloc16 = sockRloc16 | entry.mChildId;
+                child.mMode   = (entry.mMode.mRxOnWhenIdle ? kModeRxOnWhenIdle : 0) |
+                                (entry.mMode.mDeviceType ? kModeFullThreadDevice : 0) |
+                                (entry.mMode.mNetworkData ? kModeFullNetworkData : 0);
+                node.mChildren.push_back(child);
             }
-            blobmsg_close_array(&mNetworkdataBuf, jsonArray);
             break;
         }
 
@@ -1400,7 +1521,11 @@ void UbusServer::HandleDiagnosticGetResponse(otError aError, otMessage *aMessage
         }
     }
 
-    blobmsg_close_table(&mNetworkdataBuf, sJsonUri);
+    {
+        std::lock_guard<std::mutex> lock(mDiagResultMutex);
+
+        mDiagResults.push_back(std::move(node));
+    }
 
 exit:
     if (aError != OT_ERROR_NONE)
@@ -1409,6 +1534,100 @@ exit:
     }
 }
 
+void UbusServer::UbusDiagPollTimer(struct uloop_timeout *aTimeout)
+{
+    GetInstance().UbusDiagPollTimerDetail(aTimeout);
+}
+
+void UbusServer::UbusDiagPollTimerDetail(struct uloop_timeout *aTimeout)
+{
+    Timepoint budgetEnd = Clock::now() + Milliseconds(kDiagReplyBudget);
+    bool      drained   = false;
+
+    // Stream at most a budget's worth of node replies per pass so a query
+    // across hundreds of nodes neither stalls the uloop nor buffers the
+    // whole result set before the caller sees the first node.
+    while (Clock::now() < budgetEnd)
+    {
+        char           networkdata[20];
+        void *         jsonUri = nullptr;
+        DiagNodeResult node;
+
+        {
+            std::lock_guard<std::mutex> lock(mDiagResultMutex);
+
+            if (mDiagResults.empty())
+            {
+                drained = true;
+                break;
+            }
+
+            node = std::move(mDiagResults.front());
+            mDiagResults.erase(mDiagResults.begin());
+        }
+
+        blob_buf_init(&mDiagBuf, 0);
+
+        sprintf(networkdata, "networkdata%d", mDiagNodeNum);
+        jsonUri = blobmsg_open_table(&mDiagBuf, networkdata);
+        mDiagNodeNum++;
+
+        if (node.mHasRloc)
+        {
+            AddHexU16(mDiagBuf, "rloc", node.mRloc16);
+        }
+
+        if (node.mHasRoutes)
+        {
+            void *jsonArray = blobmsg_open_array(&mDiagBuf, "routedata");
+
+            for (const DiagRouterEntry &router : node.mRouters)
+            {
+                void *jsonItem = blobmsg_open_table(&mDiagBuf, "router");
+
+                blobmsg_add_u32(&mDiagBuf, "routerid", router.mRouterId);
+                AddHexU16(mDiagBuf, "rloc", static_cast<uint16_t>(router.mRouterId << 10));
+                blobmsg_close_table(&mDiagBuf, jsonItem);
+            }
+            blobmsg_close_array(&mDiagBuf, jsonArray);
+        }
+
+        if (node.mHasChildren)
+        {
+            void *jsonArray = blobmsg_open_array(&mDiagBuf, "childdata");
+
+            for (const DiagChildEntry &child : node.mChildren)
+            {
+                void *jsonItem = blobmsg_open_table(&mDiagBuf, "child");
+
+                AddHexU16(mDiagBuf, "rloc", child.mRloc16);
+                blobmsg_add_u16(&mDiagBuf, "mode", child.mMode);
+                blobmsg_close_table(&mDiagBuf, jsonItem);
+            }
+            blobmsg_close_array(&mDiagBuf, jsonArray);
+        }
+
+        blobmsg_close_table(&mDiagBuf, jsonUri);
+
+        ubus_send_reply(mContext, &mDiagRequest, mDiagBuf.head);
+    }
+
+    // A multicast diagnostic get has no completion signal; keep polling
+    // until the collect window has elapsed and every queued node has been
+    // streamed out.
+    if (!drained || Clock::now() < mDiagDeadline)
+    {
+        uloop_timeout_set(aTimeout, kScanPollInterval);
+        return;
+    }
+
+    blob_buf_init(&mDiagBuf, 0);
+    blobmsg_add_u16(&mDiagBuf, "Error", OT_ERROR_NONE);
+    ubus_send_reply(mContext, &mDiagRequest, mDiagBuf.head);
+    ubus_complete_deferred_request(mContext, &mDiagRequest, UBUS_STATUS_OK);
+    mDiagDeferred = false;
+}
+
 int UbusServer::UbusSetInformation(struct ubus_context *     aContext,
                                    struct ubus_object *      aObj,
                                    struct ubus_request_data *aRequest,
@@ -1796,6 +2015,9 @@ void UBusAgent::Init(void)
 
     otbr::ubus::UbusServer::Initialize(&mNcp, &mThreadMutex);
 
+    mNcp.AddThreadStateChangedCallback(
+        [](otChangedFlags aFlags) { otbr::ubus::UbusServer::GetInstance().HandleThreadStateChanged(aFlags); });
+
     if (otbr::ubus::sUbusEfd == -1)
     {
         perror("Failed to create eventfd for ubus");
@@ -39,6 +39,10 @@
 #include <stdarg.h>
 #include <time.h>
 
+#include <mutex>
+#include <vector>
+
+#include <openthread/instance.h>
 #include <openthread/ip6.h>
 #include <openthread/link.h>
 #include <openthread/netdiag.h>
@@ -46,6 +50,7 @@
 
 #include "common/code_utils.hpp"
 #include "common/mainloop.hpp"
+#include "common/time.hpp"
 #include "ncp/ncp_openthread.hpp"
 
 extern "C" {
@@ -768,18 +773,68 @@ public:
      */
     void HandleDiagnosticGetResponse(otError aError, otMessage *aMessage, const otMessageInfo *aMessageInfo);
 
+    /**
+     * This method handles Thread state changed events and invalidates the cached neighbor blob.
+     *
+     * @param[in] aFlags  The OpenThread changed flags.
+     *
+     */
+    void HandleThreadStateChanged(otChangedFlags aFlags);
+
 private:
-    bool                       mIfFinishScan;
-    struct ubus_context *      mContext;
-    const char *               mSockPath;
-    struct blob_buf            mBuf;
-    struct blob_buf            mNetworkdataBuf;
-    Ncp::ControllerOpenThread *mController;
-    std::mutex *               mNcpThreadMutex;
-    time_t                     mSecond;
+    struct DiagRouterEntry
+    {
+        uint8_t mRouterId; // The router ID.
+    };
+
+    struct DiagChildEntry
+    {
+        uint16_t mRloc16; // The RLOC16 of the child.
+        uint8_t  mMode;   // The mode bits of the child.
+    };
+
+    // One node's parsed diagnostic response, queued by the OpenThread
+    // callback and rendered into a ubus reply by the uloop poll timer.
+    struct DiagNodeResult
+    {
+        bool                         mHasRloc     = false; // Whether the responder address carried an RLOC16.
+        bool                         mHasRoutes   = false; // Whether a route TLV was present.
+        bool                         mHasChildren = false; // Whether a child table TLV was present.
+        uint16_t                     mRloc16      = 0;     // The RLOC16 of the responder.
+        std::vector<DiagRouterEntry> mRouters;             // The usable router entries.
+        std::vector<DiagChildEntry>  mChildren;            // The child table entries.
+    };
+
+    bool                            mIfFinishScan;
+    struct ubus_context *           mContext;
+    const char *                    mSockPath;
+    struct blob_buf                 mBuf;
+    struct blob_buf                 mScanBuf;
+    struct ubus_request_data        mScanRequest;
+    struct uloop_timeout            mScanPollTimer;
+    bool                            mScanDeferred;
+    std::mutex                      mScanResultMutex;
+    std::vector<otActiveScanResult> mScanResults;
+    struct blob_buf                 mDiagBuf;
+    struct ubus_request_data        mDiagRequest;
+    struct uloop_timeout            mDiagPollTimer;
+    bool                            mDiagDeferred;
+    Timepoint                       mDiagDeadline;
+    int                             mDiagNodeNum;
+    std::mutex                      mDiagResultMutex;
+    std::vector<DiagNodeResult>     mDiagResults;
+    struct blob_buf                 mNeighborBuf;
+    bool                            mNeighborCacheValid;
+    time_t                          mNeighborCacheTime;
+    Ncp::ControllerOpenThread *     mController;
+    std::mutex *                    mNcpThreadMutex;
     enum
     {
         kDefaultJoinerTimeout = 120,
+        kScanPollInterval     = 100,  ///< Milliseconds between deferred scan completion polls.
+        kNeighborCacheMaxAge  = 10,   ///< Seconds before the cached neighbor blob goes stale anyway.
+        kDiagCollectTimeout   = 3000, ///< Milliseconds to keep collecting multicast diagnostic responses.
+        kDiagReplyBudget      = 2,    ///< Milliseconds of reply building per poll pass.
     };
 
     /**
@@ -831,6 +886,39 @@ private:
      */
     void HandleActiveScanResultDetail(otActiveScanResult *aResult);
 
+    /**
+     * This method polls for scan completion (callback function).
+     *
+     * @param[in] aTimeout  A pointer to the timeout.
+     *
+     */
+    static void UbusScanPollTimer(struct uloop_timeout *aTimeout);
+
+    /**
+     * This method detailly streams queued scan results and resolves the deferred scan request on completion.
+     *
+     * @param[in] aTimeout  A pointer to the timeout.
+     *
+     */
+    void UbusScanPollTimerDetail(struct uloop_timeout *aTimeout);
+
+    /**
+     * This method polls for queued diagnostic responses (callback function).
+     *
+     * @param[in] aTimeout  A pointer to the timeout.
+     *
+     */
+    static void UbusDiagPollTimer(struct uloop_timeout *aTimeout);
+
+    /**
+     * This method detailly streams queued diagnostic responses within a time budget and resolves the deferred
+     * request once the collect window has elapsed.
+     *
+     * @param[in] aTimeout  A pointer to the timeout.
+     *
+     */
+    void UbusDiagPollTimerDetail(struct uloop_timeout *aTimeout);
+
     /**
      * This method detailly handler get neighbor information.
      *
@@ -0,0 +1,388 @@
+/*
+ *  Copyright (c) 2020, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rest/cbor.hpp"
+
+#include <string.h>
+
+namespace otbr {
+namespace rest {
+namespace Cbor {
+
+/**
+ * This class appends CBOR items (RFC 7049) directly to a byte buffer, so objects are serialized in one pass without
+ * building an intermediate tree.
+ *
+ */
+class CborWriter
+{
+public:
+    explicit CborWriter(size_t aCapacity) { mBuffer.reserve(aCapacity); }
+
+    void OpenMap(size_t aCount) { PutHead(5, aCount); }
+    void OpenArray(size_t aCount) { PutHead(4, aCount); }
+
+    // Indefinite-length maps avoid a counting pass when the number of pairs
+    // is only known after walking the input.
+    void OpenIndefiniteMap(void) { mBuffer.push_back(static_cast<char>(0xbf)); }
+    void CloseIndefinite(void) { mBuffer.push_back(static_cast<char>(0xff)); }
+
+    void PutUnsigned(uint64_t aValue) { PutHead(0, aValue); }
+
+    void PutSigned(int64_t aValue)
+    {
+        if (aValue < 0)
+        {
+            PutHead(1, static_cast<uint64_t>(-1 - aValue));
+        }
+        else
+        {
+            PutHead(0, static_cast<uint64_t>(aValue));
+        }
+    }
+
+    void PutText(const char *aText)
+    {
+        size_t length = strlen(aText);
+
+        PutHead(3, length);
+        mBuffer.append(aText, length);
+    }
+
+    void PutBytes(const uint8_t *aBytes, size_t aLength)
+    {
+        PutHead(2, aLength);
+        mBuffer.append(reinterpret_cast<const char *>(aBytes), aLength);
+    }
+
+    void Key(const char *aKey) { PutText(aKey); }
+
+    std::string TakeString(void) { return std::move(mBuffer); }
+
+private:
+    void PutHead(uint8_t aMajor, uint64_t aValue)
+    {
+        uint8_t type = static_cast<uint8_t>(aMajor << 5);
+
+        if (aValue < 24)
+        {
+            mBuffer.push_back(static_cast<char>(type | aValue));
+        }
+        else if (aValue <= 0xff)
+        {
+            mBuffer.push_back(static_cast<char>(type | 24));
+            mBuffer.push_back(static_cast<char>(aValue));
+        }
+        else if (aValue <= 0xffff)
+        {
+            mBuffer.push_back(static_cast<char>(type | 25));
+            mBuffer.push_back(static_cast<char>(aValue >> 8));
+            mBuffer.push_back(static_cast<char>(aValue));
+        }
+        else if (aValue <= 0xffffffff)
+        {
+            mBuffer.push_back(static_cast<char>(type | 26));
+            for (int shift = 24; shift >= 0; shift -= 8)
+            {
+                mBuffer.push_back(static_cast<char>(aValue >> shift));
+            }
+        }
+        else
+        {
+            mBuffer.push_back(static_cast<char>(type | 27));
+            for (int shift = 56; shift >= 0; shift -= 8)
+            {
+                mBuffer.push_back(static_cast<char>(aValue >> shift));
+            }
+        }
+    }
+
+    std::string mBuffer;
+};
+
+static void WriteMode(CborWriter &aWriter, const otLinkModeConfig &aMode)
+{
+    aWriter.OpenMap(3);
+    aWriter.Key("RxOnWhenIdle");
+    aWriter.PutUnsigned(aMode.mRxOnWhenIdle);
+    aWriter.Key("DeviceType");
+    aWriter.PutUnsigned(aMode.mDeviceType);
+    aWriter.Key("NetworkData");
+    aWriter.PutUnsigned(aMode.mNetworkData);
+}
+
+static void WriteChildTableEntry(CborWriter &aWriter, const otNetworkDiagChildEntry &aChildEntry)
+{
+    aWriter.OpenMap(3);
+    aWriter.Key("ChildId");
+    aWriter.PutUnsigned(aChildEntry.mChildId);
+    aWriter.Key("Timeout");
+    aWriter.PutUnsigned(aChildEntry.mTimeout);
+    aWriter.Key("Mode");
+    WriteMode(aWriter, aChildEntry.mMode);
+}
+
+static void WriteMacCounters(CborWriter &aWriter, const otNetworkDiagMacCounters &aMacCounters)
+{
+    aWriter.OpenMap(9);
+    aWriter.Key("IfInUnknownProtos");
+    aWriter.PutUnsigned(aMacCounters.mIfInUnknownProtos);
+    aWriter.Key("IfInErrors");
+    aWriter.PutUnsigned(aMacCounters.mIfInErrors);
+    aWriter.Key("IfOutErrors");
+    aWriter.PutUnsigned(aMacCounters.mIfOutErrors);
+    aWriter.Key("IfInUcastPkts");
+    aWriter.PutUnsigned(aMacCounters.mIfInUcastPkts);
+    aWriter.Key("IfInBroadcastPkts");
+    aWriter.PutUnsigned(aMacCounters.mIfInBroadcastPkts);
+    aWriter.Key("IfInDiscards");
+    aWriter.PutUnsigned(aMacCounters.mIfInDiscards);
+    aWriter.Key("IfOutUcastPkts");
+    aWriter.PutUnsigned(aMacCounters.mIfOutUcastPkts);
+    aWriter.Key("IfOutBroadcastPkts");
+    aWriter.PutUnsigned(aMacCounters.mIfOutBroadcastPkts);
+    aWriter.Key("IfOutDiscards");
+    aWriter.PutUnsigned(aMacCounters.mIfOutDiscards);
+}
+
+static void WriteConnectivity(CborWriter &aWriter, const otNetworkDiagConnectivity &aConnectivity)
+{
+    aWriter.OpenMap(9);
+    aWriter.Key("ParentPriority");
+    aWriter.PutSigned(aConnectivity.mParentPriority);
+    aWriter.Key("LinkQuality3");
+    aWriter.PutUnsigned(aConnectivity.mLinkQuality3);
+    aWriter.Key("LinkQuality2");
+    aWriter.PutUnsigned(aConnectivity.mLinkQuality2);
+    aWriter.Key("LinkQuality1");
+    aWriter.PutUnsigned(aConnectivity.mLinkQuality1);
+    aWriter.Key("LeaderCost");
+    aWriter.PutUnsigned(aConnectivity.mLeaderCost);
+    aWriter.Key("IdSequence");
+    aWriter.PutUnsigned(aConnectivity.mIdSequence);
+    aWriter.Key("ActiveRouters");
+    aWriter.PutUnsigned(aConnectivity.mActiveRouters);
+    aWriter.Key("SedBufferSize");
+    aWriter.PutUnsigned(aConnectivity.mSedBufferSize);
+    aWriter.Key("SedDatagramCount");
+    aWriter.PutUnsigned(aConnectivity.mSedDatagramCount);
+}
+
+static void WriteRoute(CborWriter &aWriter, const otNetworkDiagRoute &aRoute)
+{
+    aWriter.OpenMap(2);
+    aWriter.Key("IdSequence");
+    aWriter.PutUnsigned(aRoute.mIdSequence);
+
+    aWriter.Key("RouteData");
+    aWriter.OpenArray(aRoute.mRouteCount);
+    for (uint16_t i = 0; i < aRoute.mRouteCount; ++i)
+    {
+        aWriter.OpenMap(4);
+        aWriter.Key("RouteId");
+        aWriter.PutUnsigned(aRoute.mRouteData[i].mRouterId);
+        aWriter.Key("LinkQualityOut");
+        aWriter.PutUnsigned(aRoute.mRouteData[i].mLinkQualityOut);
+        aWriter.Key("LinkQualityIn");
+        aWriter.PutUnsigned(aRoute.mRouteData[i].mLinkQualityIn);
+        aWriter.Key("RouteCost");
+        aWriter.PutUnsigned(aRoute.mRouteData[i].mRouteCost);
+    }
+}
+
+static void WriteLeaderData(CborWriter &aWriter, const otLeaderData &aLeaderData)
+{
+    aWriter.OpenMap(5);
+    aWriter.Key("PartitionId");
+    aWriter.PutUnsigned(aLeaderData.mPartitionId);
+    aWriter.Key("Weighting");
+    aWriter.PutUnsigned(aLeaderData.mWeighting);
+    aWriter.Key("DataVersion");
+    aWriter.PutUnsigned(aLeaderData.mDataVersion);
+    aWriter.Key("StableDataVersion");
+    aWriter.PutUnsigned(aLeaderData.mStableDataVersion);
+    aWriter.Key("LeaderRouterId");
+    aWriter.PutUnsigned(aLeaderData.mLeaderRouterId);
+}
+
+std::string Node2CborString(const NodeInfo &aNode)
+{
+    CborWriter writer(256);
+
+    writer.OpenMap(8);
+    writer.Key("State");
+    writer.PutUnsigned(aNode.mRole);
+    writer.Key("NumOfRouter");
+    writer.PutUnsigned(aNode.mNumOfRouter);
+    writer.Key("RlocAddress");
+    writer.PutBytes(aNode.mRlocAddress.mFields.m8, OT_IP6_ADDRESS_SIZE);
+    writer.Key("ExtAddress");
+    writer.PutBytes(aNode.mExtAddress, OT_EXT_ADDRESS_SIZE);
+    writer.Key("NetworkName");
+    writer.PutText(aNode.mNetworkName.c_str());
+    writer.Key("Rloc16");
+    writer.PutUnsigned(aNode.mRloc16);
+    writer.Key("LeaderData");
+    WriteLeaderData(writer, aNode.mLeaderData);
+    writer.Key("ExtPanId");
+    writer.PutBytes(aNode.mExtPanId, OT_EXT_PAN_ID_SIZE);
+
+    return writer.TakeString();
+}
+
+static void WriteDiagNode(CborWriter &aWriter, const std::vector<otNetworkDiagTlv> &aDiagItem)
+{
+    aWriter.OpenIndefiniteMap();
+    for (const auto &diagTlv : aDiagItem)
+    {
+        switch (diagTlv.mType)
+        {
+        case OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS:
+
+            aWriter.Key("ExtAddress");
+            aWriter.PutBytes(diagTlv.mData.mExtAddress.m8, OT_EXT_ADDRESS_SIZE);
+
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS:
+
+            aWriter.Key("Rloc16");
+            aWriter.PutUnsigned(diagTlv.mData.mAddr16);
+
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_MODE:
+
+            aWriter.Key("Mode");
+            WriteMode(aWriter, diagTlv.mData.mMode);
+
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_TIMEOUT:
+
+            aWriter.Key("Timeout");
+            aWriter.PutUnsigned(diagTlv.mData.mTimeout);
+
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_CONNECTIVITY:
+
+            aWriter.Key("Connectivity");
+            WriteConnectivity(aWriter, diagTlv.mData.mConnectivity);
+
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_ROUTE:
+
+            aWriter.Key("Route");
+            WriteRoute(aWriter, diagTlv.mData.mRoute);
+
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_LEADER_DATA:
+
+            aWriter.Key("LeaderData");
+            WriteLeaderData(aWriter, diagTlv.mData.mLeaderData);
+
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_NETWORK_DATA:
+
+            aWriter.Key("NetworkData");
+            aWriter.PutBytes(diagTlv.mData.mNetworkData.m8, diagTlv.mData.mNetworkData.mCount);
+
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_IP6_ADDR_LIST:
+
+            aWriter.Key("IP6AddressList");
+            aWriter.OpenArray(diagTlv.mData.mIp6AddrList.mCount);
+
+            for (uint16_t i = 0; i < diagTlv.mData.mIp6AddrList.mCount; ++i)
+            {
+                aWriter.PutBytes(diagTlv.mData.mIp6AddrList.mList[i].mFields.m8, OT_IP6_ADDRESS_SIZE);
+            }
+
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_MAC_COUNTERS:
+
+            aWriter.Key("MACCounters");
+            WriteMacCounters(aWriter, diagTlv.mData.mMacCounters);
+
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_BATTERY_LEVEL:
+
+            aWriter.Key("BatteryLevel");
+            aWriter.PutUnsigned(diagTlv.mData.mBatteryLevel);
+
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_SUPPLY_VOLTAGE:
+
+            aWriter.Key("SupplyVoltage");
+            aWriter.PutUnsigned(diagTlv.mData.mSupplyVoltage);
+
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE:
+
+            aWriter.Key("ChildTable");
+            aWriter.OpenArray(diagTlv.mData.mChildTable.mCount);
+
+            for (uint16_t i = 0; i < diagTlv.mData.mChildTable.mCount; ++i)
+            {
+                WriteChildTableEntry(aWriter, diagTlv.mData.mChildTable.mTable[i]);
+            }
+
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_CHANNEL_PAGES:
+
+            aWriter.Key("ChannelPages");
+            aWriter.PutBytes(diagTlv.mData.mChannelPages.m8, diagTlv.mData.mChannelPages.mCount);
+
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_MAX_CHILD_TIMEOUT:
+
+            aWriter.Key("MaxChildTimeout");
+            aWriter.PutUnsigned(diagTlv.mData.mMaxChildTimeout);
+
+            break;
+        default:
+            break;
+        }
+    }
+    aWriter.CloseIndefinite();
+}
+
+std::string Diag2CborString(const std::vector<std::vector<otNetworkDiagTlv>> &aDiagSet)
+{
+    CborWriter writer(aDiagSet.size() * 512 + 16);
+
+    writer.OpenArray(aDiagSet.size());
+
+    for (const auto &diagItem : aDiagSet)
+    {
+        WriteDiagNode(writer, diagItem);
+    }
+
+    return writer.TakeString();
+}
+
+} // namespace Cbor
+} // namespace rest
+} // namespace otbr
@@ -0,0 +1,78 @@
+/*
+ *  Copyright (c) 2020, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes CBOR formatter definition for RESTful HTTP server.
+ */
+
+#ifndef OTBR_REST_CBOR_HPP_
+#define OTBR_REST_CBOR_HPP_
+
+#include "openthread/link.h"
+#include "openthread/thread_ftd.h"
+
+#include "rest/types.hpp"
+
+namespace otbr {
+namespace rest {
+
+/**
+ * The functions within this namespace provide a transformation from an object to a serialized CBOR byte string. The
+ * encodings use the same keys and nesting as their Json counterparts, directly serialized without an intermediate
+ * tree.
+ *
+ */
+namespace Cbor {
+
+/**
+ * This method formats a Node object to a CBOR map and serializes it to a byte string.
+ *
+ * @param[in] aNode  A Node object.
+ *
+ * @returns A string of serialized CBOR map.
+ *
+ */
+std::string Node2CborString(const NodeInfo &aNode);
+
+/**
+ * This method formats a vector of diagnostic objects to a CBOR array and serializes it to a byte string.
+ *
+ * @param[in] aDiagSet  A vector of diagnostic objects.
+ *
+ * @returns A string of serialized CBOR array.
+ *
+ */
+std::string Diag2CborString(const std::vector<std::vector<otNetworkDiagTlv>> &aDiagSet);
+
+}; // namespace Cbor
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_CBOR_HPP_
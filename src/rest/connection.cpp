@@ -32,8 +32,12 @@
 
 #include <assert.h>
 
+#include <sys/epoll.h>
 #include <sys/socket.h>
 #include <sys/time.h>
+#include <sys/uio.h>
+
+#include "common/time.hpp"
 
 using std::chrono::duration_cast;
 using std::chrono::microseconds;
@@ -55,12 +59,23 @@ static const uint32_t kWriteTimeout = 10000000;
 // The timeout (in microseconds) since a connection is in wait read state
 static const uint32_t kReadTimeout = 1000000;
 
+// The maximum number of buffers gathered into one writev call
+static const int kMaxWriteIov = 16;
+
+// The timeout (in microseconds) a keep-alive connection may stay idle
+// between requests before it is closed.
+static const uint32_t kIdleTimeout = 10000000;
+
 Connection::Connection(steady_clock::time_point aStartTime, Resource *aResource, int aFd)
     : mTimeStamp(aStartTime)
     , mFd(aFd)
     , mState(ConnectionState::kInit)
     , mParser(&mRequest)
     , mResource(aResource)
+    , mWriteChunk(0)
+    , mWriteOffset(0)
+    , mKeepAlive(false)
+    , mIdle(false)
 {
 }
 
@@ -74,38 +89,39 @@ void Connection::Init(void)
     mParser.Init();
 }
 
-void Connection::UpdateReadFdSet(fd_set &aReadFdSet, int &aMaxFd) const
+uint32_t Connection::GetEpollEvents(void) const
 {
-    if (mState == ConnectionState::kReadWait || mState == ConnectionState::kInit)
-    {
-        FD_SET(mFd, &aReadFdSet);
-        aMaxFd = aMaxFd < mFd ? mFd : aMaxFd;
-    }
-}
+    uint32_t events = 0;
 
-void Connection::UpdateWriteFdSet(fd_set &aWriteFdSet, int &aMaxFd) const
-{
-    if (mState == ConnectionState::kWriteWait)
+    switch (mState)
     {
-        FD_SET(mFd, &aWriteFdSet);
-        aMaxFd = aMaxFd < mFd ? mFd : aMaxFd;
+    case ConnectionState::kInit:
+    case ConnectionState::kReadWait:
+        events = EPOLLIN;
+        break;
+    case ConnectionState::kWriteWait:
+        events = EPOLLOUT;
+        break;
+    default:
+        break;
     }
+
+    return events;
 }
 
-void Connection::UpdateTimeout(timeval &aTimeout) const
+steady_clock::time_point Connection::GetDeadline(void) const
 {
-    struct timeval timeout;
-    uint32_t       timeoutLen = kReadTimeout;
-    auto           duration   = duration_cast<microseconds>(steady_clock::now() - mTimeStamp).count();
+    uint32_t timeoutLen = kReadTimeout;
 
     switch (mState)
     {
     case ConnectionState::kReadWait:
-        timeoutLen = kReadTimeout;
+        timeoutLen = mIdle ? kIdleTimeout : kReadTimeout;
         break;
     case ConnectionState::kCallbackWait:
-        timeoutLen = kCallbackCheckInterval;
-        break;
+        // A callback wait is polled periodically: the next check is always
+        // one interval away, not a fixed offset from the state entry time.
+        return CachedClock::Now() + microseconds(kCallbackCheckInterval);
     case ConnectionState::kWriteWait:
         timeoutLen = kWriteTimeout;
         break;
@@ -116,28 +132,7 @@ void Connection::UpdateTimeout(timeval &aTimeout) const
         break;
     }
 
-    if (duration <= timeoutLen)
-    {
-        timeout.tv_sec  = 0;
-        timeout.tv_usec = timeoutLen - duration;
-    }
-    else
-    {
-        timeout.tv_sec  = 0;
-        timeout.tv_usec = 0;
-    }
-
-    if (timercmp(&timeout, &aTimeout, <))
-    {
-        aTimeout = timeout;
-    }
-}
-
-void Connection::Update(MainloopContext &aMainloop)
-{
-    UpdateTimeout(aMainloop.mTimeout);
-    UpdateReadFdSet(aMainloop.mReadFdSet, aMainloop.mMaxFd);
-    UpdateWriteFdSet(aMainloop.mWriteFdSet, aMainloop.mMaxFd);
+    return mTimeStamp + microseconds(timeoutLen);
 }
 
 void Connection::Disconnect(void)
@@ -151,7 +146,7 @@ void Connection::Disconnect(void)
     }
 }
 
-void Connection::Process(const MainloopContext &aMainloop)
+void Connection::Process(bool aReadable, bool aWritable)
 {
     otbrError error = OTBR_ERROR_NONE;
 
@@ -160,14 +155,14 @@ void Connection::Process(const MainloopContext &aMainloop)
     // Initial state, directly read for the first time.
     case ConnectionState::kInit:
     case ConnectionState::kReadWait:
-        ProcessWaitRead(aMainloop.mReadFdSet);
+        ProcessWaitRead(aReadable);
         break;
     case ConnectionState::kCallbackWait:
         //  Wait for Callback process.
         ProcessWaitCallback();
         break;
     case ConnectionState::kWriteWait:
-        ProcessWaitWrite(aMainloop.mWriteFdSet);
+        ProcessWaitWrite(aWritable);
         break;
     default:
         assert(false);
@@ -179,18 +174,25 @@ void Connection::Process(const MainloopContext &aMainloop)
     }
 }
 
-void Connection::ProcessWaitRead(const fd_set &aReadFdSet)
+void Connection::ProcessWaitRead(bool aReadable)
 {
     otbrError error    = OTBR_ERROR_NONE;
-    int32_t   received = 0, err;
+    int32_t   received = 0, err = 0;
     char      buf[2048];
-    auto      duration = duration_cast<microseconds>(steady_clock::now() - mTimeStamp).count();
+    auto      duration = duration_cast<microseconds>(CachedClock::Now() - mTimeStamp).count();
+
+    // A keep-alive connection that stays idle too long is closed quietly.
+    if (mIdle && duration >= kIdleTimeout)
+    {
+        Disconnect();
+        ExitNow();
+    }
 
     // Reach a read timeout, will send response about this timeout later.
-    VerifyOrExit(duration <= kReadTimeout, error = OTBR_ERROR_REST);
+    VerifyOrExit(mIdle || duration <= kReadTimeout, error = OTBR_ERROR_REST);
 
-    // It will succeed either fd is set or it is in kInit state.
-    VerifyOrExit(FD_ISSET(mFd, &aReadFdSet) || mState == ConnectionState::kInit);
+    // It will succeed either the socket is readable or it is in kInit state.
+    VerifyOrExit(aReadable || mState == ConnectionState::kInit);
 
     do
     {
@@ -199,7 +201,23 @@ void Connection::ProcessWaitRead(const fd_set &aReadFdSet)
         err      = errno;
         if (received > 0)
         {
-            mParser.Process(buf, received);
+            size_t consumed;
+
+            if (mIdle)
+            {
+                // First bytes of the next request on a reused connection:
+                // restart the read timeout from here.
+                mIdle      = false;
+                mTimeStamp = CachedClock::Now();
+            }
+
+            consumed = mParser.Process(buf, received);
+
+            // Keep pipelined data beyond the current request for later.
+            if (mRequest.IsComplete() && consumed < static_cast<size_t>(received))
+            {
+                mReadBuffer.append(buf + consumed, received - consumed);
+            }
         }
     } while ((received > 0 && !mRequest.IsComplete()) || err == EINTR);
 
@@ -208,6 +226,13 @@ void Connection::ProcessWaitRead(const fd_set &aReadFdSet)
         Handle();
     }
 
+    // The peer closed an idle keep-alive connection; nothing to respond to.
+    if (received == 0 && mIdle)
+    {
+        Disconnect();
+        ExitNow();
+    }
+
     // Check first failure situation: received == 0 (indicate another side at least has closes its write side )
     // and at the same time, the request has not been parsed completely.
     VerifyOrExit(received != 0 || mRequest.IsComplete(), error = OTBR_ERROR_REST);
@@ -219,6 +244,7 @@ void Connection::ProcessWaitRead(const fd_set &aReadFdSet)
 exit:
     if (error != OTBR_ERROR_NONE)
     {
+        mKeepAlive = false;
         if (received < 0)
         {
             mResource->ErrorHandler(mResponse, HttpStatusCode::kStatusInternalServerError);
@@ -236,16 +262,22 @@ void Connection::Handle(void)
 {
     otbrError error = OTBR_ERROR_NONE;
 
-    // Try to close server read side here, because we have started to handle the request and no longler read from
-    // socket.
-    VerifyOrExit((shutdown(mFd, SHUT_RD) == 0), error = OTBR_ERROR_REST);
+    mKeepAlive = mParser.ShouldKeepAlive();
+    mResponse.SetKeepAlive(mKeepAlive);
+
+    // When the connection is not reused, close server read side here, because
+    // we have started to handle the request and no longer read from socket.
+    if (!mKeepAlive)
+    {
+        VerifyOrExit((shutdown(mFd, SHUT_RD) == 0), error = OTBR_ERROR_REST);
+    }
 
     mResource->Handle(mRequest, mResponse);
 
-    if (mResponse.NeedCallback())
+    if (mResponse.NeedCallback() || mResponse.HasDeferredBody())
     {
         mState     = ConnectionState::kCallbackWait;
-        mTimeStamp = steady_clock::now();
+        mTimeStamp = CachedClock::Now();
     }
     else
     {
@@ -257,6 +289,7 @@ exit:
 
     if (error != OTBR_ERROR_NONE)
     {
+        mKeepAlive = false;
         mResource->ErrorHandler(mResponse, HttpStatusCode::kStatusInternalServerError);
         Write();
     }
@@ -264,31 +297,50 @@ exit:
 
 void Connection::ProcessWaitCallback(void)
 {
-    auto duration = duration_cast<microseconds>(steady_clock::now() - mTimeStamp).count();
+    auto duration = duration_cast<microseconds>(CachedClock::Now() - mTimeStamp).count();
 
-    mResource->HandleCallback(mRequest, mResponse);
-
-    if (mResponse.IsComplete())
+    if (mResponse.HasDeferredBody())
     {
-        Write();
+        // A worker thread is producing the body; do not invoke the callback
+        // handler again, just adopt the body once it is ready.
+        if (mResponse.TryAdoptDeferredBody())
+        {
+            Write();
+            ExitNow();
+        }
     }
     else
     {
-        if (duration >= kCallbackTimeout)
+        mResource->HandleCallback(mRequest, mResponse);
+
+        if (mResponse.IsComplete() || mResponse.HasDeferredBody())
         {
-            mResource->ErrorHandler(mResponse, HttpStatusCode::kStatusInternalServerError);
-            Write();
+            if (mResponse.IsComplete())
+            {
+                Write();
+            }
+            ExitNow();
         }
     }
+
+    if (duration >= kCallbackTimeout)
+    {
+        mKeepAlive = false;
+        mResource->ErrorHandler(mResponse, HttpStatusCode::kStatusInternalServerError);
+        Write();
+    }
+
+exit:
+    return;
 }
 
-void Connection::ProcessWaitWrite(const fd_set &aWriteFdSet)
+void Connection::ProcessWaitWrite(bool aWritable)
 {
-    auto duration = duration_cast<microseconds>(steady_clock::now() - mTimeStamp).count();
+    auto duration = duration_cast<microseconds>(CachedClock::Now() - mTimeStamp).count();
 
     if (duration <= kWriteTimeout)
     {
-        if (FD_ISSET(mFd, &aWriteFdSet))
+        if (aWritable)
         {
             Write();
         }
@@ -301,47 +353,108 @@ void Connection::ProcessWaitWrite(const fd_set &aWriteFdSet)
 
 void Connection::Write(void)
 {
-    otbrError   error = OTBR_ERROR_NONE;
-    std::string errorCode;
-    int32_t     sendLength;
-    int32_t     err;
+    otbrError                       error = OTBR_ERROR_NONE;
+    const std::vector<std::string> &bodyRope = mResponse.GetBodyRope();
+    struct iovec                    iov[kMaxWriteIov];
+    int                             iovCount = 0;
+    size_t                          chunk;
+    size_t                          offset;
+    ssize_t                         sendLength;
+    int32_t                         err;
 
     if (mState != ConnectionState::kWriteWait)
     {
         // Change its state when try write for the first time.
-        mState        = ConnectionState::kWriteWait;
-        mTimeStamp    = steady_clock::now();
-        mWriteContent = mResponse.Serialize();
+        mState       = ConnectionState::kWriteWait;
+        mTimeStamp   = CachedClock::Now();
+        mWriteHeader = mResponse.SerializeHeader();
+        mWriteChunk  = 0;
+        mWriteOffset = 0;
     }
 
     // Check we do have something to write.
-    VerifyOrExit(mWriteContent.size() > 0, error = OTBR_ERROR_REST);
-
-    sendLength = write(mFd, mWriteContent.c_str(), mWriteContent.size());
-    err        = errno;
+    VerifyOrExit(mWriteHeader.size() > 0, error = OTBR_ERROR_REST);
 
-    // Write successfully
-    if (sendLength == static_cast<int32_t>(mWriteContent.size()))
+    // Gather the remaining pieces: the header first, then the body rope,
+    // so the response is sent without concatenating it into one buffer.
+    offset = mWriteOffset;
+    for (chunk = mWriteChunk; chunk <= bodyRope.size() && iovCount < kMaxWriteIov; chunk++)
     {
-        // Normal Exit
-        Disconnect();
+        const std::string &buffer = (chunk == 0) ? mWriteHeader : bodyRope[chunk - 1];
+
+        if (buffer.size() > offset)
+        {
+            iov[iovCount].iov_base = const_cast<char *>(buffer.data() + offset);
+            iov[iovCount].iov_len  = buffer.size() - offset;
+            iovCount++;
+        }
+        offset = 0;
     }
-    else if (sendLength > 0)
+
+    if (iovCount == 0)
     {
-        // Partly write
-        mWriteContent = mWriteContent.substr(sendLength);
+        // Everything has been written already.
+        mWriteChunk = bodyRope.size() + 1;
     }
     else
     {
-        if (errno == EINTR)
+        sendLength = writev(mFd, iov, iovCount);
+        err        = errno;
+
+        if (sendLength < 0)
         {
-            // Try again
-            Write();
+            if (err == EINTR)
+            {
+                // Try again
+                Write();
+                ExitNow();
+            }
+
+            // There is an error when we write, if this, we directly disconnect this connection.
+            VerifyOrExit(err == EAGAIN || err == EWOULDBLOCK, error = OTBR_ERROR_REST);
+            ExitNow();
+        }
+
+        // Advance the chunk index and offset past the written bytes.
+        while (sendLength > 0)
+        {
+            const std::string &buffer    = (mWriteChunk == 0) ? mWriteHeader : bodyRope[mWriteChunk - 1];
+            size_t             remaining = buffer.size() - mWriteOffset;
+
+            if (static_cast<size_t>(sendLength) >= remaining)
+            {
+                sendLength -= remaining;
+                mWriteChunk++;
+                mWriteOffset = 0;
+            }
+            else
+            {
+                mWriteOffset += sendLength;
+                sendLength = 0;
+            }
+        }
+
+        // Skip any empty trailing buffers.
+        while (mWriteChunk <= bodyRope.size() &&
+               ((mWriteChunk == 0) ? mWriteHeader : bodyRope[mWriteChunk - 1]).size() == mWriteOffset)
+        {
+            mWriteChunk++;
+            mWriteOffset = 0;
+        }
+    }
+
+    if (mWriteChunk > bodyRope.size())
+    {
+        // Write successfully
+        if (mKeepAlive)
+        {
+            // The connection is reused for the next request.
+            PrepareNextRequest();
         }
         else
         {
-            // There is an error when we write, if this, we directly disconnect this connection.
-            VerifyOrExit(err == EAGAIN || err == EWOULDBLOCK, error = OTBR_ERROR_REST);
+            // Normal Exit
+            Disconnect();
         }
     }
 
@@ -352,6 +465,46 @@ exit:
     }
 }
 
+void Connection::PrepareNextRequest(void)
+{
+    // Reset the per-request state in place so the buffers grown while
+    // serving earlier requests are reused; the parser keeps its position in
+    // the byte stream so back-to-back requests parse seamlessly.
+    mRequest.Reset();
+    mResponse.Reset();
+    mWriteHeader.clear();
+    mWriteChunk  = 0;
+    mWriteOffset = 0;
+
+    mState     = ConnectionState::kReadWait;
+    mTimeStamp = CachedClock::Now();
+    mIdle      = true;
+
+    if (!mReadBuffer.empty())
+    {
+        // Pipelined data already received: parse it as the next request.
+        std::string buffered;
+        size_t      consumed;
+
+        buffered.swap(mReadBuffer);
+        mIdle = false;
+
+        consumed = mParser.Process(buffered.data(), buffered.size());
+
+        if (mRequest.IsComplete())
+        {
+            if (consumed < buffered.size())
+            {
+                // assign() reuses mReadBuffer's existing capacity instead of
+                // allocating a temporary the way substr() would.
+                mReadBuffer.assign(buffered, consumed, std::string::npos);
+            }
+
+            Handle();
+        }
+    }
+}
+
 bool Connection::IsComplete() const
 {
     return mState == ConnectionState::kComplete;
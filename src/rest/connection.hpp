@@ -37,7 +37,6 @@
 #include <string.h>
 #include <unistd.h>
 
-#include "common/mainloop.hpp"
 #include "rest/parser.hpp"
 #include "rest/resource.hpp"
 
@@ -49,8 +48,13 @@ namespace rest {
 /**
  * This class implements a Connection class of each socket connection.
  *
+ * Connections are driven by the REST server's epoll set rather than the
+ * mainloop directly: the server feeds readable/writable events into
+ * `Process()` and keeps the epoll registration in sync with
+ * `GetEpollEvents()`.
+ *
  */
-class Connection : public MainloopProcessor
+class Connection
 {
 public:
     /**
@@ -70,7 +74,7 @@ public:
      * The desctructor destroys the connection instance.
      *
      */
-    ~Connection(void) override;
+    ~Connection(void);
 
     /**
      * This method initializes the connection.
@@ -79,8 +83,39 @@ public:
      */
     void Init(void);
 
-    void Update(MainloopContext &aMainloop) override;
-    void Process(const MainloopContext &aMainloop) override;
+    /**
+     * This method processes the connection with the events reported for its socket.
+     *
+     * @param[in] aReadable  Whether the socket was reported readable.
+     * @param[in] aWritable  Whether the socket was reported writable.
+     *
+     */
+    void Process(bool aReadable, bool aWritable);
+
+    /**
+     * This method returns the file descriptor of the connection socket.
+     *
+     * @returns The connection socket file descriptor.
+     *
+     */
+    int GetFd(void) const { return mFd; }
+
+    /**
+     * This method returns the epoll events the connection currently waits for.
+     *
+     * @returns The epoll event mask matching the connection state.
+     *
+     */
+    uint32_t GetEpollEvents(void) const;
+
+    /**
+     * This method returns the time at which the connection needs processing
+     * even without a socket event (state timeouts and callback polling).
+     *
+     * @returns The deadline of the connection state.
+     *
+     */
+    steady_clock::time_point GetDeadline(void) const;
 
     /**
      * This method indicates whether this connection no longer need to be processed.
@@ -92,14 +127,12 @@ public:
     bool IsComplete(void) const;
 
 private:
-    void UpdateReadFdSet(fd_set &aReadFdSet, int &aMaxFd) const;
-    void UpdateWriteFdSet(fd_set &aWriteFdSet, int &aMaxFd) const;
-    void UpdateTimeout(timeval &aTimeout) const;
-    void ProcessWaitRead(const fd_set &aReadFdSet);
+    void ProcessWaitRead(bool aReadable);
     void ProcessWaitCallback(void);
-    void ProcessWaitWrite(const fd_set &aWriteFdSet);
+    void ProcessWaitWrite(bool aWritable);
     void Write(void);
     void Handle(void);
+    void PrepareNextRequest(void);
     void Disconnect(void);
 
     // Timestamp used for each check point of a connection
@@ -123,8 +156,24 @@ private:
     // Resource handler instance
     Resource *mResource;
 
-    // Write buffer in case write multiple times
-    std::string mWriteContent;
+    // Serialized status line and headers of the response being written
+    std::string mWriteHeader;
+
+    // Index of the buffer being written (0 is the header, body rope after)
+    size_t mWriteChunk;
+
+    // Write offset within the buffer being written
+    size_t mWriteOffset;
+
+    // Pipelined data received beyond the request currently being served
+    std::string mReadBuffer;
+
+    // Whether the current request allows the connection to be reused
+    bool mKeepAlive;
+
+    // Whether the connection is idle between keep-alive requests (no bytes
+    // of the next request received yet)
+    bool mIdle;
 };
 
 } // namespace rest
@@ -0,0 +1,223 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes a slab allocator for REST server connections.
+ */
+
+#ifndef OTBR_REST_CONNECTION_POOL_HPP_
+#define OTBR_REST_CONNECTION_POOL_HPP_
+
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "common/code_utils.hpp"
+#include "rest/connection.hpp"
+
+namespace otbr {
+namespace rest {
+
+/**
+ * This class implements a slab allocator for `Connection` objects.
+ *
+ * Slots are allocated in chunks and recycled through a free list, so in
+ * steady state accepting a connection performs no heap allocation. Chunks
+ * are retained until the pool is destroyed.
+ *
+ */
+class ConnectionPool
+{
+public:
+    /**
+     * The constructor initializes the pool.
+     *
+     * @param[in] aCapacity  The maximum number of live connections.
+     *
+     */
+    explicit ConnectionPool(size_t aCapacity)
+        : mCapacity(aCapacity)
+        , mFreeList(nullptr)
+        , mCount(0)
+        , mAllocationCount(0)
+        , mReuseCount(0)
+    {
+    }
+
+    /**
+     * The destructor destroys all live connections and releases the chunks.
+     *
+     */
+    ~ConnectionPool(void)
+    {
+        ForEach([](Connection &aConnection) { aConnection.~Connection(); });
+    }
+
+    /**
+     * This method allocates a connection from the pool.
+     *
+     * @param[in] aArgs  The arguments to construct the connection with.
+     *
+     * @returns A pointer to the new connection, or nullptr if the pool is full.
+     *
+     */
+    template <typename... Args> Connection *Allocate(Args &&...aArgs)
+    {
+        Connection *connection = nullptr;
+        Slot *      slot;
+
+        VerifyOrExit(mCount < mCapacity);
+
+        if (mFreeList == nullptr)
+        {
+            Grow();
+        }
+
+        slot      = mFreeList;
+        mFreeList = slot->mNextFree;
+
+        connection   = new (&slot->mStorage) Connection(std::forward<Args>(aArgs)...);
+        slot->mInUse = true;
+        mCount++;
+        mAllocationCount++;
+        if (slot->mRecycled)
+        {
+            mReuseCount++;
+        }
+
+    exit:
+        return connection;
+    }
+
+    /**
+     * This method destroys a connection and returns its slot to the pool.
+     *
+     * @param[in] aConnection  The connection to free, allocated by this pool.
+     *
+     */
+    void Free(Connection *aConnection)
+    {
+        Slot *slot = reinterpret_cast<Slot *>(aConnection);
+
+        aConnection->~Connection();
+        slot->mInUse    = false;
+        slot->mRecycled = true;
+        slot->mNextFree = mFreeList;
+        mFreeList       = slot;
+        mCount--;
+    }
+
+    /**
+     * This method returns the number of live connections.
+     *
+     * @returns The number of live connections.
+     *
+     */
+    size_t GetCount(void) const { return mCount; }
+
+    /**
+     * This method returns the total number of allocations served by the pool.
+     *
+     * @returns The number of allocations.
+     *
+     */
+    size_t GetAllocationCount(void) const { return mAllocationCount; }
+
+    /**
+     * This method returns the number of allocations served from a recycled
+     * slot rather than a freshly grown chunk; together with the allocation
+     * count it gives the pool hit rate.
+     *
+     * @returns The number of allocations reusing a slot.
+     *
+     */
+    size_t GetReuseCount(void) const { return mReuseCount; }
+
+    /**
+     * This method invokes a callable for every live connection.
+     *
+     * The callable may free the connection it is invoked with.
+     *
+     * @param[in] aVisitor  The callable invoked with each live connection.
+     *
+     */
+    template <typename Visitor> void ForEach(Visitor aVisitor)
+    {
+        for (const std::unique_ptr<Slot[]> &chunk : mChunks)
+        {
+            for (size_t i = 0; i < kChunkSize; i++)
+            {
+                if (chunk[i].mInUse)
+                {
+                    aVisitor(*reinterpret_cast<Connection *>(&chunk[i].mStorage));
+                }
+            }
+        }
+    }
+
+private:
+    static constexpr size_t kChunkSize = 32;
+
+    struct Slot
+    {
+        // The storage is first so a `Connection *` can be converted back to
+        // its `Slot *`.
+        typename std::aligned_storage<sizeof(Connection), alignof(Connection)>::type mStorage;
+        Slot *                                                                       mNextFree = nullptr;
+        bool                                                                         mInUse    = false;
+        bool                                                                         mRecycled = false;
+    };
+
+    void Grow(void)
+    {
+        std::unique_ptr<Slot[]> chunk(new Slot[kChunkSize]);
+
+        for (size_t i = 0; i < kChunkSize; i++)
+        {
+            chunk[i].mNextFree = mFreeList;
+            mFreeList          = &chunk[i];
+        }
+
+        mChunks.push_back(std::move(chunk));
+    }
+
+    size_t                               mCapacity;
+    Slot *                               mFreeList;
+    size_t                               mCount;
+    size_t                               mAllocationCount;
+    size_t                               mReuseCount;
+    std::vector<std::unique_ptr<Slot[]>> mChunks;
+};
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_CONNECTION_POOL_HPP_
@@ -28,6 +28,11 @@
 
 #include "rest/json.hpp"
 
+#include <stdio.h>
+
+#include <vector>
+
+#include "common/arena.hpp"
 #include "common/code_utils.hpp"
 #include "common/types.hpp"
 
@@ -39,6 +44,175 @@ namespace otbr {
 namespace rest {
 namespace Json {
 
+// All cJSON objects in this file are transient: they are built, printed and
+// deleted within a single call, well before the mainloop pass completes. So
+// cJSON can draw from the scratch arena and skip individual frees entirely,
+// removing the malloc/free churn from every REST serialization.
+static void *ScratchJsonAlloc(size_t aSize)
+{
+    return ScratchArena::GetInstance().Allocate(aSize);
+}
+
+static void ScratchJsonFree(void *)
+{
+    // Reclaimed in bulk by ScratchArena::Reset() after the mainloop pass.
+}
+
+static bool InstallScratchJsonHooks(void)
+{
+    cJSON_Hooks hooks;
+
+    hooks.malloc_fn = ScratchJsonAlloc;
+    hooks.free_fn   = ScratchJsonFree;
+    cJSON_InitHooks(&hooks);
+
+    return true;
+}
+
+static const bool kScratchJsonHooksInstalled = InstallScratchJsonHooks();
+
+/**
+ * This class implements an append-only JSON writer which produces the same
+ * formatted output as `cJSON_Print()` without building an object tree, so
+ * large responses serialize into a single preallocated buffer.
+ *
+ */
+class JsonWriter
+{
+public:
+    explicit JsonWriter(size_t aCapacity, size_t aDepth = 0)
+    {
+        mBuffer.reserve(aCapacity);
+        // A non-zero depth renders a fragment as it would appear nested
+        // that many containers deep, without emitting the containers.
+        mHasItem.resize(aDepth, false);
+    }
+
+    void OpenObject(void)
+    {
+        mBuffer += "{\n";
+        mHasItem.push_back(false);
+    }
+
+    void CloseObject(void)
+    {
+        if (mHasItem.back())
+        {
+            mBuffer += '\n';
+        }
+        mHasItem.pop_back();
+        AppendTabs(mHasItem.size());
+        mBuffer += '}';
+    }
+
+    void OpenArray(void)
+    {
+        mBuffer += '[';
+        mHasItem.push_back(false);
+    }
+
+    void CloseArray(void)
+    {
+        mHasItem.pop_back();
+        mBuffer += ']';
+    }
+
+    void Key(const char *aName)
+    {
+        if (mHasItem.back())
+        {
+            mBuffer += ",\n";
+        }
+        mHasItem.back() = true;
+        AppendTabs(mHasItem.size());
+        AppendEscaped(aName);
+        mBuffer += ":\t";
+    }
+
+    void Element(void)
+    {
+        if (mHasItem.back())
+        {
+            mBuffer += ", ";
+        }
+        mHasItem.back() = true;
+    }
+
+    void PutNumber(double aNumber)
+    {
+        char   buffer[26];
+        double test;
+
+        snprintf(buffer, sizeof(buffer), "%1.15g", aNumber);
+
+        // Match cJSON: fall back to 17 significant digits when 15 digits
+        // do not round-trip.
+        if (sscanf(buffer, "%lg", &test) != 1 || test != aNumber)
+        {
+            snprintf(buffer, sizeof(buffer), "%1.17g", aNumber);
+        }
+
+        mBuffer += buffer;
+    }
+
+    void PutString(const char *aString) { AppendEscaped(aString); }
+
+    std::string TakeString(void) { return std::move(mBuffer); }
+
+private:
+    void AppendTabs(size_t aCount) { mBuffer.append(aCount, '\t'); }
+
+    void AppendEscaped(const char *aString)
+    {
+        mBuffer += '"';
+        for (const char *current = aString; *current != '\0'; current++)
+        {
+            unsigned char byte = static_cast<unsigned char>(*current);
+
+            if (byte > 31 && byte != '"' && byte != '\\')
+            {
+                mBuffer += *current;
+                continue;
+            }
+
+            mBuffer += '\\';
+            switch (byte)
+            {
+            case '\\':
+                mBuffer += '\\';
+                break;
+            case '"':
+                mBuffer += '"';
+                break;
+            case '\b':
+                mBuffer += 'b';
+                break;
+            case '\f':
+                mBuffer += 'f';
+                break;
+            case '\n':
+                mBuffer += 'n';
+                break;
+            case '\r':
+                mBuffer += 'r';
+                break;
+            case '\t':
+                mBuffer += 't';
+                break;
+            default:
+                char escaped[6];
+                snprintf(escaped, sizeof(escaped), "u%04x", byte);
+                mBuffer += escaped;
+                break;
+            }
+        }
+        mBuffer += '"';
+    }
+
+    std::string       mBuffer;
+    std::vector<bool> mHasItem;
+};
+
 static cJSON *Bytes2HexJson(const uint8_t *aBytes, uint8_t aLength)
 {
     char hex[2 * aLength + 1];
@@ -110,8 +284,11 @@ static cJSON *Mode2Json(const otLinkModeConfig &aMode)
 static cJSON *IpAddr2Json(const otIp6Address &aAddress)
 {
     Ip6Address addr(aAddress.mFields.m8);
+    char       addrString[Ip6Address::kStringSize];
 
-    return cJSON_CreateString(addr.ToString().c_str());
+    addr.ToString(addrString, sizeof(addrString));
+
+    return cJSON_CreateString(addrString);
 }
 
 static cJSON *ChildTableEntry2Json(const otNetworkDiagChildEntry &aChildEntry)
@@ -204,6 +381,141 @@ static cJSON *LeaderData2Json(const otLeaderData &aLeaderData)
     return leaderData;
 }
 
+static void WriteBytesHex(JsonWriter &aWriter, const uint8_t *aBytes, uint8_t aLength)
+{
+    char hex[2 * aLength + 1];
+
+    otbr::Utils::Bytes2Hex(aBytes, aLength, hex);
+    hex[2 * aLength] = '\0';
+
+    aWriter.PutString(hex);
+}
+
+static void WriteIpAddr(JsonWriter &aWriter, const otIp6Address &aAddress)
+{
+    Ip6Address addr(aAddress.mFields.m8);
+    char       addrString[Ip6Address::kStringSize];
+
+    addr.ToString(addrString, sizeof(addrString));
+
+    aWriter.PutString(addrString);
+}
+
+static void WriteMode(JsonWriter &aWriter, const otLinkModeConfig &aMode)
+{
+    aWriter.OpenObject();
+    aWriter.Key("RxOnWhenIdle");
+    aWriter.PutNumber(aMode.mRxOnWhenIdle);
+    aWriter.Key("DeviceType");
+    aWriter.PutNumber(aMode.mDeviceType);
+    aWriter.Key("NetworkData");
+    aWriter.PutNumber(aMode.mNetworkData);
+    aWriter.CloseObject();
+}
+
+static void WriteChildTableEntry(JsonWriter &aWriter, const otNetworkDiagChildEntry &aChildEntry)
+{
+    aWriter.OpenObject();
+    aWriter.Key("ChildId");
+    aWriter.PutNumber(aChildEntry.mChildId);
+    aWriter.Key("Timeout");
+    aWriter.PutNumber(aChildEntry.mTimeout);
+    aWriter.Key("Mode");
+    WriteMode(aWriter, aChildEntry.mMode);
+    aWriter.CloseObject();
+}
+
+static void WriteMacCounters(JsonWriter &aWriter, const otNetworkDiagMacCounters &aMacCounters)
+{
+    aWriter.OpenObject();
+    aWriter.Key("IfInUnknownProtos");
+    aWriter.PutNumber(aMacCounters.mIfInUnknownProtos);
+    aWriter.Key("IfInErrors");
+    aWriter.PutNumber(aMacCounters.mIfInErrors);
+    aWriter.Key("IfOutErrors");
+    aWriter.PutNumber(aMacCounters.mIfOutErrors);
+    aWriter.Key("IfInUcastPkts");
+    aWriter.PutNumber(aMacCounters.mIfInUcastPkts);
+    aWriter.Key("IfInBroadcastPkts");
+    aWriter.PutNumber(aMacCounters.mIfInBroadcastPkts);
+    aWriter.Key("IfInDiscards");
+    aWriter.PutNumber(aMacCounters.mIfInDiscards);
+    aWriter.Key("IfOutUcastPkts");
+    aWriter.PutNumber(aMacCounters.mIfOutUcastPkts);
+    aWriter.Key("IfOutBroadcastPkts");
+    aWriter.PutNumber(aMacCounters.mIfOutBroadcastPkts);
+    aWriter.Key("IfOutDiscards");
+    aWriter.PutNumber(aMacCounters.mIfOutDiscards);
+    aWriter.CloseObject();
+}
+
+static void WriteConnectivity(JsonWriter &aWriter, const otNetworkDiagConnectivity &aConnectivity)
+{
+    aWriter.OpenObject();
+    aWriter.Key("ParentPriority");
+    aWriter.PutNumber(aConnectivity.mParentPriority);
+    aWriter.Key("LinkQuality3");
+    aWriter.PutNumber(aConnectivity.mLinkQuality3);
+    aWriter.Key("LinkQuality2");
+    aWriter.PutNumber(aConnectivity.mLinkQuality2);
+    aWriter.Key("LinkQuality1");
+    aWriter.PutNumber(aConnectivity.mLinkQuality1);
+    aWriter.Key("LeaderCost");
+    aWriter.PutNumber(aConnectivity.mLeaderCost);
+    aWriter.Key("IdSequence");
+    aWriter.PutNumber(aConnectivity.mIdSequence);
+    aWriter.Key("ActiveRouters");
+    aWriter.PutNumber(aConnectivity.mActiveRouters);
+    aWriter.Key("SedBufferSize");
+    aWriter.PutNumber(aConnectivity.mSedBufferSize);
+    aWriter.Key("SedDatagramCount");
+    aWriter.PutNumber(aConnectivity.mSedDatagramCount);
+    aWriter.CloseObject();
+}
+
+static void WriteRoute(JsonWriter &aWriter, const otNetworkDiagRoute &aRoute)
+{
+    aWriter.OpenObject();
+    aWriter.Key("IdSequence");
+    aWriter.PutNumber(aRoute.mIdSequence);
+
+    aWriter.Key("RouteData");
+    aWriter.OpenArray();
+    for (uint16_t i = 0; i < aRoute.mRouteCount; ++i)
+    {
+        aWriter.Element();
+        aWriter.OpenObject();
+        aWriter.Key("RouteId");
+        aWriter.PutNumber(aRoute.mRouteData[i].mRouterId);
+        aWriter.Key("LinkQualityOut");
+        aWriter.PutNumber(aRoute.mRouteData[i].mLinkQualityOut);
+        aWriter.Key("LinkQualityIn");
+        aWriter.PutNumber(aRoute.mRouteData[i].mLinkQualityIn);
+        aWriter.Key("RouteCost");
+        aWriter.PutNumber(aRoute.mRouteData[i].mRouteCost);
+        aWriter.CloseObject();
+    }
+    aWriter.CloseArray();
+
+    aWriter.CloseObject();
+}
+
+static void WriteLeaderData(JsonWriter &aWriter, const otLeaderData &aLeaderData)
+{
+    aWriter.OpenObject();
+    aWriter.Key("PartitionId");
+    aWriter.PutNumber(aLeaderData.mPartitionId);
+    aWriter.Key("Weighting");
+    aWriter.PutNumber(aLeaderData.mWeighting);
+    aWriter.Key("DataVersion");
+    aWriter.PutNumber(aLeaderData.mDataVersion);
+    aWriter.Key("StableDataVersion");
+    aWriter.PutNumber(aLeaderData.mStableDataVersion);
+    aWriter.Key("LeaderRouterId");
+    aWriter.PutNumber(aLeaderData.mLeaderRouterId);
+    aWriter.CloseObject();
+}
+
 std::string IpAddr2JsonString(const otIp6Address &aAddress)
 {
     std::string ret;
@@ -217,147 +529,202 @@ std::string IpAddr2JsonString(const otIp6Address &aAddress)
 
 std::string Node2JsonString(const NodeInfo &aNode)
 {
-    cJSON *     node = cJSON_CreateObject();
-    std::string ret;
-
-    cJSON_AddItemToObject(node, "State", cJSON_CreateNumber(aNode.mRole));
-    cJSON_AddItemToObject(node, "NumOfRouter", cJSON_CreateNumber(aNode.mNumOfRouter));
-    cJSON_AddItemToObject(node, "RlocAddress", IpAddr2Json(aNode.mRlocAddress));
-    cJSON_AddItemToObject(node, "ExtAddress", Bytes2HexJson(aNode.mExtAddress, OT_EXT_ADDRESS_SIZE));
-    cJSON_AddItemToObject(node, "NetworkName", cJSON_CreateString(aNode.mNetworkName.c_str()));
-    cJSON_AddItemToObject(node, "Rloc16", cJSON_CreateNumber(aNode.mRloc16));
-    cJSON_AddItemToObject(node, "LeaderData", LeaderData2Json(aNode.mLeaderData));
-    cJSON_AddItemToObject(node, "ExtPanId", Bytes2HexJson(aNode.mExtPanId, OT_EXT_PAN_ID_SIZE));
-
-    ret = Json2String(node);
-    cJSON_Delete(node);
-
-    return ret;
+    JsonWriter writer(512);
+
+    writer.OpenObject();
+    writer.Key("State");
+    writer.PutNumber(aNode.mRole);
+    writer.Key("NumOfRouter");
+    writer.PutNumber(aNode.mNumOfRouter);
+    writer.Key("RlocAddress");
+    WriteIpAddr(writer, aNode.mRlocAddress);
+    writer.Key("ExtAddress");
+    WriteBytesHex(writer, aNode.mExtAddress, OT_EXT_ADDRESS_SIZE);
+    writer.Key("NetworkName");
+    writer.PutString(aNode.mNetworkName.c_str());
+    writer.Key("Rloc16");
+    writer.PutNumber(aNode.mRloc16);
+    writer.Key("LeaderData");
+    WriteLeaderData(writer, aNode.mLeaderData);
+    writer.Key("ExtPanId");
+    WriteBytesHex(writer, aNode.mExtPanId, OT_EXT_PAN_ID_SIZE);
+    writer.CloseObject();
+
+    return writer.TakeString();
 }
 
-std::string Diag2JsonString(const std::vector<std::vector<otNetworkDiagTlv>> &aDiagSet)
+static void WriteDiagNode(JsonWriter &aWriter, const std::vector<otNetworkDiagTlv> &aDiagItem)
 {
-    cJSON *     diagInfo          = cJSON_CreateArray();
-    cJSON *     diagInfoOfOneNode = nullptr;
-    cJSON *     addrList          = nullptr;
-    cJSON *     tableList         = nullptr;
-    std::string ret;
-    uint64_t    timeout;
+    uint64_t timeout;
 
-    for (auto diagItem : aDiagSet)
+    aWriter.OpenObject();
+    for (const auto &diagTlv : aDiagItem)
     {
-        diagInfoOfOneNode = cJSON_CreateObject();
-        for (auto diagTlv : diagItem)
+        switch (diagTlv.mType)
         {
-            switch (diagTlv.mType)
-            {
-            case OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS:
+        case OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS:
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "ExtAddress",
-                                      Bytes2HexJson(diagTlv.mData.mExtAddress.m8, OT_EXT_ADDRESS_SIZE));
+            aWriter.Key("ExtAddress");
+            WriteBytesHex(aWriter, diagTlv.mData.mExtAddress.m8, OT_EXT_ADDRESS_SIZE);
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS:
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS:
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "Rloc16", cJSON_CreateNumber(diagTlv.mData.mAddr16));
+            aWriter.Key("Rloc16");
+            aWriter.PutNumber(diagTlv.mData.mAddr16);
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_MODE:
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_MODE:
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "Mode", Mode2Json(diagTlv.mData.mMode));
+            aWriter.Key("Mode");
+            WriteMode(aWriter, diagTlv.mData.mMode);
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_TIMEOUT:
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_TIMEOUT:
 
-                timeout = static_cast<uint64_t>(diagTlv.mData.mTimeout);
-                cJSON_AddItemToObject(diagInfoOfOneNode, "Timeout", cJSON_CreateNumber(timeout));
+            timeout = static_cast<uint64_t>(diagTlv.mData.mTimeout);
+            aWriter.Key("Timeout");
+            aWriter.PutNumber(timeout);
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_CONNECTIVITY:
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_CONNECTIVITY:
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "Connectivity",
-                                      Connectivity2Json(diagTlv.mData.mConnectivity));
+            aWriter.Key("Connectivity");
+            WriteConnectivity(aWriter, diagTlv.mData.mConnectivity);
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_ROUTE:
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_ROUTE:
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "Route", Route2Json(diagTlv.mData.mRoute));
+            aWriter.Key("Route");
+            WriteRoute(aWriter, diagTlv.mData.mRoute);
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_LEADER_DATA:
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_LEADER_DATA:
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "LeaderData", LeaderData2Json(diagTlv.mData.mLeaderData));
+            aWriter.Key("LeaderData");
+            WriteLeaderData(aWriter, diagTlv.mData.mLeaderData);
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_NETWORK_DATA:
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_NETWORK_DATA:
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "NetworkData",
-                                      Bytes2HexJson(diagTlv.mData.mNetworkData.m8, diagTlv.mData.mNetworkData.mCount));
+            aWriter.Key("NetworkData");
+            WriteBytesHex(aWriter, diagTlv.mData.mNetworkData.m8, diagTlv.mData.mNetworkData.mCount);
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_IP6_ADDR_LIST:
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_IP6_ADDR_LIST:
 
-                addrList = cJSON_CreateArray();
+            aWriter.Key("IP6AddressList");
+            aWriter.OpenArray();
 
-                for (uint16_t i = 0; i < diagTlv.mData.mIp6AddrList.mCount; ++i)
-                {
-                    cJSON_AddItemToArray(addrList, IpAddr2Json(diagTlv.mData.mIp6AddrList.mList[i]));
-                }
-                cJSON_AddItemToObject(diagInfoOfOneNode, "IP6AddressList", addrList);
+            for (uint16_t i = 0; i < diagTlv.mData.mIp6AddrList.mCount; ++i)
+            {
+                aWriter.Element();
+                WriteIpAddr(aWriter, diagTlv.mData.mIp6AddrList.mList[i]);
+            }
+            aWriter.CloseArray();
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_MAC_COUNTERS:
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_MAC_COUNTERS:
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "MACCounters", MacCounters2Json(diagTlv.mData.mMacCounters));
+            aWriter.Key("MACCounters");
+            WriteMacCounters(aWriter, diagTlv.mData.mMacCounters);
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_BATTERY_LEVEL:
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_BATTERY_LEVEL:
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "BatteryLevel",
-                                      cJSON_CreateNumber(diagTlv.mData.mBatteryLevel));
+            aWriter.Key("BatteryLevel");
+            aWriter.PutNumber(diagTlv.mData.mBatteryLevel);
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_SUPPLY_VOLTAGE:
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_SUPPLY_VOLTAGE:
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "SupplyVoltage",
-                                      cJSON_CreateNumber(diagTlv.mData.mSupplyVoltage));
+            aWriter.Key("SupplyVoltage");
+            aWriter.PutNumber(diagTlv.mData.mSupplyVoltage);
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE:
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE:
 
-                tableList = cJSON_CreateArray();
+            aWriter.Key("ChildTable");
+            aWriter.OpenArray();
 
-                for (uint16_t i = 0; i < diagTlv.mData.mChildTable.mCount; ++i)
-                {
-                    cJSON_AddItemToArray(tableList, ChildTableEntry2Json(diagTlv.mData.mChildTable.mTable[i]));
-                }
+            for (uint16_t i = 0; i < diagTlv.mData.mChildTable.mCount; ++i)
+            {
+                aWriter.Element();
+                WriteChildTableEntry(aWriter, diagTlv.mData.mChildTable.mTable[i]);
+            }
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "ChildTable", tableList);
+            aWriter.CloseArray();
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_CHANNEL_PAGES:
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_CHANNEL_PAGES:
 
-                cJSON_AddItemToObject(
-                    diagInfoOfOneNode, "ChannelPages",
-                    Bytes2HexJson(diagTlv.mData.mChannelPages.m8, diagTlv.mData.mChannelPages.mCount));
+            aWriter.Key("ChannelPages");
+            WriteBytesHex(aWriter, diagTlv.mData.mChannelPages.m8, diagTlv.mData.mChannelPages.mCount);
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_MAX_CHILD_TIMEOUT:
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_MAX_CHILD_TIMEOUT:
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "MaxChildTimeout",
-                                      cJSON_CreateNumber(diagTlv.mData.mMaxChildTimeout));
+            aWriter.Key("MaxChildTimeout");
+            aWriter.PutNumber(diagTlv.mData.mMaxChildTimeout);
 
-                break;
-            default:
-                break;
-            }
+            break;
+        default:
+            break;
         }
-        cJSON_AddItemToArray(diagInfo, diagInfoOfOneNode);
     }
+    aWriter.CloseObject();
+}
+
+std::string Diag2JsonString(const std::vector<std::vector<otNetworkDiagTlv>> &aDiagSet)
+{
+    JsonWriter writer(aDiagSet.size() * 1024 + 16);
+
+    writer.OpenArray();
+
+    for (const auto &diagItem : aDiagSet)
+    {
+        writer.Element();
+        WriteDiagNode(writer, diagItem);
+    }
+
+    writer.CloseArray();
 
-    ret = Json2String(diagInfo);
+    return writer.TakeString();
+}
+
+std::string DiagNode2JsonString(const std::vector<otNetworkDiagTlv> &aDiagContent)
+{
+    // Render the node at the depth it takes inside the diagnostic array.
+    JsonWriter writer(1024, 1);
+
+    WriteDiagNode(writer, aDiagContent);
+
+    return writer.TakeString();
+}
+
+std::string Diag2JsonString(const std::vector<std::string> &aDiagJsonSet)
+{
+    std::string ret;
+    size_t      capacity = 2;
+
+    for (const std::string &node : aDiagJsonSet)
+    {
+        capacity += node.size() + 2;
+    }
+
+    ret.reserve(capacity);
+    ret += '[';
+
+    for (const std::string &node : aDiagJsonSet)
+    {
+        if (ret.size() > 1)
+        {
+            ret += ", ";
+        }
+        ret += node;
+    }
 
-    cJSON_Delete(diagInfo);
+    ret += ']';
 
     return ret;
 }
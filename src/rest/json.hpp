@@ -110,6 +110,27 @@ std::string Node2JsonString(const NodeInfo &aNode);
  */
 std::string Diag2JsonString(const std::vector<std::vector<otNetworkDiagTlv>> &aDiagSet);
 
+/**
+ * This method formats the diagnostic TLVs of one node to a Json object serialized for use inside a diagnostic
+ * array, so per-node results can be cached and reassembled without re-serializing unchanged nodes.
+ *
+ * @param[in] aDiagContent  A vector of diagnostic TLVs of one node.
+ *
+ * @returns A string of the serialized Json object of the node.
+ *
+ */
+std::string DiagNode2JsonString(const std::vector<otNetworkDiagTlv> &aDiagContent);
+
+/**
+ * This method assembles pre-serialized per-node diagnostic Json objects to a Json array.
+ *
+ * @param[in] aDiagJsonSet  A vector of serialized per-node Json objects.
+ *
+ * @returns A string of serialized Json array.
+ *
+ */
+std::string Diag2JsonString(const std::vector<std::string> &aDiagJsonSet);
+
 /**
  * This method formats an Ipv6Address to a Json string and serialize it to a string.
  *
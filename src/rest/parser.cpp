@@ -28,6 +28,8 @@
 
 #include "rest/parser.hpp"
 
+#include <limits.h>
+
 #include <string>
 #include <vector>
 
@@ -64,6 +66,10 @@ static int OnMessageComplete(http_parser *parser)
 
     request->SetReadComplete();
 
+    // Pause the parser at the request boundary so pipelined data that
+    // belongs to the next request is not consumed yet.
+    http_parser_pause(parser, 1);
+
     return 0;
 }
 
@@ -79,6 +85,38 @@ static int OnHeaderComplete(http_parser *parser)
 {
     Request *request = reinterpret_cast<Request *>(parser->data);
     request->SetMethod(parser->method);
+
+    // The announced body size is known here; forward it so the request can
+    // size its body buffer in one step before the body callbacks start.
+    if (parser->content_length != ULLONG_MAX)
+    {
+        request->SetContentLength(static_cast<size_t>(parser->content_length));
+    }
+
+    return 0;
+}
+
+static int OnHeaderField(http_parser *parser, const char *at, size_t len)
+{
+    Request *request = reinterpret_cast<Request *>(parser->data);
+
+    if (len > 0)
+    {
+        request->AddHeaderField(at, len);
+    }
+
+    return 0;
+}
+
+static int OnHeaderValue(http_parser *parser, const char *at, size_t len)
+{
+    Request *request = reinterpret_cast<Request *>(parser->data);
+
+    if (len > 0)
+    {
+        request->AddHeaderValue(at, len);
+    }
+
     return 0;
 }
 
@@ -97,17 +135,27 @@ void Parser::Init(void)
     mSettings.on_message_begin    = OnMessageBegin;
     mSettings.on_url              = OnUrl;
     mSettings.on_status           = OnHandlerData;
-    mSettings.on_header_field     = OnHandlerData;
-    mSettings.on_header_value     = OnHandlerData;
+    mSettings.on_header_field     = OnHeaderField;
+    mSettings.on_header_value     = OnHeaderValue;
     mSettings.on_body             = OnBody;
     mSettings.on_headers_complete = OnHeaderComplete;
     mSettings.on_message_complete = OnMessageComplete;
     http_parser_init(&mParser, HTTP_REQUEST);
 }
 
-void Parser::Process(const char *aBuf, size_t aLength)
+size_t Parser::Process(const char *aBuf, size_t aLength)
+{
+    if (HTTP_PARSER_ERRNO(&mParser) == HPE_PAUSED)
+    {
+        http_parser_pause(&mParser, 0);
+    }
+
+    return http_parser_execute(&mParser, &mSettings, aBuf, aLength);
+}
+
+bool Parser::ShouldKeepAlive(void) const
 {
-    http_parser_execute(&mParser, &mSettings, aBuf, aLength);
+    return http_should_keep_alive(&mParser) != 0;
 }
 
 } // namespace rest
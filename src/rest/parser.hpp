@@ -71,11 +71,26 @@ public:
     /**
      * This method performs a parse process.
      *
+     * The parser stops at the end of a request, so pipelined data beyond the
+     * current request is left unconsumed for the caller to keep.
+     *
      * @param[in] aBuf     A pointer pointing to read buffer.
      * @param[in] aLength  An integer indicates how much data is to be processed by parser.
      *
+     * @returns The number of bytes consumed by the parser.
+     *
+     */
+    size_t Process(const char *aBuf, size_t aLength);
+
+    /**
+     * This method indicates whether the parsed request allows the connection
+     * to be reused for a subsequent request.
+     *
+     * @retval TRUE   The connection could serve another request (HTTP keep-alive).
+     * @retval FALSE  The connection should be closed after the response.
+     *
      */
-    void Process(const char *aBuf, size_t aLength);
+    bool ShouldKeepAlive(void) const;
 
 private:
     http_parser          mParser;
@@ -28,27 +28,106 @@
 
 #include "rest/request.hpp"
 
+#include <strings.h>
+
 namespace otbr {
 namespace rest {
 
+// Typical sizes pre-reserved so parsing common requests does not grow the
+// buffers one callback at a time.
+static const size_t kUrlReserve    = 128;
+static const size_t kBodyReserve   = 256;
+static const size_t kHeaderReserve = 8;
+
+// Upper bound on the body capacity reserved from the announced
+// content-length; larger bodies fall back to amortized growth.
+static const size_t kBodyReserveMax = 64 * 1024;
+
 Request::Request(void)
     : mComplete(false)
 {
+    mUrl.reserve(kUrlReserve);
+    mBody.reserve(kBodyReserve);
+    mHeaderField.reserve(kHeaderReserve);
+    mHeaderValue.reserve(kHeaderReserve);
+}
+
+void Request::Reset(void)
+{
+    mMethod        = 0;
+    mContentLength = 0;
+    mComplete      = false;
+    // clear() keeps the capacity the buffers have already grown to.
+    mUrl.clear();
+    mBody.clear();
+    mHeaderField.clear();
+    mHeaderValue.clear();
+}
+
+void Request::AddHeaderField(const char *aString, size_t aLength)
+{
+    // A new field starts when the previous field already has its value;
+    // otherwise this chunk continues the field name.
+    if (mHeaderField.size() == mHeaderValue.size())
+    {
+        mHeaderField.emplace_back(aString, aLength);
+    }
+    else
+    {
+        mHeaderField.back().append(aString, aLength);
+    }
+}
+
+void Request::AddHeaderValue(const char *aString, size_t aLength)
+{
+    if (mHeaderValue.size() < mHeaderField.size())
+    {
+        mHeaderValue.emplace_back(aString, aLength);
+    }
+    else
+    {
+        mHeaderValue.back().append(aString, aLength);
+    }
+}
+
+std::string Request::GetHeaderValue(const std::string &aField) const
+{
+    std::string value;
+
+    for (size_t i = 0; i < mHeaderValue.size(); ++i)
+    {
+        if (strcasecmp(mHeaderField[i].c_str(), aField.c_str()) == 0)
+        {
+            value = mHeaderValue[i];
+            break;
+        }
+    }
+
+    return value;
 }
 
 void Request::SetUrl(const char *aString, size_t aLength)
 {
-    mUrl += std::string(aString, aLength);
+    mUrl.append(aString, aLength);
 }
 
 void Request::SetBody(const char *aString, size_t aLength)
 {
-    mBody += std::string(aString, aLength);
+    mBody.append(aString, aLength);
 }
 
 void Request::SetContentLength(size_t aContentLength)
 {
     mContentLength = aContentLength;
+
+    // The announced body size is known before the first body byte arrives:
+    // grow the buffer once here so a large upload does not reallocate it
+    // chunk by chunk. Oversized announcements are clamped so a hostile
+    // Content-Length cannot reserve arbitrary memory up front.
+    if (aContentLength > mBody.capacity())
+    {
+        mBody.reserve(aContentLength < kBodyReserveMax ? aContentLength : kBodyReserveMax);
+    }
 }
 
 void Request::SetMethod(int32_t aMethod)
@@ -66,6 +145,33 @@ std::string Request::GetBody() const
     return mBody;
 }
 
+const char *Request::GetPath(size_t &aLength) const
+{
+    const char *path   = mUrl.data();
+    size_t      length = mUrl.size();
+    size_t      urlEnd = mUrl.find('?');
+
+    if (urlEnd != std::string::npos)
+    {
+        length = urlEnd;
+    }
+
+    while (length > 0 && path[length - 1] == '/')
+    {
+        length--;
+    }
+
+    if (length == 0)
+    {
+        path   = "/";
+        length = 1;
+    }
+
+    aLength = length;
+
+    return path;
+}
+
 std::string Request::GetUrl(void) const
 {
     std::string url = mUrl;
@@ -87,6 +193,38 @@ exit:
     return url;
 }
 
+std::string Request::GetQueryParameter(const std::string &aName) const
+{
+    std::string value;
+    size_t      queryStart = mUrl.find('?');
+    size_t      pos;
+
+    VerifyOrExit(queryStart != std::string::npos);
+
+    pos = queryStart + 1;
+    while (pos < mUrl.size())
+    {
+        size_t end = mUrl.find('&', pos);
+
+        if (end == std::string::npos)
+        {
+            end = mUrl.size();
+        }
+
+        if (pos + aName.size() < end && mUrl.compare(pos, aName.size(), aName) == 0 &&
+            mUrl[pos + aName.size()] == '=')
+        {
+            value = mUrl.substr(pos + aName.size() + 1, end - (pos + aName.size() + 1));
+            break;
+        }
+
+        pos = end + 1;
+    }
+
+exit:
+    return value;
+}
+
 void Request::SetReadComplete(void)
 {
     mComplete = true;
@@ -95,6 +233,8 @@ void Request::SetReadComplete(void)
 void Request::ResetReadComplete(void)
 {
     mComplete = false;
+    mHeaderField.clear();
+    mHeaderValue.clear();
 }
 
 bool Request::IsComplete(void) const
@@ -37,6 +37,8 @@
 #include <string>
 #include <vector>
 
+#include <vector>
+
 #include "common/code_utils.hpp"
 #include "rest/types.hpp"
 
@@ -74,6 +76,26 @@ public:
      */
     void SetBody(const char *aString, size_t aLength);
 
+    /**
+     * This method appends a chunk of a header field name of a request; the
+     * parser may deliver one name in several chunks.
+     *
+     * @param[in] aString  A pointer points to the header field name chunk.
+     * @param[in] aLength  Length of the chunk.
+     *
+     */
+    void AddHeaderField(const char *aString, size_t aLength);
+
+    /**
+     * This method appends a chunk of a header value of a request; the parser
+     * may deliver one value in several chunks.
+     *
+     * @param[in] aString  A pointer points to the header value chunk.
+     * @param[in] aLength  Length of the chunk.
+     *
+     */
+    void AddHeaderValue(const char *aString, size_t aLength);
+
     /**
      * This method sets the content-length field of a request.
      *
@@ -102,6 +124,14 @@ public:
      */
     void ResetReadComplete(void);
 
+    /**
+     * This method resets the request to its initial state while keeping the
+     * buffers already grown, so a reused connection parses its next request
+     * without reallocating.
+     *
+     */
+    void Reset(void);
+
     /**
      * This method returns the HTTP method of this request.
      *
@@ -123,6 +153,36 @@ public:
      */
     std::string GetUrl(void) const;
 
+    /**
+     * This method returns the request path — the url without the query
+     * string or trailing slashes — without constructing a string.
+     *
+     * @param[out] aLength  The length of the path.
+     *
+     * @returns A pointer into the url buffer, valid until the request is
+     *          modified, or a literal "/" when the path is empty.
+     */
+    const char *GetPath(size_t &aLength) const;
+
+    /**
+     * This method returns the value of a header of this request; the field
+     * name is matched case-insensitively.
+     *
+     * @param[in] aField  The name of the header field.
+     *
+     * @returns A string contains the header value, empty when the header is not present.
+     */
+    std::string GetHeaderValue(const std::string &aField) const;
+
+    /**
+     * This method returns the value of a query parameter of this request.
+     *
+     * @param[in] aName  The name of the query parameter.
+     *
+     * @returns A string contains the parameter value, empty when the parameter is not present.
+     */
+    std::string GetQueryParameter(const std::string &aName) const;
+
     /**
      * This method indicates whether this request is parsed completely.
      *
@@ -131,11 +191,13 @@ public:
     bool IsComplete(void) const;
 
 private:
-    int32_t     mMethod;
-    size_t      mContentLength;
-    std::string mUrl;
-    std::string mBody;
-    bool        mComplete;
+    int32_t                  mMethod;
+    size_t                   mContentLength;
+    std::string              mUrl;
+    std::string              mBody;
+    std::vector<std::string> mHeaderField;
+    std::vector<std::string> mHeaderValue;
+    bool                     mComplete;
 };
 
 } // namespace rest
@@ -30,12 +30,21 @@
 
 #include "rest/resource.hpp"
 
+#include "common/alloc_tracker.hpp"
+#include "common/metrics.hpp"
+#include "common/tracing.hpp"
+#include "rest/cbor.hpp"
+
+#include "ctype.h"
+#include "inttypes.h"
+#include "stdlib.h"
 #include "string.h"
 
 #define OT_PSKC_MAX_LENGTH 16
 #define OT_EXTENDED_PANID_LENGTH 8
 
 #define OT_REST_RESOURCE_PATH_DIAGNOETIC "/diagnostics"
+#define OT_REST_RESOURCE_PATH_DIAGNOETIC_DELTA "/diagnostics/delta"
 #define OT_REST_RESOURCE_PATH_NODE "/node"
 #define OT_REST_RESOURCE_PATH_NODE_RLOC "/node/rloc"
 #define OT_REST_RESOURCE_PATH_NODE_RLOC16 "/node/rloc16"
@@ -49,8 +58,13 @@
 #define OT_REST_RESOURCE_PATH_NETWORK_CURRENT "/networks/current"
 #define OT_REST_RESOURCE_PATH_NETWORK_CURRENT_COMMISSION "/networks/commission"
 #define OT_REST_RESOURCE_PATH_NETWORK_CURRENT_PREFIX "/networks/current/prefix"
+#define OT_REST_RESOURCE_PATH_METRICS "/metrics"
+
+#define OT_REST_CONTENT_TYPE_CBOR "application/cbor"
+#define OT_REST_CONTENT_TYPE_PROMETHEUS "text/plain; version=0.0.4"
 
 #define OT_REST_HTTP_STATUS_200 "200 OK"
+#define OT_REST_HTTP_STATUS_304 "304 Not Modified"
 #define OT_REST_HTTP_STATUS_404 "404 Not Found"
 #define OT_REST_HTTP_STATUS_405 "405 Method Not Allowed"
 #define OT_REST_HTTP_STATUS_408 "408 Request Timeout"
@@ -66,6 +80,9 @@ using std::placeholders::_2;
 namespace otbr {
 namespace rest {
 
+// Allocation tag attributing request handling and JSON serialization to REST.
+static const uint8_t kAllocTag = AllocTracker::GetInstance().RegisterTag("rest");
+
 // MulticastAddr
 static const char *kMulticastAddrAllRouters = "ff03::2";
 
@@ -75,9 +92,37 @@ static const uint8_t kAllTlvTypes[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 14, 15, 16,
 // Timeout (in Microseconds) for deleting outdated diagnostics
 static const uint32_t kDiagResetTimeout = 3000000;
 
+// Duration (in Microseconds) of one slot of the diagnostic expiry wheel
+static const uint32_t kDiagWheelSlotDuration = 500000;
+
+// Number of slots of the diagnostic expiry wheel, covering the reset timeout
+static const uint32_t kDiagWheelSlotNum = kDiagResetTimeout / kDiagWheelSlotDuration + 2;
+
 // Timeout (in Microseconds) for collecting diagnostics
 static const uint32_t kDiagCollectTimeout = 2000000;
 
+// Default freshness window (in Microseconds) within which diagnostic
+// requests share one collection; overridable with the "maxAge" query
+// parameter (in seconds).
+static const uint32_t kDiagMaxAgeDefault = 2000000;
+
+// Timeout (in Microseconds) after which a delta long-poll completes with an
+// empty delta; kept below the connection callback timeout so the poll ends
+// with 200 rather than an error.
+static const uint32_t kDiagDeltaPollTimeout = 8000000;
+
+// Latency budget (in Microseconds) above which a request is logged as slow
+static const uint32_t kSlowRequestBudget = 10000;
+
+// Minimum interval (in Microseconds) between slow-request logs; over-budget
+// requests in between are only counted and reported with the next log
+static const uint32_t kSlowRequestLogInterval = 1000000;
+
+static bool AcceptsCbor(const Request &aRequest)
+{
+    return aRequest.GetHeaderValue("Accept").find(OT_REST_CONTENT_TYPE_CBOR) != std::string::npos;
+}
+
 static std::string GetHttpStatus(HttpStatusCode aErrorCode)
 {
     std::string httpStatus;
@@ -87,6 +132,9 @@ static std::string GetHttpStatus(HttpStatusCode aErrorCode)
     case HttpStatusCode::kStatusOk:
         httpStatus = OT_REST_HTTP_STATUS_200;
         break;
+    case HttpStatusCode::kStatusNotModified:
+        httpStatus = OT_REST_HTTP_STATUS_304;
+        break;
     case HttpStatusCode::kStatusResourceNotFound:
         httpStatus = OT_REST_HTTP_STATUS_404;
         break;
@@ -107,37 +155,185 @@ static std::string GetHttpStatus(HttpStatusCode aErrorCode)
 Resource::Resource(ControllerOpenThread *aNcp)
     : mInstance(nullptr)
     , mNcp(aNcp)
+    , mWorkerPool(nullptr)
+    , mDiagWheel(kDiagWheelSlotNum)
+    , mDiagWheelTick(0)
+    , mDiagCollectValid(false)
+    , mDiagVersion(0)
+    , mNodeInfoJsonValid(false)
+    , mExtAddrJsonValid(false)
+    , mNetworkNameJsonValid(false)
 {
-    // Resource Handler
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_DIAGNOETIC, &Resource::Diagnostic);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE, &Resource::NodeInfo);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_STATE, &Resource::State);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_EXTADDRESS, &Resource::ExtendedAddr);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_NETWORKNAME, &Resource::NetworkName);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_RLOC16, &Resource::Rloc16);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_LEADERDATA, &Resource::LeaderData);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_NUMOFROUTER, &Resource::NumOfRoute);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_EXTPANID, &Resource::ExtendedPanId);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_RLOC, &Resource::Rloc);
-
-    // Resource callback handler
-    mResourceCallbackMap.emplace(OT_REST_RESOURCE_PATH_DIAGNOETIC, &Resource::HandleDiagnosticCallback);
 }
 
 void Resource::Init(void)
 {
     mInstance = mNcp->GetThreadHelper()->GetInstance();
+
+    // Invalidate the cached /node document when a field it serializes may
+    // have changed. The router count has no dedicated flag; it is refreshed
+    // on the next flagged change (role, partition or network data).
+    mNcp->AddThreadStateChangedCallback([this](otChangedFlags aFlags) {
+        constexpr otChangedFlags kNodeInfoFlags = OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_PARTITION_ID |
+                                                  OT_CHANGED_THREAD_NETDATA | OT_CHANGED_THREAD_NETWORK_NAME |
+                                                  OT_CHANGED_THREAD_EXT_PANID | OT_CHANGED_THREAD_RLOC_ADDED |
+                                                  OT_CHANGED_THREAD_RLOC_REMOVED | OT_CHANGED_THREAD_ML_ADDR;
+
+        if ((aFlags & kNodeInfoFlags) != 0)
+        {
+            mNodeInfoJsonValid = false;
+        }
+
+        if ((aFlags & OT_CHANGED_THREAD_NETWORK_NAME) != 0)
+        {
+            PreRenderInvariantBodies();
+        }
+    });
+
+    // Dataset updates are the only runtime path that moves these values;
+    // re-rendering here keeps their GETs a buffer copy at any poll rate.
+    mNcp->GetThreadHelper()->AddActiveDatasetChangeHandler(
+        [this](const otOperationalDatasetTlvs &) { PreRenderInvariantBodies(); });
+
+    PreRenderInvariantBodies();
+}
+
+void Resource::PreRenderInvariantBodies(void) const
+{
+    const uint8_t *extAddress = reinterpret_cast<const uint8_t *>(otLinkGetExtendedAddress(mInstance));
+
+    mExtAddrJson          = Json::Bytes2HexJsonString(extAddress, OT_EXT_ADDRESS_SIZE);
+    mExtAddrJsonValid     = true;
+    mNetworkNameJson      = Json::String2JsonString(otThreadGetNetworkName(mInstance));
+    mNetworkNameJsonValid = true;
+}
+
+void Resource::SetWorkerPool(WorkerPool *aWorkerPool, std::function<void(void)> aNotify)
+{
+    mWorkerPool   = aWorkerPool;
+    mWorkerNotify = std::move(aNotify);
+}
+
+// Converts an endpoint path into a Prometheus metric name prefix, e.g.
+// "/node/state" becomes "otbr_rest_node_state".
+static std::string MetricNameForPath(const char *aPath)
+{
+    std::string name = "otbr_rest";
+
+    for (const char *c = aPath; *c != '\0'; c++)
+    {
+        name.push_back(isalnum(static_cast<unsigned char>(*c)) ? *c : '_');
+    }
+
+    return name;
+}
+
+static void LogSlowRequest(const char *aUrl, const char *aPhase, uint64_t aLatency)
+{
+    static steady_clock::time_point sLastLogTime;
+    static uint64_t                 sSuppressed = 0;
+
+    steady_clock::time_point now = steady_clock::now();
+
+    if (sLastLogTime != steady_clock::time_point() &&
+        duration_cast<microseconds>(now - sLastLogTime).count() < kSlowRequestLogInterval)
+    {
+        sSuppressed++;
+        ExitNow();
+    }
+
+    otbrLogWarning("slow REST request: url=%s phase=%s latency=%" PRIu64 "us (%" PRIu64 " more suppressed)", aUrl,
+                   aPhase, aLatency, sSuppressed);
+    sLastLogTime = now;
+    sSuppressed  = 0;
+
+exit:
+    return;
+}
+
+Resource::Endpoint *Resource::FindEndpoint(const char *aPath, size_t aLength)
+{
+    // Fixed endpoint table replacing the per-instance hash maps: the length
+    // comparison rejects almost every entry before a memcmp runs, and no
+    // string copy or hash of the URL is computed per request.
+    static Endpoint sEndpoints[] = {
+        {OT_REST_RESOURCE_PATH_DIAGNOETIC, sizeof(OT_REST_RESOURCE_PATH_DIAGNOETIC) - 1, &Resource::Diagnostic,
+         &Resource::HandleDiagnosticCallback, nullptr, nullptr},
+        {OT_REST_RESOURCE_PATH_DIAGNOETIC_DELTA, sizeof(OT_REST_RESOURCE_PATH_DIAGNOETIC_DELTA) - 1,
+         &Resource::DiagnosticDelta, &Resource::HandleDiagnosticDeltaCallback, nullptr, nullptr},
+        {OT_REST_RESOURCE_PATH_NODE, sizeof(OT_REST_RESOURCE_PATH_NODE) - 1, &Resource::NodeInfo, nullptr, nullptr,
+         nullptr},
+        {OT_REST_RESOURCE_PATH_NODE_STATE, sizeof(OT_REST_RESOURCE_PATH_NODE_STATE) - 1, &Resource::State, nullptr,
+         nullptr, nullptr},
+        {OT_REST_RESOURCE_PATH_NODE_EXTADDRESS, sizeof(OT_REST_RESOURCE_PATH_NODE_EXTADDRESS) - 1,
+         &Resource::ExtendedAddr, nullptr, nullptr, nullptr},
+        {OT_REST_RESOURCE_PATH_NODE_NETWORKNAME, sizeof(OT_REST_RESOURCE_PATH_NODE_NETWORKNAME) - 1,
+         &Resource::NetworkName, nullptr, nullptr, nullptr},
+        {OT_REST_RESOURCE_PATH_NODE_RLOC16, sizeof(OT_REST_RESOURCE_PATH_NODE_RLOC16) - 1, &Resource::Rloc16, nullptr,
+         nullptr, nullptr},
+        {OT_REST_RESOURCE_PATH_NODE_LEADERDATA, sizeof(OT_REST_RESOURCE_PATH_NODE_LEADERDATA) - 1,
+         &Resource::LeaderData, nullptr, nullptr, nullptr},
+        {OT_REST_RESOURCE_PATH_NODE_NUMOFROUTER, sizeof(OT_REST_RESOURCE_PATH_NODE_NUMOFROUTER) - 1,
+         &Resource::NumOfRoute, nullptr, nullptr, nullptr},
+        {OT_REST_RESOURCE_PATH_NODE_EXTPANID, sizeof(OT_REST_RESOURCE_PATH_NODE_EXTPANID) - 1, &Resource::ExtendedPanId,
+         nullptr, nullptr, nullptr},
+        {OT_REST_RESOURCE_PATH_NODE_RLOC, sizeof(OT_REST_RESOURCE_PATH_NODE_RLOC) - 1, &Resource::Rloc, nullptr,
+         nullptr, nullptr},
+        {OT_REST_RESOURCE_PATH_METRICS, sizeof(OT_REST_RESOURCE_PATH_METRICS) - 1, &Resource::PrometheusMetrics,
+         nullptr, nullptr, nullptr},
+    };
+
+    Endpoint *found = nullptr;
+
+    for (Endpoint &endpoint : sEndpoints)
+    {
+        if (endpoint.mLength == aLength && memcmp(endpoint.mPath, aPath, aLength) == 0)
+        {
+            found = &endpoint;
+            break;
+        }
+    }
+
+    return found;
+}
+
+void Resource::EnsureEndpointMetrics(Endpoint &aEndpoint)
+{
+    if (aEndpoint.mRequests == nullptr)
+    {
+        std::string name = MetricNameForPath(aEndpoint.mPath);
+
+        aEndpoint.mRequests = &Metrics::GetInstance().RegisterCounter(
+            name + "_requests_total", std::string("Number of REST requests served for ") + aEndpoint.mPath + ".");
+        aEndpoint.mLatency = &Metrics::GetInstance().RegisterHistogram(
+            name + "_latency_usec", std::string("Handling latency in microseconds for ") + aEndpoint.mPath + ".");
+    }
 }
 
 void Resource::Handle(Request &aRequest, Response &aResponse) const
 {
-    std::string url = aRequest.GetUrl();
-    auto        it  = mResourceMap.find(url);
+    Tracer::Scope          scope("rest", "Handle");
+    AllocTracker::TagScope allocScope(kAllocTag);
+    size_t                 length;
+    const char *           path     = aRequest.GetPath(length);
+    Endpoint *             endpoint = FindEndpoint(path, length);
 
-    if (it != mResourceMap.end())
+    if (endpoint != nullptr)
     {
-        ResourceHandler resourceHandler = it->second;
-        (this->*resourceHandler)(aRequest, aResponse);
+        steady_clock::time_point start = steady_clock::now();
+        uint64_t                 latency;
+
+        (this->*endpoint->mHandler)(aRequest, aResponse);
+
+        latency = static_cast<uint64_t>(duration_cast<microseconds>(steady_clock::now() - start).count());
+        EnsureEndpointMetrics(*endpoint);
+        endpoint->mRequests->Increment();
+        endpoint->mLatency->Observe(latency);
+
+        if (latency >= kSlowRequestBudget)
+        {
+            LogSlowRequest(endpoint->mPath, "handle", latency);
+        }
     }
     else
     {
@@ -147,39 +343,91 @@ void Resource::Handle(Request &aRequest, Response &aResponse) const
 
 void Resource::HandleCallback(Request &aRequest, Response &aResponse)
 {
-    std::string url = aRequest.GetUrl();
-    auto        it  = mResourceCallbackMap.find(url);
+    Tracer::Scope          scope("rest", "HandleCallback");
+    AllocTracker::TagScope allocScope(kAllocTag);
+    size_t                 length;
+    const char *           path     = aRequest.GetPath(length);
+    Endpoint *             endpoint = FindEndpoint(path, length);
 
-    if (it != mResourceCallbackMap.end())
+    if (endpoint != nullptr && endpoint->mCallbackHandler != nullptr)
     {
-        ResourceCallbackHandler resourceHandler = it->second;
-        (this->*resourceHandler)(aRequest, aResponse);
+        steady_clock::time_point start = steady_clock::now();
+        uint64_t                 latency;
+
+        (this->*endpoint->mCallbackHandler)(aRequest, aResponse);
+
+        latency = static_cast<uint64_t>(duration_cast<microseconds>(steady_clock::now() - start).count());
+        EnsureEndpointMetrics(*endpoint);
+        endpoint->mLatency->Observe(latency);
+
+        if (latency >= kSlowRequestBudget)
+        {
+            LogSlowRequest(endpoint->mPath, "callback", latency);
+        }
     }
 }
 
 void Resource::HandleDiagnosticCallback(const Request &aRequest, Response &aResponse)
 {
-    OT_UNUSED_VARIABLE(aRequest);
-    std::vector<std::vector<otNetworkDiagTlv>> diagContentSet;
-    std::string                                body;
-    std::string                                errorCode;
+    std::string body;
+    std::string errorCode;
 
     auto duration = duration_cast<microseconds>(steady_clock::now() - aResponse.GetStartTime()).count();
     if (duration >= kDiagCollectTimeout)
     {
         DeleteOutDatedDiagnostic();
 
-        for (auto it = mDiagSet.begin(); it != mDiagSet.end(); ++it)
+        errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+        aResponse.SetResponsCode(errorCode);
+
+        if (AcceptsCbor(aRequest))
         {
-            diagContentSet.push_back(it->second.mDiagContent);
+            std::vector<std::vector<otNetworkDiagTlv>> diagContentSet;
+
+            diagContentSet.reserve(mDiagSet.size());
+            for (auto it = mDiagSet.begin(); it != mDiagSet.end(); ++it)
+            {
+                diagContentSet.push_back(it->second.mDiagContent);
+            }
+
+            aResponse.SetContentType(OT_REST_CONTENT_TYPE_CBOR);
+
+            if (mWorkerPool != nullptr)
+            {
+                // Serialize the snapshot off the mainloop; the connection
+                // adopts the body once the worker is done.
+                DeferBody(aResponse,
+                          [diagContentSet](void) { return Cbor::Diag2CborString(diagContentSet); });
+                ExitNow();
+            }
+
+            body = Cbor::Diag2CborString(diagContentSet);
+        }
+        else
+        {
+            std::vector<std::string> diagJsonSet;
+
+            diagJsonSet.reserve(mDiagSet.size());
+            for (auto it = mDiagSet.begin(); it != mDiagSet.end(); ++it)
+            {
+                diagJsonSet.push_back(it->second.mJson);
+            }
+
+            if (mWorkerPool != nullptr)
+            {
+                DeferBody(aResponse, [diagJsonSet](void) { return Json::Diag2JsonString(diagJsonSet); });
+                ExitNow();
+            }
+
+            body = Json::Diag2JsonString(diagJsonSet);
         }
 
-        body      = Json::Diag2JsonString(diagContentSet);
-        errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
-        aResponse.SetResponsCode(errorCode);
         aResponse.SetBody(body);
         aResponse.SetComplete();
     }
+
+exit:
+    return;
 }
 
 void Resource::ErrorHandler(Response &aResponse, HttpStatusCode aErrorCode) const
@@ -192,42 +440,101 @@ void Resource::ErrorHandler(Response &aResponse, HttpStatusCode aErrorCode) cons
     aResponse.SetComplete();
 }
 
-void Resource::GetNodeInfo(Response &aResponse) const
+otbrError Resource::BuildNodeInfo(struct NodeInfo &aNode) const
 {
-    otbrError       error = OTBR_ERROR_NONE;
-    struct NodeInfo node;
-    otRouterInfo    routerInfo;
-    uint8_t         maxRouterId;
-    std::string     body;
-    std::string     errorCode;
+    otbrError    error    = OTBR_ERROR_NONE;
+    const auto & snapshot = mNcp->GetStateSnapshot();
+    otRouterInfo routerInfo;
+    uint8_t      maxRouterId;
 
-    VerifyOrExit(otThreadGetLeaderData(mInstance, &node.mLeaderData) == OT_ERROR_NONE, error = OTBR_ERROR_REST);
+    VerifyOrExit(snapshot.mLeaderDataValid, error = OTBR_ERROR_REST);
+    aNode.mLeaderData = snapshot.mLeaderData;
 
-    node.mNumOfRouter = 0;
-    maxRouterId       = otThreadGetMaxRouterId(mInstance);
+    aNode.mNumOfRouter = 0;
+    maxRouterId        = otThreadGetMaxRouterId(mInstance);
     for (uint8_t i = 0; i <= maxRouterId; ++i)
     {
         if (otThreadGetRouterInfo(mInstance, i, &routerInfo) != OT_ERROR_NONE)
         {
             continue;
         }
-        ++node.mNumOfRouter;
+        ++aNode.mNumOfRouter;
     }
 
-    node.mRole        = otThreadGetDeviceRole(mInstance);
-    node.mExtAddress  = reinterpret_cast<const uint8_t *>(otLinkGetExtendedAddress(mInstance));
-    node.mNetworkName = otThreadGetNetworkName(mInstance);
-    node.mRloc16      = otThreadGetRloc16(mInstance);
-    node.mExtPanId    = reinterpret_cast<const uint8_t *>(otThreadGetExtendedPanId(mInstance));
-    node.mRlocAddress = *otThreadGetRloc(mInstance);
+    aNode.mRole        = snapshot.mDeviceRole;
+    aNode.mExtAddress  = reinterpret_cast<const uint8_t *>(otLinkGetExtendedAddress(mInstance));
+    aNode.mNetworkName = otThreadGetNetworkName(mInstance);
+    aNode.mRloc16      = otThreadGetRloc16(mInstance);
+    aNode.mExtPanId    = reinterpret_cast<const uint8_t *>(otThreadGetExtendedPanId(mInstance));
+    aNode.mRlocAddress = *otThreadGetRloc(mInstance);
 
-    body = Json::Node2JsonString(node);
-    aResponse.SetBody(body);
+exit:
+    return error;
+}
+
+// A strong entity tag for a serialized document: the FNV-1a hash of its
+// bytes, quoted as RFC 7232 requires.
+static std::string ComputeEtag(const std::string &aBody)
+{
+    uint64_t hash = 0xcbf29ce484222325ull;
+    char     etag[sizeof("\"0123456789abcdef\"")];
+
+    for (char byte : aBody)
+    {
+        hash = (hash ^ static_cast<uint8_t>(byte)) * 0x100000001b3ull;
+    }
+
+    snprintf(etag, sizeof(etag), "\"%016" PRIx64 "\"", hash);
+
+    return std::string(etag);
+}
+
+void Resource::GetNodeInfo(const Request &aRequest, Response &aResponse) const
+{
+    otbrError   error       = OTBR_ERROR_NONE;
+    bool        notModified = false;
+    std::string body;
+    std::string errorCode;
+
+    if (AcceptsCbor(aRequest))
+    {
+        struct NodeInfo node;
+
+        SuccessOrExit(error = BuildNodeInfo(node));
+        body = Cbor::Node2CborString(node);
+        aResponse.SetContentType(OT_REST_CONTENT_TYPE_CBOR);
+        aResponse.SetBody(body);
+    }
+    else
+    {
+        if (!mNodeInfoJsonValid)
+        {
+            struct NodeInfo node;
+
+            SuccessOrExit(error = BuildNodeInfo(node));
+            mNodeInfoJson      = Json::Node2JsonString(node);
+            mNodeInfoEtag      = ComputeEtag(mNodeInfoJson);
+            mNodeInfoJsonValid = true;
+        }
+
+        aResponse.AddHeader("ETag", mNodeInfoEtag);
+
+        if (aRequest.GetHeaderValue("If-None-Match") == mNodeInfoEtag)
+        {
+            notModified = true;
+        }
+        else
+        {
+            // The cached document only needs to be copied into the response.
+            body = mNodeInfoJson;
+            aResponse.SetBody(body);
+        }
+    }
 
 exit:
     if (error == OTBR_ERROR_NONE)
     {
-        errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+        errorCode = GetHttpStatus(notModified ? HttpStatusCode::kStatusNotModified : HttpStatusCode::kStatusOk);
         aResponse.SetResponsCode(errorCode);
     }
     else
@@ -241,7 +548,28 @@ void Resource::NodeInfo(const Request &aRequest, Response &aResponse) const
     std::string errorCode;
     if (aRequest.GetMethod() == HttpMethod::kGet)
     {
-        GetNodeInfo(aResponse);
+        GetNodeInfo(aRequest, aResponse);
+    }
+    else
+    {
+        ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed);
+    }
+}
+
+void Resource::PrometheusMetrics(const Request &aRequest, Response &aResponse) const
+{
+    std::string errorCode;
+    std::string body;
+
+    if (aRequest.GetMethod() == HttpMethod::kGet)
+    {
+        // Serialization walks the registry only at scrape time; hot-path
+        // increments never pay for it.
+        body = otbr::Metrics::GetInstance().SerializePrometheus();
+        aResponse.SetContentType(OT_REST_CONTENT_TYPE_PROMETHEUS);
+        aResponse.SetBody(body);
+        errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+        aResponse.SetResponsCode(errorCode);
     }
     else
     {
@@ -251,10 +579,16 @@ void Resource::NodeInfo(const Request &aRequest, Response &aResponse) const
 
 void Resource::GetDataExtendedAddr(Response &aResponse) const
 {
-    const uint8_t *extAddress = reinterpret_cast<const uint8_t *>(otLinkGetExtendedAddress(mInstance));
-    std::string    errorCode;
-    std::string    body = Json::Bytes2HexJsonString(extAddress, OT_EXT_ADDRESS_SIZE);
+    std::string errorCode;
+    std::string body;
+
+    if (!mExtAddrJsonValid)
+    {
+        PreRenderInvariantBodies();
+    }
 
+    // The prepared document only needs to be copied into the response.
+    body = mExtAddrJson;
     aResponse.SetBody(body);
     errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
     aResponse.SetResponsCode(errorCode);
@@ -285,7 +619,7 @@ void Resource::GetDataState(Response &aResponse) const
     // 3 : router
     // 4 : leader
 
-    role  = otThreadGetDeviceRole(mInstance);
+    role  = mNcp->GetStateSnapshot().mDeviceRole;
     state = Json::Number2JsonString(role);
     aResponse.SetBody(state);
     errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
@@ -308,13 +642,17 @@ void Resource::State(const Request &aRequest, Response &aResponse) const
 
 void Resource::GetDataNetworkName(Response &aResponse) const
 {
-    std::string networkName;
     std::string errorCode;
+    std::string body;
 
-    networkName = otThreadGetNetworkName(mInstance);
-    networkName = Json::String2JsonString(networkName);
+    if (!mNetworkNameJsonValid)
+    {
+        PreRenderInvariantBodies();
+    }
 
-    aResponse.SetBody(networkName);
+    // The prepared document only needs to be copied into the response.
+    body = mNetworkNameJson;
+    aResponse.SetBody(body);
     errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
     aResponse.SetResponsCode(errorCode);
 }
@@ -340,7 +678,8 @@ void Resource::GetDataLeaderData(Response &aResponse) const
     std::string  body;
     std::string  errorCode;
 
-    VerifyOrExit(otThreadGetLeaderData(mInstance, &leaderData) == OT_ERROR_NONE, error = OTBR_ERROR_REST);
+    VerifyOrExit(mNcp->GetStateSnapshot().mLeaderDataValid, error = OTBR_ERROR_REST);
+    leaderData = mNcp->GetStateSnapshot().mLeaderData;
 
     body = Json::LeaderData2JsonString(leaderData);
 
@@ -489,65 +828,241 @@ void Resource::Rloc(const Request &aRequest, Response &aResponse) const
     }
 }
 
-void Resource::DeleteOutDatedDiagnostic(void)
+void Resource::DeferBody(Response &aResponse, std::function<std::string(void)> aSerializer)
 {
-    auto eraseIt = mDiagSet.begin();
-    for (eraseIt = mDiagSet.begin(); eraseIt != mDiagSet.end();)
-    {
-        auto diagInfo = eraseIt->second;
-        auto duration = duration_cast<microseconds>(steady_clock::now() - diagInfo.mStartTime).count();
+    // Serialization time observed separately from the handler latency, so
+    // slow endpoints can be attributed to body building vs the OT queries
+    // that run inline in the handler.
+    static Metrics::Histogram &sSerializeLatency = Metrics::GetInstance().RegisterHistogram(
+        "otbr_rest_serialization_usec", "Time spent serializing deferred REST response bodies, in microseconds.");
+
+    std::shared_ptr<DeferredBody> deferred = aResponse.DeferBody();
+    std::function<void(void)>     notify   = mWorkerNotify;
+
+    mWorkerPool->Post([deferred, aSerializer, notify](void) {
+        steady_clock::time_point start = steady_clock::now();
+        std::string              body  = aSerializer();
+
+        sSerializeLatency.Observe(
+            static_cast<uint64_t>(duration_cast<microseconds>(steady_clock::now() - start).count()));
 
-        if (duration >= kDiagResetTimeout)
         {
-            eraseIt = mDiagSet.erase(eraseIt);
+            std::lock_guard<std::mutex> lock(deferred->mMutex);
+
+            deferred->mBody  = std::move(body);
+            deferred->mReady = true;
         }
-        else
+
+        if (notify)
+        {
+            notify();
+        }
+    });
+}
+
+static uint64_t GetDiagWheelTick(void)
+{
+    return static_cast<uint64_t>(duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count()) /
+           kDiagWheelSlotDuration;
+}
+
+void Resource::DeleteOutDatedDiagnostic(void)
+{
+    uint64_t currentTick = GetDiagWheelTick();
+    uint64_t expiryTicks = kDiagResetTimeout / kDiagWheelSlotDuration;
+
+    VerifyOrExit(currentTick > mDiagWheelTick);
+
+    // Visit only the wheel slots whose time has passed since the last run;
+    // one lap over the wheel covers any longer gap.
+    for (uint64_t tick = mDiagWheelTick + 1; tick <= currentTick && tick <= mDiagWheelTick + kDiagWheelSlotNum; tick++)
+    {
+        std::vector<std::string> &slot = mDiagWheel[tick % kDiagWheelSlotNum];
+
+        for (const std::string &key : slot)
         {
-            eraseIt++;
+            auto it = mDiagSet.find(key);
+
+            // Skip entries refreshed after they were scheduled into this slot.
+            if (it != mDiagSet.end() && it->second.mUpdateTick + expiryTicks <= currentTick)
+            {
+                mDiagSet.erase(it);
+            }
         }
+        slot.clear();
     }
+
+    mDiagWheelTick = currentTick;
+
+exit:
+    return;
+}
+
+void Resource::ScheduleDiagExpiry(const std::string &aKey, DiagInfo &aInfo)
+{
+    uint64_t currentTick = GetDiagWheelTick();
+    uint64_t expiryTicks = kDiagResetTimeout / kDiagWheelSlotDuration;
+
+    aInfo.mUpdateTick = currentTick;
+    mDiagWheel[(currentTick + expiryTicks) % kDiagWheelSlotNum].push_back(aKey);
 }
 
 void Resource::UpdateDiag(std::string aKey, std::vector<otNetworkDiagTlv> &aDiag)
 {
-    DiagInfo value;
+    DiagInfo &value = mDiagSet[aKey];
 
     value.mStartTime = steady_clock::now();
     value.mDiagContent.assign(aDiag.begin(), aDiag.end());
-    mDiagSet[aKey] = value;
+    // Re-serialize only this node; unchanged nodes keep their cached JSON.
+    value.mJson    = Json::DiagNode2JsonString(value.mDiagContent);
+    value.mVersion = ++mDiagVersion;
+    ScheduleDiagExpiry(aKey, value);
 }
 
-void Resource::Diagnostic(const Request &aRequest, Response &aResponse) const
+otbrError Resource::StartDiagnosticCollect(void)
 {
-    otbrError error = OTBR_ERROR_NONE;
-    OT_UNUSED_VARIABLE(aRequest);
+    otbrError           error         = OTBR_ERROR_NONE;
     struct otIp6Address rloc16address = *otThreadGetRloc(mInstance);
     struct otIp6Address multicastAddress;
 
     VerifyOrExit(otThreadSendDiagnosticGet(mInstance, &rloc16address, kAllTlvTypes, sizeof(kAllTlvTypes),
-                                           &Resource::DiagnosticResponseHandler,
-                                           const_cast<Resource *>(this)) == OT_ERROR_NONE,
+                                           &Resource::DiagnosticResponseHandler, this) == OT_ERROR_NONE,
                  error = OTBR_ERROR_REST);
     VerifyOrExit(otIp6AddressFromString(kMulticastAddrAllRouters, &multicastAddress) == OT_ERROR_NONE,
                  error = OTBR_ERROR_REST);
     VerifyOrExit(otThreadSendDiagnosticGet(mInstance, &multicastAddress, kAllTlvTypes, sizeof(kAllTlvTypes),
-                                           &Resource::DiagnosticResponseHandler,
-                                           const_cast<Resource *>(this)) == OT_ERROR_NONE,
+                                           &Resource::DiagnosticResponseHandler, this) == OT_ERROR_NONE,
                  error = OTBR_ERROR_REST);
 
+    mDiagCollectStart = steady_clock::now();
+    mDiagCollectValid = true;
+
 exit:
+    return error;
+}
 
-    if (error == OTBR_ERROR_NONE)
+void Resource::Diagnostic(const Request &aRequest, Response &aResponse) const
+{
+    otbrError   error       = OTBR_ERROR_NONE;
+    Resource *  self        = const_cast<Resource *>(this);
+    uint64_t    maxAge      = kDiagMaxAgeDefault;
+    std::string maxAgeParam = aRequest.GetQueryParameter("maxAge");
+    auto        now         = steady_clock::now();
+
+    if (!maxAgeParam.empty())
     {
-        aResponse.SetStartTime(steady_clock::now());
+        maxAge = static_cast<uint64_t>(strtoull(maxAgeParam.c_str(), nullptr, 10)) * 1000000;
+    }
+
+    // Coalesce with the in-flight or recent collection when it is fresh
+    // enough for this request, instead of multicasting another query.
+    if (mDiagCollectValid &&
+        static_cast<uint64_t>(duration_cast<microseconds>(now - mDiagCollectStart).count()) <= maxAge)
+    {
+        aResponse.SetStartTime(mDiagCollectStart);
         aResponse.SetCallback();
+        ExitNow();
+    }
+
+    SuccessOrExit(error = self->StartDiagnosticCollect());
+
+    aResponse.SetStartTime(mDiagCollectStart);
+    aResponse.SetCallback();
+
+exit:
+
+    if (error != OTBR_ERROR_NONE)
+    {
+        ErrorHandler(aResponse, HttpStatusCode::kStatusInternalServerError);
+    }
+}
+
+static uint64_t GetSinceParameter(const Request &aRequest)
+{
+    std::string sinceParam = aRequest.GetQueryParameter("since");
+
+    return sinceParam.empty() ? 0 : static_cast<uint64_t>(strtoull(sinceParam.c_str(), nullptr, 10));
+}
+
+void Resource::WriteDiagnosticDelta(uint64_t aSince, Response &aResponse)
+{
+    std::vector<std::string> diagJsonSet;
+    std::string              body;
+    std::string              errorCode;
+
+    DeleteOutDatedDiagnostic();
+
+    for (auto it = mDiagSet.begin(); it != mDiagSet.end(); ++it)
+    {
+        if (it->second.mVersion > aSince)
+        {
+            diagJsonSet.push_back(it->second.mJson);
+        }
+    }
+
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.AddHeader("X-Diagnostic-Version", std::to_string(mDiagVersion));
+    aResponse.SetResponsCode(errorCode);
+
+    if (mWorkerPool != nullptr)
+    {
+        DeferBody(aResponse, [diagJsonSet](void) { return Json::Diag2JsonString(diagJsonSet); });
+        ExitNow();
+    }
+
+    body = Json::Diag2JsonString(diagJsonSet);
+    aResponse.SetBody(body);
+    aResponse.SetComplete();
+
+exit:
+    return;
+}
+
+void Resource::DiagnosticDelta(const Request &aRequest, Response &aResponse) const
+{
+    otbrError error = OTBR_ERROR_NONE;
+    Resource *self  = const_cast<Resource *>(this);
+    uint64_t  since = GetSinceParameter(aRequest);
+    auto      now   = steady_clock::now();
+
+    // Keep a shared collection running so updates keep arriving while the
+    // client long-polls; it is coalesced with /diagnostics requests.
+    if (!mDiagCollectValid ||
+        static_cast<uint64_t>(duration_cast<microseconds>(now - mDiagCollectStart).count()) > kDiagMaxAgeDefault)
+    {
+        SuccessOrExit(error = self->StartDiagnosticCollect());
+    }
+
+    if (mDiagVersion > since)
+    {
+        // Updates the client has not seen yet: answer without parking.
+        self->WriteDiagnosticDelta(since, aResponse);
     }
     else
+    {
+        aResponse.SetStartTime(now);
+        aResponse.SetCallback();
+    }
+
+exit:
+
+    if (error != OTBR_ERROR_NONE)
     {
         ErrorHandler(aResponse, HttpStatusCode::kStatusInternalServerError);
     }
 }
 
+void Resource::HandleDiagnosticDeltaCallback(const Request &aRequest, Response &aResponse)
+{
+    uint64_t since    = GetSinceParameter(aRequest);
+    auto     duration = duration_cast<microseconds>(steady_clock::now() - aResponse.GetStartTime()).count();
+
+    if (mDiagVersion > since || duration >= kDiagDeltaPollTimeout)
+    {
+        WriteDiagnosticDelta(since, aResponse);
+    }
+}
+
 void Resource::DiagnosticResponseHandler(otError              aError,
                                          otMessage *          aMessage,
                                          const otMessageInfo *aMessageInfo,
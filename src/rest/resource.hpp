@@ -38,10 +38,12 @@
 
 #include <openthread/border_router.h>
 
+#include "common/metrics.hpp"
 #include "ncp/ncp_openthread.hpp"
 #include "rest/json.hpp"
 #include "rest/request.hpp"
 #include "rest/response.hpp"
+#include "rest/worker_pool.hpp"
 #include "utils/thread_helper.hpp"
 
 using otbr::Ncp::ControllerOpenThread;
@@ -72,6 +74,18 @@ public:
      */
     void Init(void);
 
+    /**
+     * This method attaches a worker pool that serializes large response
+     * bodies off the mainloop; without one, serialization stays inline.
+     *
+     * @param[in] aWorkerPool  A pointer to the worker pool.
+     * @param[in] aNotify      A callable invoked from a worker thread when a
+     *                         deferred body becomes ready; it must be safe to
+     *                         call from another thread.
+     *
+     */
+    void SetWorkerPool(WorkerPool *aWorkerPool, std::function<void(void)> aNotify);
+
     /**
      * This method is the main entry of resource handler, which find corresponding handler according to request url
      * find the resource and set the content of response.
@@ -104,6 +118,22 @@ public:
 private:
     typedef void (Resource::*ResourceHandler)(const Request &aRequest, Response &aResponse) const;
     typedef void (Resource::*ResourceCallbackHandler)(const Request &aRequest, Response &aResponse);
+
+    // One entry of the fixed endpoint table; the metric pointers are filled
+    // lazily on the first request the endpoint serves.
+    struct Endpoint
+    {
+        const char *            mPath;            // The endpoint path.
+        uint8_t                 mLength;          // The path length.
+        ResourceHandler         mHandler;         // The request handler.
+        ResourceCallbackHandler mCallbackHandler; // The callback handler, or nullptr.
+        Metrics::Counter *      mRequests;        // The request counter.
+        Metrics::Histogram *    mLatency;         // The latency histogram.
+    };
+
+    static Endpoint *FindEndpoint(const char *aPath, size_t aLength);
+    static void      EnsureEndpointMetrics(Endpoint &aEndpoint);
+
     void NodeInfo(const Request &aRequest, Response &aResponse) const;
     void ExtendedAddr(const Request &aRequest, Response &aResponse) const;
     void State(const Request &aRequest, Response &aResponse) const;
@@ -113,10 +143,15 @@ private:
     void Rloc16(const Request &aRequest, Response &aResponse) const;
     void ExtendedPanId(const Request &aRequest, Response &aResponse) const;
     void Rloc(const Request &aRequest, Response &aResponse) const;
+    void PrometheusMetrics(const Request &aRequest, Response &aResponse) const;
     void Diagnostic(const Request &aRequest, Response &aResponse) const;
+    void DiagnosticDelta(const Request &aRequest, Response &aResponse) const;
     void HandleDiagnosticCallback(const Request &aRequest, Response &aResponse);
+    void HandleDiagnosticDeltaCallback(const Request &aRequest, Response &aResponse);
 
-    void GetNodeInfo(Response &aResponse) const;
+    void      GetNodeInfo(const Request &aRequest, Response &aResponse) const;
+    otbrError BuildNodeInfo(struct NodeInfo &aNode) const;
+    void PreRenderInvariantBodies(void) const;
     void GetDataExtendedAddr(Response &aResponse) const;
     void GetDataState(Response &aResponse) const;
     void GetDataNetworkName(Response &aResponse) const;
@@ -126,8 +161,12 @@ private:
     void GetDataExtendedPanId(Response &aResponse) const;
     void GetDataRloc(Response &aResponse) const;
 
-    void DeleteOutDatedDiagnostic(void);
-    void UpdateDiag(std::string aKey, std::vector<otNetworkDiagTlv> &aDiag);
+    void      DeleteOutDatedDiagnostic(void);
+    void      ScheduleDiagExpiry(const std::string &aKey, DiagInfo &aInfo);
+    void      UpdateDiag(std::string aKey, std::vector<otNetworkDiagTlv> &aDiag);
+    otbrError StartDiagnosticCollect(void);
+    void      WriteDiagnosticDelta(uint64_t aSince, Response &aResponse);
+    void      DeferBody(Response &aResponse, std::function<std::string(void)> aSerializer);
 
     static void DiagnosticResponseHandler(otError              aError,
                                           otMessage *          aMessage,
@@ -138,10 +177,41 @@ private:
     otInstance *          mInstance;
     ControllerOpenThread *mNcp;
 
-    std::unordered_map<std::string, ResourceHandler>         mResourceMap;
-    std::unordered_map<std::string, ResourceCallbackHandler> mResourceCallbackMap;
+    // Serializes large response bodies off the mainloop when attached.
+    WorkerPool *              mWorkerPool;
+    std::function<void(void)> mWorkerNotify;
 
     std::unordered_map<std::string, DiagInfo> mDiagSet;
+
+    // TTL expiry wheel over mDiagSet keys; only slots whose time has passed
+    // are visited, so expiry cost tracks the update rate, not the mesh size.
+    std::vector<std::vector<std::string>> mDiagWheel;
+    uint64_t                              mDiagWheelTick;
+
+    // Start time of the latest diagnostic collection; concurrent requests
+    // within their freshness window share it instead of multicasting again.
+    steady_clock::time_point mDiagCollectStart;
+    bool                     mDiagCollectValid;
+
+    // Monotonic counter bumped on every per-node diagnostic update; delta
+    // long-polls send only the nodes updated after the version the client
+    // has already seen.
+    uint64_t mDiagVersion;
+
+    // Serialized /node document and its entity tag, rebuilt only after a
+    // Thread state change touching one of its fields; unchanged polls are
+    // answered with 304 from the If-None-Match comparison.
+    mutable std::string mNodeInfoJson;
+    mutable std::string mNodeInfoEtag;
+    mutable bool        mNodeInfoJsonValid;
+
+    // Pre-rendered bodies for /node/ext-address and /node/network-name,
+    // rebuilt at state-change time (these values only move on dataset
+    // updates); a GET just copies the prepared buffer into the response.
+    mutable std::string mExtAddrJson;
+    mutable bool        mExtAddrJsonValid;
+    mutable std::string mNetworkNameJson;
+    mutable bool        mNetworkNameJsonValid;
 };
 
 } // namespace rest
@@ -30,6 +30,8 @@
 
 #include <stdio.h>
 
+#include "common/code_utils.hpp"
+
 #define OT_REST_RESPONSE_CONTENT_TYPE_JSON "application/json"
 #define OT_REST_RESPONSE_ACCESS_CONTROL_ALLOW_ORIGIN "*"
 #define OT_REST_RESPONSE_ACCESS_CONTROL_ALLOW_HEADERS                                                              \
@@ -40,9 +42,13 @@
 namespace otbr {
 namespace rest {
 
+// Number of the pre-defined headers set by the constructor.
+static const size_t kBaseHeaderNum = 4;
+
 Response::Response(void)
     : mCallback(false)
     , mComplete(false)
+    , mKeepAlive(false)
 {
     // HTTP protocol
     mProtocol = "HTTP/1.1 ";
@@ -61,6 +67,22 @@ Response::Response(void)
     mHeaderValue.push_back(OT_REST_RESPONSE_ACCESS_CONTROL_ALLOW_HEADERS);
 }
 
+void Response::Reset(void)
+{
+    mCallback  = false;
+    mComplete  = false;
+    mKeepAlive = false;
+    mCode.clear();
+    mBodyRope.clear();
+    mDeferredBody.reset();
+
+    // Drop the headers added per response and restore the default content
+    // type, keeping the pre-defined headers in place.
+    mHeaderField.resize(kBaseHeaderNum);
+    mHeaderValue.resize(kBaseHeaderNum);
+    mHeaderValue[0] = OT_REST_RESPONSE_CONTENT_TYPE_JSON;
+}
+
 void Response::SetComplete()
 {
     mComplete = true;
@@ -81,6 +103,24 @@ bool Response::IsComplete()
     return mComplete == true;
 }
 
+void Response::SetContentType(const std::string &aType)
+{
+    for (size_t i = 0; i < mHeaderField.size(); ++i)
+    {
+        if (mHeaderField[i] == "Content-Type")
+        {
+            mHeaderValue[i] = aType;
+            break;
+        }
+    }
+}
+
+void Response::AddHeader(const std::string &aField, const std::string &aValue)
+{
+    mHeaderField.push_back(aField);
+    mHeaderValue.push_back(aValue);
+}
+
 void Response::SetResponsCode(std::string &aCode)
 {
     mCode = aCode;
@@ -91,14 +131,67 @@ void Response::SetCallback(void)
     mCallback = true;
 }
 
+void Response::SetKeepAlive(bool aKeepAlive)
+{
+    mKeepAlive = aKeepAlive;
+}
+
+std::shared_ptr<DeferredBody> Response::DeferBody(void)
+{
+    mDeferredBody = std::make_shared<DeferredBody>();
+
+    return mDeferredBody;
+}
+
+bool Response::TryAdoptDeferredBody(void)
+{
+    bool adopted = false;
+
+    {
+        std::lock_guard<std::mutex> lock(mDeferredBody->mMutex);
+
+        VerifyOrExit(mDeferredBody->mReady);
+
+        mBodyRope.clear();
+        mBodyRope.push_back(std::move(mDeferredBody->mBody));
+    }
+
+    mDeferredBody.reset();
+    mComplete = true;
+    adopted   = true;
+
+exit:
+    return adopted;
+}
+
 void Response::SetBody(std::string &aBody)
 {
-    mBody = aBody;
+    mBodyRope.clear();
+    mBodyRope.push_back(aBody);
+}
+
+void Response::AppendBody(std::string aChunk)
+{
+    mBodyRope.push_back(std::move(aChunk));
 }
 
 std::string Response::GetBody(void) const
 {
-    return mBody;
+    std::string body;
+    size_t      size = 0;
+
+    for (const std::string &chunk : mBodyRope)
+    {
+        size += chunk.size();
+    }
+
+    body.reserve(size);
+    for (const std::string &chunk : mBodyRope)
+    {
+        body += chunk;
+    }
+
+    return body;
 }
 
 bool Response::NeedCallback(void)
@@ -106,18 +199,25 @@ bool Response::NeedCallback(void)
     return mCallback;
 }
 
-std::string Response::Serialize(void) const
+std::string Response::SerializeHeader(void) const
 {
     size_t      index;
-    std::string spacer = "\r\n";
+    size_t      bodySize = 0;
+    std::string spacer   = "\r\n";
     std::string ret(mProtocol + " " + mCode);
 
+    for (const std::string &chunk : mBodyRope)
+    {
+        bodySize += chunk.size();
+    }
+
     for (index = 0; index < mHeaderField.size(); index++)
     {
         ret += (spacer + mHeaderField[index] + ": " + mHeaderValue[index]);
     }
-    ret += spacer + "Content-Length: " + std::to_string(mBody.size());
-    ret += (spacer + spacer + mBody);
+    ret += spacer + "Connection: " + (mKeepAlive ? "keep-alive" : "close");
+    ret += spacer + "Content-Length: " + std::to_string(bodySize);
+    ret += (spacer + spacer);
 
     return ret;
 }
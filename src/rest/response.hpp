@@ -64,13 +64,56 @@ public:
     Response(void);
 
     /**
-     * This method set the response body.
+     * This method resets the response to its freshly constructed state while
+     * keeping the buffers already grown, so a reused connection builds its
+     * next response without reallocating.
+     *
+     */
+    void Reset(void);
+
+    /**
+     * This method set the response body, replacing any previous content.
      *
      * @param[in] aBody  A string to be set as response body.
      *
      */
     void SetBody(std::string &aBody);
 
+    /**
+     * This method appends a buffer to the response body rope without copying
+     * or reallocating the buffers already appended.
+     *
+     * @param[in] aChunk  A string appended to the response body.
+     *
+     */
+    void AppendBody(std::string aChunk);
+
+    /**
+     * This method arranges for the body to be produced off the mainloop: it
+     * attaches a shared placeholder a worker thread fills and returns it. The
+     * response completes when the placeholder is adopted.
+     *
+     * @returns A shared pointer to the placeholder to be filled by a worker.
+     */
+    std::shared_ptr<DeferredBody> DeferBody(void);
+
+    /**
+     * This method indicates whether the response is waiting for a body
+     * produced off the mainloop.
+     *
+     * @returns A bool value indicates whether a deferred body is attached.
+     */
+    bool HasDeferredBody(void) const { return mDeferredBody != nullptr; }
+
+    /**
+     * This method adopts the deferred body when the worker has finished
+     * producing it, completing the response.
+     *
+     * @retval TRUE   The body was ready and the response is now complete.
+     * @retval FALSE  The body is not ready yet.
+     */
+    bool TryAdoptDeferredBody(void);
+
     /**
      * This method return a string contains the body field of this response.
      *
@@ -78,6 +121,31 @@ public:
      */
     std::string GetBody(void) const;
 
+    /**
+     * This method returns the rope of buffers forming the response body, so
+     * the body can be transmitted without concatenating it first.
+     *
+     * @returns A reference to the vector of body buffers.
+     */
+    const std::vector<std::string> &GetBodyRope(void) const { return mBodyRope; }
+
+    /**
+     * This method overrides the content type of the response, "application/json" by default.
+     *
+     * @param[in] aType  A string of the content type.
+     *
+     */
+    void SetContentType(const std::string &aType);
+
+    /**
+     * This method adds a header field and value to the response.
+     *
+     * @param[in] aField  A string of the header field name.
+     * @param[in] aValue  A string of the header value.
+     *
+     */
+    void AddHeader(const std::string &aField, const std::string &aValue);
+
     /**
      * This method set the response code.
      *
@@ -113,6 +181,14 @@ public:
      */
     bool IsComplete();
 
+    /**
+     * This method sets whether the connection is kept alive after this response.
+     *
+     * @param[in] aKeepAlive  A bool value indicates whether the connection is reused.
+     *
+     */
+    void SetKeepAlive(bool aKeepAlive);
+
     /**
      * This method is used to set a timestamp. when a callback is needed and this field tells callback handler when to
      * collect all the data and form the response.
@@ -129,11 +205,12 @@ public:
     steady_clock::time_point GetStartTime() const;
 
     /**
-     * This method serialize a response to a string that could be sent by socket later.
+     * This method serializes the status line and headers of a response to a string; together with the body rope it
+     * forms the data to be sent by socket later.
      *
-     * @returns A string contains status line, headers and body of a response.
+     * @returns A string contains status line and headers of a response.
      */
-    std::string Serialize(void) const;
+    std::string SerializeHeader(void) const;
 
 private:
     bool                     mCallback;
@@ -141,8 +218,10 @@ private:
     std::vector<std::string> mHeaderValue;
     std::string              mCode;
     std::string              mProtocol;
-    std::string              mBody;
+    std::vector<std::string> mBodyRope;
+    std::shared_ptr<DeferredBody> mDeferredBody;
     bool                     mComplete;
+    bool                     mKeepAlive;
     steady_clock::time_point mStartTime;
 };
 
@@ -31,9 +31,12 @@
 #include "rest/rest_web_server.hpp"
 
 #include <cerrno>
+#include <cstdlib>
 
 #include <fcntl.h>
 
+#include "common/metrics.hpp"
+#include "common/perf_config.hpp"
 #include "utils/socket_utils.hpp"
 
 using std::chrono::duration_cast;
@@ -43,19 +46,70 @@ using std::chrono::steady_clock;
 namespace otbr {
 namespace rest {
 
-// Maximum number of connection a server support at the same time.
-static const uint32_t kMaxServeNum = 500;
+// Default maximum number of connections the server supports at the same time.
+static const uint32_t kDefaultMaxServeNum = 500;
+// Maximum number of epoll events handled per batch.
+static const int kMaxEpollEvents = 64;
+// Maximum number of connections accepted per mainloop cycle.
+static const uint32_t kMaxAcceptBurst = 64;
+// Backlog of the listening socket.
+static const int kListenBacklog = 128;
 // Port number used by Rest server.
 static const uint32_t kPortNumber = 8081;
+// Interval (in seconds) between connection pool statistics log entries.
+static const uint32_t kPoolStatsLogInterval = 60;
+// Number of worker threads serializing response bodies off the mainloop.
+static const size_t kWorkerThreadNum = 2;
+// Slot width and count of the connection timer wheel; the horizon (about
+// 32 seconds) exceeds the largest connection timeout (10 seconds), which the
+// wheel requires to trust its first occupied slot.
+static const uint32_t kTimerWheelSlotWidthMs = 128;
+static const size_t   kTimerWheelSlotCount   = 256;
+
+// Reads the connection limit from the `OTBR_REST_MAX_CONNECTIONS` environment
+// variable, falling back to the built-in default when unset or invalid.
+static uint32_t GetConfiguredMaxServeNum(void)
+{
+    uint32_t    num = kDefaultMaxServeNum;
+    const char *env = getenv("OTBR_REST_MAX_CONNECTIONS");
+
+    if (env != nullptr)
+    {
+        char *        end   = nullptr;
+        unsigned long value = strtoul(env, &end, 10);
+
+        if (end != env && *end == '\0' && value > 0)
+        {
+            num = static_cast<uint32_t>(value);
+        }
+        else
+        {
+            otbrLogWarning("Ignoring invalid OTBR_REST_MAX_CONNECTIONS value '%s'", env);
+        }
+    }
+
+    return num;
+}
 
 RestWebServer::RestWebServer(ControllerOpenThread &aNcp)
     : mResource(Resource(&aNcp))
     , mListenFd(-1)
+    , mEpollFd(-1)
+    , mMaxServeNum(GetConfiguredMaxServeNum())
+    , mConnectionPool(mMaxServeNum)
+    , mTimerWheel(kTimerWheelSlotWidthMs, kTimerWheelSlotCount)
+    , mNextPoolStatsLogTime(steady_clock::now() + std::chrono::seconds(kPoolStatsLogInterval))
+    , mLoggedAllocationCount(0)
+    , mWorkerPool(kWorkerThreadNum)
 {
 }
 
 RestWebServer::~RestWebServer(void)
 {
+    if (mEpollFd != -1)
+    {
+        close(mEpollFd);
+    }
     if (mListenFd != -1)
     {
         close(mListenFd);
@@ -65,52 +119,142 @@ RestWebServer::~RestWebServer(void)
 void RestWebServer::Init(void)
 {
     mResource.Init();
+    mResource.SetWorkerPool(&mWorkerPool, [this](void) {
+        // Called on a worker thread; hop back to the mainloop before
+        // touching connections.
+        mTaskRunner.Post([this](void) { ProcessDeferredConnections(); });
+    });
     InitializeListenFd();
+    InitializeEpollFd();
 }
 
 void RestWebServer::Update(MainloopContext &aMainloop)
 {
-    FD_SET(mListenFd, &aMainloop.mReadFdSet);
-    aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, mListenFd);
+    FD_SET(mEpollFd, &aMainloop.mReadFdSet);
+    aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, mEpollFd);
 
-    return;
+    if (mConnectionPool.GetCount() > 0)
+    {
+        struct timeval timeout      = {0, 0};
+        auto           now          = steady_clock::now();
+        auto           nextDeadline = mTimerWheel.GetNextDeadline();
+
+        if (nextDeadline > now)
+        {
+            auto remaining  = duration_cast<microseconds>(nextDeadline - now).count();
+            timeout.tv_sec  = remaining / 1000000;
+            timeout.tv_usec = remaining % 1000000;
+        }
+
+        if (timercmp(&timeout, &aMainloop.mTimeout, <))
+        {
+            aMainloop.mTimeout = timeout;
+        }
+    }
 }
 
 void RestWebServer::Process(const MainloopContext &aMainloop)
 {
-    UpdateConnections(aMainloop.mReadFdSet);
+    if (FD_ISSET(mEpollFd, &aMainloop.mReadFdSet))
+    {
+        ProcessEpollEvents();
+    }
+
+    mTimerWheel.Advance(steady_clock::now(),
+                        [this](Connection &aConnection) { ProcessConnection(aConnection, false, false); });
+
+    LogPoolStats();
 }
 
-void RestWebServer::UpdateConnections(const fd_set &aReadFdSet)
+void RestWebServer::LogPoolStats(void)
 {
-    otbrError error   = OTBR_ERROR_NONE;
-    auto      eraseIt = mConnectionSet.begin();
+    size_t allocations = mConnectionPool.GetAllocationCount();
 
-    // Erase useless connections
-    for (eraseIt = mConnectionSet.begin(); eraseIt != mConnectionSet.end();)
-    {
-        Connection *connection = eraseIt->second.get();
+    VerifyOrExit(steady_clock::now() >= mNextPoolStatsLogTime);
+    mNextPoolStatsLogTime = steady_clock::now() + std::chrono::seconds(kPoolStatsLogInterval);
 
-        if (connection->IsComplete())
+    // Stay quiet while the server is idle.
+    VerifyOrExit(allocations != mLoggedAllocationCount);
+    mLoggedAllocationCount = allocations;
+
+    otbrLogDebug("Connection pool: %zu live, %zu allocations, %zu slot reuses", mConnectionPool.GetCount(),
+                 allocations, mConnectionPool.GetReuseCount());
+
+exit:
+    return;
+}
+
+void RestWebServer::ProcessEpollEvents(void)
+{
+    struct epoll_event events[kMaxEpollEvents];
+    int                count;
+
+    while ((count = epoll_wait(mEpollFd, events, kMaxEpollEvents, 0)) > 0)
+    {
+        for (int i = 0; i < count; i++)
         {
-            eraseIt = mConnectionSet.erase(eraseIt);
+            // The listening socket is registered with a null pointer.
+            if (events[i].data.ptr == nullptr)
+            {
+                AcceptBurst();
+            }
+            else
+            {
+                Connection &connection = *static_cast<Connection *>(events[i].data.ptr);
+                uint32_t    reported   = events[i].events;
+
+                ProcessConnection(connection, (reported & (EPOLLIN | EPOLLERR | EPOLLHUP)) != 0,
+                                  (reported & (EPOLLOUT | EPOLLERR | EPOLLHUP)) != 0);
+            }
         }
-        else
+
+        if (count < kMaxEpollEvents)
         {
-            eraseIt++;
+            break;
         }
     }
+}
+
+void RestWebServer::ProcessConnection(Connection &aConnection, bool aReadable, bool aWritable)
+{
+    uint32_t oldEvents = aConnection.GetEpollEvents();
+
+    aConnection.Process(aReadable, aWritable);
 
-    // Create new connection if listenfd is set
-    if (FD_ISSET(mListenFd, &aReadFdSet) && mConnectionSet.size() < kMaxServeNum)
+    if (aConnection.IsComplete())
     {
-        error = Accept(mListenFd);
+        // Closing the socket removed it from the epoll set; just recycle the slot.
+        mTimerWheel.Remove(&aConnection);
+        mConnectionPool.Free(&aConnection);
+        ExitNow();
     }
 
-    if (error != OTBR_ERROR_NONE)
+    // Processing moves the connection's deadline; rescheduling in the wheel
+    // is O(1).
+    mTimerWheel.Schedule(&aConnection, aConnection.GetDeadline());
+
+    if (aConnection.GetEpollEvents() != oldEvents)
     {
-        otbrLogWarning("Failed to accept new connection: %s", otbrErrorString(error));
+        struct epoll_event event;
+
+        event.events   = aConnection.GetEpollEvents();
+        event.data.ptr = &aConnection;
+
+        if (epoll_ctl(mEpollFd, EPOLL_CTL_MOD, aConnection.GetFd(), &event) != 0)
+        {
+            otbrLogWarning("Failed to update epoll events of connection: %s", strerror(errno));
+        }
     }
+
+exit:
+    return;
+}
+
+void RestWebServer::ProcessDeferredConnections(void)
+{
+    // Give every connection a chance to adopt a finished body; the ones not
+    // waiting on a worker treat this like a regular timeout check.
+    mConnectionPool.ForEach([this](Connection &aConnection) { ProcessConnection(aConnection, false, false); });
 }
 
 void RestWebServer::InitializeListenFd(void)
@@ -118,23 +262,27 @@ void RestWebServer::InitializeListenFd(void)
     otbrError   error = OTBR_ERROR_NONE;
     std::string errorMessage;
     int32_t     ret;
-    int32_t     err    = errno;
-    int32_t     optval = 1;
+    int32_t     err = errno;
+    SocketSpec  spec;
 
     mAddress.sin_family      = AF_INET;
     mAddress.sin_addr.s_addr = INADDR_ANY;
     mAddress.sin_port        = htons(kPortNumber);
 
-    mListenFd = SocketWithCloseExec(AF_INET, SOCK_STREAM, 0, kSocketNonBlock);
+    spec.mDomain    = AF_INET;
+    spec.mType      = SOCK_STREAM;
+    spec.mReuseAddr = true;
+
+    mListenFd = CreateSocket(spec);
     VerifyOrExit(mListenFd != -1, err = errno, error = OTBR_ERROR_REST, errorMessage = "socket");
 
-    ret = setsockopt(mListenFd, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<char *>(&optval), sizeof(optval));
-    VerifyOrExit(ret == 0, err = errno, error = OTBR_ERROR_REST, errorMessage = "sock opt");
+    // Nonblocking so that `AcceptBurst()` can drain the backlog until EAGAIN.
+    VerifyOrExit(SetFdNonblocking(mListenFd), err = errno, error = OTBR_ERROR_REST, errorMessage = "set nonblock");
 
     ret = bind(mListenFd, reinterpret_cast<struct sockaddr *>(&mAddress), sizeof(sockaddr));
     VerifyOrExit(ret == 0, err = errno, error = OTBR_ERROR_REST, errorMessage = "bind");
 
-    ret = listen(mListenFd, 5);
+    ret = listen(mListenFd, kListenBacklog);
     VerifyOrExit(ret >= 0, err = errno, error = OTBR_ERROR_REST, errorMessage = "listen");
 
 exit:
@@ -147,8 +295,34 @@ exit:
     VerifyOrDie(error == OTBR_ERROR_NONE, "otbr rest server init error");
 }
 
-otbrError RestWebServer::Accept(int aListenFd)
+void RestWebServer::AcceptBurst(void)
 {
+    static PerfConfig::Uint32Value &sMaxConnections = PerfConfig::GetInstance().RegisterUint32(
+        "rest.max_connections", mMaxServeNum, "Maximum number of concurrent REST connections served.");
+    static PerfConfig::Uint32Value &sAcceptBurst = PerfConfig::GetInstance().RegisterUint32(
+        "rest.accept_burst", kMaxAcceptBurst, "Maximum number of REST connections accepted per mainloop cycle.");
+    // The connection pool is sized at startup, so raising the limit at
+    // runtime is capped at the initial capacity.
+    uint32_t maxServe = std::min(sMaxConnections.Get(), mMaxServeNum);
+    uint32_t accepted = 0;
+
+    // Drain the whole backlog in one pass so a reconnect burst does not
+    // trickle in at one connection per cycle, but cap the pass so accepts
+    // cannot starve connection processing.
+    while (accepted < sAcceptBurst.Get() && mConnectionPool.GetCount() < maxServe)
+    {
+        if (Accept(mListenFd) != OTBR_ERROR_NONE)
+        {
+            break;
+        }
+        accepted++;
+    }
+}
+
+otbrError RestWebServer::Accept(int32_t aListenFd)
+{
+    static Metrics::Counter &sConnections =
+        Metrics::GetInstance().RegisterCounter("otbr_rest_connections_total", "Number of accepted REST connections.");
     std::string errorMessage;
     otbrError   error = OTBR_ERROR_NONE;
     int32_t     err;
@@ -159,11 +333,15 @@ otbrError RestWebServer::Accept(int aListenFd)
     fd  = accept(aListenFd, reinterpret_cast<struct sockaddr *>(&mAddress), &addrlen);
     err = errno;
 
-    VerifyOrExit(fd >= 0, err = errno, error = OTBR_ERROR_REST, errorMessage = "accept");
+    // An empty backlog is the normal end of an accept burst, not an error
+    // worth logging.
+    VerifyOrExit(fd >= 0, error = OTBR_ERROR_REST,
+                 errorMessage = (err == EAGAIN || err == EWOULDBLOCK) ? "" : "accept");
 
     VerifyOrExit(SetFdNonblocking(fd), err = errno, error = OTBR_ERROR_REST; errorMessage = "set nonblock");
 
     CreateNewConnection(fd);
+    sConnections.Increment();
 
 exit:
     if (error != OTBR_ERROR_NONE)
@@ -173,25 +351,70 @@ exit:
             close(fd);
             fd = -1;
         }
-        otbrLogErr("Rest server accept error: %s %s", errorMessage.c_str(), strerror(err));
+        if (!errorMessage.empty())
+        {
+            otbrLogErr("Rest server accept error: %s %s", errorMessage.c_str(), strerror(err));
+        }
     }
 
     return error;
 }
 
-void RestWebServer::CreateNewConnection(int &aFd)
+void RestWebServer::InitializeEpollFd(void)
 {
-    auto it =
-        mConnectionSet.emplace(aFd, std::unique_ptr<Connection>(new Connection(steady_clock::now(), &mResource, aFd)));
+    otbrError          error = OTBR_ERROR_NONE;
+    std::string        errorMessage;
+    int32_t            err = errno;
+    struct epoll_event event;
 
-    if (it.second == true)
+    mEpollFd = epoll_create1(EPOLL_CLOEXEC);
+    VerifyOrExit(mEpollFd != -1, err = errno, error = OTBR_ERROR_REST, errorMessage = "epoll create");
+
+    // The listening socket is registered with a null pointer so that events
+    // on it can be told apart from connection events.
+    event.events   = EPOLLIN;
+    event.data.ptr = nullptr;
+    VerifyOrExit(epoll_ctl(mEpollFd, EPOLL_CTL_ADD, mListenFd, &event) == 0, err = errno, error = OTBR_ERROR_REST,
+                 errorMessage = "epoll add listen");
+
+exit:
+
+    if (error != OTBR_ERROR_NONE)
     {
-        Connection *connection = it.first->second.get();
+        otbrLogErr("InitializeEpollFd error %s : %s", errorMessage.c_str(), strerror(err));
+    }
+
+    VerifyOrDie(error == OTBR_ERROR_NONE, "otbr rest server init error");
+}
+
+void RestWebServer::CreateNewConnection(int32_t &aFd)
+{
+    Connection *connection = mConnectionPool.Allocate(steady_clock::now(), &mResource, aFd);
+
+    if (connection != nullptr)
+    {
+        struct epoll_event event;
+
         connection->Init();
+
+        event.events   = connection->GetEpollEvents();
+        event.data.ptr = connection;
+
+        if (epoll_ctl(mEpollFd, EPOLL_CTL_ADD, aFd, &event) != 0)
+        {
+            otbrLogWarning("Failed to add connection to epoll: %s", strerror(errno));
+            // The destructor closes the socket.
+            mConnectionPool.Free(connection);
+            aFd = -1;
+        }
+        else
+        {
+            mTimerWheel.Schedule(connection, connection->GetDeadline());
+        }
     }
     else
     {
-        // failure on inserting new connection
+        // failure on allocating new connection
         close(aFd);
         aFd = -1;
     }
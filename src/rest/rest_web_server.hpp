@@ -36,10 +36,15 @@
 
 #include <netinet/in.h>
 #include <netinet/ip.h>
+#include <sys/epoll.h>
 #include <sys/socket.h>
 
 #include "common/mainloop.hpp"
+#include "common/task_runner.hpp"
+#include "common/timer_wheel.hpp"
 #include "rest/connection.hpp"
+#include "rest/connection_pool.hpp"
+#include "rest/worker_pool.hpp"
 
 using otbr::Ncp::ControllerOpenThread;
 using std::chrono::steady_clock;
@@ -78,10 +83,15 @@ public:
     void Process(const MainloopContext &aMainloop) override;
 
 private:
-    void      UpdateConnections(const fd_set &aReadFdSet);
+    void      ProcessEpollEvents(void);
+    void      ProcessConnection(Connection &aConnection, bool aReadable, bool aWritable);
+    void      ProcessDeferredConnections(void);
+    void      LogPoolStats(void);
     void      CreateNewConnection(int32_t &aFd);
+    void      AcceptBurst(void);
     otbrError Accept(int32_t aListenFd);
     void      InitializeListenFd(void);
+    void      InitializeEpollFd(void);
     bool      SetFdNonblocking(int32_t fd);
 
     // Resource handler
@@ -90,8 +100,24 @@ private:
     sockaddr_in mAddress;
     // File descriptor for listening
     int32_t mListenFd;
-    // Connection List
-    std::unordered_map<int32_t, std::unique_ptr<Connection>> mConnectionSet;
+    // The epoll set holding the listening socket and all connection sockets
+    int32_t mEpollFd;
+    // Connection limit, overridable via `OTBR_REST_MAX_CONNECTIONS`
+    uint32_t mMaxServeNum;
+    // Slab allocator for connection objects
+    ConnectionPool mConnectionPool;
+    // Tracks the state deadline of every live connection; a connection is
+    // rescheduled whenever it is processed, so a timeout sweep touches only
+    // the expired ones and the mainloop timeout derives from the next
+    // occupied slot.
+    TimerWheel<Connection> mTimerWheel;
+    // Rate limit and change tracking for the pool statistics log.
+    steady_clock::time_point mNextPoolStatsLogTime;
+    size_t                   mLoggedAllocationCount;
+    // Serializes large response bodies off the mainloop
+    WorkerPool mWorkerPool;
+    // Brings completions from the worker threads back to the mainloop
+    TaskRunner mTaskRunner;
 };
 
 } // namespace rest
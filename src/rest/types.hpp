@@ -35,6 +35,8 @@
 #define OTBR_REST_TYPES_HPP_
 
 #include <chrono>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -59,6 +61,7 @@ enum class HttpMethod : std::uint8_t
 enum class HttpStatusCode : std::uint16_t
 {
     kStatusOk                  = 200,
+    kStatusNotModified         = 304,
     kStatusResourceNotFound    = 404,
     kStatusMethodNotAllowed    = 405,
     kStatusRequestTimeout      = 408,
@@ -96,10 +99,25 @@ struct NodeInfo
     std::string    mNetworkName;
 };
 
+// Body of a response serialized off the mainloop; shared between the worker
+// that fills it and the response that adopts it once ready.
+struct DeferredBody
+{
+    std::mutex  mMutex;
+    bool        mReady = false;
+    std::string mBody;
+};
+
 struct DiagInfo
 {
     steady_clock::time_point      mStartTime;
     std::vector<otNetworkDiagTlv> mDiagContent;
+    // Serialized node object, rebuilt only when the node updates
+    std::string mJson;
+    // Expiry-wheel tick of the latest update
+    uint64_t mUpdateTick;
+    // Diagnostic version counter value of the latest update
+    uint64_t mVersion;
 };
 
 } // namespace rest
@@ -0,0 +1,101 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes a worker thread pool for the RESTful HTTP server.
+ */
+
+#ifndef OTBR_REST_WORKER_POOL_HPP_
+#define OTBR_REST_WORKER_POOL_HPP_
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+namespace rest {
+
+/**
+ * This class implements a small worker thread pool executing posted jobs in
+ * order. It runs CPU-bound work such as response serialization off the
+ * mainloop; jobs must not touch the OpenThread APIs.
+ *
+ */
+class WorkerPool : private NonCopyable
+{
+public:
+    /**
+     * This type represents a job executed by a worker thread.
+     *
+     */
+    using Job = std::function<void(void)>;
+
+    /**
+     * The constructor starts the worker threads.
+     *
+     * @param[in] aThreadNum  The number of worker threads.
+     *
+     */
+    explicit WorkerPool(size_t aThreadNum);
+
+    /**
+     * The destructor drains the queued jobs and joins the worker threads.
+     *
+     */
+    ~WorkerPool(void);
+
+    /**
+     * This method posts a job to the pool and returns immediately.
+     *
+     * It is safe to call this method in different threads concurrently.
+     *
+     * @param[in] aJob  The job to be executed by a worker thread.
+     *
+     */
+    void Post(Job aJob);
+
+private:
+    void Run(void);
+
+    std::vector<std::thread> mThreads;
+    std::deque<Job>          mJobs;
+    std::mutex               mMutex;
+    std::condition_variable  mCondition;
+    bool                     mTerminate;
+};
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_WORKER_POOL_HPP_
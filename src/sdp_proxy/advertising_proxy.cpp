@@ -41,16 +41,41 @@
 #error "The Advertising Proxy requires OTBR_ENABLE_MDNS_AVAHI, OTBR_ENABLE_MDNS_MDNSSD or OTBR_ENABLE_MDNS_MOJO"
 #endif
 
+#include <algorithm>
 #include <string>
 
 #include <assert.h>
+#include <string.h>
 
 #include "common/code_utils.hpp"
 #include "common/dns_utils.hpp"
 #include "common/logging.hpp"
+#include "common/metrics.hpp"
+#include "common/tracing.hpp"
 
 namespace otbr {
 
+// FNV-1a parameters for the per-host published-content hash.
+static constexpr uint64_t kFnvOffsetBasis = 0xcbf29ce484222325ull;
+static constexpr uint64_t kFnvPrime       = 0x100000001b3ull;
+
+static uint64_t HashUpdate(uint64_t aHash, const void *aBytes, size_t aLength)
+{
+    const uint8_t *bytes = static_cast<const uint8_t *>(aBytes);
+
+    for (size_t i = 0; i < aLength; ++i)
+    {
+        aHash = (aHash ^ bytes[i]) * kFnvPrime;
+    }
+
+    return aHash;
+}
+
+static uint64_t HashUpdate(uint64_t aHash, const char *aString)
+{
+    return HashUpdate(aHash, aString, strlen(aString) + 1);
+}
+
 static otError OtbrErrorToOtError(otbrError aError)
 {
     otError error;
@@ -121,6 +146,10 @@ void AdvertisingProxy::Stop()
         otSrpServerSetServiceUpdateHandler(GetInstance(), nullptr, nullptr);
     }
 
+    mPendingUpdates.clear();
+    // Abandon any resuming publish-all walk; its posted task is a no-op.
+    mPublishAllInProgress = false;
+
     otbrLogInfo("Stopped");
 }
 
@@ -136,48 +165,121 @@ void AdvertisingProxy::AdvertisingHandler(otSrpServerServiceUpdateId aId,
                                           const otSrpServerHost *    aHost,
                                           uint32_t                   aTimeout)
 {
-    OTBR_UNUSED_VARIABLE(aTimeout);
+    static Metrics::Counter &sUpdates = Metrics::GetInstance().RegisterCounter(
+        "otbr_srp_advertising_updates_total", "Number of SRP service updates received for advertising.");
+    Timepoint now = Clock::now();
+
+    sUpdates.Increment();
+
+    // The host stays valid until the update result is reported, so updates
+    // beyond the concurrency cap can be parked and dispatched later.
+    mPendingUpdates.push_back(PendingUpdate{aId, aHost, now + Milliseconds(aTimeout), now});
+
+    DispatchPendingUpdates();
+}
+
+void AdvertisingProxy::DispatchPendingUpdates(void)
+{
+    while (!mPendingUpdates.empty() && mOutstandingUpdates.size() < mMaxConcurrentUpdates)
+    {
+        // Dispatch the update with the least remaining timeout budget first,
+        // so that small updates are not timed out behind large ones.
+        auto next = std::min_element(
+            mPendingUpdates.begin(), mPendingUpdates.end(),
+            [](const PendingUpdate &aLhs, const PendingUpdate &aRhs) { return aLhs.mDeadline < aRhs.mDeadline; });
+        PendingUpdate update = *next;
+
+        mPendingUpdates.erase(next);
+        AdvertiseUpdate(update.mId, update.mHost, update.mReceivedTime);
+    }
+}
 
-    OutstandingUpdate *update = nullptr;
+void AdvertisingProxy::AdvertiseUpdate(otSrpServerServiceUpdateId aId,
+                                       const otSrpServerHost *    aHost,
+                                       Timepoint                  aReceivedTime)
+{
+    Tracer::Scope      scope("srp", "AdvertiseUpdate");
+    OutstandingUpdate *update = &mOutstandingUpdates[aId];
     otbrError          error  = OTBR_ERROR_NONE;
 
-    mOutstandingUpdates.emplace_back();
-    update      = &mOutstandingUpdates.back();
-    update->mId = aId;
+    update->mId           = aId;
+    update->mReceivedTime = aReceivedTime;
 
     error = PublishHostAndItsServices(aHost, update);
 
+    if (error == OTBR_ERROR_NONE)
+    {
+        mPublishedHostContentHashes[update->mHostName]  = ComputeHostContentHash(aHost);
+        mPublishedHostServicesHashes[update->mHostName] = ComputeHostServicesContentHash(aHost);
+    }
+
     if (error != OTBR_ERROR_NONE || update->mCallbackCount == 0)
     {
-        mOutstandingUpdates.pop_back();
+        UpdateLatencyOnCompletion(*update);
+        mOutstandingUpdates.erase(aId);
         otSrpServerHandleServiceUpdateResult(GetInstance(), aId, OtbrErrorToOtError(error));
     }
 }
 
+void AdvertisingProxy::UpdateLatencyOnCompletion(const OutstandingUpdate &aUpdate)
+{
+    static Metrics::Histogram &sLatency = Metrics::GetInstance().RegisterHistogram(
+        "otbr_srp_advertising_update_latency_ms", "Latency of advertising an SRP update, in milliseconds.");
+    uint32_t latency = std::chrono::duration_cast<Milliseconds>(Clock::now() - aUpdate.mReceivedTime).count();
+
+    sLatency.Observe(latency);
+
+    if (mUpdateEmaLatency == 0)
+    {
+        mUpdateEmaLatency = latency;
+    }
+    else
+    {
+        mUpdateEmaLatency =
+            (latency * MdnsTelemetryInfo::kEmaFactorNumerator +
+             mUpdateEmaLatency * (MdnsTelemetryInfo::kEmaFactorDenominator - MdnsTelemetryInfo::kEmaFactorNumerator)) /
+            MdnsTelemetryInfo::kEmaFactorDenominator;
+    }
+
+    otbrLogDebug("Advertised SRP update (id = %u) in %u ms", aUpdate.mId, latency);
+}
+
 void AdvertisingProxy::OnMdnsPublishResult(otSrpServerServiceUpdateId aUpdateId, otbrError aError)
 {
-    for (auto update = mOutstandingUpdates.begin(); update != mOutstandingUpdates.end(); ++update)
+    Tracer::Scope scope("srp", "OnMdnsPublishResult");
+    auto          it = mOutstandingUpdates.find(aUpdateId);
+
+    VerifyOrExit(it != mOutstandingUpdates.end());
+
+    if (aError != OTBR_ERROR_NONE || it->second.mCallbackCount == 1)
     {
-        if (update->mId != aUpdateId)
+        if (aError != OTBR_ERROR_NONE)
         {
-            continue;
+            // The published content no longer matches the recorded hashes;
+            // make sure the next full walk republishes this host.
+            mPublishedHostContentHashes.erase(it->second.mHostName);
+            mPublishedHostServicesHashes.erase(it->second.mHostName);
         }
 
-        if (aError != OTBR_ERROR_NONE || update->mCallbackCount == 1)
-        {
-            // Erase before notifying OpenThread, because there are chances that new
-            // elements may be added to `otSrpServerHandleServiceUpdateResult` and
-            // the iterator will be invalidated.
-            mOutstandingUpdates.erase(update);
-            otSrpServerHandleServiceUpdateResult(GetInstance(), aUpdateId, OtbrErrorToOtError(aError));
-        }
-        else
-        {
-            --update->mCallbackCount;
-            otbrLogInfo("Waiting for more publishing callbacks %d", update->mCallbackCount);
-        }
-        break;
+        UpdateLatencyOnCompletion(it->second);
+
+        // Erase before notifying OpenThread, because there are chances that new
+        // elements may be added to `otSrpServerHandleServiceUpdateResult` and
+        // the iterator will be invalidated.
+        mOutstandingUpdates.erase(it);
+        otSrpServerHandleServiceUpdateResult(GetInstance(), aUpdateId, OtbrErrorToOtError(aError));
+
+        // A pipeline slot freed up; dispatch the next pending update.
+        DispatchPendingUpdates();
+    }
+    else
+    {
+        --it->second.mCallbackCount;
+        otbrLogInfo("Waiting for more publishing callbacks %d", it->second.mCallbackCount);
     }
+
+exit:
+    return;
 }
 
 std::vector<Ip6Address> AdvertisingProxy::GetEligibleAddresses(const otIp6Address *aHostAddresses,
@@ -205,34 +307,163 @@ std::vector<Ip6Address> AdvertisingProxy::GetEligibleAddresses(const otIp6Addres
     return addresses;
 }
 
+// Per-mainloop-cycle time budget of an incremental publish-all walk.
+static constexpr Microseconds kPublishAllCycleBudget{2000};
+
 void AdvertisingProxy::PublishAllHostsAndServices(void)
 {
-    const otSrpServerHost *host = nullptr;
+    otbrLogInfo("Publish all hosts and services");
 
-    VerifyOrExit(mPublisher.IsStarted(), mPublisher.Start());
+    // A restart while a walk is still resuming simply starts over; the
+    // content hashes keep the already republished hosts cheap.
+    mPublishAllNextIndex  = 0;
+    mPublishAllUnchanged  = 0;
+    mPublishAllInProgress = true;
+
+    ContinuePublishAll();
+}
+
+void AdvertisingProxy::ContinuePublishAll(void)
+{
+    const otSrpServerHost *host  = nullptr;
+    size_t                 index = 0;
+    // The budget measures elapsed time within this cycle, so it needs the
+    // real clock; the cached clock is frozen per mainloop wakeup.
+    Timepoint start = Clock::now();
+
+    VerifyOrExit(mPublishAllInProgress);
+    VerifyOrExit(mPublisher.IsStarted(), (mPublisher.Start(), mPublishAllInProgress = false));
 
-    otbrLogInfo("Publish all hosts and services");
     while ((host = otSrpServerGetNextHost(GetInstance(), host)))
     {
-        PublishHostAndItsServices(host, nullptr);
+        uint64_t    contentHash;
+        std::string hostName;
+        std::string hostDomain;
+
+        if (index++ < mPublishAllNextIndex)
+        {
+            // Handled in an earlier cycle of this walk.
+            continue;
+        }
+
+        contentHash = ComputeHostContentHash(host);
+
+        if (SplitFullHostName(otSrpServerHostGetFullName(host), hostName, hostDomain) == OTBR_ERROR_NONE &&
+            mPublishedHostContentHashes.count(hostName) > 0 && mPublishedHostContentHashes[hostName] == contentHash)
+        {
+            ++mPublishAllUnchanged;
+        }
+        else if (PublishHostAndItsServices(host, nullptr) == OTBR_ERROR_NONE)
+        {
+            mPublishedHostContentHashes[hostName]  = contentHash;
+            mPublishedHostServicesHashes[hostName] = ComputeHostServicesContentHash(host);
+        }
+
+        mPublishAllNextIndex = index;
+
+        if (Clock::now() - start >= kPublishAllCycleBudget)
+        {
+            // Out of budget: resume from the cursor on the next mainloop
+            // cycle so mesh-critical processing runs in between.
+            otbrLogDebug("Publish all: %zu hosts handled, yielding", mPublishAllNextIndex);
+            mTaskRunner.Post(TaskRunner::Priority::kBulk, [this]() { ContinuePublishAll(); });
+            ExitNow();
+        }
+    }
+
+    mPublishAllInProgress = false;
+
+    if (mPublishAllUnchanged > 0)
+    {
+        otbrLogInfo("Skipped %zu hosts with unchanged content", mPublishAllUnchanged);
     }
 
 exit:
     return;
 }
 
+void AdvertisingProxy::HandleMdnsState(Mdns::Publisher::State aState)
+{
+    VerifyOrExit(aState != Mdns::Publisher::State::kReady);
+
+    // The publisher lost its registrations; drop the per-host bookkeeping
+    // so the next `PublishAllHostsAndServices()` republishes everything.
+    mPublishedHostContentHashes.clear();
+    mPublishedHostServicesHashes.clear();
+
+exit:
+    return;
+}
+
+uint64_t AdvertisingProxy::ComputeHostContentHash(const otSrpServerHost *aHost)
+{
+    uint64_t            hash = ComputeHostServicesContentHash(aHost);
+    const otIp6Address *addresses;
+    uint8_t             addressNum;
+
+    addresses = otSrpServerHostGetAddresses(aHost, &addressNum);
+    for (uint8_t i = 0; i < addressNum; ++i)
+    {
+        hash = HashUpdate(hash, addresses[i].mFields.m8, sizeof(addresses[i].mFields.m8));
+    }
+
+    return hash;
+}
+
+uint64_t AdvertisingProxy::ComputeHostServicesContentHash(const otSrpServerHost *aHost)
+{
+    uint64_t                  hash    = kFnvOffsetBasis;
+    bool                      deleted = otSrpServerHostIsDeleted(aHost);
+    const otSrpServerService *service = nullptr;
+
+    hash = HashUpdate(hash, otSrpServerHostGetFullName(aHost));
+    hash = HashUpdate(hash, &deleted, sizeof(deleted));
+
+    while ((service = otSrpServerHostFindNextService(aHost, service, OT_SRP_SERVER_FLAGS_BASE_TYPE_SERVICE_ONLY,
+                                                     /* aServiceName */ nullptr, /* aInstanceName */ nullptr)))
+    {
+        const uint8_t *txtData;
+        uint16_t       txtDataLength  = 0;
+        uint16_t       port           = otSrpServerServiceGetPort(service);
+        bool           serviceDeleted = otSrpServerServiceIsDeleted(service);
+
+        hash = HashUpdate(hash, otSrpServerServiceGetFullName(service));
+        hash = HashUpdate(hash, &serviceDeleted, sizeof(serviceDeleted));
+        hash = HashUpdate(hash, &port, sizeof(port));
+
+        txtData = otSrpServerServiceGetTxtData(service, &txtDataLength);
+        hash    = HashUpdate(hash, txtData, txtDataLength);
+    }
+
+    // Sub-types are separate service entries; hash their names so that a
+    // sub-type-only change still republishes the host.
+    service = nullptr;
+    while ((service = otSrpServerHostFindNextService(
+                aHost, service, (OT_SRP_SERVER_SERVICE_FLAG_SUB_TYPE | OT_SRP_SERVER_SERVICE_FLAG_ACTIVE),
+                /* aServiceName */ nullptr, /* aInstanceName */ nullptr)))
+    {
+        hash = HashUpdate(hash, otSrpServerServiceGetFullName(service));
+    }
+
+    return hash;
+}
+
 otbrError AdvertisingProxy::PublishHostAndItsServices(const otSrpServerHost *aHost, OutstandingUpdate *aUpdate)
 {
-    otbrError                  error = OTBR_ERROR_NONE;
-    std::string                hostName;
-    std::string                hostDomain;
-    const otIp6Address *       hostAddresses;
-    uint8_t                    hostAddressNum;
-    bool                       hostDeleted;
-    const otSrpServerService * service;
-    otSrpServerServiceUpdateId updateId     = 0;
-    bool                       hasUpdate    = false;
-    std::string                fullHostName = otSrpServerHostGetFullName(aHost);
+    using BatchRecord = Mdns::Publisher::BatchRecord;
+
+    otbrError                      error = OTBR_ERROR_NONE;
+    std::string                    hostName;
+    std::string                    hostDomain;
+    const otIp6Address *           hostAddresses;
+    uint8_t                        hostAddressNum;
+    bool                           hostDeleted;
+    const otSrpServerService *     service;
+    otSrpServerServiceUpdateId     updateId     = 0;
+    bool                           hasUpdate    = false;
+    std::string                    fullHostName = otSrpServerHostGetFullName(aHost);
+    std::vector<BatchRecord>       records;
+    std::vector<BatchRecord::Kind> kinds;
 
     otbrLogInfo("Advertise SRP service updates: host=%s", fullHostName.c_str());
 
@@ -244,13 +475,39 @@ otbrError AdvertisingProxy::PublishHostAndItsServices(const otSrpServerHost *aHo
     {
         hasUpdate = true;
         updateId  = aUpdate->mId;
-        aUpdate->mCallbackCount++;
-        aUpdate->mHostName = hostName;
-        service            = nullptr;
-        while ((service = otSrpServerHostFindNextService(aHost, service, OT_SRP_SERVER_FLAGS_BASE_TYPE_SERVICE_ONLY,
-                                                         /* aServiceName */ nullptr, /* aInstanceName */ nullptr)))
+        // The whole batch completes through one aggregated callback.
+        aUpdate->mCallbackCount = 1;
+        aUpdate->mHostName      = hostName;
+    }
+
+    if (!hostDeleted)
+    {
+        auto servicesHash = mPublishedHostServicesHashes.find(hostName);
+
+        // Everything but the address set matches the last successful
+        // publish, so only the AAAA records need to change; update them in
+        // place instead of re-sending the host and every service record.
+        // Sleepy devices cycling SLAAC addresses hit this path on nearly
+        // every SRP renewal.
+        if (servicesHash != mPublishedHostServicesHashes.end() &&
+            servicesHash->second == ComputeHostServicesContentHash(aHost))
         {
-            aUpdate->mCallbackCount++;
+            otbrLogInfo("Advertise SRP updates for host %s: only addresses changed", fullHostName.c_str());
+
+            mPublisher.UpdateHostAddresses(
+                hostName, GetEligibleAddresses(hostAddresses, hostAddressNum),
+                Mdns::Publisher::ResultCallback([this, hasUpdate, updateId, fullHostName](otbrError aError) {
+                    otbrLogResult(aError, "Update addresses of SRP host '%s'", fullHostName.c_str());
+
+                    if (hasUpdate)
+                    {
+                        // An in-place update may complete synchronously;
+                        // report from a posted task so the caller's
+                        // outstanding-update bookkeeping stays valid.
+                        mTaskRunner.Post([this, updateId, aError]() { OnMdnsPublishResult(updateId, aError); });
+                    }
+                }));
+            ExitNow();
         }
     }
 
@@ -262,72 +519,102 @@ otbrError AdvertisingProxy::PublishHostAndItsServices(const otSrpServerHost *aHo
         std::string serviceName;
         std::string serviceType;
         std::string serviceDomain;
+        BatchRecord record;
 
         SuccessOrExit(error = SplitFullServiceInstanceName(fullServiceName, serviceName, serviceType, serviceDomain));
 
         if (!hostDeleted && !otSrpServerServiceIsDeleted(service))
         {
-            Mdns::Publisher::TxtList     txtList     = MakeTxtList(service);
-            Mdns::Publisher::SubTypeList subTypeList = MakeSubTypeList(service);
-
             otbrLogDebug("Publish SRP service '%s'", fullServiceName.c_str());
-            mPublisher.PublishService(
-                hostName, serviceName, serviceType, subTypeList, otSrpServerServiceGetPort(service), txtList,
-                [this, hasUpdate, updateId, fullServiceName](otbrError aError) {
-                    otbrLogResult(aError, "Handle publish SRP service '%s'", fullServiceName.c_str());
-                    if (hasUpdate)
-                    {
-                        OnMdnsPublishResult(updateId, aError);
-                    }
-                });
+            record.mKind        = BatchRecord::Kind::kPublishService;
+            record.mHostName    = hostName;
+            record.mName        = std::move(serviceName);
+            record.mType        = std::move(serviceType);
+            record.mSubTypeList = MakeSubTypeList(service);
+            record.mPort        = otSrpServerServiceGetPort(service);
+            record.mTxtList     = MakeTxtList(service);
         }
         else
         {
             otbrLogDebug("Unpublish SRP service '%s'", fullServiceName.c_str());
-            mPublisher.UnpublishService(
-                serviceName, serviceType, [this, hasUpdate, updateId, fullServiceName](otbrError aError) {
-                    // Treat `NOT_FOUND` as success when unpublishing service
-                    aError = (aError == OTBR_ERROR_NOT_FOUND) ? OTBR_ERROR_NONE : aError;
-                    otbrLogResult(aError, "Handle unpublish SRP service '%s'", fullServiceName.c_str());
-                    if (hasUpdate)
-                    {
-                        OnMdnsPublishResult(updateId, aError);
-                    }
-                });
+            record.mKind = BatchRecord::Kind::kUnpublishService;
+            record.mName = std::move(serviceName);
+            record.mType = std::move(serviceType);
         }
+
+        records.push_back(std::move(record));
     }
 
-    if (!hostDeleted)
     {
-        std::vector<Ip6Address> addresses;
+        BatchRecord record;
 
-        // TODO: select a preferred address or advertise all addresses from SRP client.
-        otbrLogDebug("Publish SRP host '%s'", fullHostName.c_str());
+        if (!hostDeleted)
+        {
+            // TODO: select a preferred address or advertise all addresses from SRP client.
+            otbrLogDebug("Publish SRP host '%s'", fullHostName.c_str());
+            record.mKind      = BatchRecord::Kind::kPublishHost;
+            record.mName      = hostName;
+            record.mAddresses = GetEligibleAddresses(hostAddresses, hostAddressNum);
+        }
+        else
+        {
+            otbrLogDebug("Unpublish SRP host '%s'", fullHostName.c_str());
+            record.mKind = BatchRecord::Kind::kUnpublishHost;
+            record.mName = hostName;
+        }
 
-        addresses = GetEligibleAddresses(hostAddresses, hostAddressNum);
-        mPublisher.PublishHost(
-            hostName, addresses,
-            Mdns::Publisher::ResultCallback([this, hasUpdate, updateId, fullHostName](otbrError aError) {
-                otbrLogResult(aError, "Handle publish SRP host '%s'", fullHostName.c_str());
-                if (hasUpdate)
-                {
-                    OnMdnsPublishResult(updateId, aError);
-                }
-            }));
+        records.push_back(std::move(record));
     }
-    else
+
+    kinds.reserve(records.size());
+    for (const BatchRecord &record : records)
     {
-        otbrLogDebug("Unpublish SRP host '%s'", fullHostName.c_str());
-        mPublisher.UnpublishHost(hostName, [this, hasUpdate, updateId, fullHostName](otbrError aError) {
-            // Treat `NOT_FOUND` as success when unpublishing host.
-            aError = (aError == OTBR_ERROR_NOT_FOUND) ? OTBR_ERROR_NONE : aError;
-            otbrLogResult(aError, "Handle unpublish SRP host '%s'", fullHostName.c_str());
-            if (hasUpdate)
+        kinds.push_back(record.mKind);
+    }
+
+    mPublisher.PublishBatch(std::move(records), Mdns::Publisher::BatchResultCallback([this, hasUpdate, updateId,
+                                                                                      fullHostName, kinds](
+                                                                                         const std::vector<otbrError>
+                                                                                             &aErrors) {
+        otbrError combined = OTBR_ERROR_NONE;
+        size_t    failed   = 0;
+
+        for (size_t i = 0; i < aErrors.size(); i++)
+        {
+            otbrError recordError = aErrors[i];
+            bool      isUnpublish =
+                kinds[i] == BatchRecord::Kind::kUnpublishService || kinds[i] == BatchRecord::Kind::kUnpublishHost;
+
+            // Treat `NOT_FOUND` as success when un-publishing.
+            if (isUnpublish && recordError == OTBR_ERROR_NOT_FOUND)
             {
-                OnMdnsPublishResult(updateId, aError);
+                recordError = OTBR_ERROR_NONE;
             }
-        });
-    }
+
+            if (recordError != OTBR_ERROR_NONE)
+            {
+                failed++;
+
+                if (combined == OTBR_ERROR_NONE)
+                {
+                    combined = recordError;
+                }
+            }
+        }
+
+        if (failed > 0)
+        {
+            otbrLogWarning("Advertising SRP host '%s': %zu of %zu records failed", fullHostName.c_str(), failed,
+                           aErrors.size());
+        }
+
+        otbrLogResult(combined, "Handle advertising SRP host '%s' and its services", fullHostName.c_str());
+
+        if (hasUpdate)
+        {
+            OnMdnsPublishResult(updateId, combined);
+        }
+    }));
 
 exit:
     if (error != OTBR_ERROR_NONE)
@@ -38,10 +38,13 @@
 
 #include <stdint.h>
 
+#include <unordered_map>
+
 #include <openthread/instance.h>
 #include <openthread/srp_server.h>
 
 #include "common/code_utils.hpp"
+#include "common/time.hpp"
 #include "mdns/mdns.hpp"
 #include "ncp/ncp_openthread.hpp"
 
@@ -81,15 +84,65 @@ public:
     /**
      * This method publishes all registered hosts and services.
      *
+     * Hosts whose content is unchanged since their last successful publish
+     * are skipped, so that a publisher state flip does not republish the
+     * whole SRP registry. The walk is incremental: each mainloop cycle
+     * processes hosts within a small time budget and the remainder resumes
+     * from a posted task, so a bulk republish of a large registry never
+     * blocks mesh-critical processing.
+     *
      */
     void PublishAllHostsAndServices(void);
 
+    /**
+     * This method handles mDNS publisher state changes.
+     *
+     * When the publisher leaves the ready state its registrations are lost,
+     * so the per-host publish bookkeeping is dropped to force a full
+     * republish on the next `PublishAllHostsAndServices()`.
+     *
+     * @param[in] aState  The new mDNS publisher state.
+     *
+     */
+    void HandleMdnsState(Mdns::Publisher::State aState);
+
+    /**
+     * This method sets the maximum number of SRP updates advertised to the
+     * mDNS backend concurrently; further updates are queued and dispatched
+     * by remaining timeout budget.
+     *
+     * @param[in] aLimit  The concurrency cap; MUST be greater than 0.
+     *
+     */
+    void SetMaxConcurrentUpdates(size_t aLimit) { mMaxConcurrentUpdates = aLimit; }
+
+    /**
+     * This method returns the EMA latency of completed SRP updates in
+     * milliseconds, measured from SRP server hand-off to the last mDNS
+     * callback.
+     *
+     * @returns The EMA latency of SRP updates in milliseconds.
+     *
+     */
+    uint32_t GetUpdateEmaLatency(void) const { return mUpdateEmaLatency; }
+
 private:
+    static constexpr size_t kDefaultMaxConcurrentUpdates = 8;
+
     struct OutstandingUpdate
     {
         otSrpServerServiceUpdateId mId;                // The ID of the SRP service update transaction.
         std::string                mHostName;          // The host name.
         uint32_t                   mCallbackCount = 0; // The number of callbacks which we are waiting for.
+        Timepoint                  mReceivedTime;      // When the SRP server handed the update to the proxy.
+    };
+
+    struct PendingUpdate
+    {
+        otSrpServerServiceUpdateId mId;           // The ID of the SRP service update transaction.
+        const otSrpServerHost *    mHost;         // The host of the update; valid until the result is reported.
+        Timepoint                  mDeadline;     // When the SRP server will time the update out.
+        Timepoint                  mReceivedTime; // When the SRP server handed the update to the proxy.
     };
 
     static void AdvertisingHandler(otSrpServerServiceUpdateId aId,
@@ -104,6 +157,14 @@ private:
 
     std::vector<Ip6Address> GetEligibleAddresses(const otIp6Address *aHostAddresses, uint8_t aHostAddressNum);
 
+    static uint64_t ComputeHostContentHash(const otSrpServerHost *aHost);
+    static uint64_t ComputeHostServicesContentHash(const otSrpServerHost *aHost);
+
+    void DispatchPendingUpdates(void);
+    void AdvertiseUpdate(otSrpServerServiceUpdateId aId, const otSrpServerHost *aHost, Timepoint aReceivedTime);
+    void UpdateLatencyOnCompletion(const OutstandingUpdate &aUpdate);
+    void ContinuePublishAll(void);
+
     /**
      * This method publishes a specified host and its services.
      *
@@ -127,8 +188,39 @@ private:
     // A reference to the mDNS publisher, has no ownership.
     Mdns::Publisher &mPublisher;
 
-    // A vector that tracks outstanding updates.
-    std::vector<OutstandingUpdate> mOutstandingUpdates;
+    // Outstanding updates indexed by their SRP service update ID, so each
+    // publish completion callback finds its update in O(1).
+    std::unordered_map<otSrpServerServiceUpdateId, OutstandingUpdate> mOutstandingUpdates;
+
+    // Content hash of each successfully published host, keyed by host name;
+    // used to skip unchanged hosts in `PublishAllHostsAndServices()`.
+    std::unordered_map<std::string, uint64_t> mPublishedHostContentHashes;
+
+    // Hash of the non-address content (services, ports, TXT, sub-types) of
+    // each successfully published host; an update whose services hash is
+    // unchanged only touched the address set and goes through the in-place
+    // address update of the publisher.
+    std::unordered_map<std::string, uint64_t> mPublishedHostServicesHashes;
+
+    // Updates waiting for a free slot in the advertising pipeline; the one
+    // with the least remaining timeout budget is dispatched first.
+    std::vector<PendingUpdate> mPendingUpdates;
+
+    // The maximum number of updates advertised concurrently.
+    size_t mMaxConcurrentUpdates = kDefaultMaxConcurrentUpdates;
+
+    // The EMA latency of completed SRP updates in milliseconds.
+    uint32_t mUpdateEmaLatency = 0;
+
+    // Progress of an incremental `PublishAllHostsAndServices()` walk. The
+    // cursor counts hosts already handled; each resumed cycle skips that
+    // many entries of the SRP server host list (cheap pointer hops) before
+    // spending its time budget on the rest. A host removed mid-walk can
+    // make the skip land one entry off, which at worst republishes a host
+    // the content hashes would have skipped.
+    size_t mPublishAllNextIndex  = 0;
+    size_t mPublishAllUnchanged  = 0;
+    bool   mPublishAllInProgress = false;
 
     // Task runner for running tasks in the context of the main thread.
     TaskRunner mTaskRunner;
@@ -39,15 +39,23 @@
 
 #include <algorithm>
 #include <string>
+#include <vector>
 
 #include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
 
 #include <openthread/dnssd_server.h>
 
 #include "common/code_utils.hpp"
 #include "common/dns_utils.hpp"
 #include "common/logging.hpp"
+#include "common/metrics.hpp"
 #include "utils/dns_utils.hpp"
+#include "utils/hex.hpp"
 #include "utils/string_utils.hpp"
 
 namespace otbr {
@@ -58,6 +66,38 @@ static inline bool DnsLabelsEqual(const std::string &aLabel1, const std::string
     return StringUtils::EqualCaseInsensitive(aLabel1, aLabel2);
 }
 
+static uint32_t AgeInSeconds(Timepoint aDiscoveredAt)
+{
+    return static_cast<uint32_t>(std::chrono::duration_cast<Seconds>(CachedClock::Now() - aDiscoveredAt).count());
+}
+
+// Where the result caches are persisted across agent restarts.
+static const char kCachePath[] = "/var/run/otbr-discovery-proxy.cache";
+
+static std::string BytesToHexString(const uint8_t *aBytes, size_t aLength)
+{
+    std::vector<char> buffer(aLength * 2 + 1);
+
+    Utils::Bytes2Hex(aBytes, static_cast<uint16_t>(aLength), buffer.data());
+
+    return std::string(buffer.data());
+}
+
+static bool HexStringToBytes(const char *aHex, std::vector<uint8_t> &aBytes)
+{
+    bool ok = false;
+    int  length;
+
+    aBytes.resize(strlen(aHex) / 2 + 1);
+    length = Utils::Hex2Bytes(aHex, aBytes.data(), static_cast<uint16_t>(aBytes.size()));
+    VerifyOrExit(length >= 0, aBytes.clear());
+    aBytes.resize(static_cast<size_t>(length));
+    ok = true;
+
+exit:
+    return ok;
+}
+
 DiscoveryProxy::DiscoveryProxy(Ncp::ControllerOpenThread &aNcp, Mdns::Publisher &aPublisher)
     : mNcp(aNcp)
     , mMdnsPublisher(aPublisher)
@@ -76,17 +116,34 @@ void DiscoveryProxy::Start(void)
                              &DiscoveryProxy::OnDiscoveryProxyUnsubscribe, this);
 
     mSubscriberId = mMdnsPublisher.AddSubscriptionCallbacks(
-        [this](const std::string &aType, const Mdns::Publisher::DiscoveredInstanceInfo &aInstanceInfo) {
-            if (!aInstanceInfo.mRemoved)
+        [this](const std::string &aType, const std::vector<Mdns::Publisher::DiscoveredInstanceInfo> &aInstances) {
+            for (const auto &instanceInfo : aInstances)
             {
-                OnServiceDiscovered(aType, aInstanceInfo);
+                CacheServiceInstance(aType, instanceInfo);
+
+                if (!instanceInfo.mRemoved)
+                {
+                    OnServiceDiscovered(aType, instanceInfo, 0);
+                }
             }
         },
 
         [this](const std::string &aHostName, const Mdns::Publisher::DiscoveredHostInfo &aHostInfo) {
-            OnHostDiscovered(aHostName, aHostInfo);
+            CachedHost &cached = mCachedHosts[StringUtils::ToLowercase(aHostName)];
+
+            cached.mInfo         = aHostInfo;
+            cached.mDiscoveredAt = CachedClock::Now();
+            ScheduleCacheSave();
+            OnHostDiscovered(aHostName, aHostInfo, 0);
         });
 
+    // Answer proxied queries from the previous run's results while the fresh
+    // browses warm up; a restarted agent otherwise starts with empty caches.
+    if (mCachedInstances.empty() && mCachedHosts.empty())
+    {
+        LoadCache();
+    }
+
     otbrLogInfo("Started");
 }
 
@@ -100,6 +157,10 @@ void DiscoveryProxy::Stop(void)
         mSubscriberId = 0;
     }
 
+    mSubscriptions.clear();
+    mCachedInstances.clear();
+    mCachedHosts.clear();
+
     otbrLogInfo("Stopped");
 }
 
@@ -110,22 +171,45 @@ void DiscoveryProxy::OnDiscoveryProxySubscribe(void *aContext, const char *aFull
 
 void DiscoveryProxy::OnDiscoveryProxySubscribe(const char *aFullName)
 {
-    std::string fullName(aFullName);
-    DnsNameInfo nameInfo = SplitFullDnsName(fullName);
+    std::string   fullName(aFullName);
+    DnsNameInfo   nameInfo     = SplitFullDnsName(fullName);
+    Subscription &subscription = mSubscriptions[StringUtils::ToLowercase(fullName)];
 
-    otbrLogInfo("Subscribe: %s", fullName.c_str());
+    otbrLogInfo("Subscribe: %s (ref %u)", fullName.c_str(), subscription.mRefCount + 1);
 
-    if (GetServiceSubscriptionCount(nameInfo) == 1)
+    if (++subscription.mRefCount > 1)
     {
-        if (nameInfo.mHostName.empty())
-        {
-            mMdnsPublisher.SubscribeService(nameInfo.mServiceName, nameInfo.mInstanceName);
-        }
-        else
-        {
-            mMdnsPublisher.SubscribeHost(nameInfo.mHostName);
-        }
+        // An identical query already drives a backend browse; answer the
+        // new client from the shared result cache.
+        ReplayFromCache(nameInfo);
+        ExitNow();
+    }
+
+    {
+        static Metrics::Counter &sQueries = Metrics::GetInstance().RegisterCounter(
+            "otbr_discovery_proxy_queries_total", "Number of Thread-side DNS queries handled by the discovery proxy.");
+
+        sQueries.Increment();
+    }
+
+    subscription.mSubscribeTime = Clock::now();
+
+    // A new browse may still have usable records cached from an earlier
+    // subscription: answer from them immediately while they are within
+    // their TTLs, and let the backend subscription below refresh them.
+    ReplayFromCache(nameInfo);
+
+    if (nameInfo.mHostName.empty())
+    {
+        mMdnsPublisher.SubscribeService(nameInfo.mServiceName, nameInfo.mInstanceName);
+    }
+    else
+    {
+        mMdnsPublisher.SubscribeHost(nameInfo.mHostName);
     }
+
+exit:
+    return;
 }
 
 void DiscoveryProxy::OnDiscoveryProxyUnsubscribe(void *aContext, const char *aFullName)
@@ -137,28 +221,48 @@ void DiscoveryProxy::OnDiscoveryProxyUnsubscribe(const char *aFullName)
 {
     std::string fullName(aFullName);
     DnsNameInfo nameInfo = SplitFullDnsName(fullName);
+    auto        it       = mSubscriptions.find(StringUtils::ToLowercase(fullName));
+
+    VerifyOrExit(it != mSubscriptions.end(),
+                 otbrLogWarning("Unsubscribe without matching subscription: %s", fullName.c_str()));
+
+    otbrLogInfo("Unsubscribe: %s (ref %u)", fullName.c_str(), it->second.mRefCount);
 
-    otbrLogInfo("Unsubscribe: %s", fullName.c_str());
+    VerifyOrExit(--it->second.mRefCount == 0);
 
-    if (GetServiceSubscriptionCount(nameInfo) == 1)
+    if (!it->second.mAnswered)
     {
-        if (nameInfo.mHostName.empty())
-        {
-            mMdnsPublisher.UnsubscribeService(nameInfo.mServiceName, nameInfo.mInstanceName);
-        }
-        else
-        {
-            mMdnsPublisher.UnsubscribeHost(nameInfo.mHostName);
-        }
+        static Metrics::Histogram &sTimeoutLatency = Metrics::GetInstance().RegisterHistogram(
+            "otbr_discovery_proxy_query_timeout_usec",
+            "Lifetime of Thread-side DNS queries that ended without any discovered record, in microseconds.");
+
+        sTimeoutLatency.Observe(static_cast<uint64_t>(
+            std::chrono::duration_cast<Microseconds>(Clock::now() - it->second.mSubscribeTime).count()));
     }
+
+    mSubscriptions.erase(it);
+
+    if (nameInfo.mHostName.empty())
+    {
+        mMdnsPublisher.UnsubscribeService(nameInfo.mServiceName, nameInfo.mInstanceName);
+    }
+    else
+    {
+        mMdnsPublisher.UnsubscribeHost(nameInfo.mHostName);
+    }
+
+exit:
+    return;
 }
 
 void DiscoveryProxy::OnServiceDiscovered(const std::string &                            aType,
-                                         const Mdns::Publisher::DiscoveredInstanceInfo &aInstanceInfo)
+                                         const Mdns::Publisher::DiscoveredInstanceInfo &aInstanceInfo,
+                                         uint32_t                                       aAgeSeconds)
 {
     otDnssdServiceInstanceInfo instanceInfo;
     const otDnssdQuery *       query                 = nullptr;
     std::string                unescapedInstanceName = DnsUtils::UnescapeInstanceName(aInstanceInfo.mName);
+    std::string                translatedDomain;
 
     otbrLogInfo("Service discovered: %s, instance %s hostname %s addresses %zu port %d priority %d "
                 "weight %d",
@@ -181,7 +285,9 @@ void DiscoveryProxy::OnServiceDiscovered(const std::string &
     instanceInfo.mWeight    = aInstanceInfo.mWeight;
     instanceInfo.mTxtLength = static_cast<uint16_t>(aInstanceInfo.mTxtData.size());
     instanceInfo.mTxtData   = aInstanceInfo.mTxtData.data();
-    instanceInfo.mTtl       = CapTtl(aInstanceInfo.mTtl);
+    // A cached record has aged since discovery; callers only replay records
+    // still within their TTLs, so the remaining lifetime stays positive.
+    instanceInfo.mTtl = CapTtl(aInstanceInfo.mTtl - aAgeSeconds);
 
     while ((query = otDnssdGetNextQuery(mNcp.GetInstance(), query)) != nullptr)
     {
@@ -215,20 +321,30 @@ void DiscoveryProxy::OnServiceDiscovered(const std::string &
         if (DnsLabelsEqual(serviceName, aType) &&
             (instanceName.empty() || DnsLabelsEqual(instanceName, unescapedInstanceName)))
         {
-            std::string serviceFullName    = aType + "." + domain;
-            std::string translatedHostName = TranslateDomain(aInstanceInfo.mHostName, domain);
-            std::string instanceFullName   = unescapedInstanceName + "." + serviceFullName;
+            // Assemble the translated names in reused scratch buffers, and
+            // only when the query domain differs from the previous match;
+            // OpenThread doesn't reference them after the call returns.
+            if (translatedDomain != domain)
+            {
+                mServiceFullNameBuffer.assign(aType).append(".").append(domain);
+                TranslateDomain(aInstanceInfo.mHostName, domain, mHostFullNameBuffer);
+                mInstanceFullNameBuffer.assign(unescapedInstanceName).append(".").append(mServiceFullNameBuffer);
+                translatedDomain = domain;
+            }
 
-            instanceInfo.mFullName = instanceFullName.c_str();
-            instanceInfo.mHostName = translatedHostName.c_str();
+            instanceInfo.mFullName = mInstanceFullNameBuffer.c_str();
+            instanceInfo.mHostName = mHostFullNameBuffer.c_str();
 
-            otDnssdQueryHandleDiscoveredServiceInstance(mNcp.GetInstance(), serviceFullName.c_str(), &instanceInfo);
+            otDnssdQueryHandleDiscoveredServiceInstance(mNcp.GetInstance(), mServiceFullNameBuffer.c_str(),
+                                                        &instanceInfo);
+            MarkQueryAnswered(queryName);
         }
     }
 }
 
 void DiscoveryProxy::OnHostDiscovered(const std::string &                        aHostName,
-                                      const Mdns::Publisher::DiscoveredHostInfo &aHostInfo)
+                                      const Mdns::Publisher::DiscoveredHostInfo &aHostInfo,
+                                      uint32_t                                   aAgeSeconds)
 {
     otDnssdHostInfo     hostInfo;
     const otDnssdQuery *query            = nullptr;
@@ -252,7 +368,7 @@ void DiscoveryProxy::OnHostDiscovered(const std::string &
         hostInfo.mAddresses = nullptr;
     }
 
-    hostInfo.mTtl = CapTtl(aHostInfo.mTtl);
+    hostInfo.mTtl = CapTtl(aHostInfo.mTtl - aAgeSeconds);
 
     while ((query = otDnssdGetNextQuery(mNcp.GetInstance(), query)) != nullptr)
     {
@@ -272,48 +388,342 @@ void DiscoveryProxy::OnHostDiscovered(const std::string &
 
         if (DnsLabelsEqual(hostName, aHostName))
         {
-            std::string hostFullName = TranslateDomain(resolvedHostName, domain);
+            TranslateDomain(resolvedHostName, domain, mHostFullNameBuffer);
 
-            otDnssdQueryHandleDiscoveredHost(mNcp.GetInstance(), hostFullName.c_str(), &hostInfo);
+            otDnssdQueryHandleDiscoveredHost(mNcp.GetInstance(), mHostFullNameBuffer.c_str(), &hostInfo);
+            MarkQueryAnswered(queryName);
         }
     }
 }
 
-std::string DiscoveryProxy::TranslateDomain(const std::string &aName, const std::string &aTargetDomain)
+void DiscoveryProxy::MarkQueryAnswered(const char *aQueryName)
+{
+    static Metrics::Histogram &sHitLatency = Metrics::GetInstance().RegisterHistogram(
+        "otbr_discovery_proxy_query_hit_usec",
+        "Latency from Thread-side DNS query arrival to the first discovered record, in microseconds.");
+    auto it = mSubscriptions.find(StringUtils::ToLowercase(aQueryName));
+
+    VerifyOrExit(it != mSubscriptions.end());
+    // Only the first discovered record scores the query; later records for
+    // the same browse refresh results and carry no latency information.
+    VerifyOrExit(!it->second.mAnswered);
+
+    it->second.mAnswered = true;
+    sHitLatency.Observe(static_cast<uint64_t>(
+        std::chrono::duration_cast<Microseconds>(Clock::now() - it->second.mSubscribeTime).count()));
+
+exit:
+    return;
+}
+
+void DiscoveryProxy::TranslateDomain(const std::string &aName,
+                                     const std::string &aTargetDomain,
+                                     std::string &      aTargetName)
 {
-    std::string targetName;
     std::string hostName;
     std::string domain;
 
-    VerifyOrExit(OTBR_ERROR_NONE == SplitFullHostName(aName, hostName, domain), targetName = aName);
-    VerifyOrExit(DnsLabelsEqual(domain, "local."), targetName = aName);
+    VerifyOrExit(OTBR_ERROR_NONE == SplitFullHostName(aName, hostName, domain), aTargetName = aName);
+    VerifyOrExit(DnsLabelsEqual(domain, "local."), aTargetName = aName);
 
-    targetName = hostName + "." + aTargetDomain;
+    aTargetName.assign(hostName).append(".").append(aTargetDomain);
 
 exit:
-    otbrLogDebug("Translate domain: %s => %s", aName.c_str(), targetName.c_str());
-    return targetName;
+    otbrLogDebug("Translate domain: %s => %s", aName.c_str(), aTargetName.c_str());
 }
 
-int DiscoveryProxy::GetServiceSubscriptionCount(const DnsNameInfo &aNameInfo) const
+void DiscoveryProxy::CacheServiceInstance(const std::string &                            aType,
+                                          const Mdns::Publisher::DiscoveredInstanceInfo &aInstanceInfo)
 {
-    const otDnssdQuery *query = nullptr;
-    int                 count = 0;
+    std::vector<CachedInstance> &instances =
+        mCachedInstances[Mdns::NameInterner::GetInstance().Intern(aType).GetLowercaseId()];
+    auto                         it =
+        std::find_if(instances.begin(), instances.end(), [&aInstanceInfo](const CachedInstance &aCached) {
+            return DnsLabelsEqual(aCached.mInfo.mName, aInstanceInfo.mName);
+        });
 
-    while ((query = otDnssdGetNextQuery(mNcp.GetInstance(), query)) != nullptr)
+    if (aInstanceInfo.mRemoved)
+    {
+        if (it != instances.end())
+        {
+            instances.erase(it);
+        }
+    }
+    else if (it != instances.end())
+    {
+        it->mInfo         = aInstanceInfo;
+        it->mDiscoveredAt = CachedClock::Now();
+    }
+    else
+    {
+        CachedInstance cached;
+
+        cached.mInfo         = aInstanceInfo;
+        cached.mDiscoveredAt = CachedClock::Now();
+        instances.push_back(std::move(cached));
+    }
+
+    ScheduleCacheSave();
+}
+
+void DiscoveryProxy::ReplayFromCache(const DnsNameInfo &aNameInfo)
+{
+    if (aNameInfo.mHostName.empty())
     {
-        char        queryName[OT_DNS_MAX_NAME_SIZE];
-        DnsNameInfo queryInfo;
+        auto it =
+            mCachedInstances.find(Mdns::NameInterner::GetInstance().Intern(aNameInfo.mServiceName).GetLowercaseId());
+
+        VerifyOrExit(it != mCachedInstances.end());
 
-        otDnssdGetQueryTypeAndName(query, &queryName);
-        queryInfo = SplitFullDnsName(queryName);
+        for (size_t i = 0; i < it->second.size();)
+        {
+            const CachedInstance &cached = it->second[i];
+            uint32_t              age    = AgeInSeconds(cached.mDiscoveredAt);
 
-        count += (DnsLabelsEqual(aNameInfo.mInstanceName, queryInfo.mInstanceName) &&
-                  DnsLabelsEqual(aNameInfo.mServiceName, queryInfo.mServiceName) &&
-                  DnsLabelsEqual(aNameInfo.mHostName, queryInfo.mHostName));
+            if (age >= cached.mInfo.mTtl)
+            {
+                // The record outlived its TTL while cached; drop it so a
+                // stale instance is never replayed to a client.
+                it->second.erase(it->second.begin() + i);
+                continue;
+            }
+
+            if (aNameInfo.mInstanceName.empty() ||
+                DnsLabelsEqual(aNameInfo.mInstanceName, DnsUtils::UnescapeInstanceName(cached.mInfo.mName)))
+            {
+                OnServiceDiscovered(aNameInfo.mServiceName, cached.mInfo, age);
+            }
+
+            i++;
+        }
+    }
+    else
+    {
+        auto     it = mCachedHosts.find(StringUtils::ToLowercase(aNameInfo.mHostName));
+        uint32_t age;
+
+        VerifyOrExit(it != mCachedHosts.end());
+
+        age = AgeInSeconds(it->second.mDiscoveredAt);
+
+        if (age >= it->second.mInfo.mTtl)
+        {
+            mCachedHosts.erase(it);
+            ExitNow();
+        }
+
+        OnHostDiscovered(aNameInfo.mHostName, it->second.mInfo, age);
+    }
+
+exit:
+    return;
+}
+
+void DiscoveryProxy::LoadCache(void)
+{
+    FILE *   file = fopen(kCachePath, "r");
+    char     line[2048];
+    uint64_t now    = static_cast<uint64_t>(time(nullptr));
+    size_t   loaded = 0;
+
+    VerifyOrExit(file != nullptr);
+
+    while (fgets(line, sizeof(line), file) != nullptr)
+    {
+        uint64_t wallTime;
+        uint32_t ttl;
+        uint32_t age;
+        unsigned port;
+        unsigned priority;
+        unsigned weight;
+        char     key[128];
+        char     nameHex[513];
+        char     hostName[256];
+        char     txtHex[1025];
+        char     addressesHex[1025];
+
+        if (sscanf(line, "I %" SCNu64 " %" SCNu32 " %u %u %u %127s %512s %255s %1024s %1024s", &wallTime, &ttl, &port,
+                   &priority, &weight, key, nameHex, hostName, txtHex, addressesHex) == 10)
+        {
+            std::vector<uint8_t> nameBytes;
+            std::vector<uint8_t> addressBytes;
+            CachedInstance       cached;
+
+            age = (wallTime < now) ? static_cast<uint32_t>(now - wallTime) : 0;
+
+            // A record that outlived its mDNS TTL while the agent was down
+            // must not be served; only still-fresh entries are reloaded.
+            if (age >= ttl || !HexStringToBytes(nameHex, nameBytes))
+            {
+                continue;
+            }
+
+            if (strcmp(txtHex, "-") != 0 && !HexStringToBytes(txtHex, cached.mInfo.mTxtData))
+            {
+                continue;
+            }
+
+            if (strcmp(addressesHex, "-") != 0)
+            {
+                if (!HexStringToBytes(addressesHex, addressBytes) || (addressBytes.size() % sizeof(Ip6Address)) != 0)
+                {
+                    continue;
+                }
+
+                for (size_t offset = 0; offset < addressBytes.size(); offset += sizeof(Ip6Address))
+                {
+                    Ip6Address address;
+
+                    memcpy(address.m8, &addressBytes[offset], sizeof(address.m8));
+                    cached.mInfo.mAddresses.push_back(address);
+                }
+            }
+
+            cached.mInfo.mName     = std::string(nameBytes.begin(), nameBytes.end());
+            cached.mInfo.mHostName = (strcmp(hostName, "-") == 0) ? "" : hostName;
+            cached.mInfo.mPort     = static_cast<uint16_t>(port);
+            cached.mInfo.mPriority = static_cast<uint16_t>(priority);
+            cached.mInfo.mWeight   = static_cast<uint16_t>(weight);
+            cached.mInfo.mTtl      = ttl;
+            // Reconstruct the discovery time so the remaining TTL keeps
+            // counting down from where the previous run left off.
+            cached.mDiscoveredAt = CachedClock::Now() - Seconds(age);
+
+            mCachedInstances[Mdns::NameInterner::GetInstance().Intern(key).GetLowercaseId()].push_back(
+                std::move(cached));
+            loaded++;
+        }
+        else if (sscanf(line, "H %" SCNu64 " %" SCNu32 " %127s %255s %1024s", &wallTime, &ttl, key, hostName,
+                        addressesHex) == 5)
+        {
+            std::vector<uint8_t> addressBytes;
+            CachedHost           cached;
+
+            age = (wallTime < now) ? static_cast<uint32_t>(now - wallTime) : 0;
+
+            if (age >= ttl)
+            {
+                continue;
+            }
+
+            if (strcmp(addressesHex, "-") != 0)
+            {
+                if (!HexStringToBytes(addressesHex, addressBytes) || (addressBytes.size() % sizeof(Ip6Address)) != 0)
+                {
+                    continue;
+                }
+
+                for (size_t offset = 0; offset < addressBytes.size(); offset += sizeof(Ip6Address))
+                {
+                    Ip6Address address;
+
+                    memcpy(address.m8, &addressBytes[offset], sizeof(address.m8));
+                    cached.mInfo.mAddresses.push_back(address);
+                }
+            }
+
+            cached.mInfo.mHostName = (strcmp(hostName, "-") == 0) ? "" : hostName;
+            cached.mInfo.mTtl      = ttl;
+            cached.mDiscoveredAt   = CachedClock::Now() - Seconds(age);
+
+            mCachedHosts[key] = std::move(cached);
+            loaded++;
+        }
     }
 
-    return count;
+    fclose(file);
+
+    otbrLogInfo("Loaded %zu cached discovery results from %s", loaded, kCachePath);
+
+exit:
+    return;
+}
+
+void DiscoveryProxy::SaveCache(void)
+{
+    std::string tmpPath = std::string(kCachePath) + ".tmp";
+    FILE *      file    = fopen(tmpPath.c_str(), "w");
+    uint64_t    now     = static_cast<uint64_t>(time(nullptr));
+
+    VerifyOrExit(file != nullptr,
+                 otbrLogWarning("Failed to open cache file %s: %s", tmpPath.c_str(), strerror(errno)));
+
+    for (const auto &entry : mCachedInstances)
+    {
+        const std::string &typeKey = Mdns::NameInterner::GetInstance().GetString(entry.first);
+
+        for (const CachedInstance &cached : entry.second)
+        {
+            const Mdns::Publisher::DiscoveredInstanceInfo &info = cached.mInfo;
+            std::string                                    addressesHex;
+
+            // Keys and host names are whitespace-free DNS names; instance
+            // names may contain spaces and are stored hex-encoded.
+            if (info.mName.empty() || typeKey.find(' ') != std::string::npos ||
+                info.mHostName.find(' ') != std::string::npos)
+            {
+                continue;
+            }
+
+            for (const Ip6Address &address : info.mAddresses)
+            {
+                addressesHex += BytesToHexString(address.m8, sizeof(address.m8));
+            }
+
+            fprintf(file, "I %" PRIu64 " %" PRIu32 " %u %u %u %s %s %s %s %s\n",
+                    now - AgeInSeconds(cached.mDiscoveredAt), info.mTtl, info.mPort, info.mPriority, info.mWeight,
+                    typeKey.c_str(),
+                    BytesToHexString(reinterpret_cast<const uint8_t *>(info.mName.data()), info.mName.size()).c_str(),
+                    info.mHostName.empty() ? "-" : info.mHostName.c_str(),
+                    info.mTxtData.empty() ? "-" : BytesToHexString(info.mTxtData.data(), info.mTxtData.size()).c_str(),
+                    addressesHex.empty() ? "-" : addressesHex.c_str());
+        }
+    }
+
+    for (const auto &entry : mCachedHosts)
+    {
+        const Mdns::Publisher::DiscoveredHostInfo &info = entry.second.mInfo;
+        std::string                                addressesHex;
+
+        if (entry.first.find(' ') != std::string::npos || info.mHostName.find(' ') != std::string::npos)
+        {
+            continue;
+        }
+
+        for (const Ip6Address &address : info.mAddresses)
+        {
+            addressesHex += BytesToHexString(address.m8, sizeof(address.m8));
+        }
+
+        fprintf(file, "H %" PRIu64 " %" PRIu32 " %s %s %s\n", now - AgeInSeconds(entry.second.mDiscoveredAt),
+                info.mTtl, entry.first.c_str(), info.mHostName.empty() ? "-" : info.mHostName.c_str(),
+                addressesHex.empty() ? "-" : addressesHex.c_str());
+    }
+
+    fclose(file);
+
+    // Swap the new cache into place atomically so a crash mid-save never
+    // leaves a truncated file behind.
+    if (rename(tmpPath.c_str(), kCachePath) != 0)
+    {
+        otbrLogWarning("Failed to move cache file into place: %s", strerror(errno));
+    }
+
+exit:
+    return;
+}
+
+void DiscoveryProxy::ScheduleCacheSave(void)
+{
+    VerifyOrExit(mSaveCacheTaskId == 0);
+
+    mSaveCacheTaskId = mTaskRunner.Post(Milliseconds(kCacheSaveDelayMs), [this]() {
+        mSaveCacheTaskId = 0;
+        SaveCache();
+    });
+
+exit:
+    return;
 }
 
 uint32_t DiscoveryProxy::CapTtl(uint32_t aTtl)
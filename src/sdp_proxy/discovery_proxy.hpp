@@ -37,7 +37,10 @@
 #if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
 
 #include <set>
+#include <string>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <stdint.h>
 
@@ -45,7 +48,10 @@
 #include <openthread/instance.h>
 
 #include "common/dns_utils.hpp"
+#include "common/task_runner.hpp"
+#include "common/time.hpp"
 #include "mdns/mdns.hpp"
+#include "mdns/name_interner.hpp"
 #include "ncp/ncp_openthread.hpp"
 
 namespace otbr {
@@ -82,23 +88,81 @@ public:
 private:
     enum : uint32_t
     {
-        kServiceTtlCapLimit = 10, // TTL cap limit for Discovery Proxy (in seconds).
+        kServiceTtlCapLimit = 10,   // TTL cap limit for Discovery Proxy (in seconds).
+        kCacheSaveDelayMs   = 5000, // Delay coalescing cache changes into one save (in milliseconds).
+    };
+
+    struct Subscription
+    {
+        uint32_t  mRefCount = 0;      // The number of identical client queries sharing the backend browse.
+        bool      mAnswered = false;  // Whether any record has been delivered to OpenThread for this query.
+        Timepoint mSubscribeTime;     // When the query arrived; anchors the latency metrics.
+    };
+
+    // A discovery result together with the time it was cached; freshness is
+    // judged against the record's own mDNS TTL.
+    struct CachedInstance
+    {
+        Mdns::Publisher::DiscoveredInstanceInfo mInfo;
+        Timepoint                               mDiscoveredAt;
+    };
+
+    struct CachedHost
+    {
+        Mdns::Publisher::DiscoveredHostInfo mInfo;
+        Timepoint                           mDiscoveredAt;
     };
 
     static void        OnDiscoveryProxySubscribe(void *aContext, const char *aFullName);
     void               OnDiscoveryProxySubscribe(const char *aSubscription);
     static void        OnDiscoveryProxyUnsubscribe(void *aContext, const char *aFullName);
     void               OnDiscoveryProxyUnsubscribe(const char *aSubscription);
-    int                GetServiceSubscriptionCount(const DnsNameInfo &aNameInfo) const;
-    static std::string TranslateDomain(const std::string &aName, const std::string &aTargetDomain);
+    void               CacheServiceInstance(const std::string &                            aType,
+                                            const Mdns::Publisher::DiscoveredInstanceInfo &aInstanceInfo);
+    void               ReplayFromCache(const DnsNameInfo &aNameInfo);
+    static void        TranslateDomain(const std::string &aName,
+                                       const std::string &aTargetDomain,
+                                       std::string &      aTargetName);
     void               OnServiceDiscovered(const std::string &                            aSubscription,
-                                           const Mdns::Publisher::DiscoveredInstanceInfo &aInstanceInfo);
-    void OnHostDiscovered(const std::string &aHostName, const Mdns::Publisher::DiscoveredHostInfo &aHostInfo);
+                                           const Mdns::Publisher::DiscoveredInstanceInfo &aInstanceInfo,
+                                           uint32_t                                       aAgeSeconds);
+    void            OnHostDiscovered(const std::string &                        aHostName,
+                                     const Mdns::Publisher::DiscoveredHostInfo &aHostInfo,
+                                     uint32_t                                   aAgeSeconds);
     static uint32_t CapTtl(uint32_t aTtl);
+    void            MarkQueryAnswered(const char *aQueryName);
+    void            LoadCache(void);
+    void            SaveCache(void);
+    void            ScheduleCacheSave(void);
 
     Ncp::ControllerOpenThread &mNcp;
     Mdns::Publisher &          mMdnsPublisher;
     uint64_t                   mSubscriberId = 0;
+
+    // Reference-counted client subscriptions keyed by the lowercased full
+    // DNS name, so identical client queries share one backend browse.
+    std::unordered_map<std::string, Subscription> mSubscriptions;
+
+    // Shared discovery results; subscriptions are answered from here while
+    // the records are still within their mDNS TTLs, with the backend browse
+    // refreshing them in the background. Expired records are dropped lazily
+    // on replay. Instances are keyed by the interned lowercase-form id of
+    // the service type (see `Mdns::NameInterner`); hosts are keyed by the
+    // lowercased host name, which is client-driven and thus not interned.
+    std::unordered_map<uint32_t, std::vector<CachedInstance>> mCachedInstances;
+    std::unordered_map<std::string, CachedHost>               mCachedHosts;
+
+    // Scratch buffers reused across discovery notifications; the translated
+    // names handed to OpenThread are only referenced for the duration of the
+    // `otDnssdQueryHandleDiscovered*()` call.
+    std::string mServiceFullNameBuffer;
+    std::string mInstanceFullNameBuffer;
+    std::string mHostFullNameBuffer;
+
+    // Persists the result caches across agent restarts so proxied queries
+    // are answerable before the first browse cycle; saves are coalesced.
+    TaskRunner         mTaskRunner;
+    TaskRunner::TaskId mSaveCacheTaskId{0};
 };
 
 } // namespace Dnssd
@@ -0,0 +1,200 @@
+/*
+ *    Copyright (c) 2022, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes implementation of the shared-memory telemetry segment.
+ */
+
+#if OTBR_ENABLE_TELEMETRY_SHM
+
+#define OTBR_LOG_TAG "TELEM"
+
+#include "telemetry/telemetry_shm.hpp"
+
+#include <errno.h>
+#include <string.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <openthread/channel_monitor.h>
+#include <openthread/thread_ftd.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+
+namespace otbr {
+namespace Telemetry {
+
+static const char kDefaultSegmentPath[] = "/var/run/otbr-telemetry";
+
+constexpr uint8_t TelemetryShmPublisher::kMaxChildEntries;
+
+TelemetryShmPublisher::TelemetryShmPublisher(Ncp::ControllerOpenThread &aNcp)
+    : mNcp(aNcp)
+    , mSegmentPath(kDefaultSegmentPath)
+    , mFd(-1)
+    , mSegment(nullptr)
+{
+}
+
+void TelemetryShmPublisher::Init(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    mFd = open(mSegmentPath.c_str(), O_CREAT | O_RDWR | O_CLOEXEC, 0644);
+    VerifyOrExit(mFd >= 0, error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(ftruncate(mFd, sizeof(Segment)) == 0, error = OTBR_ERROR_ERRNO);
+
+    mSegment = static_cast<Segment *>(mmap(nullptr, sizeof(Segment), PROT_READ | PROT_WRITE, MAP_SHARED, mFd, 0));
+    VerifyOrExit(mSegment != MAP_FAILED, mSegment = nullptr; error = OTBR_ERROR_ERRNO);
+
+    memset(mSegment, 0, sizeof(Segment));
+    mSegment->mMagic         = kMagic;
+    mSegment->mLayoutVersion = kLayoutVersion;
+
+    otbrLogInfo("Publishing telemetry segment at %s", mSegmentPath.c_str());
+    ScheduleUpdate();
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to create telemetry segment %s: %s", mSegmentPath.c_str(), strerror(errno));
+        Deinit();
+    }
+}
+
+void TelemetryShmPublisher::Deinit(void)
+{
+    if (mSegment != nullptr)
+    {
+        munmap(mSegment, sizeof(Segment));
+        mSegment = nullptr;
+        unlink(mSegmentPath.c_str());
+    }
+
+    if (mFd >= 0)
+    {
+        close(mFd);
+        mFd = -1;
+    }
+}
+
+void TelemetryShmPublisher::ScheduleUpdate(void)
+{
+    VerifyOrExit(mSegment != nullptr);
+
+    mNcp.PostTimerTask(Milliseconds(kUpdateIntervalMs), [this]() {
+        Update();
+        ScheduleUpdate();
+    });
+
+exit:
+    return;
+}
+
+void TelemetryShmPublisher::Update(void)
+{
+    VerifyOrExit(mSegment != nullptr);
+
+    // Seqlock write side: an odd sequence tells readers a write is in
+    // progress; the fences order the data writes between the two bumps.
+    __atomic_store_n(&mSegment->mSequence, mSegment->mSequence + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    Fill(*mSegment);
+
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    __atomic_store_n(&mSegment->mSequence, mSegment->mSequence + 1, __ATOMIC_RELEASE);
+
+exit:
+    return;
+}
+
+void TelemetryShmPublisher::Fill(Segment &aSegment)
+{
+    otInstance *instance   = mNcp.GetInstance();
+    uint16_t    childIndex = 0;
+    otChildInfo childInfo;
+
+    aSegment.mUpdateTimeMs   = std::chrono::duration_cast<Milliseconds>(Clock::now().time_since_epoch()).count();
+    aSegment.mDeviceRole     = static_cast<uint8_t>(otThreadGetDeviceRole(instance));
+    aSegment.mRloc16         = otThreadGetRloc16(instance);
+    aSegment.mPartitionId    = otThreadGetPartitionId(instance);
+    aSegment.mChannelMask    = otLinkGetSupportedChannelMask(instance);
+    aSegment.mCcaFailureRate = otLinkGetCcaFailureRate(instance);
+
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
+    for (uint8_t i = 0; i < sizeof(aSegment.mChannelOccupancy) / sizeof(aSegment.mChannelOccupancy[0]); i++)
+    {
+        if (aSegment.mChannelMask & (1U << i))
+        {
+            aSegment.mChannelOccupancy[i] = otChannelMonitorGetChannelOccupancy(instance, i);
+        }
+    }
+#endif
+
+    aSegment.mMacCounters = *otLinkGetCounters(instance);
+    aSegment.mIp6Counters = *otThreadGetIp6Counters(instance);
+
+    while (childIndex < kMaxChildEntries &&
+           otThreadGetChildInfoByIndex(instance, childIndex, &childInfo) == OT_ERROR_NONE)
+    {
+        ChildEntry &entry = aSegment.mChildTable[childIndex];
+
+        entry.mExtAddress = 0;
+        for (uint8_t byte : childInfo.mExtAddress.m8)
+        {
+            entry.mExtAddress = (entry.mExtAddress << 8) | byte;
+        }
+        entry.mTimeout          = childInfo.mTimeout;
+        entry.mAge              = childInfo.mAge;
+        entry.mRloc16           = childInfo.mRloc16;
+        entry.mChildId          = childInfo.mChildId;
+        entry.mFrameErrorRate   = childInfo.mFrameErrorRate;
+        entry.mMessageErrorRate = childInfo.mMessageErrorRate;
+        entry.mAverageRssi      = childInfo.mAverageRssi;
+        entry.mLastRssi         = childInfo.mLastRssi;
+        entry.mLinkQualityIn    = childInfo.mLinkQualityIn;
+        entry.mModeFlags        = (childInfo.mRxOnWhenIdle ? kModeFlagRxOnWhenIdle : 0) |
+                           (childInfo.mFullThreadDevice ? kModeFlagFullThreadDevice : 0) |
+                           (childInfo.mFullNetworkData ? kModeFlagFullNetworkData : 0) |
+                           (childInfo.mIsStateRestoring ? kModeFlagIsStateRestoring : 0);
+        childIndex++;
+    }
+
+    aSegment.mChildCount = static_cast<uint8_t>(childIndex);
+}
+
+} // namespace Telemetry
+} // namespace otbr
+
+#endif // OTBR_ENABLE_TELEMETRY_SHM
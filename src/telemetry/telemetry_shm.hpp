@@ -0,0 +1,164 @@
+/*
+ *    Copyright (c) 2022, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the shared-memory telemetry segment.
+ */
+
+#ifndef OTBR_TELEMETRY_TELEMETRY_SHM_HPP_
+#define OTBR_TELEMETRY_TELEMETRY_SHM_HPP_
+
+#if OTBR_ENABLE_TELEMETRY_SHM
+
+#include <stdint.h>
+
+#include <string>
+
+#include <openthread/link.h>
+#include <openthread/thread.h>
+
+#include "common/time.hpp"
+#include "common/types.hpp"
+#include "ncp/ncp_openthread.hpp"
+
+namespace otbr {
+namespace Telemetry {
+
+/**
+ * This class publishes bulk telemetry into an mmap'ed file segment.
+ *
+ * The segment is updated in place on a fixed interval and protected by a
+ * sequence lock: the writer bumps `mSequence` to an odd value before
+ * writing and to the next even value after, so a reader retries whenever
+ * it observes an odd value or the value changes across its read. External
+ * consumers (e.g. a node exporter) map the file read-only and poll it at
+ * memory speed without waking the agent or marshalling over D-Bus.
+ *
+ */
+class TelemetryShmPublisher : private NonCopyable
+{
+public:
+    /**
+     * This structure is the on-disk layout of one child table entry.
+     *
+     */
+    struct ChildEntry
+    {
+        uint64_t mExtAddress;       ///< Extended address.
+        uint32_t mTimeout;          ///< Timeout in seconds.
+        uint32_t mAge;              ///< Seconds since last heard.
+        uint16_t mRloc16;           ///< RLOC16.
+        uint16_t mChildId;          ///< Child ID.
+        uint16_t mFrameErrorRate;   ///< Frame error rate (0xffff->100%).
+        uint16_t mMessageErrorRate; ///< IPv6 message error rate (0xffff->100%).
+        int8_t   mAverageRssi;      ///< Average RSSI.
+        int8_t   mLastRssi;         ///< Last observed RSSI.
+        uint8_t  mLinkQualityIn;    ///< Link quality in.
+        uint8_t  mModeFlags;        ///< Mode bits, see `kModeFlag*`.
+    };
+
+    static constexpr uint8_t kModeFlagRxOnWhenIdle     = 1 << 0; ///< The child keeps its receiver on when idle.
+    static constexpr uint8_t kModeFlagFullThreadDevice = 1 << 1; ///< The child is a Full Thread Device.
+    static constexpr uint8_t kModeFlagFullNetworkData  = 1 << 2; ///< The child requests full Network Data.
+    static constexpr uint8_t kModeFlagIsStateRestoring = 1 << 3; ///< The child is in the restoring state.
+
+    static constexpr uint32_t kMagic           = 0x4f544254; ///< "OTBT"
+    static constexpr uint32_t kLayoutVersion   = 1;          ///< Layout version written to `mLayoutVersion`.
+    static constexpr uint8_t  kMaxChildEntries = 64;         ///< Capacity of `mChildTable`.
+
+    /**
+     * This structure is the on-disk layout of the telemetry segment.
+     *
+     * All multi-byte fields use the native byte order of the host; the
+     * segment is only meant to be read on the machine that writes it.
+     * `mLayoutVersion` must be bumped whenever the layout changes.
+     *
+     */
+    struct Segment
+    {
+        uint32_t mMagic;         ///< Must equal `kMagic`.
+        uint32_t mLayoutVersion; ///< Must equal `kLayoutVersion`.
+        uint32_t mSequence;      ///< Sequence lock; odd while a write is in progress.
+        uint32_t mReserved;      ///< Reserved, zero.
+        uint64_t mUpdateTimeMs;  ///< Steady-clock timestamp of the last update, in milliseconds.
+
+        uint8_t  mDeviceRole;           ///< Device role, `otDeviceRole` value.
+        uint8_t  mChildCount;           ///< Number of valid entries in `mChildTable`.
+        uint16_t mRloc16;               ///< RLOC16 of this device.
+        uint32_t mPartitionId;          ///< Thread partition ID.
+        uint32_t mChannelMask;          ///< Supported channel mask; occupancy valid for set bits.
+        uint16_t mCcaFailureRate;       ///< CCA failure rate (0xffff->100%).
+        uint16_t mChannelOccupancy[32]; ///< Channel occupancy (0xffff->100%), indexed by channel.
+
+        otMacCounters mMacCounters; ///< MAC layer counters.
+        otIpCounters  mIp6Counters; ///< IPv6 message counters.
+
+        ChildEntry mChildTable[kMaxChildEntries]; ///< Child table, first `mChildCount` entries valid.
+    };
+
+    /**
+     * The constructor to initialize the telemetry publisher.
+     *
+     * @param[in] aNcp  A reference to the NCP controller.
+     *
+     */
+    explicit TelemetryShmPublisher(Ncp::ControllerOpenThread &aNcp);
+
+    /**
+     * This method creates the segment file, maps it and starts the
+     * periodic updates.
+     *
+     */
+    void Init(void);
+
+    /**
+     * This method stops the updates and removes the segment file.
+     *
+     */
+    void Deinit(void);
+
+private:
+    static constexpr uint32_t kUpdateIntervalMs = 1000;
+
+    void ScheduleUpdate(void);
+    void Update(void);
+    void Fill(Segment &aSegment);
+
+    Ncp::ControllerOpenThread &mNcp;
+    std::string                mSegmentPath;
+    int                        mFd;
+    Segment *                  mSegment;
+};
+
+} // namespace Telemetry
+} // namespace otbr
+
+#endif // OTBR_ENABLE_TELEMETRY_SHM
+
+#endif // OTBR_TELEMETRY_TELEMETRY_SHM_HPP_
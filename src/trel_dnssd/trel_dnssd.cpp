@@ -37,8 +37,11 @@
 
 #include "trel_dnssd/trel_dnssd.hpp"
 
+#include <ctype.h>
 #include <inttypes.h>
 #include <net/if.h>
+#include <stdio.h>
+#include <time.h>
 
 #include <openthread/instance.h>
 #include <openthread/link.h>
@@ -50,6 +53,9 @@
 
 static const char kTrelServiceName[] = "_trel._udp";
 
+// Where discovered peers are persisted across agent restarts.
+static const char kPeerCachePath[] = "/var/run/otbr-trel-peers.cache";
+
 static otbr::TrelDnssd::TrelDnssd *sTrelDnssd = nullptr;
 
 void trelDnssdInitialize(const char *aTrelNetif)
@@ -111,8 +117,11 @@ void TrelDnssd::StartBrowse(void)
 
     assert(mSubscriberId == 0);
     mSubscriberId = mPublisher.AddSubscriptionCallbacks(
-        [this](const std::string &aType, const Mdns::Publisher::DiscoveredInstanceInfo &aInstanceInfo) {
-            OnTrelServiceInstanceResolved(aType, aInstanceInfo);
+        [this](const std::string &aType, const std::vector<Mdns::Publisher::DiscoveredInstanceInfo> &aInstances) {
+            for (const auto &instanceInfo : aInstances)
+            {
+                OnTrelServiceInstanceResolved(aType, instanceInfo);
+            }
         },
         /* aHostCallback */ nullptr);
 
@@ -154,35 +163,102 @@ void TrelDnssd::RegisterService(uint16_t aPort, const uint8_t *aTxtData, uint8_t
     otbrLogDebug("Register %s service: port=%u, TXT=%d bytes", kTrelServiceName, aPort, aTxtLength);
     otbrDump(OTBR_LOG_DEBUG, OTBR_LOG_TAG, "TXT", aTxtData, aTxtLength);
 
-    if (mRegisterInfo.IsValid() && IsReady())
-    {
-        UnpublishTrelService();
-    }
+    mPendingRegisterInfo.Assign(aPort, aTxtData, aTxtLength);
+    mRegistrationGeneration++;
+    ScheduleApplyRegistration();
+
+exit:
+    return;
+}
 
-    mRegisterInfo.Assign(aPort, aTxtData, aTxtLength);
+void TrelDnssd::UnregisterService(void)
+{
+    VerifyOrExit(IsInitialized());
 
-    if (IsReady())
+    otbrLogDebug("Remove %s service", kTrelServiceName);
+
+    mPendingRegisterInfo.Clear();
+    mRegistrationGeneration++;
+    ScheduleApplyRegistration();
+
+exit:
+    return;
+}
+
+void TrelDnssd::ScheduleApplyRegistration(void)
+{
+    if (mRegistrationSettleWindow == Milliseconds::zero())
     {
-        PublishTrelService();
+        ReconcileRegistration();
+        ExitNow();
     }
 
+    // An apply task is already pending; the most recently requested state
+    // replaces the earlier one, so it is applied by the existing task.
+    VerifyOrExit(mApplyRegistrationTaskId == 0);
+
+    mApplyRegistrationTaskId = mTaskRunner.Post(mRegistrationSettleWindow, [this]() {
+        mApplyRegistrationTaskId = 0;
+        ReconcileRegistration();
+    });
+
 exit:
     return;
 }
 
-void TrelDnssd::UnregisterService(void)
+void TrelDnssd::ReconcileRegistration(void)
 {
-    VerifyOrExit(IsInitialized());
+    uint64_t generation = mRegistrationGeneration;
 
-    otbrLogDebug("Remove %s service", kTrelServiceName);
-    assert(mRegisterInfo.IsValid());
+    VerifyOrExit(!mRegistrationOpInFlight);
+    VerifyOrExit(mAppliedGeneration != generation);
 
-    if (IsReady())
+    if (generation - mAppliedGeneration > 1)
+    {
+        otbrLogDebug("Collapsed %llu intermediate %s registration state(s)",
+                     static_cast<unsigned long long>(generation - mAppliedGeneration - 1), kTrelServiceName);
+    }
+
+    if (!mPendingRegisterInfo.IsValid())
     {
+        // Desired state: unregistered.
+        if (IsReady() && mRegisterInfo.IsPublished())
+        {
+            UnpublishTrelService();
+        }
+        else
+        {
+            mRegisterInfo.Clear();
+            mAppliedGeneration = generation;
+        }
+    }
+    else if (mRegisterInfo.IsPublished() && mRegisterInfo.mPort == mPendingRegisterInfo.mPort &&
+             mRegisterInfo.mTxtEntries == mPendingRegisterInfo.mTxtEntries)
+    {
+        otbrLogDebug("Reuse existing %s registration: port and TXT data unchanged", kTrelServiceName);
+        mAppliedGeneration = generation;
+    }
+    else if (IsReady() && mRegisterInfo.IsPublished())
+    {
+        // Take the stale registration down first; the completion handler
+        // reconciles again and issues the publish.
         UnpublishTrelService();
     }
+    else
+    {
+        mRegisterInfo.mPort       = mPendingRegisterInfo.mPort;
+        mRegisterInfo.mTxtEntries = mPendingRegisterInfo.mTxtEntries;
 
-    mRegisterInfo.Clear();
+        if (IsReady())
+        {
+            PublishTrelService();
+        }
+        else
+        {
+            // Applied as far as possible; OnBecomeReady() publishes later.
+            mAppliedGeneration = generation;
+        }
+    }
 
 exit:
     return;
@@ -196,6 +272,9 @@ void TrelDnssd::OnMdnsPublisherReady(void)
     mMdnsPublisherReady = true;
     RemoveAllPeers();
 
+    // The publisher restarted; any registration op it had in flight is void.
+    mRegistrationOpInFlight = false;
+
     if (mRegisterInfo.IsPublished())
     {
         mRegisterInfo.mInstanceName = "";
@@ -248,17 +327,23 @@ void TrelDnssd::PublishTrelService(void)
     assert(mTrelNetifIndex > 0);
 
     mRegisterInfo.mInstanceName = GetTrelInstanceName();
+    mRegistrationOpInFlight     = true;
     mPublisher.PublishService(/* aHostName */ "", mRegisterInfo.mInstanceName, kTrelServiceName,
                               Mdns::Publisher::SubTypeList{}, mRegisterInfo.mPort, mRegisterInfo.mTxtEntries,
-                              [](otbrError aError) { HandlePublishTrelServiceError(aError); });
+                              [this](otbrError aError) { HandlePublishTrelServiceDone(aError); });
 }
 
-void TrelDnssd::HandlePublishTrelServiceError(otbrError aError)
+void TrelDnssd::HandlePublishTrelServiceDone(otbrError aError)
 {
+    mRegistrationOpInFlight = false;
+
     if (aError != OTBR_ERROR_NONE)
     {
         otbrLogErr("Failed to publish TREL service: %s. TREL won't be working.", otbrErrorString(aError));
     }
+
+    // Converge on any desired state that changed while this was in flight.
+    ReconcileRegistration();
 }
 
 void TrelDnssd::UnpublishTrelService(void)
@@ -266,23 +351,29 @@ void TrelDnssd::UnpublishTrelService(void)
     assert(mRegisterInfo.IsValid());
     assert(mRegisterInfo.IsPublished());
 
+    mRegistrationOpInFlight = true;
     mPublisher.UnpublishService(mRegisterInfo.mInstanceName, kTrelServiceName,
-                                [](otbrError aError) { HandleUnpublishTrelServiceError(aError); });
+                                [this](otbrError aError) { HandleUnpublishTrelServiceDone(aError); });
     mRegisterInfo.mInstanceName = "";
 }
 
-void TrelDnssd::HandleUnpublishTrelServiceError(otbrError aError)
+void TrelDnssd::HandleUnpublishTrelServiceDone(otbrError aError)
 {
+    mRegistrationOpInFlight = false;
+
     if (aError != OTBR_ERROR_NONE)
     {
         otbrLogInfo("Failed to unpublish TREL service: %s", otbrErrorString(aError));
     }
+
+    // Converge on any desired state that changed while this was in flight.
+    ReconcileRegistration();
 }
 
 void TrelDnssd::OnTrelServiceInstanceAdded(const Mdns::Publisher::DiscoveredInstanceInfo &aInstanceInfo)
 {
-    std::string        instanceName = StringUtils::ToLowercase(aInstanceInfo.mName);
-    otPlatTrelPeerInfo peerInfo;
+    std::string instanceName = StringUtils::ToLowercase(aInstanceInfo.mName);
+    otSockAddr  sockAddr;
 
     // Remove any existing TREL service instance before adding
     OnTrelServiceInstanceRemoved(instanceName);
@@ -303,27 +394,43 @@ void TrelDnssd::OnTrelServiceInstanceAdded(const Mdns::Publisher::DiscoveredInst
         ExitNow();
     }
 
-    peerInfo.mRemoved = false;
-    memcpy(&peerInfo.mSockAddr.mAddress, &aInstanceInfo.mAddresses[0], sizeof(peerInfo.mSockAddr.mAddress));
-    peerInfo.mSockAddr.mPort = aInstanceInfo.mPort;
-    peerInfo.mTxtData        = aInstanceInfo.mTxtData.data();
-    peerInfo.mTxtLength      = aInstanceInfo.mTxtData.size();
+    memcpy(&sockAddr.mAddress, &aInstanceInfo.mAddresses[0], sizeof(sockAddr.mAddress));
+    sockAddr.mPort = aInstanceInfo.mPort;
 
     {
-        Peer peer(aInstanceInfo.mTxtData, peerInfo.mSockAddr);
+        Peer peer(aInstanceInfo.mTxtData, sockAddr);
 
         VerifyOrExit(peer.mValid, otbrLogWarning("Peer %s is invalid", aInstanceInfo.mName.c_str()));
 
-        otPlatTrelHandleDiscoveredPeerInfo(mNcp.GetInstance(), &peerInfo);
-
-        mPeers.emplace(instanceName, peer);
-        CheckPeersNumLimit();
+        AddPeer(instanceName, std::move(peer));
+        SchedulePeerCacheSave();
     }
 
 exit:
     return;
 }
 
+void TrelDnssd::AddPeer(const std::string &aInstanceName, Peer aPeer)
+{
+    otPlatTrelPeerInfo peerInfo;
+
+    peerInfo.mRemoved   = false;
+    peerInfo.mTxtData   = aPeer.mTxtData.data();
+    peerInfo.mTxtLength = aPeer.mTxtData.size();
+    peerInfo.mSockAddr  = aPeer.mSockAddr;
+
+    otPlatTrelHandleDiscoveredPeerInfo(mNcp.GetInstance(), &peerInfo);
+
+    {
+        auto result = mPeers.emplace(aInstanceName, std::move(aPeer));
+
+        mPeerEvictionOrder.push_back(aInstanceName);
+        result.first->second.mEvictionIt = std::prev(mPeerEvictionOrder.end());
+        ++mPeerIdentityCounts[GetPeerIdentityKey(result.first->second)];
+    }
+    CheckPeersNumLimit();
+}
+
 void TrelDnssd::OnTrelServiceInstanceRemoved(const std::string &aInstanceName)
 {
     std::string instanceName = StringUtils::ToLowercase(aInstanceName);
@@ -333,34 +440,34 @@ void TrelDnssd::OnTrelServiceInstanceRemoved(const std::string &aInstanceName)
 
     otbrLogDebug("Peer removed: %s", instanceName.c_str());
 
-    // Remove the peer only when all instances are removed because one peer can have multiple instances if expired
-    // instances were not properly removed by mDNS.
-    if (CountDuplicatePeers(it->second) == 0)
     {
-        NotifyRemovePeer(it->second);
+        auto identityIt = mPeerIdentityCounts.find(GetPeerIdentityKey(it->second));
+
+        // Remove the peer only when all instances are removed because one peer can have multiple instances if
+        // expired instances were not properly removed by mDNS.
+        if (--identityIt->second == 0)
+        {
+            NotifyRemovePeer(it->second);
+            mPeerIdentityCounts.erase(identityIt);
+        }
     }
 
+    mPeerEvictionOrder.erase(it->second.mEvictionIt);
     mPeers.erase(it);
 
+    SchedulePeerCacheSave();
+
 exit:
     return;
 }
 
 void TrelDnssd::CheckPeersNumLimit(void)
 {
-    const PeerMap::value_type *oldestPeer = nullptr;
-
     VerifyOrExit(mPeers.size() >= kPeerCacheSize);
 
-    for (const auto &entry : mPeers)
-    {
-        if (oldestPeer == nullptr || entry.second.mDiscoverTime < oldestPeer->second.mDiscoverTime)
-        {
-            oldestPeer = &entry;
-        }
-    }
-
-    OnTrelServiceInstanceRemoved(oldestPeer->first);
+    // Peers are re-inserted on every discovery, so the front of the
+    // eviction order is always the least recently discovered peer.
+    OnTrelServiceInstanceRemoved(mPeerEvictionOrder.front());
 
 exit:
     return;
@@ -386,6 +493,149 @@ void TrelDnssd::RemoveAllPeers(void)
     }
 
     mPeers.clear();
+    mPeerEvictionOrder.clear();
+    mPeerIdentityCounts.clear();
+}
+
+void TrelDnssd::LoadPeerCache(void)
+{
+    FILE *   file   = fopen(kPeerCachePath, "r");
+    size_t   loaded = 0;
+    uint64_t now    = static_cast<uint64_t>(time(nullptr));
+    char     line[1024];
+
+    VerifyOrExit(file != nullptr);
+
+    while (fgets(line, sizeof(line), file) != nullptr)
+    {
+        uint64_t             expiry;
+        unsigned int         port;
+        char                 addrHex[2 * sizeof(otIp6Address) + 1];
+        char                 txtHex[2 * kMaxPersistedTxtSize + 2];
+        char                 name[256];
+        otSockAddr           sockAddr;
+        std::vector<uint8_t> txtData;
+
+        memset(&sockAddr, 0, sizeof(sockAddr));
+
+        if (sscanf(line, "%" SCNu64 " %u %32s %511s %255s", &expiry, &port, addrHex, txtHex, name) != 5)
+        {
+            continue;
+        }
+
+        if (expiry <= now || port == 0 || port > 0xffff)
+        {
+            continue;
+        }
+
+        if (Utils::Hex2Bytes(addrHex, sockAddr.mAddress.mFields.m8, sizeof(sockAddr.mAddress)) !=
+            static_cast<int>(sizeof(sockAddr.mAddress)))
+        {
+            continue;
+        }
+
+        if (strcmp(txtHex, "-") != 0)
+        {
+            uint8_t txtBuf[kMaxPersistedTxtSize];
+            int     txtLen = Utils::Hex2Bytes(txtHex, txtBuf, sizeof(txtBuf));
+
+            if (txtLen <= 0)
+            {
+                continue;
+            }
+
+            txtData.assign(txtBuf, txtBuf + txtLen);
+        }
+
+        sockAddr.mPort = static_cast<uint16_t>(port);
+
+        {
+            Peer peer(std::move(txtData), sockAddr);
+
+            if (!peer.mValid || mPeers.count(name) > 0)
+            {
+                continue;
+            }
+
+            peer.mStale        = true;
+            peer.mDiscoverTime = Clock::from_time_t(static_cast<time_t>(expiry - kPeerCacheValiditySec));
+            AddPeer(name, std::move(peer));
+            loaded++;
+        }
+    }
+
+    otbrLogInfo("Loaded %zu cached TREL peers from %s", loaded, kPeerCachePath);
+
+exit:
+    if (file != nullptr)
+    {
+        fclose(file);
+    }
+}
+
+void TrelDnssd::SavePeerCache(void)
+{
+    std::string tmpPath = std::string(kPeerCachePath) + ".tmp";
+    FILE *      file    = fopen(tmpPath.c_str(), "w");
+
+    VerifyOrExit(file != nullptr,
+                 otbrLogWarning("Failed to open peer cache %s: %s", tmpPath.c_str(), strerror(errno)));
+
+    for (const auto &entry : mPeers)
+    {
+        const Peer &peer = entry.second;
+        char        addrHex[2 * sizeof(otIp6Address) + 1];
+        char        txtHex[2 * kMaxPersistedTxtSize + 2];
+        uint64_t    expiry = static_cast<uint64_t>(Clock::to_time_t(peer.mDiscoverTime)) + kPeerCacheValiditySec;
+
+        // The format is line-oriented with space-separated fields; skip the
+        // rare peer whose instance name cannot be represented.
+        if (peer.mTxtData.size() > kMaxPersistedTxtSize || entry.first.empty() || entry.first.length() >= 256 ||
+            entry.first.find_first_of(" \t\n") != std::string::npos)
+        {
+            continue;
+        }
+
+        Utils::Bytes2Hex(peer.mSockAddr.mAddress.mFields.m8, sizeof(otIp6Address), addrHex);
+
+        if (peer.mTxtData.empty())
+        {
+            txtHex[0] = '-';
+            txtHex[1] = '\0';
+        }
+        else
+        {
+            Utils::Bytes2Hex(peer.mTxtData.data(), static_cast<uint16_t>(peer.mTxtData.size()), txtHex);
+        }
+
+        fprintf(file, "%" PRIu64 " %u %s %s %s\n", expiry, peer.mSockAddr.mPort, addrHex, txtHex,
+                entry.first.c_str());
+    }
+
+    fclose(file);
+    file = nullptr;
+
+    if (rename(tmpPath.c_str(), kPeerCachePath) != 0)
+    {
+        otbrLogWarning("Failed to move peer cache into place: %s", strerror(errno));
+    }
+
+exit:
+    return;
+}
+
+void TrelDnssd::SchedulePeerCacheSave(void)
+{
+    // A save task is already pending; it persists the latest peer table.
+    VerifyOrExit(mSavePeerCacheTaskId == 0);
+
+    mSavePeerCacheTaskId = mTaskRunner.Post(Milliseconds(kPeerCacheSaveDelayMs), [this]() {
+        mSavePeerCacheTaskId = 0;
+        SavePeerCache();
+    });
+
+exit:
+    return;
 }
 
 void TrelDnssd::CheckTrelNetifReady(void)
@@ -426,6 +676,14 @@ void TrelDnssd::OnBecomeReady(void)
         otbrLogInfo("TREL DNS-SD Is Now Ready: Netif=%s(%" PRIu32 "), SubscriberId=%" PRIu64 ", Register=%s!",
                     mTrelNetif.c_str(), mTrelNetifIndex, mSubscriberId, mRegisterInfo.mInstanceName.c_str());
 
+        // Warm up from the persisted peer cache so TREL links are usable
+        // before the first browse cycle completes.
+        if (!mPeerCacheLoaded)
+        {
+            mPeerCacheLoaded = true;
+            LoadPeerCache();
+        }
+
         if (mSubscriberId > 0)
         {
             mPublisher.SubscribeService(kTrelServiceName, /* aInstanceName */ "");
@@ -438,25 +696,14 @@ void TrelDnssd::OnBecomeReady(void)
     }
 }
 
-uint16_t TrelDnssd::CountDuplicatePeers(const TrelDnssd::Peer &aPeer)
+std::string TrelDnssd::GetPeerIdentityKey(const TrelDnssd::Peer &aPeer)
 {
-    uint16_t count = 0;
+    std::string key;
 
-    for (const auto &entry : mPeers)
-    {
-        if (&entry.second == &aPeer)
-        {
-            continue;
-        }
+    key.append(reinterpret_cast<const char *>(aPeer.mExtAddr.m8), sizeof(aPeer.mExtAddr.m8));
+    key.append(reinterpret_cast<const char *>(&aPeer.mSockAddr), sizeof(aPeer.mSockAddr));
 
-        if (!memcmp(&entry.second.mSockAddr, &aPeer.mSockAddr, sizeof(otSockAddr)) &&
-            !memcmp(&entry.second.mExtAddr, &aPeer.mExtAddr, sizeof(otExtAddress)))
-        {
-            count++;
-        }
-    }
-
-    return count;
+    return key;
 }
 
 void TrelDnssd::RegisterInfo::Assign(uint16_t aPort, const uint8_t *aTxtData, uint8_t aTxtLength)
@@ -485,26 +732,66 @@ void TrelDnssd::RegisterInfo::Clear(void)
 
 const char TrelDnssd::Peer::kTxtRecordExtAddressKey[] = "xa";
 
-void TrelDnssd::Peer::ReadExtAddrFromTxtData(void)
+bool TrelDnssd::FindTxtValue(const uint8_t * aTxtData,
+                             size_t          aTxtLength,
+                             const char *    aKey,
+                             const uint8_t *&aValue,
+                             uint8_t &       aValueLength)
 {
-    std::vector<Mdns::Publisher::TxtEntry> txtEntries;
+    bool   found  = false;
+    size_t keyLen = strlen(aKey);
+    size_t offset = 0;
 
-    memset(&mExtAddr, 0, sizeof(mExtAddr));
+    while (offset < aTxtLength)
+    {
+        uint8_t        entryLen = aTxtData[offset++];
+        const uint8_t *entry    = &aTxtData[offset];
+        bool           matched  = true;
 
-    SuccessOrExit(Mdns::Publisher::DecodeTxtData(txtEntries, mTxtData.data(), mTxtData.size()));
+        VerifyOrExit(entryLen <= aTxtLength - offset);
+        offset += entryLen;
 
-    for (const auto &txtEntry : txtEntries)
-    {
-        if (StringUtils::EqualCaseInsensitive(txtEntry.mName, kTxtRecordExtAddressKey))
+        // Each entry is `key=value`; keys are matched case-insensitively.
+        if (entryLen <= keyLen || entry[keyLen] != '=')
         {
-            VerifyOrExit(txtEntry.mValue.size() == sizeof(mExtAddr));
+            continue;
+        }
+
+        for (size_t i = 0; i < keyLen; i++)
+        {
+            if (tolower(entry[i]) != tolower(static_cast<uint8_t>(aKey[i])))
+            {
+                matched = false;
+                break;
+            }
+        }
 
-            memcpy(mExtAddr.m8, txtEntry.mValue.data(), sizeof(mExtAddr));
-            mValid = true;
+        if (matched)
+        {
+            aValue       = &entry[keyLen + 1];
+            aValueLength = static_cast<uint8_t>(entryLen - keyLen - 1);
+            found        = true;
             break;
         }
     }
 
+exit:
+    return found;
+}
+
+void TrelDnssd::Peer::ReadExtAddrFromTxtData(void)
+{
+    const uint8_t *value       = nullptr;
+    uint8_t        valueLength = 0;
+
+    memset(&mExtAddr, 0, sizeof(mExtAddr));
+
+    VerifyOrExit(FindTxtValue(mTxtData.data(), mTxtData.size(), kTxtRecordExtAddressKey, value, valueLength));
+    VerifyOrExit(valueLength == sizeof(mExtAddr));
+
+    memcpy(mExtAddr.m8, value, sizeof(mExtAddr));
+    mValid = true;
+
 exit:
 
     if (!mValid)
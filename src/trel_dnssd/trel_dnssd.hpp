@@ -37,10 +37,13 @@
 #if OTBR_ENABLE_TREL
 
 #include <assert.h>
+#include <list>
+#include <unordered_map>
 #include <utility>
 
 #include <openthread/instance.h>
 
+#include "common/time.hpp"
 #include "common/types.hpp"
 #include "mdns/mdns.hpp"
 #include "ncp/ncp_openthread.hpp"
@@ -112,9 +115,22 @@ public:
      */
     void OnMdnsPublisherReady(void);
 
+    /**
+     * This method sets the window within which TREL service registration
+     * changes are coalesced before reaching mDNS.
+     *
+     * @param[in] aWindow  The settle window. Zero applies changes immediately.
+     *
+     */
+    void SetRegistrationSettleWindow(Milliseconds aWindow) { mRegistrationSettleWindow = aWindow; }
+
 private:
-    static constexpr size_t   kPeerCacheSize             = 256;
-    static constexpr uint16_t kCheckNetifReadyIntervalMs = 5000;
+    static constexpr size_t   kPeerCacheSize              = 256;
+    static constexpr uint16_t kCheckNetifReadyIntervalMs  = 5000;
+    static constexpr uint16_t kRegistrationSettleWindowMs = 500;
+    static constexpr uint32_t kPeerCacheValiditySec       = 24 * 60 * 60;
+    static constexpr uint16_t kPeerCacheSaveDelayMs       = 5000;
+    static constexpr size_t   kMaxPersistedTxtSize        = 255;
 
     struct RegisterInfo
     {
@@ -149,9 +165,16 @@ private:
         otSockAddr           mSockAddr;
         otExtAddress         mExtAddr;
         bool                 mValid = false;
+        // Loaded from the on-disk peer cache and not yet confirmed by an
+        // mDNS browse result; replaced in place when the browse catches up.
+        bool mStale = false;
+
+        // Position in `mPeerEvictionOrder`; assigned when the peer is
+        // inserted into the table.
+        std::list<std::string>::iterator mEvictionIt;
     };
 
-    using PeerMap = std::map<std::string, Peer>;
+    using PeerMap = std::unordered_map<std::string, Peer>;
 
     bool        IsInitialized(void) const { return !mTrelNetif.empty(); }
     bool        IsReady(void) const;
@@ -160,17 +183,32 @@ private:
     std::string GetTrelInstanceName(void);
     void        PublishTrelService(void);
     void        UnpublishTrelService(void);
-    static void HandlePublishTrelServiceError(otbrError aError);
-    static void HandleUnpublishTrelServiceError(otbrError aError);
+    void        HandlePublishTrelServiceDone(otbrError aError);
+    void        HandleUnpublishTrelServiceDone(otbrError aError);
     void        OnTrelServiceInstanceResolved(const std::string &                            aType,
                                               const Mdns::Publisher::DiscoveredInstanceInfo &aInstanceInfo);
     void        OnTrelServiceInstanceAdded(const Mdns::Publisher::DiscoveredInstanceInfo &aInstanceInfo);
     void        OnTrelServiceInstanceRemoved(const std::string &aInstanceName);
 
-    void     NotifyRemovePeer(const Peer &aPeer);
-    void     CheckPeersNumLimit(void);
-    void     RemoveAllPeers(void);
-    uint16_t CountDuplicatePeers(const Peer &aPeer);
+    void AddPeer(const std::string &aInstanceName, Peer aPeer);
+    void NotifyRemovePeer(const Peer &aPeer);
+    void CheckPeersNumLimit(void);
+    void RemoveAllPeers(void);
+    void ScheduleApplyRegistration(void);
+    void ReconcileRegistration(void);
+    void LoadPeerCache(void);
+    void SavePeerCache(void);
+    void SchedulePeerCacheSave(void);
+
+    static std::string GetPeerIdentityKey(const Peer &aPeer);
+
+    // Looks up `aKey` in a raw TXT record without decoding it into
+    // per-entry allocations; returns a view into `aTxtData`.
+    static bool FindTxtValue(const uint8_t * aTxtData,
+                             size_t          aTxtLength,
+                             const char *    aKey,
+                             const uint8_t *&aValue,
+                             uint8_t &       aValueLength);
 
     Mdns::Publisher &          mPublisher;
     Ncp::ControllerOpenThread &mNcp;
@@ -181,6 +219,31 @@ private:
     RegisterInfo               mRegisterInfo;
     PeerMap                    mPeers;
     bool                       mMdnsPublisherReady = false;
+
+    // Desired registration state, reconciled against `mRegisterInfo` with
+    // at most one mDNS operation in flight; the generation counter lets
+    // intermediate states collapse so only the most recent one is ever
+    // published. Invalid (zero port) means "unregistered".
+    RegisterInfo       mPendingRegisterInfo;
+    uint64_t           mRegistrationGeneration = 0;
+    uint64_t           mAppliedGeneration      = 0;
+    bool               mRegistrationOpInFlight = false;
+    TaskRunner::TaskId mApplyRegistrationTaskId{0};
+    Milliseconds       mRegistrationSettleWindow{kRegistrationSettleWindowMs};
+
+    // Persists discovered peers across agent restarts so TREL links come up
+    // before the first browse cycle completes; saves are coalesced.
+    TaskRunner::TaskId mSavePeerCacheTaskId{0};
+    bool               mPeerCacheLoaded = false;
+
+    // Peer instance names in discovery order; the front is the eviction
+    // candidate when the table reaches `kPeerCacheSize`.
+    std::list<std::string> mPeerEvictionOrder;
+
+    // Count of live peers per identity (extended address plus socket
+    // address), so the removal path detects duplicate instances without
+    // scanning the whole table.
+    std::unordered_map<std::string, uint16_t> mPeerIdentityCounts;
 };
 
 /**
@@ -0,0 +1,123 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the ones-complement Internet checksum.
+ */
+
+#include "utils/checksum.hpp"
+
+#include <string.h>
+
+#include "common/byteswap.hpp"
+
+namespace otbr {
+
+void Checksum::Update(const uint8_t *aBuf, size_t aLength)
+{
+    // Byte pairs are accumulated in host byte order; per RFC 1071 the
+    // ones-complement sum is byte-order independent, so `Get()` fixes up
+    // the lane order once at the end.
+    uint64_t sum0 = 0;
+    uint64_t sum1 = 0;
+
+    if (mAtOddByte && aLength > 0)
+    {
+        uint16_t word = htobe16(static_cast<uint16_t>(*aBuf));
+
+        mSum += word;
+        aBuf++;
+        aLength--;
+        mAtOddByte = false;
+    }
+
+    while (aLength >= 16)
+    {
+        uint32_t words[4];
+
+        memcpy(words, aBuf, sizeof(words));
+        sum0 += static_cast<uint64_t>(words[0]) + words[1];
+        sum1 += static_cast<uint64_t>(words[2]) + words[3];
+        aBuf += 16;
+        aLength -= 16;
+    }
+
+    mSum += sum0 + sum1;
+
+    while (aLength >= 2)
+    {
+        uint16_t word;
+
+        memcpy(&word, aBuf, sizeof(word));
+        mSum += word;
+        aBuf += 2;
+        aLength -= 2;
+    }
+
+    if (aLength > 0)
+    {
+        uint16_t word = static_cast<uint16_t>(*aBuf);
+
+        mSum += htobe16(static_cast<uint16_t>(word << 8));
+        mAtOddByte = true;
+    }
+}
+
+uint16_t Checksum::Get(void) const
+{
+    uint64_t sum = mSum;
+
+    while (sum >> 16)
+    {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
+
+    // The accumulated sum has the even-offset byte in the host-order low
+    // lane on little-endian machines; swapping to big-endian puts it back
+    // in the high lane the wire format expects.
+    return static_cast<uint16_t>(~htobe16(static_cast<uint16_t>(sum)));
+}
+
+uint16_t Checksum::UpdateField(uint16_t aChecksum, uint16_t aOldValue, uint16_t aNewValue)
+{
+    // RFC 1624 equation 3: HC' = ~(~HC + ~m + m').
+    uint32_t sum = static_cast<uint16_t>(~aChecksum);
+
+    sum += static_cast<uint16_t>(~aOldValue);
+    sum += aNewValue;
+
+    while (sum >> 16)
+    {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
+
+    return static_cast<uint16_t>(~sum);
+}
+
+} // namespace otbr
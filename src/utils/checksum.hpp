@@ -0,0 +1,113 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the ones-complement Internet checksum.
+ */
+
+#ifndef OTBR_UTILS_CHECKSUM_HPP_
+#define OTBR_UTILS_CHECKSUM_HPP_
+
+#include "openthread-br/config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace otbr {
+
+/**
+ * This class computes the ones-complement Internet checksum (RFC 1071).
+ *
+ * Checksum values are in host byte order; callers writing one into a packet
+ * convert with `htobe16()`.
+ *
+ */
+class Checksum
+{
+public:
+    /**
+     * This constructor initializes the object.
+     *
+     */
+    Checksum(void) { Init(); }
+
+    /**
+     * This method initializes the checksum computation.
+     *
+     */
+    void Init(void)
+    {
+        mSum       = 0;
+        mAtOddByte = false;
+    }
+
+    /**
+     * This method feeds a buffer into the checksum computation.
+     *
+     * The buffer is accumulated eight byte-pairs at a time into independent
+     * partial sums the compiler can vectorize; the value is the same as
+     * feeding the bytes one by one. Buffers may be fed in any split,
+     * including at odd offsets.
+     *
+     * @param[in] aBuf     A pointer to the buffer.
+     * @param[in] aLength  The length of the buffer, in bytes.
+     *
+     */
+    void Update(const uint8_t *aBuf, size_t aLength);
+
+    /**
+     * This method gets the checksum of the bytes fed so far.
+     *
+     * A trailing odd byte is treated as padded with zero, per RFC 1071.
+     *
+     * @returns The checksum, in host byte order.
+     *
+     */
+    uint16_t Get(void) const;
+
+    /**
+     * This method incrementally updates a checksum for a patched 16-bit field (RFC 1624).
+     *
+     * @param[in] aChecksum  The checksum over the original data, in host byte order.
+     * @param[in] aOldValue  The original value of the patched field, in host byte order.
+     * @param[in] aNewValue  The new value of the patched field, in host byte order.
+     *
+     * @returns The checksum over the patched data, in host byte order.
+     *
+     */
+    static uint16_t UpdateField(uint16_t aChecksum, uint16_t aOldValue, uint16_t aNewValue);
+
+private:
+    uint64_t mSum;
+    bool     mAtOddByte;
+};
+
+} // namespace otbr
+
+#endif // OTBR_UTILS_CHECKSUM_HPP_
@@ -35,30 +35,93 @@
 
 namespace otbr {
 
+namespace {
+
+constexpr uint8_t kNumSlices = 8;
+
+struct SliceTables
+{
+    uint16_t mEntries[kNumSlices][256];
+};
+
+SliceTables BuildSliceTables(uint16_t aPolynomial)
+{
+    SliceTables tables;
+
+    // Table 0 is the classic one-byte lookup table; entry `value` of table
+    // `slice` is the CRC of `value` followed by `slice` zero bytes.
+    for (uint32_t value = 0; value < 256; value++)
+    {
+        uint16_t crc = static_cast<uint16_t>(value << 8);
+
+        for (uint8_t bit = 0; bit < 8; bit++)
+        {
+            if (crc & 0x8000)
+            {
+                crc = static_cast<uint16_t>(crc << 1) ^ aPolynomial;
+            }
+            else
+            {
+                crc = static_cast<uint16_t>(crc << 1);
+            }
+        }
+
+        tables.mEntries[0][value] = crc;
+    }
+
+    for (uint8_t slice = 1; slice < kNumSlices; slice++)
+    {
+        for (uint32_t value = 0; value < 256; value++)
+        {
+            uint16_t crc = tables.mEntries[slice - 1][value];
+
+            tables.mEntries[slice][value] = static_cast<uint16_t>(crc << 8) ^ tables.mEntries[0][crc >> 8];
+        }
+    }
+
+    return tables;
+}
+
+const SliceTables &GetSliceTables(Crc16::Polynomial aPolynomial)
+{
+    static const SliceTables sCcittTables = BuildSliceTables(Crc16::kCcitt);
+    static const SliceTables sAnsiTables  = BuildSliceTables(Crc16::kAnsi);
+
+    return (aPolynomial == Crc16::kAnsi) ? sAnsiTables : sCcittTables;
+}
+
+} // namespace
+
 Crc16::Crc16(Polynomial aPolynomial)
 {
     mPolynomial = static_cast<uint16_t>(aPolynomial);
+    mTables     = GetSliceTables(aPolynomial).mEntries;
     Init();
 }
 
 void Crc16::Update(uint8_t aByte)
 {
-    uint8_t i;
+    mCrc = static_cast<uint16_t>(mCrc << 8) ^ mTables[0][(mCrc >> 8) ^ aByte];
+}
+
+void Crc16::Update(const uint8_t *aBuf, size_t aLength)
+{
+    while (aLength >= kNumSlices)
+    {
+        uint16_t crc = mCrc;
+
+        mCrc = mTables[7][(crc >> 8) ^ aBuf[0]] ^ mTables[6][(crc & 0xff) ^ aBuf[1]] ^ mTables[5][aBuf[2]] ^
+               mTables[4][aBuf[3]] ^ mTables[3][aBuf[4]] ^ mTables[2][aBuf[5]] ^ mTables[1][aBuf[6]] ^
+               mTables[0][aBuf[7]];
 
-    mCrc = mCrc ^ static_cast<uint16_t>(aByte << 8);
-    i    = 8;
+        aBuf += kNumSlices;
+        aLength -= kNumSlices;
+    }
 
-    do
+    while (aLength-- > 0)
     {
-        if (mCrc & 0x8000)
-        {
-            mCrc = static_cast<uint16_t>(mCrc << 1) ^ mPolynomial;
-        }
-        else
-        {
-            mCrc = static_cast<uint16_t>(mCrc << 1);
-        }
-    } while (--i);
+        Update(*aBuf++);
+    }
 }
 
 } // namespace otbr
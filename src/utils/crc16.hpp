@@ -36,6 +36,7 @@
 
 #include "openthread-br/config.h"
 
+#include <stddef.h>
 #include <stdint.h>
 
 namespace otbr {
@@ -75,6 +76,18 @@ public:
      */
     void Update(uint8_t aByte);
 
+    /**
+     * This method feeds a buffer into the CRC16 computation.
+     *
+     * The buffer is processed eight bytes at a time with slice-by-8 lookup
+     * tables, yielding the same value as feeding the bytes one by one.
+     *
+     * @param[in] aBuf     A pointer to the buffer.
+     * @param[in] aLength  The length of the buffer, in bytes.
+     *
+     */
+    void Update(const uint8_t *aBuf, size_t aLength);
+
     /**
      * This method gets the current CRC16 value.
      *
@@ -86,6 +99,7 @@ public:
 private:
     uint16_t mPolynomial;
     uint16_t mCrc;
+    const uint16_t (*mTables)[256]; ///< Slice-by-8 tables for the polynomial.
 };
 
 } // namespace otbr
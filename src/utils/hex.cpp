@@ -33,60 +33,119 @@
 
 #include "utils/hex.hpp"
 
-#include <string>
-
-#include <stdio.h>
 #include <string.h>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
 namespace otbr {
 
 namespace Utils {
 
+static const char kHexChars[] = "0123456789ABCDEF";
+
+// Maps an ASCII character to its hex nibble value, or -1 for a
+// non-hex character, so decoding is one table lookup per character.
+struct HexDecodeTable
+{
+    HexDecodeTable(void)
+    {
+        memset(mValues, -1, sizeof(mValues));
+
+        for (int i = 0; i < 10; i++)
+        {
+            mValues['0' + i] = static_cast<int8_t>(i);
+        }
+        for (int i = 0; i < 6; i++)
+        {
+            mValues['A' + i] = static_cast<int8_t>(10 + i);
+            mValues['a' + i] = static_cast<int8_t>(10 + i);
+        }
+    }
+
+    int8_t mValues[256];
+};
+
+static const HexDecodeTable sHexDecodeTable;
+
+#if defined(__SSE2__)
+// Encodes 16 bytes into 32 uppercase hex characters: the high and low
+// nibbles are mapped to ASCII in parallel ('0' + nibble, plus the
+// 'A' - '0' - 10 adjustment where the nibble exceeds 9) and interleaved.
+static void EncodeHexChunk(const uint8_t *aBytes, char *aHex)
+{
+    const __m128i nine   = _mm_set1_epi8(9);
+    const __m128i zero   = _mm_set1_epi8('0');
+    const __m128i adjust = _mm_set1_epi8('A' - '0' - 10);
+    __m128i       bytes  = _mm_loadu_si128(reinterpret_cast<const __m128i *>(aBytes));
+    __m128i       hi     = _mm_and_si128(_mm_srli_epi16(bytes, 4), _mm_set1_epi8(0x0f));
+    __m128i       lo     = _mm_and_si128(bytes, _mm_set1_epi8(0x0f));
+
+    hi = _mm_add_epi8(_mm_add_epi8(hi, zero), _mm_and_si128(_mm_cmpgt_epi8(hi, nine), adjust));
+    lo = _mm_add_epi8(_mm_add_epi8(lo, zero), _mm_and_si128(_mm_cmpgt_epi8(lo, nine), adjust));
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(aHex), _mm_unpacklo_epi8(hi, lo));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(aHex + 16), _mm_unpackhi_epi8(hi, lo));
+}
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+static void EncodeHexChunk(const uint8_t *aBytes, char *aHex)
+{
+    const uint8x16_t nine   = vdupq_n_u8(9);
+    const uint8x16_t zero   = vdupq_n_u8('0');
+    const uint8x16_t adjust = vdupq_n_u8('A' - '0' - 10);
+    uint8x16_t       bytes  = vld1q_u8(aBytes);
+    uint8x16x2_t     nibbles;
+
+    nibbles.val[0] = vshrq_n_u8(bytes, 4);
+    nibbles.val[1] = vandq_u8(bytes, vdupq_n_u8(0x0f));
+
+    nibbles.val[0] =
+        vaddq_u8(vaddq_u8(nibbles.val[0], zero), vandq_u8(vcgtq_u8(nibbles.val[0], nine), adjust));
+    nibbles.val[1] =
+        vaddq_u8(vaddq_u8(nibbles.val[1], zero), vandq_u8(vcgtq_u8(nibbles.val[1], nine), adjust));
+
+    vst2q_u8(reinterpret_cast<uint8_t *>(aHex), nibbles);
+}
+#endif
+
 int Hex2Bytes(const char *aHex, uint8_t *aBytes, uint16_t aBytesLength)
 {
-    size_t      hexLength = strlen(aHex);
-    const char *hexEnd    = aHex + hexLength;
-    uint8_t *   cur       = aBytes;
-    uint8_t     numChars  = hexLength & 1;
-    uint8_t     byte      = 0;
+    size_t   hexLength = strlen(aHex);
+    uint8_t *cur       = aBytes;
 
     if ((hexLength + 1) / 2 > aBytesLength)
     {
         return -1;
     }
 
-    while (aHex < hexEnd)
+    // An odd-length string encodes its first byte with a single character.
+    if (hexLength & 1)
     {
-        if ('A' <= *aHex && *aHex <= 'F')
-        {
-            byte |= 10 + (*aHex - 'A');
-        }
-        else if ('a' <= *aHex && *aHex <= 'f')
-        {
-            byte |= 10 + (*aHex - 'a');
-        }
-        else if ('0' <= *aHex && *aHex <= '9')
-        {
-            byte |= *aHex - '0';
-        }
-        else
+        int8_t nibble = sHexDecodeTable.mValues[static_cast<uint8_t>(*aHex++)];
+
+        if (nibble < 0)
         {
             return -1;
         }
 
-        aHex++;
-        numChars++;
+        *cur++ = static_cast<uint8_t>(nibble);
+    }
 
-        if (numChars >= 2)
-        {
-            numChars = 0;
-            *cur++   = byte;
-            byte     = 0;
-        }
-        else
+    while (*aHex)
+    {
+        int8_t hi = sHexDecodeTable.mValues[static_cast<uint8_t>(aHex[0])];
+        int8_t lo = sHexDecodeTable.mValues[static_cast<uint8_t>(aHex[1])];
+
+        if (hi < 0 || lo < 0)
         {
-            byte <<= 4;
+            return -1;
         }
+
+        *cur++ = static_cast<uint8_t>((hi << 4) | lo);
+        aHex += 2;
     }
 
     return static_cast<int>(cur - aBytes);
@@ -94,37 +153,44 @@ int Hex2Bytes(const char *aHex, uint8_t *aBytes, uint16_t aBytesLength)
 
 size_t Bytes2Hex(const uint8_t *aBytes, const uint16_t aBytesLength, char *aHex)
 {
-    char byteHex[3];
+    uint16_t i = 0;
 
-    std::string hexString;
-    uint8_t     cur[aBytesLength];
-
-    memcpy(cur, aBytes, aBytesLength);
+#if defined(__SSE2__) || defined(__ARM_NEON) || defined(__ARM_NEON__)
+    for (; i + 16 <= aBytesLength; i += 16)
+    {
+        EncodeHexChunk(aBytes + i, aHex + 2 * i);
+    }
+#endif
 
-    for (int i = 0; i < aBytesLength; i++)
+    for (; i < aBytesLength; i++)
     {
-        sprintf(byteHex, "%02X", cur[i]);
-        hexString += byteHex;
+        aHex[2 * i]     = kHexChars[aBytes[i] >> 4];
+        aHex[2 * i + 1] = kHexChars[aBytes[i] & 0x0f];
     }
-    strcpy(aHex, hexString.c_str());
-    return strlen(aHex);
+
+    aHex[2 * aBytesLength] = '\0';
+
+    return 2 * static_cast<size_t>(aBytesLength);
 }
 
 size_t Long2Hex(const uint64_t aLong, char *aHex)
 {
-    std::string hexString;
-    char        byteHex[3];
-    uint64_t    longValue = aLong;
+    uint64_t longValue = aLong;
 
+    // Bytes are encoded starting from the least significant one, matching
+    // the order the previous implementation produced.
     for (uint8_t i = 0; i < sizeof(uint64_t); i++)
     {
         uint8_t byte = longValue & 0xff;
-        sprintf(byteHex, "%02X", byte);
-        hexString += byteHex;
-        longValue = longValue >> 8;
+
+        aHex[2 * i]     = kHexChars[byte >> 4];
+        aHex[2 * i + 1] = kHexChars[byte & 0x0f];
+        longValue >>= 8;
     }
-    strcpy(aHex, hexString.c_str());
-    return strlen(aHex);
+
+    aHex[2 * sizeof(uint64_t)] = '\0';
+
+    return 2 * sizeof(uint64_t);
 }
 
 } // namespace Utils
@@ -37,14 +37,19 @@
 
 #include "utils/infra_link_selector.hpp"
 
+#include <linux/neighbour.h>
 #include <linux/rtnetlink.h>
 #include <net/if.h>
+#include <stdio.h>
 #include <sys/ioctl.h>
 #include <sys/socket.h>
 #include <unistd.h>
 
+#include <algorithm>
+
 #include <openthread/backbone_router_ftd.h>
 
+#include "common/perf_config.hpp"
 #include "utils/socket_utils.hpp"
 
 namespace otbr {
@@ -122,23 +127,34 @@ const char *InfraLinkSelector::SelectGeneric(void)
     VerifyOrExit(mInfraLinkNames.size() > 1, mCurrentInfraLink = mInfraLinkNames.front());
     VerifyOrExit(mRequireReselect, assert(mCurrentInfraLink != nullptr));
 
+    ProbeLinkQualities();
+
     otbrLogInfo("Evaluating infra link among %zu netifs:", mInfraLinkNames.size());
 
-    // Prefer `mCurrentInfraLink` if it's up and running.
+    // Prefer `mCurrentInfraLink` if it's up and running, unless its
+    // default gateway is known to be unreachable, in which case the
+    // candidates are compared so failover can pick a genuinely working
+    // link in one evaluation.
     if (mCurrentInfraLink != nullptr)
     {
         currentInfraLinkInfo = &mInfraLinkInfos[mCurrentInfraLink];
 
-        otbrLogInfo("\tInfra link %s is in state %s", mCurrentInfraLink,
-                    LinkStateToString(currentInfraLinkInfo->mState));
+        otbrLogInfo("\tInfra link %s is in state %s, gateway %s", mCurrentInfraLink,
+                    LinkStateToString(currentInfraLinkInfo->mState),
+                    !currentInfraLinkInfo->mGatewayKnown      ? "unknown"
+                    : currentInfraLinkInfo->mGatewayReachable ? "reachable"
+                                                              : "unreachable");
 
-        VerifyOrExit(currentInfraLinkInfo->mState != kUpAndRunning);
+        VerifyOrExit(currentInfraLinkInfo->mState != kUpAndRunning ||
+                     (currentInfraLinkInfo->mGatewayKnown && !currentInfraLinkInfo->mGatewayReachable));
     }
 
-    // Select an infra link with best state.
+    // Select an infra link with best state, breaking state ties on
+    // gateway reachability and then on recent throughput.
     {
         const char *                 bestInfraLink = mCurrentInfraLink;
         InfraLinkSelector::LinkState bestState     = currentInfraLinkState;
+        const LinkInfo *             bestInfo      = nullptr;
 
         for (const char *name : mInfraLinkNames)
         {
@@ -146,11 +162,18 @@ const char *InfraLinkSelector::SelectGeneric(void)
             {
                 LinkInfo &linkInfo = mInfraLinkInfos[name];
 
-                otbrLogInfo("\tInfra link %s is in state %s", name, LinkStateToString(linkInfo.mState));
-                if (bestInfraLink == nullptr || linkInfo.mState > bestState)
+                otbrLogInfo("\tInfra link %s is in state %s, gateway %s, recent bytes %llu", name,
+                            LinkStateToString(linkInfo.mState),
+                            !linkInfo.mGatewayKnown      ? "unknown"
+                            : linkInfo.mGatewayReachable ? "reachable"
+                                                         : "unreachable",
+                            static_cast<unsigned long long>(linkInfo.mRecentThroughput));
+                if (bestInfraLink == nullptr || linkInfo.mState > bestState ||
+                    (bestInfo != nullptr && linkInfo.mState == bestState && IsBetterQuality(linkInfo, *bestInfo)))
                 {
                     bestInfraLink = name;
                     bestState     = linkInfo.mState;
+                    bestInfo      = &linkInfo;
                 }
             }
         }
@@ -160,15 +183,19 @@ const char *InfraLinkSelector::SelectGeneric(void)
         // Prefer `mCurrentInfraLink` if no other infra link is up and running
         VerifyOrExit(mCurrentInfraLink == nullptr || bestState == kUpAndRunning);
 
-        // Prefer `mCurrentInfraLink` if it's down for less than `kInfraLinkSelectionDelay`
+        // Prefer `mCurrentInfraLink` if it's down for less than the selection delay
         if (mCurrentInfraLink != nullptr && currentInfraLinkInfo->mWasUpAndRunning)
         {
+            static PerfConfig::Uint32Value &sSelectionDelayMs = PerfConfig::GetInstance().RegisterUint32(
+                "infra_link.selection_delay_ms", static_cast<uint32_t>(kInfraLinkSelectionDelay.count()),
+                "How long a formerly running infra link is preferred after going down, in milliseconds.");
+            Milliseconds selectionDelay = Milliseconds(sSelectionDelayMs.Get());
             Milliseconds timeSinceLastRunning =
                 std::chrono::duration_cast<Milliseconds>(now - currentInfraLinkInfo->mLastRunningTime);
 
-            if (timeSinceLastRunning < kInfraLinkSelectionDelay)
+            if (timeSinceLastRunning < selectionDelay)
             {
-                Milliseconds delay = kInfraLinkSelectionDelay - timeSinceLastRunning;
+                Milliseconds delay = selectionDelay - timeSinceLastRunning;
 
                 otbrLogInfo("Infra link %s was running %lldms ago, wait for %lldms to recheck.", mCurrentInfraLink,
                             timeSinceLastRunning.count(), delay.count());
@@ -231,6 +258,232 @@ exit:
     return state;
 }
 
+uint64_t InfraLinkSelector::ReadLinkByteCount(const char *aInfraLinkName)
+{
+    static const char *const kCounterNames[] = {"rx_bytes", "tx_bytes"};
+    uint64_t                 total           = 0;
+
+    for (const char *counterName : kCounterNames)
+    {
+        char               path[128];
+        FILE *             file;
+        unsigned long long value = 0;
+
+        snprintf(path, sizeof(path), "/sys/class/net/%s/statistics/%s", aInfraLinkName, counterName);
+
+        file = fopen(path, "r");
+        if (file != nullptr)
+        {
+            if (fscanf(file, "%llu", &value) != 1)
+            {
+                value = 0;
+            }
+            fclose(file);
+        }
+
+        total += value;
+    }
+
+    return total;
+}
+
+bool InfraLinkSelector::IsBetterQuality(const LinkInfo &aLhs, const LinkInfo &aRhs)
+{
+    bool lhsReachable = aLhs.mGatewayKnown && aLhs.mGatewayReachable;
+    bool rhsReachable = aRhs.mGatewayKnown && aRhs.mGatewayReachable;
+    bool lhsDead      = aLhs.mGatewayKnown && !aLhs.mGatewayReachable;
+    bool rhsDead      = aRhs.mGatewayKnown && !aRhs.mGatewayReachable;
+    bool better;
+
+    if (lhsReachable != rhsReachable)
+    {
+        better = lhsReachable;
+    }
+    else if (lhsDead != rhsDead)
+    {
+        better = rhsDead;
+    }
+    else
+    {
+        better = aLhs.mRecentThroughput > aRhs.mRecentThroughput;
+    }
+
+    return better;
+}
+
+void InfraLinkSelector::ProbeLinkQualities(void)
+{
+    QueryGatewayReachability();
+
+    for (const char *name : mInfraLinkNames)
+    {
+        LinkInfo &linkInfo  = mInfraLinkInfos[name];
+        uint64_t  byteCount = ReadLinkByteCount(name);
+
+        linkInfo.mRecentThroughput =
+            (linkInfo.mByteCount != 0 && byteCount >= linkInfo.mByteCount) ? byteCount - linkInfo.mByteCount : 0;
+        linkInfo.mByteCount = byteCount;
+    }
+}
+
+void InfraLinkSelector::QueryGatewayReachability(void)
+{
+    struct GatewayEntry
+    {
+        uint32_t mIfIndex;
+        uint8_t  mFamily;
+        uint16_t mAddressLength;
+        uint8_t  mAddress[16];
+        bool     mReachable;
+    };
+
+    std::vector<GatewayEntry> gateways;
+    int                       sock = CreateNetLinkRouteSocket(0);
+
+    for (const char *name : mInfraLinkNames)
+    {
+        mInfraLinkInfos[name].mGatewayKnown     = false;
+        mInfraLinkInfos[name].mGatewayReachable = false;
+    }
+
+    VerifyOrExit(sock != -1);
+
+    // Two synchronous nonblocking dumps: the default routes identify each
+    // candidate's gateway, the neighbor cache tells whether that gateway
+    // has recently answered ARP/NS. All candidates are covered by the
+    // same pair of dumps, so no per-link probe round trips are needed.
+    for (int phase = 0; phase < 2; phase++)
+    {
+        struct
+        {
+            struct nlmsghdr mHeader;
+            struct rtgenmsg mGen;
+        } request;
+        bool done = false;
+
+        memset(&request, 0, sizeof(request));
+        request.mHeader.nlmsg_len   = NLMSG_LENGTH(sizeof(struct rtgenmsg));
+        request.mHeader.nlmsg_type  = (phase == 0) ? RTM_GETROUTE : RTM_GETNEIGH;
+        request.mHeader.nlmsg_flags = NLM_F_REQUEST | NLM_F_DUMP;
+        request.mHeader.nlmsg_seq   = static_cast<uint32_t>(phase + 1);
+        request.mGen.rtgen_family   = AF_UNSPEC;
+
+        VerifyOrExit(send(sock, &request, request.mHeader.nlmsg_len, 0) >= 0);
+
+        while (!done)
+        {
+            uint8_t buffer[8192];
+            ssize_t len = recv(sock, buffer, sizeof(buffer), MSG_DONTWAIT);
+
+            if (len < 0)
+            {
+                break;
+            }
+
+            for (struct nlmsghdr *header = reinterpret_cast<struct nlmsghdr *>(buffer);
+                 NLMSG_OK(header, static_cast<size_t>(len)); header = NLMSG_NEXT(header, len))
+            {
+                if (header->nlmsg_type == NLMSG_DONE || header->nlmsg_type == NLMSG_ERROR)
+                {
+                    done = true;
+                    break;
+                }
+
+                if (phase == 0 && header->nlmsg_type == RTM_NEWROUTE)
+                {
+                    struct rtmsg *route      = reinterpret_cast<struct rtmsg *>(NLMSG_DATA(header));
+                    int           attrLen    = static_cast<int>(RTM_PAYLOAD(header));
+                    uint32_t      oifIndex   = 0;
+                    bool          hasGateway = false;
+                    GatewayEntry  entry{};
+
+                    // Only default routes identify the gateway a candidate
+                    // link depends on.
+                    if (route->rtm_dst_len != 0)
+                    {
+                        continue;
+                    }
+
+                    for (struct rtattr *rta = RTM_RTA(route); RTA_OK(rta, attrLen); rta = RTA_NEXT(rta, attrLen))
+                    {
+                        if (rta->rta_type == RTA_OIF)
+                        {
+                            oifIndex = *reinterpret_cast<uint32_t *>(RTA_DATA(rta));
+                        }
+                        else if (rta->rta_type == RTA_GATEWAY && RTA_PAYLOAD(rta) <= sizeof(entry.mAddress))
+                        {
+                            entry.mAddressLength = static_cast<uint16_t>(RTA_PAYLOAD(rta));
+                            memcpy(entry.mAddress, RTA_DATA(rta), entry.mAddressLength);
+                            hasGateway = true;
+                        }
+                    }
+
+                    if (hasGateway && oifIndex != 0)
+                    {
+                        entry.mIfIndex   = oifIndex;
+                        entry.mFamily    = route->rtm_family;
+                        entry.mReachable = false;
+                        gateways.push_back(entry);
+                    }
+                }
+                else if (phase == 1 && header->nlmsg_type == RTM_NEWNEIGH)
+                {
+                    struct ndmsg * neigh = reinterpret_cast<struct ndmsg *>(NLMSG_DATA(header));
+                    struct rtattr *rta   = reinterpret_cast<struct rtattr *>(reinterpret_cast<char *>(neigh) +
+                                                                           NLMSG_ALIGN(sizeof(struct ndmsg)));
+                    int            attrLen =
+                        static_cast<int>(header->nlmsg_len - NLMSG_LENGTH(NLMSG_ALIGN(sizeof(struct ndmsg))));
+
+                    if (!(neigh->ndm_state & (NUD_REACHABLE | NUD_STALE | NUD_DELAY | NUD_PROBE | NUD_PERMANENT)))
+                    {
+                        continue;
+                    }
+
+                    for (; RTA_OK(rta, attrLen); rta = RTA_NEXT(rta, attrLen))
+                    {
+                        if (rta->rta_type != NDA_DST)
+                        {
+                            continue;
+                        }
+
+                        for (GatewayEntry &gateway : gateways)
+                        {
+                            if (gateway.mIfIndex == static_cast<uint32_t>(neigh->ndm_ifindex) &&
+                                gateway.mFamily == neigh->ndm_family &&
+                                gateway.mAddressLength == RTA_PAYLOAD(rta) &&
+                                memcmp(gateway.mAddress, RTA_DATA(rta), gateway.mAddressLength) == 0)
+                            {
+                                gateway.mReachable = true;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    for (const char *name : mInfraLinkNames)
+    {
+        uint32_t  index    = if_nametoindex(name);
+        LinkInfo &linkInfo = mInfraLinkInfos[name];
+
+        for (const GatewayEntry &gateway : gateways)
+        {
+            if (gateway.mIfIndex == index)
+            {
+                linkInfo.mGatewayKnown     = true;
+                linkInfo.mGatewayReachable = linkInfo.mGatewayReachable || gateway.mReachable;
+            }
+        }
+    }
+
+exit:
+    if (sock != -1)
+    {
+        close(sock);
+    }
+}
+
 void InfraLinkSelector::Update(MainloopContext &aMainloop)
 {
     if (mNetlinkSocket != -1)
@@ -252,47 +505,68 @@ void InfraLinkSelector::Process(const MainloopContext &aMainloop)
 
 void InfraLinkSelector::ReceiveNetLinkMessage(void)
 {
-    const size_t kMaxNetLinkBufSize = 8192;
-    ssize_t      len;
+    const size_t          kMaxNetLinkBufSize = 8192;
+    ssize_t               len;
+    std::vector<uint32_t> changedIndexes;
     union
     {
         nlmsghdr mHeader;
         uint8_t  mBuffer[kMaxNetLinkBufSize];
     } msgBuffer;
 
-    len = recv(mNetlinkSocket, msgBuffer.mBuffer, sizeof(msgBuffer.mBuffer), 0);
-    if (len < 0)
+    // Drain every queued datagram and deduplicate the touched links
+    // before acting, so an interface churn storm costs one state query
+    // per link per batch instead of one per event.
+    while (true)
     {
-        otbrLogWarning("Failed to receive netlink message: %s", strerror(errno));
-        ExitNow();
-    }
-
-    for (struct nlmsghdr *header = &msgBuffer.mHeader; NLMSG_OK(header, static_cast<size_t>(len));
-         header                  = NLMSG_NEXT(header, len))
-    {
-        struct ifinfomsg *ifinfo;
-
-        switch (header->nlmsg_type)
+        len = recv(mNetlinkSocket, msgBuffer.mBuffer, sizeof(msgBuffer.mBuffer), MSG_DONTWAIT);
+        if (len < 0)
         {
-        case RTM_NEWLINK:
-        case RTM_DELLINK:
-            ifinfo = reinterpret_cast<struct ifinfomsg *>(NLMSG_DATA(header));
-            HandleInfraLinkStateChange(ifinfo->ifi_index);
+            if (errno != EAGAIN && errno != EWOULDBLOCK)
+            {
+                otbrLogWarning("Failed to receive netlink message: %s", strerror(errno));
+            }
             break;
-        case NLMSG_ERROR:
+        }
+
+        for (struct nlmsghdr *header = &msgBuffer.mHeader; NLMSG_OK(header, static_cast<size_t>(len));
+             header                  = NLMSG_NEXT(header, len))
         {
-            struct nlmsgerr *errMsg = reinterpret_cast<struct nlmsgerr *>(NLMSG_DATA(header));
+            struct ifinfomsg *ifinfo;
+            uint32_t          index;
 
-            otbrLogWarning("netlink NLMSG_ERROR response: seq=%u, error=%d", header->nlmsg_seq, errMsg->error);
-            break;
-        }
-        default:
-            break;
+            switch (header->nlmsg_type)
+            {
+            case RTM_NEWLINK:
+            case RTM_DELLINK:
+                ifinfo = reinterpret_cast<struct ifinfomsg *>(NLMSG_DATA(header));
+                index  = static_cast<uint32_t>(ifinfo->ifi_index);
+                if (std::find(changedIndexes.begin(), changedIndexes.end(), index) == changedIndexes.end())
+                {
+                    changedIndexes.push_back(index);
+                }
+                break;
+            case NLMSG_ERROR:
+            {
+                struct nlmsgerr *errMsg = reinterpret_cast<struct nlmsgerr *>(NLMSG_DATA(header));
+
+                otbrLogWarning("netlink NLMSG_ERROR response: seq=%u, error=%d", header->nlmsg_seq, errMsg->error);
+                break;
+            }
+            default:
+                break;
+            }
         }
     }
 
-exit:
-    return;
+    // `mRequireReselect` defers the actual evaluation to the next
+    // `Select()` call, so the whole batch triggers at most one
+    // re-evaluation and the `kInfraLinkSelectionDelay` handling in
+    // `SelectGeneric()` is untouched.
+    for (uint32_t index : changedIndexes)
+    {
+        HandleInfraLinkStateChange(index);
+    }
 }
 
 void InfraLinkSelector::HandleInfraLinkStateChange(uint32_t aInfraLinkIndex)
@@ -120,6 +120,13 @@ private:
         Clock::time_point mLastRunningTime;
         bool              mWasUpAndRunning = false;
 
+        // Link quality probed right before each evaluation; see
+        // `ProbeLinkQualities()`.
+        bool     mGatewayKnown     = false; ///< Whether a default gateway was found on this link.
+        bool     mGatewayReachable = false; ///< Whether that gateway has a live neighbor cache entry.
+        uint64_t mByteCount        = 0;     ///< rx+tx byte counter at the last evaluation.
+        uint64_t mRecentThroughput = 0;     ///< Bytes moved between the last two evaluations.
+
         bool Update(LinkState aState);
     };
 
@@ -130,10 +137,14 @@ private:
 
     static const char *LinkStateToString(LinkState aState);
     static LinkState   QueryInfraLinkState(const char *aInfraLinkName);
+    static uint64_t    ReadLinkByteCount(const char *aInfraLinkName);
+    static bool        IsBetterQuality(const LinkInfo &aLhs, const LinkInfo &aRhs);
     void               Update(MainloopContext &aMainloop) override;
     void               Process(const MainloopContext &aMainloop) override;
     void               ReceiveNetLinkMessage(void);
     void               HandleInfraLinkStateChange(uint32_t aInfraLinkIndex);
+    void               ProbeLinkQualities(void);
+    void               QueryGatewayReachability(void);
 
     std::vector<const char *>        mInfraLinkNames;
     std::map<const char *, LinkInfo> mInfraLinkInfos;
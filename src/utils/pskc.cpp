@@ -33,12 +33,82 @@
 
 #include "utils/pskc.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <thread>
+
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
 
 namespace otbr {
 namespace Psk {
 
+namespace {
+
+struct PskcCacheEntry
+{
+    std::string mKey;
+    uint8_t     mPskc[OT_PSKC_LENGTH];
+};
+
+constexpr size_t kPskcCacheSize = 8;
+
+// The most recently used entry is kept at the front.
+std::list<PskcCacheEntry> sPskcCache;
+std::mutex                sPskcCacheMutex;
+
+std::string MakePskcCacheKey(const uint8_t *aExtPanId, const char *aNetworkName, const char *aPassphrase)
+{
+    std::string key;
+
+    key.reserve(OT_EXTENDED_PAN_ID_LENGTH + strlen(aNetworkName) + strlen(aPassphrase) + 2);
+    key.append(reinterpret_cast<const char *>(aExtPanId), OT_EXTENDED_PAN_ID_LENGTH);
+    key.append(aNetworkName);
+    key.push_back('\0');
+    key.append(aPassphrase);
+
+    return key;
+}
+
+bool FindCachedPskc(const std::string &aKey, uint8_t *aPskc)
+{
+    std::lock_guard<std::mutex> lock(sPskcCacheMutex);
+    bool                        found = false;
+
+    for (auto it = sPskcCache.begin(); it != sPskcCache.end(); ++it)
+    {
+        if (it->mKey == aKey)
+        {
+            memcpy(aPskc, it->mPskc, OT_PSKC_LENGTH);
+            sPskcCache.splice(sPskcCache.begin(), sPskcCache, it);
+            found = true;
+            break;
+        }
+    }
+
+    return found;
+}
+
+void StoreCachedPskc(const std::string &aKey, const uint8_t *aPskc)
+{
+    std::lock_guard<std::mutex> lock(sPskcCacheMutex);
+    PskcCacheEntry              entry;
+
+    entry.mKey = aKey;
+    memcpy(entry.mPskc, aPskc, OT_PSKC_LENGTH);
+
+    sPskcCache.push_front(std::move(entry));
+
+    if (sPskcCache.size() > kPskcCacheSize)
+    {
+        sPskcCache.pop_back();
+    }
+}
+
+} // namespace
+
 void Pskc::SetSalt(const uint8_t *aExtPanId, const char *aNetworkName)
 {
     const char *saltPrefix = "Thread";
@@ -74,8 +144,12 @@ const uint8_t *Pskc::ComputePskc(const uint8_t *aExtPanId, const char *aNetworkN
     uint8_t  prfInput[OT_PBKDF2_SALT_MAX_LENGTH + 4];
     uint8_t  prfOutput[MBEDTLS_CIPHER_BLKSIZE_MAX];
     uint8_t  keyBlock[MBEDTLS_CIPHER_BLKSIZE_MAX];
-    uint16_t keyLen = OT_PSKC_LENGTH;
-    uint8_t *pskc   = mPskc;
+    uint16_t    keyLen = OT_PSKC_LENGTH;
+    uint8_t *   pskc   = mPskc;
+    std::string cacheKey;
+
+    cacheKey = MakePskcCacheKey(aExtPanId, aNetworkName, aPassphrase);
+    VerifyOrExit(!FindCachedPskc(cacheKey, mPskc));
 
     SetSalt(aExtPanId, aNetworkName);
 
@@ -113,8 +187,50 @@ const uint8_t *Pskc::ComputePskc(const uint8_t *aExtPanId, const char *aNetworkN
         pskc += useLen;
         keyLen -= useLen;
     }
+
+    StoreCachedPskc(cacheKey, mPskc);
+
+exit:
     return mPskc;
 }
 
+void Pskc::ComputePskcBatch(std::vector<PskcBatchItem> &aItems)
+{
+    size_t numThreads =
+        std::min<size_t>(aItems.size(), std::max<size_t>(1, std::thread::hardware_concurrency()));
+    std::atomic<size_t>      nextIndex(0);
+    std::vector<std::thread> workers;
+
+    auto deriveItems = [&aItems, &nextIndex](void) {
+        Pskc   pskc;
+        size_t index;
+
+        while ((index = nextIndex.fetch_add(1)) < aItems.size())
+        {
+            PskcBatchItem &item = aItems[index];
+
+            memcpy(item.mPskc, pskc.ComputePskc(item.mExtPanId, item.mNetworkName.c_str(), item.mPassphrase.c_str()),
+                   OT_PSKC_LENGTH);
+        }
+    };
+
+    if (numThreads <= 1)
+    {
+        deriveItems();
+    }
+    else
+    {
+        for (size_t i = 0; i < numThreads; i++)
+        {
+            workers.emplace_back(deriveItems);
+        }
+
+        for (std::thread &worker : workers)
+        {
+            worker.join();
+        }
+    }
+}
+
 } // namespace Psk
 } // namespace otbr
@@ -45,6 +45,9 @@
 #include <stdint.h>
 #include <string.h>
 
+#include <string>
+#include <vector>
+
 #include <mbedtls/cmac.h>
 
 namespace otbr {
@@ -56,12 +59,28 @@ enum
     kPskcStatus_InvalidArgument = 1
 };
 
+/**
+ * This structure represents one candidate network in a batch PSKc derivation.
+ *
+ */
+struct PskcBatchItem
+{
+    uint8_t     mExtPanId[OT_EXTENDED_PAN_ID_LENGTH]; ///< The extended PAN ID.
+    std::string mNetworkName;                         ///< The network name.
+    std::string mPassphrase;                          ///< The commissioning passphrase.
+    uint8_t     mPskc[OT_PSKC_LENGTH];                ///< The derived PSKc (output).
+};
+
 class Pskc
 {
 public:
     /**
      * This method computes the PSKc.
      *
+     * The derivation runs 16384 AES-CMAC iterations, so results are kept in
+     * a small process-wide LRU cache keyed by the input tuple; repeated
+     * computations for unchanged inputs return without rederiving.
+     *
      * @param[in] aExtPanId     A pointer to extended PAN ID.
      * @param[in] aNetworkName  A pointer to network name.
      * @param[in] aPassphrase   A pointer to passphrase.
@@ -71,6 +90,18 @@ public:
      */
     const uint8_t *ComputePskc(const uint8_t *aExtPanId, const char *aNetworkName, const char *aPassphrase);
 
+    /**
+     * This method computes the PSKc for multiple candidate networks.
+     *
+     * The derivations are distributed over worker threads, one per hardware
+     * thread at most, and each result is written to the `mPskc` field of its
+     * item. Cached results are reused and new results populate the cache.
+     *
+     * @param[in,out] aItems  The batch items to derive the PSKc for.
+     *
+     */
+    static void ComputePskcBatch(std::vector<PskcBatchItem> &aItems);
+
 private:
     void SetSalt(const uint8_t *aExtPanId, const char *aNetworkName);
 
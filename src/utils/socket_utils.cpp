@@ -61,6 +61,51 @@ exit:
     return fd;
 }
 
+int CreateSocket(const SocketSpec &aSpec)
+{
+    int rval = 0;
+    int on   = 1;
+    int fd;
+
+    fd = SocketWithCloseExec(aSpec.mDomain, aSpec.mType, aSpec.mProtocol, aSpec.mBlockOption);
+    VerifyOrExit(fd != -1);
+
+    if (aSpec.mReuseAddr)
+    {
+        VerifyOrExit((rval = setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on))) == 0,
+                     perror("setsockopt(SO_REUSEADDR)"));
+    }
+
+#ifdef SO_REUSEPORT
+    if (aSpec.mReusePort)
+    {
+        VerifyOrExit((rval = setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, &on, sizeof(on))) == 0,
+                     perror("setsockopt(SO_REUSEPORT)"));
+    }
+#endif
+
+    if (aSpec.mRcvBufSize > 0)
+    {
+        VerifyOrExit((rval = setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &aSpec.mRcvBufSize, sizeof(aSpec.mRcvBufSize))) == 0,
+                     perror("setsockopt(SO_RCVBUF)"));
+    }
+
+    if (aSpec.mSndBufSize > 0)
+    {
+        VerifyOrExit((rval = setsockopt(fd, SOL_SOCKET, SO_SNDBUF, &aSpec.mSndBufSize, sizeof(aSpec.mSndBufSize))) == 0,
+                     perror("setsockopt(SO_SNDBUF)"));
+    }
+
+exit:
+    if (fd != -1 && rval != 0)
+    {
+        close(fd);
+        fd = -1;
+    }
+
+    return fd;
+}
+
 #if __linux__
 int CreateNetLinkRouteSocket(uint32_t aNlGroups)
 {
@@ -44,6 +44,37 @@ enum SocketBlockOption
     kSocketNonBlock, ///< The socket is non-blocking.
 };
 
+/**
+ * This structure declaratively describes a socket to create and tune.
+ *
+ * It gathers the options that were previously scattered over per-caller
+ * `setsockopt()` sequences; the defaults yield a nonblocking close-on-exec
+ * socket with kernel-default buffer sizes.
+ *
+ */
+struct SocketSpec
+{
+    int               mDomain      = AF_UNSPEC;       ///< The communication domain.
+    int               mType        = 0;               ///< The semantics of communication.
+    int               mProtocol    = 0;               ///< The protocol to use.
+    SocketBlockOption mBlockOption = kSocketNonBlock; ///< Blocking semantics; nonblocking by default.
+    bool              mReuseAddr   = false;           ///< Whether to set SO_REUSEADDR.
+    bool              mReusePort   = false;           ///< Whether to set SO_REUSEPORT.
+    int               mRcvBufSize  = 0;               ///< SO_RCVBUF in bytes; 0 keeps the kernel default.
+    int               mSndBufSize  = 0;               ///< SO_SNDBUF in bytes; 0 keeps the kernel default.
+};
+
+/**
+ * This function creates a socket from a spec, applying all options in one place.
+ *
+ * @param[in] aSpec  The socket spec.
+ *
+ * @retval -1   Failed to create or configure the socket.
+ * @retval ...  The file descriptor of the created socket.
+ *
+ */
+int CreateSocket(const SocketSpec &aSpec);
+
 /**
  * This function creates a socket with SOCK_CLOEXEC flag set.
  *
@@ -0,0 +1,195 @@
+/*
+ *    Copyright (c) 2022, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes implementation of the persisted runtime state snapshot.
+ */
+
+#define OTBR_LOG_TAG "UTILS"
+
+#include "utils/state_snapshot.hpp"
+
+#include <errno.h>
+#include <string.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "common/logging.hpp"
+
+namespace otbr {
+namespace Utils {
+
+static const char kDefaultSegmentPath[] = "/var/run/otbr-state-snapshot";
+
+constexpr uint16_t StateSnapshot::kMaxInstanceNameLength;
+constexpr uint16_t StateSnapshot::kMaxTxtDataLength;
+
+StateSnapshot::StateSnapshot(void)
+    : mSegmentPath(kDefaultSegmentPath)
+    , mFd(-1)
+    , mSegment(nullptr)
+{
+}
+
+otbrError StateSnapshot::Init(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    mFd = open(mSegmentPath.c_str(), O_CREAT | O_RDWR | O_CLOEXEC, 0600);
+    VerifyOrExit(mFd >= 0, error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(ftruncate(mFd, sizeof(Segment)) == 0, error = OTBR_ERROR_ERRNO);
+
+    mSegment = static_cast<Segment *>(mmap(nullptr, sizeof(Segment), PROT_READ | PROT_WRITE, MAP_SHARED, mFd, 0));
+    VerifyOrExit(mSegment != MAP_FAILED, mSegment = nullptr; error = OTBR_ERROR_ERRNO);
+
+    // Unlike the telemetry segment, existing content is the whole point
+    // here: only reinitialize when the segment is from another layout or
+    // was torn by a crash mid-write (odd sequence).
+    if (mSegment->mMagic != kMagic || mSegment->mLayoutVersion != kLayoutVersion || (mSegment->mSequence & 1) != 0)
+    {
+        memset(mSegment, 0, sizeof(Segment));
+        mSegment->mMagic         = kMagic;
+        mSegment->mLayoutVersion = kLayoutVersion;
+    }
+
+    otbrLogInfo("Mapped state snapshot at %s", mSegmentPath.c_str());
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLogWarning("Failed to map state snapshot %s: %s", mSegmentPath.c_str(), strerror(errno));
+        Deinit();
+    }
+
+    return error;
+}
+
+void StateSnapshot::Deinit(void)
+{
+    if (mSegment != nullptr)
+    {
+        munmap(mSegment, sizeof(Segment));
+        mSegment = nullptr;
+    }
+
+    if (mFd >= 0)
+    {
+        close(mFd);
+        mFd = -1;
+    }
+}
+
+bool StateSnapshot::GetMeshCopService(std::string &         aInstanceName,
+                                      uint16_t &            aPort,
+                                      std::vector<uint8_t> &aTxtData,
+                                      uint64_t &            aDatasetDigest) const
+{
+    bool valid = false;
+
+    VerifyOrExit(mSegment != nullptr);
+    VerifyOrExit(mSegment->mMeshCopValid != 0);
+    VerifyOrExit(mSegment->mMeshCopTxtLength <= kMaxTxtDataLength);
+    VerifyOrExit(memchr(mSegment->mMeshCopInstanceName, '\0', sizeof(mSegment->mMeshCopInstanceName)) != nullptr);
+
+    aInstanceName  = mSegment->mMeshCopInstanceName;
+    aPort          = mSegment->mMeshCopPort;
+    aTxtData       = std::vector<uint8_t>(mSegment->mMeshCopTxtData,
+                                          mSegment->mMeshCopTxtData + mSegment->mMeshCopTxtLength);
+    aDatasetDigest = mSegment->mDatasetDigest;
+    valid          = true;
+
+exit:
+    return valid;
+}
+
+void StateSnapshot::SetMeshCopService(const std::string &         aInstanceName,
+                                      uint16_t                    aPort,
+                                      const std::vector<uint8_t> &aTxtData,
+                                      uint64_t                    aDatasetDigest)
+{
+    VerifyOrExit(mSegment != nullptr);
+
+    BeginWrite();
+
+    if (aInstanceName.size() > kMaxInstanceNameLength || aTxtData.size() > kMaxTxtDataLength)
+    {
+        otbrLogWarning("MeshCoP registration too large for state snapshot, invalidating");
+        mSegment->mMeshCopValid = 0;
+    }
+    else
+    {
+        mSegment->mMeshCopPort      = aPort;
+        mSegment->mMeshCopTxtLength = static_cast<uint16_t>(aTxtData.size());
+        mSegment->mDatasetDigest    = aDatasetDigest;
+
+        memset(mSegment->mMeshCopInstanceName, 0, sizeof(mSegment->mMeshCopInstanceName));
+        memcpy(mSegment->mMeshCopInstanceName, aInstanceName.c_str(), aInstanceName.size());
+        memcpy(mSegment->mMeshCopTxtData, aTxtData.data(), aTxtData.size());
+
+        mSegment->mMeshCopValid = 1;
+    }
+
+    EndWrite();
+
+exit:
+    return;
+}
+
+uint64_t StateSnapshot::ComputeDigest(const uint8_t *aData, size_t aLength)
+{
+    uint64_t hash = 14695981039346656037ULL; // FNV-1a 64-bit offset basis.
+
+    for (size_t i = 0; i < aLength; i++)
+    {
+        hash ^= aData[i];
+        hash *= 1099511628211ULL; // FNV-1a 64-bit prime.
+    }
+
+    return hash;
+}
+
+void StateSnapshot::BeginWrite(void)
+{
+    // Seqlock write side: an odd sequence marks an in-progress write so a
+    // crash between the bumps invalidates the segment on the next start.
+    __atomic_store_n(&mSegment->mSequence, mSegment->mSequence + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+}
+
+void StateSnapshot::EndWrite(void)
+{
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    __atomic_store_n(&mSegment->mSequence, mSegment->mSequence + 1, __ATOMIC_RELEASE);
+}
+
+} // namespace Utils
+} // namespace otbr
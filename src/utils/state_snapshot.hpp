@@ -0,0 +1,175 @@
+/*
+ *    Copyright (c) 2022, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the persisted runtime state snapshot.
+ */
+
+#ifndef OTBR_UTILS_STATE_SNAPSHOT_HPP_
+#define OTBR_UTILS_STATE_SNAPSHOT_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "common/code_utils.hpp"
+#include "common/types.hpp"
+
+namespace otbr {
+namespace Utils {
+
+/**
+ * This class persists derived runtime state across agent restarts.
+ *
+ * The snapshot is an mmap'ed file kept under `/var/run` (tmpfs), so it
+ * survives a crash or a package upgrade within the same boot but not a
+ * reboot. A restarting agent reads it back to warm-start its mDNS
+ * registration instead of waiting for the NCP state to be re-derived,
+ * keyed by a digest of the active dataset so stale state is never
+ * replayed. Writes bump `mSequence` to an odd value first and to the
+ * next even value when done; a snapshot left with an odd sequence by a
+ * crash mid-write is discarded on the next start.
+ *
+ */
+class StateSnapshot : private NonCopyable
+{
+public:
+    static constexpr uint32_t kMagic                 = 0x4f544253; ///< "OTBS"
+    static constexpr uint32_t kLayoutVersion         = 1;          ///< Layout version written to `mLayoutVersion`.
+    static constexpr uint16_t kMaxInstanceNameLength = 63;         ///< Capacity of `mMeshCopInstanceName`, sans NUL.
+    static constexpr uint16_t kMaxTxtDataLength      = 512;        ///< Capacity of `mMeshCopTxtData`.
+
+    /**
+     * This structure is the on-disk layout of the snapshot segment.
+     *
+     * All multi-byte fields use the native byte order of the host; the
+     * segment is only meant to be read on the machine that writes it.
+     * `mLayoutVersion` must be bumped whenever the layout changes.
+     *
+     */
+    struct Segment
+    {
+        uint32_t mMagic;         ///< Must equal `kMagic`.
+        uint32_t mLayoutVersion; ///< Must equal `kLayoutVersion`.
+        uint32_t mSequence;      ///< Sequence lock; odd while a write is in progress.
+        uint32_t mReserved;      ///< Reserved, zero.
+
+        uint8_t  mMeshCopValid;      ///< Whether the MeshCoP registration fields below are valid.
+        uint8_t  mPadding[3];        ///< Padding, zero.
+        uint16_t mMeshCopPort;       ///< Port of the published MeshCoP service.
+        uint16_t mMeshCopTxtLength;  ///< Number of valid bytes in `mMeshCopTxtData`.
+        uint64_t mDatasetDigest;     ///< Digest of the active dataset the registration was derived from.
+
+        char    mMeshCopInstanceName[kMaxInstanceNameLength + 1]; ///< NUL-terminated service instance name.
+        uint8_t mMeshCopTxtData[kMaxTxtDataLength];               ///< Encoded TXT data of the MeshCoP service.
+    };
+
+    StateSnapshot(void);
+
+    /**
+     * This method maps the snapshot segment, creating it when absent.
+     *
+     * An existing segment with a matching magic, layout version and an
+     * even sequence is kept as-is so its content can be read back; any
+     * other content is reinitialized to empty.
+     *
+     * @retval OTBR_ERROR_NONE   Successfully mapped the segment.
+     * @retval OTBR_ERROR_ERRNO  Failed to create or map the segment file.
+     *
+     */
+    otbrError Init(void);
+
+    /**
+     * This method unmaps the snapshot segment.
+     *
+     * The backing file is deliberately left in place so the next agent
+     * instance can warm-start from it.
+     *
+     */
+    void Deinit(void);
+
+    /**
+     * This method reads back the persisted MeshCoP service registration.
+     *
+     * @param[out] aInstanceName   The persisted service instance name.
+     * @param[out] aPort           The persisted service port.
+     * @param[out] aTxtData        The persisted encoded TXT data.
+     * @param[out] aDatasetDigest  The active dataset digest the registration was derived from.
+     *
+     * @returns  Whether a valid registration was read back.
+     *
+     */
+    bool GetMeshCopService(std::string &         aInstanceName,
+                           uint16_t &            aPort,
+                           std::vector<uint8_t> &aTxtData,
+                           uint64_t &            aDatasetDigest) const;
+
+    /**
+     * This method persists the MeshCoP service registration.
+     *
+     * A registration whose name or TXT data exceeds the segment capacity
+     * is not persisted and the segment is invalidated instead.
+     *
+     * @param[in] aInstanceName   The service instance name.
+     * @param[in] aPort           The service port.
+     * @param[in] aTxtData        The encoded TXT data.
+     * @param[in] aDatasetDigest  The active dataset digest the registration was derived from.
+     *
+     */
+    void SetMeshCopService(const std::string &         aInstanceName,
+                           uint16_t                    aPort,
+                           const std::vector<uint8_t> &aTxtData,
+                           uint64_t                    aDatasetDigest);
+
+    /**
+     * This method computes the digest used to key snapshot entries.
+     *
+     * @param[in] aData    A pointer to the data to digest.
+     * @param[in] aLength  The length of the data, in bytes.
+     *
+     * @returns  The 64-bit FNV-1a digest of the data.
+     *
+     */
+    static uint64_t ComputeDigest(const uint8_t *aData, size_t aLength);
+
+private:
+    void BeginWrite(void);
+    void EndWrite(void);
+
+    std::string mSegmentPath;
+    int         mFd;
+    Segment *   mSegment;
+};
+
+} // namespace Utils
+} // namespace otbr
+
+#endif // OTBR_UTILS_STATE_SNAPSHOT_HPP_
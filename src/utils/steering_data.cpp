@@ -61,20 +61,28 @@ void SteeringData::ComputeJoinerId(const uint8_t *aEui64, uint8_t *aJoinerId)
 }
 
 void SteeringData::ComputeBloomFilter(const uint8_t *aJoinerId)
+{
+    ComputeBloomFilters(aJoinerId, 1);
+}
+
+void SteeringData::ComputeBloomFilters(const uint8_t *aJoinerIds, size_t aCount)
 {
     Crc16          ccitt(Crc16::kCcitt);
     Crc16          ansi(Crc16::kAnsi);
     const uint16_t numBits = mLength * 8;
 
-    for (size_t i = 0; i < kSizeJoinerId; i++)
+    // The hashers are constructed once for the whole batch; the table-driven
+    // Update() folds each 8-byte joiner id in a single slice-by-8 step.
+    for (size_t i = 0; i < aCount; i++, aJoinerIds += kSizeJoinerId)
     {
-        uint8_t byte = aJoinerId[i];
-        ccitt.Update(byte);
-        ansi.Update(byte);
-    }
+        ccitt.Init();
+        ansi.Init();
+        ccitt.Update(aJoinerIds, kSizeJoinerId);
+        ansi.Update(aJoinerIds, kSizeJoinerId);
 
-    SetBit(static_cast<uint8_t>(ccitt.Get() % numBits));
-    SetBit(static_cast<uint8_t>(ansi.Get() % numBits));
+        SetBit(static_cast<uint8_t>(ccitt.Get() % numBits));
+        SetBit(static_cast<uint8_t>(ansi.Get() % numBits));
+    }
 }
 
 } // namespace otbr
@@ -36,6 +36,7 @@
 
 #include "openthread-br/config.h"
 
+#include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 
@@ -90,6 +91,19 @@ public:
      */
     void ComputeBloomFilter(const uint8_t *aJoinerId);
 
+    /**
+     * This method folds a batch of joiner ids into the Bloom Filter in one pass.
+     *
+     * The CRC hashers are set up once and reused across the whole batch, so
+     * mass commissioning flows pay no per-joiner setup cost.
+     *
+     * @param[in] aJoinerIds  A pointer to @p aCount consecutive joiner ids of
+     *                        `kSizeJoinerId` bytes each.
+     * @param[in] aCount      The number of joiner ids.
+     *
+     */
+    void ComputeBloomFilters(const uint8_t *aJoinerIds, size_t aCount);
+
     /**
      * This method computes joiner id from EUI64.
      *
@@ -28,7 +28,7 @@
 
 #include "utils/string_utils.hpp"
 
-#include <algorithm>
+#include <stdint.h>
 
 #include "common/code_utils.hpp"
 
@@ -36,16 +36,112 @@ namespace otbr {
 
 namespace StringUtils {
 
+namespace {
+
+// A locale-free lowercase lookup table, so case normalization is one
+// branch-free load per character.
+struct LowercaseTable
+{
+    LowercaseTable(void)
+    {
+        for (int i = 0; i < 256; i++)
+        {
+            mChars[i] = static_cast<char>(i);
+        }
+
+        for (int i = 'A'; i <= 'Z'; i++)
+        {
+            mChars[i] = static_cast<char>(i - 'A' + 'a');
+        }
+    }
+
+    char mChars[256];
+};
+
+const LowercaseTable sLowercaseTable;
+
+// Lowercases all eight bytes of a word at once: a lane holds an uppercase
+// ASCII letter iff its 7-bit value is >= 'A' and not > 'Z' and its top bit
+// is clear, and OR-ing 0x20 into exactly those lanes lowercases them. The
+// adds cannot carry between lanes because the inputs are masked to 7 bits.
+static inline uint64_t LowercaseWord(uint64_t aWord)
+{
+    const uint64_t kOnes   = UINT64_C(0x0101010101010101);
+    const uint64_t kBit7   = kOnes << 7;
+    uint64_t       heptets = aWord & ~kBit7;
+    uint64_t       isGeA   = heptets + (UINT64_C(0x80) - 'A') * kOnes;
+    uint64_t       isGtZ   = heptets + (UINT64_C(0x7f) - 'Z') * kOnes;
+    uint64_t       isUpper = isGeA & ~isGtZ & ~aWord & kBit7;
+
+    return aWord | (isUpper >> 2);
+}
+
+static inline uint64_t LoadWord(const char *aChars)
+{
+    uint64_t word;
+
+    memcpy(&word, aChars, sizeof(word));
+    return word;
+}
+
+} // namespace
+
 bool EqualCaseInsensitive(const std::string &aString1, const std::string &aString2)
 {
-    return ToLowercase(aString1) == ToLowercase(aString2);
+    return EqualCaseInsensitive(aString1.data(), aString1.size(), aString2.data(), aString2.size());
+}
+
+bool EqualCaseInsensitive(const char *aString1, size_t aLength1, const char *aString2, size_t aLength2)
+{
+    bool   equal = aLength1 == aLength2;
+    size_t i     = 0;
+
+    // Compare word-sized chunks first; DNS-SD name matching is the most
+    // frequent string operation in browse-heavy profiles, so the bulk of
+    // each name is folded eight bytes at a time.
+    if (equal)
+    {
+        for (; i + sizeof(uint64_t) <= aLength1; i += sizeof(uint64_t))
+        {
+            if (LowercaseWord(LoadWord(aString1 + i)) != LowercaseWord(LoadWord(aString2 + i)))
+            {
+                equal = false;
+                break;
+            }
+        }
+    }
+
+    for (; equal && i < aLength1; i++)
+    {
+        equal = sLowercaseTable.mChars[static_cast<uint8_t>(aString1[i])] ==
+                sLowercaseTable.mChars[static_cast<uint8_t>(aString2[i])];
+    }
+
+    return equal;
+}
+
+void ConvertToLowercase(std::string &aString)
+{
+    size_t i = 0;
+
+    for (; i + sizeof(uint64_t) <= aString.size(); i += sizeof(uint64_t))
+    {
+        uint64_t word = LowercaseWord(LoadWord(&aString[i]));
+
+        memcpy(&aString[i], &word, sizeof(word));
+    }
+
+    for (; i < aString.size(); i++)
+    {
+        aString[i] = sLowercaseTable.mChars[static_cast<uint8_t>(aString[i])];
+    }
 }
 
 std::string ToLowercase(const std::string &aString)
 {
     std::string ret = aString;
 
-    std::transform(ret.begin(), ret.end(), ret.begin(), [](char c) { return std::tolower(c); });
+    ConvertToLowercase(ret);
     return ret;
 }
 
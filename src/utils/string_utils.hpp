@@ -36,6 +36,7 @@
 
 #include "openthread-br/config.h"
 
+#include <stddef.h>
 #include <string.h>
 #include <string>
 
@@ -54,6 +55,32 @@ namespace StringUtils {
  */
 bool EqualCaseInsensitive(const std::string &aString1, const std::string &aString2);
 
+/**
+ * This function compares two character ranges in a case-insensitive manner.
+ *
+ * The comparison is locale-free and table-driven, and makes no allocation or
+ * copy, so it is safe in browse callback hot paths.
+ *
+ * @param[in] aString1  A pointer to the first character range.
+ * @param[in] aLength1  The length of the first character range.
+ * @param[in] aString2  A pointer to the second character range.
+ * @param[in] aLength2  The length of the second character range.
+ *
+ * @returns  Whether the two ranges are equal in a case-insensitive manner.
+ *
+ */
+bool EqualCaseInsensitive(const char *aString1, size_t aLength1, const char *aString2, size_t aLength2);
+
+/**
+ * This function converts a given string to lowercase in place.
+ *
+ * The conversion is locale-free and table-driven, and makes no allocation.
+ *
+ * @param[in,out] aString The string to convert.
+ *
+ */
+void ConvertToLowercase(std::string &aString);
+
 /**
  * This function converts a given string to lowercase.
  *
@@ -49,25 +49,21 @@
 #include "common/logging.hpp"
 #include "common/tlv.hpp"
 #include "ncp/ncp_openthread.hpp"
+#include "utils/state_snapshot.hpp"
 
 namespace otbr {
 namespace agent {
 namespace {
-const Tlv *FindTlv(uint8_t aTlvType, const uint8_t *aTlvs, int aTlvsSize)
-{
-    const Tlv *result = nullptr;
+// Typical neighborhoods fit well within this, so a batch scan does not
+// reallocate while beacons are arriving.
+constexpr size_t kActiveScanResultReserve = 32;
 
-    for (const Tlv *tlv = reinterpret_cast<const Tlv *>(aTlvs);
-         reinterpret_cast<const uint8_t *>(tlv) + sizeof(Tlv) < aTlvs + aTlvsSize; tlv = tlv->GetNext())
-    {
-        if (tlv->GetType() == aTlvType)
-        {
-            ExitNow(result = tlv);
-        }
-    }
+// One result per IEEE 802.15.4 channel.
+constexpr size_t kEnergyScanResultReserve = 16;
 
-exit:
-    return result;
+const Tlv *FindTlv(uint8_t aTlvType, const uint8_t *aTlvs, int aTlvsSize)
+{
+    return TlvRange(aTlvs, static_cast<size_t>(aTlvsSize)).FindTlv(aTlvType);
 }
 } // namespace
 
@@ -81,7 +77,7 @@ void ThreadHelper::StateChangedCallback(otChangedFlags aFlags)
 {
     if (aFlags & OT_CHANGED_THREAD_ROLE)
     {
-        otDeviceRole role = otThreadGetDeviceRole(mInstance);
+        otDeviceRole role = mNcp->GetStateSnapshot().mDeviceRole;
 
         for (const auto &handler : mDeviceRoleHandlers)
         {
@@ -133,9 +129,16 @@ void ThreadHelper::ActiveDatasetChangedCallback()
 {
     otError                  error;
     otOperationalDatasetTlvs datasetTlvs;
+    uint64_t                 digest;
 
     SuccessOrExit(error = otDatasetGetActiveTlvs(mInstance, &datasetTlvs));
 
+    // Repeated MGMT_SET commonly re-raises the change flag for an
+    // identical dataset; skip the fan-out when the TLVs are unchanged.
+    digest = Utils::StateSnapshot::ComputeDigest(datasetTlvs.mTlvs, datasetTlvs.mLength);
+    VerifyOrExit(digest != mLastDatasetDigest, error = OT_ERROR_NONE);
+    mLastDatasetDigest = digest;
+
     for (const auto &handler : mActiveDatasetChangeHandlers)
     {
         handler(datasetTlvs);
@@ -174,6 +177,7 @@ void ThreadHelper::Scan(ScanHandler aHandler)
     VerifyOrExit(aHandler != nullptr);
     mScanHandler = aHandler;
     mScanResults.clear();
+    mScanResults.reserve(kActiveScanResultReserve);
 
     error =
         otLinkActiveScan(mInstance, /*scanChannels =*/0, /*scanDuration=*/0, &ThreadHelper::ActiveScanHandler, this);
@@ -189,17 +193,51 @@ exit:
     }
 }
 
+void ThreadHelper::ScanStreaming(StreamingScanHandler aHandler)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(aHandler != nullptr);
+    mStreamingScanHandler = aHandler;
+
+    error =
+        otLinkActiveScan(mInstance, /*scanChannels =*/0, /*scanDuration=*/0, &ThreadHelper::ActiveScanHandler, this);
+
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        if (aHandler)
+        {
+            mStreamingScanHandler(error, nullptr);
+        }
+        mStreamingScanHandler = nullptr;
+    }
+}
+
 void ThreadHelper::EnergyScan(uint32_t aScanDuration, EnergyScanHandler aHandler)
 {
-    otError  error             = OT_ERROR_NONE;
-    uint32_t preferredChannels = otPlatRadioGetPreferredChannelMask(mInstance);
+    StartEnergyScan(otPlatRadioGetPreferredChannelMask(mInstance), aScanDuration, aHandler);
+}
+
+void ThreadHelper::EnergyScanSurvey(uint32_t aChannelMask, uint32_t aScanDuration, EnergyScanHandler aHandler)
+{
+    StartEnergyScan(aChannelMask, aScanDuration, aHandler);
+}
+
+void ThreadHelper::StartEnergyScan(uint32_t aChannelMask, uint32_t aScanDuration, EnergyScanHandler aHandler)
+{
+    otError error = OT_ERROR_NONE;
 
     VerifyOrExit(aHandler != nullptr, error = OT_ERROR_BUSY);
     VerifyOrExit(aScanDuration < UINT16_MAX, error = OT_ERROR_INVALID_ARGS);
     mEnergyScanHandler = aHandler;
+
+    // `clear()` keeps the capacity, so back-to-back scans reuse the same
+    // allocation once the buffer has grown to one result per channel.
     mEnergyScanResults.clear();
+    mEnergyScanResults.reserve(kEnergyScanResultReserve);
 
-    error = otLinkEnergyScan(mInstance, preferredChannels, static_cast<uint16_t>(aScanDuration),
+    error = otLinkEnergyScan(mInstance, aChannelMask, static_cast<uint16_t>(aScanDuration),
                              &ThreadHelper::EnergyScanCallback, this);
 
 exit:
@@ -233,11 +271,22 @@ void ThreadHelper::ActiveScanHandler(otActiveScanResult *aResult, void *aThreadH
 
 void ThreadHelper::ActiveScanHandler(otActiveScanResult *aResult)
 {
-    if (aResult == nullptr)
+    if (mStreamingScanHandler != nullptr)
+    {
+        // Stream each beacon to the handler as it arrives; a null result
+        // marks the end of the scan.
+        mStreamingScanHandler(OT_ERROR_NONE, aResult);
+
+        if (aResult == nullptr)
+        {
+            mStreamingScanHandler = nullptr;
+        }
+    }
+    else if (aResult == nullptr)
     {
         if (mScanHandler != nullptr)
         {
-            mScanHandler(OT_ERROR_NONE, mScanResults);
+            mScanHandler(OT_ERROR_NONE, std::move(mScanResults));
         }
     }
     else
@@ -64,7 +64,8 @@ class ThreadHelper
 {
 public:
     using DeviceRoleHandler       = std::function<void(otDeviceRole)>;
-    using ScanHandler             = std::function<void(otError, const std::vector<otActiveScanResult> &)>;
+    using ScanHandler             = std::function<void(otError, std::vector<otActiveScanResult>)>;
+    using StreamingScanHandler    = std::function<void(otError, const otActiveScanResult *)>;
     using EnergyScanHandler       = std::function<void(otError, const std::vector<otEnergyScanResult> &)>;
     using ResultHandler           = std::function<void(otError)>;
     using AttachHandler           = std::function<void(otError, int64_t)>;
@@ -114,6 +115,19 @@ public:
      */
     void Scan(ScanHandler aHandler);
 
+    /**
+     * This method performs a Thread network scan, delivering results as they arrive.
+     *
+     * @p aHandler is invoked once per beacon as soon as it is received, with no
+     * accumulation, and a final time with a null result when the scan ends (or
+     * with the error when the scan fails to start). Use this instead of `Scan()`
+     * when first-result latency matters.
+     *
+     * @param[in] aHandler  The per-result handler.
+     *
+     */
+    void ScanStreaming(StreamingScanHandler aHandler);
+
     /**
      * This method performs an IEEE 802.15.4 Energy Scan.
      *
@@ -123,6 +137,21 @@ public:
      */
     void EnergyScan(uint32_t aScanDuration, EnergyScanHandler aHandler);
 
+    /**
+     * This method performs an IEEE 802.15.4 Energy Scan over an explicit channel mask.
+     *
+     * The radio walks all masked channels within a single scan request, so a full
+     * 16-channel site survey completes without per-channel host round trips. The
+     * results for all masked channels are delivered to @p aHandler in one batch
+     * from a result buffer that is reused across back-to-back scans.
+     *
+     * @param[in] aChannelMask   The channel mask to scan.
+     * @param[in] aScanDuration  The duration for the scan, in milliseconds.
+     * @param[in] aHandler       The scan result handler.
+     *
+     */
+    void EnergyScanSurvey(uint32_t aChannelMask, uint32_t aScanDuration, EnergyScanHandler aHandler);
+
     /**
      * This method attaches the device to the Thread network.
      *
@@ -263,6 +292,8 @@ private:
     static void ActiveScanHandler(otActiveScanResult *aResult, void *aThreadHelper);
     void        ActiveScanHandler(otActiveScanResult *aResult);
 
+    void StartEnergyScan(uint32_t aChannelMask, uint32_t aScanDuration, EnergyScanHandler aHandler);
+
     static void EnergyScanCallback(otEnergyScanResult *aResult, void *aThreadHelper);
     void        EnergyScanCallback(otEnergyScanResult *aResult);
 
@@ -285,12 +316,14 @@ private:
     otbr::Ncp::ControllerOpenThread *mNcp;
 
     ScanHandler                     mScanHandler;
+    StreamingScanHandler            mStreamingScanHandler;
     std::vector<otActiveScanResult> mScanResults;
     EnergyScanHandler               mEnergyScanHandler;
     std::vector<otEnergyScanResult> mEnergyScanResults;
 
     std::vector<DeviceRoleHandler>    mDeviceRoleHandlers;
     std::vector<DatasetChangeHandler> mActiveDatasetChangeHandlers;
+    uint64_t                          mLastDatasetDigest = 0; ///< Digest of the last fanned-out dataset TLVs.
 
     std::map<uint16_t, size_t> mUnsecurePortRefCounter;
 
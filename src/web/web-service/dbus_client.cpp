@@ -0,0 +1,155 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define OTBR_LOG_TAG "WEB"
+
+#include "web/web-service/dbus_client.hpp"
+
+#if OTBR_ENABLE_DBUS_SERVER
+
+#include <string.h>
+
+#include <chrono>
+#include <vector>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+
+namespace otbr {
+namespace Web {
+
+using DBus::ActiveScanResult;
+using DBus::ClientError;
+
+OpenThreadDBusClient::OpenThreadDBusClient(const char *aNetifName)
+    : mNetifName(aNetifName)
+    , mConnection(nullptr)
+{
+}
+
+OpenThreadDBusClient::~OpenThreadDBusClient(void)
+{
+    mApi.reset();
+
+    if (mConnection != nullptr)
+    {
+        dbus_connection_close(mConnection);
+        dbus_connection_unref(mConnection);
+    }
+}
+
+bool OpenThreadDBusClient::Connect(void)
+{
+    DBusError error;
+
+    dbus_error_init(&error);
+
+    // A private connection, so that concurrent web handlers do not dispatch
+    // each other's replies on a shared one.
+    mConnection = dbus_bus_get_private(DBUS_BUS_SYSTEM, &error);
+
+    if (mConnection == nullptr)
+    {
+        otbrLogErr("Failed to connect to the system bus: %s", error.message != nullptr ? error.message : "unknown");
+        ExitNow();
+    }
+
+    dbus_connection_set_exit_on_disconnect(mConnection, FALSE);
+    mApi.reset(new DBus::ThreadApiDBus(mConnection, mNetifName));
+
+exit:
+    dbus_error_free(&error);
+    return mConnection != nullptr;
+}
+
+int OpenThreadDBusClient::Scan(WpanNetworkInfo *aNetworks, int aLength)
+{
+    // Heap-allocated so a scan that outlives the timeout cannot write into
+    // a dead stack frame when its handler finally fires.
+    struct ScanContext
+    {
+        bool                          mDone = false;
+        std::vector<ActiveScanResult> mResults;
+    };
+
+    std::shared_ptr<ScanContext>          context = std::make_shared<ScanContext>();
+    std::chrono::steady_clock::time_point deadline =
+        std::chrono::steady_clock::now() + std::chrono::milliseconds(kScanTimeout);
+    ClientError error;
+    int         count = 0;
+
+    error = mApi->Scan([context](const std::vector<ActiveScanResult> &aResults) {
+        context->mResults = aResults;
+        context->mDone    = true;
+    });
+    VerifyOrExit(error == ClientError::ERROR_NONE, otbrLogErr("Failed to start scan: %d", static_cast<int>(error)));
+
+    while (!context->mDone && std::chrono::steady_clock::now() < deadline)
+    {
+        VerifyOrExit(dbus_connection_read_write_dispatch(mConnection, kDispatchTimeout));
+    }
+    VerifyOrExit(context->mDone, otbrLogErr("Timed out waiting for the scan to complete"));
+
+    for (const ActiveScanResult &result : context->mResults)
+    {
+        VerifyOrExit(count < aLength);
+
+        WpanNetworkInfo &network = aNetworks[count];
+
+        memset(&network, 0, sizeof(network));
+        strncpy(network.mNetworkName, result.mNetworkName.c_str(), sizeof(network.mNetworkName) - 1);
+        network.mPanId    = result.mPanId;
+        network.mChannel  = result.mChannel;
+        network.mExtPanId = result.mExtendedPanId;
+        network.mRssi     = result.mRssi;
+
+        for (size_t i = 0; i < sizeof(network.mHardwareAddress); i++)
+        {
+            network.mHardwareAddress[i] = (result.mExtAddress >> (56 - i * 8)) & 0xff;
+        }
+
+        for (uint8_t byte : result.mSteeringData)
+        {
+            if (byte != 0)
+            {
+                network.mAllowingJoin = true;
+                break;
+            }
+        }
+
+        count++;
+    }
+
+exit:
+    return count;
+}
+
+} // namespace Web
+} // namespace otbr
+
+#endif // OTBR_ENABLE_DBUS_SERVER
@@ -0,0 +1,114 @@
+/*
+ *  Copyright (c) 2019, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file includes definitions for the D-Bus backed OpenThread client of
+ * the web service.
+ */
+
+#ifndef OTBR_WEB_WEB_SERVICE_DBUS_CLIENT_HPP_
+#define OTBR_WEB_WEB_SERVICE_DBUS_CLIENT_HPP_
+
+#include "openthread-br/config.h"
+
+#if OTBR_ENABLE_DBUS_SERVER
+
+#include <memory>
+
+#include <dbus/dbus.h>
+
+#include "dbus/client/thread_api_dbus.hpp"
+#include "web/web-service/ot_client.hpp"
+
+namespace otbr {
+namespace Web {
+
+/**
+ * This class talks to the agent over D-Bus with structured results, instead
+ * of driving the OpenThread CLI text protocol over the daemon socket.
+ *
+ */
+class OpenThreadDBusClient
+{
+public:
+    /**
+     * This constructor creates a D-Bus backed OpenThread client.
+     *
+     * @param[in] aNetifName  The Thread network interface name.
+     *
+     */
+    OpenThreadDBusClient(const char *aNetifName);
+
+    /**
+     * This destructor destroys the client and closes its bus connection.
+     *
+     */
+    ~OpenThreadDBusClient(void);
+
+    /**
+     * This method connects to the system bus.
+     *
+     * @retval TRUE   Successfully connected to the bus.
+     * @retval FALSE  Failed to connect to the bus.
+     *
+     */
+    bool Connect(void);
+
+    /**
+     * This method scans Thread networks, blocking until the scan completes.
+     *
+     * The results arrive as structured D-Bus values, so no text table
+     * parsing is involved.
+     *
+     * @param[out] aNetworks  A pointer to the buffer to store network information.
+     * @param[in]  aLength    Number of entries in @p aNetworks.
+     *
+     * @returns Number of entries found. 0 if none found or the scan failed.
+     *
+     */
+    int Scan(WpanNetworkInfo *aNetworks, int aLength);
+
+private:
+    enum
+    {
+        kScanTimeout     = 10000, ///< Timeout(ms) waiting for a scan to complete.
+        kDispatchTimeout = 100,   ///< Timeout(ms) of one bus dispatch iteration.
+    };
+
+    const char *                         mNetifName;
+    DBusConnection *                     mConnection;
+    std::unique_ptr<DBus::ThreadApiDBus> mApi;
+};
+
+} // namespace Web
+} // namespace otbr
+
+#endif // OTBR_ENABLE_DBUS_SERVER
+
+#endif // OTBR_WEB_WEB_SERVICE_DBUS_CLIENT_HPP_
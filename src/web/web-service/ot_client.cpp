@@ -34,16 +34,20 @@
 
 #include <errno.h>
 #include <inttypes.h>
+#include <poll.h>
 #include <signal.h>
 #include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <sys/select.h>
 #include <sys/socket.h>
 #include <sys/un.h>
 #include <unistd.h>
 
+#include <chrono>
+#include <map>
+#include <string>
+
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
 
@@ -60,11 +64,30 @@
 namespace otbr {
 namespace Web {
 
+static bool IsSocketAlive(int aSocket)
+{
+    char    byte;
+    ssize_t count = recv(aSocket, &byte, 1, MSG_PEEK | MSG_DONTWAIT);
+
+    return count > 0 || (count < 0 && (errno == EAGAIN || errno == EWOULDBLOCK));
+}
+
+OpenThreadClient::PooledConnection &OpenThreadClient::GetPooledConnection(const char *aNetifName)
+{
+    static std::mutex                              sPoolMutex;
+    static std::map<std::string, PooledConnection> sPool;
+
+    std::lock_guard<std::mutex> lock(sPoolMutex);
+
+    return sPool[aNetifName];
+}
+
 OpenThreadClient::OpenThreadClient(const char *aNetifName)
 
     : mNetifName(aNetifName)
     , mTimeout(kDefaultTimeout)
     , mSocket(-1)
+    , mPooled(nullptr)
 {
 }
 
@@ -75,7 +98,16 @@ OpenThreadClient::~OpenThreadClient(void)
 
 void OpenThreadClient::Disconnect(void)
 {
-    if (mSocket != -1)
+    if (mPooled != nullptr)
+    {
+        // Return the connection to the pool for the next client instead
+        // of closing it.
+        mPooled->mSocket = mSocket;
+        mSocket          = -1;
+        mPooled          = nullptr;
+        mLock.unlock();
+    }
+    else if (mSocket != -1)
     {
         close(mSocket);
         mSocket = -1;
@@ -83,6 +115,36 @@ void OpenThreadClient::Disconnect(void)
 }
 
 bool OpenThreadClient::Connect(void)
+{
+    bool ok = true;
+
+    if (mPooled == nullptr)
+    {
+        mPooled = &GetPooledConnection(mNetifName);
+        mLock   = std::unique_lock<std::mutex>(mPooled->mMutex);
+        mSocket = mPooled->mSocket;
+    }
+
+    if (mSocket != -1 && !IsSocketAlive(mSocket))
+    {
+        close(mSocket);
+        mSocket = mPooled->mSocket = -1;
+    }
+
+    if (mSocket == -1)
+    {
+        ok = OpenSocket();
+
+        if (ok)
+        {
+            mPooled->mSocket = mSocket;
+        }
+    }
+
+    return ok;
+}
+
+bool OpenThreadClient::OpenSocket(void)
 {
     struct sockaddr_un sockname;
     int                ret;
@@ -110,19 +172,36 @@ exit:
     return ret == 0;
 }
 
+bool OpenThreadClient::Reconnect(void)
+{
+    bool ok;
+
+    if (mSocket != -1)
+    {
+        close(mSocket);
+        mSocket = -1;
+    }
+
+    ok = OpenSocket();
+
+    if (mPooled != nullptr)
+    {
+        mPooled->mSocket = ok ? mSocket : -1;
+    }
+
+    return ok;
+}
+
 void OpenThreadClient::DiscardRead(void)
 {
-    fd_set  readFdSet;
-    timeval timeout = {0, 0};
     ssize_t count;
     int     ret;
 
     for (;;)
     {
-        FD_ZERO(&readFdSet);
-        FD_SET(mSocket, &readFdSet);
+        struct pollfd pollFd = {mSocket, POLLIN, 0};
 
-        ret = select(mSocket + 1, &readFdSet, nullptr, nullptr, &timeout);
+        ret = poll(&pollFd, 1, /* timeout */ 0);
         if (ret <= 0)
         {
             break;
@@ -136,13 +215,58 @@ void OpenThreadClient::DiscardRead(void)
     }
 }
 
+char *OpenThreadClient::WaitForResponse(const char *aTerminator, int aTimeout)
+{
+    // Event-driven wait: poll(2) blocks until the daemon writes or the
+    // remaining budget expires, so the response is returned on the exact
+    // arrival of @p aTerminator instead of on a polling boundary.
+    auto   deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(aTimeout);
+    size_t rxLength = 0;
+    char * rval     = nullptr;
+
+    for (;;)
+    {
+        struct pollfd pollFd = {mSocket, POLLIN, 0};
+        ssize_t       count;
+        char *        found;
+        int           ret;
+        auto          remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+                             deadline - std::chrono::steady_clock::now())
+                             .count();
+
+        VerifyOrExit(remaining > 0 && rxLength < sizeof(mBuffer) - 1);
+
+        ret = poll(&pollFd, 1, static_cast<int>(remaining));
+        VerifyOrExit(ret != -1 || errno == EINTR);
+        if (ret <= 0)
+        {
+            continue;
+        }
+
+        count = read(mSocket, &mBuffer[rxLength], sizeof(mBuffer) - 1 - rxLength);
+        VerifyOrExit(count > 0);
+        rxLength += count;
+
+        mBuffer[rxLength] = '\0';
+        found             = strstr(mBuffer, aTerminator);
+
+        if (found != nullptr)
+        {
+            rval = mBuffer;
+            break;
+        }
+    }
+
+exit:
+    return rval;
+}
+
 char *OpenThreadClient::Execute(const char *aFormat, ...)
 {
     va_list args;
     int     ret;
     char *  rval = nullptr;
     ssize_t count;
-    size_t  rxLength = 0;
 
     DiscardRead();
 
@@ -170,43 +294,23 @@ char *OpenThreadClient::Execute(const char *aFormat, ...)
 
     if (count < ret)
     {
-        mBuffer[ret] = '\0';
-        otbrLogErr("Failed to send command: %s", mBuffer);
+        // The pooled connection may have gone stale (daemon restart);
+        // reconnect once and replay the command.
+        VerifyOrExit(Reconnect(), otbrLogErr("Failed to reconnect to the daemon"));
+        count = write(mSocket, mBuffer, ret);
+        VerifyOrExit(count == ret, mBuffer[ret] = '\0'; otbrLogErr("Failed to send command: %s", mBuffer));
     }
 
-    for (int i = 0; i < mTimeout; ++i)
-    {
-        fd_set  readFdSet;
-        timeval timeout = {0, 1000};
-        char *  done;
-
-        FD_ZERO(&readFdSet);
-        FD_SET(mSocket, &readFdSet);
+    rval = WaitForResponse("Done\r\n", mTimeout);
 
-        ret = select(mSocket + 1, &readFdSet, nullptr, nullptr, &timeout);
-        VerifyOrExit(ret != -1 || errno == EINTR);
-        if (ret <= 0)
-        {
-            continue;
-        }
-
-        count = read(mSocket, &mBuffer[rxLength], sizeof(mBuffer) - rxLength);
-        VerifyOrExit(count > 0);
-        rxLength += count;
-
-        mBuffer[rxLength] = '\0';
-        done              = strstr(mBuffer, "Done\r\n");
+    if (rval != nullptr)
+    {
+        char *done = strstr(rval, "Done\r\n");
 
-        if (done != nullptr)
+        // remove trailing \r\n
+        if (done - rval > 2)
         {
-            // remove trailing \r\n
-            if (done - mBuffer > 2)
-            {
-                done[-2] = '\0';
-            }
-
-            rval = mBuffer;
-            break;
+            done[-2] = '\0';
         }
     }
 
@@ -216,29 +320,7 @@ exit:
 
 char *OpenThreadClient::Read(const char *aResponse, int aTimeout)
 {
-    ssize_t count    = 0;
-    size_t  rxLength = 0;
-    char *  found;
-    char *  rval = nullptr;
-
-    for (int i = 0; i < aTimeout; ++i)
-    {
-        count = read(mSocket, &mBuffer[rxLength], sizeof(mBuffer) - rxLength);
-        VerifyOrExit(count > 0);
-        rxLength += count;
-
-        mBuffer[rxLength] = '\0';
-        found             = strstr(mBuffer, aResponse);
-
-        if (found != nullptr)
-        {
-            rval = mBuffer;
-            break;
-        }
-    }
-
-exit:
-    return rval;
+    return WaitForResponse(aResponse, aTimeout);
 }
 
 int OpenThreadClient::Scan(WpanNetworkInfo *aNetworks, int aLength)
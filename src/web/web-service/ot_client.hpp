@@ -38,6 +38,8 @@
 
 #include <stdint.h>
 
+#include <mutex>
+
 namespace otbr {
 namespace Web {
 
@@ -130,8 +132,22 @@ public:
     bool FactoryReset(void);
 
 private:
-    void Disconnect(void);
-    void DiscardRead(void);
+    // One pooled daemon connection per Thread interface, shared by the
+    // short-lived clients the web handlers construct; the mutex serializes
+    // whole command sequences on the shared socket.
+    struct PooledConnection
+    {
+        std::mutex mMutex;
+        int        mSocket = -1;
+    };
+
+    static PooledConnection &GetPooledConnection(const char *aNetifName);
+
+    void  Disconnect(void);
+    void  DiscardRead(void);
+    bool  OpenSocket(void);
+    bool  Reconnect(void);
+    char *WaitForResponse(const char *aTerminator, int aTimeout);
 
     enum
     {
@@ -139,10 +155,12 @@ private:
         kDefaultTimeout = 800,  ///< Default timeout(ms) waiting for a command finish.
     };
 
-    const char *mNetifName;
-    char        mBuffer[kBufferSize];
-    int         mTimeout; /// Timeout in milliseconds
-    int         mSocket;
+    const char *                 mNetifName;
+    char                         mBuffer[kBufferSize];
+    int                          mTimeout; /// Timeout in milliseconds
+    int                          mSocket;
+    PooledConnection *           mPooled;
+    std::unique_lock<std::mutex> mLock;
 };
 
 } // namespace Web
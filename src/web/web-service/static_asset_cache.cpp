@@ -0,0 +1,197 @@
+/*
+ *    Copyright (c) 2022, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the preloaded static asset cache of the web server.
+ */
+
+#define OTBR_LOG_TAG "WEB"
+
+#include "web/web-service/static_asset_cache.hpp"
+
+#include <fstream>
+#include <sstream>
+
+#include <stdio.h>
+#include <string.h>
+#include <zlib.h>
+
+#define BOOST_NO_CXX11_SCOPED_ENUMS
+#include <boost/filesystem.hpp>
+#undef BOOST_NO_CXX11_SCOPED_ENUMS
+
+#include "common/logging.hpp"
+
+namespace otbr {
+namespace Web {
+
+void StaticAssetCache::Preload(const std::string &aRootPath)
+{
+    boost::system::error_code error;
+    auto                      rootPath = boost::filesystem::canonical(aRootPath, error);
+
+    if (error)
+    {
+        otbrLogWarning("Failed to preload assets from %s: %s", aRootPath.c_str(), error.message().c_str());
+        return;
+    }
+
+    for (boost::filesystem::recursive_directory_iterator it(rootPath), end; it != end; ++it)
+    {
+        std::ostringstream content;
+        std::ifstream      file;
+        std::string        key;
+        Asset              asset;
+
+        if (!boost::filesystem::is_regular_file(it->path()))
+        {
+            continue;
+        }
+
+        file.open(it->path().string(), std::ifstream::in | std::ios::binary);
+        if (!file)
+        {
+            otbrLogWarning("Failed to preload asset %s", it->path().string().c_str());
+            continue;
+        }
+        content << file.rdbuf();
+
+        key = "/" + it->path().lexically_relative(rootPath).generic_string();
+
+        asset.mContent     = content.str();
+        asset.mGzipContent = GzipCompress(asset.mContent);
+        asset.mContentType = GuessContentType(it->path().string());
+        asset.mEtag        = ComputeEtag(asset.mContent);
+
+        mAssets[key] = std::move(asset);
+    }
+
+    otbrLogInfo("Preloaded %zu assets from %s", mAssets.size(), aRootPath.c_str());
+}
+
+const StaticAssetCache::Asset *StaticAssetCache::Find(const std::string &aRequestPath) const
+{
+    auto it = mAssets.find(aRequestPath == "/" ? "/index.html" : aRequestPath);
+
+    return it != mAssets.end() ? &it->second : nullptr;
+}
+
+std::string StaticAssetCache::ComputeEtag(const std::string &aContent)
+{
+    // 64-bit FNV-1a over the content; strong enough as a validator since
+    // the cache is rebuilt whenever the process restarts.
+    uint64_t hash = 14695981039346656037ULL;
+    char     etag[32];
+
+    for (char c : aContent)
+    {
+        hash = (hash ^ static_cast<uint8_t>(c)) * 1099511628211ULL;
+    }
+
+    snprintf(etag, sizeof(etag), "\"%016llx\"", static_cast<unsigned long long>(hash));
+
+    return etag;
+}
+
+std::string StaticAssetCache::GzipCompress(const std::string &aContent)
+{
+    std::string compressed;
+    z_stream    stream;
+    int         ret;
+
+    memset(&stream, 0, sizeof(stream));
+
+    // windowBits 15 + 16 selects the gzip wrapper.
+    ret = deflateInit2(&stream, Z_BEST_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY);
+    if (ret != Z_OK)
+    {
+        return compressed;
+    }
+
+    compressed.resize(deflateBound(&stream, aContent.size()));
+    stream.next_in   = reinterpret_cast<Bytef *>(const_cast<char *>(aContent.data()));
+    stream.avail_in  = static_cast<uInt>(aContent.size());
+    stream.next_out  = reinterpret_cast<Bytef *>(&compressed[0]);
+    stream.avail_out = static_cast<uInt>(compressed.size());
+
+    ret = deflate(&stream, Z_FINISH);
+    if (ret == Z_STREAM_END)
+    {
+        compressed.resize(stream.total_out);
+    }
+    else
+    {
+        compressed.clear();
+    }
+    deflateEnd(&stream);
+
+    // Serving the compressed variant only pays when it is actually smaller.
+    if (compressed.size() >= aContent.size())
+    {
+        compressed.clear();
+    }
+
+    return compressed;
+}
+
+std::string StaticAssetCache::GuessContentType(const std::string &aPath)
+{
+    std::string extension = boost::filesystem::extension(aPath);
+    std::string contentType;
+
+    if (extension == ".html")
+    {
+        contentType = "text/html; charset=utf-8";
+    }
+    else if (extension == ".css")
+    {
+        contentType = "text/css";
+    }
+    else if (extension == ".js")
+    {
+        contentType = "application/javascript";
+    }
+    else if (extension == ".png")
+    {
+        contentType = "image/png";
+    }
+    else if (extension == ".svg")
+    {
+        contentType = "image/svg+xml";
+    }
+    else if (extension == ".ico")
+    {
+        contentType = "image/x-icon";
+    }
+
+    return contentType;
+}
+
+} // namespace Web
+} // namespace otbr
@@ -0,0 +1,94 @@
+/*
+ *    Copyright (c) 2022, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the preloaded static asset cache of
+ *   the web server.
+ */
+
+#ifndef OTBR_WEB_WEB_SERVICE_STATIC_ASSET_CACHE_HPP_
+#define OTBR_WEB_WEB_SERVICE_STATIC_ASSET_CACHE_HPP_
+
+#include "openthread-br/config.h"
+
+#include <map>
+#include <string>
+
+namespace otbr {
+namespace Web {
+
+/**
+ * This class preloads the frontend files into memory at startup and keeps
+ * gzip-precompressed variants, so requests are served without touching
+ * disk and with validators for client-side caching.
+ *
+ */
+class StaticAssetCache
+{
+public:
+    struct Asset
+    {
+        std::string mContent;     ///< Identity-encoded file content.
+        std::string mGzipContent; ///< Gzip variant; empty when compression does not pay off.
+        std::string mContentType; ///< Content-Type header value; empty when unknown.
+        std::string mEtag;        ///< Strong validator derived from the content.
+    };
+
+    /**
+     * This method loads all regular files under @p aRootPath into the
+     * cache, keyed by their path relative to the root (with a leading
+     * slash), and precompresses them.
+     *
+     * @param[in] aRootPath  The frontend root directory.
+     *
+     */
+    void Preload(const std::string &aRootPath);
+
+    /**
+     * This method looks up a preloaded asset.
+     *
+     * @param[in] aRequestPath  The request path, e.g. "/index.html".
+     *
+     * @returns A pointer to the asset, or nullptr if not preloaded.
+     *
+     */
+    const Asset *Find(const std::string &aRequestPath) const;
+
+private:
+    static std::string ComputeEtag(const std::string &aContent);
+    static std::string GzipCompress(const std::string &aContent);
+    static std::string GuessContentType(const std::string &aPath);
+
+    std::map<std::string, Asset> mAssets;
+};
+
+} // namespace Web
+} // namespace otbr
+
+#endif // OTBR_WEB_WEB_SERVICE_STATIC_ASSET_CACHE_HPP_
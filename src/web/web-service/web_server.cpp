@@ -61,6 +61,7 @@
 #define OT_RESPONSE_HEADER_TEXT_HTML_TYPE "\r\nContent-Type: text/html; charset=utf-8"
 #define OT_RESPONSE_HEADER_TYPE "Content-Type: application/json\r\n charset=utf-8"
 #define OT_RESPONSE_PLACEHOLD "\r\n\r\n"
+#define OT_RESPONSE_CACHE_CONTROL "public, max-age=3600"
 #define OT_RESPONSE_FAILURE_STATUS "HTTP/1.1 400 Bad Request\r\n"
 #define OT_BUFFER_SIZE 1024
 
@@ -127,7 +128,12 @@ void WebServer::StartWebServer(const char *aIfName, const char *aListenAddr, uin
         mServer->config.address = aListenAddr;
     }
     mServer->config.port = aPort;
+    // Run the io_service on a small pool so a slow wpan operation (join,
+    // scan) does not stall static assets and status polls; wpan command
+    // sequences stay serialized by the pooled client connection.
+    mServer->config.thread_pool_size = kThreadPoolSize;
     mWpanService.SetInterfaceName(aIfName);
+    mAssetCache.Preload(WEB_FILE_PATH);
     Init();
     ResponseGetQRCode();
     ResponseJoinNetwork();
@@ -186,21 +192,20 @@ void WebServer::HandleHttpRequest(const char *aUrl, const char *aMethod, HttpReq
 
 void DefaultResourceSend(const HttpServer &                           aServer,
                          const std::shared_ptr<HttpServer::Response> &aResponse,
-                         const std::shared_ptr<std::ifstream> &       aIfStream)
+                         const std::shared_ptr<std::ifstream> &       aIfStream,
+                         const std::shared_ptr<std::vector<char>> &   aBuffer)
 {
-    static std::vector<char> buffer(OT_BUFFER_SIZE); // Safe when server is running on one thread
-
     std::streamsize readLength;
 
-    if ((readLength = aIfStream->read(&buffer[0], buffer.size()).gcount()) > 0)
+    if ((readLength = aIfStream->read(&(*aBuffer)[0], aBuffer->size()).gcount()) > 0)
     {
-        aResponse->write(&buffer[0], readLength);
-        if (readLength == static_cast<std::streamsize>(buffer.size()))
+        aResponse->write(&(*aBuffer)[0], readLength);
+        if (readLength == static_cast<std::streamsize>(aBuffer->size()))
         {
-            aServer.send(aResponse, [&aServer, aResponse, aIfStream](const boost::system::error_code &ec) {
+            aServer.send(aResponse, [&aServer, aResponse, aIfStream, aBuffer](const boost::system::error_code &ec) {
                 if (!ec)
                 {
-                    DefaultResourceSend(aServer, aResponse, aIfStream);
+                    DefaultResourceSend(aServer, aResponse, aIfStream, aBuffer);
                 }
                 else
                 {
@@ -217,6 +222,41 @@ void WebServer::DefaultHttpResponse(void)
                                                               std::shared_ptr<HttpServer::Request>  request) {
         try
         {
+            const StaticAssetCache::Asset *asset = mAssetCache.Find(request->path);
+
+            if (asset != nullptr)
+            {
+                auto ifNoneMatch = request->header.find("If-None-Match");
+
+                if (ifNoneMatch != request->header.end() && ifNoneMatch->second == asset->mEtag)
+                {
+                    *response << "HTTP/1.1 304 Not Modified\r\n"
+                              << "ETag: " << asset->mEtag << "\r\n"
+                              << "Cache-Control: " OT_RESPONSE_CACHE_CONTROL "\r\n\r\n";
+                    return;
+                }
+
+                auto               acceptEncoding = request->header.find("Accept-Encoding");
+                const std::string &body = (acceptEncoding != request->header.end() && !asset->mGzipContent.empty() &&
+                                           acceptEncoding->second.find("gzip") != std::string::npos)
+                                              ? asset->mGzipContent
+                                              : asset->mContent;
+
+                *response << OT_RESPONSE_SUCCESS_STATUS << "ETag: " << asset->mEtag << "\r\n"
+                          << "Cache-Control: " OT_RESPONSE_CACHE_CONTROL "\r\n";
+                if (&body == &asset->mGzipContent)
+                {
+                    *response << "Content-Encoding: gzip\r\n";
+                }
+                if (!asset->mContentType.empty())
+                {
+                    *response << "Content-Type: " << asset->mContentType << "\r\n";
+                }
+                *response << OT_RESPONSE_HEADER_LENGTH << body.size() << "\r\n\r\n" << body;
+                return;
+            }
+
+            // Fall back to the disk for anything not preloaded at startup.
             auto webRootPath = boost::filesystem::canonical(WEB_FILE_PATH);
             auto path        = boost::filesystem::canonical(webRootPath / request->path);
 
@@ -258,7 +298,7 @@ void WebServer::DefaultHttpResponse(void)
                 *response << OT_RESPONSE_SUCCESS_STATUS << cacheControl << etag << OT_RESPONSE_HEADER_LENGTH << length
                           << header << OT_RESPONSE_PLACEHOLD;
 
-                DefaultResourceSend(*mServer, response, ifs);
+                DefaultResourceSend(*mServer, response, ifs, std::make_shared<std::vector<char>>(OT_BUFFER_SIZE));
             }
             else
             {
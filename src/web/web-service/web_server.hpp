@@ -47,6 +47,7 @@
 
 #include <boost/asio/ip/tcp.hpp>
 
+#include "web/web-service/static_asset_cache.hpp"
 #include "web/web-service/wpan_service.hpp"
 
 namespace SimpleWeb {
@@ -128,8 +129,14 @@ private:
 
     void Init(void);
 
-    HttpServer *           mServer;
-    otbr::Web::WpanService mWpanService;
+    enum
+    {
+        kThreadPoolSize = 4, ///< io_service threads serving http requests.
+    };
+
+    HttpServer *                mServer;
+    otbr::Web::WpanService      mWpanService;
+    otbr::Web::StaticAssetCache mAssetCache;
 };
 
 } // namespace Web
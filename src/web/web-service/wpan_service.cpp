@@ -36,6 +36,7 @@
 #include "web/web-service/wpan_service.hpp"
 
 #include <sstream>
+#include <thread>
 
 #include <inttypes.h>
 #include <stdio.h>
@@ -120,8 +121,18 @@ std::string WpanService::HandleJoinNetworkRequest(const std::string &aJoinReques
 
     if (credentialType == CREDENTIAL_TYPE_NETWORK_KEY)
     {
-        VerifyOrExit((ret = joinActiveDataset(client, networkKey, mNetworks[index].mChannel,
-                                              mNetworks[index].mPanId)) == kWpanStatus_Ok);
+        WpanNetworkInfo network;
+
+        {
+            // Snapshot the selected entry; a background rescan may rewrite
+            // mNetworks while the join is in flight.
+            std::lock_guard<std::mutex> lock(mScanMutex);
+
+            VerifyOrExit(index >= 0 && index < mNetworksCount, ret = kWpanStatus_NetworkNotFound);
+            network = mNetworks[index];
+        }
+
+        VerifyOrExit((ret = joinActiveDataset(client, networkKey, network.mChannel, network.mPanId)) == kWpanStatus_Ok);
         VerifyOrExit(client.Execute("ifconfig up") != nullptr, ret = kWpanStatus_JoinFailed);
     }
     else if (credentialType == CREDENTIAL_TYPE_PSKD)
@@ -472,11 +483,18 @@ std::string WpanService::HandleAvailableNetworkRequest()
     Json::FastWriter            jsonWriter;
     std::string                 response;
     int                         ret = kWpanStatus_Ok;
-    otbr::Web::OpenThreadClient client(mIfName);
+    std::lock_guard<std::mutex> lock(mScanMutex);
+
+    if (!mScanInProgress &&
+        (!mScanValid || std::chrono::steady_clock::now() - mScanTime > std::chrono::seconds(kScanCacheMaxAge)))
+    {
+        // The multi-second active scan must not block the server thread;
+        // refresh the cache in the background and serve what we have.
+        mScanInProgress = true;
+        std::thread(&WpanService::RefreshScanCache, this).detach();
+    }
 
-    VerifyOrExit(client.Connect(), ret = kWpanStatus_ScanFailed);
-    VerifyOrExit((mNetworksCount = client.Scan(mNetworks, sizeof(mNetworks) / sizeof(mNetworks[0]))) > 0,
-                 ret = kWpanStatus_NetworkNotFound);
+    VerifyOrExit(mScanValid, ret = kWpanStatus_NetworkNotFound);
 
     for (int i = 0; i < mNetworksCount; i++)
     {
@@ -489,8 +507,11 @@ std::string WpanService::HandleAvailableNetworkRequest()
     }
 
     root["result"] = networkInfo;
+    root["age"]    = static_cast<Json::UInt64>(
+        std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - mScanTime).count());
 
 exit:
+    root["scanning"] = mScanInProgress;
     if (ret != kWpanStatus_Ok)
     {
         root["result"] = WPAN_RESPONSE_FAILURE;
@@ -501,6 +522,53 @@ exit:
     return response;
 }
 
+void WpanService::RefreshScanCache(void)
+{
+    WpanNetworkInfo networks[OT_SCANNED_NET_BUFFER_SIZE];
+    int             count = 0;
+
+#if OTBR_ENABLE_DBUS_SERVER
+    // Prefer the D-Bus bridge: the scan results arrive structured instead
+    // of as a CLI text table, and no daemon socket resynchronization runs.
+    {
+        otbr::Web::OpenThreadDBusClient dbusClient(mIfName);
+
+        if (dbusClient.Connect())
+        {
+            count = dbusClient.Scan(networks, sizeof(networks) / sizeof(networks[0]));
+        }
+    }
+#endif
+
+    if (count <= 0)
+    {
+        otbr::Web::OpenThreadClient client(mIfName);
+
+        if (client.Connect())
+        {
+            count = client.Scan(networks, sizeof(networks) / sizeof(networks[0]));
+        }
+        else
+        {
+            otbrLogErr("Failed to connect to the daemon for scanning");
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mScanMutex);
+
+        if (count > 0)
+        {
+            memcpy(mNetworks, networks, count * sizeof(networks[0]));
+            mNetworksCount = count;
+            mScanTime      = std::chrono::steady_clock::now();
+            mScanValid     = true;
+        }
+
+        mScanInProgress = false;
+    }
+}
+
 int WpanService::GetWpanServiceStatus(std::string &aNetworkName, std::string &aExtPanId) const
 {
     int                         status = kWpanStatus_Ok;
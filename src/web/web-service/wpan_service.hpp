@@ -42,12 +42,16 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <chrono>
+#include <mutex>
+
 #include <json/json.h>
 #include <json/writer.h>
 
 #include "common/logging.hpp"
 #include "utils/hex.hpp"
 #include "utils/pskc.hpp"
+#include "web/web-service/dbus_client.hpp"
 #include "web/web-service/ot_client.hpp"
 
 /**
@@ -132,6 +136,12 @@ public:
     /**
      * This method handles http request to get available networks.
      *
+     * The multi-second active scan runs on a background thread; the
+     * response carries the cached results with their age in seconds and
+     * a `scanning` flag, so the handler never blocks the server thread.
+     * The first request (and any request finding the cache stale) kicks
+     * off a refresh and returns immediately.
+     *
      * @returns The string to the http response of getting available networks.
      *
      */
@@ -195,12 +205,27 @@ private:
                                          uint16_t                     aPanId);
     static std::string escapeOtCliEscapable(const std::string &aArg);
 
+    void RefreshScanCache(void);
+
+    // Maximum age before a request kicks off a background rescan.
+    enum
+    {
+        kScanCacheMaxAge = 60, ///< Seconds.
+    };
+
     WpanNetworkInfo mNetworks[OT_SCANNED_NET_BUFFER_SIZE];
     int             mNetworksCount;
     char            mIfName[IFNAMSIZ];
     std::string     mNetworkName;
     std::string     mExtPanId;
 
+    // Scan-result cache; mNetworks/mNetworksCount double as its storage
+    // and are guarded by mScanMutex once a background refresh exists.
+    std::mutex                            mScanMutex;
+    std::chrono::steady_clock::time_point mScanTime;
+    bool                                  mScanValid      = false;
+    bool                                  mScanInProgress = false;
+
     enum
     {
         kWpanStatus_Ok = 0,
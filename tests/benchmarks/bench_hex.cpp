@@ -0,0 +1,91 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file benchmarks the hex conversion routines in utils/hex.cpp.
+ */
+
+#include "utils/hex.hpp"
+
+#include <chrono>
+#include <vector>
+
+#include <stdio.h>
+
+static double MegabytesPerSecond(size_t aBytesProcessed, std::chrono::steady_clock::duration aElapsed)
+{
+    double seconds = std::chrono::duration<double>(aElapsed).count();
+
+    return static_cast<double>(aBytesProcessed) / (1024 * 1024) / seconds;
+}
+
+static void BenchmarkBufferSize(size_t aBufferSize)
+{
+    constexpr size_t kBytesPerRun = 64 * 1024 * 1024;
+
+    size_t               iterations = kBytesPerRun / aBufferSize;
+    std::vector<uint8_t> bytes(aBufferSize);
+    std::vector<uint8_t> decoded(aBufferSize);
+    std::vector<char>    hex(2 * aBufferSize + 1);
+
+    for (size_t i = 0; i < aBufferSize; i++)
+    {
+        bytes[i] = static_cast<uint8_t>(i * 131 + 7);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; i++)
+    {
+        otbr::Utils::Bytes2Hex(bytes.data(), static_cast<uint16_t>(aBufferSize), hex.data());
+    }
+    auto encodeElapsed = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; i++)
+    {
+        otbr::Utils::Hex2Bytes(hex.data(), decoded.data(), static_cast<uint16_t>(aBufferSize));
+    }
+    auto decodeElapsed = std::chrono::steady_clock::now() - start;
+
+    printf("%6zu bytes: Bytes2Hex %8.1f MB/s, Hex2Bytes %8.1f MB/s\n", aBufferSize,
+           MegabytesPerSecond(iterations * aBufferSize, encodeElapsed),
+           MegabytesPerSecond(iterations * aBufferSize, decodeElapsed));
+}
+
+int main(void)
+{
+    // 8 bytes: an extended address; 254 bytes: a full operational dataset;
+    // larger sizes: telemetry TLV batches.
+    for (size_t bufferSize : {8, 64, 254, 4096, 65535})
+    {
+        BenchmarkBufferSize(bufferSize);
+    }
+
+    return 0;
+}
@@ -0,0 +1,352 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements an ND proxy load-test tool. The `flood` mode sends
+ *   synthetic Neighbor Solicitations at a configurable rate on an interface
+ *   and reports answered-NA latency percentiles and the drop rate; the
+ *   `respond` mode answers every solicitation and serves as the harness
+ *   self-test peer on a veth pair (see `tests/scripts/nd-proxy-bench`).
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <net/if.h>
+#include <netinet/icmp6.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace {
+
+constexpr size_t   kNsPacketLength   = 32;     ///< NS header plus the SLLA option.
+constexpr size_t   kRecvBufferLength = 1500;   ///< Large enough for any ND packet.
+constexpr uint32_t kDefaultRate      = 1000;   ///< Solicitations per second.
+constexpr uint32_t kDefaultCount     = 10000;  ///< Solicitations per run.
+constexpr uint32_t kDrainTimeoutMs   = 1000;   ///< Wait for late answers after the last send.
+
+uint64_t NowNs(void)
+{
+    timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return static_cast<uint64_t>(now.tv_sec) * 1000000000 + now.tv_nsec;
+}
+
+uint64_t PercentileNs(const std::vector<uint64_t> &aSortedLatencies, double aPercentile)
+{
+    size_t index = static_cast<size_t>(aPercentile * (aSortedLatencies.size() - 1));
+
+    return aSortedLatencies[index];
+}
+
+int OpenIcmp6Socket(const char *aInterfaceName, uint8_t aPassType)
+{
+    int                 sock;
+    int                 hops = 255;
+    struct icmp6_filter filter;
+
+    sock = socket(AF_INET6, SOCK_RAW, IPPROTO_ICMPV6);
+
+    if (sock < 0)
+    {
+        perror("socket");
+        exit(EXIT_FAILURE);
+    }
+
+    if (setsockopt(sock, SOL_SOCKET, SO_BINDTODEVICE, aInterfaceName, strlen(aInterfaceName)) != 0 ||
+        setsockopt(sock, IPPROTO_IPV6, IPV6_MULTICAST_HOPS, &hops, sizeof(hops)) != 0 ||
+        setsockopt(sock, IPPROTO_IPV6, IPV6_UNICAST_HOPS, &hops, sizeof(hops)) != 0)
+    {
+        perror("setsockopt");
+        exit(EXIT_FAILURE);
+    }
+
+    ICMP6_FILTER_SETBLOCKALL(&filter);
+    ICMP6_FILTER_SETPASS(aPassType, &filter);
+
+    if (setsockopt(sock, IPPROTO_ICMPV6, ICMP6_FILTER, &filter, sizeof(filter)) != 0)
+    {
+        perror("setsockopt(ICMP6_FILTER)");
+        exit(EXIT_FAILURE);
+    }
+
+    return sock;
+}
+
+// Receiving solicitations for arbitrary targets requires the interface to
+// accept all multicast groups, like the ND proxy's own backbone interface
+// effectively does through its joined solicited-node groups.
+void SetAllMulticast(int aSock, const char *aInterfaceName)
+{
+    ifreq request;
+
+    memset(&request, 0, sizeof(request));
+    strncpy(request.ifr_name, aInterfaceName, sizeof(request.ifr_name) - 1);
+
+    if (ioctl(aSock, SIOCGIFFLAGS, &request) != 0)
+    {
+        perror("ioctl(SIOCGIFFLAGS)");
+        exit(EXIT_FAILURE);
+    }
+
+    request.ifr_flags |= IFF_ALLMULTI;
+
+    if (ioctl(aSock, SIOCSIFFLAGS, &request) != 0)
+    {
+        perror("ioctl(SIOCSIFFLAGS)");
+        exit(EXIT_FAILURE);
+    }
+}
+
+// Builds an NS for `aTarget` addressed to its solicited-node multicast group.
+void BuildNeighborSolicitation(const in6_addr &aTarget, uint8_t *aPacket, sockaddr_in6 &aDst)
+{
+    nd_neighbor_solicit &ns  = *reinterpret_cast<nd_neighbor_solicit *>(aPacket);
+    nd_opt_hdr &         opt = *reinterpret_cast<nd_opt_hdr *>(aPacket + sizeof(nd_neighbor_solicit));
+
+    memset(aPacket, 0, kNsPacketLength);
+    ns.nd_ns_type   = ND_NEIGHBOR_SOLICIT;
+    ns.nd_ns_target = aTarget;
+    opt.nd_opt_type = ND_OPT_SOURCE_LINKADDR;
+    opt.nd_opt_len  = 1;
+
+    memset(&aDst, 0, sizeof(aDst));
+    aDst.sin6_family           = AF_INET6;
+    aDst.sin6_addr.s6_addr[0]  = 0xff;
+    aDst.sin6_addr.s6_addr[1]  = 0x02;
+    aDst.sin6_addr.s6_addr[11] = 0x01;
+    aDst.sin6_addr.s6_addr[12] = 0xff;
+    memcpy(&aDst.sin6_addr.s6_addr[13], &aTarget.s6_addr[13], 3);
+}
+
+// Drains answered NAs, crediting the latency of the matching solicitation.
+// Returns the number of answers consumed.
+size_t DrainAnswers(int                    aSock,
+                    const in6_addr &       aBaseTarget,
+                    std::vector<uint64_t> &aSendTimes,
+                    std::vector<uint64_t> &aLatencies)
+{
+    uint8_t buffer[kRecvBufferLength];
+    ssize_t length;
+    size_t  answered = 0;
+
+    while ((length = recv(aSock, buffer, sizeof(buffer), MSG_DONTWAIT)) > 0)
+    {
+        const nd_neighbor_advert &na = *reinterpret_cast<const nd_neighbor_advert *>(buffer);
+        uint32_t                  sequence;
+
+        if (static_cast<size_t>(length) < sizeof(nd_neighbor_advert) || na.nd_na_type != ND_NEIGHBOR_ADVERT)
+        {
+            continue;
+        }
+
+        if (memcmp(&na.nd_na_target, &aBaseTarget, 12) != 0)
+        {
+            continue;
+        }
+
+        sequence = static_cast<uint32_t>(na.nd_na_target.s6_addr[13]) << 16 |
+                   static_cast<uint32_t>(na.nd_na_target.s6_addr[14]) << 8 | na.nd_na_target.s6_addr[15];
+
+        if (sequence >= aSendTimes.size() || aSendTimes[sequence] == 0)
+        {
+            continue;
+        }
+
+        aLatencies.push_back(NowNs() - aSendTimes[sequence]);
+        aSendTimes[sequence] = 0;
+        ++answered;
+    }
+
+    return answered;
+}
+
+int RunFlood(const char *aInterfaceName, const char *aTargetPrefix, uint32_t aRate, uint32_t aCount)
+{
+    int                   sock       = OpenIcmp6Socket(aInterfaceName, ND_NEIGHBOR_ADVERT);
+    uint64_t              intervalNs = 1000000000ull / aRate;
+    uint64_t              nextSendNs = NowNs();
+    size_t                answered   = 0;
+    in6_addr              baseTarget;
+    std::vector<uint64_t> sendTimes(aCount, 0);
+    std::vector<uint64_t> latencies;
+
+    if (inet_pton(AF_INET6, aTargetPrefix, &baseTarget) != 1)
+    {
+        fprintf(stderr, "invalid target prefix: %s\n", aTargetPrefix);
+        exit(EXIT_FAILURE);
+    }
+
+    latencies.reserve(aCount);
+
+    for (uint32_t i = 0; i < aCount; i++)
+    {
+        uint8_t      packet[kNsPacketLength];
+        sockaddr_in6 dst;
+        in6_addr     target = baseTarget;
+        uint64_t     nowNs;
+
+        // The last three target bytes carry the sequence number so an
+        // answered NA can be matched back to its solicitation.
+        target.s6_addr[13] = static_cast<uint8_t>(i >> 16);
+        target.s6_addr[14] = static_cast<uint8_t>(i >> 8);
+        target.s6_addr[15] = static_cast<uint8_t>(i);
+
+        while ((nowNs = NowNs()) < nextSendNs)
+        {
+            pollfd pollFd = {sock, POLLIN, 0};
+
+            answered += DrainAnswers(sock, baseTarget, sendTimes, latencies);
+            poll(&pollFd, 1, static_cast<int>((nextSendNs - nowNs) / 1000000));
+        }
+
+        nextSendNs += intervalNs;
+
+        BuildNeighborSolicitation(target, packet, dst);
+        sendTimes[i] = NowNs();
+
+        if (sendto(sock, packet, kNsPacketLength, 0, reinterpret_cast<const sockaddr *>(&dst), sizeof(dst)) !=
+            static_cast<ssize_t>(kNsPacketLength))
+        {
+            perror("sendto");
+            sendTimes[i] = 0;
+        }
+
+        answered += DrainAnswers(sock, baseTarget, sendTimes, latencies);
+    }
+
+    // Give in-flight answers a grace period before counting drops.
+    for (uint64_t deadlineNs = NowNs() + static_cast<uint64_t>(kDrainTimeoutMs) * 1000000; NowNs() < deadlineNs;)
+    {
+        pollfd pollFd = {sock, POLLIN, 0};
+
+        poll(&pollFd, 1, 10);
+        answered += DrainAnswers(sock, baseTarget, sendTimes, latencies);
+    }
+
+    printf("sent %u solicitations at %u/s, answered %zu, dropped %zu (%.2f%%)\n", aCount, aRate, answered,
+           aCount - answered, 100.0 * (aCount - answered) / aCount);
+
+    if (!latencies.empty())
+    {
+        std::sort(latencies.begin(), latencies.end());
+        printf("answer latency p50 %.1f us, p90 %.1f us, p99 %.1f us, max %.1f us\n",
+               PercentileNs(latencies, 0.50) / 1000.0, PercentileNs(latencies, 0.90) / 1000.0,
+               PercentileNs(latencies, 0.99) / 1000.0, latencies.back() / 1000.0);
+    }
+
+    close(sock);
+
+    return answered > 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// Answers every received NS with a solicited NA for the same target; used
+// as the harness self-test peer when no Backbone Router is on the link.
+int RunResponder(const char *aInterfaceName)
+{
+    int sock = OpenIcmp6Socket(aInterfaceName, ND_NEIGHBOR_SOLICIT);
+
+    SetAllMulticast(sock, aInterfaceName);
+
+    while (true)
+    {
+        uint8_t      buffer[kRecvBufferLength];
+        sockaddr_in6 src;
+        socklen_t    srcLength = sizeof(src);
+        ssize_t      length    = recvfrom(sock, buffer, sizeof(buffer), 0, reinterpret_cast<sockaddr *>(&src),
+                                          &srcLength);
+
+        if (length < static_cast<ssize_t>(sizeof(nd_neighbor_solicit)))
+        {
+            continue;
+        }
+
+        const nd_neighbor_solicit &ns = *reinterpret_cast<const nd_neighbor_solicit *>(buffer);
+        nd_neighbor_advert         na;
+
+        if (ns.nd_ns_type != ND_NEIGHBOR_SOLICIT)
+        {
+            continue;
+        }
+
+        memset(&na, 0, sizeof(na));
+        na.nd_na_type           = ND_NEIGHBOR_ADVERT;
+        na.nd_na_target         = ns.nd_ns_target;
+        na.nd_na_flags_reserved = ND_NA_FLAG_SOLICITED | ND_NA_FLAG_OVERRIDE;
+
+        sendto(sock, &na, sizeof(na), 0, reinterpret_cast<const sockaddr *>(&src), sizeof(src));
+    }
+
+    return EXIT_SUCCESS;
+}
+
+void PrintUsage(const char *aProgram)
+{
+    fprintf(stderr,
+            "Usage: %s flood <interface> <target-prefix> [rate-pps] [count]\n"
+            "       %s respond <interface>\n",
+            aProgram, aProgram);
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    int ret = EXIT_FAILURE;
+
+    if (argc >= 4 && strcmp(argv[1], "flood") == 0)
+    {
+        uint32_t rate  = (argc > 4) ? static_cast<uint32_t>(strtoul(argv[4], nullptr, 0)) : kDefaultRate;
+        uint32_t count = (argc > 5) ? static_cast<uint32_t>(strtoul(argv[5], nullptr, 0)) : kDefaultCount;
+
+        ret = RunFlood(argv[2], argv[3], rate, count);
+    }
+    else if (argc >= 3 && strcmp(argv[1], "respond") == 0)
+    {
+        ret = RunResponder(argv[2]);
+    }
+    else
+    {
+        PrintUsage(argv[0]);
+    }
+
+    return ret;
+}
@@ -0,0 +1,187 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a common runner for the microbenchmark suite.
+ *
+ *   Each benchmark body is calibrated to run for a fixed wall-clock budget,
+ *   then measured; results are printed as text and, with `--json PATH`,
+ *   written as machine-readable JSON for tests/scripts/compare-benchmarks.
+ */
+
+#ifndef OTBR_TESTS_BENCH_RUNNER_HPP_
+#define OTBR_TESTS_BENCH_RUNNER_HPP_
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <stdio.h>
+#include <string.h>
+
+namespace otbr {
+namespace Bench {
+
+class Runner
+{
+public:
+    Runner(int argc, char *argv[])
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            if (strcmp(argv[i], "--json") == 0 && i + 1 < argc)
+            {
+                mJsonPath = argv[++i];
+            }
+        }
+    }
+
+    /**
+     * This method calibrates and measures one benchmark body.
+     *
+     * @param[in] aName        The benchmark name; stable across runs, used as the comparison key.
+     * @param[in] aBytesPerOp  Bytes processed per iteration, or 0 when throughput is not meaningful.
+     * @param[in] aBody        The benchmark body; one iteration per call.
+     *
+     */
+    void Run(const char *aName, size_t aBytesPerOp, const std::function<void(void)> &aBody)
+    {
+        constexpr double kMeasureSeconds = 0.3;
+
+        uint64_t iterations = CalibrateIterations(aBody, kMeasureSeconds);
+        auto     start      = std::chrono::steady_clock::now();
+
+        for (uint64_t i = 0; i < iterations; i++)
+        {
+            aBody();
+        }
+
+        {
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            Result result;
+
+            result.mName       = aName;
+            result.mIterations = iterations;
+            result.mNsPerOp    = seconds * 1e9 / iterations;
+            result.mMbPerSec =
+                aBytesPerOp > 0 ? static_cast<double>(aBytesPerOp) * iterations / (1024 * 1024) / seconds : 0;
+            mResults.push_back(result);
+
+            if (aBytesPerOp > 0)
+            {
+                printf("%-32s %12.1f ns/op %10.1f MB/s\n", aName, result.mNsPerOp, result.mMbPerSec);
+            }
+            else
+            {
+                printf("%-32s %12.1f ns/op\n", aName, result.mNsPerOp);
+            }
+        }
+    }
+
+    /**
+     * This method writes the JSON result file when requested.
+     *
+     * @returns The process exit code.
+     *
+     */
+    int Finish(void)
+    {
+        int ret = 0;
+
+        if (!mJsonPath.empty())
+        {
+            FILE *file = fopen(mJsonPath.c_str(), "w");
+
+            if (file == nullptr)
+            {
+                fprintf(stderr, "Failed to open %s\n", mJsonPath.c_str());
+                return 1;
+            }
+
+            fputs("{\"benchmarks\":[", file);
+            for (size_t i = 0; i < mResults.size(); i++)
+            {
+                fprintf(file,
+                        "%s{\"name\":\"%s\",\"ns_per_op\":%.1f,\"mb_per_sec\":%.1f,\"iterations\":%llu}",
+                        i > 0 ? "," : "", mResults[i].mName.c_str(), mResults[i].mNsPerOp, mResults[i].mMbPerSec,
+                        static_cast<unsigned long long>(mResults[i].mIterations));
+            }
+            fputs("]}\n", file);
+            fclose(file);
+        }
+
+        return ret;
+    }
+
+private:
+    struct Result
+    {
+        std::string mName;
+        double      mNsPerOp;
+        double      mMbPerSec;
+        uint64_t    mIterations;
+    };
+
+    // Scales the iteration count so one measurement runs for about
+    // @p aSeconds, keeping per-benchmark runtime flat regardless of cost.
+    static uint64_t CalibrateIterations(const std::function<void(void)> &aBody, double aSeconds)
+    {
+        uint64_t iterations = 1;
+
+        while (true)
+        {
+            auto start = std::chrono::steady_clock::now();
+
+            for (uint64_t i = 0; i < iterations; i++)
+            {
+                aBody();
+            }
+
+            {
+                double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+                if (elapsed >= aSeconds / 10)
+                {
+                    return static_cast<uint64_t>(iterations * (aSeconds / elapsed)) + 1;
+                }
+            }
+
+            iterations *= 10;
+        }
+    }
+
+    std::string         mJsonPath;
+    std::vector<Result> mResults;
+};
+
+} // namespace Bench
+} // namespace otbr
+
+#endif // OTBR_TESTS_BENCH_RUNNER_HPP_
@@ -0,0 +1,288 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file benchmarks the SRP advertising publish pipeline against a mock
+ *   mDNS publisher, reporting updates/sec, heap allocations per update and
+ *   publish latency percentiles.
+ */
+
+#define OTBR_LOG_TAG "BENCH"
+
+#include "mdns/mdns.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+
+static uint64_t sAllocationCount = 0;
+
+void *operator new(size_t aSize)
+{
+    ++sAllocationCount;
+    return malloc(aSize);
+}
+
+void operator delete(void *aPtr) noexcept
+{
+    free(aPtr);
+}
+
+void operator delete(void *aPtr, size_t aSize) noexcept
+{
+    (void)aSize;
+    free(aPtr);
+}
+
+namespace {
+
+using otbr::Mdns::Publisher;
+
+/**
+ * This class implements a mock mDNS publisher which completes every
+ * registration synchronously, so the benchmark measures only the publish
+ * pipeline itself (sorting, duplicate detection, content hashing and
+ * registration bookkeeping) and not a backend daemon.
+ *
+ */
+class BenchPublisher : public Publisher
+{
+public:
+    otbrError Start(void) override { return OTBR_ERROR_NONE; }
+    void      Stop(void) override {}
+    bool      IsStarted(void) const override { return true; }
+
+    void UnpublishService(const std::string &aName, const std::string &aType, ResultCallback &&aCallback) override
+    {
+        RemoveServiceRegistration(aName, aType, OTBR_ERROR_ABORTED);
+        std::move(aCallback)(OTBR_ERROR_NONE);
+    }
+
+    void UnpublishHost(const std::string &aName, ResultCallback &&aCallback) override
+    {
+        RemoveHostRegistration(aName, OTBR_ERROR_ABORTED);
+        std::move(aCallback)(OTBR_ERROR_NONE);
+    }
+
+protected:
+    void PublishServiceImpl(const std::string &aHostName,
+                            const std::string &aName,
+                            const std::string &aType,
+                            const SubTypeList &aSubTypeList,
+                            uint16_t           aPort,
+                            TxtList            aTxtList,
+                            ResultCallback &&  aCallback) override
+    {
+        SubTypeList sortedSubTypeList = SortSubTypeList(aSubTypeList);
+        TxtList     sortedTxtList     = SortTxtList(std::move(aTxtList));
+
+        aCallback = HandleDuplicateServiceRegistration(aHostName, aName, aType, sortedSubTypeList, aPort,
+                                                       sortedTxtList, std::move(aCallback));
+        VerifyOrExit(!aCallback.IsNull());
+
+        AddServiceRegistration(std::unique_ptr<ServiceRegistration>(
+            new ServiceRegistration(aHostName, aName, aType, sortedSubTypeList, aPort, std::move(sortedTxtList),
+                                    std::move(aCallback), this)));
+        FindServiceRegistration(aName, aType)->Complete(OTBR_ERROR_NONE);
+
+    exit:
+        return;
+    }
+
+    void PublishHostImpl(const std::string &                  aName,
+                         const std::vector<otbr::Ip6Address> &aAddresses,
+                         ResultCallback &&                    aCallback) override
+    {
+        aCallback = HandleDuplicateHostRegistration(aName, aAddresses, std::move(aCallback));
+        VerifyOrExit(!aCallback.IsNull());
+
+        AddHostRegistration(
+            std::unique_ptr<HostRegistration>(new HostRegistration(aName, aAddresses, std::move(aCallback), this)));
+        FindHostRegistration(aName)->Complete(OTBR_ERROR_NONE);
+
+    exit:
+        return;
+    }
+
+    void SubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName) override
+    {
+        OTBR_UNUSED_VARIABLE(aType);
+        OTBR_UNUSED_VARIABLE(aInstanceName);
+    }
+
+    void UnsubscribeServiceImpl(const std::string &aType, const std::string &aInstanceName) override
+    {
+        OTBR_UNUSED_VARIABLE(aType);
+        OTBR_UNUSED_VARIABLE(aInstanceName);
+    }
+
+    void SubscribeHostImpl(const std::string &aHostName) override { OTBR_UNUSED_VARIABLE(aHostName); }
+    void UnsubscribeHostImpl(const std::string &aHostName) override { OTBR_UNUSED_VARIABLE(aHostName); }
+
+    void OnServiceResolveFailedImpl(const std::string &aType,
+                                    const std::string &aInstanceName,
+                                    int32_t            aErrorCode) override
+    {
+        OTBR_UNUSED_VARIABLE(aType);
+        OTBR_UNUSED_VARIABLE(aInstanceName);
+        OTBR_UNUSED_VARIABLE(aErrorCode);
+    }
+
+    void OnHostResolveFailedImpl(const std::string &aHostName, int32_t aErrorCode) override
+    {
+        OTBR_UNUSED_VARIABLE(aHostName);
+        OTBR_UNUSED_VARIABLE(aErrorCode);
+    }
+
+    otbrError DnsErrorToOtbrError(int32_t aError) override
+    {
+        OTBR_UNUSED_VARIABLE(aError);
+        return OTBR_ERROR_MDNS;
+    }
+};
+
+uint64_t PercentileNs(const std::vector<uint64_t> &aSortedLatencies, double aPercentile)
+{
+    size_t index = static_cast<size_t>(aPercentile * (aSortedLatencies.size() - 1));
+
+    return aSortedLatencies[index];
+}
+
+// Publishes one synthetic SRP host with two addresses and one service with
+// three TXT entries, mirroring what the Advertising Proxy emits per
+// `otSrpServerHost`. Returns the number of failed publish callbacks.
+size_t PublishSyntheticUpdate(BenchPublisher &aPublisher, size_t aIndex)
+{
+    size_t                    failures = 0;
+    char                      name[64];
+    uint8_t                   addressBytes[16] = {0xfd, 0x11, 0x22};
+    Publisher::ResultCallback callback         = [&failures](otbrError aError) {
+        failures += (aError != OTBR_ERROR_NONE && aError != OTBR_ERROR_DUPLICATED);
+    };
+
+    addressBytes[14] = static_cast<uint8_t>(aIndex >> 8);
+    addressBytes[15] = static_cast<uint8_t>(aIndex);
+
+    snprintf(name, sizeof(name), "srp-bench-host-%zu", aIndex);
+
+    {
+        std::vector<otbr::Ip6Address> addresses;
+
+        addresses.emplace_back(addressBytes);
+        addressBytes[13] = 1;
+        addresses.emplace_back(addressBytes);
+        addressBytes[13] = 0;
+
+        aPublisher.PublishHost(name, addresses, [&failures](otbrError aError) {
+            failures += (aError != OTBR_ERROR_NONE && aError != OTBR_ERROR_DUPLICATED);
+        });
+    }
+
+    {
+        Publisher::TxtList     txtList{{"rv", "1"}, {"nn", "bench"}, {"xp", "0011223344556677"}};
+        Publisher::SubTypeList subTypeList{"_bench"};
+        char                   instanceName[64];
+
+        snprintf(instanceName, sizeof(instanceName), "srp-bench-service-%zu", aIndex);
+        aPublisher.PublishService(name, instanceName, "_srp-bench._udp", subTypeList,
+                                  static_cast<uint16_t>(10000 + aIndex % 50000), std::move(txtList),
+                                  std::move(callback));
+    }
+
+    return failures;
+}
+
+void RunPass(BenchPublisher &aPublisher, const char *aPassName, size_t aUpdateCount)
+{
+    std::vector<uint64_t> latencies;
+    size_t                failures         = 0;
+    uint64_t              allocationsBefore;
+    double                seconds;
+
+    latencies.reserve(aUpdateCount);
+    allocationsBefore = sAllocationCount;
+
+    auto passStart = std::chrono::steady_clock::now();
+
+    for (size_t i = 0; i < aUpdateCount; i++)
+    {
+        auto updateStart = std::chrono::steady_clock::now();
+
+        failures += PublishSyntheticUpdate(aPublisher, i);
+
+        latencies.push_back(static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - updateStart)
+                .count()));
+    }
+
+    seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - passStart).count();
+    std::sort(latencies.begin(), latencies.end());
+
+    printf("%-12s %8.0f updates/s, %6.1f allocs/update, latency p50 %6.2f us, p90 %6.2f us, p99 %6.2f us\n", aPassName,
+           static_cast<double>(aUpdateCount) / seconds,
+           static_cast<double>(sAllocationCount - allocationsBefore) / aUpdateCount,
+           PercentileNs(latencies, 0.50) / 1000.0, PercentileNs(latencies, 0.90) / 1000.0,
+           PercentileNs(latencies, 0.99) / 1000.0);
+
+    if (failures > 0)
+    {
+        printf("%-12s %zu publish callbacks reported failure!\n", aPassName, failures);
+    }
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    constexpr size_t kDefaultUpdateCount = 10000;
+
+    size_t         updateCount = (argc > 1) ? static_cast<size_t>(strtoul(argv[1], nullptr, 0)) : kDefaultUpdateCount;
+    BenchPublisher publisher;
+
+    otbrLogInit("bench-srp-advertising", OTBR_LOG_WARNING, true);
+
+    publisher.Start();
+
+    // First pass registers every host and service; the second publishes the
+    // same content again and should be absorbed by duplicate suppression.
+    RunPass(publisher, "register", updateCount);
+    RunPass(publisher, "republish", updateCount);
+
+    publisher.Stop();
+
+    return 0;
+}
@@ -0,0 +1,166 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the performance regression suite over identified hot paths.
+ *
+ *   Run with `--json PATH` and compare two result files with
+ *   tests/scripts/compare-benchmarks to flag regressions.
+ */
+
+#include "common/arena.hpp"
+#include "common/dns_utils.hpp"
+#include "mdns/mdns.hpp"
+#include "rest/json.hpp"
+#include "utils/crc16.hpp"
+
+#include <vector>
+
+#include <stdint.h>
+#include <string.h>
+
+#include "bench_runner.hpp"
+
+// Keeps results observable so the optimizer cannot discard the benchmark bodies.
+static volatile size_t sSink;
+
+static void BenchmarkEncodeTxtData(otbr::Bench::Runner &aRunner)
+{
+    otbr::Mdns::Publisher::TxtList txtList{
+        {"rv", "1"}, {"tv", "1.3.0"}, {"nn", "OpenThreadDemo"}, {"xp", "dead00beef00cafe"},
+        {"sb", "296"}, {"dn", "DefaultDomain"}, {"at", "0123456789abcdef0123456789abcdef"},
+    };
+    std::vector<uint8_t> txtData;
+    size_t               bytesPerOp;
+
+    otbr::Mdns::Publisher::EncodeTxtData(txtList, txtData);
+    bytesPerOp = txtData.size();
+
+    aRunner.Run("mdns_encode_txt_data", bytesPerOp, [&txtList, &txtData](void) {
+        otbr::Mdns::Publisher::EncodeTxtData(txtList, txtData);
+        sSink = txtData.size();
+    });
+}
+
+static void BenchmarkSplitFullDnsName(otbr::Bench::Runner &aRunner)
+{
+    const std::string name = "OpenThread Demo._meshcop._udp.default.service.arpa.";
+
+    aRunner.Run("dns_split_full_name", name.size(), [&name](void) {
+        DnsNameInfo info = SplitFullDnsName(name);
+
+        sSink = info.mInstanceName.size();
+    });
+
+    aRunner.Run("dns_split_full_name_view", name.size(), [&name](void) {
+        DnsNameInfoView info = SplitFullDnsNameView(name.c_str(), name.size());
+
+        sSink = info.mInstanceName.mLength;
+    });
+}
+
+static void BenchmarkCrc16(otbr::Bench::Runner &aRunner)
+{
+    constexpr size_t     kBufferSize = 4096;
+    std::vector<uint8_t> buffer(kBufferSize);
+    otbr::Crc16          crc(otbr::Crc16::kCcitt);
+
+    for (size_t i = 0; i < kBufferSize; i++)
+    {
+        buffer[i] = static_cast<uint8_t>(i * 31 + 7);
+    }
+
+    aRunner.Run("crc16_ccitt_4k", kBufferSize, [&crc, &buffer](void) {
+        crc.Init();
+        crc.Update(buffer.data(), buffer.size());
+        sSink = crc.Get();
+    });
+}
+
+static void BenchmarkDiag2JsonString(otbr::Bench::Runner &aRunner)
+{
+    // A representative per-node diagnostic set: addresses, leader data and
+    // counters for a handful of nodes.
+    std::vector<std::vector<otNetworkDiagTlv>> diagSet;
+
+    for (int node = 0; node < 8; node++)
+    {
+        std::vector<otNetworkDiagTlv> diag;
+        otNetworkDiagTlv              tlv;
+
+        memset(&tlv, 0, sizeof(tlv));
+        tlv.mType = OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS;
+        for (size_t i = 0; i < sizeof(tlv.mData.mExtAddress.m8); i++)
+        {
+            tlv.mData.mExtAddress.m8[i] = static_cast<uint8_t>(node * 16 + i);
+        }
+        diag.push_back(tlv);
+
+        memset(&tlv, 0, sizeof(tlv));
+        tlv.mType                 = OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS;
+        tlv.mData.mAddr16         = static_cast<uint16_t>(0x2000 + node);
+        diag.push_back(tlv);
+
+        memset(&tlv, 0, sizeof(tlv));
+        tlv.mType                            = OT_NETWORK_DIAGNOSTIC_TLV_LEADER_DATA;
+        tlv.mData.mLeaderData.mPartitionId   = 0x12345678;
+        tlv.mData.mLeaderData.mWeighting     = 64;
+        tlv.mData.mLeaderData.mDataVersion   = 109;
+        tlv.mData.mLeaderData.mLeaderRouterId = 21;
+        diag.push_back(tlv);
+
+        memset(&tlv, 0, sizeof(tlv));
+        tlv.mType                         = OT_NETWORK_DIAGNOSTIC_TLV_MAC_COUNTERS;
+        tlv.mData.mMacCounters.mIfInUnknownProtos = node;
+        diag.push_back(tlv);
+
+        diagSet.push_back(diag);
+    }
+
+    aRunner.Run("json_diag_to_string", 0, [&diagSet](void) {
+        std::string json = otbr::rest::Json::Diag2JsonString(diagSet);
+
+        sSink = json.size();
+        // The mainloop resets the scratch arena after each pass; do the
+        // same here so cJSON scratch does not accumulate across iterations.
+        otbr::ScratchArena::GetInstance().Reset();
+    });
+}
+
+int main(int argc, char *argv[])
+{
+    otbr::Bench::Runner runner(argc, argv);
+
+    BenchmarkEncodeTxtData(runner);
+    BenchmarkSplitFullDnsName(runner);
+    BenchmarkCrc16(runner);
+    BenchmarkDiag2JsonString(runner);
+
+    return runner.Finish();
+}
@@ -0,0 +1,149 @@
+/*
+ *    Copyright (c) 2022, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the client side of the d-bus round-trip benchmark.
+ *   It drives ThreadApiDBus against the mock server from
+ *   bench_dbus_server.cpp and prints one CSV line per measurement:
+ *
+ *       benchmark,payload_bytes,iterations,usec_per_op,ops_per_sec
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "common/code_utils.hpp"
+#include "dbus/client/thread_api_dbus.hpp"
+
+using otbr::DBus::ClientError;
+using otbr::DBus::ThreadApiDBus;
+
+using Clock = std::chrono::steady_clock;
+
+static double UsecPerOp(Clock::duration aElapsed, size_t aIterations)
+{
+    return std::chrono::duration<double, std::micro>(aElapsed).count() / static_cast<double>(aIterations);
+}
+
+static void PrintResult(const char *aBenchmark, size_t aPayloadBytes, size_t aIterations, Clock::duration aElapsed)
+{
+    double usecPerOp = UsecPerOp(aElapsed, aIterations);
+
+    printf("%s,%zu,%zu,%.2f,%.0f\n", aBenchmark, aPayloadBytes, aIterations, usecPerOp, 1e6 / usecPerOp);
+}
+
+static int BenchmarkPingLatency(DBusConnection *aConnection, ThreadApiDBus &aApi, size_t aPipelineDepth)
+{
+    constexpr size_t kIterations = 2000;
+
+    int    ret       = EXIT_SUCCESS;
+    size_t completed = 0;
+    size_t queued    = 0;
+    auto   start     = Clock::now();
+
+    while (completed < kIterations)
+    {
+        while (queued < completed + aPipelineDepth && queued < kIterations)
+        {
+            ClientError error = aApi.QueuePipelinedCall("Ping", [&completed](ClientError aError) {
+                VerifyOrDie(aError == ClientError::ERROR_NONE, "Ping failed");
+                completed++;
+            });
+
+            VerifyOrExit(error == ClientError::ERROR_NONE, ret = EXIT_FAILURE);
+            queued++;
+        }
+        aApi.FlushPipelinedCalls();
+        VerifyOrExit(dbus_connection_read_write_dispatch(aConnection, /* timeout */ 10000), ret = EXIT_FAILURE);
+    }
+
+    PrintResult(aPipelineDepth == 1 ? "ping-round-trip" : "ping-pipelined", 0, kIterations, Clock::now() - start);
+
+exit:
+    return ret;
+}
+
+static int BenchmarkPropertyRead(ThreadApiDBus &aApi, size_t aPayloadBytes)
+{
+    constexpr size_t kIterations = 1000;
+
+    int         ret          = EXIT_SUCCESS;
+    std::string propertyName = "Blob" + std::to_string(aPayloadBytes);
+    auto        start        = Clock::now();
+
+    for (size_t i = 0; i < kIterations; i++)
+    {
+        std::vector<uint8_t> blob;
+
+        VerifyOrExit(aApi.GetProperties({propertyName}, blob) == ClientError::ERROR_NONE, ret = EXIT_FAILURE);
+        VerifyOrExit(blob.size() == aPayloadBytes, ret = EXIT_FAILURE);
+    }
+
+    PrintResult("property-read", aPayloadBytes, kIterations, Clock::now() - start);
+
+exit:
+    return ret;
+}
+
+int main()
+{
+    int       ret = EXIT_SUCCESS;
+    DBusError dbusErr;
+
+    dbus_error_init(&dbusErr);
+
+    DBusConnection *connection = dbus_bus_get(DBUS_BUS_SYSTEM, &dbusErr);
+    VerifyOrExit(connection != nullptr, ret = EXIT_FAILURE);
+    dbus_bus_register(connection, &dbusErr);
+
+    {
+        ThreadApiDBus api(connection, "benchmock");
+
+        printf("benchmark,payload_bytes,iterations,usec_per_op,ops_per_sec\n");
+
+        SuccessOrExit(ret = BenchmarkPingLatency(connection, api, /* aPipelineDepth */ 1));
+        SuccessOrExit(ret = BenchmarkPingLatency(connection, api, /* aPipelineDepth */ 64));
+
+        for (size_t payloadBytes : {8, 64, 1024, 16384})
+        {
+            SuccessOrExit(ret = BenchmarkPropertyRead(api, payloadBytes));
+        }
+
+        api.QueuePipelinedCall("Quit", nullptr);
+        api.FlushPipelinedCalls();
+    }
+
+exit:
+    dbus_error_free(&dbusErr);
+    return ret;
+}
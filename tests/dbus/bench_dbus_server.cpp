@@ -0,0 +1,169 @@
+/*
+ *    Copyright (c) 2022, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the mock server side of the d-bus round-trip
+ *   benchmark. It mimics the reply shapes of DBusThreadObject (including
+ *   the batched `GetProperties` method) without needing an NCP, so the
+ *   client measures pure marshalling and bus cost.
+ */
+
+#include <stdlib.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "common/code_utils.hpp"
+#include "dbus/common/constants.hpp"
+#include "dbus/common/dbus_message_helper.hpp"
+#include "dbus/server/dbus_object.hpp"
+
+using otbr::DBus::DBusMessageEncodeToVariant;
+using otbr::DBus::DBusMessageExtract;
+using otbr::DBus::DBusObject;
+using otbr::DBus::DBusRequest;
+using otbr::DBus::UniqueDBusMessage;
+using std::placeholders::_1;
+
+static const char kBenchServerName[] = OTBR_DBUS_SERVER_PREFIX "benchmock";
+static const char kBenchObjectPath[] = OTBR_DBUS_OBJECT_PREFIX "benchmock";
+
+class BenchObject : public DBusObject
+{
+public:
+    BenchObject(DBusConnection *aConnection)
+        : DBusObject(aConnection, kBenchObjectPath)
+        , mEnded(false)
+    {
+        RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, "Ping", std::bind(&BenchObject::PingHandler, this, _1));
+        RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, "Quit", std::bind(&BenchObject::QuitHandler, this, _1));
+        RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_GET_PROPERTIES_METHOD,
+                       std::bind(&BenchObject::GetPropertiesHandler, this, _1));
+
+        for (size_t size : {8, 64, 1024, 16384})
+        {
+            std::vector<uint8_t> blob(size);
+
+            for (size_t i = 0; i < size; i++)
+            {
+                blob[i] = static_cast<uint8_t>(i);
+            }
+            mBlobs["Blob" + std::to_string(size)] = std::move(blob);
+        }
+    }
+
+    bool IsEnded(void) const { return mEnded; }
+
+private:
+    void PingHandler(DBusRequest &aRequest) { aRequest.Reply(std::tuple<>()); }
+
+    void QuitHandler(DBusRequest &aRequest)
+    {
+        aRequest.Reply(std::tuple<>());
+        mEnded = true;
+    }
+
+    // Mirrors DBusThreadObject::GetPropertiesHandler: the reply is an
+    // array of variants, one per requested property name.
+    void GetPropertiesHandler(DBusRequest &aRequest)
+    {
+        UniqueDBusMessage        reply(dbus_message_new_method_return(aRequest.GetMessage()));
+        DBusMessageIter          iter;
+        DBusMessageIter          replyIter;
+        DBusMessageIter          replySubIter;
+        std::vector<std::string> propertyNames;
+        otError                  error = OT_ERROR_NONE;
+
+        VerifyOrExit(reply != nullptr, error = OT_ERROR_NO_BUFS);
+        VerifyOrExit(dbus_message_iter_init(aRequest.GetMessage(), &iter), error = OT_ERROR_FAILED);
+        VerifyOrExit(DBusMessageExtract(&iter, propertyNames) == OTBR_ERROR_NONE, error = OT_ERROR_PARSE);
+
+        dbus_message_iter_init_append(reply.get(), &replyIter);
+        VerifyOrExit(
+            dbus_message_iter_open_container(&replyIter, DBUS_TYPE_ARRAY, DBUS_TYPE_VARIANT_AS_STRING, &replySubIter),
+            error = OT_ERROR_NO_BUFS);
+
+        for (const std::string &propertyName : propertyNames)
+        {
+            auto blobIter = mBlobs.find(propertyName);
+
+            VerifyOrExit(blobIter != mBlobs.end(), error = OT_ERROR_NOT_FOUND);
+            VerifyOrExit(DBusMessageEncodeToVariant(&replySubIter, blobIter->second) == OTBR_ERROR_NONE,
+                         error = OT_ERROR_FAILED);
+        }
+
+        VerifyOrExit(dbus_message_iter_close_container(&replyIter, &replySubIter), error = OT_ERROR_NO_BUFS);
+
+    exit:
+        if (error == OT_ERROR_NONE)
+        {
+            dbus_connection_send(aRequest.GetConnection(), reply.get(), nullptr);
+        }
+        else
+        {
+            aRequest.ReplyOtResult(error);
+        }
+    }
+
+    bool                                        mEnded;
+    std::map<std::string, std::vector<uint8_t>> mBlobs;
+};
+
+int main()
+{
+    int       ret = EXIT_SUCCESS;
+    int       requestReply;
+    DBusError dbusErr;
+
+    dbus_error_init(&dbusErr);
+
+    DBusConnection *connection = dbus_bus_get(DBUS_BUS_SYSTEM, &dbusErr);
+    VerifyOrExit(connection != nullptr, ret = EXIT_FAILURE);
+    dbus_bus_register(connection, &dbusErr);
+
+    requestReply = dbus_bus_request_name(connection, kBenchServerName, DBUS_NAME_FLAG_REPLACE_EXISTING, &dbusErr);
+    VerifyOrExit(requestReply == DBUS_REQUEST_NAME_REPLY_PRIMARY_OWNER ||
+                     requestReply == DBUS_REQUEST_NAME_REPLY_ALREADY_OWNER,
+                 ret = EXIT_FAILURE);
+
+    {
+        BenchObject s(connection);
+        s.Init();
+
+        while (!s.IsEnded())
+        {
+            dbus_connection_read_write_dispatch(connection, -1);
+        }
+    }
+
+exit:
+    dbus_error_free(&dbusErr);
+    return ret;
+}
@@ -0,0 +1,389 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a keep-alive HTTP load generator for the otbr REST server.
+ *
+ *   It drives a running otbr-agent with concurrent persistent connections over a
+ *   mix of endpoints and reports requests/sec, latency percentiles and (when
+ *   --agent-pid is given) agent CPU usage. Compare runs against the committed
+ *   baseline in tests/rest/baseline.json.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace {
+
+struct Options
+{
+    const char *             mHost        = "127.0.0.1";
+    uint16_t                 mPort        = 8081;
+    uint32_t                 mConnections = 16;
+    uint32_t                 mDuration    = 10;
+    long                     mAgentPid    = 0;
+    bool                     mJson        = false;
+    std::vector<std::string> mEndpoints;
+};
+
+struct Connection
+{
+    int         mFd = -1;
+    std::string mRequest;
+    std::string mResponse;
+    std::chrono::steady_clock::time_point mSentTime;
+    size_t                                mSentBytes    = 0;
+    size_t                                mNextEndpoint = 0;
+};
+
+// Cumulative CPU time (user + system) of a process, in clock ticks.
+uint64_t ReadProcessCpuTicks(long aPid)
+{
+    char          path[64];
+    unsigned long utime = 0;
+    unsigned long stime = 0;
+    FILE *        file;
+    char          line[1024];
+    char *        statsAfterComm;
+
+    snprintf(path, sizeof(path), "/proc/%ld/stat", aPid);
+    file = fopen(path, "r");
+
+    if (file == nullptr || fgets(line, sizeof(line), file) == nullptr)
+    {
+        if (file != nullptr)
+        {
+            fclose(file);
+        }
+        return 0;
+    }
+    fclose(file);
+
+    // The comm field may contain spaces; fields 14 and 15 are utime/stime
+    // counted from after the closing parenthesis.
+    statsAfterComm = strrchr(line, ')');
+    if (statsAfterComm == nullptr ||
+        sscanf(statsAfterComm + 1, " %*c %*d %*d %*d %*d %*d %*u %*u %*u %*u %*u %lu %lu", &utime, &stime) != 2)
+    {
+        return 0;
+    }
+
+    return static_cast<uint64_t>(utime) + stime;
+}
+
+int ConnectTo(const char *aHost, uint16_t aPort)
+{
+    int                fd = socket(AF_INET, SOCK_STREAM, 0);
+    int                on = 1;
+    struct sockaddr_in addr;
+
+    if (fd < 0)
+    {
+        return -1;
+    }
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port   = htons(aPort);
+
+    if (inet_pton(AF_INET, aHost, &addr.sin_addr) != 1 ||
+        connect(fd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) != 0)
+    {
+        close(fd);
+        return -1;
+    }
+
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+
+    return fd;
+}
+
+void StartRequest(Connection &aConnection, const Options &aOptions)
+{
+    const std::string &endpoint = aOptions.mEndpoints[aConnection.mNextEndpoint];
+
+    aConnection.mNextEndpoint = (aConnection.mNextEndpoint + 1) % aOptions.mEndpoints.size();
+    aConnection.mRequest      = "GET " + endpoint + " HTTP/1.1\r\nHost: " + aOptions.mHost +
+                           "\r\nConnection: keep-alive\r\nAccept: application/json\r\n\r\n";
+    aConnection.mResponse.clear();
+    aConnection.mSentBytes = 0;
+    aConnection.mSentTime  = std::chrono::steady_clock::now();
+}
+
+// Returns true when a full response (headers plus Content-Length body) has
+// been buffered.
+bool HasFullResponse(const std::string &aResponse)
+{
+    bool   full          = false;
+    size_t headerEnd     = aResponse.find("\r\n\r\n");
+    long   contentLength = 0;
+
+    if (headerEnd != std::string::npos)
+    {
+        size_t lengthPos = aResponse.find("Content-Length:");
+
+        if (lengthPos != std::string::npos && lengthPos < headerEnd)
+        {
+            contentLength = strtol(aResponse.c_str() + lengthPos + strlen("Content-Length:"), nullptr, 10);
+        }
+
+        full = aResponse.size() >= headerEnd + 4 + static_cast<size_t>(contentLength);
+    }
+
+    return full;
+}
+
+uint64_t Percentile(const std::vector<uint64_t> &aSortedLatencies, double aPercentile)
+{
+    size_t index;
+
+    if (aSortedLatencies.empty())
+    {
+        return 0;
+    }
+
+    index = static_cast<size_t>(aPercentile * (aSortedLatencies.size() - 1) / 100.0 + 0.5);
+
+    return aSortedLatencies[index];
+}
+
+void PrintUsage(const char *aProgramName)
+{
+    fprintf(stderr,
+            "Usage: %s [--host HOST] [--port PORT] [--connections N] [--duration SECONDS]\n"
+            "          [--agent-pid PID] [--json] [ENDPOINT ...]\n"
+            "Default endpoint mix: /node /node/state /node/rloc16\n",
+            aProgramName);
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    Options                 options;
+    std::vector<Connection> connections;
+    std::vector<uint64_t>   latencies;
+    std::vector<pollfd>     pollFds;
+    uint64_t                completed  = 0;
+    uint64_t                errors     = 0;
+    uint64_t                cpuBefore  = 0;
+    double                  elapsed    = 0;
+    double                  cpuPercent = 0;
+    char                    buffer[4096];
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--host") == 0 && i + 1 < argc)
+        {
+            options.mHost = argv[++i];
+        }
+        else if (strcmp(argv[i], "--port") == 0 && i + 1 < argc)
+        {
+            options.mPort = static_cast<uint16_t>(atoi(argv[++i]));
+        }
+        else if (strcmp(argv[i], "--connections") == 0 && i + 1 < argc)
+        {
+            options.mConnections = static_cast<uint32_t>(atoi(argv[++i]));
+        }
+        else if (strcmp(argv[i], "--duration") == 0 && i + 1 < argc)
+        {
+            options.mDuration = static_cast<uint32_t>(atoi(argv[++i]));
+        }
+        else if (strcmp(argv[i], "--agent-pid") == 0 && i + 1 < argc)
+        {
+            options.mAgentPid = atol(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--json") == 0)
+        {
+            options.mJson = true;
+        }
+        else if (argv[i][0] == '/')
+        {
+            options.mEndpoints.push_back(argv[i]);
+        }
+        else
+        {
+            PrintUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (options.mEndpoints.empty())
+    {
+        options.mEndpoints = {"/node", "/node/state", "/node/rloc16"};
+    }
+
+    connections.resize(options.mConnections);
+    pollFds.resize(options.mConnections);
+
+    for (uint32_t i = 0; i < options.mConnections; i++)
+    {
+        connections[i].mFd = ConnectTo(options.mHost, options.mPort);
+        if (connections[i].mFd < 0)
+        {
+            fprintf(stderr, "Failed to connect to %s:%u: %s\n", options.mHost, options.mPort, strerror(errno));
+            return EXIT_FAILURE;
+        }
+
+        // Stagger the endpoint mix across connections.
+        connections[i].mNextEndpoint = i % options.mEndpoints.size();
+        StartRequest(connections[i], options);
+    }
+
+    if (options.mAgentPid != 0)
+    {
+        cpuBefore = ReadProcessCpuTicks(options.mAgentPid);
+    }
+
+    {
+        auto start    = std::chrono::steady_clock::now();
+        auto deadline = start + std::chrono::seconds(options.mDuration);
+
+        while (std::chrono::steady_clock::now() < deadline)
+        {
+            for (uint32_t i = 0; i < options.mConnections; i++)
+            {
+                pollFds[i].fd     = connections[i].mFd;
+                pollFds[i].events = connections[i].mSentBytes < connections[i].mRequest.size() ? POLLOUT : POLLIN;
+            }
+
+            if (poll(pollFds.data(), options.mConnections, 100) <= 0)
+            {
+                continue;
+            }
+
+            for (uint32_t i = 0; i < options.mConnections; i++)
+            {
+                Connection &connection = connections[i];
+
+                if (pollFds[i].revents & POLLOUT)
+                {
+                    ssize_t written = write(connection.mFd, connection.mRequest.data() + connection.mSentBytes,
+                                            connection.mRequest.size() - connection.mSentBytes);
+
+                    if (written > 0)
+                    {
+                        connection.mSentBytes += static_cast<size_t>(written);
+                    }
+                }
+                else if (pollFds[i].revents & (POLLIN | POLLERR | POLLHUP))
+                {
+                    ssize_t received = read(connection.mFd, buffer, sizeof(buffer));
+
+                    if (received <= 0)
+                    {
+                        // The server closed the connection; reconnect.
+                        errors++;
+                        close(connection.mFd);
+                        connection.mFd = ConnectTo(options.mHost, options.mPort);
+                        if (connection.mFd < 0)
+                        {
+                            fprintf(stderr, "Reconnect failed: %s\n", strerror(errno));
+                            return EXIT_FAILURE;
+                        }
+                        StartRequest(connection, options);
+                        continue;
+                    }
+
+                    connection.mResponse.append(buffer, static_cast<size_t>(received));
+
+                    if (HasFullResponse(connection.mResponse))
+                    {
+                        auto now = std::chrono::steady_clock::now();
+
+                        latencies.push_back(static_cast<uint64_t>(
+                            std::chrono::duration_cast<std::chrono::microseconds>(now - connection.mSentTime).count()));
+                        completed++;
+                        StartRequest(connection, options);
+                    }
+                }
+            }
+        }
+
+        elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    if (options.mAgentPid != 0)
+    {
+        uint64_t cpuTicks = ReadProcessCpuTicks(options.mAgentPid) - cpuBefore;
+
+        cpuPercent = 100.0 * static_cast<double>(cpuTicks) / sysconf(_SC_CLK_TCK) / elapsed;
+    }
+
+    for (Connection &connection : connections)
+    {
+        close(connection.mFd);
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+
+    if (options.mJson)
+    {
+        printf("{\"connections\":%u,\"duration_s\":%.1f,\"requests\":%llu,\"errors\":%llu,"
+               "\"requests_per_sec\":%.1f,\"latency_us\":{\"p50\":%llu,\"p90\":%llu,\"p99\":%llu},"
+               "\"agent_cpu_percent\":%.1f}\n",
+               options.mConnections, elapsed, static_cast<unsigned long long>(completed),
+               static_cast<unsigned long long>(errors), completed / elapsed,
+               static_cast<unsigned long long>(Percentile(latencies, 50)),
+               static_cast<unsigned long long>(Percentile(latencies, 90)),
+               static_cast<unsigned long long>(Percentile(latencies, 99)), cpuPercent);
+    }
+    else
+    {
+        printf("%llu requests in %.1fs over %u connections (%llu errors)\n",
+               static_cast<unsigned long long>(completed), elapsed, options.mConnections,
+               static_cast<unsigned long long>(errors));
+        printf("requests/sec: %.1f\n", completed / elapsed);
+        printf("latency: p50 %llu us, p90 %llu us, p99 %llu us\n",
+               static_cast<unsigned long long>(Percentile(latencies, 50)),
+               static_cast<unsigned long long>(Percentile(latencies, 90)),
+               static_cast<unsigned long long>(Percentile(latencies, 99)));
+        if (options.mAgentPid != 0)
+        {
+            printf("agent CPU: %.1f%%\n", cpuPercent);
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
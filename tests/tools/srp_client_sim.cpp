@@ -0,0 +1,577 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a mock SRP client fleet for load-testing the SRP server path.
+ *
+ *   Each synthetic client registers one host with one service via a DNS
+ *   Update carrying the SRP lease option and a SIG(0) signature (ECDSA
+ *   P-256/SHA-256), then refreshes it periodically, so AdvertisingProxy and
+ *   the mDNS backend see a realistic registration mix at bench scale.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <mbedtls/ctr_drbg.h>
+#include <mbedtls/ecdsa.h>
+#include <mbedtls/entropy.h>
+#include <mbedtls/sha256.h>
+
+namespace {
+
+constexpr uint16_t kDnsTypeSoa   = 6;
+constexpr uint16_t kDnsTypePtr   = 12;
+constexpr uint16_t kDnsTypeKey   = 25;
+constexpr uint16_t kDnsTypeTxt   = 16;
+constexpr uint16_t kDnsTypeAaaa  = 28;
+constexpr uint16_t kDnsTypeSrv   = 33;
+constexpr uint16_t kDnsTypeOpt   = 41;
+constexpr uint16_t kDnsTypeSig   = 24;
+constexpr uint16_t kDnsClassIn   = 1;
+constexpr uint16_t kDnsClassNone = 254;
+
+constexpr uint8_t  kDnssecAlgEcdsaP256Sha256 = 13;
+constexpr uint16_t kLeaseOptionCode          = 2; // EDNS0 update lease option.
+
+constexpr uint16_t kUpdateFlags = 5 << 11; // Opcode Update, QR=0.
+
+const char kDefaultDomain[] = "default.service.arpa.";
+
+struct Options
+{
+    const char *mServer      = "::1";
+    uint16_t    mPort        = 53535; // Default OT SRP server port range start.
+    uint32_t    mNumClients  = 100;
+    uint32_t    mRate        = 50;  // Registrations per second.
+    uint32_t    mLease       = 300; // Lease, in seconds.
+    uint32_t    mKeyLease    = 600; // Key lease, in seconds.
+    uint32_t    mDuration    = 60;  // Soak duration, in seconds.
+    const char *mServiceType = "_srpsim._udp";
+};
+
+// A wire-format DNS message under construction.
+class MessageBuilder
+{
+public:
+    std::vector<uint8_t> &GetBytes(void) { return mBytes; }
+
+    void AppendUint8(uint8_t aValue) { mBytes.push_back(aValue); }
+
+    void AppendUint16(uint16_t aValue)
+    {
+        mBytes.push_back(static_cast<uint8_t>(aValue >> 8));
+        mBytes.push_back(static_cast<uint8_t>(aValue));
+    }
+
+    void AppendUint32(uint32_t aValue)
+    {
+        AppendUint16(static_cast<uint16_t>(aValue >> 16));
+        AppendUint16(static_cast<uint16_t>(aValue));
+    }
+
+    void AppendBytes(const uint8_t *aBytes, size_t aLength) { mBytes.insert(mBytes.end(), aBytes, aBytes + aLength); }
+
+    // Appends a dotted name as uncompressed labels; a trailing dot is
+    // accepted and implied otherwise.
+    void AppendName(const std::string &aName)
+    {
+        size_t begin = 0;
+
+        while (begin < aName.size())
+        {
+            size_t end = aName.find('.', begin);
+
+            if (end == std::string::npos)
+            {
+                end = aName.size();
+            }
+
+            AppendUint8(static_cast<uint8_t>(end - begin));
+            AppendBytes(reinterpret_cast<const uint8_t *>(aName.data()) + begin, end - begin);
+            begin = end + 1;
+        }
+
+        AppendUint8(0);
+    }
+
+    // Patches a previously appended big-endian uint16, e.g. an RDLENGTH
+    // placeholder or a header count.
+    void PatchUint16(size_t aOffset, uint16_t aValue)
+    {
+        mBytes[aOffset]     = static_cast<uint8_t>(aValue >> 8);
+        mBytes[aOffset + 1] = static_cast<uint8_t>(aValue);
+    }
+
+    size_t GetLength(void) const { return mBytes.size(); }
+
+private:
+    std::vector<uint8_t> mBytes;
+};
+
+// One synthetic SRP client: a host with an ECDSA key and one service.
+struct Client
+{
+    std::string            mHostName;
+    std::string            mInstanceName;
+    uint8_t                mAddress[16];
+    uint16_t               mPort;
+    mbedtls_ecdsa_context  mKey;
+    uint16_t               mPendingMessageId = 0;
+    std::chrono::steady_clock::time_point mSentTime;
+    std::chrono::steady_clock::time_point mNextRefresh;
+    bool                   mRegistered = false;
+};
+
+mbedtls_entropy_context  sEntropy;
+mbedtls_ctr_drbg_context sCtrDrbg;
+
+// RFC 4034 Appendix B key tag over the KEY RDATA.
+uint16_t ComputeKeyTag(const uint8_t *aRdata, size_t aLength)
+{
+    uint32_t accumulator = 0;
+
+    for (size_t i = 0; i < aLength; i++)
+    {
+        accumulator += (i & 1) ? aRdata[i] : static_cast<uint32_t>(aRdata[i]) << 8;
+    }
+
+    accumulator += (accumulator >> 16) & 0xffff;
+
+    return static_cast<uint16_t>(accumulator);
+}
+
+// KEY RDATA: flags, protocol 3 (DNSSEC), algorithm, then the 64-byte
+// uncompressed P-256 public key (X | Y) as DNSSEC algorithm 13 requires.
+std::vector<uint8_t> BuildKeyRdata(mbedtls_ecdsa_context &aKey)
+{
+    std::vector<uint8_t> rdata;
+    uint8_t              point[65];
+    size_t               pointLength = 0;
+
+    rdata.push_back(0x02); // Flags: ZONE
+    rdata.push_back(0x00);
+    rdata.push_back(3); // Protocol: DNSSEC
+    rdata.push_back(kDnssecAlgEcdsaP256Sha256);
+
+    mbedtls_ecp_point_write_binary(&aKey.grp, &aKey.Q, MBEDTLS_ECP_PF_UNCOMPRESSED, &pointLength, point,
+                                   sizeof(point));
+    rdata.insert(rdata.end(), point + 1, point + pointLength); // Strip the 0x04 prefix.
+
+    return rdata;
+}
+
+// Appends one resource record with a computed RDLENGTH.
+size_t BeginRecord(MessageBuilder &aMessage, const std::string &aName, uint16_t aType, uint16_t aClass, uint32_t aTtl)
+{
+    size_t rdlengthOffset;
+
+    aMessage.AppendName(aName);
+    aMessage.AppendUint16(aType);
+    aMessage.AppendUint16(aClass);
+    aMessage.AppendUint32(aTtl);
+    rdlengthOffset = aMessage.GetLength();
+    aMessage.AppendUint16(0); // RDLENGTH placeholder.
+
+    return rdlengthOffset;
+}
+
+void EndRecord(MessageBuilder &aMessage, size_t aRdlengthOffset)
+{
+    aMessage.PatchUint16(aRdlengthOffset, static_cast<uint16_t>(aMessage.GetLength() - aRdlengthOffset - 2));
+}
+
+// Builds a full SRP registration/refresh for @p aClient: zone section,
+// host AAAA + KEY, service PTR/SRV/TXT, the lease option, and a trailing
+// SIG(0) over the message.
+std::vector<uint8_t> BuildSrpUpdate(Client &aClient, const Options &aOptions, uint16_t aMessageId)
+{
+    MessageBuilder message;
+    std::string    serviceName = std::string(aOptions.mServiceType) + "." + kDefaultDomain;
+    size_t         rdlengthOffset;
+
+    // Header: one zone, no prerequisites; update and additional counts are
+    // patched as records are appended.
+    message.AppendUint16(aMessageId);
+    message.AppendUint16(kUpdateFlags);
+    message.AppendUint16(1); // ZOCOUNT
+    message.AppendUint16(0); // PRCOUNT
+    message.AppendUint16(5); // UPCOUNT
+    message.AppendUint16(1); // ARCOUNT, excluding the SIG(0) while signing.
+
+    message.AppendName(kDefaultDomain);
+    message.AppendUint16(kDnsTypeSoa);
+    message.AppendUint16(kDnsClassIn);
+
+    // Host AAAA.
+    rdlengthOffset = BeginRecord(message, aClient.mHostName, kDnsTypeAaaa, kDnsClassIn, aOptions.mLease);
+    message.AppendBytes(aClient.mAddress, sizeof(aClient.mAddress));
+    EndRecord(message, rdlengthOffset);
+
+    // Host KEY.
+    {
+        std::vector<uint8_t> keyRdata = BuildKeyRdata(aClient.mKey);
+
+        rdlengthOffset = BeginRecord(message, aClient.mHostName, kDnsTypeKey, kDnsClassIn, aOptions.mKeyLease);
+        message.AppendBytes(keyRdata.data(), keyRdata.size());
+        EndRecord(message, rdlengthOffset);
+    }
+
+    // Service PTR.
+    rdlengthOffset = BeginRecord(message, serviceName, kDnsTypePtr, kDnsClassIn, aOptions.mLease);
+    message.AppendName(aClient.mInstanceName);
+    EndRecord(message, rdlengthOffset);
+
+    // Service SRV.
+    rdlengthOffset = BeginRecord(message, aClient.mInstanceName, kDnsTypeSrv, kDnsClassIn, aOptions.mLease);
+    message.AppendUint16(0); // Priority
+    message.AppendUint16(0); // Weight
+    message.AppendUint16(aClient.mPort);
+    message.AppendName(aClient.mHostName);
+    EndRecord(message, rdlengthOffset);
+
+    // Service TXT.
+    rdlengthOffset = BeginRecord(message, aClient.mInstanceName, kDnsTypeTxt, kDnsClassIn, aOptions.mLease);
+    message.AppendUint8(7);
+    message.AppendBytes(reinterpret_cast<const uint8_t *>("sim=1.0"), 7);
+    EndRecord(message, rdlengthOffset);
+
+    // EDNS0 OPT with the SRP update lease option.
+    message.AppendUint8(0); // Root name.
+    message.AppendUint16(kDnsTypeOpt);
+    message.AppendUint16(1232); // Requestor's UDP payload size.
+    message.AppendUint32(0);
+    message.AppendUint16(12); // RDLENGTH
+    message.AppendUint16(kLeaseOptionCode);
+    message.AppendUint16(8);
+    message.AppendUint32(aOptions.mLease);
+    message.AppendUint32(aOptions.mKeyLease);
+
+    // SIG(0), RFC 2931: the signature covers the SIG RDATA minus the
+    // signature itself, followed by the message with the SIG(0) record
+    // excluded from ARCOUNT.
+    {
+        std::vector<uint8_t> keyRdata = BuildKeyRdata(aClient.mKey);
+        uint32_t             now      = static_cast<uint32_t>(time(nullptr));
+        MessageBuilder       sigRdata;
+        uint8_t              digest[32];
+        mbedtls_sha256_context sha;
+        mbedtls_mpi          r, s;
+        uint8_t              signature[64];
+
+        sigRdata.AppendUint16(0); // Type covered: 0 for SIG(0).
+        sigRdata.AppendUint8(kDnssecAlgEcdsaP256Sha256);
+        sigRdata.AppendUint8(0);  // Labels
+        sigRdata.AppendUint32(0); // Original TTL
+        sigRdata.AppendUint32(now + 300);
+        sigRdata.AppendUint32(now - 300);
+        sigRdata.AppendUint16(ComputeKeyTag(keyRdata.data(), keyRdata.size()));
+        sigRdata.AppendName(aClient.mHostName);
+
+        mbedtls_sha256_init(&sha);
+        mbedtls_sha256_starts_ret(&sha, 0);
+        mbedtls_sha256_update_ret(&sha, sigRdata.GetBytes().data(), sigRdata.GetLength());
+        mbedtls_sha256_update_ret(&sha, message.GetBytes().data(), message.GetLength());
+        mbedtls_sha256_finish_ret(&sha, digest);
+        mbedtls_sha256_free(&sha);
+
+        mbedtls_mpi_init(&r);
+        mbedtls_mpi_init(&s);
+        mbedtls_ecdsa_sign(&aClient.mKey.grp, &r, &s, &aClient.mKey.d, digest, sizeof(digest),
+                           mbedtls_ctr_drbg_random, &sCtrDrbg);
+        mbedtls_mpi_write_binary(&r, signature, 32);
+        mbedtls_mpi_write_binary(&s, signature + 32, 32);
+        mbedtls_mpi_free(&r);
+        mbedtls_mpi_free(&s);
+
+        // Now append the SIG(0) record and count it in ARCOUNT.
+        message.PatchUint16(10, 2);
+        rdlengthOffset = BeginRecord(message, ".", kDnsTypeSig, kDnsClassNone, 0);
+        message.AppendBytes(sigRdata.GetBytes().data(), sigRdata.GetLength());
+        message.AppendBytes(signature, sizeof(signature));
+        EndRecord(message, rdlengthOffset);
+    }
+
+    return message.GetBytes();
+}
+
+uint64_t Percentile(const std::vector<uint64_t> &aSorted, double aPercentile)
+{
+    return aSorted.empty() ? 0 : aSorted[static_cast<size_t>(aPercentile * (aSorted.size() - 1) / 100.0 + 0.5)];
+}
+
+void PrintUsage(const char *aProgramName)
+{
+    fprintf(stderr,
+            "Usage: %s [--server ADDR] [--port PORT] [--clients N] [--rate PER_SEC]\n"
+            "          [--lease SECONDS] [--key-lease SECONDS] [--duration SECONDS]\n",
+            aProgramName);
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    Options               options;
+    std::vector<Client>   clients;
+    std::vector<uint64_t> latencies;
+    struct sockaddr_in6   server;
+    int                   fd;
+    uint64_t              sent      = 0;
+    uint64_t              succeeded = 0;
+    uint64_t              failed    = 0;
+    uint16_t              nextMessageId = 1;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--server") == 0 && i + 1 < argc)
+        {
+            options.mServer = argv[++i];
+        }
+        else if (strcmp(argv[i], "--port") == 0 && i + 1 < argc)
+        {
+            options.mPort = static_cast<uint16_t>(atoi(argv[++i]));
+        }
+        else if (strcmp(argv[i], "--clients") == 0 && i + 1 < argc)
+        {
+            options.mNumClients = static_cast<uint32_t>(atoi(argv[++i]));
+        }
+        else if (strcmp(argv[i], "--rate") == 0 && i + 1 < argc)
+        {
+            options.mRate = static_cast<uint32_t>(atoi(argv[++i]));
+        }
+        else if (strcmp(argv[i], "--lease") == 0 && i + 1 < argc)
+        {
+            options.mLease = static_cast<uint32_t>(atoi(argv[++i]));
+        }
+        else if (strcmp(argv[i], "--key-lease") == 0 && i + 1 < argc)
+        {
+            options.mKeyLease = static_cast<uint32_t>(atoi(argv[++i]));
+        }
+        else if (strcmp(argv[i], "--duration") == 0 && i + 1 < argc)
+        {
+            options.mDuration = static_cast<uint32_t>(atoi(argv[++i]));
+        }
+        else
+        {
+            PrintUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    mbedtls_entropy_init(&sEntropy);
+    mbedtls_ctr_drbg_init(&sCtrDrbg);
+    if (mbedtls_ctr_drbg_seed(&sCtrDrbg, mbedtls_entropy_func, &sEntropy,
+                              reinterpret_cast<const unsigned char *>("srp-client-sim"), 14) != 0)
+    {
+        fprintf(stderr, "Failed to seed the RNG\n");
+        return EXIT_FAILURE;
+    }
+
+    memset(&server, 0, sizeof(server));
+    server.sin6_family = AF_INET6;
+    server.sin6_port   = htons(options.mPort);
+    if (inet_pton(AF_INET6, options.mServer, &server.sin6_addr) != 1)
+    {
+        fprintf(stderr, "Invalid server address: %s\n", options.mServer);
+        return EXIT_FAILURE;
+    }
+
+    fd = socket(AF_INET6, SOCK_DGRAM, 0);
+    if (fd < 0)
+    {
+        perror("socket");
+        return EXIT_FAILURE;
+    }
+
+    printf("Generating %u clients with ECDSA keys...\n", options.mNumClients);
+
+    clients.resize(options.mNumClients);
+    for (uint32_t i = 0; i < options.mNumClients; i++)
+    {
+        Client &client = clients[i];
+        char    name[64];
+
+        snprintf(name, sizeof(name), "srpsim-%u.%s", i, kDefaultDomain);
+        client.mHostName = name;
+        snprintf(name, sizeof(name), "srpsim-%u.%s.%s", i, options.mServiceType, kDefaultDomain);
+        client.mInstanceName = name;
+
+        memset(client.mAddress, 0, sizeof(client.mAddress));
+        client.mAddress[0]  = 0xfd;
+        client.mAddress[14] = static_cast<uint8_t>(i >> 8);
+        client.mAddress[15] = static_cast<uint8_t>(i);
+        client.mPort        = static_cast<uint16_t>(10000 + i);
+
+        mbedtls_ecdsa_init(&client.mKey);
+        if (mbedtls_ecdsa_genkey(&client.mKey, MBEDTLS_ECP_DP_SECP256R1, mbedtls_ctr_drbg_random, &sCtrDrbg) != 0)
+        {
+            fprintf(stderr, "Failed to generate key for client %u\n", i);
+            return EXIT_FAILURE;
+        }
+
+        client.mNextRefresh = std::chrono::steady_clock::now();
+    }
+
+    {
+        auto     start        = std::chrono::steady_clock::now();
+        auto     deadline     = start + std::chrono::seconds(options.mDuration);
+        auto     sendInterval = std::chrono::microseconds(1000000 / (options.mRate > 0 ? options.mRate : 1));
+        auto     nextSend     = start;
+        uint32_t nextClient   = 0;
+
+        while (std::chrono::steady_clock::now() < deadline)
+        {
+            auto now = std::chrono::steady_clock::now();
+
+            // Paced sends: pick the next client due for a register/refresh.
+            if (now >= nextSend)
+            {
+                for (uint32_t scanned = 0; scanned < options.mNumClients; scanned++)
+                {
+                    Client &client = clients[nextClient];
+
+                    nextClient = (nextClient + 1) % options.mNumClients;
+
+                    if (client.mPendingMessageId == 0 && now >= client.mNextRefresh)
+                    {
+                        std::vector<uint8_t> update;
+
+                        client.mPendingMessageId = nextMessageId++;
+                        if (nextMessageId == 0)
+                        {
+                            nextMessageId = 1;
+                        }
+
+                        update = BuildSrpUpdate(client, options, client.mPendingMessageId);
+                        client.mSentTime = now;
+
+                        if (sendto(fd, update.data(), update.size(), 0, reinterpret_cast<struct sockaddr *>(&server),
+                                   sizeof(server)) < 0)
+                        {
+                            perror("sendto");
+                            client.mPendingMessageId = 0;
+                        }
+                        else
+                        {
+                            sent++;
+                        }
+                        break;
+                    }
+                }
+
+                nextSend += sendInterval;
+            }
+
+            // Drain responses; ID 0 is never used so matches are unambiguous.
+            {
+                struct pollfd pollFd = {fd, POLLIN, 0};
+
+                while (poll(&pollFd, 1, 1) > 0)
+                {
+                    uint8_t response[512];
+                    ssize_t length = recv(fd, response, sizeof(response), MSG_DONTWAIT);
+
+                    if (length < 12)
+                    {
+                        break;
+                    }
+
+                    {
+                        uint16_t id    = static_cast<uint16_t>(response[0] << 8 | response[1]);
+                        uint8_t  rcode = response[3] & 0x0f;
+
+                        for (Client &client : clients)
+                        {
+                            if (client.mPendingMessageId != id)
+                            {
+                                continue;
+                            }
+
+                            client.mPendingMessageId = 0;
+
+                            if (rcode == 0)
+                            {
+                                auto responseTime = std::chrono::steady_clock::now();
+
+                                latencies.push_back(static_cast<uint64_t>(
+                                    std::chrono::duration_cast<std::chrono::microseconds>(responseTime -
+                                                                                          client.mSentTime)
+                                        .count()));
+                                succeeded++;
+                                client.mRegistered  = true;
+                                client.mNextRefresh = responseTime + std::chrono::seconds(options.mLease / 2);
+                            }
+                            else
+                            {
+                                failed++;
+                                client.mNextRefresh =
+                                    std::chrono::steady_clock::now() + std::chrono::seconds(5);
+                            }
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    close(fd);
+    std::sort(latencies.begin(), latencies.end());
+
+    printf("sent %llu updates: %llu succeeded, %llu refused, %llu unanswered\n",
+           static_cast<unsigned long long>(sent), static_cast<unsigned long long>(succeeded),
+           static_cast<unsigned long long>(failed), static_cast<unsigned long long>(sent - succeeded - failed));
+    printf("registration latency: p50 %llu us, p95 %llu us, p99 %llu us\n",
+           static_cast<unsigned long long>(Percentile(latencies, 50)),
+           static_cast<unsigned long long>(Percentile(latencies, 95)),
+           static_cast<unsigned long long>(Percentile(latencies, 99)));
+
+    for (Client &client : clients)
+    {
+        mbedtls_ecdsa_free(&client.mKey);
+    }
+    mbedtls_ctr_drbg_free(&sCtrDrbg);
+    mbedtls_entropy_free(&sEntropy);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,134 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "utils/checksum.hpp"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <initializer_list>
+
+#include <CppUTest/TestHarness.h>
+
+// Byte-at-a-time reference per RFC 1071, with zero padding of an odd tail.
+static uint16_t ReferenceChecksum(const uint8_t *aBuf, size_t aLength)
+{
+    uint32_t sum = 0;
+
+    for (size_t i = 0; i < aLength; i += 2)
+    {
+        uint16_t word = static_cast<uint16_t>(aBuf[i] << 8);
+
+        if (i + 1 < aLength)
+        {
+            word |= aBuf[i + 1];
+        }
+
+        sum += word;
+    }
+
+    while (sum >> 16)
+    {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
+
+    return static_cast<uint16_t>(~sum);
+}
+
+TEST_GROUP(Checksum){};
+
+TEST(Checksum, TestRfc1071Example)
+{
+    const uint8_t  kBytes[] = {0x00, 0x01, 0xf2, 0x03, 0xf4, 0xf5, 0xf6, 0xf7};
+    otbr::Checksum checksum;
+
+    checksum.Update(kBytes, sizeof(kBytes));
+    CHECK_EQUAL(0x220d, checksum.Get());
+}
+
+TEST(Checksum, TestMatchesReferenceAcrossLengths)
+{
+    uint8_t bytes[67];
+
+    for (size_t i = 0; i < sizeof(bytes); i++)
+    {
+        bytes[i] = static_cast<uint8_t>(i * 13 + 1);
+    }
+
+    // Cover lengths below, at and above the 16-byte accumulation block,
+    // both parities included.
+    for (size_t length : {size_t(0), size_t(1), size_t(2), size_t(15), size_t(16), size_t(17), size_t(66), size_t(67)})
+    {
+        otbr::Checksum checksum;
+
+        checksum.Update(bytes, length);
+        CHECK_EQUAL(ReferenceChecksum(bytes, length), checksum.Get());
+    }
+}
+
+TEST(Checksum, TestSplitUpdatesAtOddOffsets)
+{
+    uint8_t bytes[40];
+
+    for (size_t i = 0; i < sizeof(bytes); i++)
+    {
+        bytes[i] = static_cast<uint8_t>(0xa5 ^ i);
+    }
+
+    for (size_t split = 0; split <= sizeof(bytes); split++)
+    {
+        otbr::Checksum checksum;
+
+        checksum.Update(bytes, split);
+        checksum.Update(bytes + split, sizeof(bytes) - split);
+        CHECK_EQUAL(ReferenceChecksum(bytes, sizeof(bytes)), checksum.Get());
+    }
+}
+
+TEST(Checksum, TestUpdateFieldMatchesRecompute)
+{
+    uint8_t bytes[20];
+
+    for (size_t i = 0; i < sizeof(bytes); i++)
+    {
+        bytes[i] = static_cast<uint8_t>(i * 31 + 7);
+    }
+
+    for (size_t offset = 0; offset + 1 < sizeof(bytes); offset += 2)
+    {
+        uint16_t before   = ReferenceChecksum(bytes, sizeof(bytes));
+        uint16_t oldValue = static_cast<uint16_t>((bytes[offset] << 8) | bytes[offset + 1]);
+        uint16_t newValue = static_cast<uint16_t>(oldValue ^ 0x5bd1);
+
+        bytes[offset]     = static_cast<uint8_t>(newValue >> 8);
+        bytes[offset + 1] = static_cast<uint8_t>(newValue & 0xff);
+
+        CHECK_EQUAL(ReferenceChecksum(bytes, sizeof(bytes)),
+                    otbr::Checksum::UpdateField(before, oldValue, newValue));
+    }
+}
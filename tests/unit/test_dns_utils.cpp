@@ -95,3 +95,21 @@ TEST(DnsUtils, TestSplitFullDnsName)
     CheckSplitFullDnsName("com", false, false, true, "", "", "com", ".");
     CheckSplitFullDnsName("", false, false, true, "", "", "", ".");
 }
+
+TEST(DnsUtils, TestSplitFullDnsNameView)
+{
+    const std::string fullName = "ins1._ipps._tcp.default.service.arpa";
+    DnsNameInfoView   view     = SplitFullDnsNameView(fullName.data(), fullName.length());
+
+    // The views reference the original name without copying.
+    CHECK_TRUE(view.IsServiceInstance());
+    CHECK_EQUAL(fullName.data(), view.mInstanceName.mData);
+    CHECK_EQUAL(std::string("ins1"), view.mInstanceName.ToString());
+    CHECK_EQUAL(std::string("_ipps._tcp"), view.mServiceName.ToString());
+    CHECK_EQUAL(std::string("default.service.arpa."), view.DomainString());
+
+    // Materializing the view matches the owning splitter.
+    DnsNameInfo nameInfo = view.ToNameInfo();
+    CHECK_EQUAL(SplitFullDnsName(fullName).mServiceName, nameInfo.mServiceName);
+    CHECK_EQUAL(SplitFullDnsName(fullName).mDomain, nameInfo.mDomain);
+}
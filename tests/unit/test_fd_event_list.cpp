@@ -0,0 +1,94 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/fd_event_list.hpp"
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::FdEventList;
+using otbr::MainloopContext;
+
+static MainloopContext MakeEmptyContext(void)
+{
+    MainloopContext mainloop;
+
+    mainloop.mMaxFd = -1;
+    FD_ZERO(&mainloop.mReadFdSet);
+    FD_ZERO(&mainloop.mWriteFdSet);
+    FD_ZERO(&mainloop.mErrorFdSet);
+
+    return mainloop;
+}
+
+TEST_GROUP(FdEventList){};
+
+TEST(FdEventList, TestApplySetsPreparedFdsAndMaxFd)
+{
+    FdEventList     list;
+    MainloopContext mainloop = MakeEmptyContext();
+
+    list.Add(3, FdEventList::kEventRead);
+    list.Add(70, FdEventList::kEventRead | FdEventList::kEventWrite | FdEventList::kEventError);
+    list.Apply(mainloop);
+
+    CHECK(FD_ISSET(3, &mainloop.mReadFdSet));
+    CHECK_FALSE(FD_ISSET(3, &mainloop.mWriteFdSet));
+    CHECK(FD_ISSET(70, &mainloop.mReadFdSet));
+    CHECK(FD_ISSET(70, &mainloop.mWriteFdSet));
+    CHECK(FD_ISSET(70, &mainloop.mErrorFdSet));
+    CHECK_EQUAL(70, mainloop.mMaxFd);
+}
+
+TEST(FdEventList, TestApplyMergesWithExistingFds)
+{
+    FdEventList     list;
+    MainloopContext mainloop = MakeEmptyContext();
+
+    FD_SET(5, &mainloop.mReadFdSet);
+    mainloop.mMaxFd = 200;
+
+    list.Add(9, FdEventList::kEventWrite);
+    list.Apply(mainloop);
+
+    CHECK(FD_ISSET(5, &mainloop.mReadFdSet));
+    CHECK(FD_ISSET(9, &mainloop.mWriteFdSet));
+    CHECK_EQUAL(200, mainloop.mMaxFd);
+}
+
+TEST(FdEventList, TestApplyAfterClearIsNoOp)
+{
+    FdEventList     list;
+    MainloopContext mainloop = MakeEmptyContext();
+
+    list.Add(4, FdEventList::kEventRead);
+    list.Clear();
+    list.Apply(mainloop);
+
+    CHECK_FALSE(FD_ISSET(4, &mainloop.mReadFdSet));
+    CHECK_EQUAL(-1, mainloop.mMaxFd);
+}
@@ -0,0 +1,111 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "utils/hex.hpp"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <initializer_list>
+
+#include <CppUTest/TestHarness.h>
+
+TEST_GROUP(Hex){};
+
+TEST(Hex, TestBytes2HexMatchesPrintfAcrossSizes)
+{
+    uint8_t bytes[64];
+    char    hex[2 * sizeof(bytes) + 1];
+    char    expected[2 * sizeof(bytes) + 1];
+
+    for (size_t i = 0; i < sizeof(bytes); i++)
+    {
+        bytes[i] = static_cast<uint8_t>(i * 7 + 3);
+        snprintf(&expected[2 * i], 3, "%02X", bytes[i]);
+    }
+
+    // Cover lengths below, at and above the 16-byte SIMD chunk size.
+    for (uint16_t length : {0, 1, 15, 16, 17, 32, 64})
+    {
+        CHECK_EQUAL(2 * static_cast<size_t>(length), otbr::Utils::Bytes2Hex(bytes, length, hex));
+        CHECK_EQUAL(0, strncmp(hex, expected, 2 * length));
+        CHECK_EQUAL('\0', hex[2 * length]);
+    }
+}
+
+TEST(Hex, TestHex2BytesRoundTrip)
+{
+    uint8_t bytes[64];
+    uint8_t decoded[64];
+    char    hex[2 * sizeof(bytes) + 1];
+
+    for (size_t i = 0; i < sizeof(bytes); i++)
+    {
+        bytes[i] = static_cast<uint8_t>(255 - i);
+    }
+
+    otbr::Utils::Bytes2Hex(bytes, sizeof(bytes), hex);
+    CHECK_EQUAL(static_cast<int>(sizeof(bytes)), otbr::Utils::Hex2Bytes(hex, decoded, sizeof(decoded)));
+    CHECK_EQUAL(0, memcmp(bytes, decoded, sizeof(bytes)));
+}
+
+TEST(Hex, TestHex2BytesAcceptsLowercase)
+{
+    uint8_t decoded[4];
+
+    CHECK_EQUAL(4, otbr::Utils::Hex2Bytes("deadbeef", decoded, sizeof(decoded)));
+    CHECK_EQUAL(0xde, decoded[0]);
+    CHECK_EQUAL(0xef, decoded[3]);
+}
+
+TEST(Hex, TestHex2BytesOddLength)
+{
+    uint8_t decoded[2];
+
+    // An odd-length string encodes its first byte with a single character.
+    CHECK_EQUAL(2, otbr::Utils::Hex2Bytes("ABC", decoded, sizeof(decoded)));
+    CHECK_EQUAL(0x0a, decoded[0]);
+    CHECK_EQUAL(0xbc, decoded[1]);
+}
+
+TEST(Hex, TestHex2BytesRejectsBadInput)
+{
+    uint8_t decoded[4];
+
+    CHECK_EQUAL(-1, otbr::Utils::Hex2Bytes("GG", decoded, sizeof(decoded)));
+    CHECK_EQUAL(-1, otbr::Utils::Hex2Bytes("AABBCCDDEE", decoded, sizeof(decoded)));
+}
+
+TEST(Hex, TestLong2Hex)
+{
+    char hex[2 * sizeof(uint64_t) + 1];
+
+    // Bytes are encoded starting from the least significant one.
+    CHECK_EQUAL(16, otbr::Utils::Long2Hex(UINT64_C(0x0123456789abcdef), hex));
+    STRCMP_EQUAL("EFCDAB8967452301", hex);
+}
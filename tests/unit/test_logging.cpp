@@ -97,18 +97,37 @@ TEST(Logging, TestLoggingDump)
     sleep(0);
 
     /*
-     * Above produces output like this
-     * otbr-test-5976[47088]: foobar: 0000: 6f 6e 65 20 73 75 70 65 72 20 6c 6f 6e 67 20 73
-     * otbr-test-5976[47088]: foobar: 0010: 74 72 69 6e 67 20 77 69 74 68 20 6c 6f 74 73 20
-     * otbr-test-5976[47088]: foobar: 0020: 6f 66 20 74 65 78 74 00
+     * Above produces one batched record carrying all dump lines, with the
+     * lines separated by '\n' (which syslog daemons typically escape):
+     * otbr-test-5976[47088]: foobar: 0000: 6F6E65207375706572206C6F6E672073
+     *                                0010: 7472696E672077697468206C6F747320
+     *                                0020: 6F66207465787400
      */
 
-    sprintf(cmd, "grep '%s.*: foobar: 0000: 6f 6e 65 20 73 75 70 65 72 20 6c 6f 6e 67 20 73' /var/log/syslog", ident);
+    sprintf(cmd, "grep '%s.*: foobar: 0000: 6F6E65207375706572206C6F6E672073' /var/log/syslog", ident);
     CHECK(0 == system(cmd));
 
-    sprintf(cmd, "grep '%s.*: foobar: 0010: 74 72 69 6e 67 20 77 69 74 68 20 6c 6f 74 73 20' /var/log/syslog", ident);
+    sprintf(cmd, "grep '%s.*0010: 7472696E672077697468206C6F747320' /var/log/syslog", ident);
     CHECK(0 == system(cmd));
 
-    sprintf(cmd, "grep '%s.*: foobar: 0020: 6f 66 20 74 65 78 74 00' /var/log/syslog", ident);
+    sprintf(cmd, "grep '%s.*0020: 6F66207465787400' /var/log/syslog", ident);
+    CHECK(0 == system(cmd));
+}
+
+TEST(Logging, TestLoggingBinarySink)
+{
+    char ident[20];
+    char cmd[128];
+
+    sprintf(ident, "otbr-test-%ld", clock());
+    otbrLogInit(ident, OTBR_LOG_INFO, true);
+    otbrLogEnableBinarySink(true);
+    otbrLog(OTBR_LOG_INFO, OTBR_LOG_TAG, "cool-binary %s %d %08x", "deferred", -7, 0xabcd);
+    // Disabling the sink formats and emits the captured records.
+    otbrLogEnableBinarySink(false);
+    otbrLogDeinit();
+    sleep(0);
+
+    sprintf(cmd, "grep '%s.*cool-binary deferred -7 0000abcd' /var/log/syslog", ident);
     CHECK(0 == system(cmd));
 }
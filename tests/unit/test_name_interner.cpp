@@ -0,0 +1,87 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mdns/name_interner.hpp"
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::Mdns::InternedName;
+using otbr::Mdns::NameInterner;
+
+TEST_GROUP(NameInterner){};
+
+TEST(NameInterner, TestSameSpellingSharesId)
+{
+    NameInterner &interner = NameInterner::GetInstance();
+    InternedName  first    = interner.Intern("_meshcop._udp");
+    InternedName  second   = interner.Intern("_meshcop._udp");
+    InternedName  other    = interner.Intern("_trel._udp");
+
+    CHECK(first == second);
+    CHECK(first != other);
+    STRCMP_EQUAL("_meshcop._udp", first.GetString().c_str());
+    STRCMP_EQUAL("_trel._udp", other.GetString().c_str());
+}
+
+TEST(NameInterner, TestInterningIsIdempotent)
+{
+    NameInterner &interner = NameInterner::GetInstance();
+
+    interner.Intern("_hap._tcp");
+
+    size_t count = interner.GetCount();
+
+    // Re-interning known spellings must not grow the table.
+    interner.Intern("_hap._tcp");
+    interner.Intern("_meshcop._udp");
+    CHECK_EQUAL(count, interner.GetCount());
+}
+
+TEST(NameInterner, TestLowercaseFormSharedAcrossCase)
+{
+    NameInterner &interner  = NameInterner::GetInstance();
+    InternedName  lowercase = interner.Intern("_myhome._tcp");
+    InternedName  mixed     = interner.Intern("_MyHome._TCP");
+
+    // Different spellings get distinct ids but share one lowercase form.
+    CHECK(lowercase != mixed);
+    CHECK_EQUAL(lowercase.GetLowercaseId(), mixed.GetLowercaseId());
+    STRCMP_EQUAL("_myhome._tcp", mixed.GetLowercase().c_str());
+    STRCMP_EQUAL("_MyHome._TCP", mixed.GetString().c_str());
+
+    // An all-lowercase name is its own lowercase form.
+    CHECK_EQUAL(lowercase.GetId(), lowercase.GetLowercaseId());
+}
+
+TEST(NameInterner, TestDefaultHandleIsEmptyString)
+{
+    InternedName name;
+
+    STRCMP_EQUAL("", name.GetString().c_str());
+    CHECK(name == NameInterner::GetInstance().Intern(""));
+}
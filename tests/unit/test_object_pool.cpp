@@ -0,0 +1,94 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/object_pool.hpp"
+
+#include <set>
+
+#include <CppUTest/TestHarness.h>
+
+TEST_GROUP(ObjectPool){};
+
+TEST(ObjectPool, TestSlotRecycling)
+{
+    otbr::ObjectPool pool(/* aSlotSize */ 48, /* aSlotsPerSlab */ 4);
+    void *           slots[4];
+
+    CHECK_EQUAL(0, pool.GetSlabCount());
+
+    for (void *&slot : slots)
+    {
+        slot = pool.Allocate();
+        CHECK(slot != nullptr);
+    }
+
+    CHECK_EQUAL(1, pool.GetSlabCount());
+
+    // A steady allocate/free churn must not grow the pool.
+    for (int i = 0; i < 100; i++)
+    {
+        pool.Free(slots[0]);
+        slots[0] = pool.Allocate();
+    }
+
+    CHECK_EQUAL(1, pool.GetSlabCount());
+
+    // Exhausting the slab grows the pool by exactly one slab.
+    void *extra = pool.Allocate();
+
+    CHECK(extra != nullptr);
+    CHECK_EQUAL(2, pool.GetSlabCount());
+}
+
+TEST(ObjectPool, TestSlotsAreDistinctAndReused)
+{
+    otbr::ObjectPool  pool(/* aSlotSize */ 16, /* aSlotsPerSlab */ 8);
+    std::set<void *>  slots;
+    std::set<void *>  reused;
+
+    for (int i = 0; i < 8; i++)
+    {
+        CHECK_TRUE(slots.insert(pool.Allocate()).second);
+    }
+
+    for (void *slot : slots)
+    {
+        pool.Free(slot);
+    }
+
+    // Freed slots come back instead of fresh memory.
+    for (int i = 0; i < 8; i++)
+    {
+        void *slot = pool.Allocate();
+
+        CHECK_TRUE(slots.count(slot) == 1);
+        CHECK_TRUE(reused.insert(slot).second);
+    }
+
+    CHECK_EQUAL(1, pool.GetSlabCount());
+}
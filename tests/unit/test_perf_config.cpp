@@ -0,0 +1,101 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/perf_config.hpp"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <CppUTest/TestHarness.h>
+
+static const char kTestConfigFile[] = "/tmp/otbr-test-perf.conf";
+
+static void WriteConfigFile(const char *aContent)
+{
+    FILE *file = fopen(kTestConfigFile, "w");
+
+    CHECK(file != nullptr);
+    fputs(aContent, file);
+    fclose(file);
+}
+
+TEST_GROUP(PerfConfig)
+{
+    void setup(void) override { setenv("OTBR_PERF_CONFIG_FILE", kTestConfigFile, 1); }
+
+    void teardown(void) override
+    {
+        remove(kTestConfigFile);
+        unsetenv("OTBR_PERF_CONFIG_FILE");
+    }
+};
+
+TEST(PerfConfig, TestReloadAppliesAndReverts)
+{
+    otbr::PerfConfig::Uint32Value &value =
+        otbr::PerfConfig::GetInstance().RegisterUint32("test.tunable", 100, "A test tunable.");
+
+    CHECK_EQUAL(100, value.Get());
+
+    WriteConfigFile("# comment\n"
+                    "test.tunable = 250\n"
+                    "test.unknown = 1 # ignored with a warning\n"
+                    "test.broken = oops\n");
+    otbr::PerfConfig::GetInstance().Reload();
+    CHECK_EQUAL(250, value.Get());
+
+    // A key removed from the file reverts to its default.
+    WriteConfigFile("# empty\n");
+    otbr::PerfConfig::GetInstance().Reload();
+    CHECK_EQUAL(100, value.Get());
+}
+
+TEST(PerfConfig, TestMissingFileUsesDefaults)
+{
+    otbr::PerfConfig::Uint32Value &value =
+        otbr::PerfConfig::GetInstance().RegisterUint32("test.other", 7, "Another test tunable.");
+
+    WriteConfigFile("test.other = 8\n");
+    otbr::PerfConfig::GetInstance().Reload();
+    CHECK_EQUAL(8, value.Get());
+
+    remove(kTestConfigFile);
+    otbr::PerfConfig::GetInstance().Reload();
+    CHECK_EQUAL(7, value.Get());
+}
+
+TEST(PerfConfig, TestRegisterSameKeyReturnsSameValue)
+{
+    otbr::PerfConfig::Uint32Value &value1 =
+        otbr::PerfConfig::GetInstance().RegisterUint32("test.shared", 1, "A shared test tunable.");
+    otbr::PerfConfig::Uint32Value &value2 =
+        otbr::PerfConfig::GetInstance().RegisterUint32("test.shared", 2, "A shared test tunable.");
+
+    POINTERS_EQUAL(&value1, &value2);
+    CHECK_EQUAL(1, value2.Get());
+}
@@ -0,0 +1,116 @@
+/*
+ *    Copyright (c) 2024, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/prefix_matcher.hpp"
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::Ip6Address;
+using otbr::Ip6Prefix;
+using otbr::Ip6PrefixMatcher;
+
+TEST_GROUP(PrefixMatcher){};
+
+static Ip6Prefix MakePrefix(const char *aAddress, uint8_t aLength)
+{
+    Ip6Prefix prefix;
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, Ip6Address::FromString(aAddress, prefix.mPrefix));
+    prefix.mLength = aLength;
+
+    return prefix;
+}
+
+static Ip6Address MakeAddress(const char *aAddress)
+{
+    Ip6Address address;
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, Ip6Address::FromString(aAddress, address));
+
+    return address;
+}
+
+TEST(PrefixMatcher, TestPrefixLookup)
+{
+    Ip6PrefixMatcher matcher;
+
+    CHECK_FALSE(matcher.Contains(MakeAddress("fd00:1::1")));
+
+    matcher.Insert(MakePrefix("fd00:1::", 64));
+    matcher.Insert(MakePrefix("fd00:2:3::", 48));
+
+    CHECK_TRUE(matcher.Contains(MakeAddress("fd00:1::1")));
+    CHECK_TRUE(matcher.Contains(MakeAddress("fd00:1::ffff:ffff:ffff:ffff")));
+    CHECK_TRUE(matcher.Contains(MakeAddress("fd00:2:3:4::5")));
+    CHECK_FALSE(matcher.Contains(MakeAddress("fd00:2::1")));
+    CHECK_FALSE(matcher.Contains(MakeAddress("fd00:1:1::1")));
+    CHECK_FALSE(matcher.Contains(MakeAddress("::1")));
+}
+
+TEST(PrefixMatcher, TestFullAddressLookup)
+{
+    Ip6PrefixMatcher matcher;
+
+    matcher.Insert(MakeAddress("fd00:1::1"));
+    matcher.Insert(MakeAddress("fd00:1::2"));
+
+    CHECK_TRUE(matcher.Contains(MakeAddress("fd00:1::1")));
+    CHECK_TRUE(matcher.Contains(MakeAddress("fd00:1::2")));
+    CHECK_FALSE(matcher.Contains(MakeAddress("fd00:1::3")));
+}
+
+TEST(PrefixMatcher, TestNestedPrefixes)
+{
+    Ip6PrefixMatcher matcher;
+
+    matcher.Insert(MakePrefix("fd00::", 16));
+    matcher.Insert(MakePrefix("fd00:1::", 64));
+
+    // The shorter prefix keeps matching after the longer one is removed.
+    matcher.Remove(MakePrefix("fd00:1::", 64));
+    CHECK_TRUE(matcher.Contains(MakeAddress("fd00:1::1")));
+
+    matcher.Remove(MakePrefix("fd00::", 16));
+    CHECK_FALSE(matcher.Contains(MakeAddress("fd00:1::1")));
+}
+
+TEST(PrefixMatcher, TestRemoveAndClear)
+{
+    Ip6PrefixMatcher matcher;
+
+    matcher.Insert(MakeAddress("fd00:1::1"));
+    matcher.Remove(MakeAddress("fd00:1::1"));
+    CHECK_FALSE(matcher.Contains(MakeAddress("fd00:1::1")));
+
+    // Removing an absent prefix is a no-op.
+    matcher.Remove(MakePrefix("fd00:9::", 64));
+
+    matcher.Insert(MakePrefix("fd00:1::", 64));
+    matcher.Clear();
+    CHECK_FALSE(matcher.Contains(MakeAddress("fd00:1::1")));
+}
@@ -45,4 +45,32 @@ TEST(Pskc, Test123456_0001020304050607_OpenThread)
 
     pskc = mPSKc.ComputePskc(extpanid, "OpenThread", "123456");
     MEMCMP_EQUAL(expected, pskc, sizeof(expected));
+
+    // A repeated computation is served from the cache and must return
+    // the same value.
+    pskc = mPSKc.ComputePskc(extpanid, "OpenThread", "123456");
+    MEMCMP_EQUAL(expected, pskc, sizeof(expected));
+}
+
+TEST(Pskc, TestComputePskcBatch)
+{
+    uint8_t extpanid[] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07};
+    uint8_t expected[] = {
+        0xb7, 0x83, 0x81, 0x27, 0x89, 0x91, 0x1e, 0xb4, 0xea, 0x76, 0x59, 0x6c, 0x9c, 0xed, 0x2a, 0x69,
+    };
+    std::vector<otbr::Psk::PskcBatchItem> items(3);
+
+    for (otbr::Psk::PskcBatchItem &item : items)
+    {
+        memcpy(item.mExtPanId, extpanid, sizeof(extpanid));
+        item.mNetworkName = "OpenThread";
+        item.mPassphrase  = "123456";
+    }
+    items[1].mPassphrase = "654321";
+
+    otbr::Psk::Pskc::ComputePskcBatch(items);
+
+    MEMCMP_EQUAL(expected, items[0].mPskc, sizeof(expected));
+    MEMCMP_EQUAL(expected, items[2].mPskc, sizeof(expected));
+    CHECK_TRUE(memcmp(expected, items[1].mPskc, sizeof(expected)) != 0);
 }
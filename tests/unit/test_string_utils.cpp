@@ -0,0 +1,75 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "utils/string_utils.hpp"
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::StringUtils::EqualCaseInsensitive;
+using otbr::StringUtils::ToLowercase;
+
+TEST_GROUP(StringUtils){};
+
+TEST(StringUtils, TestEqualCaseInsensitive)
+{
+    CHECK(EqualCaseInsensitive("_meshcop._udp.local.", "_MeshCoP._UDP.LOCAL."));
+    CHECK(EqualCaseInsensitive("", ""));
+    CHECK_FALSE(EqualCaseInsensitive("_meshcop._udp", "_meshcop._tcp"));
+    CHECK_FALSE(EqualCaseInsensitive("_meshcop._udp", "_meshcop._udp."));
+}
+
+TEST(StringUtils, TestCaseFoldingBoundaries)
+{
+    // '@' (0x40), '[' (0x5b), '`' (0x60) and '{' (0x7b) border the letter
+    // ranges and must not fold onto letters in the word-at-a-time path.
+    CHECK_FALSE(EqualCaseInsensitive("boundary@@@@@@@@", "boundary````````"));
+    CHECK_FALSE(EqualCaseInsensitive("boundary[[[[[[[[", "boundary{{{{{{{{"));
+    CHECK(EqualCaseInsensitive("boundary@[`{@[`{", "boundary@[`{@[`{"));
+}
+
+TEST(StringUtils, TestNonAsciiBytesCompareExactly)
+{
+    // UTF-8 instance names must compare byte-for-byte; bytes with the top
+    // bit set have no case.
+    std::string name1 = "caf\xc3\xa9 printer._ipp._tcp";
+    std::string name2 = "CAF\xc3\xa9 PRINTER._IPP._TCP";
+    std::string name3 = "caf\xc3\x89 printer._ipp._tcp";
+
+    CHECK(EqualCaseInsensitive(name1, name2));
+    CHECK_FALSE(EqualCaseInsensitive(name1, name3));
+}
+
+TEST(StringUtils, TestToLowercaseOddLengths)
+{
+    // Lengths around the 8-byte word size exercise both the word path and
+    // the per-character tail.
+    STRCMP_EQUAL("abcdefg", ToLowercase("ABCDEFG").c_str());
+    STRCMP_EQUAL("abcdefgh", ToLowercase("ABCDEFGH").c_str());
+    STRCMP_EQUAL("abcdefghi", ToLowercase("ABCDEFGHI").c_str());
+    STRCMP_EQUAL("_trel._udp,2-f1x", ToLowercase("_TREL._UDP,2-F1X").c_str());
+}
@@ -98,6 +98,36 @@ TEST(TaskRunner, TestTasksOrder)
     STRCMP_EQUAL("abc", str.c_str());
 }
 
+TEST(TaskRunner, TestTaskPriorities)
+{
+    std::string           str;
+    otbr::TaskRunner      taskRunner;
+    int                   rval;
+    otbr::MainloopContext mainloop;
+
+    // Post in reverse priority order; draining must reorder them.
+    taskRunner.Post(otbr::TaskRunner::Priority::kBulk, [&]() { str.push_back('c'); });
+    taskRunner.Post(otbr::TaskRunner::Priority::kNormal, [&]() { str.push_back('b'); });
+    taskRunner.Post(otbr::TaskRunner::Priority::kLatencyCritical, [&]() { str.push_back('a'); });
+
+    mainloop.mMaxFd   = -1;
+    mainloop.mTimeout = {2, 0};
+
+    FD_ZERO(&mainloop.mReadFdSet);
+    FD_ZERO(&mainloop.mWriteFdSet);
+    FD_ZERO(&mainloop.mErrorFdSet);
+
+    taskRunner.Update(mainloop);
+    rval = select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
+                  &mainloop.mTimeout);
+    CHECK_TRUE(rval == 1);
+
+    taskRunner.Process(mainloop);
+
+    // Latency-critical runs first, then normal, then bulk.
+    STRCMP_EQUAL("abc", str.c_str());
+}
+
 TEST(TaskRunner, TestMultipleThreads)
 {
     std::atomic<int>         counter{0};
@@ -0,0 +1,179 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/timer_wheel.hpp"
+
+#include <vector>
+
+#include <CppUTest/TestHarness.h>
+
+struct WheelItem
+{
+    int mId;
+};
+
+TEST_GROUP(TimerWheel){};
+
+TEST(TimerWheel, TestExpiryAndRemoval)
+{
+    otbr::TimerWheel<WheelItem> wheel(/* aSlotWidthMs */ 100, /* aSlotCount */ 64);
+    WheelItem                   items[3] = {{0}, {1}, {2}};
+    otbr::Timepoint             now      = otbr::Clock::now();
+    std::vector<int>            fired;
+
+    wheel.Schedule(&items[0], now + otbr::Milliseconds(100));
+    wheel.Schedule(&items[1], now + otbr::Milliseconds(1000));
+    wheel.Schedule(&items[2], now + otbr::Milliseconds(2000));
+    CHECK_EQUAL(3, wheel.GetCount());
+
+    // Nothing is due before the first deadline.
+    wheel.Advance(now + otbr::Milliseconds(50), [&fired](WheelItem &aItem) { fired.push_back(aItem.mId); });
+    CHECK_EQUAL(0, fired.size());
+
+    // Only the first item is due; an expired item leaves the wheel.
+    wheel.Advance(now + otbr::Milliseconds(500), [&fired](WheelItem &aItem) { fired.push_back(aItem.mId); });
+    CHECK_EQUAL(1, fired.size());
+    CHECK_EQUAL(0, fired[0]);
+    CHECK_EQUAL(2, wheel.GetCount());
+
+    // A removed item never fires.
+    wheel.Remove(&items[1]);
+    wheel.Advance(now + otbr::Milliseconds(3000), [&fired](WheelItem &aItem) { fired.push_back(aItem.mId); });
+    CHECK_EQUAL(2, fired.size());
+    CHECK_EQUAL(2, fired[1]);
+    CHECK_EQUAL(0, wheel.GetCount());
+}
+
+TEST(TimerWheel, TestRescheduleMovesDeadline)
+{
+    otbr::TimerWheel<WheelItem> wheel(/* aSlotWidthMs */ 100, /* aSlotCount */ 64);
+    WheelItem                   item = {7};
+    otbr::Timepoint             now  = otbr::Clock::now();
+    int                         firedCount = 0;
+
+    wheel.Schedule(&item, now + otbr::Milliseconds(200));
+    wheel.Schedule(&item, now + otbr::Milliseconds(4000));
+    CHECK_EQUAL(1, wheel.GetCount());
+
+    // The first deadline was superseded and must not fire.
+    wheel.Advance(now + otbr::Milliseconds(1000), [&firedCount](WheelItem &) { firedCount++; });
+    CHECK_EQUAL(0, firedCount);
+
+    wheel.Advance(now + otbr::Milliseconds(5000), [&firedCount](WheelItem &) { firedCount++; });
+    CHECK_EQUAL(1, firedCount);
+}
+
+TEST(TimerWheel, TestHandlerMayReschedule)
+{
+    otbr::TimerWheel<WheelItem> wheel(/* aSlotWidthMs */ 100, /* aSlotCount */ 64);
+    WheelItem                   item = {1};
+    otbr::Timepoint             now  = otbr::Clock::now();
+    int                         firedCount = 0;
+
+    wheel.Schedule(&item, now + otbr::Milliseconds(100));
+
+    // A periodic item reschedules itself from its own handler.
+    wheel.Advance(now + otbr::Milliseconds(500), [&](WheelItem &aItem) {
+        firedCount++;
+        wheel.Schedule(&aItem, now + otbr::Milliseconds(1000));
+    });
+    CHECK_EQUAL(1, firedCount);
+    CHECK_EQUAL(1, wheel.GetCount());
+
+    wheel.Advance(now + otbr::Milliseconds(1500), [&firedCount](WheelItem &) { firedCount++; });
+    CHECK_EQUAL(2, firedCount);
+    CHECK_EQUAL(0, wheel.GetCount());
+}
+
+TEST(TimerWheel, TestNextDeadlineTracksEarliest)
+{
+    otbr::TimerWheel<WheelItem> wheel(/* aSlotWidthMs */ 100, /* aSlotCount */ 64);
+    WheelItem                   items[2] = {{0}, {1}};
+    otbr::Timepoint             now      = otbr::Clock::now();
+
+    CHECK(wheel.GetNextDeadline() == otbr::Timepoint::max());
+
+    wheel.Schedule(&items[0], now + otbr::Milliseconds(3000));
+    wheel.Schedule(&items[1], now + otbr::Milliseconds(700));
+    CHECK(wheel.GetNextDeadline() <= now + otbr::Milliseconds(700));
+    CHECK(wheel.GetNextDeadline() > now);
+
+    wheel.Remove(&items[1]);
+    CHECK(wheel.GetNextDeadline() == now + otbr::Milliseconds(3000));
+}
+
+TEST(TimerWheel, TestPastDeadlineFiresOnNextAdvance)
+{
+    otbr::TimerWheel<WheelItem> wheel(/* aSlotWidthMs */ 100, /* aSlotCount */ 64);
+    WheelItem                   item = {3};
+    otbr::Timepoint             now  = otbr::Clock::now();
+    int                         firedCount = 0;
+
+    // A deadline already in the past must fire on the very next sweep, even
+    // though its natural slot lies behind the cursor.
+    wheel.Schedule(&item, now - otbr::Milliseconds(60000));
+    wheel.Advance(now, [&firedCount](WheelItem &) { firedCount++; });
+    CHECK_EQUAL(1, firedCount);
+    CHECK_EQUAL(0, wheel.GetCount());
+}
+
+TEST(TimerWheel, TestFullLapStallFiresOnce)
+{
+    otbr::TimerWheel<WheelItem> wheel(/* aSlotWidthMs */ 100, /* aSlotCount */ 64);
+    WheelItem                   item = {5};
+    otbr::Timepoint             now  = otbr::Clock::now();
+    int                         firedCount = 0;
+
+    // A stall longer than the wheel horizon (6.4 s here) makes the sweep
+    // scan a full lap; the cursor slot must still be visited only once so
+    // its items are not dispatched twice.
+    wheel.Schedule(&item, now + otbr::Milliseconds(100));
+    wheel.Advance(now + otbr::Milliseconds(20000), [&firedCount](WheelItem &) { firedCount++; });
+    CHECK_EQUAL(1, firedCount);
+    CHECK_EQUAL(0, wheel.GetCount());
+}
+
+TEST(TimerWheel, TestHandlerMayRemovePeerItem)
+{
+    otbr::TimerWheel<WheelItem> wheel(/* aSlotWidthMs */ 100, /* aSlotCount */ 64);
+    WheelItem                   items[2] = {{0}, {1}};
+    otbr::Timepoint             now      = otbr::Clock::now();
+    std::vector<int>            fired;
+
+    // A handler removing another item expired in the same batch must
+    // suppress that item's dispatch: whichever item is handled first
+    // removes its peer, so exactly one handler call happens.
+    wheel.Schedule(&items[0], now + otbr::Milliseconds(100));
+    wheel.Schedule(&items[1], now + otbr::Milliseconds(100));
+    wheel.Advance(now + otbr::Milliseconds(500), [&](WheelItem &aItem) {
+        fired.push_back(aItem.mId);
+        wheel.Remove(&items[1 - aItem.mId]);
+    });
+    CHECK_EQUAL(1, fired.size());
+    CHECK_EQUAL(0, wheel.GetCount());
+}
@@ -0,0 +1,150 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/tlv.hpp"
+
+#include <CppUTest/TestHarness.h>
+
+TEST_GROUP(Tlv){};
+
+TEST(Tlv, TestTlvRangeIteratesAllTlvs)
+{
+    // Type 1, length 2, value {0x11, 0x22}; type 2, length 1, value {0x33}.
+    const uint8_t buffer[] = {0x01, 0x02, 0x11, 0x22, 0x02, 0x01, 0x33};
+    otbr::TlvRange range(buffer, sizeof(buffer));
+    size_t         count = 0;
+
+    for (const otbr::Tlv &tlv : range)
+    {
+        switch (count++)
+        {
+        case 0:
+            CHECK_EQUAL(1, tlv.GetType());
+            CHECK_EQUAL(2, tlv.GetLength());
+            CHECK_EQUAL(0x11, static_cast<const uint8_t *>(tlv.GetValue())[0]);
+            break;
+        case 1:
+            CHECK_EQUAL(2, tlv.GetType());
+            CHECK_EQUAL(1, tlv.GetLength());
+            CHECK_EQUAL(0x33, tlv.GetValueUInt8());
+            break;
+        }
+    }
+
+    CHECK_EQUAL(2, count);
+}
+
+TEST(Tlv, TestTlvRangeStopsAtTruncatedTlv)
+{
+    // The second Tlv claims 4 value bytes but only 1 remains in the buffer.
+    const uint8_t buffer[] = {0x01, 0x01, 0x11, 0x02, 0x04, 0x33};
+    otbr::TlvRange range(buffer, sizeof(buffer));
+    size_t         count = 0;
+
+    for (const otbr::Tlv &tlv : range)
+    {
+        CHECK_EQUAL(1, tlv.GetType());
+        count++;
+    }
+
+    CHECK_EQUAL(1, count);
+}
+
+TEST(Tlv, TestTlvRangeStopsAtTruncatedExtendedLengthTlv)
+{
+    // The second Tlv starts an extended-length header (length byte 0xff) but
+    // the buffer ends before the two extended length bytes; the iteration
+    // must stop without reading past the buffer.
+    const uint8_t  buffer[] = {0x01, 0x01, 0x11, 0x02, 0xff};
+    otbr::TlvRange range(buffer, sizeof(buffer));
+    size_t         count = 0;
+
+    for (const otbr::Tlv &tlv : range)
+    {
+        CHECK_EQUAL(1, tlv.GetType());
+        count++;
+    }
+
+    CHECK_EQUAL(1, count);
+
+    // One extended length byte present, one missing: still truncated.
+    const uint8_t  shortByOne[] = {0x02, 0xff, 0x00};
+    otbr::TlvRange headerOnly(shortByOne, sizeof(shortByOne));
+
+    CHECK_TRUE(headerOnly.begin() == headerOnly.end());
+}
+
+TEST(Tlv, TestTlvRangeIteratesExtendedLengthTlv)
+{
+    // Type 3, extended length 2 (0xff escape plus big-endian 0x0002).
+    const uint8_t  buffer[] = {0x03, 0xff, 0x00, 0x02, 0xaa, 0xbb};
+    otbr::TlvRange range(buffer, sizeof(buffer));
+    size_t         count = 0;
+
+    for (const otbr::Tlv &tlv : range)
+    {
+        CHECK_EQUAL(3, tlv.GetType());
+        CHECK_EQUAL(2, tlv.GetLength());
+        CHECK_EQUAL(0xaa, static_cast<const uint8_t *>(tlv.GetValue())[0]);
+        count++;
+    }
+
+    CHECK_EQUAL(1, count);
+}
+
+TEST(Tlv, TestTlvRangeHandlesEmptyBuffer)
+{
+    const uint8_t  buffer[] = {0x01};
+    otbr::TlvRange empty(buffer, 0);
+    otbr::TlvRange headerOnly(buffer, sizeof(buffer));
+
+    CHECK_TRUE(empty.begin() == empty.end());
+    CHECK_TRUE(headerOnly.begin() == headerOnly.end());
+    CHECK_TRUE(empty.FindTlv(0x01) == nullptr);
+}
+
+TEST(Tlv, TestTlvRangeFindTlv)
+{
+    const uint8_t buffer[] = {0x01, 0x02, 0x11, 0x22, 0x02, 0x01, 0x33};
+    otbr::TlvRange range(buffer, sizeof(buffer));
+
+    CHECK_TRUE(range.FindTlv(0x01) != nullptr);
+    CHECK_EQUAL(2, range.FindTlv(0x02)->GetType());
+    CHECK_TRUE(range.FindTlv(0x03) == nullptr);
+}
+
+TEST(Tlv, TestTlvIndexFindsFirstOccurrence)
+{
+    // Two Tlvs of type 1; the index must return the first one.
+    const uint8_t buffer[] = {0x01, 0x01, 0xaa, 0x02, 0x01, 0x33, 0x01, 0x01, 0xbb};
+    otbr::TlvIndex index(buffer, sizeof(buffer));
+
+    CHECK_EQUAL(0xaa, index.FindTlv(0x01)->GetValueUInt8());
+    CHECK_EQUAL(0x33, index.FindTlv(0x02)->GetValueUInt8());
+    CHECK_TRUE(index.FindTlv(0x03) == nullptr);
+}
@@ -0,0 +1,77 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/types.hpp"
+
+#include <string.h>
+
+#include <CppUTest/TestHarness.h>
+
+static void CheckIp6AddressToString(const char *aAddrString)
+{
+    otbr::Ip6Address addr;
+    char             buffer[otbr::Ip6Address::kStringSize];
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, otbr::Ip6Address::FromString(aAddrString, addr));
+
+    // The buffer variant and the allocating variant must agree, and round
+    // trip the canonical text form.
+    CHECK_EQUAL(strlen(aAddrString), addr.ToString(buffer, sizeof(buffer)));
+    STRCMP_EQUAL(aAddrString, buffer);
+    CHECK_EQUAL(std::string(aAddrString), addr.ToString());
+}
+
+TEST_GROUP(Types){};
+
+TEST(Types, TestIp6AddressToString)
+{
+    CheckIp6AddressToString("::");
+    CheckIp6AddressToString("::1");
+    CheckIp6AddressToString("fe80::1");
+    CheckIp6AddressToString("fd00:db8::a:b");
+    CheckIp6AddressToString("2001:db8:0:1:1:1:1:1");
+    CheckIp6AddressToString("1:0:0:2::3");
+    CheckIp6AddressToString("ff02::1:ff00:0");
+    CheckIp6AddressToString("1:2:3:4:5:6:7:8");
+    // Embedded IPv4 forms.
+    CheckIp6AddressToString("::ffff:192.0.2.1");
+    CheckIp6AddressToString("::192.0.2.1");
+}
+
+TEST(Types, TestIp6PrefixToString)
+{
+    otbr::Ip6Prefix prefix;
+    char            buffer[otbr::Ip6Prefix::kStringSize];
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, otbr::Ip6Address::FromString("fd00:db8::", prefix.mPrefix));
+    prefix.mLength = 64;
+
+    CHECK_EQUAL(strlen("fd00:db8::/64"), prefix.ToString(buffer, sizeof(buffer)));
+    STRCMP_EQUAL("fd00:db8::/64", buffer);
+    CHECK_EQUAL(std::string("fd00:db8::/64"), prefix.ToString());
+}
@@ -36,6 +36,8 @@
 #include <stdlib.h>
 #include <sysexits.h>
 
+#include <vector>
+
 #include "common/code_utils.hpp"
 #include "utils/hex.hpp"
 #include "utils/steering_data.hpp"
@@ -45,10 +47,15 @@ void help(void)
     printf("steering-data - compute steering data\n"
            "SYNTAX:\n"
            "    steering-data [LENGTH] <JOINER_ID> ...\n"
+           "    steering-data [LENGTH] -\n"
+           "With '-', EUI64s are read from stdin, one per line, and folded\n"
+           "into a single bloom filter - use this for mass commissioning\n"
+           "instead of one invocation per device.\n"
            "EXAMPLE:\n"
            "    steering-data 18b4300000000001\n"
            "    steering-data 15 18b4300000000001\n"
-           "    steering-data 18b4300000000001 18b4300000000002\n");
+           "    steering-data 18b4300000000001 18b4300000000002\n"
+           "    steering-data - < eui64-list.txt\n");
 }
 
 int ComputeJoinerId(const char *aEui64, uint8_t *aJoinerId)
@@ -93,12 +100,36 @@ int main(int argc, char *argv[])
 
     computer.Init(static_cast<uint8_t>(length));
 
-    for (; i < argc; ++i)
+    if (i < argc && strcmp(argv[i], "-") == 0)
+    {
+        std::vector<uint8_t> joinerIds;
+        char                 line[64];
+
+        while (fgets(line, sizeof(line), stdin) != nullptr)
+        {
+            uint8_t joinerId[otbr::SteeringData::kSizeJoinerId];
+
+            line[strcspn(line, "\r\n")] = '\0';
+            if (line[0] == '\0')
+            {
+                continue;
+            }
+
+            VerifyOrExit(ComputeJoinerId(line, joinerId) == 0, fprintf(stderr, "Invalid EUI64 : %s\n", line));
+            joinerIds.insert(joinerIds.end(), joinerId, joinerId + sizeof(joinerId));
+        }
+
+        computer.ComputeBloomFilters(joinerIds.data(), joinerIds.size() / otbr::SteeringData::kSizeJoinerId);
+    }
+    else
     {
-        uint8_t joinerId[otbr::SteeringData::kSizeJoinerId];
+        for (; i < argc; ++i)
+        {
+            uint8_t joinerId[otbr::SteeringData::kSizeJoinerId];
 
-        VerifyOrExit(ComputeJoinerId(argv[i], joinerId) == 0, fprintf(stderr, "Invalid EUI64 : %s\n", argv[i]));
-        computer.ComputeBloomFilter(joinerId);
+            VerifyOrExit(ComputeJoinerId(argv[i], joinerId) == 0, fprintf(stderr, "Invalid EUI64 : %s\n", argv[i]));
+            computer.ComputeBloomFilter(joinerId);
+        }
     }
 
     for (i = 0; i < length; i++)